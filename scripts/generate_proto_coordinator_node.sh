@@ -19,6 +19,7 @@ echo "=== Generating Protocol Buffer files ==="
 PROTO_FILES=(
     "coordinator_node/common.proto"
     "coordinator_node/signing.proto"
+    "coordinator_node/error.proto"
     "coordinator_node/message.proto"
 )
 
@@ -19,6 +19,7 @@ echo "=== Generating Wallet-Coordinator Protocol Buffer files ==="
 PROTO_FILES=(
     "wallet_coordinator/wallet_common.proto"
     "wallet_coordinator/wallet_signing.proto"
+    "wallet_coordinator/wallet_key.proto"
     "wallet_coordinator/wallet_message.proto"
 )
 
@@ -0,0 +1,174 @@
+// src/common/network/framing/relay.hpp
+#pragma once
+#include "tcp.hpp"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mpc_engine::network::framing
+{
+    /**
+     * MPC 라운드 중계 프레임 (MessageType::MPC_RELAY_ROUND)
+     *
+     * Node → Coordinator 응답 body = envelope 1개
+     *   [RelayEnvelopeHeader][session_id][recipients: uint64 × recipient_count][payload][0 padding]
+     * Coordinator → Node 요청 body = 라운드 요청 + 직전 라운드 envelope들
+     *   [RelayFrameHeader][CoordinatorNodeMessage (peer_messages 없는 MpcRoundRequest)][0 padding][envelope]...
+     *
+     * Coordinator는 envelope의 routing header만 읽고 payload는 해석하지 않음 - 수신한 응답 body를
+     * 그대로 수신자별 요청 프레임의 segment로 공유 (복사/재직렬화 없음).
+     * 각 부분은 4바이트 단위로 padding되어 있어 프레임 checksum = 부분 checksum의 XOR
+     * (envelope checksum은 노드 응답 프레임 header의 값을 재사용)
+     */
+    constexpr uint32_t RELAY_ENVELOPE_MAGIC = 0x5243504D;   // "MPCR"
+    constexpr size_t RELAY_ALIGNMENT = 4;
+
+    struct RelayEnvelopeHeader
+    {
+        uint32_t magic = RELAY_ENVELOPE_MAGIC;
+        uint32_t round = 0;
+        uint64_t from_player = 0;
+        uint32_t payload_length = 0;
+        uint16_t session_id_length = 0;
+        uint16_t recipient_count = 0;       // 0 = 세션의 모든 참여자
+    } __attribute__((packed));
+
+    struct RelayFrameHeader
+    {
+        uint32_t request_length = 0;
+        uint32_t envelope_count = 0;
+    } __attribute__((packed));
+
+    inline size_t RelayPadded(size_t length)
+    {
+        return (length + RELAY_ALIGNMENT - 1) & ~(RELAY_ALIGNMENT - 1);
+    }
+
+    /**
+     * @brief 디코딩된 envelope (버퍼를 참조 - 버퍼보다 오래 쓰지 말 것)
+     */
+    struct RelayEnvelopeView
+    {
+        uint32_t round = 0;
+        uint64_t from_player = 0;
+        std::string_view session_id;
+        std::string_view payload;
+        const uint8_t* recipients = nullptr;    // 정렬되지 않은 uint64 배열
+        uint16_t recipient_count = 0;
+        size_t size = 0;                        // padding 포함 envelope 길이
+
+        bool AddressedTo(uint64_t player_id) const
+        {
+            if (recipient_count == 0) {
+                return true;
+            }
+            for (uint16_t i = 0; i < recipient_count; ++i) {
+                uint64_t recipient;
+                memcpy(&recipient, recipients + i * sizeof(uint64_t), sizeof(uint64_t));
+                if (recipient == player_id) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    inline std::vector<uint8_t> EncodeRelayEnvelope(const std::string& session_id, uint32_t round, uint64_t from_player,
+                                                    const std::vector<uint64_t>& recipients, const std::string& payload)
+    {
+        RelayEnvelopeHeader header;
+        header.round = round;
+        header.from_player = from_player;
+        header.payload_length = static_cast<uint32_t>(payload.size());
+        header.session_id_length = static_cast<uint16_t>(session_id.size());
+        header.recipient_count = static_cast<uint16_t>(recipients.size());
+
+        size_t length = sizeof(header) + session_id.size() + recipients.size() * sizeof(uint64_t) + payload.size();
+        std::vector<uint8_t> envelope(RelayPadded(length), 0);
+        uint8_t* out = envelope.data();
+        memcpy(out, &header, sizeof(header));
+        out += sizeof(header);
+        memcpy(out, session_id.data(), session_id.size());
+        out += session_id.size();
+        if (!recipients.empty()) {
+            memcpy(out, recipients.data(), recipients.size() * sizeof(uint64_t));
+            out += recipients.size() * sizeof(uint64_t);
+        }
+        memcpy(out, payload.data(), payload.size());
+        return envelope;
+    }
+
+    /**
+     * @brief data에서 envelope 1개 디코딩 (routing header와 길이만 검사, payload는 읽지 않음)
+     * @return 형식 오류 / 길이 초과 시 false
+     */
+    inline bool DecodeRelayEnvelope(const uint8_t* data, size_t length, RelayEnvelopeView* view)
+    {
+        RelayEnvelopeHeader header;
+        if (length < sizeof(header)) {
+            return false;
+        }
+        memcpy(&header, data, sizeof(header));
+        if (header.magic != RELAY_ENVELOPE_MAGIC || header.session_id_length == 0) {
+            return false;
+        }
+
+        size_t recipients_size = static_cast<size_t>(header.recipient_count) * sizeof(uint64_t);
+        size_t used = sizeof(header) + header.session_id_length + recipients_size + header.payload_length;
+        if (RelayPadded(used) > length) {
+            return false;
+        }
+
+        const uint8_t* cursor = data + sizeof(header);
+        view->round = header.round;
+        view->from_player = header.from_player;
+        view->session_id = std::string_view(reinterpret_cast<const char*>(cursor), header.session_id_length);
+        cursor += header.session_id_length;
+        view->recipients = cursor;
+        view->recipient_count = header.recipient_count;
+        cursor += recipients_size;
+        view->payload = std::string_view(reinterpret_cast<const char*>(cursor), header.payload_length);
+        view->size = RelayPadded(used);
+        return true;
+    }
+
+    // 요청 프레임 앞부분 (RelayFrameHeader + 라운드 요청 + padding) 길이 - envelope는 이 뒤에 이어짐
+    inline size_t RelayFramePrefixSize(size_t request_length)
+    {
+        return RelayPadded(sizeof(RelayFrameHeader) + request_length);
+    }
+
+    /**
+     * @brief 요청 프레임 body 디코딩
+     * @param request 라운드 요청 (serialized CoordinatorNodeMessage)
+     * @return 형식 오류 / envelope 수·길이 불일치 시 false
+     */
+    inline bool DecodeRelayFrame(const std::vector<uint8_t>& body, std::string_view* request, std::vector<RelayEnvelopeView>* envelopes)
+    {
+        RelayFrameHeader header;
+        if (body.size() < sizeof(header)) {
+            return false;
+        }
+        memcpy(&header, body.data(), sizeof(header));
+
+        size_t offset = RelayFramePrefixSize(header.request_length);
+        if (offset > body.size()) {
+            return false;
+        }
+        *request = std::string_view(reinterpret_cast<const char*>(body.data() + sizeof(header)), header.request_length);
+
+        envelopes->clear();
+        envelopes->reserve(header.envelope_count);
+        for (uint32_t i = 0; i < header.envelope_count; ++i) {
+            RelayEnvelopeView view;
+            if (!DecodeRelayEnvelope(body.data() + offset, body.size() - offset, &view)) {
+                return false;
+            }
+            envelopes->push_back(view);
+            offset += view.size;
+        }
+        return offset == body.size();
+    }
+} // namespace mpc_engine::network::framing
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <cstring>
+#include <memory>
 
 namespace mpc_engine::network::framing
 {
@@ -48,14 +49,16 @@ namespace mpc_engine::network::framing
         uint16_t message_type;
         uint32_t body_length;
         uint32_t checksum;
-        uint64_t timestamp;
+        // 요청: 송신 시점의 남은 처리 기한 (ms, 0 = 없음) - 수신 측이 자기 시계 기준 기한으로 환산 (utils::DeadlineAfter)
+        // 이전 버전은 이 자리에 송신 시각(epoch ms)을 넣었으나 읽는 곳이 없었음 - 그 값은 수신 측 상한에 묶여 무해
+        uint64_t timeout_ms;
         uint64_t request_id;
 
         MessageHeader() 
-            : message_type(0), body_length(0), checksum(0), timestamp(0), request_id(0) {}
+            : message_type(0), body_length(0), checksum(0), timeout_ms(0), request_id(0) {}
 
         MessageHeader(uint16_t type, uint32_t length) 
-            : message_type(type), body_length(length), checksum(0), timestamp(0), request_id(0) {}
+            : message_type(type), body_length(length), checksum(0), timeout_ms(0), request_id(0) {}
 
         // 기본 헤더 검증
         ValidationResult ValidateBasic() const 
@@ -103,6 +106,10 @@ namespace mpc_engine::network::framing
         MessageHeader header;
         std::vector<uint8_t> body;
 
+        // 송신 전용: body 뒤에 이어 보낼 공유 버퍼 (중계 프레임이 수신자별로 같은 envelope 재사용)
+        // header.body_length = body + segments 전체 길이 / 수신한 메시지는 항상 body 하나
+        std::vector<std::shared_ptr<const std::vector<uint8_t>>> segments;
+
         NetworkMessage() = default;
         
         NetworkMessage(uint16_t type, const std::vector<uint8_t>& data) 
@@ -153,7 +160,11 @@ namespace mpc_engine::network::framing
 
         size_t GetTotalSize() const 
         {
-            return sizeof(MessageHeader) + body.size();
+            size_t total = sizeof(MessageHeader) + body.size();
+            for (const auto& segment : segments) {
+                total += segment->size();
+            }
+            return total;
         }
     };
 } // namespace mpc_engine::network::framing
\ No newline at end of file
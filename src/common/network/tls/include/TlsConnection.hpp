@@ -3,6 +3,7 @@
 
 #include "TlsContext.hpp"
 #include "types/BasicTypes.hpp"
+#include <mutex>
 #include <string>
 
 namespace mpc_engine::network::tls
@@ -91,6 +92,9 @@ namespace mpc_engine::network::tls
     {
     private:
         SSL* ssl = nullptr;
+        // 송신/수신 스레드가 같은 연결을 동시에 사용 - SSL 객체는 스레드 안전하지 않으므로
+        // SSL_read/SSL_write 호출 단위로 직렬화 (소켓은 논블로킹이라 대기는 lock 밖 select)
+        std::mutex ssl_mutex;
         socket_t socket_fd = INVALID_SOCKET_VALUE;
         TlsConnectionState state = TlsConnectionState::DISCONNECTED;
         TlsConnectionConfig config;
@@ -196,6 +200,17 @@ namespace mpc_engine::network::tls
          */
         std::string GetPeerCertificateInfo() const;
 
+        /**
+         * @brief 피어 인증서 (참조 1 증가 - 호출자가 X509_free)
+         * @return 미연결 / 인증서 없음이면 nullptr
+         */
+        X509* GetPeerCertificate() const;
+
+        /**
+         * @brief 피어 인증서가 name(SAN DNS / CN)으로 발급되었는지 (X509_check_host)
+         */
+        bool VerifyPeerName(const std::string& name) const;
+
         /**
          * @brief 사용된 암호화 스위트 정보
          */
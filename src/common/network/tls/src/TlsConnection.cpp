@@ -205,6 +205,7 @@ namespace mpc_engine::network::tls
             return last_error;
         }
 
+        std::lock_guard<std::mutex> lock(ssl_mutex);
         ClearError();
 
         int result = SSL_read(ssl, buffer, length);
@@ -235,6 +236,7 @@ namespace mpc_engine::network::tls
             return last_error;
         }
 
+        std::lock_guard<std::mutex> lock(ssl_mutex);
         ClearError();
 
         int result = SSL_write(ssl, data, length);
@@ -313,6 +315,7 @@ namespace mpc_engine::network::tls
 
         if (ssl) {
             // Graceful shutdown (양방향 종료)
+            std::lock_guard<std::mutex> lock(ssl_mutex);
             int result = SSL_shutdown(ssl);
             if (result == 0) {
                 // 첫 번째 단계만 완료, 두 번째 시도
@@ -357,6 +360,19 @@ namespace mpc_engine::network::tls
         return std::string("Subject: ") + subject + ", Issuer: " + issuer;
     }
 
+    X509* TlsConnection::GetPeerCertificate() const 
+    {
+        if (!ssl || state != TlsConnectionState::CONNECTED) {
+            return nullptr;
+        }
+        return SSL_get_peer_certificate(ssl);
+    }
+
+    bool TlsConnection::VerifyPeerName(const std::string& name) const 
+    {
+        return state == TlsConnectionState::CONNECTED && TlsConnectionHelper::VerifyHostname(ssl, name);
+    }
+
     std::string TlsConnection::GetCipherInfo() const 
     {
         if (!ssl || state != TlsConnectionState::CONNECTED) {
@@ -496,11 +512,9 @@ namespace mpc_engine::network::tls
                 return false;
             }
 
-            // TODO: 실제 hostname 검증 구현
-            // X509_check_host() 사용
-
+            bool matched = X509_check_host(cert, hostname.c_str(), hostname.size(), 0, nullptr) == 1;
             X509_free(cert);
-            return true;
+            return matched;
         }
 
         void PrintCertificateChain(SSL* ssl) 
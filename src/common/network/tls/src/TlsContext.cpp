@@ -5,6 +5,7 @@
 #include <openssl/bio.h>
 #include <iostream>
 #include <cstring>
+#include <signal.h>
 
 namespace mpc_engine::network::tls
 {
@@ -244,6 +245,10 @@ namespace mpc_engine::network::tls
         SSL_library_init();
         SSL_load_error_strings();
         OpenSSL_add_all_algorithms();
+
+        // socket BIO는 write()를 사용 - 종료 중인 연결에서 SSL_read/SSL_write가
+        // 기록을 시도하면 SIGPIPE로 프로세스가 종료되므로 EPIPE 에러로 처리
+        signal(SIGPIPE, SIG_IGN);
     }
 
     void TlsContext::GlobalCleanup() 
@@ -0,0 +1,183 @@
+// src/common/utils/metrics/LatencyHistogram.hpp
+#pragma once
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+namespace mpc_engine::utils
+{
+    /**
+     * @brief 단조 시계 (ns) - 지연 측정용
+     * @note steady_clock은 Linux에서 vDSO clock_gettime(CLOCK_MONOTONIC) → syscall 없음
+     */
+    inline uint64_t MonotonicNowNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    struct LatencySnapshot
+    {
+        uint64_t count = 0;
+        uint64_t min_ns = 0;
+        uint64_t max_ns = 0;
+        uint64_t mean_ns = 0;
+        uint64_t p50_ns = 0;
+        uint64_t p90_ns = 0;
+        uint64_t p99_ns = 0;
+        uint64_t p999_ns = 0;
+    };
+
+    /**
+     * @brief Lock-free HDR 스타일 지연 히스토그램 (ns)
+     *
+     * log-linear 버킷: 2의 거듭제곱 구간마다 SUB_BUCKET_HALF개로 균등 분할
+     * → 상대 오차 ≤ 1/SUB_BUCKET_HALF (≈1.6%), 1ns ~ 2^MAX_MAGNITUDE ns(약 2.4시간) 범위
+     *
+     * Record()는 relaxed atomic 증가 몇 번뿐이라 핸들러/송신 스레드 hot path에서 호출 가능.
+     * Snapshot()은 버킷을 순회하므로 덤프 주기로만 호출할 것.
+     */
+    class LatencyHistogram
+    {
+    public:
+        static constexpr uint32_t SUB_BUCKET_BITS = 7;
+        static constexpr uint64_t SUB_BUCKET_COUNT = 1ULL << SUB_BUCKET_BITS;
+        static constexpr uint64_t SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;
+        static constexpr uint32_t MAX_MAGNITUDE = 43;
+        static constexpr size_t BUCKET_COUNT =
+            SUB_BUCKET_COUNT + (MAX_MAGNITUDE - SUB_BUCKET_BITS + 1) * SUB_BUCKET_HALF;
+        static constexpr uint64_t MAX_TRACKABLE_NS = (1ULL << (MAX_MAGNITUDE + 1)) - 1;
+
+        LatencyHistogram()
+        {
+            for (auto& bucket : buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        void Record(uint64_t value_ns)
+        {
+            if (value_ns > MAX_TRACKABLE_NS) {
+                value_ns = MAX_TRACKABLE_NS;
+            }
+
+            buckets[BucketIndex(value_ns)].fetch_add(1, std::memory_order_relaxed);
+            total_ns.fetch_add(value_ns, std::memory_order_relaxed);
+
+            uint64_t current = max_ns.load(std::memory_order_relaxed);
+            while (value_ns > current &&
+                   !max_ns.compare_exchange_weak(current, value_ns, std::memory_order_relaxed)) {
+            }
+        }
+
+        // start_ns(MonotonicNowNs) 부터 지금까지
+        void RecordSince(uint64_t start_ns)
+        {
+            uint64_t now = MonotonicNowNs();
+            Record(now > start_ns ? now - start_ns : 0);
+        }
+
+        /**
+        * @brief 누적 분포 요약
+        * @note 동시 Record 중 호출 시 일부 샘플이 포함/누락될 수 있음 (통계 용도로 충분)
+        */
+        LatencySnapshot Snapshot() const
+        {
+            LatencySnapshot snapshot;
+
+            std::array<uint64_t, BUCKET_COUNT> counts;
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                counts[i] = buckets[i].load(std::memory_order_relaxed);
+                snapshot.count += counts[i];
+            }
+            if (snapshot.count == 0) {
+                return snapshot;
+            }
+
+            snapshot.max_ns = max_ns.load(std::memory_order_relaxed);
+            snapshot.mean_ns = total_ns.load(std::memory_order_relaxed) / snapshot.count;
+
+            const uint64_t p50_rank = Rank(snapshot.count, 500);
+            const uint64_t p90_rank = Rank(snapshot.count, 900);
+            const uint64_t p99_rank = Rank(snapshot.count, 990);
+            const uint64_t p999_rank = Rank(snapshot.count, 999);
+
+            uint64_t seen = 0;
+            bool min_found = false;
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                if (counts[i] == 0) {
+                    continue;
+                }
+                if (!min_found) {
+                    snapshot.min_ns = LowestEquivalent(i);
+                    min_found = true;
+                }
+
+                uint64_t before = seen;
+                seen += counts[i];
+                uint64_t value = HighestEquivalent(i);
+                if (before < p50_rank && seen >= p50_rank) snapshot.p50_ns = value;
+                if (before < p90_rank && seen >= p90_rank) snapshot.p90_ns = value;
+                if (before < p99_rank && seen >= p99_rank) snapshot.p99_ns = value;
+                if (before < p999_rank && seen >= p999_rank) snapshot.p999_ns = value;
+            }
+
+            // 버킷 상한이 실제 최대값보다 클 수 있음
+            auto clamp = [&](uint64_t& v) { if (v > snapshot.max_ns) v = snapshot.max_ns; };
+            clamp(snapshot.p50_ns);
+            clamp(snapshot.p90_ns);
+            clamp(snapshot.p99_ns);
+            clamp(snapshot.p999_ns);
+            return snapshot;
+        }
+
+        static size_t BucketIndex(uint64_t value)
+        {
+            if (value < SUB_BUCKET_COUNT) {
+                return static_cast<size_t>(value);
+            }
+            uint32_t magnitude = 63 - static_cast<uint32_t>(__builtin_clzll(value));
+            uint32_t shift = magnitude - (SUB_BUCKET_BITS - 1);
+            uint64_t sub_bucket = value >> shift;   // [SUB_BUCKET_HALF, SUB_BUCKET_COUNT)
+            return static_cast<size_t>(SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF + (sub_bucket - SUB_BUCKET_HALF));
+        }
+
+        static uint64_t LowestEquivalent(size_t index)
+        {
+            if (index < SUB_BUCKET_COUNT) {
+                return index;
+            }
+            uint64_t offset = index - SUB_BUCKET_COUNT;
+            uint32_t shift = static_cast<uint32_t>(offset / SUB_BUCKET_HALF) + 1;
+            uint64_t sub_bucket = offset % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+            return sub_bucket << shift;
+        }
+
+        static uint64_t HighestEquivalent(size_t index)
+        {
+            if (index < SUB_BUCKET_COUNT) {
+                return index;
+            }
+            uint64_t offset = index - SUB_BUCKET_COUNT;
+            uint32_t shift = static_cast<uint32_t>(offset / SUB_BUCKET_HALF) + 1;
+            return LowestEquivalent(index) + (1ULL << shift) - 1;
+        }
+
+    private:
+        // permille 분위에 해당하는 순위 (1-based)
+        static uint64_t Rank(uint64_t count, uint64_t permille)
+        {
+            uint64_t rank = (count * permille + 999) / 1000;
+            return rank == 0 ? 1 : rank;
+        }
+
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets;
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+    };
+}
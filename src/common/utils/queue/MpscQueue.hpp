@@ -0,0 +1,237 @@
+// src/common/utils/queue/MpscQueue.hpp
+#pragma once
+
+#include "common/utils/queue/ThreadSafeQueue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mpc_engine::utils
+{
+    /**
+     * @brief Multi-Producer Single-Consumer 큐 (producer lock-free)
+     *
+     * 여러 핸들러 스레드가 응답을 넣고 하나의 송신 스레드가 꺼내는 구조 전용입니다.
+     * - Push: atomic exchange 1회 + store 1회 (Vyukov intrusive MPSC), 락 없음
+     * - PopAll: 준비된 아이템을 한 번에 모두 꺼냄 → 송신 스레드가 하나의 배치로 전송
+     * - 소비자가 잠들어 있을 때만 producer가 mutex/condvar를 건드림
+     *
+     * API는 ThreadSafeQueue와 동일한 QueueResult를 사용합니다.
+     *
+     * @note max_size는 근사 상한 (동시 push 시 producer 수만큼 잠시 초과 가능)
+     * @warning Pop/PopAll/Clear는 단일 소비자 스레드에서만 호출할 것
+     * @note TElement는 기본 생성 가능해야 함 (stub 노드)
+     */
+    template<typename TElement>
+    class MpscQueue
+    {
+    private:
+        struct Node
+        {
+            std::atomic<Node*> next{nullptr};
+            TElement value;
+
+            Node() = default;
+            explicit Node(TElement&& v) : value(std::move(v)) {}
+        };
+
+        // producer 측 (head) / consumer 측 (tail) 분리 - false sharing 방지
+        alignas(64) std::atomic<Node*> head;
+        alignas(64) Node* tail;
+        alignas(64) std::atomic<size_t> size{0};
+
+        size_t max_size;
+        std::atomic<bool> shutdown_flag{false};
+
+        // 소비자 대기용 (비어 있을 때만 사용)
+        std::atomic<bool> consumer_waiting{false};
+        std::mutex wait_mutex;
+        std::condition_variable cv_not_empty;
+
+    public:
+        explicit MpscQueue(size_t max_size = 10000) : max_size(max_size)
+        {
+            if (max_size == 0) {
+                throw std::invalid_argument("Queue max_size must be greater than 0");
+            }
+            Node* stub = new Node();
+            head.store(stub, std::memory_order_relaxed);
+            tail = stub;
+        }
+
+        ~MpscQueue()
+        {
+            Shutdown();
+
+            TElement discard;
+            while (PopOne(discard)) {}
+            delete tail;
+        }
+
+        // 복사 방지
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        // Push: 가득 찼으면 공간이 생길 때까지 대기
+        QueueResult Push(TElement item)
+        {
+            return PushInternal(std::move(item), nullptr);
+        }
+
+        // TryPush: 타임아웃과 함께 Push 시도
+        QueueResult TryPush(TElement item, std::chrono::milliseconds timeout)
+        {
+            auto deadline = std::chrono::steady_clock::now() + timeout;
+            return PushInternal(std::move(item), &deadline);
+        }
+
+        /**
+         * @brief 준비된 아이템을 모두 꺼냄 (비어 있으면 timeout까지 대기)
+         * @param out 꺼낸 아이템이 뒤에 추가됨 (호출자가 재사용 가능)
+         * @param max_items 한 번에 꺼낼 최대 개수
+         * @return SUCCESS(1개 이상) / TIMEOUT / SHUTDOWN(종료 + 비어 있음)
+         */
+        QueueResult TryPopAll(std::vector<TElement>& out, std::chrono::milliseconds timeout, size_t max_items = SIZE_MAX)
+        {
+            if (!WaitNotEmpty(timeout)) {
+                return shutdown_flag.load() ? QueueResult::SHUTDOWN : QueueResult::TIMEOUT;
+            }
+
+            size_t taken = 0;
+            TElement item;
+            while (taken < max_items && PopOne(item)) {
+                out.push_back(std::move(item));
+                ++taken;
+            }
+
+            if (taken == 0) {
+                return shutdown_flag.load() ? QueueResult::SHUTDOWN : QueueResult::TIMEOUT;
+            }
+            return QueueResult::SUCCESS;
+        }
+
+        // TryPop: 타임아웃과 함께 1개 Pop
+        QueueResult TryPop(TElement& item, std::chrono::milliseconds timeout)
+        {
+            if (!WaitNotEmpty(timeout) || !PopOne(item)) {
+                return shutdown_flag.load() ? QueueResult::SHUTDOWN : QueueResult::TIMEOUT;
+            }
+            return QueueResult::SUCCESS;
+        }
+
+        // Shutdown: 대기 중인 소비자/생산자 깨우기 (남은 아이템은 계속 꺼낼 수 있음)
+        void Shutdown()
+        {
+            shutdown_flag.store(true);
+            std::lock_guard<std::mutex> lock(wait_mutex);
+            cv_not_empty.notify_all();
+        }
+
+        // Clear: 남은 아이템 폐기 (소비자 스레드 또는 소비자 정지 후에만 호출)
+        void Clear()
+        {
+            TElement discard;
+            while (PopOne(discard)) {}
+        }
+
+        size_t Size() const { return size.load(std::memory_order_relaxed); }
+        bool Empty() const { return Size() == 0; }
+        bool IsFull() const { return Size() >= max_size; }
+        bool IsShutdown() const { return shutdown_flag.load(); }
+        size_t MaxSize() const { return max_size; }
+
+    private:
+        QueueResult PushInternal(TElement&& item, const std::chrono::steady_clock::time_point* deadline)
+        {
+            // 노드를 먼저 만듦 - 할당/move가 throw해도 size는 그대로 (예약 후 throw하면 소비자가 연결되지 않을 노드를 기다림)
+            std::unique_ptr<Node> owned(new Node(std::move(item)));
+
+            // 용량 예약 (가득 찬 경우는 드문 경로 - backoff로 대기)
+            size_t current = size.load(std::memory_order_relaxed);
+            while (true) {
+                if (shutdown_flag.load(std::memory_order_relaxed)) {
+                    return QueueResult::SHUTDOWN;
+                }
+                if (current < max_size) {
+                    if (size.compare_exchange_weak(current, current + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                    continue;
+                }
+                if (deadline && std::chrono::steady_clock::now() >= *deadline) {
+                    return QueueResult::TIMEOUT;
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                current = size.load(std::memory_order_relaxed);
+            }
+
+            // 예약 이후로는 throw 없음
+            Node* node = owned.release();
+            Node* prev = head.exchange(node, std::memory_order_acq_rel);
+            prev->next.store(node, std::memory_order_release);
+
+            // 소비자가 잠들어 있을 때만 깨움 (size 증가 ↔ waiting 확인 순서 보장)
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (consumer_waiting.load(std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> lock(wait_mutex);
+                cv_not_empty.notify_one();
+            }
+            return QueueResult::SUCCESS;
+        }
+
+        bool PopOne(TElement& item)
+        {
+            Node* current = tail;
+            Node* next = current->next.load(std::memory_order_acquire);
+
+            if (!next) {
+                // exchange 이후 next 연결 전인 producer가 있으면 잠시 대기
+                // (producer가 선점된 경우 - yield 후 sleep을 1ms까지 늘려 CPU를 태우지 않음)
+                if (size.load(std::memory_order_acquire) == 0) {
+                    return false;
+                }
+                std::chrono::microseconds backoff(1);
+                for (int spins = 0; !(next = current->next.load(std::memory_order_acquire)); ++spins) {
+                    if (spins < 64) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    std::this_thread::sleep_for(backoff);
+                    backoff = std::min(backoff * 2, std::chrono::microseconds(1000));
+                }
+            }
+
+            item = std::move(next->value);
+            tail = next;
+            delete current;
+            size.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+
+        bool WaitNotEmpty(std::chrono::milliseconds timeout)
+        {
+            if (Size() > 0) {
+                return true;
+            }
+            if (shutdown_flag.load()) {
+                return false;
+            }
+
+            std::unique_lock<std::mutex> lock(wait_mutex);
+            consumer_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool ready = cv_not_empty.wait_for(lock, timeout, [this]() {
+                return Size() > 0 || shutdown_flag.load();
+            });
+            consumer_waiting.store(false, std::memory_order_relaxed);
+            return ready && Size() > 0;
+        }
+    };
+
+} // namespace mpc_engine::utils
@@ -0,0 +1,178 @@
+// src/common/utils/socket/SocketHandoff.cpp
+#include "SocketHandoff.hpp"
+#include "SocketUtils.hpp"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstring>
+#include <errno.h>
+
+namespace mpc_engine::utils
+{
+    static bool FillUnixAddress(const std::string& path, sockaddr_un& addr)
+    {
+        if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+            return false;
+        }
+
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        std::memcpy(addr.sun_path, path.c_str(), path.size());
+        return true;
+    }
+
+    socket_t CreateUnixListener(const std::string& path)
+    {
+        sockaddr_un addr;
+        if (!FillUnixAddress(path, addr)) {
+            return INVALID_SOCKET_VALUE;
+        }
+
+        socket_t sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (sock == INVALID_SOCKET_VALUE) {
+            return INVALID_SOCKET_VALUE;
+        }
+
+        // 이전 프로세스가 남긴 경로 제거 (열려 있는 이전 listener는 영향 없음)
+        unlink(path.c_str());
+
+        if (bind(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || listen(sock, 1) < 0) {
+            CloseSocket(sock);
+            return INVALID_SOCKET_VALUE;
+        }
+
+        return sock;
+    }
+
+    socket_t ConnectUnix(const std::string& path)
+    {
+        sockaddr_un addr;
+        if (!FillUnixAddress(path, addr)) {
+            return INVALID_SOCKET_VALUE;
+        }
+
+        socket_t sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (sock == INVALID_SOCKET_VALUE) {
+            return INVALID_SOCKET_VALUE;
+        }
+
+        if (connect(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            CloseSocket(sock);
+            return INVALID_SOCKET_VALUE;
+        }
+
+        return sock;
+    }
+
+    bool SendSocketHandle(socket_t channel, socket_t handle, char tag)
+    {
+        iovec iov{};
+        iov.iov_base = &tag;
+        iov.iov_len = 1;
+
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+        std::memset(control, 0, sizeof(control));
+
+        msghdr msg{};
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(cmsg), &handle, sizeof(int));
+
+        ssize_t sent;
+        do {
+            sent = sendmsg(channel, &msg, MSG_NOSIGNAL);
+        } while (sent < 0 && errno == EINTR);
+
+        return sent == 1;
+    }
+
+    socket_t ReceiveSocketHandle(socket_t channel, char* tag, uint32_t timeout_ms)
+    {
+        if (!WaitReadable(channel, timeout_ms)) {
+            return INVALID_SOCKET_VALUE;
+        }
+
+        char byte = 0;
+        iovec iov{};
+        iov.iov_base = &byte;
+        iov.iov_len = 1;
+
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+        std::memset(control, 0, sizeof(control));
+
+        msghdr msg{};
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        ssize_t received;
+        do {
+            received = recvmsg(channel, &msg, MSG_CMSG_CLOEXEC);
+        } while (received < 0 && errno == EINTR);
+
+        if (received != 1 || (msg.msg_flags & MSG_CTRUNC)) {
+            return INVALID_SOCKET_VALUE;
+        }
+        if (tag) {
+            *tag = byte;
+        }
+
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS &&
+                cmsg->cmsg_len == CMSG_LEN(sizeof(int))) {
+                int handle;
+                std::memcpy(&handle, CMSG_DATA(cmsg), sizeof(int));
+                return handle;
+            }
+        }
+
+        return INVALID_SOCKET_VALUE;
+    }
+
+    bool SendControlByte(socket_t channel, char byte)
+    {
+        ssize_t sent;
+        do {
+            sent = send(channel, &byte, 1, MSG_NOSIGNAL);
+        } while (sent < 0 && errno == EINTR);
+
+        return sent == 1;
+    }
+
+    bool ReceiveControlByte(socket_t channel, char* byte, uint32_t timeout_ms)
+    {
+        if (!WaitReadable(channel, timeout_ms)) {
+            return false;
+        }
+
+        ssize_t received;
+        do {
+            received = recv(channel, byte, 1, 0);
+        } while (received < 0 && errno == EINTR);
+
+        return received == 1;
+    }
+
+    bool WaitReadable(socket_t sock, uint32_t timeout_ms)
+    {
+        pollfd pfd{};
+        pfd.fd = sock;
+        pfd.events = POLLIN;
+
+        int ready;
+        do {
+            ready = poll(&pfd, 1, static_cast<int>(timeout_ms));
+        } while (ready < 0 && errno == EINTR);
+
+        return ready > 0 && (pfd.revents & (POLLIN | POLLHUP | POLLERR));
+    }
+}
@@ -0,0 +1,40 @@
+// src/common/utils/socket/SocketHandoff.hpp
+#pragma once
+#include "types/BasicTypes.hpp"
+#include <string>
+#include <cstdint>
+
+namespace mpc_engine::utils
+{
+    /**
+     * @brief 프로세스 간 소켓 전달 (Unix domain socket + SCM_RIGHTS)
+     *
+     * 무중단 재시작 시 기존 프로세스의 listening socket을 새 프로세스로 넘길 때 사용합니다.
+     * 전달된 fd는 같은 커널 소켓을 가리키므로 backlog에 쌓인 연결도 그대로 이어받습니다.
+     *
+     * 제어 메시지는 1바이트 tag로 구분합니다 (프로토콜 정의는 호출자 몫).
+     */
+
+    // path에 Unix domain listener 생성 (기존 파일은 unlink 후 재생성)
+    socket_t CreateUnixListener(const std::string& path);
+
+    // path의 Unix domain listener에 연결
+    socket_t ConnectUnix(const std::string& path);
+
+    // channel로 handle을 전달 (tag 1바이트 + SCM_RIGHTS)
+    bool SendSocketHandle(socket_t channel, socket_t handle, char tag);
+
+    /**
+     * @brief channel에서 전달된 handle 수신
+     * @param tag 함께 온 1바이트 tag (optional) - handle 없이 제어 바이트만 온 경우에도 설정됨
+     * @return 수신한 handle (실패/타임아웃/handle 없음 시 INVALID_SOCKET_VALUE)
+     */
+    socket_t ReceiveSocketHandle(socket_t channel, char* tag, uint32_t timeout_ms);
+
+    // 제어 바이트 송수신 (핸드오프 요청/완료 통지)
+    bool SendControlByte(socket_t channel, char byte);
+    bool ReceiveControlByte(socket_t channel, char* byte, uint32_t timeout_ms);
+
+    // 읽을 데이터(또는 accept 대기 연결)가 생길 때까지 대기
+    bool WaitReadable(socket_t sock, uint32_t timeout_ms);
+}
@@ -0,0 +1,233 @@
+// src/common/utils/threading/CpuAffinity.hpp
+#pragma once
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <linux/mempolicy.h>
+#include <cstring>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace mpc_engine::utils
+{
+    /**
+     * @brief CPU 목록 ("0-3,8,10-11" 형식, taskset/cgroup cpuset과 동일)
+     */
+    class CpuSet
+    {
+    private:
+        std::vector<int> cpus;  // 정렬, 중복 없음
+
+    public:
+        CpuSet() = default;
+
+        /**
+        * @brief cpuset 문자열 파싱
+        * @return 형식 오류 시 false (out은 변경하지 않음)
+        */
+        static bool Parse(const std::string& spec, CpuSet& out)
+        {
+            std::set<int> parsed;
+            size_t pos = 0;
+
+            while (pos < spec.size()) {
+                size_t comma = spec.find(',', pos);
+                std::string item = spec.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+                pos = (comma == std::string::npos) ? spec.size() : comma + 1;
+
+                size_t begin = item.find_first_not_of(" \t");
+                size_t end = item.find_last_not_of(" \t");
+                if (begin == std::string::npos) {
+                    return false;
+                }
+                item = item.substr(begin, end - begin + 1);
+
+                size_t dash = item.find('-');
+                char* tail = nullptr;
+                long first = std::strtol(item.c_str(), &tail, 10);
+                long last = first;
+                if (dash != std::string::npos) {
+                    if (tail != item.c_str() + dash) {
+                        return false;
+                    }
+                    const char* range_end = item.c_str() + dash + 1;
+                    last = std::strtol(range_end, &tail, 10);
+                    if (tail == range_end) {
+                        return false;
+                    }
+                }
+                if (*tail != '\0' || first < 0 || last < first || last >= CPU_SETSIZE) {
+                    return false;
+                }
+
+                for (long cpu = first; cpu <= last; ++cpu) {
+                    parsed.insert(static_cast<int>(cpu));
+                }
+            }
+
+            if (parsed.empty()) {
+                return false;
+            }
+
+            out.cpus.assign(parsed.begin(), parsed.end());
+            return true;
+        }
+
+        bool Empty() const { return cpus.empty(); }
+        size_t Size() const { return cpus.size(); }
+        int operator[](size_t index) const { return cpus[index]; }
+        const std::vector<int>& Cpus() const { return cpus; }
+
+        // 연속 구간은 다시 a-b로 묶어서 표시
+        std::string ToString() const
+        {
+            std::string result;
+            for (size_t i = 0; i < cpus.size(); ) {
+                size_t j = i;
+                while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+                    ++j;
+                }
+                if (!result.empty()) {
+                    result += ",";
+                }
+                result += std::to_string(cpus[i]);
+                if (j > i) {
+                    result += "-" + std::to_string(cpus[j]);
+                }
+                i = j + 1;
+            }
+            return result;
+        }
+    };
+
+    /**
+     * @brief 스레드 배치 설정
+     * - cpus: 비어 있으면 배치하지 않음 (스케줄러 기본)
+     * - per_worker: true면 워커 i를 cpus[i % n] 하나에 고정 (migration 없음), false면 집합 전체 허용
+     * - numa_local_memory: 워커가 할당하는 메모리를 실행 중인 NUMA 노드에 두도록 정책 설정
+     */
+    struct ThreadPlacement
+    {
+        CpuSet cpus;
+        bool per_worker = false;
+        bool numa_local_memory = false;
+
+        bool Enabled() const { return !cpus.Empty(); }
+    };
+
+    inline bool PinThread(pthread_t thread, const std::vector<int>& cpus)
+    {
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        for (int cpu : cpus) {
+            CPU_SET(cpu, &mask);
+        }
+        return pthread_setaffinity_np(thread, sizeof(mask), &mask) == 0;
+    }
+
+    inline bool PinThread(pthread_t thread, const CpuSet& cpus)
+    {
+        return PinThread(thread, cpus.Cpus());
+    }
+
+    // 현재 스레드의 메모리 할당을 실행 중인 노드에 우선 배치 (MPOL_LOCAL)
+    inline bool BindMemoryToLocalNode()
+    {
+        return syscall(SYS_set_mempolicy, MPOL_LOCAL, nullptr, 0) == 0;
+    }
+
+    /**
+    * @brief 워커 스레드 시작 시 호출 - placement 적용
+    * @return 적용 실패 시 false (배치 없이 계속 실행)
+    */
+    inline bool ApplyWorkerPlacement(const ThreadPlacement& placement, size_t worker_id)
+    {
+        if (!placement.Enabled()) {
+            return true;
+        }
+
+        bool pinned = placement.per_worker
+            ? PinThread(pthread_self(), std::vector<int>{ placement.cpus[worker_id % placement.cpus.Size()] })
+            : PinThread(pthread_self(), placement.cpus);
+
+        // affinity 적용 후 설정해야 이후 first-touch가 고정된 노드에서 일어남
+        bool bound = !placement.numa_local_memory || BindMemoryToLocalNode();
+        return pinned && bound;
+    }
+
+    /**
+    * @brief cpu가 속한 NUMA 노드 (/sys/devices/system/cpu/cpuN/nodeM)
+    * @return 알 수 없으면 -1
+    */
+    inline int CpuNumaNode(int cpu)
+    {
+        std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+        DIR* dir = opendir(path.c_str());
+        if (!dir) {
+            return -1;
+        }
+
+        int node = -1;
+        while (dirent* entry = readdir(dir)) {
+            if (std::strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9') {
+                node = std::atoi(entry->d_name + 4);
+                break;
+            }
+        }
+        closedir(dir);
+        return node;
+    }
+
+    // 로그용: "2-5 (NUMA node 0)" / "2-5,34-37 (NUMA nodes 0,1)"
+    inline std::string DescribeCpuSet(const CpuSet& cpus)
+    {
+        if (cpus.Empty()) {
+            return "unpinned";
+        }
+
+        std::set<int> nodes;
+        for (int cpu : cpus.Cpus()) {
+            nodes.insert(CpuNumaNode(cpu));
+        }
+
+        std::string result = cpus.ToString();
+        if (nodes.count(-1)) {
+            return result + " (NUMA node unknown)";
+        }
+
+        result += nodes.size() == 1 ? " (NUMA node " : " (NUMA nodes ";
+        bool first = true;
+        for (int node : nodes) {
+            result += (first ? "" : ",") + std::to_string(node);
+            first = false;
+        }
+        return result + ")";
+    }
+
+    /**
+    * @brief 호출 스레드의 NUMA 노드에 메모리 확보 (mmap + first-touch)
+    * @note 고정된 워커에서 호출해야 의미가 있음. 해제는 FreeNumaLocal
+    */
+    inline void* AllocateNumaLocal(size_t size)
+    {
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            return nullptr;
+        }
+        std::memset(memory, 0, size);   // 이 스레드가 먼저 접근 → 현재 노드에 페이지 배치
+        return memory;
+    }
+
+    inline void FreeNumaLocal(void* memory, size_t size)
+    {
+        if (memory) {
+            munmap(memory, size);
+        }
+    }
+}
@@ -0,0 +1,275 @@
+// src/common/utils/threading/OrderedExecutor.hpp
+#pragma once
+
+#include "common/utils/queue/ThreadSafeQueue.hpp"
+#include "common/utils/threading/CpuAffinity.hpp"
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstdio>
+
+namespace mpc_engine::utils
+{
+    /**
+     * @brief Key-affinity 실행기 (lane별 단일 워커)
+     *
+     * 같은 affinity key(key_id, session 등)를 가진 작업은 항상 같은 lane으로 가서
+     * 제출 순서(FIFO)대로 하나씩 실행되고, 서로 다른 lane은 병렬로 실행됩니다.
+     *
+     * - 한 세션의 라운드가 순서대로 처리됨 (재정렬 없음)
+     * - 키 관련 상태가 한 워커(코어)에 머무름 → 캐시 지역성
+     * - lane 내부 상태는 단일 스레드 접근이므로 락 불필요
+     *
+     * @note ThreadPool과 동일한 Task 소유권 규칙 (SubmitOwned / SubmitBorrowed)
+     * @warning 하나의 느린 작업은 같은 lane의 후속 작업을 지연시킴 (head-of-line blocking)
+     */
+    template<typename TContext>
+    class OrderedExecutor
+    {
+    private:
+        struct Task
+        {
+            void (*func)(TContext*);
+            TContext* context;
+            bool owned;  // 소유권 플래그
+
+            Task() : func(nullptr), context(nullptr), owned(false) {}
+
+            Task(void (*f)(TContext*), TContext* c, bool o)
+                : func(f), context(c), owned(o) {}
+
+            Task(Task&& other) noexcept : func(other.func), context(other.context), owned(other.owned)
+            {
+                other.context = nullptr;
+                other.owned = false;
+            }
+
+            Task& operator=(Task&& other) noexcept
+            {
+                if (this != &other) {
+                    if (owned && context) {
+                        delete context;
+                    }
+                    func = other.func;
+                    context = other.context;
+                    owned = other.owned;
+                    other.context = nullptr;
+                    other.owned = false;
+                }
+                return *this;
+            }
+
+            // 복사 금지
+            Task(const Task&) = delete;
+            Task& operator=(const Task&) = delete;
+
+            ~Task() {
+                if (owned && context) {
+                    delete context;
+                    context = nullptr;
+                }
+            }
+        };
+
+        struct Lane
+        {
+            ThreadSafeQueue<Task> queue;
+            std::thread worker;
+
+            explicit Lane(size_t capacity) : queue(capacity) {}
+        };
+
+        std::vector<std::unique_ptr<Lane>> lanes;
+        std::atomic<bool> stop{false};
+        std::atomic<size_t> active_tasks{0};
+        size_t num_lanes;
+        ThreadPlacement placement;
+        std::atomic<size_t> placement_failures{0};
+
+    public:
+        /**
+         * @param num_lanes lane(워커) 수
+         * @param lane_capacity lane별 대기 작업 상한 (초과 시 Submit 대기)
+         * @param placement lane 워커 CPU/NUMA 배치 (기본: 배치 없음)
+         */
+        explicit OrderedExecutor(size_t num_lanes, size_t lane_capacity = 100, const ThreadPlacement& placement = ThreadPlacement())
+        : num_lanes(num_lanes), placement(placement)
+        {
+            if (num_lanes == 0) {
+                throw std::invalid_argument("OrderedExecutor must have at least 1 lane");
+            }
+
+            lanes.reserve(num_lanes);
+            for (size_t i = 0; i < num_lanes; ++i) {
+                lanes.push_back(std::make_unique<Lane>(lane_capacity));
+            }
+            for (size_t i = 0; i < num_lanes; ++i) {
+                lanes[i]->worker = std::thread([this, i]() {
+                    WorkerLoop(i);
+                });
+            }
+        }
+
+        ~OrderedExecutor()
+        {
+            Shutdown();
+        }
+
+        // 복사/이동 방지
+        OrderedExecutor(const OrderedExecutor&) = delete;
+        OrderedExecutor& operator=(const OrderedExecutor&) = delete;
+        OrderedExecutor(OrderedExecutor&&) = delete;
+        OrderedExecutor& operator=(OrderedExecutor&&) = delete;
+
+        /**
+         * @brief 작업 제출 (자동 삭제)
+         * @param key affinity key (같은 key → 같은 lane, FIFO)
+         * @param func 작업 함수
+         * @param context unique_ptr (소유권 이전)
+         */
+        void SubmitOwned(uint64_t key, void (*func)(TContext*), std::unique_ptr<TContext> context)
+        {
+            TContext* raw_ptr = context.release();
+
+            if (stop) {
+                delete raw_ptr;
+                throw std::runtime_error("OrderedExecutor is stopped");
+            }
+
+            QueueResult result = lanes[LaneOf(key)]->queue.Emplace(func, raw_ptr, true);
+            if (result != QueueResult::SUCCESS) {
+                delete raw_ptr;
+                throw std::runtime_error("Failed to push task");
+            }
+        }
+
+        /**
+         * @brief 작업 제출 시도 (대기 없음, 자동 삭제)
+         * @param key affinity key
+         * @param func 작업 함수
+         * @param context unique_ptr (소유권 이전, 실패 시 삭제됨)
+         * @return SUCCESS / FULL(해당 lane 포화) / SHUTDOWN
+         */
+        QueueResult TrySubmitOwned(uint64_t key, void (*func)(TContext*), std::unique_ptr<TContext> context)
+        {
+            if (stop) {
+                return QueueResult::SHUTDOWN;
+            }
+
+            TContext* raw_ptr = context.release();
+            QueueResult result = lanes[LaneOf(key)]->queue.TryEmplace(std::chrono::milliseconds(0), func, raw_ptr, true);
+            if (result != QueueResult::SUCCESS) {
+                delete raw_ptr;
+                return result == QueueResult::TIMEOUT ? QueueResult::FULL : result;
+            }
+            return QueueResult::SUCCESS;
+        }
+
+        /**
+         * @brief 작업 제출 (빌려줌)
+         * @param key affinity key
+         * @param func 작업 함수
+         * @param context raw pointer (호출자가 생명주기 관리)
+         */
+        void SubmitBorrowed(uint64_t key, void (*func)(TContext*), TContext* context)
+        {
+            if (stop) {
+                throw std::runtime_error("OrderedExecutor is stopped");
+            }
+
+            QueueResult result = lanes[LaneOf(key)]->queue.Emplace(func, context, false);
+            if (result != QueueResult::SUCCESS) {
+                throw std::runtime_error("Failed to push task");
+            }
+        }
+
+        void Shutdown()
+        {
+            if (stop.exchange(true)) {
+                return;
+            }
+
+            for (auto& lane : lanes) {
+                lane->queue.Shutdown();
+            }
+
+            for (auto& lane : lanes) {
+                if (lane->worker.joinable()) {
+                    lane->worker.join();
+                }
+            }
+        }
+
+        /**
+         * @brief key → lane 매핑 (splitmix64 finalizer로 분산)
+         * @note std::hash<integer>는 identity이므로 그대로 나머지 연산하면 편향됨
+         */
+        size_t LaneOf(uint64_t key) const
+        {
+            key ^= key >> 30;
+            key *= 0xbf58476d1ce4e5b9ULL;
+            key ^= key >> 27;
+            key *= 0x94d049bb133111ebULL;
+            key ^= key >> 31;
+            return static_cast<size_t>(key % num_lanes);
+        }
+
+        size_t GetActiveTaskCount() const { return active_tasks.load(); }
+        size_t GetPendingTaskCount() const
+        {
+            size_t pending = 0;
+            for (const auto& lane : lanes) {
+                pending += lane->queue.Size();
+            }
+            return pending;
+        }
+        size_t GetLaneCount() const { return num_lanes; }
+        bool IsStopped() const { return stop.load(); }
+
+        // placement 적용에 실패한 lane 워커 수
+        size_t GetPlacementFailureCount() const { return placement_failures.load(); }
+
+    private:
+        void WorkerLoop(size_t lane_id)
+        {
+            if (!ApplyWorkerPlacement(placement, lane_id)) {
+                placement_failures++;
+                fprintf(stderr, "[OrderedExecutor Lane %zu] Failed to apply placement (cpus %s)\n", lane_id, placement.cpus.ToString().c_str());
+            }
+
+            ThreadSafeQueue<Task>& queue = lanes[lane_id]->queue;
+
+            while (!stop) {
+                Task task;
+
+                QueueResult result = queue.Pop(task);
+
+                if (result == QueueResult::SHUTDOWN) {
+                    break;
+                }
+
+                if (result != QueueResult::SUCCESS) {
+                    fprintf(stderr, "[OrderedExecutor Lane %zu] Unexpected pop result: %s\n", lane_id, QueueResultToString(result));
+                    break;
+                }
+
+                active_tasks++;
+
+                try {
+                    task.func(task.context);
+                } catch (const std::exception& e) {
+                    fprintf(stderr, "[OrderedExecutor Lane %zu] Exception: %s\n",
+                            lane_id, e.what());
+                } catch (...) {
+                    fprintf(stderr, "[OrderedExecutor Lane %zu] Unknown exception\n",
+                            lane_id);
+                }
+
+                active_tasks--;
+            }
+        }
+    };
+
+} // namespace mpc_engine::utils
@@ -0,0 +1,66 @@
+// src/common/utils/threading/ParallelRunner.hpp
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace mpc_engine::utils
+{
+    using ParallelWork = std::function<void(size_t index)>;
+
+    /**
+     * @brief 요청 하나 안의 독립 작업 count개를 여러 워커에 나눠 실행 (배치 요청 처리용)
+     * @note RunParallel은 모든 작업이 끝난 뒤 반환 - 작업 중 예외는 호출자에게 다시 던짐
+     */
+    class ParallelRunner
+    {
+    public:
+        virtual ~ParallelRunner() = default;
+        virtual void RunParallel(size_t count, const ParallelWork& work) = 0;
+    };
+
+    // 현재 스레드(핸들러 워커)에 연결된 runner - 한 프로세스에 노드가 여럿이어도 요청을 받은 노드의 워커 사용
+    inline ParallelRunner*& CurrentParallelRunner()
+    {
+        static thread_local ParallelRunner* runner = nullptr;
+        return runner;
+    }
+
+    /**
+     * @brief 현재 스레드의 runner로 실행 (없거나 작업이 1개 이하면 호출 스레드에서 순차 실행)
+     */
+    inline void ParallelFor(size_t count, const ParallelWork& work)
+    {
+        ParallelRunner* runner = CurrentParallelRunner();
+        if (runner && count > 1) {
+            runner->RunParallel(count, work);
+            return;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            work(i);
+        }
+    }
+
+    // 스코프 동안 현재 스레드의 runner 설정 (중첩 시 이전 값 복원)
+    class ScopedParallelRunner
+    {
+    private:
+        ParallelRunner* previous;
+
+    public:
+        explicit ScopedParallelRunner(ParallelRunner* runner)
+            : previous(CurrentParallelRunner())
+        {
+            CurrentParallelRunner() = runner;
+        }
+
+        ~ScopedParallelRunner()
+        {
+            CurrentParallelRunner() = previous;
+        }
+
+        ScopedParallelRunner(const ScopedParallelRunner&) = delete;
+        ScopedParallelRunner& operator=(const ScopedParallelRunner&) = delete;
+    };
+
+} // namespace mpc_engine::utils
@@ -0,0 +1,114 @@
+// src/common/utils/threading/RcuSnapshot.hpp
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace mpc_engine::utils
+{
+    /**
+     * @brief 읽기 위주 데이터의 불변 스냅샷 (shared_ptr RCU)
+     *
+     * 변경은 복사본을 만들어 새 버전으로 게시(Publish/Update)하고, 읽기는 게시된 스냅샷을 그대로 사용.
+     * - Read: 스레드별 캐시가 최신 버전이면 lock 없이 캐시된 스냅샷을 복사해 반환 (atomic load + 참조 카운트 1회)
+     *   버전이 바뀐 뒤 첫 Read만 mutex로 새 스냅샷을 가져옴
+     * - Load: 항상 mutex로 현재 스냅샷 복사 (writer 쪽 read-modify-write용)
+     * - 이전 스냅샷은 마지막 참조(다른 스레드의 캐시 포함)가 사라질 때 해제
+     *
+     * @note Read가 반환한 shared_ptr이 스냅샷을 고정 - 이후 새 버전이 게시되거나 같은 스레드가 다시 Read해도
+     *       그 안의 원소(와 원소가 가리키는 객체)는 반환값을 들고 있는 동안 유효. 작업 1회에 스냅샷 1개를 잡고 사용
+     */
+    template <typename T>
+    class RcuSnapshot
+    {
+    public:
+        using Pointer = std::shared_ptr<const T>;
+
+        explicit RcuSnapshot(Pointer initial = std::make_shared<const T>())
+            : current(std::move(initial)), version(NextVersion())
+        {
+        }
+
+        RcuSnapshot(const RcuSnapshot&) = delete;
+        RcuSnapshot& operator=(const RcuSnapshot&) = delete;
+
+        Pointer Read() const
+        {
+            Cache& cache = ThreadCache();
+            if (cache.version == version.load(std::memory_order_acquire)) {
+                return cache.snapshot;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            cache.snapshot = current;
+            cache.version = version.load(std::memory_order_relaxed);
+            return cache.snapshot;
+        }
+
+        Pointer Load() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return current;
+        }
+
+        // 새 버전 게시 - read-modify-write는 Update 사용
+        void Publish(Pointer next)
+        {
+            Pointer previous;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                previous = std::move(current);
+                current = std::move(next);
+                version.store(NextVersion(), std::memory_order_release);
+            }
+            // 이전 스냅샷 해제(소멸자)는 lock 밖에서
+        }
+
+        /**
+        * @brief 현재 스냅샷 복사본을 mutate로 수정해 게시 (writer끼리 직렬화)
+        * @return mutate 반환값 (false면 게시하지 않음)
+        */
+        template <typename Mutate>
+        bool Update(Mutate&& mutate)
+        {
+            std::lock_guard<std::mutex> writer_lock(writer_mutex);
+            auto next = std::make_shared<T>(*Load());
+            if (!mutate(*next)) {
+                return false;
+            }
+            Publish(std::move(next));
+            return true;
+        }
+
+        uint64_t GetVersion() const { return version.load(std::memory_order_acquire); }
+
+    private:
+        struct Cache
+        {
+            uint64_t version = 0;
+            Pointer snapshot;
+        };
+
+        mutable std::mutex mutex;           // current 교체/복사
+        std::mutex writer_mutex;            // Update 직렬화
+        Pointer current;
+        std::atomic<uint64_t> version;
+
+        // 프로세스 전체에서 유일한 버전 - 캐시가 다른 인스턴스의 스냅샷을 최신으로 착각하지 않음
+        static uint64_t NextVersion()
+        {
+            static std::atomic<uint64_t> next{1};
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static Cache& ThreadCache()
+        {
+            static thread_local Cache cache;
+            return cache;
+        }
+    };
+
+} // namespace mpc_engine::utils
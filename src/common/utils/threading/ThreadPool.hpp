@@ -2,6 +2,7 @@
 #pragma once
 
 #include "common/utils/queue/ThreadSafeQueue.hpp"
+#include "common/utils/threading/CpuAffinity.hpp"
 #include <vector>
 #include <thread>
 #include <atomic>
@@ -62,10 +63,15 @@ namespace mpc_engine::utils
         std::atomic<bool> stop{false};
         std::atomic<size_t> active_tasks{0};
         size_t num_threads;
+        ThreadPlacement placement;
+        std::atomic<size_t> placement_failures{0};
 
     public:
-        explicit ThreadPool(size_t num_threads) 
-        : task_queue(num_threads * 100), num_threads(num_threads)
+        /**
+         * @param placement 워커 CPU/NUMA 배치 (기본: 배치 없음)
+         */
+        explicit ThreadPool(size_t num_threads, const ThreadPlacement& placement = ThreadPlacement()) 
+        : task_queue(num_threads * 100), num_threads(num_threads), placement(placement)
         {
             if (num_threads == 0) {
                 throw std::invalid_argument("ThreadPool must have at least 1 thread");
@@ -114,6 +120,31 @@ namespace mpc_engine::utils
             }
         }
 
+        /**
+         * @brief 작업 제출 시도 (대기 없음, 자동 삭제)
+         * 
+         * 큐가 가득 찼으면 기다리지 않고 FULL을 반환합니다.
+         * 호출자는 이를 과부하 신호로 사용 (예: BUSY 응답).
+         * 
+         * @param func 작업 함수
+         * @param context unique_ptr (소유권 이전, 실패 시 삭제됨)
+         * @return SUCCESS / FULL / SHUTDOWN
+         */
+        QueueResult TrySubmitOwned(void (*func)(TContext*), std::unique_ptr<TContext> context) 
+        {
+            if (stop) {
+                return QueueResult::SHUTDOWN;
+            }
+
+            TContext* raw_ptr = context.release();
+            QueueResult result = task_queue.TryEmplace(std::chrono::milliseconds(0), func, raw_ptr, true);
+            if (result != QueueResult::SUCCESS) {
+                delete raw_ptr;
+                return result == QueueResult::TIMEOUT ? QueueResult::FULL : result;
+            }
+            return QueueResult::SUCCESS;
+        }
+
         /**
          * @brief 작업 제출 (빌려줌)
          * 
@@ -154,9 +185,17 @@ namespace mpc_engine::utils
         size_t GetThreadCount() const { return num_threads; }
         bool IsStopped() const { return stop.load(); }
 
+        // placement 적용에 실패한 워커 수 (권한/cpuset 범위 밖 등)
+        size_t GetPlacementFailureCount() const { return placement_failures.load(); }
+
     private:
         void WorkerLoop(size_t worker_id) 
         {
+            if (!ApplyWorkerPlacement(placement, worker_id)) {
+                placement_failures++;
+                fprintf(stderr, "[ThreadPool Worker %zu] Failed to apply placement (cpus %s)\n", worker_id, placement.cpus.ToString().c_str());
+            }
+
             while (!stop) {
                 Task task;
 
@@ -4,6 +4,8 @@
 #include <chrono>
 #include <future>
 #include <vector>
+#include <fstream>
+#include <string>
 
 namespace mpc_engine::utils
 {
@@ -103,4 +105,20 @@ namespace mpc_engine::utils
         // 3. 타임아웃과 함께 join
         return JoinWithTimeout(thread, timeout_ms);
     }
+
+    /**
+     * @brief 현재 프로세스의 스레드 수 (/proc/self/status의 Threads)
+     * @return 읽기 실패 시 0
+     */
+    inline uint32_t GetProcessThreadCount()
+    {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.compare(0, 8, "Threads:") == 0) {
+                return static_cast<uint32_t>(std::stoul(line.substr(8)));
+            }
+        }
+        return 0;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+// src/common/utils/time/Deadline.hpp
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+namespace mpc_engine::utils
+{
+    /**
+     * @brief 요청 처리 기한 (Wallet → Coordinator → Node)
+     *
+     * 홉 사이에는 절대 시각이 아닌 남은 budget(ms)으로 전달하고, 받는 쪽이 자기 steady_clock 기준 기한으로 다시 환산합니다.
+     * (호스트 간 시계 차이와 무관 - 전송 지연만큼 다음 홉의 기한이 늦어지는 정도의 오차)
+     * 전달 형식에서 budget 0은 "기한 없음"
+     */
+    using Deadline = std::chrono::steady_clock::time_point;
+    constexpr Deadline NO_DEADLINE = Deadline::max();
+
+    // 받은 budget → 이 홉의 기한
+    inline Deadline DeadlineAfter(uint64_t budget_ms, Deadline now = std::chrono::steady_clock::now())
+    {
+        if (budget_ms == 0) {
+            return NO_DEADLINE;
+        }
+        // 기한 필드를 모르는 이전 버전 peer의 큰 값에도 overflow 없이
+        auto limit = std::chrono::duration_cast<std::chrono::milliseconds>(NO_DEADLINE - now);
+        if (budget_ms >= static_cast<uint64_t>(limit.count())) {
+            return NO_DEADLINE;
+        }
+        return now + std::chrono::milliseconds(budget_ms);
+    }
+
+    /**
+    * @brief 다음 홉에 넘길 남은 budget (ms, 올림)
+    * @return 기한 없음 0 / 이미 지났으면 1 (0은 기한 없음이므로 - 호출자가 먼저 만료를 확인)
+    */
+    inline uint64_t RemainingBudgetMs(Deadline deadline, Deadline now = std::chrono::steady_clock::now())
+    {
+        if (deadline == NO_DEADLINE) {
+            return 0;
+        }
+        if (deadline <= now) {
+            return 1;
+        }
+        return static_cast<uint64_t>(std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count());
+    }
+}
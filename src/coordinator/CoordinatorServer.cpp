@@ -1,8 +1,13 @@
 // src/coordinator/CoordinatorServer.cpp
 #include "coordinator/CoordinatorServer.hpp"
+#include "coordinator/handlers/wallet/include/WalletSigningHandler.hpp"
+#include "coordinator/handlers/wallet/include/WalletKeyHandler.hpp"
 #include "common/utils/socket/SocketUtils.hpp"
 #include "common/env/EnvManager.hpp"
 #include "common/utils/logger/Logger.hpp"
+#include "common/utils/threading/ThreadUtils.hpp"
+#include <algorithm>
+#include <condition_variable>
 #include <future>
 
 namespace mpc_engine::coordinator
@@ -10,6 +15,135 @@ namespace mpc_engine::coordinator
     using namespace mpc_engine::network::tls;
     using namespace mpc_engine::env;
 
+    namespace
+    {
+        // Quorum fan-out 노드별 진행 상태
+        struct QuorumSlot
+        {
+            std::string node_id;
+            std::shared_ptr<network::NodeTcpClient> client;     // fan-out 중 해제(Unregister)되지 않도록 보유
+            uint64_t request_id = 0;        // 진행 중인 요청 (0 = 없음)
+            uint32_t attempt = 0;           // 이전 시도의 늦은 콜백 무시용
+            uint32_t busy_retries = 0;
+            bool answered = false;
+            bool retry_pending = false;     // BUSY → retry_at에 재전송
+            std::chrono::steady_clock::time_point retry_at;
+        };
+
+        // 호출자와 노드 수신 스레드(완료 콜백)가 공유, 마지막 참조가 해제
+        struct QuorumState
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::vector<QuorumSlot> slots;
+            std::vector<std::pair<size_t, std::unique_ptr<CoordinatorNodeMessage>>> successes;  // 도착 순서
+            std::vector<size_t> failures;
+            std::chrono::steady_clock::time_point deadline;
+            bool settled = false;           // true → 이후 콜백 무시
+        };
+
+        bool IsSuccessfulNodeResponse(const std::string& node_id, const CoordinatorNodeMessage* response)
+        {
+            if (!response) {
+                LOG_ERRORF("CoordinatorServer", "Broadcast failed for node: %s - null response", node_id.c_str());
+                return false;
+            }
+
+            if (response->has_error_response()) {
+                const ErrorResponse& error = response->error_response();
+                LOG_ERRORF("CoordinatorServer", "Broadcast failed for node: %s - %s: %s", 
+                    node_id.c_str(), NodeErrorCode_Name(error.code()).c_str(), error.header().error_message().c_str());
+                return false;
+            }
+
+            if (response->has_signing_response() && !response->signing_response().header().success()) {
+                LOG_ERRORF("CoordinatorServer", "Broadcast failed for node: %s - error: %s", 
+                    node_id.c_str(), response->signing_response().header().error_message().c_str());
+                return false;
+            }
+
+            return true;
+        }
+
+        void OnQuorumResponse(QuorumState& state, size_t index, uint32_t attempt,
+                              std::unique_ptr<CoordinatorNodeMessage> response)
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            QuorumSlot& slot = state.slots[index];
+            if (state.settled || slot.answered || slot.attempt != attempt) {
+                return;     // 결과 확정 후 / 이전 시도의 응답
+            }
+            slot.request_id = 0;
+
+            // BUSY는 같은 노드에 retry_after_ms 후 재시도 (대기는 호출자 스레드가 담당)
+            if (response && response->has_error_response() && response->error_response().code() == NODE_ERROR_BUSY) {
+                slot.client->RecordBusyResponse();
+                auto retry_at = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(response->error_response().retry_after_ms());
+                if (slot.busy_retries < slot.client->GetBusyRetryLimit() && retry_at < state.deadline) {
+                    slot.busy_retries++;
+                    slot.retry_pending = true;
+                    slot.retry_at = retry_at;
+                    state.cv.notify_all();
+                    return;
+                }
+            }
+
+            slot.answered = true;
+            if (IsSuccessfulNodeResponse(slot.node_id, response.get())) {
+                state.successes.emplace_back(index, std::move(response));
+            } else {
+                state.failures.push_back(index);
+            }
+            state.cv.notify_all();
+        }
+
+        // state.mutex 없이 호출 - 큐잉(TryPush)이 막힐 수 있고, 송신 스레드의 deadline 만료 처리가
+        // OnQuorumResponse로 같은 mutex를 잡으므로 시도 번호만 잠금 안에서 올리고 전송은 밖에서 수행
+        void DispatchQuorumRequest(const std::shared_ptr<QuorumState>& state, size_t index,
+                                   const CoordinatorNodeMessage* request)
+        {
+            QuorumSlot& slot = state->slots[index];
+            uint32_t attempt;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->settled || slot.answered) {
+                    return;
+                }
+                attempt = ++slot.attempt;
+            }
+
+            uint64_t request_id = 0;
+            if (slot.client) {
+                request_id = slot.client->SendRequestWithCallback(request,
+                    [state, index, attempt](std::unique_ptr<CoordinatorNodeMessage> response) {
+                        OnQuorumResponse(*state, index, attempt, std::move(response));
+                    }, state->deadline);
+            } else {
+                LOG_ERRORF("CoordinatorServer", "Node not found: %s", slot.node_id.c_str());
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (slot.answered || slot.attempt != attempt) {
+                return;
+            }
+            if (request_id == 0) {
+                // 미연결 / 큐 가득 → 즉시 실패 (재연결은 NodeTcpClient가 백그라운드에서 수행)
+                LOG_ERRORF("CoordinatorServer", "Broadcast failed for node: %s - not connected", slot.node_id.c_str());
+                slot.answered = true;
+                state->failures.push_back(index);
+                state->cv.notify_all();
+                return;
+            }
+            if (!slot.retry_pending) {
+                slot.request_id = request_id;   // 콜백이 먼저 BUSY로 돌아온 경우는 제외
+            }
+        }
+
+        // drain deadline이 지나도 abort된 요청의 에러 응답은 보내도록 주는 여유
+        constexpr std::chrono::milliseconds DRAIN_RESPONSE_GRACE(1000);
+    }
+
     std::unique_ptr<CoordinatorServer> CoordinatorServer::instance = nullptr;
     std::mutex CoordinatorServer::instance_mutex;
 
@@ -50,6 +184,166 @@ namespace mpc_engine::coordinator
             return false;
         }
 
+        std::chrono::milliseconds round_timeout(Config::HasKey("COORDINATOR_MPC_ROUND_TIMEOUT_MS")
+            ? Config::GetUInt32("COORDINATOR_MPC_ROUND_TIMEOUT_MS") : 10000);
+        session::MpcRoundBatchConfig batching;
+        if (Config::HasKey("COORDINATOR_MPC_BATCH_WINDOW_US")) 
+        {
+            batching.window = std::chrono::microseconds(Config::GetUInt32("COORDINATOR_MPC_BATCH_WINDOW_US"));
+        }
+        if (Config::HasKey("COORDINATOR_MPC_BATCH_MAX")) 
+        {
+            batching.max_batch = Config::GetUInt32("COORDINATOR_MPC_BATCH_MAX");
+        }
+        session::MpcHedgeConfig hedging;
+        if (Config::HasKey("COORDINATOR_MPC_HEDGE_PERCENT")) 
+        {
+            hedging.max_ratio = Config::GetUInt32("COORDINATOR_MPC_HEDGE_PERCENT") / 100.0;
+        }
+        if (Config::HasKey("COORDINATOR_MPC_HEDGE_MIN_DELAY_US")) 
+        {
+            hedging.min_delay = std::chrono::microseconds(Config::GetUInt32("COORDINATOR_MPC_HEDGE_MIN_DELAY_US"));
+        }
+        session::PresignaturePoolConfig presign;
+        if (Config::HasKey("COORDINATOR_PRESIGN_TARGET_DEPTH")) 
+        {
+            presign.target_depth = Config::GetUInt32("COORDINATOR_PRESIGN_TARGET_DEPTH");
+        }
+        if (Config::HasKey("COORDINATOR_PRESIGN_MAX_IN_FLIGHT")) 
+        {
+            presign.max_in_flight = Config::GetUInt32("COORDINATOR_PRESIGN_MAX_IN_FLIGHT");
+        }
+        if (Config::HasKey("COORDINATOR_PRESIGN_REFILL_PER_SEC")) 
+        {
+            presign.refill_per_second = Config::GetUInt32("COORDINATOR_PRESIGN_REFILL_PER_SEC");
+        }
+        if (Config::HasKey("COORDINATOR_PRESIGN_MAX_AGE_MS")) 
+        {
+            presign.max_age = std::chrono::milliseconds(Config::GetUInt32("COORDINATOR_PRESIGN_MAX_AGE_MS"));
+        }
+        if (Config::HasKey("COORDINATOR_PRESIGN_MAX_KEYS")) 
+        {
+            presign.max_keys = Config::GetUInt32("COORDINATOR_PRESIGN_MAX_KEYS");
+        }
+        if (Config::HasKey("COORDINATOR_PRESIGN_IDLE_TTL_MS")) 
+        {
+            presign.idle_ttl = std::chrono::milliseconds(Config::GetUInt32("COORDINATOR_PRESIGN_IDLE_TTL_MS"));
+        }
+        if (Config::HasKey("COORDINATOR_PRESIGN_ENROLL_WALLET_KEYS")) 
+        {
+            presign.enroll_wallet_keys = Config::GetBool("COORDINATOR_PRESIGN_ENROLL_WALLET_KEYS");
+        }
+        session::PregeneratedKeyPoolConfig key_pool_config;
+        if (Config::HasKey("COORDINATOR_KEY_POOL_TARGET_DEPTH")) 
+        {
+            key_pool_config.target_depth = Config::GetUInt32("COORDINATOR_KEY_POOL_TARGET_DEPTH");
+        }
+        if (Config::HasKey("COORDINATOR_KEY_POOL_LOW_WATERMARK")) 
+        {
+            key_pool_config.low_watermark = Config::GetUInt32("COORDINATOR_KEY_POOL_LOW_WATERMARK");
+        }
+        if (Config::HasKey("COORDINATOR_KEY_POOL_BATCH")) 
+        {
+            key_pool_config.batch_size = Config::GetUInt32("COORDINATOR_KEY_POOL_BATCH");
+        }
+        if (Config::HasKey("COORDINATOR_KEY_POOL_KEYS_PER_SEC")) 
+        {
+            key_pool_config.keys_per_second = Config::GetUInt32("COORDINATOR_KEY_POOL_KEYS_PER_SEC");
+        }
+        if (Config::HasKey("COORDINATOR_KEY_POOL_MAX_ACTIVE_SESSIONS")) 
+        {
+            key_pool_config.max_active_sessions = Config::GetUInt32("COORDINATOR_KEY_POOL_MAX_ACTIVE_SESSIONS");
+        }
+        if (Config::HasKey("MPC_THRESHOLD")) 
+        {
+            key_pool_config.threshold = Config::GetUInt32("MPC_THRESHOLD");
+        }
+        handlers::wallet::WalletRequestDedupConfig dedup;
+        if (Config::HasKey("COORDINATOR_WALLET_DEDUP_MAX_ENTRIES")) 
+        {
+            dedup.max_entries = Config::GetUInt32("COORDINATOR_WALLET_DEDUP_MAX_ENTRIES");
+        }
+        if (Config::HasKey("COORDINATOR_WALLET_DEDUP_TTL_MS")) 
+        {
+            dedup.ttl = std::chrono::milliseconds(Config::GetUInt32("COORDINATOR_WALLET_DEDUP_TTL_MS"));
+        }
+        handlers::wallet::ConfigureWalletRequestDedup(dedup);
+        network::NodeSelectionConfig selection;
+        if (Config::HasKey("COORDINATOR_NODE_SELECTION")) 
+        {
+            selection.policy = network::NodeSelectionPolicyFromString(Config::GetString("COORDINATOR_NODE_SELECTION"));
+        }
+        if (Config::HasKey("COORDINATOR_PREFERRED_NODES")) 
+        {
+            selection.preferred_nodes = Config::GetStringArray("COORDINATOR_PREFERRED_NODES");
+        }
+        if (Config::HasKey("COORDINATOR_AVOIDED_NODES")) 
+        {
+            selection.avoided_nodes = Config::GetStringArray("COORDINATOR_AVOIDED_NODES");
+        }
+        if (Config::HasKey("COORDINATOR_PREFERRED_PLATFORMS")) 
+        {
+            for (const std::string& platform : Config::GetStringArray("COORDINATOR_PREFERRED_PLATFORMS")) 
+            {
+                selection.preferred_platforms.push_back(PlatformTypeFromString(platform));
+            }
+        }
+        if (Config::HasKey("COORDINATOR_AVOIDED_PLATFORMS")) 
+        {
+            for (const std::string& platform : Config::GetStringArray("COORDINATOR_AVOIDED_PLATFORMS")) 
+            {
+                selection.avoided_platforms.push_back(PlatformTypeFromString(platform));
+            }
+        }
+        SetNodeSelection(selection);
+        if (Config::HasKey("COORDINATOR_ENGINE_SET_VNODES")) 
+        {
+            engine_sets.SetVirtualNodes(Config::GetUInt32("COORDINATOR_ENGINE_SET_VNODES"));
+        }
+        if (Config::HasKey("COORDINATOR_KEY_PLACEMENT_FILE")) 
+        {
+            // 배치 기록 없이 시작하면 기존 키의 서명 노드를 알 수 없음
+            if (!key_placements.Open(Config::GetString("COORDINATOR_KEY_PLACEMENT_FILE"))) 
+            {
+                return false;
+            }
+        }
+        else 
+        {
+            LOG_WARN("CoordinatorServer", "COORDINATOR_KEY_PLACEMENT_FILE not set - key placements are lost on restart");
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(session_engine_mutex);
+            session_engine = std::make_shared<session::MpcSessionEngine>(
+                [this](const std::string& node_id) { return FindNodeClientInternal(node_id); },
+                round_timeout, batching,
+                [this](const std::vector<std::string>& node_ids) { return OrderNodeCandidates(node_ids); });
+            session_engine->SetHedging(hedging);
+            if (Config::HasKey("COORDINATOR_MPC_PEER_MESH")) 
+            {
+                session_engine->SetPeerMesh(Config::GetBool("COORDINATOR_MPC_PEER_MESH"));
+            }
+            if (Config::HasKey("COORDINATOR_MPC_OPAQUE_RELAY")) 
+            {
+                session_engine->SetOpaqueRelay(Config::GetBool("COORDINATOR_MPC_OPAQUE_RELAY"));
+            }
+            keygen_batch = std::make_shared<session::MpcKeygenBatch>(
+                [this](const std::string& node_id) { return FindNodeClientInternal(node_id); }, round_timeout);
+            if (presign.Enabled()) 
+            {
+                presignature_pool = std::make_shared<session::PresignaturePool>(*session_engine, presign);
+            }
+            if (key_pool_config.Enabled()) 
+            {
+                key_pool = std::make_shared<session::PregeneratedKeyPool>(*session_engine, keygen_batch,
+                    [this](const std::string& key_id) { return GetKeyNodeIds(key_id); }, key_pool_config);
+            }
+        }
+        InstallWalletSigningBackend();
+        InstallWalletKeyBackend();
+
+        is_draining = false;
         is_running = true;
         LOG_INFO("CoordinatorServer", "Coordinator server started");
         return true;
@@ -64,6 +358,44 @@ namespace mpc_engine::coordinator
         }
     
         is_running = false;
+        handlers::wallet::SetWalletSigningBackend(nullptr);
+        handlers::wallet::SetWalletKeyBackend(nullptr);
+
+        // 진행 중인 MPC 세션 abort (노드 연결 해제 전에 노드에 abort 전달)
+        // pool은 엔진이 진행 중 presign 세션을 모두 끝낸 뒤 종료 (세션 콜백이 pool을 참조)
+        // 키 pool은 엔진보다 먼저 종료 (보충 스레드가 엔진 상태를 조회, 진행 중 keygen 배치는 노드 연결이 필요)
+        std::shared_ptr<session::MpcSessionEngine> engine;
+        std::shared_ptr<session::PresignaturePool> pool;
+        std::shared_ptr<session::PregeneratedKeyPool> keys;
+        {
+            std::lock_guard<std::mutex> lock(session_engine_mutex);
+            engine = std::move(session_engine);
+            pool = std::move(presignature_pool);
+            keys = std::move(key_pool);
+            keygen_batch.reset();
+        }
+        if (keys) 
+        {
+            keys->Shutdown();
+            session::PregeneratedKeyPoolStats stats = keys->GetStats();
+            LOG_INFOF("CoordinatorServer", "Key pool: depth %zu, %zu wallets assigned, hit rate %.1f%% (%llu/%llu)",
+                      stats.depth, stats.assigned, stats.HitRate() * 100.0,
+                      static_cast<unsigned long long>(stats.hits),
+                      static_cast<unsigned long long>(stats.hits + stats.misses));
+        }
+        if (engine) 
+        {
+            engine->Shutdown();
+        }
+        if (pool) 
+        {
+            session::PresignaturePoolStats stats = pool->GetStats();
+            LOG_INFOF("CoordinatorServer", "Presignature pool: depth %zu, hit rate %.1f%% (%llu/%llu)",
+                      stats.depth, stats.HitRate() * 100.0,
+                      static_cast<unsigned long long>(stats.hits),
+                      static_cast<unsigned long long>(stats.hits + stats.misses));
+            pool->Shutdown();
+        }
         
         // HTTPS 서버 중지
         StopHttpsServer();
@@ -79,6 +411,66 @@ namespace mpc_engine::coordinator
         return is_running.load();
     }
 
+    CoordinatorDrainReport CoordinatorServer::Drain(std::chrono::milliseconds timeout) 
+    {
+        CoordinatorDrainReport report;
+        if (!is_running.load() || is_draining.exchange(true)) 
+        {
+            LOG_WARN("CoordinatorServer", "Coordinator server is not running or already draining");
+            return report;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto deadline = start + timeout;
+        // 올림 - 내림하면 세션 대기가 deadline보다 1ms 미만 먼저 끝나 아직 끝날 수 있는 세션을 abort
+        auto remaining = [deadline]() {
+            return std::max(std::chrono::milliseconds(0),
+                std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()));
+        };
+        LOG_INFOF("CoordinatorServer", "Draining (timeout %lldms)...", static_cast<long long>(timeout.count()));
+
+        // 1. 새 연결 수락 중지, health check 503, 새 Wallet 요청 503
+        if (https_server) 
+        {
+            https_server->BeginDrain();
+        }
+
+        // 2. 새 MPC 세션 거부, 키 pool 보충 중단 (진행 중 keygen 배치는 라운드 타임아웃 안에 끝남)
+        std::shared_ptr<session::MpcSessionEngine> engine = GetSessionEngine();
+        std::shared_ptr<session::PregeneratedKeyPool> keys = GetKeyPool();
+        if (engine) 
+        {
+            engine->StopAccepting();
+        }
+        if (keys) 
+        {
+            keys->Shutdown();
+        }
+
+        // 3. 진행 중 세션은 deadline까지 대기, 남은 세션은 노드에 abort (노드 연결이 살아 있을 때)
+        if (engine) 
+        {
+            report.sessions = engine->Drain(remaining());
+        }
+
+        // 4. 처리 중이던 Wallet 요청의 응답 전송 (abort된 세션의 에러 응답 포함)
+        if (https_server) 
+        {
+            report.unanswered_requests = https_server->WaitForPendingResponses(std::max(remaining(), DRAIN_RESPONSE_GRACE));
+        }
+
+        report.elapsed_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count());
+        LOG_INFOF("CoordinatorServer", "Drain finished in %llums: %zu sessions in flight, %llu completed, %llu failed, %llu aborted, %llu lost, %zu wallet requests unanswered",
+                  static_cast<unsigned long long>(report.elapsed_ms), report.sessions.in_flight,
+                  static_cast<unsigned long long>(report.sessions.completed),
+                  static_cast<unsigned long long>(report.sessions.failed),
+                  static_cast<unsigned long long>(report.sessions.aborted),
+                  static_cast<unsigned long long>(report.sessions.lost),
+                  report.unanswered_requests);
+        return report;
+    }
+
     // ========================================
     // Node 관리
     // ========================================
@@ -96,9 +488,7 @@ namespace mpc_engine::coordinator
             return false;
         }
 
-        std::lock_guard<std::mutex> lock(nodes_mutex);
-        
-        if (node_clients.find(node_id) != node_clients.end()) 
+        if (HasNode(node_id)) 
         {
             LOG_ERRORF("CoordinatorServer", "Node already registered: %s", node_id.c_str());
             return false;
@@ -108,13 +498,25 @@ namespace mpc_engine::coordinator
         std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
         std::vector<std::string> tls_cert_paths = Config::GetStringArray("TLS_CERT_PATHS");
         std::vector<std::string> tls_kms_nodes_coordinator_key_ids = Config::GetStringArray("TLS_KMS_NODES_COORDINATOR_KEY_IDS");
+        std::vector<std::string> engine_set_ids = Config::HasKey("NODE_ENGINE_SETS")
+            ? Config::GetStringArray("NODE_ENGINE_SETS") : std::vector<std::string>();
+        std::vector<std::pair<std::string, uint16_t>> mesh_hosts = Config::HasKey("NODE_MESH_HOSTS")
+            ? Config::GetNodeEndpoints("NODE_MESH_HOSTS") : std::vector<std::pair<std::string, uint16_t>>();
 
         std::string certificate_path;
         std::string private_key_id;
+        std::string engine_set = "default";
+        std::pair<std::string, uint16_t> mesh_endpoint("", 0);
         
         bool found = false;
         for (size_t i = 0; i < node_ids.size(); ++i) {
             if (node_ids[i] == node_id) {
+                if (i < engine_set_ids.size() && !engine_set_ids[i].empty()) {
+                    engine_set = engine_set_ids[i];
+                }
+                if (i < mesh_hosts.size()) {
+                    mesh_endpoint = mesh_hosts[i];
+                }
                 if (i < tls_cert_paths.size() && i < tls_kms_nodes_coordinator_key_ids.size()) {
                     certificate_path = tls_cert_paths[i];
                     private_key_id = tls_kms_nodes_coordinator_key_ids[i];
@@ -132,6 +534,7 @@ namespace mpc_engine::coordinator
         std::unique_ptr<network::NodeTcpClient> node_client = std::make_unique<network::NodeTcpClient>(
             node_id, address, port, platform, shard_index, certificate_path, private_key_id
         );
+        node_client->SetPeerMeshEndpoint(mesh_endpoint.first, mesh_endpoint.second);
         
         if (!node_client->Initialize()) {
             LOG_ERRORF("CoordinatorServer", "Failed to initialize TLS context for node: %s", node_id.c_str());
@@ -148,31 +551,51 @@ namespace mpc_engine::coordinator
             OnNodeStatusChanged(node_id, ConnectionStatus::DISCONNECTED);
         });
         
-        node_clients[node_id] = std::move(node_client);
+        // TLS 초기화는 게시 전에 끝냄 - 동시 등록은 게시 시점에 한 번 더 확인
+        bool added = node_clients.Update([&](NodeClientMap& clients) {
+            return clients.emplace(node_id, std::move(node_client)).second;
+        });
+        if (!added) 
+        {
+            LOG_ERRORF("CoordinatorServer", "Node already registered: %s", node_id.c_str());
+            return false;
+        }
+        engine_sets.AddNode(engine_set, node_id);
 
-        LOG_INFOF("CoordinatorServer", "Node registered: %s at %s:%d (platform: %s, shard: %d)",
-                  node_id.c_str(), address.c_str(), port, PlatformTypeToString(platform).c_str(), shard_index);
+        LOG_INFOF("CoordinatorServer", "Node registered: %s at %s:%d (platform: %s, shard: %d, engine set: %s)",
+                  node_id.c_str(), address.c_str(), port, PlatformTypeToString(platform).c_str(), shard_index, engine_set.c_str());
 
         return true;
     }
 
     void CoordinatorServer::UnregisterNode(const std::string& node_id) 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
-        
-        auto it = node_clients.find(node_id);
-        if (it != node_clients.end()) 
+        std::shared_ptr<network::NodeTcpClient> removed;
+        node_clients.Update([&](NodeClientMap& clients) {
+            auto it = clients.find(node_id);
+            if (it == clients.end()) 
+            {
+                return false;
+            }
+            removed = std::move(it->second);
+            clients.erase(it);
+            return true;
+        });
+
+        if (removed) 
         {
-            it->second->Disconnect();
-            node_clients.erase(it);
+            // 이전 스냅샷을 읽는 요청이 남아 있을 수 있음 - 연결만 끊고 해제는 마지막 참조가 사라질 때
+            removed->Disconnect();
+            engine_sets.RemoveNode(node_id);
             LOG_INFOF("CoordinatorServer", "Node unregistered: %s", node_id.c_str());
         }
     }
 
     bool CoordinatorServer::HasNode(const std::string& node_id) const 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
-        return node_clients.find(node_id) != node_clients.end();
+        std::shared_ptr<const NodeClientMap> snapshot = node_clients.Read();
+        const NodeClientMap& clients = *snapshot;
+        return clients.find(node_id) != clients.end();
     }
 
     // ========================================
@@ -181,7 +604,7 @@ namespace mpc_engine::coordinator
 
     bool CoordinatorServer::ConnectToNode(const std::string& node_id) 
     {
-        network::NodeTcpClient* client = FindNodeClientInternal(node_id);
+        std::shared_ptr<network::NodeTcpClient> client = FindNodeClientInternal(node_id);
         if (!client) {
             LOG_ERRORF("CoordinatorServer", "Node not found: %s", node_id.c_str());
             return false;
@@ -192,7 +615,7 @@ namespace mpc_engine::coordinator
 
     void CoordinatorServer::DisconnectFromNode(const std::string& node_id) 
     {
-        network::NodeTcpClient* client = FindNodeClientInternal(node_id);
+        std::shared_ptr<network::NodeTcpClient> client = FindNodeClientInternal(node_id);
         if (client) {
             client->Disconnect();
         }
@@ -200,15 +623,15 @@ namespace mpc_engine::coordinator
 
     bool CoordinatorServer::IsNodeConnected(const std::string& node_id) const 
     {
-        network::NodeTcpClient* client = FindNodeClientInternal(node_id);
+        std::shared_ptr<network::NodeTcpClient> client = FindNodeClientInternal(node_id);
         return client && client->IsConnected();
     }
 
     void CoordinatorServer::DisconnectAllNodes() 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
+        std::shared_ptr<const NodeClientMap> clients = node_clients.Load();
 
-        for (auto& entry : node_clients)
+        for (const auto& entry : *clients)
         {
             if (entry.second) 
             {
@@ -223,16 +646,154 @@ namespace mpc_engine::coordinator
 
     std::unique_ptr<CoordinatorNodeMessage> CoordinatorServer::SendToNode(
         const std::string& node_id, 
-        const CoordinatorNodeMessage* request) 
+        const CoordinatorNodeMessage* request,
+        utils::Deadline deadline) 
     {
-        network::NodeTcpClient* client = FindNodeClientInternal(node_id);
+        std::shared_ptr<network::NodeTcpClient> client = FindNodeClientInternal(node_id);
         if (!client) 
         {
             LOG_ERRORF("CoordinatorServer", "Node not found: %s", node_id.c_str());
             return nullptr;
         }
 
-        return client->SendRequest(request);
+        return client->SendRequest(request, deadline);
+    }
+
+    std::unique_ptr<CoordinatorNodeMessage> CoordinatorServer::SendToAnyNode(
+        const std::vector<std::string>& node_ids,
+        const CoordinatorNodeMessage* request,
+        std::string* served_by,
+        utils::Deadline deadline)
+    {
+        std::unique_ptr<CoordinatorNodeMessage> last_response;
+
+        for (const std::string& node_id : node_ids)
+        {
+            // 기한이 지나면 다음 노드도 응답을 쓸 수 없음
+            if (std::chrono::steady_clock::now() >= deadline) {
+                LOG_WARNF("CoordinatorServer", "Deadline exceeded before trying node %s", node_id.c_str());
+                break;
+            }
+
+            std::unique_ptr<CoordinatorNodeMessage> response = SendToNode(node_id, request, deadline);
+
+            if (response && !network::NodeTcpClient::IsRetryableNodeError(*response)) {
+                if (served_by) {
+                    *served_by = node_id;
+                }
+                return response;
+            }
+
+            LOG_WARNF("CoordinatorServer", "Node %s unavailable (%s), trying next node", node_id.c_str(),
+                response ? NodeErrorCode_Name(response->error_response().code()).c_str() : "no response");
+
+            if (response) {
+                last_response = std::move(response);
+            }
+        }
+
+        return last_response;
+    }
+
+    QuorumResult CoordinatorServer::BroadcastToQuorum(
+        const std::vector<std::string>& node_ids,
+        const CoordinatorNodeMessage* request,
+        size_t threshold,
+        std::chrono::milliseconds timeout)
+    {
+        QuorumResult result;
+        result.threshold = threshold;
+
+        if (!request || threshold == 0 || threshold > node_ids.size()) {
+            LOG_ERRORF("CoordinatorServer", "Invalid quorum fan-out: threshold %zu of %zu nodes", threshold, node_ids.size());
+            return result;
+        }
+
+        auto start_time = std::chrono::steady_clock::now();
+
+        auto state = std::make_shared<QuorumState>();
+        state->deadline = start_time + timeout;
+        state->slots.resize(node_ids.size());
+        for (size_t i = 0; i < node_ids.size(); ++i) {
+            state->slots[i].node_id = node_ids[i];
+            state->slots[i].client = FindNodeClientInternal(node_ids[i]);
+        }
+
+        // 1. 모든 Node에 요청 큐잉 - 응답은 각 노드의 수신 스레드가 콜백으로 전달 (스레드 생성 없음)
+        for (size_t i = 0; i < node_ids.size(); ++i) {
+            DispatchQuorumRequest(state, i, request);
+        }
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+
+        // 2. 정족수 달성 / 불가능 / 타임아웃 중 먼저 오는 시점까지 대기 (BUSY 재시도는 여기서 재전송)
+        while (state->successes.size() < threshold && node_ids.size() - state->failures.size() >= threshold) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= state->deadline) {
+                break;
+            }
+
+            auto wake = state->deadline;
+            for (const QuorumSlot& slot : state->slots) {
+                if (slot.retry_pending) {
+                    wake = std::min(wake, slot.retry_at);
+                }
+            }
+            state->cv.wait_until(lock, wake);
+
+            now = std::chrono::steady_clock::now();
+            std::vector<size_t> retries;
+            for (size_t i = 0; i < state->slots.size(); ++i) {
+                QuorumSlot& slot = state->slots[i];
+                if (slot.retry_pending && slot.retry_at <= now) {
+                    slot.retry_pending = false;
+                    retries.push_back(i);
+                }
+            }
+            if (!retries.empty()) {
+                lock.unlock();
+                for (size_t index : retries) {
+                    DispatchQuorumRequest(state, index, request);
+                }
+                lock.lock();
+            }
+        }
+
+        // 3. 결과 확정 - 남은 요청 취소 (늦은 응답은 수신 스레드에서 버려짐)
+        state->settled = true;
+
+        result.reached = state->successes.size() >= threshold;
+        for (auto& success : state->successes) {
+            result.participants.push_back(node_ids[success.first]);
+            result.responses.push_back(std::move(success.second));
+        }
+        for (size_t index : state->failures) {
+            result.failed.push_back(node_ids[index]);
+        }
+        for (QuorumSlot& slot : state->slots) {
+            if (slot.answered) {
+                continue;
+            }
+            if (slot.request_id != 0) {
+                slot.client->CancelRequest(slot.request_id);
+            }
+            result.stragglers.push_back(slot.node_id);
+        }
+        lock.unlock();
+
+        result.elapsed_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_time).count());
+
+        if (result.reached) {
+            LOG_DEBUGF("CoordinatorServer", "Quorum %zu/%zu reached in %llums (%zu stragglers cancelled)",
+                threshold, node_ids.size(), static_cast<unsigned long long>(result.elapsed_ms), result.stragglers.size());
+        } else {
+            LOG_ERRORF("CoordinatorServer", "Quorum %zu/%zu not reached in %llums (success: %zu, failed: %zu, no response: %zu)",
+                threshold, node_ids.size(), static_cast<unsigned long long>(result.elapsed_ms),
+                result.participants.size(), result.failed.size(), result.stragglers.size());
+        }
+
+        return result;
     }
 
     bool CoordinatorServer::BroadcastToNodes(
@@ -243,64 +804,562 @@ namespace mpc_engine::coordinator
             LOG_WARN("CoordinatorServer", "No node IDs provided for broadcast");
             return true;
         }
-    
-        // 1. 모든 Node에 비동기 요청
-        std::vector<std::pair<std::string, std::future<std::unique_ptr<CoordinatorNodeMessage>>>> futures;
-        
-        for (const std::string& node_id : node_ids) 
+
+        return BroadcastToQuorum(node_ids, request, node_ids.size()).reached;
+    }
+
+    bool CoordinatorServer::BroadcastToAllConnectedNodes(const CoordinatorNodeMessage* request) 
+    {
+        std::vector<std::string> connected_nodes = GetConnectedNodeIds();
+        return BroadcastToNodes(connected_nodes, request);
+    }
+
+    // ========================================
+    // MPC 세션
+    // ========================================
+
+    std::string CoordinatorServer::StartMpcSession(session::MpcSessionSpec spec, session::MpcSessionCallback callback) 
+    {
+        std::shared_ptr<session::MpcSessionEngine> engine = GetSessionEngine();
+        if (!engine) 
         {
-            auto future = std::async(std::launch::async, [this, node_id, request]() {
-                return SendToNode(node_id, request);
-            });
-            
-            futures.emplace_back(node_id, std::move(future));
+            session::MpcSessionResult result;
+            result.session_id = spec.session_id;
+            result.status = session::MpcSessionStatus::ABORTED;
+            result.error_message = "Coordinator server is not running";
+            if (callback) 
+            {
+                callback(result);
+            }
+            return spec.session_id;
         }
-    
-        // 2. 모든 응답 대기 및 결과 확인
-        bool all_success = true;
-        
-        for (auto& pair : futures) 
+        return engine->Start(std::move(spec), std::move(callback));
+    }
+
+    session::MpcSessionResult CoordinatorServer::RunMpcSession(session::MpcSessionSpec spec) 
+    {
+        std::promise<session::MpcSessionResult> promise;
+        std::future<session::MpcSessionResult> future = promise.get_future();
+        StartMpcSession(std::move(spec), [&promise](const session::MpcSessionResult& result) {
+            promise.set_value(result);
+        });
+        return future.get();
+    }
+
+    session::MpcKeygenBatchResult CoordinatorServer::RunKeygenBatch(session::MpcKeygenBatchSpec spec) 
+    {
+        std::shared_ptr<session::MpcKeygenBatch> runner;
         {
-            const std::string& node_id = pair.first;
-            
-            try {
-                // 타임아웃 35초
-                if (pair.second.wait_for(std::chrono::seconds(35)) == std::future_status::timeout) {
-                    LOG_ERRORF("CoordinatorServer", "Broadcast timeout for node: %s", node_id.c_str());
-                    all_success = false;
-                    continue;
-                }
-                
-                std::unique_ptr<CoordinatorNodeMessage> response = pair.second.get();
-                
-                if (!response) {
-                    LOG_ERRORF("CoordinatorServer", "Broadcast failed for node: %s - null response", node_id.c_str());
-                    all_success = false;
-                    continue;
+            std::lock_guard<std::mutex> lock(session_engine_mutex);
+            runner = keygen_batch;
+        }
+        if (runner) 
+        {
+            return runner->Run(std::move(spec));
+        }
+
+        session::MpcKeygenBatchResult result;
+        result.batch_id = spec.batch_id;
+        for (const std::string& key_id : spec.key_ids) 
+        {
+            session::MpcKeygenKeyResult key;
+            key.key_id = key_id;
+            key.status = session::MpcSessionStatus::ABORTED;
+            key.error_message = "Coordinator server is not running";
+            result.keys.push_back(key);
+        }
+        result.failed = result.keys.size();
+        return result;
+    }
+
+    bool CoordinatorServer::AbortMpcSession(const std::string& session_id, const std::string& reason) 
+    {
+        std::shared_ptr<session::MpcSessionEngine> engine = GetSessionEngine();
+        return engine && engine->Abort(session_id, reason);
+    }
+
+    session::MpcSessionEngineStats CoordinatorServer::GetMpcSessionStats() const 
+    {
+        std::shared_ptr<session::MpcSessionEngine> engine = GetSessionEngine();
+        return engine ? engine->GetStats() : session::MpcSessionEngineStats();
+    }
+
+    void CoordinatorServer::SetMpcRoundBatching(const session::MpcRoundBatchConfig& config) 
+    {
+        std::shared_ptr<session::MpcSessionEngine> engine = GetSessionEngine();
+        if (engine) 
+        {
+            engine->SetRoundBatching(config);
+        }
+    }
+
+    void CoordinatorServer::SetMpcHedging(const session::MpcHedgeConfig& config) 
+    {
+        std::shared_ptr<session::MpcSessionEngine> engine = GetSessionEngine();
+        if (engine) 
+        {
+            engine->SetHedging(config);
+        }
+    }
+
+    void CoordinatorServer::SetMpcPeerMesh(bool enabled) 
+    {
+        std::shared_ptr<session::MpcSessionEngine> engine = GetSessionEngine();
+        if (engine) 
+        {
+            engine->SetPeerMesh(enabled);
+        }
+    }
+
+    void CoordinatorServer::SetMpcOpaqueRelay(bool enabled) 
+    {
+        std::shared_ptr<session::MpcSessionEngine> engine = GetSessionEngine();
+        if (engine) 
+        {
+            engine->SetOpaqueRelay(enabled);
+        }
+    }
+
+    // ========================================
+    // 참여 노드 선택
+    // ========================================
+
+    void CoordinatorServer::SetNodeSelection(const network::NodeSelectionConfig& config) 
+    {
+        auto selector = std::make_shared<const network::NodeSelector>(config);
+        std::lock_guard<std::mutex> lock(node_selector_mutex);
+        node_selector = std::move(selector);
+        LOG_INFOF("CoordinatorServer", "Node selection policy: %s", network::NodeSelectionPolicyToString(config.policy));
+    }
+
+    network::NodeSelectionConfig CoordinatorServer::GetNodeSelection() const 
+    {
+        std::lock_guard<std::mutex> lock(node_selector_mutex);
+        return node_selector ? node_selector->GetConfig() : network::NodeSelectionConfig();
+    }
+
+    std::vector<std::string> CoordinatorServer::SelectNodes(const std::vector<std::string>& candidates, size_t count) const 
+    {
+        std::vector<std::string> selected;
+        for (std::string& node_id : OrderNodeCandidates(candidates)) 
+        {
+            if (selected.size() == count) 
+            {
+                break;
+            }
+            if (IsNodeConnected(node_id)) 
+            {
+                selected.push_back(std::move(node_id));
+            }
+        }
+        return selected;
+    }
+
+    std::vector<std::string> CoordinatorServer::OrderNodeCandidates(const std::vector<std::string>& node_ids) const 
+    {
+        std::shared_ptr<const network::NodeSelector> selector;
+        {
+            std::lock_guard<std::mutex> lock(node_selector_mutex);
+            selector = node_selector;
+        }
+        if (!selector) 
+        {
+            return node_ids;
+        }
+
+        std::vector<network::NodeCandidate> candidates;
+        candidates.reserve(node_ids.size());
+        {
+            std::shared_ptr<const NodeClientMap> snapshot = node_clients.Read();
+            const NodeClientMap& clients = *snapshot;
+            for (const std::string& node_id : node_ids) 
+            {
+                network::NodeCandidate candidate;
+                candidate.node_id = node_id;
+                auto it = clients.find(node_id);
+                if (it != clients.end() && it->second) 
+                {
+                    candidate.platform = it->second->GetPlatform();
+                    candidate.load = it->second->GetLoadSnapshot();
                 }
+                candidates.push_back(std::move(candidate));
+            }
+        }
+        return selector->Order(std::move(candidates), utils::GetCurrentTimeMs());
+    }
+
+    std::shared_ptr<session::MpcSessionEngine> CoordinatorServer::GetSessionEngine() const 
+    {
+        // 세션 콜백이 다시 세션을 시작할 수 있으므로 엔진 호출 중에는 lock을 잡지 않음
+        std::lock_guard<std::mutex> lock(session_engine_mutex);
+        return session_engine;
+    }
+
+    // ========================================
+    // Presignature pool / ECDSA 서명
+    // ========================================
+
+    void CoordinatorServer::SetPresignaturePool(const session::PresignaturePoolConfig& config) 
+    {
+        std::shared_ptr<session::PresignaturePool> previous;
+        {
+            std::lock_guard<std::mutex> lock(session_engine_mutex);
+            previous = std::move(presignature_pool);
+            if (session_engine && config.Enabled()) 
+            {
+                presignature_pool = std::make_shared<session::PresignaturePool>(*session_engine, config);
+            }
+        }
+        if (previous) 
+        {
+            previous->Shutdown();
+        }
+    }
+
+    bool CoordinatorServer::AddPresignatureKey(const std::string& key_id, const std::vector<std::string>& node_ids, uint32_t threshold) 
+    {
+        std::shared_ptr<session::PresignaturePool> pool = GetPresignaturePool();
+        return pool && pool->AddKey(key_id, node_ids, threshold);
+    }
 
-                if (response->has_signing_response()) {
-                    const SigningResponse& signing_resp = response->signing_response();
-                    if (!signing_resp.header().success()) {
-                        LOG_ERRORF("CoordinatorServer", "Broadcast failed for node: %s - error: %s", 
-                            node_id.c_str(), signing_resp.header().error_message().c_str());
-                        all_success = false;
+    void CoordinatorServer::RemovePresignatureKey(const std::string& key_id) 
+    {
+        std::shared_ptr<session::PresignaturePool> pool = GetPresignaturePool();
+        if (pool) 
+        {
+            pool->RemoveKey(key_id);
+        }
+    }
+
+    session::PresignaturePoolStats CoordinatorServer::GetPresignatureStats() const 
+    {
+        std::shared_ptr<session::PresignaturePool> pool = GetPresignaturePool();
+        return pool ? pool->GetStats() : session::PresignaturePoolStats();
+    }
+
+    std::vector<session::PresignatureKeyStats> CoordinatorServer::GetPresignatureKeyStats() const 
+    {
+        std::shared_ptr<session::PresignaturePool> pool = GetPresignaturePool();
+        return pool ? pool->GetKeyStats() : std::vector<session::PresignatureKeyStats>();
+    }
+
+    session::MpcSessionResult CoordinatorServer::SignEcdsa(
+        const std::string& key_id,
+        const std::string& message_hash,
+        const std::vector<std::string>& node_ids,
+        uint32_t threshold,
+        bool* used_presignature,
+        utils::Deadline deadline) 
+    {
+        if (used_presignature) 
+        {
+            *used_presignature = false;
+        }
+        // 실제로 서명하는 노드의 set에 부하 집계 (ring 재계산 결과가 아님)
+        network::EngineSetRouter::Request load = engine_sets.Begin(GetOwningEngineSet(node_ids));
+
+        // 1. 온라인 서명 (presignature 1개 소비) - 등록된 key만, 서명 요청으로는 등록하지 않음
+        std::shared_ptr<session::PresignaturePool> pool = GetPresignaturePool();
+        if (pool) 
+        {
+            std::optional<session::Presignature> presignature = pool->Acquire(key_id);
+            if (presignature) 
+            {
+                session::MpcSessionSpec spec;
+                spec.protocol = MPC_PROTOCOL_ECDSA_ONLINE_SIGNING;
+                spec.key_id = key_id;
+                spec.node_ids = presignature->node_ids;
+                spec.threshold = static_cast<uint32_t>(presignature->node_ids.size());
+                spec.session_input = message_hash;
+                spec.presignature_id = presignature->presignature_id;
+                spec.deadline = deadline;
+
+                session::MpcSessionResult result = RunMpcSession(std::move(spec));
+                if (result.status == session::MpcSessionStatus::COMPLETED) 
+                {
+                    if (used_presignature) 
+                    {
+                        *used_presignature = true;
                     }
+                    load.Finish(true);
+                    return result;
                 }
-                
-            } catch (const std::exception& e) {
-                LOG_ERRORF("CoordinatorServer", "Broadcast exception for node: %s, error: %s", node_id.c_str(), e.what());
-                all_success = false;
+                // presign 참여 노드 연결 끊김 / 노드 재시작으로 presignature 유실 등 - 전체 서명으로 진행
+                LOG_WARNF("CoordinatorServer", "Online signing with %s failed (%s), falling back to full signing",
+                          presignature->presignature_id.c_str(), result.error_message.c_str());
             }
         }
-        
-        return all_success;
+
+        // 2. 전체 서명 세션
+        session::MpcSessionSpec spec;
+        spec.protocol = MPC_PROTOCOL_ECDSA_SIGNING;
+        spec.key_id = key_id;
+        spec.node_ids = node_ids;
+        spec.threshold = threshold;
+        spec.session_input = message_hash;
+        spec.deadline = deadline;
+        session::MpcSessionResult result = RunMpcSession(std::move(spec));
+        load.Finish(result.status == session::MpcSessionStatus::COMPLETED);
+        return result;
     }
 
-    bool CoordinatorServer::BroadcastToAllConnectedNodes(const CoordinatorNodeMessage* request) 
+    std::shared_ptr<session::PresignaturePool> CoordinatorServer::GetPresignaturePool() const 
     {
-        std::vector<std::string> connected_nodes = GetConnectedNodeIds();
-        return BroadcastToNodes(connected_nodes, request);
+        std::lock_guard<std::mutex> lock(session_engine_mutex);
+        return presignature_pool;
+    }
+
+    // ========================================
+    // 미리 생성된 키 pool / 지갑 키 생성
+    // ========================================
+
+    void CoordinatorServer::SetKeyPool(const session::PregeneratedKeyPoolConfig& config) 
+    {
+        std::shared_ptr<session::PregeneratedKeyPool> previous;
+        {
+            std::lock_guard<std::mutex> lock(session_engine_mutex);
+            previous = std::move(key_pool);
+            if (session_engine && keygen_batch && config.Enabled()) 
+            {
+                key_pool = std::make_shared<session::PregeneratedKeyPool>(*session_engine, keygen_batch,
+                    [this](const std::string& key_id) { return GetKeyNodeIds(key_id); }, config);
+            }
+        }
+        if (previous) 
+        {
+            previous->Shutdown();
+        }
+    }
+
+    session::PregeneratedKeyPoolStats CoordinatorServer::GetKeyPoolStats() const 
+    {
+        std::shared_ptr<session::PregeneratedKeyPool> pool = GetKeyPool();
+        return pool ? pool->GetStats() : session::PregeneratedKeyPoolStats();
+    }
+
+    WalletKeyResult CoordinatorServer::CreateWalletKey(const std::string& tenant_id, const std::string& wallet_id, uint32_t threshold,
+                                                       utils::Deadline deadline) 
+    {
+        WalletKeyResult result;
+
+        // 1. pool 키 배정 (메타데이터만 - 노드 통신 없음)
+        std::shared_ptr<session::PregeneratedKeyPool> pool = GetKeyPool();
+        if (pool) 
+        {
+            std::optional<session::PregeneratedKey> key = pool->Assign(tenant_id, wallet_id, threshold);
+            if (key) 
+            {
+                if (!RecordKeyPlacement(*key)) 
+                {
+                    result.error_message = "Failed to record placement of key " + key->key_id;
+                    return result;
+                }
+                EnrollPresignatureKey(*key);
+                result.success = true;
+                result.pregenerated = true;
+                result.key = std::move(*key);
+                return result;
+            }
+        }
+
+        // 2. pool이 비었거나 꺼짐 / threshold 불일치 - 요청 시 keygen
+        session::MpcKeygenBatchSpec spec;
+        spec.key_ids.push_back("wallet-key-" + std::to_string(utils::GetCurrentTimeMs()) + "-" +
+                               std::to_string(next_wallet_key_number.fetch_add(1)));
+        spec.node_ids = (pool && !pool->GetConfig().node_ids.empty()) ? pool->GetConfig().node_ids : GetKeyNodeIds(spec.key_ids.front());
+        spec.threshold = threshold > 0 ? threshold : (pool ? pool->GetConfig().threshold : 0);
+        spec.deadline = deadline;
+
+        network::EngineSetRouter::Request load = engine_sets.Begin(GetOwningEngineSet(spec.node_ids));
+        session::MpcKeygenBatchResult keygen = RunKeygenBatch(spec);
+        const session::MpcKeygenKeyResult& generated = keygen.keys.front();
+        load.Finish(generated.status == session::MpcSessionStatus::COMPLETED);
+        if (generated.status != session::MpcSessionStatus::COMPLETED) 
+        {
+            result.error_message = generated.error_message;
+            return result;
+        }
+
+        session::PregeneratedKey key;
+        key.key_id = generated.key_id;
+        key.public_key = generated.public_key;
+        key.node_ids = keygen.participants;
+        key.threshold = spec.threshold;
+        key.created = std::chrono::steady_clock::now();
+
+        result.key = pool ? pool->Adopt(tenant_id, wallet_id, std::move(key)) : std::move(key);
+        if (!RecordKeyPlacement(result.key)) 
+        {
+            result.error_message = "Failed to record placement of key " + result.key.key_id;
+            return result;
+        }
+        result.success = true;
+        EnrollPresignatureKey(result.key);
+        return result;
+    }
+
+    void CoordinatorServer::EnrollPresignatureKey(const session::PregeneratedKey& key) 
+    {
+        // 키가 배치된 노드로 등록 (서명 시점에 연결된 노드가 아님) - 사용되지 않으면 idle_ttl 후 해제
+        std::shared_ptr<session::PresignaturePool> pool = GetPresignaturePool();
+        if (pool && pool->GetConfig().enroll_wallet_keys) 
+        {
+            pool->AddKey(key.key_id, key.node_ids, key.threshold);
+        }
+    }
+
+    bool CoordinatorServer::RecordKeyPlacement(const session::PregeneratedKey& key) 
+    {
+        // 응답 전에 기록 - Wallet이 key_id를 받은 키는 재시작 후에도 서명 노드를 찾을 수 있어야 함
+        session::KeyPlacement placement;
+        placement.key_id = key.key_id;
+        placement.set_id = GetOwningEngineSet(key.node_ids);
+        placement.node_ids = key.node_ids;
+        placement.threshold = key.threshold;
+        return key_placements.Record(placement);
+    }
+
+    std::string CoordinatorServer::GetOwningEngineSet(const std::vector<std::string>& node_ids) const 
+    {
+        for (const std::string& node_id : node_ids) 
+        {
+            std::string set_id = engine_sets.GetNodeSet(node_id);
+            if (!set_id.empty()) 
+            {
+                return set_id;
+            }
+        }
+        return std::string();
+    }
+
+    std::shared_ptr<session::PregeneratedKeyPool> CoordinatorServer::GetKeyPool() const 
+    {
+        std::lock_guard<std::mutex> lock(session_engine_mutex);
+        return key_pool;
+    }
+
+    void CoordinatorServer::InstallWalletSigningBackend() 
+    {
+        using namespace mpc_engine::proto::wallet_coordinator;
+
+        handlers::wallet::SetWalletSigningBackend(
+            [this](const WalletSigningRequest& request, WalletSigningResponse* response, std::string* error) {
+                // key share가 있는 노드 중 연결된 노드만 - 정족수 미달이면 세션을 시작하지 않음
+                std::vector<std::string> candidates = GetSigningNodeIds(request.key_id());
+                if (candidates.empty()) 
+                {
+                    *error = "Key " + request.key_id() + " has no recorded placement";
+                    return false;
+                }
+                std::vector<std::string> node_ids;
+                for (std::string& node_id : candidates) 
+                {
+                    if (IsNodeConnected(node_id)) 
+                    {
+                        node_ids.push_back(std::move(node_id));
+                    }
+                }
+                if (node_ids.size() < request.threshold()) 
+                {
+                    *error = "Key " + request.key_id() + " unavailable: " +
+                             std::to_string(node_ids.size()) + " connected nodes (threshold " + std::to_string(request.threshold()) + ")";
+                    return false;
+                }
+
+                // HttpsSession이 header.timeout_ms를 도착 시점 기준 남은 budget으로 맞춰 둠
+                session::MpcSessionResult result = SignEcdsa(
+                    request.key_id(), request.transaction_data(), node_ids, request.threshold(), nullptr,
+                    utils::DeadlineAfter(request.header().timeout_ms()));
+                if (result.status != session::MpcSessionStatus::COMPLETED) 
+                {
+                    *error = result.error_message;
+                    return false;
+                }
+                response->set_final_signature(result.output);
+                response->set_successful_shards(static_cast<uint32_t>(result.participants.size()));
+                return true;
+            });
+    }
+
+    void CoordinatorServer::InstallWalletKeyBackend() 
+    {
+        using namespace mpc_engine::proto::wallet_coordinator;
+
+        handlers::wallet::SetWalletKeyBackend(
+            [this](const WalletKeyCreateRequest& request, WalletKeyCreateResponse* response, std::string* error) {
+                WalletKeyResult result = CreateWalletKey(request.tenant_id(), request.wallet_id(), request.threshold(),
+                                                         utils::DeadlineAfter(request.header().timeout_ms()));
+                if (!result.success) 
+                {
+                    *error = result.error_message;
+                    return false;
+                }
+                response->set_key_id(result.key.key_id);
+                response->set_public_key(result.key.public_key);
+                response->set_threshold(result.key.threshold);
+                for (const std::string& node_id : result.key.node_ids) 
+                {
+                    response->add_node_ids(node_id);
+                }
+                response->set_pregenerated(result.pregenerated);
+                return true;
+            });
+    }
+
+    // ========================================
+    // Engine set 라우팅
+    // ========================================
+
+    bool CoordinatorServer::AddEngineSet(const std::string& set_id, const std::vector<std::string>& node_ids) 
+    {
+        return engine_sets.AddSet(set_id, node_ids);
+    }
+
+    bool CoordinatorServer::RemoveEngineSet(const std::string& set_id) 
+    {
+        return engine_sets.RemoveSet(set_id);
+    }
+
+    std::string CoordinatorServer::RouteKey(const std::string& key_id) const 
+    {
+        return engine_sets.Route(key_id);
+    }
+
+    std::vector<std::string> CoordinatorServer::GetKeyNodeIds(const std::string& key_id) const 
+    {
+        std::string set_id = engine_sets.Route(key_id);
+        return set_id.empty() ? GetAllNodeIds() : engine_sets.GetSetNodes(set_id);
+    }
+
+    std::vector<std::string> CoordinatorServer::GetSigningNodeIds(const std::string& key_id) const 
+    {
+        std::optional<session::KeyPlacement> placement = key_placements.Find(key_id);
+        if (placement) 
+        {
+            return placement->node_ids;
+        }
+        // set이 하나 이하면 배치가 하나뿐, 여러 set이면 ring은 생성 당시 배치와 다를 수 있으므로 추측하지 않음
+        return engine_sets.GetSetCount() <= 1 ? GetKeyNodeIds(key_id) : std::vector<std::string>();
+    }
+
+    std::vector<network::EngineSetStats> CoordinatorServer::GetEngineSetStats() const 
+    {
+        std::vector<network::EngineSetStats> result = engine_sets.GetStats();
+        std::shared_ptr<session::PregeneratedKeyPool> pool = GetKeyPool();
+        uint32_t threshold = pool ? pool->GetConfig().threshold
+            : (Config::HasKey("MPC_THRESHOLD") ? Config::GetUInt32("MPC_THRESHOLD") : 2);
+        for (network::EngineSetStats& stats : result) 
+        {
+            for (const std::string& node_id : stats.node_ids) 
+            {
+                if (IsNodeConnected(node_id)) 
+                {
+                    stats.connected_nodes++;
+                }
+            }
+            stats.healthy = stats.connected_nodes >= threshold;
+        }
+        return result;
     }
 
     // ========================================
@@ -309,10 +1368,11 @@ namespace mpc_engine::coordinator
 
     std::vector<std::string> CoordinatorServer::GetConnectedNodeIds() const 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
+        std::shared_ptr<const NodeClientMap> snapshot = node_clients.Read();
+        const NodeClientMap& clients = *snapshot;
         std::vector<std::string> result;
 
-        for (const auto& entry : node_clients) 
+        for (const auto& entry : clients) 
         {
             if (entry.second && entry.second->IsConnected()) 
             {
@@ -330,10 +1390,11 @@ namespace mpc_engine::coordinator
 
     std::vector<std::string> CoordinatorServer::GetAllNodeIds() const 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
+        std::shared_ptr<const NodeClientMap> snapshot = node_clients.Read();
+        const NodeClientMap& clients = *snapshot;
         std::vector<std::string> result;
 
-        for (const auto& entry : node_clients)
+        for (const auto& entry : clients)
         {
             result.push_back(entry.first);
         }
@@ -343,7 +1404,7 @@ namespace mpc_engine::coordinator
 
     ConnectionStatus CoordinatorServer::GetNodeStatus(const std::string& node_id) const 
     {
-        network::NodeTcpClient* client = FindNodeClientInternal(node_id);
+        std::shared_ptr<network::NodeTcpClient> client = FindNodeClientInternal(node_id);
         return client ? client->GetStatus() : ConnectionStatus::DISCONNECTED;
     }
 
@@ -354,45 +1415,58 @@ namespace mpc_engine::coordinator
 
     size_t CoordinatorServer::GetTotalNodeCount() const 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
-        return node_clients.size();
+        return node_clients.Read()->size();
     }
 
     std::string CoordinatorServer::GetNodeAddress(const std::string& node_id) const 
     {
-        network::NodeTcpClient* client = FindNodeClientInternal(node_id);
+        std::shared_ptr<network::NodeTcpClient> client = FindNodeClientInternal(node_id);
         return client ? client->GetAddress() : "";
     }
 
     PlatformType CoordinatorServer::GetNodePlatform(const std::string& node_id) const 
     {
-        network::NodeTcpClient* client = FindNodeClientInternal(node_id);
+        std::shared_ptr<network::NodeTcpClient> client = FindNodeClientInternal(node_id);
         return client ? client->GetPlatform() : PlatformType::UNKNOWN;
     }
 
     uint32_t CoordinatorServer::GetNodeShardIndex(const std::string& node_id) const 
     {
-        network::NodeTcpClient* client = FindNodeClientInternal(node_id);
+        std::shared_ptr<network::NodeTcpClient> client = FindNodeClientInternal(node_id);
         return client ? client->GetShardIndex() : 0;
     }
 
     std::string CoordinatorServer::GetNodeEndpoint(const std::string& node_id) const 
     {
-        network::NodeTcpClient* client = FindNodeClientInternal(node_id);
+        std::shared_ptr<network::NodeTcpClient> client = FindNodeClientInternal(node_id);
         return client ? client->GetEndpoint() : "";
     }
 
     CoordinatorStats CoordinatorServer::GetStats() const 
     {
         CoordinatorStats stats;
+
+        session::PresignaturePoolStats presign = GetPresignatureStats();
+        stats.presignature_depth = presign.depth;
+        stats.presignature_hit_rate = presign.HitRate();
+
+        session::PregeneratedKeyPoolStats keys = GetKeyPoolStats();
+        stats.key_pool_depth = keys.depth;
+        stats.key_pool_hit_rate = keys.HitRate();
+
+        handlers::wallet::WalletRequestDedupStats dedup = handlers::wallet::GetWalletRequestDedupStats();
+        stats.wallet_dedup_hit_rate = dedup.HitRate();
+        stats.wallet_dedup_entries = dedup.entries;
+        stats.wallet_dedup_memory_bytes = dedup.memory_bytes;
         
-        std::lock_guard<std::mutex> lock(nodes_mutex);
+        std::shared_ptr<const NodeClientMap> clients = node_clients.Load();
         
-        stats.total_nodes = static_cast<uint32_t>(node_clients.size());
+        stats.total_nodes = static_cast<uint32_t>(clients->size());
         stats.uptime_seconds = (utils::GetCurrentTimeMs() - start_time) / 1000;
         stats.last_update_time = utils::GetCurrentTimeMs();
+        stats.thread_count = utils::GetProcessThreadCount();
         
-        for (const auto& entry : node_clients)
+        for (const auto& entry : *clients)
         {
             if (entry.second && entry.second->IsConnected()) 
             {
@@ -406,10 +1480,11 @@ namespace mpc_engine::coordinator
 
     std::vector<std::string> CoordinatorServer::GetNodesByPlatform(PlatformType platform) const 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
+        std::shared_ptr<const NodeClientMap> snapshot = node_clients.Read();
+        const NodeClientMap& clients = *snapshot;
         std::vector<std::string> result;
 
-        for (const auto& entry : node_clients)
+        for (const auto& entry : clients)
         {
             if (entry.second && entry.second->GetPlatform() == platform) 
             {
@@ -422,10 +1497,11 @@ namespace mpc_engine::coordinator
 
     std::vector<std::string> CoordinatorServer::GetNodesByStatus(ConnectionStatus status) const 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
+        std::shared_ptr<const NodeClientMap> snapshot = node_clients.Read();
+        const NodeClientMap& clients = *snapshot;
         std::vector<std::string> result;
 
-        for (const auto& entry : node_clients)
+        for (const auto& entry : clients)
         {
             if (entry.second && entry.second->GetStatus() == status) 
             {
@@ -438,10 +1514,11 @@ namespace mpc_engine::coordinator
 
     std::vector<std::string> CoordinatorServer::GetNodesByShardIndex(uint32_t shard_index) const 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
+        std::shared_ptr<const NodeClientMap> snapshot = node_clients.Read();
+        const NodeClientMap& clients = *snapshot;
         std::vector<std::string> result;
 
-        for (const auto& entry : node_clients)
+        for (const auto& entry : clients)
         {
             if (entry.second && entry.second->GetShardIndex() == shard_index) 
             {
@@ -475,6 +1552,9 @@ namespace mpc_engine::coordinator
             // TLS 설정 (TLS_CERT_PATH 기준 상대 경로)
             config.tls_cert_path = env.GetString("TLS_CERT_COORDINATOR_WALLET");
             config.tls_key_id = env.GetString("TLS_KMS_COORDINATOR_WALLET_KEY_ID");
+            if (!LoadWalletAdmissionConfig(&config.admission)) {
+                return false;
+            }
 
             if (config.tls_cert_path.empty() || config.tls_key_id.empty()) {
                 LOG_ERROR("CoordinatorServer", "Missing TLS configuration");
@@ -504,6 +1584,60 @@ namespace mpc_engine::coordinator
         }
     }
 
+    bool CoordinatorServer::LoadWalletAdmissionConfig(network::wallet_server::WalletAdmissionConfig* config) 
+    {
+        network::wallet_server::WalletAdmissionConfig loaded;
+        if (Config::HasKey("COORDINATOR_TENANT_RATE_PER_SEC")) 
+        {
+            loaded.default_limit.requests_per_second = Config::GetUInt32("COORDINATOR_TENANT_RATE_PER_SEC");
+        }
+        if (Config::HasKey("COORDINATOR_TENANT_BURST")) 
+        {
+            loaded.default_limit.burst = Config::GetUInt32("COORDINATOR_TENANT_BURST");
+        }
+        if (Config::HasKey("COORDINATOR_TENANT_MAX_CONCURRENT")) 
+        {
+            loaded.default_limit.max_concurrent = Config::GetUInt32("COORDINATOR_TENANT_MAX_CONCURRENT");
+        }
+        if (Config::HasKey("COORDINATOR_ADMISSION_MAX_QUEUED")) 
+        {
+            loaded.max_queued = Config::GetUInt32("COORDINATOR_ADMISSION_MAX_QUEUED");
+        }
+        if (Config::HasKey("COORDINATOR_TENANT_LIMITS_FILE")) 
+        {
+            std::string error;
+            if (!network::wallet_server::LoadWalletAdmissionLimits(Config::GetString("COORDINATOR_TENANT_LIMITS_FILE"), &loaded, &error)) 
+            {
+                LOG_ERRORF("CoordinatorServer", "Failed to load tenant limits: %s", error.c_str());
+                return false;
+            }
+        }
+
+        *config = std::move(loaded);
+        return true;
+    }
+
+    bool CoordinatorServer::ReloadWalletAdmission() 
+    {
+        network::wallet_server::WalletAdmissionConfig config;
+        if (!LoadWalletAdmissionConfig(&config)) 
+        {
+            LOG_WARN("CoordinatorServer", "Keeping previous tenant limits");
+            return false;
+        }
+        if (https_server) 
+        {
+            https_server->SetAdmissionConfig(config);
+        }
+        LOG_INFOF("CoordinatorServer", "Tenant limits reloaded (%zu tenant overrides)", config.tenants.size());
+        return true;
+    }
+
+    std::vector<network::wallet_server::TenantAdmissionStats> CoordinatorServer::GetWalletAdmissionStats() const 
+    {
+        return https_server ? https_server->GetAdmissionStats() : std::vector<network::wallet_server::TenantAdmissionStats>();
+    }
+
     bool CoordinatorServer::StartHttpsServer() 
     {
         if (!https_server) {
@@ -540,12 +1674,13 @@ namespace mpc_engine::coordinator
     // Private 메서드
     // ========================================
 
-    network::NodeTcpClient* CoordinatorServer::FindNodeClientInternal(const std::string& node_id) const 
+    std::shared_ptr<network::NodeTcpClient> CoordinatorServer::FindNodeClientInternal(const std::string& node_id) const 
     {
-        std::lock_guard<std::mutex> lock(nodes_mutex);
-        
-        auto it = node_clients.find(node_id);
-        return (it != node_clients.end()) ? it->second.get() : nullptr;
+        // 요청마다 호출되는 hot path - 스냅샷을 lock 없이 조회
+        std::shared_ptr<const NodeClientMap> snapshot = node_clients.Read();
+        const NodeClientMap& clients = *snapshot;
+        auto it = clients.find(node_id);
+        return (it != clients.end()) ? it->second : nullptr;
     }
 
     void CoordinatorServer::OnNodeStatusChanged(const std::string& node_id, ConnectionStatus status) 
@@ -1,8 +1,18 @@
 // src/coordinator/CoordinatorServer.hpp
 #pragma once
 #include "coordinator/network/node_client/include/NodeTcpClient.hpp"
+#include "coordinator/network/node_client/include/NodeSelector.hpp"
+#include "coordinator/network/node_client/include/EngineSetRouter.hpp"
 #include "coordinator/network/wallet_server/include/CoordinatorHttpsServer.hpp"
+#include "coordinator/session/include/MpcSessionEngine.hpp"
+#include "coordinator/session/include/MpcKeygenBatch.hpp"
+#include "coordinator/session/include/PresignaturePool.hpp"
+#include "coordinator/session/include/PregeneratedKeyPool.hpp"
+#include "coordinator/session/include/KeyPlacementStore.hpp"
 #include "proto/coordinator_node/generated/message.pb.h"
+#include "common/utils/threading/RcuSnapshot.hpp"
+#include "common/utils/time/Deadline.hpp"
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -23,20 +33,82 @@ namespace mpc_engine::coordinator
         uint32_t error_nodes = 0;
         uint64_t uptime_seconds = 0;
         uint64_t last_update_time = 0;
+        uint32_t thread_count = 0;      // 프로세스 전체 스레드 수 (부하와 무관하게 일정해야 함)
+        size_t presignature_depth = 0;          // 전체 key의 준비된 presignature 수
+        double presignature_hit_rate = 0.0;     // 서명 요청 중 presignature를 바로 쓴 비율
+        size_t key_pool_depth = 0;              // 배정 대기 중인 미리 생성된 키 수
+        double key_pool_hit_rate = 0.0;         // 지갑 키 생성 요청 중 pool 키를 바로 배정한 비율
+        double wallet_dedup_hit_rate = 0.0;     // Wallet 서명 요청 중 재실행 없이 응답한 중복 요청 비율
+        size_t wallet_dedup_entries = 0;        // 중복 제거 table 항목 수 (실행 중 + 보관 중)
+        size_t wallet_dedup_memory_bytes = 0;
+    };
+
+    /**
+     * @brief Quorum fan-out 결과
+     * - participants/responses: 성공 응답 순서 (빠른 노드 순), 정족수 달성 시점까지 도착한 것만
+     * - failed: 에러 응답 / 연결 실패 노드
+     * - stragglers: 결과 확정 시점까지 응답하지 않아 취소된 노드
+     */
+    struct QuorumResult
+    {
+        bool reached = false;
+        size_t threshold = 0;
+        std::vector<std::string> participants;
+        std::vector<std::unique_ptr<CoordinatorNodeMessage>> responses;
+        std::vector<std::string> failed;
+        std::vector<std::string> stragglers;
+        uint64_t elapsed_ms = 0;
+    };
+
+    // Drain 결과 (SIGTERM 종료 보고)
+    struct CoordinatorDrainReport
+    {
+        session::MpcDrainReport sessions;
+        size_t unanswered_requests = 0;     // 종료 시점까지 응답을 쓰지 못한 Wallet 요청
+        uint64_t elapsed_ms = 0;
+    };
+
+    // 지갑 키 생성 결과
+    struct WalletKeyResult
+    {
+        bool success = false;
+        bool pregenerated = false;              // pool에서 배정 (false = 요청 시 keygen)
+        session::PregeneratedKey key;
+        std::string error_message;
     };
 
     class CoordinatorServer 
     {
     private:
-        // Node 클라이언트 관리
-        std::unordered_map<std::string, std::unique_ptr<network::NodeTcpClient>> node_clients;
-        mutable std::mutex nodes_mutex;
+        // Node 클라이언트 관리 - 요청 경로는 불변 스냅샷을 lock 없이 읽고, 등록/해제만 새 버전 게시
+        using NodeClientMap = std::unordered_map<std::string, std::shared_ptr<network::NodeTcpClient>>;
+        utils::RcuSnapshot<NodeClientMap> node_clients;
 
         // HTTPS 서버 (Wallet Server 통신용)
         std::unique_ptr<network::wallet_server::CoordinatorHttpsServer> https_server;
 
+        // 다중 라운드 MPC 세션 (Start에서 생성, Stop에서 진행 중 세션 abort)
+        std::shared_ptr<session::MpcSessionEngine> session_engine;
+        std::shared_ptr<session::PresignaturePool> presignature_pool;     // 꺼져 있으면 nullptr
+        std::shared_ptr<session::MpcKeygenBatch> keygen_batch;
+        std::shared_ptr<session::PregeneratedKeyPool> key_pool;             // 꺼져 있으면 nullptr
+        std::atomic<uint64_t> next_wallet_key_number{1};
+        mutable std::mutex session_engine_mutex;
+
+        // 지갑 키 → keygen 참여 노드 (CreateWalletKey에서 기록, COORDINATOR_KEY_PLACEMENT_FILE이면 재시작 후에도 유지)
+        // share가 있는 노드는 keygen 시점에 정해지므로 서명은 engine set 라우팅이 아니라 이 기록을 따름
+        session::KeyPlacementStore key_placements;
+
+        // threshold 연산 참여 노드 선택 정책 (운영 중 교체 가능)
+        std::shared_ptr<const network::NodeSelector> node_selector;
+        mutable std::mutex node_selector_mutex;
+
+        // engine set 구성 + key_id → set consistent-hash 라우팅
+        network::EngineSetRouter engine_sets;
+
         std::atomic<bool> is_running{false};
         std::atomic<bool> is_initialized{false};
+        std::atomic<bool> is_draining{false};
 
         uint64_t start_time = 0;
 
@@ -55,6 +127,14 @@ namespace mpc_engine::coordinator
         void Stop();
         bool IsRunning() const;
 
+        /**
+        * @brief 종료 전 drain - HTTPS 새 연결/요청 거부 (health check 503), 새 MPC 세션 거부,
+        *        진행 중 세션은 timeout까지 대기 후 남은 세션을 노드에 abort
+        * 노드 연결은 유지 - 이후 Stop 호출
+        */
+        CoordinatorDrainReport Drain(std::chrono::milliseconds timeout);
+        bool IsDraining() const { return is_draining.load(); }
+
         // Node 관리
         bool RegisterNode(const std::string& node_id,
             PlatformType platform,
@@ -71,17 +151,131 @@ namespace mpc_engine::coordinator
         bool IsNodeConnected(const std::string& node_id) const;
         void DisconnectAllNodes();
 
-        // Node 통신
+        // Node 통신 - deadline은 노드까지 남은 budget으로 전달 (지나면 큐에서 보내지 않고 DEADLINE_EXCEEDED)
         std::unique_ptr<CoordinatorNodeMessage> SendToNode(
             const std::string& node_id, 
-            const CoordinatorNodeMessage* request);
+            const CoordinatorNodeMessage* request,
+            utils::Deadline deadline = utils::NO_DEADLINE);
+
+        /**
+        * @brief 후보 노드를 순서대로 시도 - 재시도 가능한 에러(BUSY/SHUTTING_DOWN 등)나
+        *        연결 실패 시 타임아웃을 기다리지 않고 즉시 다음 노드로 넘어감
+        * @param served_by 응답한 노드 ID (optional)
+        * @param deadline 지나면 다음 노드를 시도하지 않음
+        * @return 마지막으로 받은 응답 (모두 실패 시 마지막 에러 응답 또는 nullptr)
+        */
+        std::unique_ptr<CoordinatorNodeMessage> SendToAnyNode(
+            const std::vector<std::string>& node_ids,
+            const CoordinatorNodeMessage* request,
+            std::string* served_by = nullptr,
+            utils::Deadline deadline = utils::NO_DEADLINE);
         
+        /**
+        * @brief t-of-n fan-out - 성공 응답이 threshold개 도착하는 즉시 반환
+        *
+        * 남은 요청은 취소(응답을 기다리지 않음)되므로 지연은 가장 느린 노드가 아닌 t번째로 빠른 노드 기준.
+        * 실패가 누적되어 정족수가 불가능해지면 timeout을 기다리지 않고 즉시 실패.
+        */
+        QuorumResult BroadcastToQuorum(
+            const std::vector<std::string>& node_ids,
+            const CoordinatorNodeMessage* request,
+            size_t threshold,
+            std::chrono::milliseconds timeout = std::chrono::seconds(35));
+
+        // 모든 노드 성공 필요 (n-of-n quorum)
         bool BroadcastToNodes(
             const std::vector<std::string>& node_ids, 
             const CoordinatorNodeMessage* request);
         
         bool BroadcastToAllConnectedNodes(const CoordinatorNodeMessage* request);
 
+        // MPC 세션 (keygen/서명 라운드 구동) - 서버가 실행 중이 아니면 ABORTED로 즉시 완료
+        std::string StartMpcSession(session::MpcSessionSpec spec, session::MpcSessionCallback callback);
+        session::MpcSessionResult RunMpcSession(session::MpcSessionSpec spec);
+        bool AbortMpcSession(const std::string& session_id, const std::string& reason);
+        session::MpcSessionEngineStats GetMpcSessionStats() const;
+        /**
+        * @brief 여러 키 keygen을 라운드 단위로 함께 진행 - 라운드마다 노드당 배치 메시지 1개 (max_keys_per_message 이하)
+        * 서버가 실행 중이 아니면 모든 키 ABORTED
+        */
+        session::MpcKeygenBatchResult RunKeygenBatch(session::MpcKeygenBatchSpec spec);
+        // 노드별 라운드 배칭 window 변경 (0 = 끔)
+        void SetMpcRoundBatching(const session::MpcRoundBatchConfig& config);
+        // 느린 참여자 hedge 설정 (max_ratio 0 = 끔)
+        void SetMpcHedging(const session::MpcHedgeConfig& config);
+        // 라운드 메시지를 노드 간 mesh로 직접 교환 (NODE_MESH_HOSTS가 있는 참여자끼리만)
+        void SetMpcPeerMesh(bool enabled);
+        // 라운드 출력을 envelope 그대로 중계 (payload 파싱/재직렬화 없음)
+        void SetMpcOpaqueRelay(bool enabled);
+
+        /**
+        * @brief ECDSA presignature pool 교체 (target_depth 0 = 끔)
+        * 이전 pool의 등록 key와 남은 presignature는 폐기 (노드 쪽은 TTL로 정리)
+        */
+        void SetPresignaturePool(const session::PresignaturePoolConfig& config);
+        // key를 pool에 등록해 미리 채움 (SignEcdsa는 등록하지 않음, max_keys 도달 시 false)
+        bool AddPresignatureKey(const std::string& key_id, const std::vector<std::string>& node_ids, uint32_t threshold);
+        void RemovePresignatureKey(const std::string& key_id);
+        session::PresignaturePoolStats GetPresignatureStats() const;
+        std::vector<session::PresignatureKeyStats> GetPresignatureKeyStats() const;
+
+        /**
+        * @brief 미리 생성된 키 pool 교체 (target_depth 0 = 끔)
+        * 이전 pool의 미배정 키와 배정 기록은 폐기
+        */
+        void SetKeyPool(const session::PregeneratedKeyPoolConfig& config);
+        session::PregeneratedKeyPoolStats GetKeyPoolStats() const;
+
+        /**
+        * @brief 지갑 키 생성 - pool에 준비된 키가 있으면 배정만, 없으면 요청 시 keygen
+        * 같은 (tenant, wallet) 재요청은 처음 배정된 키 반환
+        * @param threshold 0 = pool 기본값
+        * @param deadline 요청 시 keygen의 처리 기한 (pool 배정은 노드 통신이 없어 무관)
+        */
+        WalletKeyResult CreateWalletKey(const std::string& tenant_id, const std::string& wallet_id, uint32_t threshold = 0,
+                                        utils::Deadline deadline = utils::NO_DEADLINE);
+
+        /**
+        * @brief ECDSA 서명 - presignature가 있으면 온라인 1 라운드, 없으면(또는 온라인 서명 실패 시) 전체 서명 세션
+        * @param used_presignature 온라인 서명으로 완료했는지 (optional)
+        * @param deadline 온라인 서명 실패 후 전체 서명으로 넘어가도 같은 기한 안에서 (지나면 TIMED_OUT)
+        */
+        session::MpcSessionResult SignEcdsa(
+            const std::string& key_id,
+            const std::string& message_hash,
+            const std::vector<std::string>& node_ids,
+            uint32_t threshold,
+            bool* used_presignature = nullptr,
+            utils::Deadline deadline = utils::NO_DEADLINE);
+
+        /**
+        * @brief 참여 노드 선택 정책 변경 - 이후 시작하는 세션부터 적용
+        * 서명 세션은 후보가 threshold보다 많을 때 정책 순으로 참여자를 고름 (keygen은 항상 전체)
+        */
+        void SetNodeSelection(const network::NodeSelectionConfig& config);
+        network::NodeSelectionConfig GetNodeSelection() const;
+
+        // 연결된 후보 중 정책 순으로 최대 count개
+        std::vector<std::string> SelectNodes(const std::vector<std::string>& candidates, size_t count) const;
+
+        /**
+        * @brief engine set 노드 구성 (없으면 생성) - 등록 시 NODE_ENGINE_SETS로 정한 소속을 재구성
+        * set이 추가/제거되면 일부 key의 배치가 바뀜 (기존 key share 이전은 reshare 필요)
+        * @return 다른 set에 속한 노드가 있으면 false
+        */
+        bool AddEngineSet(const std::string& set_id, const std::vector<std::string>& node_ids);
+        bool RemoveEngineSet(const std::string& set_id);
+        // key_id가 배치된 engine set (set이 없으면 빈 문자열)
+        std::string RouteKey(const std::string& key_id) const;
+        // 새 key_id를 만들 engine set 노드 (set이 하나도 없으면 등록된 전체 노드)
+        std::vector<std::string> GetKeyNodeIds(const std::string& key_id) const;
+        /**
+        * @brief key_id 서명 후보 노드 - 기록된 배치(keygen 참여 노드)만 사용
+        * 배치 기록이 없는 키는 engine set이 하나 이하일 때만 GetKeyNodeIds, 여러 set이면 빈 목록 (ring으로 추측하지 않음)
+        */
+        std::vector<std::string> GetSigningNodeIds(const std::string& key_id) const;
+        std::vector<network::EngineSetStats> GetEngineSetStats() const;
+
         // Node 상태 조회
         std::vector<std::string> GetConnectedNodeIds() const;
         std::vector<std::string> GetReadyNodeIds() const;
@@ -107,9 +301,27 @@ namespace mpc_engine::coordinator
         void StopHttpsServer();
         bool IsHttpsServerRunning() const;
 
+        /**
+        * @brief Wallet 요청 tenant 한도 다시 읽기 (env 기본값 + COORDINATOR_TENANT_LIMITS_FILE) - SIGHUP
+        * @return 한도 파일 오류면 false (기존 한도 유지)
+        */
+        bool ReloadWalletAdmission();
+        std::vector<network::wallet_server::TenantAdmissionStats> GetWalletAdmissionStats() const;
+
     private:
-        network::NodeTcpClient* FindNodeClientInternal(const std::string& node_id) const;
+        std::shared_ptr<network::NodeTcpClient> FindNodeClientInternal(const std::string& node_id) const;
         void OnNodeStatusChanged(const std::string& node_id, ConnectionStatus status);
+        std::shared_ptr<session::MpcSessionEngine> GetSessionEngine() const;
+        std::shared_ptr<session::PresignaturePool> GetPresignaturePool() const;
+        std::shared_ptr<session::PregeneratedKeyPool> GetKeyPool() const;
+        bool RecordKeyPlacement(const session::PregeneratedKey& key);
+        // 노드들이 속한 engine set (부하 집계 대상, 어느 set에도 없으면 빈 문자열)
+        std::string GetOwningEngineSet(const std::vector<std::string>& node_ids) const;
+        void EnrollPresignatureKey(const session::PregeneratedKey& key);
+        std::vector<std::string> OrderNodeCandidates(const std::vector<std::string>& node_ids) const;
+        void InstallWalletSigningBackend();
+        void InstallWalletKeyBackend();
+        static bool LoadWalletAdmissionConfig(network::wallet_server::WalletAdmissionConfig* config);
     };
 
 } // namespace mpc_engine::coordinator
\ No newline at end of file
@@ -0,0 +1,25 @@
+// src/coordinator/handlers/wallet/include/WalletKeyHandler.hpp
+#pragma once
+#include "proto/wallet_coordinator/generated/wallet_message.pb.h"
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace mpc_engine::coordinator::handlers::wallet
+{
+    using namespace mpc_engine::proto::wallet_coordinator;
+
+    /**
+    * @brief 지갑 키 생성 경로 (CoordinatorServer가 Start에서 설치, Stop에서 해제)
+    * response의 key_id / public_key / node_ids / threshold / pregenerated를 채움
+    * @param error 실패 사유
+    * @return 키 배정 성공 여부
+    */
+    using WalletKeyBackend = std::function<bool(const WalletKeyCreateRequest& request, WalletKeyCreateResponse* response, std::string* error)>;
+
+    // nullptr = 해제 (키 생성 요청 실패 응답)
+    void SetWalletKeyBackend(WalletKeyBackend backend);
+
+    std::unique_ptr<WalletCoordinatorMessage> HandleWalletKeyCreateRequest(const WalletCoordinatorMessage* request);
+
+} // namespace mpc_engine::coordinator::handlers::wallet
@@ -5,6 +5,7 @@
 #include <array>
 #include <functional>
 #include <memory>
+#include <string>
 
 namespace mpc_engine::coordinator::handlers::wallet
 {
@@ -13,7 +14,8 @@ namespace mpc_engine::coordinator::handlers::wallet
     class WalletMessageRouter 
     {
     public:
-        using HandlerFunction = std::function<std::unique_ptr<WalletCoordinatorMessage>(const WalletCoordinatorMessage*)>;
+        // tenant_id: 세션에서 인증된 tenant (요청 body 값이 아님)
+        using HandlerFunction = std::function<std::unique_ptr<WalletCoordinatorMessage>(const WalletCoordinatorMessage*, const std::string& tenant_id)>;
 
         static WalletMessageRouter& Instance() 
         {
@@ -22,7 +24,8 @@ namespace mpc_engine::coordinator::handlers::wallet
         }
 
         bool Initialize();
-        std::unique_ptr<WalletCoordinatorMessage> ProcessMessage(const WalletCoordinatorMessage* request);
+        std::unique_ptr<WalletCoordinatorMessage> ProcessMessage(const WalletCoordinatorMessage* request,
+                                                                 const std::string& tenant_id = "default");
 
     private:
         WalletMessageRouter() = default;
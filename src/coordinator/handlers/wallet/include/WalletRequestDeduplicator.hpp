@@ -0,0 +1,143 @@
+// src/coordinator/handlers/wallet/include/WalletRequestDeduplicator.hpp
+#pragma once
+#include "proto/wallet_coordinator/generated/wallet_message.pb.h"
+#include "common/utils/time/Deadline.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace mpc_engine::coordinator::handlers::wallet
+{
+    using namespace mpc_engine::proto::wallet_coordinator;
+
+    struct WalletRequestDedupConfig
+    {
+        size_t max_entries = 10000;                         // 완료 결과 보관 상한 (초과 시 오래된 것부터 제거, 0 = dedup 끔)
+        std::chrono::milliseconds ttl{10 * 60 * 1000};      // 완료 결과 보관 시간 (Wallet 재시도 기간보다 길게)
+
+        bool Enabled() const { return max_entries > 0 && ttl.count() > 0; }
+    };
+
+    enum class WalletDedupOutcome
+    {
+        EXECUTED = 0,       // 처음 들어온 요청 - 직접 실행
+        JOINED = 1,         // 같은 request_id가 실행 중 - 그 결과를 기다려 공유 (singleflight)
+        CACHED = 2,         // TTL 안의 완료 결과 반환
+        CONFLICT = 3,       // 같은 request_id에 다른 payload - 실행하지 않음
+        BYPASSED = 4,       // request_id 없음 / dedup 꺼짐
+        DEADLINE_EXCEEDED = 5   // 실행 중인 결과를 기다리다 호출자 기한 초과
+    };
+
+    const char* WalletDedupOutcomeToString(WalletDedupOutcome outcome);
+
+    struct WalletRequestDedupStats
+    {
+        size_t entries = 0;             // 실행 중 + 보관 중
+        size_t in_flight = 0;
+        size_t memory_bytes = 0;        // 보관 응답 + key 추정치
+        uint64_t executed = 0;
+        uint64_t joined = 0;
+        uint64_t cached = 0;
+        uint64_t conflicts = 0;
+        uint64_t deadline_exceeded = 0; // 대기 중 기한 초과
+        uint64_t evicted = 0;           // 용량 초과로 제거
+        uint64_t expired = 0;           // TTL 만료로 제거
+
+        // 실행 없이 응답한 중복 요청 비율
+        double HitRate() const
+        {
+            uint64_t total = executed + joined + cached;
+            return total > 0 ? static_cast<double>(joined + cached) / static_cast<double>(total) : 0.0;
+        }
+    };
+
+    /**
+     * @brief Wallet 요청 멱등 처리 ((tenant, request_id) 기준, 메모리 내 bounded table)
+     *
+     * - request_id는 클라이언트가 정하므로 인증된 tenant 범위 안에서만 중복으로 봄 (다른 tenant와 결과 공유 없음)
+     * - 실행 중인 request_id로 다시 들어온 요청은 새로 실행하지 않고 같은 결과를 기다림 (singleflight)
+     * - 성공 응답은 TTL 동안 보관해 늦은 재시도에 그대로 반환, 실패 응답은 대기 중이던 중복 요청에만
+     *   전달하고 보관하지 않음 (재시도가 다시 실행되도록)
+     * - 보관 수는 max_entries로 제한 (완료 순으로 오래된 것부터 제거), 실행 중 항목은 제거하지 않음
+     */
+    class WalletRequestDeduplicator
+    {
+    public:
+        using Work = std::function<std::unique_ptr<WalletCoordinatorMessage>()>;
+
+        explicit WalletRequestDeduplicator(WalletRequestDedupConfig config = WalletRequestDedupConfig());
+
+        WalletRequestDeduplicator(const WalletRequestDeduplicator&) = delete;
+        WalletRequestDeduplicator& operator=(const WalletRequestDeduplicator&) = delete;
+
+        /**
+        * @brief tenant의 request_id당 한 번만 work 실행
+        * @param tenant_id 인증된 tenant (dedup 범위)
+        * @param fingerprint payload digest (SHA-256 등 충돌 저항) - 같은 request_id에 다른 payload면 CONFLICT
+        * @param deadline 실행 중인 결과를 기다리는 기한 - 지나면 DEADLINE_EXCEEDED
+        * @return 응답 (호출자 소유 복사본, CONFLICT / DEADLINE_EXCEEDED면 nullptr)
+        */
+        std::unique_ptr<WalletCoordinatorMessage> Execute(
+            const std::string& tenant_id,
+            const std::string& request_id,
+            const std::string& fingerprint,
+            const Work& work,
+            WalletDedupOutcome* outcome = nullptr,
+            utils::Deadline deadline = utils::NO_DEADLINE);
+
+        // 설정 변경 - 보관 중인 결과는 유지하고 새 상한을 넘는 만큼 즉시 제거
+        void Configure(const WalletRequestDedupConfig& config);
+        WalletRequestDedupConfig GetConfig() const;
+
+        WalletRequestDedupStats GetStats() const;
+
+    private:
+        // 실행 1회분 결과 (중복 요청은 이 객체를 공유해 대기)
+        struct Flight
+        {
+            bool done = false;
+            std::shared_ptr<const WalletCoordinatorMessage> response;
+        };
+
+        struct Entry
+        {
+            std::string fingerprint;
+            std::shared_ptr<Flight> flight;
+            bool completed = false;
+            std::chrono::steady_clock::time_point expires_at;
+            std::list<std::string>::iterator order;     // completed_order 안 위치 (완료 후)
+            size_t bytes = 0;
+        };
+
+        WalletRequestDedupConfig config;
+
+        mutable std::mutex mutex;
+        std::condition_variable flight_cv;
+        std::unordered_map<std::string, Entry> entries;
+        std::list<std::string> completed_order;     // 완료 순 (앞쪽이 가장 오래됨)
+        size_t in_flight = 0;
+        size_t memory_bytes = 0;
+
+        uint64_t executed = 0;
+        uint64_t joined = 0;
+        uint64_t cached = 0;
+        uint64_t conflicts = 0;
+        uint64_t deadline_exceeded = 0;
+        uint64_t evicted = 0;
+        uint64_t expired = 0;
+
+        // mutex 보유 상태에서 호출
+        void DropExpiredLocked(std::chrono::steady_clock::time_point now);
+        void EnforceCapacityLocked();
+        void EraseCompletedLocked(std::unordered_map<std::string, Entry>::iterator it);
+
+        void Finish(const std::string& key, const std::shared_ptr<Flight>& flight,
+                    std::shared_ptr<const WalletCoordinatorMessage> response);
+    };
+
+} // namespace mpc_engine::coordinator::handlers::wallet
@@ -1,11 +1,31 @@
 // src/coordinator/handlers/wallet/include/WalletSigningHandler.hpp
 #pragma once
+#include "coordinator/handlers/wallet/include/WalletRequestDeduplicator.hpp"
 #include "proto/wallet_coordinator/generated/wallet_message.pb.h"
+#include <functional>
 #include <memory>
+#include <string>
 
 namespace mpc_engine::coordinator::handlers::wallet
 {
     using namespace mpc_engine::proto::wallet_coordinator;
-    std::unique_ptr<WalletCoordinatorMessage> HandleWalletSigningRequest(const WalletCoordinatorMessage* request);
+
+    /**
+    * @brief 실제 MPC 서명 경로 (CoordinatorServer가 Start에서 설치, Stop에서 해제)
+    * response의 final_signature / successful_shards를 채움
+    * @param error 실패 사유
+    * @return 서명 성공 여부
+    */
+    using WalletSigningBackend = std::function<bool(const WalletSigningRequest& request, WalletSigningResponse* response, std::string* error)>;
+
+    // nullptr = 해제 (mock 서명 응답으로 돌아감)
+    void SetWalletSigningBackend(WalletSigningBackend backend);
+
+    // 서명 요청 중복 제거 ((tenant, header.request_id) 기준) - 기본 켜짐
+    void ConfigureWalletRequestDedup(const WalletRequestDedupConfig& config);
+    WalletRequestDedupStats GetWalletRequestDedupStats();
+
+    std::unique_ptr<WalletCoordinatorMessage> HandleWalletSigningRequest(const WalletCoordinatorMessage* request,
+                                                                         const std::string& tenant_id);
 
 } // namespace mpc_engine::coordinator::handlers::wallet
\ No newline at end of file
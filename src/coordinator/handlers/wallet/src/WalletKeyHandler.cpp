@@ -0,0 +1,73 @@
+// src/coordinator/handlers/wallet/src/WalletKeyHandler.cpp
+#include "coordinator/handlers/wallet/include/WalletKeyHandler.hpp"
+#include "common/utils/socket/SocketUtils.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include <mutex>
+
+namespace mpc_engine::coordinator::handlers::wallet
+{
+    namespace
+    {
+        std::mutex backend_mutex;
+        std::shared_ptr<WalletKeyBackend> key_backend;
+
+        std::shared_ptr<WalletKeyBackend> GetWalletKeyBackend()
+        {
+            std::lock_guard<std::mutex> lock(backend_mutex);
+            return key_backend;
+        }
+    }
+
+    void SetWalletKeyBackend(WalletKeyBackend backend)
+    {
+        std::lock_guard<std::mutex> lock(backend_mutex);
+        key_backend = backend ? std::make_shared<WalletKeyBackend>(std::move(backend)) : nullptr;
+    }
+
+    std::unique_ptr<WalletCoordinatorMessage> HandleWalletKeyCreateRequest(const WalletCoordinatorMessage* request)
+    {
+        LOG_DEBUG("WalletKeyHandler", "=== HandleWalletKeyCreateRequest ===");
+
+        if (!request || !request->has_key_create_request()) {
+            LOG_ERROR("WalletKeyHandler", "[Handler] Invalid request");
+            return nullptr;
+        }
+
+        const WalletKeyCreateRequest& key_req = request->key_create_request();
+        auto response_msg = std::make_unique<WalletCoordinatorMessage>();
+        response_msg->set_message_type(key_req.header().message_type());
+
+        auto* response = response_msg->mutable_key_create_response();
+        auto* header = response->mutable_header();
+        header->set_message_type(key_req.header().message_type());
+        header->set_success(true);
+        header->set_request_id(key_req.header().request_id());
+        header->set_timestamp(std::to_string(utils::GetCurrentTimeMs()));
+
+        // (tenant, wallet)이 배정 단위 - 같은 지갑 재요청은 backend가 처음 배정된 키를 반환
+        std::string error;
+        std::shared_ptr<WalletKeyBackend> backend = GetWalletKeyBackend();
+        if (key_req.wallet_id().empty()) {
+            error = "wallet_id is required";
+        } else if (!backend) {
+            error = "Coordinator server is not running";
+        } else {
+            try {
+                (*backend)(key_req, response, &error);
+            } catch (const std::exception& e) {
+                error = e.what();
+            }
+        }
+
+        if (!error.empty()) {
+            header->set_success(false);
+            header->set_error_message("Wallet key creation failed: " + error);
+            LOG_ERRORF("WalletKeyHandler", "Error: %s", header->error_message().c_str());
+        } else {
+            LOG_DEBUGF("WalletKeyHandler", "Wallet %s/%s → key %s%s", key_req.tenant_id().c_str(), key_req.wallet_id().c_str(),
+                       response->key_id().c_str(), response->pregenerated() ? " (pregenerated)" : "");
+        }
+        return response_msg;
+    }
+
+} // namespace mpc_engine::coordinator::handlers::wallet
@@ -1,6 +1,7 @@
 // src/coordinator/handlers/wallet/src/WalletMessageRouter.cpp
 #include "coordinator/handlers/wallet/include/WalletMessageRouter.hpp"
 #include "coordinator/handlers/wallet/include/WalletSigningHandler.hpp"
+#include "coordinator/handlers/wallet/include/WalletKeyHandler.hpp"
 #include "common/utils/logger/Logger.hpp"
 
 namespace mpc_engine::coordinator::handlers::wallet
@@ -15,6 +16,8 @@ namespace mpc_engine::coordinator::handlers::wallet
 
         // Handler 등록
         handlers_[static_cast<size_t>(mpc_engine::WalletMessageType::SIGNING_REQUEST)] = HandleWalletSigningRequest;
+        handlers_[static_cast<size_t>(mpc_engine::WalletMessageType::KEY_CREATE_REQUEST)] =
+            [](const WalletCoordinatorMessage* request, const std::string&) { return HandleWalletKeyCreateRequest(request); };
 
         // STATUS_CHECK는 나중에 추가 가능
         // handlers_[static_cast<size_t>(WalletMessageType::STATUS_CHECK)] = ...
@@ -25,7 +28,8 @@ namespace mpc_engine::coordinator::handlers::wallet
         return true;
     }
 
-    std::unique_ptr<WalletCoordinatorMessage> WalletMessageRouter::ProcessMessage(const WalletCoordinatorMessage* request) 
+    std::unique_ptr<WalletCoordinatorMessage> WalletMessageRouter::ProcessMessage(const WalletCoordinatorMessage* request,
+                                                                                  const std::string& tenant_id) 
     {
         LOG_DEBUGF("WalletMessageRouter", "Processing message type: %s", 
             WalletMessageTypeToString(static_cast<mpc_engine::WalletMessageType>(request->message_type())));
@@ -60,7 +64,7 @@ namespace mpc_engine::coordinator::handlers::wallet
 
         LOG_DEBUGF("WalletMessageRouter", "Processing message type: %s", WalletMessageTypeToString(type));
 
-        return handlers_[index](request);
+        return handlers_[index](request, tenant_id);
     }
 
 } // namespace mpc_engine::coordinator::handlers::wallet
\ No newline at end of file
@@ -0,0 +1,210 @@
+// src/coordinator/handlers/wallet/src/WalletRequestDeduplicator.cpp
+#include "coordinator/handlers/wallet/include/WalletRequestDeduplicator.hpp"
+#include "common/utils/logger/Logger.hpp"
+
+namespace mpc_engine::coordinator::handlers::wallet
+{
+    namespace
+    {
+        // unordered_map 노드 + list 노드 + key 두 벌 (map / list)
+        constexpr size_t ENTRY_OVERHEAD_BYTES = 128;
+
+        bool IsSuccessfulResponse(const WalletCoordinatorMessage* response)
+        {
+            return response && response->has_signing_response() && response->signing_response().header().success();
+        }
+    }
+
+    const char* WalletDedupOutcomeToString(WalletDedupOutcome outcome)
+    {
+        switch (outcome) {
+            case WalletDedupOutcome::EXECUTED:  return "EXECUTED";
+            case WalletDedupOutcome::JOINED:    return "JOINED";
+            case WalletDedupOutcome::CACHED:    return "CACHED";
+            case WalletDedupOutcome::CONFLICT:  return "CONFLICT";
+            case WalletDedupOutcome::BYPASSED:  return "BYPASSED";
+            case WalletDedupOutcome::DEADLINE_EXCEEDED: return "DEADLINE_EXCEEDED";
+            default:                            return "UNKNOWN";
+        }
+    }
+
+    WalletRequestDeduplicator::WalletRequestDeduplicator(WalletRequestDedupConfig config)
+        : config(config)
+    {
+    }
+
+    std::unique_ptr<WalletCoordinatorMessage> WalletRequestDeduplicator::Execute(
+        const std::string& tenant_id,
+        const std::string& request_id,
+        const std::string& fingerprint,
+        const Work& work,
+        WalletDedupOutcome* outcome,
+        utils::Deadline deadline)
+    {
+        auto set_outcome = [outcome](WalletDedupOutcome value) {
+            if (outcome) {
+                *outcome = value;
+            }
+        };
+
+        std::shared_ptr<Flight> flight;
+        std::string key;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (request_id.empty() || !config.Enabled()) {
+                lock.unlock();
+                set_outcome(WalletDedupOutcome::BYPASSED);
+                return work();
+            }
+
+            DropExpiredLocked(std::chrono::steady_clock::now());
+
+            key = tenant_id;
+            key += '\0';
+            key += request_id;
+
+            auto it = entries.find(key);
+            if (it != entries.end()) {
+                if (it->second.fingerprint != fingerprint) {
+                    conflicts++;
+                    set_outcome(WalletDedupOutcome::CONFLICT);
+                    return nullptr;
+                }
+
+                // 1. 완료 결과 / 실행 중 결과 공유
+                std::shared_ptr<Flight> existing = it->second.flight;
+                if (it->second.completed) {
+                    cached++;
+                    set_outcome(WalletDedupOutcome::CACHED);
+                } else {
+                    auto done = [&existing] { return existing->done; };
+                    if (deadline == utils::NO_DEADLINE) {
+                        flight_cv.wait(lock, done);
+                    } else if (!flight_cv.wait_until(lock, deadline, done)) {
+                        // 실행은 계속됨 - 완료되면 보관되어 이후 재시도가 CACHED로 받음
+                        deadline_exceeded++;
+                        set_outcome(WalletDedupOutcome::DEADLINE_EXCEEDED);
+                        return nullptr;
+                    }
+                    joined++;
+                    set_outcome(WalletDedupOutcome::JOINED);
+                }
+                std::shared_ptr<const WalletCoordinatorMessage> response = existing->response;
+                lock.unlock();
+                return response ? std::make_unique<WalletCoordinatorMessage>(*response) : nullptr;
+            }
+
+            // 2. 처음 들어온 request_id - 실행 중으로 등록
+            flight = std::make_shared<Flight>();
+            Entry entry;
+            entry.fingerprint = fingerprint;
+            entry.flight = flight;
+            entries.emplace(key, std::move(entry));
+            in_flight++;
+            executed++;
+        }
+        set_outcome(WalletDedupOutcome::EXECUTED);
+
+        std::unique_ptr<WalletCoordinatorMessage> response;
+        try {
+            response = work();
+        } catch (...) {
+            Finish(key, flight, nullptr);
+            throw;
+        }
+
+        // 보관/공유용 복사본 1개, 호출자는 원본
+        std::shared_ptr<const WalletCoordinatorMessage> shared =
+            response ? std::make_shared<const WalletCoordinatorMessage>(*response) : nullptr;
+        Finish(key, flight, std::move(shared));
+        return response;
+    }
+
+    void WalletRequestDeduplicator::Finish(const std::string& key, const std::shared_ptr<Flight>& flight,
+                                           std::shared_ptr<const WalletCoordinatorMessage> response)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            in_flight--;
+            flight->done = true;
+            flight->response = response;
+
+            auto it = entries.find(key);
+            if (it != entries.end() && it->second.flight == flight) {
+                if (IsSuccessfulResponse(response.get())) {
+                    Entry& entry = it->second;
+                    entry.completed = true;
+                    entry.expires_at = std::chrono::steady_clock::now() + config.ttl;
+                    entry.order = completed_order.insert(completed_order.end(), key);
+                    entry.bytes = ENTRY_OVERHEAD_BYTES + key.size() * 2 + entry.fingerprint.size() + response->SpaceUsedLong();
+                    memory_bytes += entry.bytes;
+                    EnforceCapacityLocked();
+                } else {
+                    // 실패는 보관하지 않음 - 대기 중이던 중복 요청만 같은 실패를 받음
+                    entries.erase(it);
+                }
+            }
+        }
+        flight_cv.notify_all();
+    }
+
+    void WalletRequestDeduplicator::DropExpiredLocked(std::chrono::steady_clock::time_point now)
+    {
+        while (!completed_order.empty()) {
+            auto it = entries.find(completed_order.front());
+            if (it->second.expires_at > now) {
+                break;
+            }
+            EraseCompletedLocked(it);
+            expired++;
+        }
+    }
+
+    void WalletRequestDeduplicator::EnforceCapacityLocked()
+    {
+        while (completed_order.size() > config.max_entries) {
+            EraseCompletedLocked(entries.find(completed_order.front()));
+            evicted++;
+        }
+    }
+
+    void WalletRequestDeduplicator::EraseCompletedLocked(std::unordered_map<std::string, Entry>::iterator it)
+    {
+        memory_bytes -= it->second.bytes;
+        completed_order.erase(it->second.order);
+        entries.erase(it);
+    }
+
+    void WalletRequestDeduplicator::Configure(const WalletRequestDedupConfig& new_config)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        config = new_config;
+        EnforceCapacityLocked();
+        LOG_INFOF("WalletRequestDeduplicator", "Dedup: %zu entries, ttl %lldms%s", config.max_entries,
+                  static_cast<long long>(config.ttl.count()), config.Enabled() ? "" : " (disabled)");
+    }
+
+    WalletRequestDedupConfig WalletRequestDeduplicator::GetConfig() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return config;
+    }
+
+    WalletRequestDedupStats WalletRequestDeduplicator::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        WalletRequestDedupStats stats;
+        stats.entries = entries.size();
+        stats.in_flight = in_flight;
+        stats.memory_bytes = memory_bytes;
+        stats.executed = executed;
+        stats.joined = joined;
+        stats.cached = cached;
+        stats.conflicts = conflicts;
+        stats.deadline_exceeded = deadline_exceeded;
+        stats.evicted = evicted;
+        stats.expired = expired;
+        return stats;
+    }
+
+} // namespace mpc_engine::coordinator::handlers::wallet
@@ -2,65 +2,163 @@
 #include "coordinator/handlers/wallet/include/WalletSigningHandler.hpp"
 #include "common/utils/socket/SocketUtils.hpp"
 #include "common/utils/logger/Logger.hpp"
+#include <openssl/sha.h>
+#include <mutex>
 
 namespace mpc_engine::coordinator::handlers::wallet
 {
-    std::unique_ptr<WalletCoordinatorMessage> HandleWalletSigningRequest(const WalletCoordinatorMessage* request) 
+    namespace
     {
-        LOG_DEBUG("WalletSigningHandler", "=== HandleWalletSigningRequest ===");
+        std::mutex backend_mutex;
+        std::shared_ptr<WalletSigningBackend> signing_backend;
 
-        if (!request || !request->has_signing_request()) {
-            LOG_ERROR("WalletSigningHandler", "[Handler] Invalid request");
-            return nullptr;
+        std::shared_ptr<WalletSigningBackend> GetWalletSigningBackend()
+        {
+            std::lock_guard<std::mutex> lock(backend_mutex);
+            return signing_backend;
         }
 
-        const WalletSigningRequest& signing_req = request->signing_request();
-        
-        auto response_msg = std::make_unique<WalletCoordinatorMessage>();
-        response_msg->set_message_type(signing_req.header().message_type());
-        
-        auto* response = response_msg->mutable_signing_response();
-        auto* header = response->mutable_header();
+        WalletRequestDeduplicator& Deduplicator()
+        {
+            static WalletRequestDeduplicator deduplicator;
+            return deduplicator;
+        }
 
-        try 
+        // 같은 request_id 재시도인지 확인용 (header의 timestamp 등 재전송마다 바뀌는 값 제외)
+        // SHA-256 - 충돌이 나면 다른 거래에 보관된 서명이 반환되므로 64-bit hash는 쓰지 않음
+        std::string SigningRequestFingerprint(const WalletSigningRequest& request)
         {
-            LOG_DEBUG("WalletSigningHandler", "[Handler] Processing signing request:");
-            LOG_DEBUGF("WalletSigningHandler", "  Key ID: %s", signing_req.key_id().c_str());
-            LOG_DEBUGF("WalletSigningHandler", "  Transaction: %s", signing_req.transaction_data().substr(0, 50).c_str());
-            LOG_DEBUGF("WalletSigningHandler", "  Threshold: %d/%d", signing_req.threshold(), signing_req.total_shards());
+            std::string payload = request.key_id();
+            payload += '\0';
+            payload += request.transaction_data();
+            payload += '\0';
+            payload += std::to_string(request.threshold()) + "/" + std::to_string(request.total_shards());
+            for (const std::string& shard : request.required_shards()) {
+                payload += '\0';
+                payload += shard;
+            }
+            unsigned char digest[SHA256_DIGEST_LENGTH];
+            SHA256(reinterpret_cast<const unsigned char*>(payload.data()), payload.size(), digest);
+            return std::string(reinterpret_cast<const char*>(digest), sizeof(digest));
+        }
 
-            // === Mock MPC 서명 시뮬레이션 ===
-            
-            // 1. 헤더 설정
-            header->set_message_type(signing_req.header().message_type());
-            header->set_success(true);
-            header->set_request_id(signing_req.header().request_id());
-            header->set_timestamp(std::to_string(utils::GetCurrentTimeMs()));
+        std::unique_ptr<WalletCoordinatorMessage> ProcessSigningRequest(const WalletSigningRequest& signing_req)
+        {
+            auto response_msg = std::make_unique<WalletCoordinatorMessage>();
+            response_msg->set_message_type(signing_req.header().message_type());
+        
+            auto* response = response_msg->mutable_signing_response();
+            auto* header = response->mutable_header();
+
+            try 
+            {
+                LOG_DEBUG("WalletSigningHandler", "[Handler] Processing signing request:");
+                LOG_DEBUGF("WalletSigningHandler", "  Key ID: %s", signing_req.key_id().c_str());
+                LOG_DEBUGF("WalletSigningHandler", "  Transaction: %s", signing_req.transaction_data().substr(0, 50).c_str());
+                LOG_DEBUGF("WalletSigningHandler", "  Threshold: %d/%d", signing_req.threshold(), signing_req.total_shards());
+
+                // 1. 헤더 설정
+                header->set_message_type(signing_req.header().message_type());
+                header->set_success(true);
+                header->set_request_id(signing_req.header().request_id());
+                header->set_timestamp(std::to_string(utils::GetCurrentTimeMs()));
+                response->set_key_id(signing_req.key_id());
 
-            // 2. Shard 서명 생성 (Mock)
-            response->set_key_id(signing_req.key_id());
+                // 2. 노드 MPC 서명 (CoordinatorServer 실행 중)
+                std::shared_ptr<WalletSigningBackend> backend = GetWalletSigningBackend();
+                if (backend) {
+                    std::string error;
+                    if (!(*backend)(signing_req, response, &error)) {
+                        header->set_success(false);
+                        header->set_error_message("Wallet signing failed: " + error);
+                        LOG_ERRORF("WalletSigningHandler", "Error: %s", header->error_message().c_str());
+                    }
+                    return response_msg;
+                }
+
+                // === Mock MPC 서명 시뮬레이션 (backend 미설치) ===
+
+                // 3. Shard 서명 생성 (Mock)
             
-            for (uint32_t i = 0; i < signing_req.total_shards(); ++i) {
-                std::string shard_sig 
-                    = "0xMOCK_SHARD_" + std::to_string(i) + "_" + signing_req.key_id() + "_" + std::to_string(utils::GetCurrentTimeMs());
-                response->add_shard_signatures(shard_sig);
+                for (uint32_t i = 0; i < signing_req.total_shards(); ++i) {
+                    std::string shard_sig 
+                        = "0xMOCK_SHARD_" + std::to_string(i) + "_" + signing_req.key_id() + "_" + std::to_string(utils::GetCurrentTimeMs());
+                    response->add_shard_signatures(shard_sig);
+                }
+
+                // 4. 최종 서명 생성 (Mock)
+                std::string final_sig = "0xMOCK_FINAL_SIG_" + signing_req.key_id() + "_" + std::to_string(utils::GetCurrentTimeMs());
+                response->set_final_signature(final_sig);
+                response->set_successful_shards(signing_req.total_shards());
+
+                LOG_DEBUG("WalletSigningHandler", "[Handler] Mock signing completed successfully");
+                LOG_DEBUGF("WalletSigningHandler", "  Final Signature: %s", response->final_signature().c_str());
+            }
+            catch (const std::exception& e) 
+            {
+                header->set_success(false);
+                header->set_error_message("Wallet signing failed: " + std::string(e.what()));
+                LOG_ERRORF("WalletSigningHandler", "Error: %s", header->error_message().c_str());
             }
+        
+            return response_msg;
+        }
+    }
 
-            // 3. 최종 서명 생성 (Mock)
-            std::string final_sig = "0xMOCK_FINAL_SIG_" + signing_req.key_id() + "_" + std::to_string(utils::GetCurrentTimeMs());
-            response->set_final_signature(final_sig);
-            response->set_successful_shards(signing_req.total_shards());
+    void SetWalletSigningBackend(WalletSigningBackend backend)
+    {
+        std::lock_guard<std::mutex> lock(backend_mutex);
+        signing_backend = backend ? std::make_shared<WalletSigningBackend>(std::move(backend)) : nullptr;
+    }
+
+    void ConfigureWalletRequestDedup(const WalletRequestDedupConfig& config)
+    {
+        Deduplicator().Configure(config);
+    }
+
+    WalletRequestDedupStats GetWalletRequestDedupStats()
+    {
+        return Deduplicator().GetStats();
+    }
+
+    std::unique_ptr<WalletCoordinatorMessage> HandleWalletSigningRequest(const WalletCoordinatorMessage* request,
+                                                                         const std::string& tenant_id) 
+    {
+        LOG_DEBUG("WalletSigningHandler", "=== HandleWalletSigningRequest ===");
 
-            LOG_DEBUG("WalletSigningHandler", "[Handler] Mock signing completed successfully");
-            LOG_DEBUGF("WalletSigningHandler", "  Final Signature: %s", response->final_signature().c_str());
+        if (!request || !request->has_signing_request()) {
+            LOG_ERROR("WalletSigningHandler", "[Handler] Invalid request");
+            return nullptr;
         }
-        catch (const std::exception& e) 
-        {
+
+        const WalletSigningRequest& signing_req = request->signing_request();
+        const std::string& request_id = signing_req.header().request_id();
+
+        // Wallet 재시도 중복 제거 - 실행 중이면 그 결과를 (요청 budget 안에서), 최근 완료면 보관된 결과를 반환
+        WalletDedupOutcome outcome = WalletDedupOutcome::BYPASSED;
+        auto response_msg = Deduplicator().Execute(tenant_id, request_id, SigningRequestFingerprint(signing_req),
+            [&signing_req]() { return ProcessSigningRequest(signing_req); }, &outcome,
+            utils::DeadlineAfter(signing_req.header().timeout_ms()));
+
+        if (outcome == WalletDedupOutcome::CONFLICT || outcome == WalletDedupOutcome::DEADLINE_EXCEEDED) {
+            response_msg = std::make_unique<WalletCoordinatorMessage>();
+            response_msg->set_message_type(signing_req.header().message_type());
+            auto* header = response_msg->mutable_signing_response()->mutable_header();
+            header->set_message_type(signing_req.header().message_type());
             header->set_success(false);
-            header->set_error_message("Wallet signing failed: " + std::string(e.what()));
-            LOG_ERRORF("WalletSigningHandler", "Error: %s", header->error_message().c_str());
+            header->set_request_id(request_id);
+            header->set_timestamp(std::to_string(utils::GetCurrentTimeMs()));
+            if (outcome == WalletDedupOutcome::CONFLICT) {
+                LOG_WARNF("WalletSigningHandler", "Request %s reused with a different payload", request_id.c_str());
+                header->set_error_message("Request id " + request_id + " was already used for a different signing request");
+            } else {
+                LOG_WARNF("WalletSigningHandler", "Request %s timed out waiting for the in-flight duplicate", request_id.c_str());
+                header->set_error_message("Deadline exceeded waiting for in-flight request " + request_id);
+            }
+        } else if (outcome == WalletDedupOutcome::JOINED || outcome == WalletDedupOutcome::CACHED) {
+            LOG_DEBUGF("WalletSigningHandler", "Duplicate request %s answered without re-signing (%s)",
+                       request_id.c_str(), WalletDedupOutcomeToString(outcome));
         }
-        
         return response_msg;
     }
 
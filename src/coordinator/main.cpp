@@ -8,8 +8,10 @@
 #include "common/utils/logger/Logger.hpp"
 #include <signal.h>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 using namespace mpc_engine;
@@ -22,22 +24,35 @@ using namespace mpc_engine::resource;
 // 전역 상태 관리
 static CoordinatorServer* g_coordinator = nullptr;
 static std::atomic<bool> g_shutdown_requested{false};
+static std::atomic<bool> g_reload_requested{false};
 static std::condition_variable g_shutdown_cv;
 static std::mutex g_shutdown_mutex;
 
-void SignalHandler(int signal) 
+static sigset_t g_handled_signals;
+
+// SIGINT/SIGTERM/SIGHUP은 모든 스레드에서 막아 두고 이 스레드가 sigwait로 받음
+// (signal handler 안에서는 lock/condvar/로그를 쓸 수 없음) - 실제 drain/reload는 메인 루프에서 수행
+void SignalWaitLoop() 
 {
-    LOG_INFOF("CoordinatorServer", "Received signal %d, shutting down gracefully...", signal);
-    
-    if (g_coordinator) {
-        g_coordinator->Stop();
-    }
-    
-    {
-        std::lock_guard<std::mutex> lock(g_shutdown_mutex);
-        g_shutdown_requested.store(true);
+    while (true) {
+        int signal = 0;
+        if (sigwait(&g_handled_signals, &signal) != 0) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(g_shutdown_mutex);
+            if (signal == SIGHUP) {
+                // tenant 한도 reload
+                g_reload_requested.store(true);
+            } else {
+                // SIGINT/SIGTERM: drain 후 종료
+                LOG_INFOF("CoordinatorServer", "Received signal %d, draining before shutdown...", signal);
+                g_shutdown_requested.store(true);
+            }
+        }
+        g_shutdown_cv.notify_one();
     }
-    g_shutdown_cv.notify_one();
 }
 
 void PrintUsage(const char* program_name) 
@@ -54,6 +69,13 @@ void PrintUsage(const char* program_name)
 
 int main(int argc, char* argv[]) 
 {
+    // 이후 만드는 모든 스레드가 mask를 물려받도록 가장 먼저 막음 - signal은 SignalWaitLoop만 받음
+    sigemptyset(&g_handled_signals);
+    sigaddset(&g_handled_signals, SIGINT);
+    sigaddset(&g_handled_signals, SIGTERM);
+    sigaddset(&g_handled_signals, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &g_handled_signals, nullptr);
+
     LOG_INFO("CoordinatorServer", "=== MPC Engine Coordinator Server ===");
     LOG_INFOF("CoordinatorServer", "Build: %s %s", __DATE__, __TIME__);
     
@@ -147,9 +169,8 @@ int main(int argc, char* argv[])
         CoordinatorServer& coordinator = CoordinatorServer::Instance();
         g_coordinator = &coordinator;
         
-        // 시그널 핸들러 등록
-        signal(SIGINT, SignalHandler);
-        signal(SIGTERM, SignalHandler);
+        // 시그널 수신 스레드 (종료 시 sigwait에 막혀 있어도 무방)
+        std::thread(SignalWaitLoop).detach();
         
         if (!coordinator.Initialize()) {
             LOG_ERROR("CoordinatorServer", "Failed to initialize coordinator");
@@ -268,12 +289,33 @@ int main(int argc, char* argv[])
         // ========================================
         {
             std::unique_lock<std::mutex> lock(g_shutdown_mutex);
-            g_shutdown_cv.wait(lock, [] { return g_shutdown_requested.load(); });
+            while (true) {
+                g_shutdown_cv.wait(lock, [] { return g_shutdown_requested.load() || g_reload_requested.load(); });
+                if (g_shutdown_requested.load()) {
+                    break;
+                }
+                g_reload_requested.store(false);
+                lock.unlock();
+                coordinator.ReloadWalletAdmission();
+                lock.lock();
+            }
         }
         
         LOG_INFO("CoordinatorServer", "\nShutdown initiated...");
+
+        // 진행 중 요청/세션을 timeout까지 마무리한 뒤 종료 (결과 로그는 Drain이 남김)
+        std::chrono::milliseconds drain_timeout(Config::HasKey("COORDINATOR_DRAIN_TIMEOUT_MS")
+            ? Config::GetUInt32("COORDINATOR_DRAIN_TIMEOUT_MS") : 30000);
+        CoordinatorDrainReport drain = coordinator.Drain(drain_timeout);
+        bool drained = drain.sessions.aborted == 0 && drain.sessions.lost == 0 && drain.unanswered_requests == 0;
+
         coordinator.Stop();
 
+        // timeout으로 끊은 세션/요청이 있으면 0이 아닌 종료 코드 (supervisor가 구분할 수 있도록)
+        if (!drained) {
+            LOG_WARN("CoordinatorServer", "Coordinator server stopped before all work drained");
+            return 1;
+        }
         LOG_INFO("CoordinatorServer", "Coordinator server stopped cleanly");
         return 0;
         
@@ -0,0 +1,140 @@
+// src/coordinator/network/node_client/include/EngineSetRouter.hpp
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mpc_engine::coordinator::network
+{
+    /**
+     * @brief key_id → engine set consistent-hash ring (virtual node)
+     *
+     * set마다 virtual_nodes개의 점을 ring에 두고 key는 시계 방향으로 처음 만나는 점의 set에 배치.
+     * set 추가 시 새 set의 점 바로 앞 구간의 key만 새 set으로, 제거 시 제거된 set의 key만 이웃 set으로 이동
+     * (다른 key의 배치는 그대로). 읽기 전용 - 변경은 복사본을 만들어 교체 (EngineSetRouter).
+     */
+    class ConsistentHashRing
+    {
+    public:
+        static constexpr size_t DEFAULT_VIRTUAL_NODES = 160;
+
+        explicit ConsistentHashRing(size_t virtual_nodes = DEFAULT_VIRTUAL_NODES);
+
+        // 이미 있으면 false
+        bool AddSet(const std::string& set_id);
+        bool RemoveSet(const std::string& set_id);
+        bool HasSet(const std::string& set_id) const;
+
+        // @return 배치된 set (ring이 비어 있으면 빈 문자열)
+        const std::string& Route(const std::string& key_id) const;
+
+        const std::vector<std::string>& GetSets() const { return sets; }
+        size_t GetVirtualNodes() const { return virtual_nodes; }
+
+        // 프로세스/플랫폼과 무관한 64bit hash (FNV-1a + splitmix64 finalizer)
+        static uint64_t Hash(const std::string& value);
+
+    private:
+        size_t virtual_nodes;
+        std::vector<std::string> sets;                          // 추가 순
+        std::vector<std::pair<uint64_t, size_t>> points;        // (hash, sets index) - hash 순 정렬
+    };
+
+    struct EngineSetStats
+    {
+        std::string set_id;
+        std::vector<std::string> node_ids;
+        size_t connected_nodes = 0;     // CoordinatorServer가 채움
+        bool healthy = false;           // 연결된 노드 >= threshold (CoordinatorServer가 채움)
+        size_t in_flight = 0;
+        uint64_t requests = 0;
+        uint64_t failures = 0;
+    };
+
+    /**
+     * @brief engine set (Coordinator가 관리하는 노드 그룹) 목록 + key 라우팅 + set별 부하 집계
+     *
+     * - 노드는 한 set에만 속함, set의 노드가 모두 빠지면 set도 ring에서 제거
+     * - Route는 ring 스냅샷(shared_ptr)으로 lock 밖에서 계산
+     * - set별 부하: Begin으로 요청 1건 시작 (in_flight/requests), Finish로 결과 (failures)
+     */
+    class EngineSetRouter
+    {
+    private:
+        struct Load
+        {
+            std::atomic<size_t> in_flight{0};
+            std::atomic<uint64_t> requests{0};
+            std::atomic<uint64_t> failures{0};
+        };
+
+    public:
+        // 요청 1건의 set 부하 기록 (Finish 없이 소멸하면 실패로 집계)
+        class Request
+        {
+        public:
+            Request() = default;
+            explicit Request(std::shared_ptr<Load> load);
+            ~Request();
+
+            Request(Request&& other) noexcept;
+            Request& operator=(Request&& other) noexcept;
+            Request(const Request&) = delete;
+            Request& operator=(const Request&) = delete;
+
+            void Finish(bool success);
+
+        private:
+            std::shared_ptr<Load> load;
+        };
+
+        explicit EngineSetRouter(size_t virtual_nodes = ConsistentHashRing::DEFAULT_VIRTUAL_NODES);
+
+        // virtual node 수 변경 (ring 재구성 - 모든 set 유지)
+        void SetVirtualNodes(size_t virtual_nodes);
+
+        /**
+        * @brief 노드를 set에 추가 (set이 없으면 생성해 ring에 추가)
+        * @return 노드가 이미 다른 set에 속해 있으면 false
+        */
+        bool AddNode(const std::string& set_id, const std::string& node_id);
+        // 노드가 빠져 set이 비면 set도 제거
+        void RemoveNode(const std::string& node_id);
+
+        // set 노드 목록 교체 (없으면 생성) - 다른 set에 속한 노드가 있으면 false
+        bool AddSet(const std::string& set_id, const std::vector<std::string>& node_ids);
+        bool RemoveSet(const std::string& set_id);
+
+        std::string Route(const std::string& key_id) const;
+        std::vector<std::string> GetSetNodes(const std::string& set_id) const;
+        std::string GetNodeSet(const std::string& node_id) const;
+        std::vector<std::string> GetSetIds() const;
+        size_t GetSetCount() const;
+
+        Request Begin(const std::string& set_id) const;
+
+        // connected_nodes/healthy 제외
+        std::vector<EngineSetStats> GetStats() const;
+
+    private:
+        struct EngineSet
+        {
+            std::vector<std::string> node_ids;
+            std::shared_ptr<Load> load = std::make_shared<Load>();
+        };
+
+        mutable std::mutex mutex;
+        std::map<std::string, EngineSet> sets;
+        std::map<std::string, std::string> node_sets;           // node_id → set_id
+        std::shared_ptr<const ConsistentHashRing> ring;
+
+        std::shared_ptr<const ConsistentHashRing> GetRing() const;
+        // mutex 보유 상태에서 호출
+        bool RemoveSetLocked(const std::string& set_id);
+    };
+}
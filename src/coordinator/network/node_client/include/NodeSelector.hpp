@@ -0,0 +1,70 @@
+// src/coordinator/network/node_client/include/NodeSelector.hpp
+#pragma once
+#include "coordinator/network/node_client/include/NodeTcpClient.hpp"
+#include "types/BasicTypes.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace mpc_engine::coordinator::network
+{
+    enum class NodeSelectionPolicy
+    {
+        ORDERED = 0,                // 후보 순서 그대로 (우선/회피 목록만 적용)
+        LOWEST_LATENCY = 1,         // 점수(지연 × (대기 요청 + 1)) 낮은 순
+        POWER_OF_TWO_CHOICES = 2    // 무작위 2개 중 점수 낮은 쪽 - 같은 노드로 몰리지 않음
+    };
+
+    const char* NodeSelectionPolicyToString(NodeSelectionPolicy policy);
+    NodeSelectionPolicy NodeSelectionPolicyFromString(const std::string& str);
+
+    struct NodeSelectionConfig
+    {
+        NodeSelectionPolicy policy = NodeSelectionPolicy::LOWEST_LATENCY;
+
+        // 우선/회피 (노드 id 또는 플랫폼 단위) - 회피 노드는 나머지로 threshold를 못 채울 때만 사용
+        std::vector<std::string> preferred_nodes;
+        std::vector<std::string> avoided_nodes;
+        std::vector<PlatformType> preferred_platforms;
+        std::vector<PlatformType> avoided_platforms;
+
+        // 지연 표본이 이보다 오래되면 점수 0으로 보고 한 번 다시 시도 (느렸던 노드의 회복 감지)
+        std::chrono::milliseconds stale_after{1000};
+        // BUSY/SHUTTING_DOWN/타임아웃 후 이 시간 동안은 회피 노드보다도 후순위 (ORDERED 제외)
+        std::chrono::milliseconds degraded_cooldown{2000};
+    };
+
+    struct NodeCandidate
+    {
+        std::string node_id;
+        PlatformType platform = PlatformType::UNKNOWN;
+        NodeLoadSnapshot load;
+    };
+
+    /**
+     * @brief threshold 연산 참여 노드 선택
+     *
+     * 후보를 단계(우선 → 일반 → 회피 → 최근 에러) 순으로 나누고 단계 안에서는 정책에 따라 정렬합니다.
+     * 호출자는 앞에서부터 필요한 수만큼 사용 (MpcSessionEngine은 연결된 노드 중 앞의 threshold개).
+     * 점수는 응답 지연(peak EWMA)에 대기 요청 수를 곱한 값 - 느려지거나 밀리는 노드는 즉시 뒤로 가고,
+     * 한동안 안 쓴 노드는 stale_after 후 다시 시도되어 회복이 반영됩니다.
+     */
+    class NodeSelector
+    {
+    public:
+        explicit NodeSelector(NodeSelectionConfig config = NodeSelectionConfig());
+
+        const NodeSelectionConfig& GetConfig() const { return config; }
+
+        // @return 선택 순서대로 정렬한 node_id (후보 전체)
+        std::vector<std::string> Order(std::vector<NodeCandidate> candidates, uint64_t now_ms) const;
+
+        // 낮을수록 우선
+        double Score(const NodeLoadSnapshot& load, uint64_t now_ms) const;
+
+    private:
+        NodeSelectionConfig config;
+
+        int Tier(const NodeCandidate& candidate, uint64_t now_ms) const;
+    };
+}
@@ -6,11 +6,14 @@
 #include "common/utils/queue/ThreadSafeQueue.hpp"
 #include "common/network/tls/include/TlsContext.hpp"
 #include "common/network/tls/include/TlsConnection.hpp"
+#include "common/utils/time/Deadline.hpp"
+#include <array>
 #include <memory>
 #include <mutex>
 #include <functional>
 #include <atomic>
 #include <future>
+#include <condition_variable>
 #include <unordered_map>
 #include <thread>
 
@@ -23,6 +26,8 @@ namespace mpc_engine::coordinator::network
     using NodeConnectedCallback = std::function<void(const std::string& node_id)>;
     using NodeDisconnectedCallback = std::function<void(const std::string& node_id)>;
     using NodeErrorCallback = std::function<void(const std::string& node_id, NetworkError, const std::string&)>;
+    using NodeResponseCallback = std::function<void(std::unique_ptr<CoordinatorNodeMessage> response)>;
+    using NodeFrameCallback = std::function<void(std::unique_ptr<NetworkMessage> response)>;
 
     // 비동기 요청 결과
     struct AsyncRequestResult {
@@ -30,6 +35,20 @@ namespace mpc_engine::coordinator::network
         std::future<NetworkMessage> future;
     };
 
+    // Send Queue 항목 - 기한이 지난 요청은 전송하지 않고, 보내는 요청은 그 시점의 남은 기한을 header.timeout_ms로
+    struct OutboundRequest {
+        NetworkMessage message;
+        utils::Deadline deadline = utils::NO_DEADLINE;
+    };
+
+    // 노드 선택 정책 입력 (응답 지연 / 부하 / 최근 에러)
+    struct NodeLoadSnapshot {
+        uint64_t latency_ns = 0;        // peak EWMA 응답 지연 (0 = 표본 없음)
+        uint64_t last_sample_ms = 0;    // 마지막 지연 표본 시각
+        uint64_t last_degraded_ms = 0;  // 마지막 BUSY/SHUTTING_DOWN 응답 또는 타임아웃 시각
+        size_t in_flight = 0;           // 응답 대기 중인 요청 수
+    };
+
     class NodeTcpClient 
     {
     private:
@@ -40,7 +59,27 @@ namespace mpc_engine::coordinator::network
         
         std::atomic<uint64_t> last_used_time{0};
         std::atomic<bool> is_connected{false};
+        std::atomic<bool> connection_lost{false};   // 수신 스레드가 끊김 감지 (정리는 EnsureConnection에서)
+        std::mutex reconnect_mutex;
+
+        // 연결 끊김 시 자동 재연결 (노드 재시작/핸드오프 후 새 프로세스로 즉시 재접속)
+        std::thread reconnect_thread;
+        std::mutex reconnect_wait_mutex;
+        std::condition_variable reconnect_cv;
+        std::atomic<bool> auto_reconnect{false};      // 명시적 Disconnect 시 해제
+        std::atomic<bool> reconnect_stop{false};
+        uint32_t reconnect_min_backoff_ms = 5;
+        uint32_t reconnect_max_backoff_ms = 1000;
+        std::atomic<uint64_t> reconnect_count{0};
+
+        // Node가 BUSY로 응답했을 때 같은 노드에 재시도할 최대 횟수
+        uint32_t busy_retry_limit = 2;
+        std::atomic<uint64_t> busy_responses{0};
         
+        // 노드 간 MPC mesh 주소 (NODE_MESH_HOSTS, port 0 = mesh 없음) - 등록 시 설정, 이후 변경하지 않음
+        std::string mesh_host;
+        uint16_t mesh_port = 0;
+
         NodeConnectedCallback connected_callback;
         NodeDisconnectedCallback disconnected_callback;
         NodeErrorCallback error_callback;
@@ -50,11 +89,34 @@ namespace mpc_engine::coordinator::network
         std::unique_ptr<TlsConnection> tls_connection;
 
         // Send Queue: 여러 Handler가 요청을 큐잉
-        std::unique_ptr<utils::ThreadSafeQueue<NetworkMessage>> send_queue;
+        std::unique_ptr<utils::ThreadSafeQueue<OutboundRequest>> send_queue;
+        std::atomic<uint64_t> expired_in_queue{0};      // 큐 대기 중 기한이 지나 보내지 않은 요청
         
-        // Pending Requests: request_id → promise 매핑
-        std::unordered_map<uint64_t, std::promise<NetworkMessage>> pending_requests;
-        std::mutex pending_mutex;
+        // Pending Requests: request_id → promise 매핑 (sent_ns: 응답 지연 측정용)
+        struct PendingRequest {
+            std::promise<NetworkMessage> promise;
+            uint64_t sent_ns = 0;
+        };
+        struct PendingCallback {
+            NodeResponseCallback callback;
+            NodeFrameCallback frame_callback;   // SendFrameWithCallback - 응답 프레임을 파싱하지 않고 전달
+            uint64_t sent_ns = 0;
+        };
+        std::unordered_map<uint64_t, PendingRequest> pending_requests;
+        std::unordered_map<uint64_t, PendingCallback> pending_callbacks;     // SendRequestWithCallback
+        mutable std::mutex pending_mutex;
+
+        // 응답 지연 peak EWMA (pending_mutex 보호) - 느려지면 즉시 반영, 빨라지면 시간 기준으로 감쇠
+        double latency_cost_ns = 0;
+        uint64_t latency_sampled_ns = 0;
+        std::atomic<uint64_t> last_latency_sample_ms{0};
+        std::atomic<uint64_t> last_degraded_ms{0};
+
+        // 최근 응답 지연 window (pending_mutex 보호) - p95는 LATENCY_P95_REFRESH 표본마다 다시 계산
+        static constexpr size_t LATENCY_WINDOW = 128;
+        std::array<uint64_t, LATENCY_WINDOW> latency_window{};
+        size_t latency_window_count = 0;
+        std::atomic<uint64_t> latency_p95_ns{0};
         
         // Request ID 생성기
         std::atomic<uint64_t> next_request_id{1};
@@ -85,8 +147,62 @@ namespace mpc_engine::coordinator::network
         bool SendMessage(const NetworkMessage& message);
         bool ReceiveMessage(NetworkMessage& message);
 
-        AsyncRequestResult SendRequestAsync(const CoordinatorNodeMessage* request);
-        std::unique_ptr<CoordinatorNodeMessage> SendRequest(const CoordinatorNodeMessage* request);
+        AsyncRequestResult SendRequestAsync(const CoordinatorNodeMessage* request, utils::Deadline deadline = utils::NO_DEADLINE);
+
+        /**
+        * @brief 동기 요청 (응답 또는 타임아웃까지 대기)
+        * 
+        * Node가 BUSY(error_response)로 응답하면 retry_after_ms 힌트만큼 쉬고 같은 노드에 재시도합니다.
+        * 그 외 에러 응답(SHUTTING_DOWN 등)은 그대로 반환 → 호출자가 다른 노드로 우회.
+        * @param deadline 호출자 기한 - 기본 대기 상한(30초)보다 이르면 그때까지만 대기, 노드에도 남은 기한 전달
+        * @return 응답 (error_response 포함 가능) / 연결 끊김·타임아웃 시 nullptr
+        */
+        std::unique_ptr<CoordinatorNodeMessage> SendRequest(const CoordinatorNodeMessage* request,
+                                                            utils::Deadline deadline = utils::NO_DEADLINE);
+
+        /**
+        * @brief 완료 콜백 요청 - 큐잉 후 즉시 반환, 응답은 수신 스레드(ReceiveLoop)에서 콜백으로 전달
+        *
+        * 호출 스레드를 붙잡지 않으므로 fan-out 시 노드별 대기 스레드가 필요 없습니다.
+        * 콜백은 수신 스레드에서 실행되므로 짧게 끝나야 하며, 연결이 끊기면 nullptr로 호출됩니다.
+        * BUSY 재시도는 하지 않음 (응답 그대로 전달).
+        * deadline까지 전송하지 못하면 보내지 않고 DEADLINE_EXCEEDED 에러 응답으로 콜백 (송신 스레드에서 호출)
+        * @return request_id (0 = 미연결/큐 가득 → 콜백 호출 안 됨)
+        */
+        uint64_t SendRequestWithCallback(const CoordinatorNodeMessage* request, NodeResponseCallback callback,
+                                         utils::Deadline deadline = utils::NO_DEADLINE);
+
+        /**
+        * @brief 이미 만든 프레임 전송 (relay 프레임 등 protobuf가 아닌 body) - 응답 프레임도 파싱 없이 콜백으로 전달
+        * request_id는 여기서, header.timeout_ms는 송신 스레드가 전송 직전에 채움. 콜백 규칙은 SendRequestWithCallback과 같음 (연결 끊김 시 nullptr)
+        * @return request_id (0 = 미연결/큐 가득 → 콜백 호출 안 됨)
+        */
+        uint64_t SendFrameWithCallback(NetworkMessage frame, NodeFrameCallback callback,
+                                       utils::Deadline deadline = utils::NO_DEADLINE);
+
+        /**
+        * @brief 콜백 요청 포기 - 이후 도착하는 응답은 버림 (이미 실행 중인 콜백은 막지 않음)
+        */
+        void CancelRequest(uint64_t request_id);
+
+        /**
+        * @brief 다른 노드로 즉시 재시도할 가치가 있는 에러 응답인지 (BUSY / SHUTTING_DOWN / DEADLINE_EXCEEDED)
+        */
+        static bool IsRetryableNodeError(const CoordinatorNodeMessage& response);
+        uint64_t GetBusyResponseCount() const { return busy_responses.load(); }
+        uint64_t GetReconnectCount() const { return reconnect_count.load(); }
+        uint64_t GetExpiredRequestCount() const { return expired_in_queue.load(); }
+        uint32_t GetBusyRetryLimit() const { return busy_retry_limit; }
+        void RecordBusyResponse() { busy_responses++; MarkDegraded(); }
+
+        /**
+        * @brief 노드 선택 정책이 잠시 후순위로 두도록 표시 (재시도 가능한 에러 응답 / 라운드 타임아웃)
+        * 에러 응답은 수신 시 자동 기록 - 타임아웃처럼 응답이 없는 경우 호출자가 기록
+        */
+        void MarkDegraded();
+        NodeLoadSnapshot GetLoadSnapshot() const;
+        // 최근 LATENCY_WINDOW개 응답 지연의 p95 (표본 부족 시 0) - hedge 시점 판단용
+        uint64_t GetLatencyP95Ns() const { return latency_p95_ns.load(std::memory_order_relaxed); }
 
         void SetConnectedCallback(NodeConnectedCallback callback);
         void SetDisconnectedCallback(NodeDisconnectedCallback callback);
@@ -101,6 +217,10 @@ namespace mpc_engine::coordinator::network
         std::string GetEndpoint() const { return connection_info.GetEndpoint(); }
         ConnectionStatus GetStatus() const { return connection_info.status; }
 
+        void SetPeerMeshEndpoint(const std::string& host, uint16_t port) { mesh_host = host; mesh_port = port; }
+        const std::string& GetPeerMeshHost() const { return mesh_host; }
+        uint16_t GetPeerMeshPort() const { return mesh_port; }
+
         std::string ToString() const { return connection_info.ToString(); }
         bool IsValid() const { return connection_info.IsValid(); }
 
@@ -113,6 +233,17 @@ namespace mpc_engine::coordinator::network
 
         void SendLoop();
         void ReceiveLoop();
+        void ReconnectLoop();
+        void DisconnectInternal();
+        void FailPendingRequests(const char* reason);
+        void RecordLatencyLocked(uint64_t sent_ns, uint64_t now_ns);
+
+        std::unique_ptr<CoordinatorNodeMessage> SendRequestOnce(
+            const CoordinatorNodeMessage* request,
+            std::chrono::steady_clock::time_point deadline);
+        void AbandonPendingRequest(uint64_t request_id, const char* reason);
+        // 큐 대기 중 기한이 지난 요청 - 노드에 보내지 않고 DEADLINE_EXCEEDED 에러 응답으로 완료
+        void ExpireQueuedRequest(const NetworkMessage& message);
 
         bool SendRaw(const void* data, size_t length);
         bool ReceiveRaw(void* buffer, size_t length);
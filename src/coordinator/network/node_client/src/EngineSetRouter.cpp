@@ -0,0 +1,315 @@
+// src/coordinator/network/node_client/src/EngineSetRouter.cpp
+#include "coordinator/network/node_client/include/EngineSetRouter.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include <algorithm>
+
+namespace mpc_engine::coordinator::network
+{
+    // ========================================
+    // ConsistentHashRing
+    // ========================================
+
+    ConsistentHashRing::ConsistentHashRing(size_t virtual_nodes)
+        : virtual_nodes(std::max<size_t>(virtual_nodes, 1))
+    {
+    }
+
+    uint64_t ConsistentHashRing::Hash(const std::string& value)
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (unsigned char c : value) {
+            hash ^= c;
+            hash *= 0x100000001b3ULL;
+        }
+        // FNV-1a는 비슷한 문자열(key-1, key-2)의 상위 비트가 몰림 - finalizer로 분산
+        hash ^= hash >> 30;
+        hash *= 0xbf58476d1ce4e5b9ULL;
+        hash ^= hash >> 27;
+        hash *= 0x94d049bb133111ebULL;
+        hash ^= hash >> 31;
+        return hash;
+    }
+
+    bool ConsistentHashRing::AddSet(const std::string& set_id)
+    {
+        if (set_id.empty() || HasSet(set_id)) {
+            return false;
+        }
+
+        size_t index = sets.size();
+        sets.push_back(set_id);
+        points.reserve(points.size() + virtual_nodes);
+        for (size_t i = 0; i < virtual_nodes; ++i) {
+            points.emplace_back(Hash(set_id + "#" + std::to_string(i)), index);
+        }
+        // hash가 같은 점은 set_id 순 - 추가 순서와 무관하게 같은 배치
+        std::sort(points.begin(), points.end(), [this](const auto& a, const auto& b) {
+            return a.first != b.first ? a.first < b.first : sets[a.second] < sets[b.second];
+        });
+        return true;
+    }
+
+    bool ConsistentHashRing::RemoveSet(const std::string& set_id)
+    {
+        auto it = std::find(sets.begin(), sets.end(), set_id);
+        if (it == sets.end()) {
+            return false;
+        }
+
+        size_t index = static_cast<size_t>(it - sets.begin());
+        sets.erase(it);
+        points.erase(std::remove_if(points.begin(), points.end(), [index](const auto& point) { return point.second == index; }),
+                     points.end());
+        for (auto& point : points) {
+            if (point.second > index) {
+                point.second--;
+            }
+        }
+        return true;
+    }
+
+    bool ConsistentHashRing::HasSet(const std::string& set_id) const
+    {
+        return std::find(sets.begin(), sets.end(), set_id) != sets.end();
+    }
+
+    const std::string& ConsistentHashRing::Route(const std::string& key_id) const
+    {
+        static const std::string none;
+        if (points.empty()) {
+            return none;
+        }
+
+        uint64_t hash = Hash(key_id);
+        auto it = std::upper_bound(points.begin(), points.end(), hash,
+                                   [](uint64_t value, const auto& point) { return value < point.first; });
+        if (it == points.end()) {
+            it = points.begin();    // ring 한 바퀴
+        }
+        return sets[it->second];
+    }
+
+    // ========================================
+    // EngineSetRouter
+    // ========================================
+
+    EngineSetRouter::Request::Request(std::shared_ptr<Load> load)
+        : load(std::move(load))
+    {
+        if (this->load) {
+            this->load->in_flight++;
+            this->load->requests++;
+        }
+    }
+
+    EngineSetRouter::Request::~Request()
+    {
+        Finish(false);
+    }
+
+    EngineSetRouter::Request::Request(Request&& other) noexcept
+        : load(std::move(other.load))
+    {
+    }
+
+    EngineSetRouter::Request& EngineSetRouter::Request::operator=(Request&& other) noexcept
+    {
+        if (this != &other) {
+            Finish(false);
+            load = std::move(other.load);
+        }
+        return *this;
+    }
+
+    void EngineSetRouter::Request::Finish(bool success)
+    {
+        if (!load) {
+            return;
+        }
+        load->in_flight--;
+        if (!success) {
+            load->failures++;
+        }
+        load.reset();
+    }
+
+    EngineSetRouter::EngineSetRouter(size_t virtual_nodes)
+        : ring(std::make_shared<const ConsistentHashRing>(virtual_nodes))
+    {
+    }
+
+    void EngineSetRouter::SetVirtualNodes(size_t virtual_nodes)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (ring->GetVirtualNodes() == virtual_nodes) {
+            return;
+        }
+        auto rebuilt = std::make_shared<ConsistentHashRing>(virtual_nodes);
+        for (const std::string& set_id : ring->GetSets()) {
+            rebuilt->AddSet(set_id);
+        }
+        ring = std::move(rebuilt);
+    }
+
+    bool EngineSetRouter::AddNode(const std::string& set_id, const std::string& node_id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto owner = node_sets.find(node_id);
+        if (owner != node_sets.end()) {
+            return owner->second == set_id;
+        }
+
+        auto it = sets.find(set_id);
+        if (it == sets.end()) {
+            it = sets.emplace(set_id, EngineSet()).first;
+            auto updated = std::make_shared<ConsistentHashRing>(*ring);
+            updated->AddSet(set_id);
+            ring = std::move(updated);
+            LOG_INFOF("EngineSetRouter", "Engine set %s added (%zu sets)", set_id.c_str(), sets.size());
+        }
+        it->second.node_ids.push_back(node_id);
+        node_sets[node_id] = set_id;
+        return true;
+    }
+
+    void EngineSetRouter::RemoveNode(const std::string& node_id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto owner = node_sets.find(node_id);
+        if (owner == node_sets.end()) {
+            return;
+        }
+        std::string set_id = owner->second;
+        node_sets.erase(owner);
+
+        std::vector<std::string>& node_ids = sets[set_id].node_ids;
+        node_ids.erase(std::remove(node_ids.begin(), node_ids.end(), node_id), node_ids.end());
+        if (node_ids.empty()) {
+            RemoveSetLocked(set_id);
+        }
+    }
+
+    bool EngineSetRouter::AddSet(const std::string& set_id, const std::vector<std::string>& node_ids)
+    {
+        if (set_id.empty() || node_ids.empty()) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const std::string& node_id : node_ids) {
+            auto owner = node_sets.find(node_id);
+            if (owner != node_sets.end() && owner->second != set_id) {
+                LOG_ERRORF("EngineSetRouter", "Node %s already belongs to engine set %s", node_id.c_str(), owner->second.c_str());
+                return false;
+            }
+        }
+
+        auto it = sets.find(set_id);
+        if (it == sets.end()) {
+            it = sets.emplace(set_id, EngineSet()).first;
+            auto updated = std::make_shared<ConsistentHashRing>(*ring);
+            updated->AddSet(set_id);
+            ring = std::move(updated);
+        }
+        for (const std::string& node_id : it->second.node_ids) {
+            node_sets.erase(node_id);
+        }
+        it->second.node_ids = node_ids;
+        for (const std::string& node_id : node_ids) {
+            node_sets[node_id] = set_id;
+        }
+        LOG_INFOF("EngineSetRouter", "Engine set %s: %zu nodes (%zu sets)", set_id.c_str(), node_ids.size(), sets.size());
+        return true;
+    }
+
+    bool EngineSetRouter::RemoveSet(const std::string& set_id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return RemoveSetLocked(set_id);
+    }
+
+    bool EngineSetRouter::RemoveSetLocked(const std::string& set_id)
+    {
+        auto it = sets.find(set_id);
+        if (it == sets.end()) {
+            return false;
+        }
+        for (const std::string& node_id : it->second.node_ids) {
+            node_sets.erase(node_id);
+        }
+        sets.erase(it);
+
+        auto updated = std::make_shared<ConsistentHashRing>(*ring);
+        updated->RemoveSet(set_id);
+        ring = std::move(updated);
+        LOG_INFOF("EngineSetRouter", "Engine set %s removed (%zu sets)", set_id.c_str(), sets.size());
+        return true;
+    }
+
+    std::string EngineSetRouter::Route(const std::string& key_id) const
+    {
+        std::shared_ptr<const ConsistentHashRing> snapshot = GetRing();
+        return snapshot->Route(key_id);
+    }
+
+    std::vector<std::string> EngineSetRouter::GetSetNodes(const std::string& set_id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = sets.find(set_id);
+        return it != sets.end() ? it->second.node_ids : std::vector<std::string>();
+    }
+
+    std::string EngineSetRouter::GetNodeSet(const std::string& node_id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = node_sets.find(node_id);
+        return it != node_sets.end() ? it->second : std::string();
+    }
+
+    std::vector<std::string> EngineSetRouter::GetSetIds() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::string> set_ids;
+        set_ids.reserve(sets.size());
+        for (const auto& entry : sets) {
+            set_ids.push_back(entry.first);
+        }
+        return set_ids;
+    }
+
+    size_t EngineSetRouter::GetSetCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return sets.size();
+    }
+
+    EngineSetRouter::Request EngineSetRouter::Begin(const std::string& set_id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = sets.find(set_id);
+        return it != sets.end() ? Request(it->second.load) : Request();
+    }
+
+    std::vector<EngineSetStats> EngineSetRouter::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<EngineSetStats> result;
+        result.reserve(sets.size());
+        for (const auto& entry : sets) {
+            EngineSetStats stats;
+            stats.set_id = entry.first;
+            stats.node_ids = entry.second.node_ids;
+            stats.in_flight = entry.second.load->in_flight.load();
+            stats.requests = entry.second.load->requests.load();
+            stats.failures = entry.second.load->failures.load();
+            result.push_back(std::move(stats));
+        }
+        return result;
+    }
+
+    std::shared_ptr<const ConsistentHashRing> EngineSetRouter::GetRing() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return ring;
+    }
+}
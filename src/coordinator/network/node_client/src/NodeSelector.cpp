@@ -0,0 +1,122 @@
+// src/coordinator/network/node_client/src/NodeSelector.cpp
+#include "coordinator/network/node_client/include/NodeSelector.hpp"
+#include <algorithm>
+#include <random>
+
+namespace mpc_engine::coordinator::network
+{
+    namespace
+    {
+        bool Contains(const std::vector<std::string>& list, const std::string& value)
+        {
+            return std::find(list.begin(), list.end(), value) != list.end();
+        }
+
+        bool Contains(const std::vector<PlatformType>& list, PlatformType value)
+        {
+            return std::find(list.begin(), list.end(), value) != list.end();
+        }
+
+        std::mt19937_64& Random()
+        {
+            thread_local std::mt19937_64 engine(std::random_device{}());
+            return engine;
+        }
+    }
+
+    const char* NodeSelectionPolicyToString(NodeSelectionPolicy policy)
+    {
+        switch (policy) {
+            case NodeSelectionPolicy::ORDERED:              return "ordered";
+            case NodeSelectionPolicy::LOWEST_LATENCY:       return "latency";
+            case NodeSelectionPolicy::POWER_OF_TWO_CHOICES: return "p2c";
+            default:                                        return "unknown";
+        }
+    }
+
+    NodeSelectionPolicy NodeSelectionPolicyFromString(const std::string& str)
+    {
+        if (str == "ordered") return NodeSelectionPolicy::ORDERED;
+        if (str == "p2c") return NodeSelectionPolicy::POWER_OF_TWO_CHOICES;
+        return NodeSelectionPolicy::LOWEST_LATENCY;
+    }
+
+    NodeSelector::NodeSelector(NodeSelectionConfig config)
+        : config(std::move(config))
+    {
+    }
+
+    double NodeSelector::Score(const NodeLoadSnapshot& load, uint64_t now_ms) const
+    {
+        // 표본이 없거나 오래됨 → 0 (먼저 시도해서 현재 지연을 측정)
+        if (load.last_sample_ms == 0 ||
+            now_ms - load.last_sample_ms > static_cast<uint64_t>(config.stale_after.count())) {
+            return 0.0;
+        }
+        return static_cast<double>(load.latency_ns) * static_cast<double>(load.in_flight + 1);
+    }
+
+    int NodeSelector::Tier(const NodeCandidate& candidate, uint64_t now_ms) const
+    {
+        if (config.policy != NodeSelectionPolicy::ORDERED && candidate.load.last_degraded_ms != 0 &&
+            now_ms - candidate.load.last_degraded_ms < static_cast<uint64_t>(config.degraded_cooldown.count())) {
+            return 3;
+        }
+        if (Contains(config.avoided_nodes, candidate.node_id) || Contains(config.avoided_platforms, candidate.platform)) {
+            return 2;
+        }
+        if (Contains(config.preferred_nodes, candidate.node_id) || Contains(config.preferred_platforms, candidate.platform)) {
+            return 0;
+        }
+        return 1;
+    }
+
+    std::vector<std::string> NodeSelector::Order(std::vector<NodeCandidate> candidates, uint64_t now_ms) const
+    {
+        struct Ranked
+        {
+            size_t index;
+            int tier;
+            double score;
+        };
+
+        std::vector<Ranked> ranked;
+        ranked.reserve(candidates.size());
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            ranked.push_back(Ranked{ i, Tier(candidates[i], now_ms), Score(candidates[i].load, now_ms) });
+        }
+
+        // 단계 순 (단계 안에서는 후보 순서 유지)
+        std::stable_sort(ranked.begin(), ranked.end(), [](const Ranked& a, const Ranked& b) {
+            return a.tier < b.tier;
+        });
+
+        for (auto first = ranked.begin(); first != ranked.end(); ) {
+            auto last = std::find_if(first, ranked.end(), [first](const Ranked& r) { return r.tier != first->tier; });
+
+            if (config.policy == NodeSelectionPolicy::LOWEST_LATENCY) {
+                std::stable_sort(first, last, [](const Ranked& a, const Ranked& b) { return a.score < b.score; });
+            } else if (config.policy == NodeSelectionPolicy::POWER_OF_TWO_CHOICES) {
+                // 남은 후보 중 무작위 2개를 뽑아 점수 낮은 쪽을 다음 자리에
+                for (auto slot = first; last - slot > 1; ++slot) {
+                    std::uniform_int_distribution<size_t> pick(0, static_cast<size_t>(last - slot) - 1);
+                    size_t a = pick(Random());
+                    size_t b = pick(Random());
+                    while (b == a) {
+                        b = pick(Random());
+                    }
+                    size_t winner = (slot[b].score < slot[a].score) ? b : a;
+                    std::iter_swap(slot, slot + winner);
+                }
+            }
+            first = last;
+        }
+
+        std::vector<std::string> ordered;
+        ordered.reserve(ranked.size());
+        for (const Ranked& r : ranked) {
+            ordered.push_back(std::move(candidates[r.index].node_id));
+        }
+        return ordered;
+    }
+}
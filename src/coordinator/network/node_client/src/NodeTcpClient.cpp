@@ -5,10 +5,13 @@
 #include "common/env/EnvManager.hpp"
 #include "common/resource/include/ReadOnlyResLoaderManager.hpp"
 #include "common/utils/logger/Logger.hpp"
+#include "common/utils/metrics/LatencyHistogram.hpp"
 #include <sys/socket.h>
 #include <arpa/inet.h>
 #include <unistd.h>
 #include <cstring>
+#include <algorithm>
+#include <cmath>
 
 namespace mpc_engine::coordinator::network
 {
@@ -17,6 +20,10 @@ namespace mpc_engine::coordinator::network
     using namespace mpc_engine::resource;
 
     constexpr uint32_t THREAD_JOIN_TIMEOUT_MS = 5000;  // 5초
+    constexpr uint32_t REQUEST_TIMEOUT_MS = 30000;     // 요청당 전체 대기 상한 (재시도 포함)
+    constexpr double LATENCY_DECAY_NS = 1e9;            // peak EWMA 감쇠 시간 상수 (1초 지나면 이전 값 영향 1/e)
+    constexpr size_t LATENCY_P95_MIN_SAMPLES = 20;
+    constexpr size_t LATENCY_P95_REFRESH = 16;
 
     NodeTcpClient::NodeTcpClient(
         const std::string& node_id, 
@@ -38,6 +45,15 @@ namespace mpc_engine::coordinator::network
     }
 
     NodeTcpClient::~NodeTcpClient() {
+        {
+            std::lock_guard<std::mutex> lock(reconnect_wait_mutex);
+            reconnect_stop = true;
+        }
+        reconnect_cv.notify_all();
+        if (reconnect_thread.joinable()) {
+            reconnect_thread.join();
+        }
+
         Disconnect();
     }
 
@@ -56,7 +72,19 @@ namespace mpc_engine::coordinator::network
         }
 
         // Send Queue 초기화
-        send_queue = std::make_unique<utils::ThreadSafeQueue<NetworkMessage>>(100);
+        send_queue = std::make_unique<utils::ThreadSafeQueue<OutboundRequest>>(100);
+
+        if (Config::HasKey("COORDINATOR_NODE_BUSY_RETRIES")) {
+            busy_retry_limit = Config::GetUInt32("COORDINATOR_NODE_BUSY_RETRIES");
+        }
+        if (Config::HasKey("COORDINATOR_NODE_RECONNECT_MIN_MS")) {
+            reconnect_min_backoff_ms = std::max<uint32_t>(1, Config::GetUInt32("COORDINATOR_NODE_RECONNECT_MIN_MS"));
+        }
+        if (Config::HasKey("COORDINATOR_NODE_RECONNECT_MAX_MS")) {
+            reconnect_max_backoff_ms = std::max(reconnect_min_backoff_ms, Config::GetUInt32("COORDINATOR_NODE_RECONNECT_MAX_MS"));
+        }
+
+        reconnect_thread = std::thread(&NodeTcpClient::ReconnectLoop, this);
 
         is_initialized = true;
         LOG_INFOF("NodeTcpClient", "Initialized successfully: %s", connection_info.node_id.c_str());
@@ -119,6 +147,9 @@ namespace mpc_engine::coordinator::network
     }
 
     bool NodeTcpClient::Connect() {
+        // 한 번 연결을 시도한 노드는 끊기면 자동으로 다시 연결
+        auto_reconnect = true;
+
         std::lock_guard<std::mutex> lock(client_mutex);
 
         if (is_connected.load()) {
@@ -155,6 +186,7 @@ namespace mpc_engine::coordinator::network
         last_used_time = utils::GetCurrentTimeMs();
 
         is_connected = true;
+        connection_lost = false;
         threads_running = true;
         
         send_thread = std::thread(&NodeTcpClient::SendLoop, this);
@@ -169,6 +201,12 @@ namespace mpc_engine::coordinator::network
     }
 
     void NodeTcpClient::Disconnect() {
+        // 명시적 해제 - 자동 재연결 중단
+        auto_reconnect = false;
+        DisconnectInternal();
+    }
+
+    void NodeTcpClient::DisconnectInternal() {
         std::string node_id_copy;
         
         {
@@ -182,12 +220,11 @@ namespace mpc_engine::coordinator::network
             is_connected = false;
             threads_running = false;
 
-            if (send_queue) {
-                send_queue->Shutdown();
+            // 블로킹 중인 송수신만 깨우고, TLS 해제는 스레드 join 이후에 수행
+            if (connection_info.node_socket != INVALID_SOCKET_VALUE) {
+                shutdown(connection_info.node_socket, SHUT_RDWR);
             }
 
-            CleanupSocket();
-
             connection_info.status = ConnectionStatus::DISCONNECTED;
         }  // lock 해제
 
@@ -206,19 +243,19 @@ namespace mpc_engine::coordinator::network
             }
         }
 
-        // Pending Requests 정리
         {
-            std::lock_guard<std::mutex> pending_lock(pending_mutex);
-            for (auto& pair : pending_requests) {
-                try {
-                    pair.second.set_exception(
-                        std::make_exception_ptr(std::runtime_error("Connection closed"))
-                    );
-                } catch (...) {}
+            std::lock_guard<std::mutex> lock(client_mutex);
+            CleanupSocket();
+
+            // 재연결 시 이전 연결의 미전송 요청이 흘러가지 않도록 정리
+            if (send_queue) {
+                send_queue->Clear();
             }
-            pending_requests.clear();
         }
 
+        // Pending Requests 정리
+        FailPendingRequests("Connection closed");
+
         // Callback 호출 (lock 밖, 간단히)
         if (disconnected_callback) {
             disconnected_callback(node_id_copy);  // ← 로그용, 간단!
@@ -227,7 +264,7 @@ namespace mpc_engine::coordinator::network
         LOG_INFOF("NodeTcpClient", "Disconnected from %s", node_id_copy.c_str());
     }
 
-    AsyncRequestResult NodeTcpClient::SendRequestAsync(const CoordinatorNodeMessage* request) {
+    AsyncRequestResult NodeTcpClient::SendRequestAsync(const CoordinatorNodeMessage* request, utils::Deadline deadline) {
         if (!request) {
             LOG_ERRORF("NodeTcpClient", "Request is null");
             throw std::invalid_argument("Request is null");
@@ -247,16 +284,15 @@ namespace mpc_engine::coordinator::network
 
         {
             std::lock_guard<std::mutex> lock(pending_mutex);
-            pending_requests[req_id] = std::move(promise);
+            pending_requests[req_id] = PendingRequest{ std::move(promise), utils::MonotonicNowNs() };
         }
 
-        // 3. NetworkMessage 생성
+        // 3. NetworkMessage 생성 (timeout_ms는 송신 스레드가 전송 직전에 채움)
         NetworkMessage msg = ConvertToNetworkMessage(request);
         msg.header.request_id = req_id;
-        msg.header.timestamp = utils::GetCurrentTimeMs();
 
         // 4. Send Queue에 Push
-        utils::QueueResult result = send_queue->TryPush(msg, std::chrono::milliseconds(1000));
+        utils::QueueResult result = send_queue->TryPush(OutboundRequest{ std::move(msg), deadline }, std::chrono::milliseconds(1000));
 
         if (result != utils::QueueResult::SUCCESS) {
             // Push 실패 시 pending에서 제거
@@ -277,43 +313,154 @@ namespace mpc_engine::coordinator::network
         return AsyncRequestResult{req_id, std::move(future)};
     }
 
-    std::unique_ptr<CoordinatorNodeMessage> NodeTcpClient::SendRequest(const CoordinatorNodeMessage* request) {
+    std::unique_ptr<CoordinatorNodeMessage> NodeTcpClient::SendRequest(const CoordinatorNodeMessage* request, utils::Deadline deadline) {
         if (!request) {
             return nullptr;
         }
 
+        deadline = std::min(deadline, std::chrono::steady_clock::now() + std::chrono::milliseconds(REQUEST_TIMEOUT_MS));
+
+        for (uint32_t attempt = 0; ; ++attempt) {
+            std::unique_ptr<CoordinatorNodeMessage> response = SendRequestOnce(request, deadline);
+            if (!response || !response->has_error_response()) {
+                return response;
+            }
+            if (IsRetryableNodeError(*response)) {
+                MarkDegraded();
+            }
+
+            const ErrorResponse& error = response->error_response();
+            LOG_WARNF("NodeTcpClient", "Node %s rejected request: %s (%s, retry_after=%ums)",
+                connection_info.node_id.c_str(), NodeErrorCode_Name(error.code()).c_str(),
+                error.header().error_message().c_str(), error.retry_after_ms());
+
+            // BUSY만 같은 노드에 재시도 - 나머지는 호출자가 다른 노드로 우회
+            if (error.code() != NODE_ERROR_BUSY) {
+                return response;
+            }
+
+            busy_responses++;
+            if (attempt >= busy_retry_limit) {
+                return response;
+            }
+
+            auto retry_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(error.retry_after_ms());
+            if (retry_at >= deadline) {
+                return response;
+            }
+            std::this_thread::sleep_until(retry_at);
+        }
+    }
+
+    bool NodeTcpClient::IsRetryableNodeError(const CoordinatorNodeMessage& response) {
+        if (!response.has_error_response()) {
+            return false;
+        }
+
+        switch (response.error_response().code()) {
+            case NODE_ERROR_BUSY:
+            case NODE_ERROR_SHUTTING_DOWN:
+            case NODE_ERROR_DEADLINE_EXCEEDED:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    uint64_t NodeTcpClient::SendRequestWithCallback(const CoordinatorNodeMessage* request, NodeResponseCallback callback,
+                                                    utils::Deadline deadline)
+    {
+        if (!request || !callback || !IsConnected()) {
+            return 0;
+        }
+
+        uint64_t req_id = next_request_id.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            pending_callbacks[req_id] = PendingCallback{ std::move(callback), nullptr, utils::MonotonicNowNs() };
+        }
+
+        NetworkMessage msg = ConvertToNetworkMessage(request);
+        msg.header.request_id = req_id;
+
+        utils::QueueResult result = send_queue->TryPush(OutboundRequest{ std::move(msg), deadline }, std::chrono::milliseconds(1000));
+        if (result != utils::QueueResult::SUCCESS) {
+            CancelRequest(req_id);
+            LOG_ERRORF("NodeTcpClient", "Failed to push request to queue: %s", utils::QueueResultToString(result));
+            return 0;
+        }
+
+        connection_info.total_requests_sent++;
+        return req_id;
+    }
+
+    uint64_t NodeTcpClient::SendFrameWithCallback(NetworkMessage frame, NodeFrameCallback callback, utils::Deadline deadline)
+    {
+        if (!callback || !IsConnected()) {
+            return 0;
+        }
+
+        uint64_t req_id = next_request_id.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            pending_callbacks[req_id] = PendingCallback{ nullptr, std::move(callback), utils::MonotonicNowNs() };
+        }
+
+        frame.header.request_id = req_id;
+
+        utils::QueueResult result = send_queue->TryPush(OutboundRequest{ std::move(frame), deadline }, std::chrono::milliseconds(1000));
+        if (result != utils::QueueResult::SUCCESS) {
+            CancelRequest(req_id);
+            LOG_ERRORF("NodeTcpClient", "Failed to push frame to queue: %s", utils::QueueResultToString(result));
+            return 0;
+        }
+
+        connection_info.total_requests_sent++;
+        return req_id;
+    }
+
+    void NodeTcpClient::CancelRequest(uint64_t request_id)
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        pending_callbacks.erase(request_id);
+    }
+
+    void NodeTcpClient::AbandonPendingRequest(uint64_t request_id, const char* reason)
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex);
+        auto it = pending_requests.find(request_id);
+        if (it != pending_requests.end()) {
+            try {
+                it->second.promise.set_exception(std::make_exception_ptr(std::runtime_error(reason)));
+            } catch (...) {
+                // promise가 이미 set된 경우 무시
+            }
+            pending_requests.erase(it);
+        }
+    }
+
+    std::unique_ptr<CoordinatorNodeMessage> NodeTcpClient::SendRequestOnce(
+        const CoordinatorNodeMessage* request,
+        std::chrono::steady_clock::time_point deadline) 
+    {
         if (!EnsureConnection()) {
             return nullptr;
         }
 
         try {
             // 비동기 요청 (request_id 포함)
-            AsyncRequestResult result = SendRequestAsync(request);
+            AsyncRequestResult result = SendRequestAsync(request, deadline);
             if (!result.future.valid()) {
                 return nullptr;
             }
 
-            // 타임아웃 30초로 대기
-            if (result.future.wait_for(std::chrono::seconds(30)) == std::future_status::timeout) {
-                LOG_ERRORF("NodeTcpClient", "Request timeout (30s) for node: %s, request_id: %lu", 
+            // 남은 시간만큼 대기 (연결이 끊기면 promise가 즉시 실패함)
+            if (result.future.wait_until(deadline) == std::future_status::timeout) {
+                LOG_ERRORF("NodeTcpClient", "Request timeout for node: %s, request_id: %lu", 
                     connection_info.node_id.c_str(), result.request_id);
 
                 // ✅ pending에서 제거
-                {
-                    std::lock_guard<std::mutex> lock(pending_mutex);
-                    auto it = pending_requests.find(result.request_id);
-                    if (it != pending_requests.end()) {
-                        try {
-                            it->second.set_exception(
-                                std::make_exception_ptr(std::runtime_error("Request timeout"))
-                            );
-                        } catch (...) {
-                            // promise가 이미 set된 경우 무시
-                        }
-                        pending_requests.erase(it);
-                    }
-                }
-
+                AbandonPendingRequest(result.request_id, "Request timeout");
                 return nullptr;
             }
 
@@ -344,14 +491,21 @@ namespace mpc_engine::coordinator::network
             return false;
         }
 
-        // TLS로 바디 전송 (있는 경우)
-        if (message.header.body_length > 0) {
-            error = tls_connection->WriteExact(message.body.data(), message.header.body_length);
+        // TLS로 바디 전송 (있는 경우) - 공유 segment는 복사 없이 이어서 전송
+        if (!message.body.empty()) {
+            error = tls_connection->WriteExact(message.body.data(), message.body.size());
             if (error != TlsError::NONE) {
                 NotifyError(NetworkError::SEND_ERROR, "Failed to send body");
                 return false;
             }
         }
+        for (const auto& segment : message.segments) {
+            error = tls_connection->WriteExact(segment->data(), segment->size());
+            if (error != TlsError::NONE) {
+                NotifyError(NetworkError::SEND_ERROR, "Failed to send body segment");
+                return false;
+            }
+        }
 
         connection_info.last_successful_communication = utils::GetCurrentTimeMs();
         return true;
@@ -467,6 +621,7 @@ namespace mpc_engine::coordinator::network
 
         int opt = 1;
         setsockopt(connection_info.node_socket, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+        utils::SetSocketNoDelay(connection_info.node_socket);     // 작은 요청이 delayed ACK(~40ms)에 묶이지 않도록
         utils::SetSocketRecvTimeout(connection_info.node_socket, connection_info.connection_timeout_ms);
         utils::SetSocketSendTimeout(connection_info.node_socket, connection_info.connection_timeout_ms);
 
@@ -507,13 +662,23 @@ namespace mpc_engine::coordinator::network
     }
 
     bool NodeTcpClient::IsConnected() const {
-        return is_connected.load();
+        return is_connected.load() && !connection_lost.load();
     }
 
     bool NodeTcpClient::EnsureConnection() {
         if (IsConnected()) {
             return true;
         }
+
+        std::lock_guard<std::mutex> lock(reconnect_mutex);
+        if (IsConnected()) {
+            return true;
+        }
+
+        // 끊긴 연결의 스레드/소켓 정리 후 새 연결
+        if (is_connected.load()) {
+            DisconnectInternal();
+        }
         return Connect();
     }
 
@@ -521,10 +686,14 @@ namespace mpc_engine::coordinator::network
         LOG_DEBUGF("NodeTcpClient", "SendLoop started for %s", connection_info.node_id.c_str());
         
         while (threads_running.load()) {
-            NetworkMessage msg;
+            OutboundRequest outbound;
 
-            // Send Queue에서 Pop
-            utils::QueueResult result = send_queue->Pop(msg);
+            // Send Queue에서 Pop (연결 종료 감지를 위해 타임아웃 사용)
+            utils::QueueResult result = send_queue->TryPop(outbound, std::chrono::milliseconds(100));
+
+            if (result == utils::QueueResult::TIMEOUT) {
+                continue;
+            }
 
             if (result == utils::QueueResult::SHUTDOWN) {
                 LOG_DEBUGF("NodeTcpClient", "SendLoop stopped for %s: Queue shutdown", connection_info.node_id.c_str());
@@ -536,6 +705,15 @@ namespace mpc_engine::coordinator::network
                 break;
             }
 
+            // 기한이 지난 요청은 노드를 쓰지 않고 즉시 실패, 나머지는 남은 기한을 실어 전송
+            NetworkMessage& msg = outbound.message;
+            auto now = std::chrono::steady_clock::now();
+            if (now >= outbound.deadline) {
+                ExpireQueuedRequest(msg);
+                continue;
+            }
+            msg.header.timeout_ms = utils::RemainingBudgetMs(outbound.deadline, now);
+
             // 메시지 전송
             if (!SendMessage(msg)) {
                 LOG_ERRORF("NodeTcpClient", "SendLoop SendMessage failed");
@@ -546,7 +724,7 @@ namespace mpc_engine::coordinator::network
                 auto it = pending_requests.find(req_id);
                 if (it != pending_requests.end()) {
                     try {
-                        it->second.set_exception(
+                        it->second.promise.set_exception(
                             std::make_exception_ptr(std::runtime_error("Send failed"))
                         );
                     } catch (...) {}
@@ -570,26 +748,68 @@ namespace mpc_engine::coordinator::network
 
             // 응답 수신
             if (!ReceiveMessage(response)) {
-                LOG_ERRORF("NodeTcpClient", "ReceiveLoop ReceiveMessage failed");
+                if (threads_running.load()) {
+                    LOG_ERRORF("NodeTcpClient", "ReceiveLoop ReceiveMessage failed");
+
+                    // 대기 중인 요청은 타임아웃까지 기다리지 않고 즉시 실패 → 호출자가 바로 재시도/우회
+                    connection_lost = true;
+                    FailPendingRequests("Connection lost");
+
+                    // 재연결 스레드 깨우기
+                    {
+                        std::lock_guard<std::mutex> lock(reconnect_wait_mutex);
+                    }
+                    reconnect_cv.notify_all();
+                }
                 break;
             }
 
             uint64_t req_id = response.header.request_id;
 
-            // request_id로 대응하는 Promise 찾기
-            std::lock_guard<std::mutex> lock(pending_mutex);
-            auto it = pending_requests.find(req_id);
+            // request_id로 대응하는 Promise / 완료 콜백 찾기
+            NodeResponseCallback callback;
+            NodeFrameCallback frame_callback;
+            {
+                std::lock_guard<std::mutex> lock(pending_mutex);
+                auto it = pending_requests.find(req_id);
+
+                if (it != pending_requests.end()) {
+                    // Promise 완료
+                    RecordLatencyLocked(it->second.sent_ns, utils::MonotonicNowNs());
+                    try {
+                        it->second.promise.set_value(std::move(response));
+                    } catch (const std::exception& e) {
+                        LOG_ERRORF("NodeTcpClient", "ReceiveLoop set_value failed: %s", e.what());
+                    }
+                    pending_requests.erase(it);
+                } else if (auto cb = pending_callbacks.find(req_id); cb != pending_callbacks.end()) {
+                    RecordLatencyLocked(cb->second.sent_ns, utils::MonotonicNowNs());
+                    callback = std::move(cb->second.callback);
+                    frame_callback = std::move(cb->second.frame_callback);
+                    pending_callbacks.erase(cb);
+                } else {
+                    // 타임아웃/취소(quorum 달성 후 stragglers)로 이미 포기한 요청의 늦은 응답
+                    LOG_DEBUGF("NodeTcpClient", "ReceiveLoop No pending request for ID: %llu (abandoned)", req_id);
+                }
+            }
 
-            if (it != pending_requests.end()) {
-                // Promise 완료
+            // 콜백은 lock 밖에서 실행 (콜백 안에서 새 요청/취소 가능)
+            if (frame_callback) {
                 try {
-                    it->second.set_value(std::move(response));
+                    frame_callback(std::make_unique<NetworkMessage>(std::move(response)));
                 } catch (const std::exception& e) {
-                    LOG_ERRORF("NodeTcpClient", "ReceiveLoop set_value failed: %s", e.what());
+                    LOG_ERRORF("NodeTcpClient", "ReceiveLoop frame callback threw: %s", e.what());
+                }
+            } else if (callback) {
+                try {
+                    std::unique_ptr<CoordinatorNodeMessage> message = ConvertFromNetworkMessage(response);
+                    if (message && IsRetryableNodeError(*message)) {
+                        MarkDegraded();
+                    }
+                    callback(std::move(message));
+                } catch (const std::exception& e) {
+                    LOG_ERRORF("NodeTcpClient", "ReceiveLoop response callback threw: %s", e.what());
                 }
-                pending_requests.erase(it);
-            } else {
-                LOG_ERRORF("NodeTcpClient", "ReceiveLoop No pending request for ID: %llu", req_id);
             }
 
             connection_info.successful_responses++;
@@ -599,6 +819,158 @@ namespace mpc_engine::coordinator::network
         LOG_DEBUGF("NodeTcpClient", "ReceiveLoop stopped for %s", connection_info.node_id.c_str());
     }
 
+    /**
+    * @brief 연결 끊김 감지 시 backoff로 재연결
+    * 
+    * 노드 재시작(핸드오프) 후 새 프로세스가 같은 포트에서 바로 accept하므로
+    * 첫 시도(min backoff)에 대부분 재연결됩니다.
+    */
+    void NodeTcpClient::ReconnectLoop() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(reconnect_wait_mutex);
+                reconnect_cv.wait(lock, [this]() {
+                    return reconnect_stop.load() || (connection_lost.load() && auto_reconnect.load());
+                });
+            }
+            if (reconnect_stop.load()) {
+                break;
+            }
+
+            uint32_t backoff_ms = reconnect_min_backoff_ms;
+            while (!reconnect_stop.load() && auto_reconnect.load() && !IsConnected()) {
+                {
+                    std::unique_lock<std::mutex> lock(reconnect_wait_mutex);
+                    reconnect_cv.wait_for(lock, std::chrono::milliseconds(backoff_ms), [this]() {
+                        return reconnect_stop.load();
+                    });
+                }
+                if (reconnect_stop.load() || !auto_reconnect.load()) {
+                    break;
+                }
+
+                if (EnsureConnection()) {
+                    reconnect_count++;
+                    LOG_INFOF("NodeTcpClient", "Reconnected to %s", connection_info.node_id.c_str());
+                    break;
+                }
+                backoff_ms = std::min(backoff_ms * 2, reconnect_max_backoff_ms);
+            }
+        }
+    }
+
+    void NodeTcpClient::ExpireQueuedRequest(const NetworkMessage& message) {
+        expired_in_queue++;
+        LOG_DEBUGF("NodeTcpClient", "Request %llu to %s expired in send queue", 
+            (unsigned long long)message.header.request_id, connection_info.node_id.c_str());
+
+        CoordinatorNodeMessage error;
+        error.set_message_type(message.header.message_type);
+        error.mutable_error_response()->set_code(NODE_ERROR_DEADLINE_EXCEEDED);
+        error.mutable_error_response()->mutable_header()->set_request_id(message.header.request_id);
+        error.mutable_error_response()->mutable_header()->set_error_message("Deadline exceeded before send");
+        NetworkMessage response = ConvertToNetworkMessage(&error);
+        response.header.request_id = message.header.request_id;
+
+        // 노드 응답과 같은 경로로 완료 (지연 표본은 남기지 않음)
+        NodeResponseCallback callback;
+        NodeFrameCallback frame_callback;
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            if (auto it = pending_requests.find(message.header.request_id); it != pending_requests.end()) {
+                try {
+                    it->second.promise.set_value(std::move(response));
+                } catch (...) {}
+                pending_requests.erase(it);
+                return;
+            }
+            auto cb = pending_callbacks.find(message.header.request_id);
+            if (cb == pending_callbacks.end()) {
+                return;     // 이미 취소됨
+            }
+            callback = std::move(cb->second.callback);
+            frame_callback = std::move(cb->second.frame_callback);
+            pending_callbacks.erase(cb);
+        }
+
+        try {
+            if (frame_callback) {
+                frame_callback(std::make_unique<NetworkMessage>(std::move(response)));
+            } else if (callback) {
+                callback(std::make_unique<CoordinatorNodeMessage>(std::move(error)));
+            }
+        } catch (const std::exception& e) {
+            LOG_ERRORF("NodeTcpClient", "Expired request callback threw: %s", e.what());
+        }
+    }
+
+    void NodeTcpClient::FailPendingRequests(const char* reason) {
+        std::unordered_map<uint64_t, PendingCallback> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            for (auto& pair : pending_requests) {
+                try {
+                    pair.second.promise.set_exception(
+                        std::make_exception_ptr(std::runtime_error(reason))
+                    );
+                } catch (...) {}
+            }
+            pending_requests.clear();
+            callbacks.swap(pending_callbacks);
+        }
+
+        // 콜백 요청은 nullptr 응답으로 즉시 실패 통보
+        for (auto& pair : callbacks) {
+            try {
+                if (pair.second.frame_callback) {
+                    pair.second.frame_callback(nullptr);
+                } else {
+                    pair.second.callback(nullptr);
+                }
+            } catch (...) {}
+        }
+    }
+
+    void NodeTcpClient::RecordLatencyLocked(uint64_t sent_ns, uint64_t now_ns) {
+        double sample = static_cast<double>(now_ns - sent_ns);
+
+        // 더 느린 표본은 즉시 반영 (peak), 빠른 표본은 지난 시간만큼 감쇠 - 한동안 안 쓴 노드는 표본 하나로 갱신됨
+        if (latency_sampled_ns == 0 || sample > latency_cost_ns) {
+            latency_cost_ns = sample;
+        } else {
+            double weight = std::exp(-static_cast<double>(now_ns - latency_sampled_ns) / LATENCY_DECAY_NS);
+            latency_cost_ns = latency_cost_ns * weight + sample * (1.0 - weight);
+        }
+        latency_sampled_ns = now_ns;
+        last_latency_sample_ms = utils::GetCurrentTimeMs();
+
+        latency_window[latency_window_count % LATENCY_WINDOW] = now_ns - sent_ns;
+        latency_window_count++;
+        if (latency_window_count >= LATENCY_P95_MIN_SAMPLES && latency_window_count % LATENCY_P95_REFRESH == 0) {
+            size_t samples = std::min(latency_window_count, LATENCY_WINDOW);
+            std::array<uint64_t, LATENCY_WINDOW> sorted = latency_window;
+            auto p95 = sorted.begin() + (samples * 95) / 100;
+            std::nth_element(sorted.begin(), p95, sorted.begin() + samples);
+            latency_p95_ns.store(*p95, std::memory_order_relaxed);
+        }
+    }
+
+    void NodeTcpClient::MarkDegraded() {
+        last_degraded_ms = utils::GetCurrentTimeMs();
+    }
+
+    NodeLoadSnapshot NodeTcpClient::GetLoadSnapshot() const {
+        NodeLoadSnapshot snapshot;
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            snapshot.latency_ns = static_cast<uint64_t>(latency_cost_ns);
+            snapshot.in_flight = pending_requests.size() + pending_callbacks.size();
+        }
+        snapshot.last_sample_ms = last_latency_sample_ms.load();
+        snapshot.last_degraded_ms = last_degraded_ms.load();
+        return snapshot;
+    }
+
     void NodeTcpClient::NotifyError(NetworkError error, const std::string& message) {
         if (error_callback) {
             error_callback(connection_info.node_id, error, message);
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "coordinator/network/wallet_server/include/HttpsSession.hpp"
+#include "coordinator/network/wallet_server/include/WalletAdmissionController.hpp"
 #include "common/utils/threading/ThreadPool.hpp"
 #include <boost/asio.hpp>
 #include <boost/asio/ssl.hpp>
@@ -9,6 +10,7 @@
 #include <memory>
 #include <thread>
 #include <atomic>
+#include <chrono>
 
 namespace mpc_engine::coordinator::network::wallet_server
 {
@@ -32,6 +34,9 @@ namespace mpc_engine::coordinator::network::wallet_server
         
         std::string tls_cert_path;
         std::string tls_key_id;  // KMS Key ID
+
+        // tenant별 rate limit / 동시 요청 상한 / 공정 디스패치 가중치
+        WalletAdmissionConfig admission;
     };
 
     /**
@@ -74,6 +79,24 @@ namespace mpc_engine::coordinator::network::wallet_server
         bool IsRunning() const { return running_.load(); }
         bool IsInitialized() const { return initialized_.load(); }
 
+        /**
+         * @brief drain 시작 - 새 연결 수락 중지, /health 503, 새 요청 503 (받아 둔 요청은 계속 처리)
+         */
+        void BeginDrain();
+        bool IsDraining() const { return draining_.load(); }
+
+        /**
+         * @brief 받아 둔 요청의 응답을 모두 쓸 때까지 대기 (BeginDrain 후)
+         * @return timeout 후에도 쓰지 못한 응답 수
+         */
+        size_t WaitForPendingResponses(std::chrono::milliseconds timeout);
+
+        /**
+         * @brief tenant 한도 교체 (운영 중 reload) - 이후 요청부터 적용
+         */
+        void SetAdmissionConfig(const WalletAdmissionConfig& admission);
+        std::vector<TenantAdmissionStats> GetAdmissionStats() const;
+
     private:
         /**
          * @brief 비동기 Accept
@@ -108,11 +131,14 @@ namespace mpc_engine::coordinator::network::wallet_server
         
         // 비지니스 로직 처리
         std::unique_ptr<ThreadPool<WalletHandlerContext>> handler_pool_;
+        std::unique_ptr<WalletAdmissionController> admission_;     // handler pool 앞단 (tenant 대기열)
         
         // Singleton Router 참조는 Initialize에서 체크만 함
         
         std::atomic<bool> running_{false};
         std::atomic<bool> initialized_{false};
+        std::atomic<bool> draining_{false};
+        std::atomic<size_t> pending_responses_{0};     // 모든 세션의 아직 쓰지 못한 응답
     };
 
 } // namespace mpc_engine::coordinator::network::wallet_server
\ No newline at end of file
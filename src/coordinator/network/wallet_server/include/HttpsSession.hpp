@@ -3,6 +3,8 @@
 
 #include "proto/wallet_coordinator/generated/wallet_message.pb.h"
 #include "common/utils/threading/ThreadPool.hpp"
+#include "coordinator/network/wallet_server/include/WalletAdmissionController.hpp"
+#include "common/utils/time/Deadline.hpp"
 #include <boost/asio.hpp>
 #include <boost/asio/ssl.hpp>
 #include <boost/beast/core.hpp>
@@ -39,6 +41,7 @@ namespace mpc_engine::coordinator::network::wallet_server
         int status_code = 200;
         std::string status_text = "OK";
         std::unique_ptr<WalletCoordinatorMessage> protobuf_message;
+        std::chrono::seconds retry_after{0};        // 0이 아니면 Retry-After 헤더 (429 / 503)
 
         HttpResponse() = default;
         HttpResponse(HttpResponse&&) = default;
@@ -55,6 +58,9 @@ namespace mpc_engine::coordinator::network::wallet_server
     {
         std::unique_ptr<WalletCoordinatorMessage> request;
         std::shared_ptr<std::promise<HttpResponse>> promise;
+        std::string tenant_id;
+        WalletAdmissionController* admission = nullptr;     // 처리 후 Complete (다음 요청 디스패치)
+        Deadline deadline = NO_DEADLINE;                    // 요청 도착 시각 + 클라이언트 budget (admission 대기 포함)
 
         WalletHandlerContext(
             std::unique_ptr<WalletCoordinatorMessage> req,
@@ -69,6 +75,10 @@ namespace mpc_engine::coordinator::network::wallet_server
      * - 비동기 Read/Write
      * - HTTP 순서 보장 (pending_queue)
      * - Keep-Alive 지원
+     * - GET /health: 200, 서버 drain 중이면 503
+     * - 서버 drain 중: 새 요청은 503 (Retry-After), 남은 응답을 모두 쓰면 연결 종료
+     * - 요청 budget (X-Request-Timeout-Ms / 요청 header.timeout_ms): handler 시작 전에 지났으면 504,
+     *   아니면 남은 budget을 요청 header.timeout_ms에 다시 써서 backend → Node까지 전달
      */
     class HttpsSession : public std::enable_shared_from_this<HttpsSession> 
     {
@@ -77,9 +87,12 @@ namespace mpc_engine::coordinator::network::wallet_server
             tcp::socket socket,
             ssl::context& ssl_context,
             ThreadPool<WalletHandlerContext>& thread_pool,
+            WalletAdmissionController& admission,
             mpc_engine::coordinator::handlers::wallet::WalletMessageRouter& router,
             int max_requests,
-            std::chrono::seconds timeout
+            std::chrono::seconds timeout,
+            const std::atomic<bool>& draining,
+            std::atomic<size_t>& pending_responses
         );
 
         ~HttpsSession();
@@ -100,6 +113,11 @@ namespace mpc_engine::coordinator::network::wallet_server
          */
         void DoTlsHandshake();
 
+        /**
+         * @brief mTLS로 검증된 client 인증서의 CN (없으면 빈 문자열)
+         */
+        std::string ReadClientIdentity();
+
         /**
          * @brief 비동기 Read (여러 요청 동시 수신)
          */
@@ -125,6 +143,16 @@ namespace mpc_engine::coordinator::network::wallet_server
          */
         void DoClose();
 
+        /**
+         * @brief 바로 보낼 응답을 순서 큐에 추가 (health check / drain 거부)
+         */
+        void QueueReadyResponse(HttpResponse response);
+
+        /**
+         * @brief 응답 1개 전송 완료/폐기 (서버 pending 응답 수 감소)
+         */
+        void OnResponseDone();
+
         /**
          * @brief Keep-Alive 판단
          */
@@ -135,6 +163,17 @@ namespace mpc_engine::coordinator::network::wallet_server
          */
         void UpdateActivity();
 
+        /**
+         * @brief admission / dedup 단위 - 인증된 identity만 (등록된 X-Api-Key > 등록된 client 인증서 CN > "default")
+         * X-Tenant-Id 헤더 / 요청 body의 tenant_id는 클라이언트가 정하는 값이라 쓰지 않음
+         */
+        std::string ResolveTenant() const;
+
+        /**
+         * @brief 요청 처리 budget (ms, 0 = 기한 없음) - X-Request-Timeout-Ms 헤더와 요청 header.timeout_ms 중 짧은 쪽
+         */
+        uint64_t ResolveTimeoutMs(const WalletCoordinatorMessage& message) const;
+
         /**
          * @brief 요청 처리 (ThreadPool에서 실행)
          */
@@ -145,6 +184,7 @@ namespace mpc_engine::coordinator::network::wallet_server
         beast::ssl_stream<beast::tcp_stream> stream_;
         beast::flat_buffer buffer_;
         http::request<http::string_body> request_;
+        std::string client_identity_;       // 핸드셰이크 후 client 인증서 CN
 
         // 순서 보장용 Queue
         std::queue<std::future<HttpResponse>> pending_queue_;
@@ -153,6 +193,7 @@ namespace mpc_engine::coordinator::network::wallet_server
 
         // 외부 의존성 (참조)
         ThreadPool<WalletHandlerContext>& thread_pool_;
+        WalletAdmissionController& admission_;
         mpc_engine::coordinator::handlers::wallet::WalletMessageRouter& router_;
 
         // Keep-Alive 관리
@@ -161,6 +202,10 @@ namespace mpc_engine::coordinator::network::wallet_server
         std::chrono::steady_clock::time_point last_activity_;
         std::chrono::seconds timeout_;
 
+        // 서버 drain 상태 / 서버 전체의 아직 쓰지 못한 응답 수 (참조)
+        const std::atomic<bool>& draining_;
+        std::atomic<size_t>& pending_responses_;
+
         std::atomic<bool> active_{false};
     };
 
@@ -0,0 +1,157 @@
+// src/coordinator/network/wallet_server/include/WalletAdmissionController.hpp
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mpc_engine::coordinator::network::wallet_server
+{
+    /**
+     * @brief tenant(또는 API key)별 한도
+     */
+    struct TenantLimit
+    {
+        double requests_per_second = 0.0;   // token bucket 속도 (0 = 제한 없음)
+        double burst = 0.0;                 // bucket 크기 (0 = 1초 분량, 최소 1)
+        size_t max_concurrent = 0;          // 대기 + 처리 중 요청 상한 (0 = 제한 없음)
+        uint32_t weight = 1;                // DRR quantum - 다른 tenant와 경쟁할 때 라운드당 디스패치 수
+    };
+
+    // 인증된 identity가 없거나 등록되지 않은 요청이 함께 쓰는 tenant
+    inline constexpr const char* DEFAULT_TENANT = "default";
+
+    struct WalletAdmissionConfig
+    {
+        TenantLimit default_limit;                      // tenants에 없는 tenant
+        std::map<std::string, TenantLimit> tenants;
+        std::map<std::string, std::string> api_keys;    // X-Api-Key → tenant
+        size_t max_queued = 10000;                      // 전체 대기 요청 상한 (0 = 제한 없음)
+
+        const TenantLimit& LimitFor(const std::string& tenant_id) const;
+
+        /**
+        * @brief 인증된 identity → tenant (admission / 요청 dedup 범위)
+        * 등록된 API key > tenants에 등록된 client 인증서 CN > DEFAULT_TENANT
+        * 클라이언트가 보낸 tenant id는 쓰지 않음 - 모르는 key / CN은 모두 DEFAULT_TENANT 하나로 모임
+        */
+        std::string ResolveTenant(const std::string& api_key, const std::string& client_identity) const;
+    };
+
+    /**
+     * @brief tenant 한도 파일 읽기 (운영 중 reload용) - 한 줄에 tenant 하나, '*'는 기본 한도
+     *   <tenant|*> [rps=<n>] [burst=<n>] [concurrency=<n>] [weight=<n>] [key=<api key>...]   # 주석
+     * 생략한 필드는 config의 기존 값 유지, API key 목록은 파일 내용으로 교체 (파일에서 지우면 폐기)
+     * @return 파일을 못 읽거나 형식 오류면 false (config는 일부만 바뀌었을 수 있음 - 복사본에 읽을 것)
+     */
+    bool LoadWalletAdmissionLimits(const std::string& path, WalletAdmissionConfig* config, std::string* error);
+
+    enum class AdmissionStatus
+    {
+        ADMITTED,
+        RATE_LIMITED,           // tenant token bucket 소진
+        CONCURRENCY_LIMITED,    // tenant 대기 + 처리 중 요청이 max_concurrent
+        OVERLOADED              // 전체 대기열 가득 참 / 종료 중
+    };
+
+    const char* AdmissionStatusToString(AdmissionStatus status);
+
+    struct AdmissionDecision
+    {
+        AdmissionStatus status = AdmissionStatus::ADMITTED;
+        std::chrono::seconds retry_after{0};        // 거절 시 Retry-After
+
+        bool Admitted() const { return status == AdmissionStatus::ADMITTED; }
+    };
+
+    struct TenantAdmissionStats
+    {
+        std::string tenant_id;
+        size_t queued = 0;
+        size_t running = 0;
+        uint64_t admitted = 0;
+        uint64_t rejected = 0;
+    };
+
+    /**
+     * @brief Wallet 요청 admission control + tenant 간 공정 디스패치
+     *
+     * - Submit: tenant token bucket / 동시 요청 상한 / 전체 대기열 상한 검사 후 tenant 대기열에 추가
+     *   (거절 시 Retry-After 계산 - HTTPS 세션이 429로 응답)
+     * - handler pool에는 dispatch_slots개(handler thread 수)까지만 넘기고, 나머지는 tenant별 대기열에서
+     *   deficit round robin (weight = quantum) 순으로 디스패치 - 한 tenant가 몰려도 다른 tenant는 자기 차례를 받음
+     * - 디스패치된 작업은 끝날 때 Complete를 호출해야 다음 요청이 나감
+     * - SetConfig로 운영 중 한도 교체 (진행 중 요청은 그대로, bucket은 새 burst로 잘림)
+     */
+    class WalletAdmissionController
+    {
+    public:
+        using Work = std::function<void()>;
+
+        WalletAdmissionController(size_t dispatch_slots, WalletAdmissionConfig config);
+
+        WalletAdmissionController(const WalletAdmissionController&) = delete;
+        WalletAdmissionController& operator=(const WalletAdmissionController&) = delete;
+
+        /**
+        * @brief 요청 admission - 허용되면 work는 차례가 오면 실행 (호출 스레드 또는 Complete 호출 스레드)
+        * work는 handler pool 제출처럼 바로 반환해야 함
+        */
+        AdmissionDecision Submit(const std::string& tenant_id, Work work);
+
+        // 디스패치된 요청 1건 완료
+        void Complete(const std::string& tenant_id);
+
+        void SetConfig(WalletAdmissionConfig config);
+        WalletAdmissionConfig GetConfig() const;
+
+        // 현재 설정으로 WalletAdmissionConfig::ResolveTenant
+        std::string ResolveTenant(const std::string& api_key, const std::string& client_identity) const;
+
+        // 대기 중 요청 폐기 + 이후 Submit 거절
+        void Shutdown();
+
+        std::vector<TenantAdmissionStats> GetStats() const;
+        size_t GetQueuedCount() const;
+
+    private:
+        struct TenantState
+        {
+            double tokens = 0.0;
+            std::chrono::steady_clock::time_point last_refill;
+            std::deque<Work> queue;
+            size_t running = 0;
+            double deficit = 0.0;
+            bool active = false;            // DRR active 목록에 있음
+            uint64_t admitted = 0;
+            uint64_t rejected = 0;
+        };
+
+        const size_t dispatch_slots;
+
+        mutable std::mutex mutex;
+        WalletAdmissionConfig config;
+        std::map<std::string, TenantState> tenants;
+        std::deque<std::string> active;         // 대기 요청이 있는 tenant (DRR 순서)
+        size_t dispatched = 0;                  // handler pool에 넘긴 요청 수
+        size_t queued = 0;
+        uint64_t submits_since_sweep = 0;
+        bool stopped = false;
+
+        // mutex 보유 상태에서 호출
+        void RefillLocked(TenantState& state, const TenantLimit& limit, std::chrono::steady_clock::time_point now) const;
+        std::vector<std::pair<std::string, Work>> TakeDispatchableLocked();
+        std::vector<std::pair<std::string, Work>> CompleteLocked(const std::string& tenant_id);
+        void SweepIdleLocked(std::chrono::steady_clock::time_point now);
+
+        // lock 밖에서 실행 - 실행 실패(handler pool 종료 등)는 바로 Complete
+        void Run(std::vector<std::pair<std::string, Work>> works);
+    };
+
+} // namespace mpc_engine::coordinator::network::wallet_server
@@ -162,7 +162,10 @@ namespace mpc_engine::coordinator::network::wallet_server
         }
         io_threads_.clear();
     
-        // ThreadPool 종료
+        // 대기 중인 tenant 요청 폐기 후 ThreadPool 종료
+        if (admission_) {
+            admission_->Shutdown();
+        }
         if (handler_pool_) {
             handler_pool_->Shutdown();
         }
@@ -170,6 +173,33 @@ namespace mpc_engine::coordinator::network::wallet_server
         LOG_INFO("CoordinatorHttpsServer", "Stopped");
     }
 
+    void CoordinatorHttpsServer::BeginDrain() 
+    {
+        if (!running_.load() || draining_.exchange(true)) {
+            return;
+        }
+
+        LOG_INFO("CoordinatorHttpsServer", "Draining - no longer accepting connections");
+
+        // acceptor는 I/O 스레드에서만 조작 (대기 중인 async_accept 취소)
+        asio::post(io_context_, [this]() {
+            boost::system::error_code ec;
+            if (acceptor_ && acceptor_->is_open()) {
+                // NOLINTNEXTLINE(bugprone-unused-return-value)
+                acceptor_->close(ec);
+            }
+        });
+    }
+
+    size_t CoordinatorHttpsServer::WaitForPendingResponses(std::chrono::milliseconds timeout) 
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (pending_responses_.load() > 0 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return pending_responses_.load();
+    }
+
     void CoordinatorHttpsServer::DoAccept() 
     {
         if (!running_.load()) {
@@ -188,17 +218,20 @@ namespace mpc_engine::coordinator::network::wallet_server
                         std::move(socket),
                         *ssl_context_,
                         *handler_pool_,
+                        *admission_,
                         WalletMessageRouter::Instance(),
                         config_.max_requests_per_connection,
-                        std::chrono::seconds(config_.keep_alive_timeout_sec)
+                        std::chrono::seconds(config_.keep_alive_timeout_sec),
+                        draining_,
+                        pending_responses_
                     );
                     session->Start();
-                } else {
+                } else if (!draining_.load()) {
                     LOG_ERRORF("CoordinatorHttpsServer", "Accept error: %s", ec.message().c_str());
                 }
 
-                // 다음 연결 수락 대기
-                if (running_.load()) {
+                // 다음 연결 수락 대기 (drain 중이면 acceptor가 닫힘)
+                if (running_.load() && !draining_.load()) {
                     DoAccept();
                 }
             }
@@ -298,6 +331,8 @@ namespace mpc_engine::coordinator::network::wallet_server
             handler_pool_ = std::make_unique<ThreadPool<WalletHandlerContext>>(
                 config_.handler_threads
             );
+            // handler thread 수만큼만 pool에 넘김 - 나머지는 tenant 대기열에서 공정하게 대기
+            admission_ = std::make_unique<WalletAdmissionController>(config_.handler_threads, config_.admission);
             LOG_INFO("CoordinatorHttpsServer", "ThreadPool created successfully");
             return true;
         } catch (const std::exception& e) {
@@ -306,6 +341,19 @@ namespace mpc_engine::coordinator::network::wallet_server
         }
     }
 
+    void CoordinatorHttpsServer::SetAdmissionConfig(const WalletAdmissionConfig& admission) 
+    {
+        config_.admission = admission;
+        if (admission_) {
+            admission_->SetConfig(admission);
+        }
+    }
+
+    std::vector<TenantAdmissionStats> CoordinatorHttpsServer::GetAdmissionStats() const 
+    {
+        return admission_ ? admission_->GetStats() : std::vector<TenantAdmissionStats>();
+    }
+
     bool CoordinatorHttpsServer::InitializeRouter() 
     {
         LOG_INFO("CoordinatorHttpsServer", "Initializing WalletMessageRouter...");
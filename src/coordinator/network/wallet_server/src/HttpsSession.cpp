@@ -2,25 +2,50 @@
 #include "coordinator/network/wallet_server/include/HttpsSession.hpp"
 #include "coordinator/handlers/wallet/include/WalletMessageRouter.hpp"
 #include "common/utils/logger/Logger.hpp"
+#include <openssl/x509.h>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
 
 namespace mpc_engine::coordinator::network::wallet_server
 {
     using namespace mpc_engine::coordinator::handlers::wallet;
     using std::chrono::steady_clock;
 
+    namespace
+    {
+        // budget을 전달하는 요청 header (budget이 없는 요청 종류는 nullptr)
+        WalletRequestHeader* MutableRequestHeader(WalletCoordinatorMessage& message)
+        {
+            if (message.has_signing_request()) {
+                return message.mutable_signing_request()->mutable_header();
+            }
+            if (message.has_key_create_request()) {
+                return message.mutable_key_create_request()->mutable_header();
+            }
+            return nullptr;
+        }
+    }
+
     HttpsSession::HttpsSession(
         tcp::socket socket,
         ssl::context& ssl_context,
         ThreadPool<WalletHandlerContext>& thread_pool,
+        WalletAdmissionController& admission,
         WalletMessageRouter& router,
         int max_requests,
-        std::chrono::seconds timeout
+        std::chrono::seconds timeout,
+        const std::atomic<bool>& draining,
+        std::atomic<size_t>& pending_responses
     )
         : stream_(std::move(socket), ssl_context)
         , thread_pool_(thread_pool)
+        , admission_(admission)
         , router_(router)
         , max_requests_(max_requests)
         , timeout_(timeout)
+        , draining_(draining)
+        , pending_responses_(pending_responses)
     {
         last_activity_ = steady_clock::now();
     }
@@ -28,6 +53,9 @@ namespace mpc_engine::coordinator::network::wallet_server
     HttpsSession::~HttpsSession() 
     {
         Stop();
+
+        // 연결이 먼저 끊겨 쓰지 못한 응답
+        pending_responses_ -= pending_queue_.size();
     }
 
     void HttpsSession::Start() 
@@ -75,7 +103,8 @@ namespace mpc_engine::coordinator::network::wallet_server
             ssl::stream_base::server,
             [self](beast::error_code ec) {
                 if (!ec) {
-                    LOG_INFO("HttpsSession", "TLS handshake success");
+                    self->client_identity_ = self->ReadClientIdentity();
+                    LOG_INFOF("HttpsSession", "TLS handshake success (client %s)", self->client_identity_.c_str());
                     self->DoRead();
                 } else {
                     LOG_ERRORF("HttpsSession", "TLS handshake failed: %s", ec.message().c_str());
@@ -84,6 +113,19 @@ namespace mpc_engine::coordinator::network::wallet_server
         );
     }
 
+    std::string HttpsSession::ReadClientIdentity() 
+    {
+        X509* cert = SSL_get_peer_certificate(stream_.native_handle());
+        if (!cert) {
+            return std::string();
+        }
+
+        char common_name[256] = {0};
+        int length = X509_NAME_get_text_by_NID(X509_get_subject_name(cert), NID_commonName, common_name, sizeof(common_name));
+        X509_free(cert);
+        return length > 0 ? std::string(common_name, static_cast<size_t>(length)) : std::string();
+    }
+
     void HttpsSession::DoRead() 
     {
         if (!active_.load()) {
@@ -136,6 +178,30 @@ namespace mpc_engine::coordinator::network::wallet_server
                    request_.method_string().data(), 
                    request_.target().data());
 
+        // health check / drain 중 새 요청 - handler pool을 거치지 않고 바로 응답
+        bool health_check = request_.target() == "/health";
+        if (health_check || draining_.load()) {
+            HttpResponse response;
+            if (draining_.load()) {
+                response.status_code = 503;
+                response.status_text = "Service Unavailable";
+                response.retry_after = std::chrono::seconds(1);
+            }
+            if (!health_check) {
+                response.protobuf_message = std::make_unique<WalletCoordinatorMessage>();
+            }
+            QueueReadyResponse(std::move(response));
+
+            requests_handled_++;
+            DoRead();
+
+            bool expected = false;
+            if (write_in_progress_.compare_exchange_strong(expected, true)) {
+                DoWrite();
+            }
+            return;
+        }
+
         // Proto 역직렬화
         auto wallet_message = std::make_unique<WalletCoordinatorMessage>();
         if (!wallet_message->ParseFromString(request_.body())) {
@@ -149,6 +215,7 @@ namespace mpc_engine::coordinator::network::wallet_server
                 std::lock_guard<std::mutex> lock(queue_mutex_);
                 pending_queue_.push(std::move(future));
             }
+            pending_responses_++;
 
             // 즉시 에러 응답 설정
             HttpResponse error_response;
@@ -173,26 +240,44 @@ namespace mpc_engine::coordinator::network::wallet_server
             return;
         }
 
-        // 정상 처리 (기존 코드)
+        // 정상 처리 - tenant admission 후 차례가 오면 handler pool로
         auto promise = std::make_shared<std::promise<HttpResponse>>();
         auto future = promise->get_future();
 
+        std::string tenant_id = ResolveTenant();
+        uint64_t timeout_ms = ResolveTimeoutMs(*wallet_message);
         auto context = std::make_unique<WalletHandlerContext>(
             std::move(wallet_message),
             promise
         );
+        context->tenant_id = tenant_id;
+        context->admission = &admission_;
+        context->deadline = DeadlineAfter(timeout_ms);
 
         {
             std::lock_guard<std::mutex> lock(queue_mutex_);
             pending_queue_.push(std::move(future));
         }
-
-        try {
-            thread_pool_.SubmitOwned(ProcessRequest, std::move(context));
-        } catch (const std::exception& e) {
-            LOG_ERRORF("HttpsSession", "Failed to submit task: %s", e.what());
-            DoClose();
-            return;
+        pending_responses_++;
+
+        // 대기 중 폐기(종료)되면 context 소멸 → promise 해제 → DoWrite에서 연결 종료
+        auto pending = std::make_shared<std::unique_ptr<WalletHandlerContext>>(std::move(context));
+        ThreadPool<WalletHandlerContext>* pool = &thread_pool_;
+        AdmissionDecision decision = admission_.Submit(tenant_id, [pool, pending]() {
+            pool->SubmitOwned(ProcessRequest, std::move(*pending));
+        });
+
+        if (!decision.Admitted()) {
+            LOG_WARNF("HttpsSession", "Request from tenant %s rejected (%s), retry after %llds",
+                      tenant_id.c_str(), AdmissionStatusToString(decision.status),
+                      static_cast<long long>(decision.retry_after.count()));
+
+            HttpResponse rejected;
+            rejected.status_code = 429;
+            rejected.status_text = "Too Many Requests";
+            rejected.retry_after = decision.retry_after;
+            rejected.protobuf_message = std::make_unique<WalletCoordinatorMessage>();
+            promise->set_value(std::move(rejected));
         }
 
         requests_handled_++;
@@ -204,9 +289,26 @@ namespace mpc_engine::coordinator::network::wallet_server
         }
     }
 
+    void HttpsSession::QueueReadyResponse(HttpResponse response) 
+    {
+        std::promise<HttpResponse> promise;
+        promise.set_value(std::move(response));
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            pending_queue_.push(promise.get_future());
+        }
+        pending_responses_++;
+    }
+
+    void HttpsSession::OnResponseDone() 
+    {
+        pending_responses_--;
+    }
+
     void HttpsSession::DoWrite() 
     {
         std::future<HttpResponse> future;
+        bool more_pending = false;
 
         {
             std::lock_guard<std::mutex> lock(queue_mutex_);
@@ -218,6 +320,7 @@ namespace mpc_engine::coordinator::network::wallet_server
 
             future = std::move(pending_queue_.front());
             pending_queue_.pop();
+            more_pending = !pending_queue_.empty();
         }
 
         // 첫 번째 요청 완료 대기 (순서 보장!)
@@ -226,6 +329,7 @@ namespace mpc_engine::coordinator::network::wallet_server
             http_response = future.get();  // blocking
         } catch (const std::exception& e) {
             LOG_ERRORF("HttpsSession", "Future exception: %s", e.what());
+            OnResponseDone();
             DoClose();
             return;
         }
@@ -235,6 +339,7 @@ namespace mpc_engine::coordinator::network::wallet_server
         if (http_response.protobuf_message && 
             !http_response.protobuf_message->SerializeToString(&proto_body)) {
             LOG_ERROR("HttpsSession", "Proto serialize failed");
+            OnResponseDone();
             DoClose();
             return;
         }
@@ -244,10 +349,13 @@ namespace mpc_engine::coordinator::network::wallet_server
         response->version(11);
         response->result(http_response.status_code);
         response->set(http::field::content_type, "application/x-protobuf");
+        if (http_response.retry_after.count() > 0) {
+            response->set(http::field::retry_after, std::to_string(http_response.retry_after.count()));
+        }
         response->body() = std::move(proto_body);
 
-        // Keep-Alive 결정
-        bool keep_alive = ShouldKeepAlive();
+        // Keep-Alive 결정 (drain 중에는 남은 응답까지만 쓰고 종료)
+        bool keep_alive = ShouldKeepAlive() && (!draining_.load() || more_pending);
         response->keep_alive(keep_alive);
         response->prepare_payload();
 
@@ -268,6 +376,7 @@ namespace mpc_engine::coordinator::network::wallet_server
     void HttpsSession::OnWrite(beast::error_code ec, std::size_t bytes_transferred, bool keep_alive) 
     {
         (void)bytes_transferred;
+        OnResponseDone();
 
         if (ec) {
             LOG_ERRORF("HttpsSession", "Write error: %s", ec.message().c_str());
@@ -346,6 +455,44 @@ namespace mpc_engine::coordinator::network::wallet_server
         last_activity_ = steady_clock::now();
     }
 
+    std::string HttpsSession::ResolveTenant() const 
+    {
+        auto api_key = request_.find("X-Api-Key");
+        std::string key = api_key != request_.end() ? std::string(api_key->value()) : std::string();
+        return admission_.ResolveTenant(key, client_identity_);
+    }
+
+    uint64_t HttpsSession::ResolveTimeoutMs(const WalletCoordinatorMessage& message) const 
+    {
+        uint64_t timeout_ms = 0;
+
+        auto header = request_.find("X-Request-Timeout-Ms");
+        if (header != request_.end()) {
+            std::string value(header->value());
+            try {
+                size_t parsed = 0;
+                unsigned long long budget = std::stoull(value, &parsed);
+                if (parsed != value.size()) {
+                    throw std::invalid_argument(value);
+                }
+                timeout_ms = budget;
+            } catch (const std::exception&) {
+                LOG_WARNF("HttpsSession", "Ignoring invalid X-Request-Timeout-Ms: %s", value.c_str());
+            }
+        }
+
+        uint64_t proto_timeout_ms = 0;
+        if (message.has_signing_request()) {
+            proto_timeout_ms = message.signing_request().header().timeout_ms();
+        } else if (message.has_key_create_request()) {
+            proto_timeout_ms = message.key_create_request().header().timeout_ms();
+        }
+        if (proto_timeout_ms > 0 && (timeout_ms == 0 || proto_timeout_ms < timeout_ms)) {
+            timeout_ms = proto_timeout_ms;
+        }
+        return timeout_ms;
+    }
+
     void HttpsSession::ProcessRequest(WalletHandlerContext* context) 
     {
         if (!context || !context->request || !context->promise) {
@@ -356,18 +503,34 @@ namespace mpc_engine::coordinator::network::wallet_server
         HttpResponse response;
 
         try {
-            // WalletMessageRouter 호출 (기존 그대로)
-            auto protobuf_response = WalletMessageRouter::Instance().ProcessMessage(
-                context->request.get()
-            );
-
-            if (protobuf_response) {
-                response.status_code = 200;
-                response.status_text = "OK";
-                response.protobuf_message = std::move(protobuf_response);
+            // admission / handler pool 대기 중 budget을 다 쓴 요청은 노드에 보내지 않음
+            auto now = steady_clock::now();
+            if (now >= context->deadline) {
+                LOG_WARNF("HttpsSession", "Request from tenant %s expired before processing", context->tenant_id.c_str());
+                response.status_code = 504;
+                response.status_text = "Gateway Timeout";
+                response.protobuf_message = std::make_unique<WalletCoordinatorMessage>();
             } else {
-                response.status_code = 500;
-                response.status_text = "Internal Server Error";
+                // backend는 header.timeout_ms를 받은 시점 기준 budget으로 사용
+                WalletRequestHeader* header = MutableRequestHeader(*context->request);
+                if (header && context->deadline != NO_DEADLINE) {
+                    header->set_timeout_ms(static_cast<uint32_t>(
+                        std::min<uint64_t>(RemainingBudgetMs(context->deadline, now), UINT32_MAX)));
+                }
+
+                // WalletMessageRouter 호출 (기존 그대로)
+                auto protobuf_response = WalletMessageRouter::Instance().ProcessMessage(
+                    context->request.get(), context->tenant_id
+                );
+
+                if (protobuf_response) {
+                    response.status_code = 200;
+                    response.status_text = "OK";
+                    response.protobuf_message = std::move(protobuf_response);
+                } else {
+                    response.status_code = 500;
+                    response.status_text = "Internal Server Error";
+                }
             }
         } catch (const std::exception& e) {
             LOG_ERRORF("HttpsSession", "Exception: %s", e.what());
@@ -381,6 +544,11 @@ namespace mpc_engine::coordinator::network::wallet_server
         } catch (const std::exception& e) {
             LOG_ERRORF("HttpsSession", "Promise set_value failed: %s", e.what());
         }
+
+        // handler slot 반환 - 대기 중인 다음 tenant 요청 디스패치
+        if (context->admission) {
+            context->admission->Complete(context->tenant_id);
+        }
     }
 
 } // namespace mpc_engine::coordinator::network::wallet_server
\ No newline at end of file
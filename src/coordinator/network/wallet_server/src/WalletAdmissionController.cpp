@@ -0,0 +1,343 @@
+// src/coordinator/network/wallet_server/src/WalletAdmissionController.cpp
+#include "coordinator/network/wallet_server/include/WalletAdmissionController.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace mpc_engine::coordinator::network::wallet_server
+{
+    constexpr uint64_t SWEEP_INTERVAL = 1024;       // Submit 횟수 기준 유휴 tenant 정리 주기
+
+    namespace
+    {
+        double BucketCapacity(const TenantLimit& limit)
+        {
+            return std::max(1.0, limit.burst > 0.0 ? limit.burst : limit.requests_per_second);
+        }
+    }
+
+    const TenantLimit& WalletAdmissionConfig::LimitFor(const std::string& tenant_id) const
+    {
+        auto it = tenants.find(tenant_id);
+        return it != tenants.end() ? it->second : default_limit;
+    }
+
+    std::string WalletAdmissionConfig::ResolveTenant(const std::string& api_key, const std::string& client_identity) const
+    {
+        if (!api_key.empty()) {
+            auto it = api_keys.find(api_key);
+            if (it != api_keys.end()) {
+                return it->second;
+            }
+        }
+        if (!client_identity.empty() && tenants.find(client_identity) != tenants.end()) {
+            return client_identity;
+        }
+        return DEFAULT_TENANT;
+    }
+
+    const char* AdmissionStatusToString(AdmissionStatus status)
+    {
+        switch (status) {
+            case AdmissionStatus::ADMITTED: return "admitted";
+            case AdmissionStatus::RATE_LIMITED: return "rate limited";
+            case AdmissionStatus::CONCURRENCY_LIMITED: return "concurrency limited";
+            case AdmissionStatus::OVERLOADED: return "overloaded";
+        }
+        return "unknown";
+    }
+
+    bool LoadWalletAdmissionLimits(const std::string& path, WalletAdmissionConfig* config, std::string* error)
+    {
+        std::ifstream file(path);
+        if (!file) {
+            *error = "cannot open " + path;
+            return false;
+        }
+
+        config->api_keys.clear();
+
+        std::string line;
+        size_t line_number = 0;
+        while (std::getline(file, line)) {
+            line_number++;
+            line.erase(std::find(line.begin(), line.end(), '#'), line.end());
+
+            std::istringstream fields(line);
+            std::string tenant_id;
+            if (!(fields >> tenant_id)) {
+                continue;
+            }
+
+            TenantLimit limit = tenant_id == "*" ? config->default_limit : config->LimitFor(tenant_id);
+            std::string field;
+            while (fields >> field) {
+                size_t eq = field.find('=');
+                std::string key = field.substr(0, eq);
+                std::string value = eq == std::string::npos ? "" : field.substr(eq + 1);
+                try {
+                    if (key == "rps") {
+                        limit.requests_per_second = std::stod(value);
+                    } else if (key == "burst") {
+                        limit.burst = std::stod(value);
+                    } else if (key == "concurrency") {
+                        limit.max_concurrent = std::stoul(value);
+                    } else if (key == "weight") {
+                        limit.weight = static_cast<uint32_t>(std::max(1UL, std::stoul(value)));
+                    } else if (key == "key") {
+                        if (tenant_id == "*" || value.empty()) {
+                            *error = path + ":" + std::to_string(line_number) + ": key needs a tenant and a value";
+                            return false;
+                        }
+                        if (!config->api_keys.emplace(value, tenant_id).second) {
+                            *error = path + ":" + std::to_string(line_number) + ": duplicate API key";
+                            return false;
+                        }
+                    } else {
+                        *error = path + ":" + std::to_string(line_number) + ": unknown field " + key;
+                        return false;
+                    }
+                } catch (const std::exception&) {
+                    *error = path + ":" + std::to_string(line_number) + ": invalid value for " + key;
+                    return false;
+                }
+            }
+
+            if (tenant_id == "*") {
+                config->default_limit = limit;
+            } else {
+                config->tenants[tenant_id] = limit;
+            }
+        }
+        return true;
+    }
+
+    WalletAdmissionController::WalletAdmissionController(size_t dispatch_slots, WalletAdmissionConfig config)
+        : dispatch_slots(std::max<size_t>(dispatch_slots, 1)), config(std::move(config))
+    {
+    }
+
+    AdmissionDecision WalletAdmissionController::Submit(const std::string& tenant_id, Work work)
+    {
+        AdmissionDecision decision;
+        std::vector<std::pair<std::string, Work>> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto now = std::chrono::steady_clock::now();
+            if (stopped) {
+                decision.status = AdmissionStatus::OVERLOADED;
+                decision.retry_after = std::chrono::seconds(1);
+                return decision;
+            }
+            if (++submits_since_sweep >= SWEEP_INTERVAL) {
+                SweepIdleLocked(now);
+            }
+
+            const TenantLimit& limit = config.LimitFor(tenant_id);
+            auto inserted = tenants.try_emplace(tenant_id);
+            TenantState& state = inserted.first->second;
+            if (inserted.second) {
+                state.tokens = BucketCapacity(limit);
+                state.last_refill = now;
+            }
+            RefillLocked(state, limit, now);
+
+            if (limit.max_concurrent > 0 && state.queue.size() + state.running >= limit.max_concurrent) {
+                decision.status = AdmissionStatus::CONCURRENCY_LIMITED;
+                decision.retry_after = std::chrono::seconds(1);
+            } else if (limit.requests_per_second > 0.0 && state.tokens < 1.0) {
+                decision.status = AdmissionStatus::RATE_LIMITED;
+                double wait_sec = (1.0 - state.tokens) / limit.requests_per_second;
+                decision.retry_after = std::chrono::seconds(std::max<int64_t>(1, static_cast<int64_t>(std::ceil(wait_sec))));
+            } else if (config.max_queued > 0 && queued >= config.max_queued) {
+                decision.status = AdmissionStatus::OVERLOADED;
+                decision.retry_after = std::chrono::seconds(1);
+            }
+            if (!decision.Admitted()) {
+                state.rejected++;
+                return decision;
+            }
+
+            if (limit.requests_per_second > 0.0) {
+                state.tokens -= 1.0;
+            }
+            state.queue.push_back(std::move(work));
+            state.admitted++;
+            queued++;
+            if (!state.active) {
+                state.active = true;
+                active.push_back(tenant_id);
+            }
+            ready = TakeDispatchableLocked();
+        }
+        Run(std::move(ready));
+        return decision;
+    }
+
+    void WalletAdmissionController::Complete(const std::string& tenant_id)
+    {
+        std::vector<std::pair<std::string, Work>> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready = CompleteLocked(tenant_id);
+        }
+        Run(std::move(ready));
+    }
+
+    std::vector<std::pair<std::string, WalletAdmissionController::Work>> WalletAdmissionController::CompleteLocked(const std::string& tenant_id)
+    {
+        auto it = tenants.find(tenant_id);
+        if (it != tenants.end() && it->second.running > 0) {
+            it->second.running--;
+        }
+        if (dispatched > 0) {
+            dispatched--;
+        }
+        return TakeDispatchableLocked();
+    }
+
+    std::vector<std::pair<std::string, WalletAdmissionController::Work>> WalletAdmissionController::TakeDispatchableLocked()
+    {
+        std::vector<std::pair<std::string, Work>> ready;
+        while (dispatched < dispatch_slots && !active.empty()) {
+            const std::string& tenant_id = active.front();
+            TenantState& state = tenants[tenant_id];
+            if (state.queue.empty()) {
+                state.active = false;
+                state.deficit = 0.0;
+                active.pop_front();
+                continue;
+            }
+
+            // 차례가 온 tenant는 quantum(weight)만큼 디스패치한 뒤 맨 뒤로
+            if (state.deficit < 1.0) {
+                state.deficit += std::max<uint32_t>(config.LimitFor(tenant_id).weight, 1);
+            }
+            ready.emplace_back(tenant_id, std::move(state.queue.front()));
+            state.queue.pop_front();
+            state.deficit -= 1.0;
+            state.running++;
+            queued--;
+            dispatched++;
+
+            if (state.queue.empty()) {
+                state.active = false;
+                state.deficit = 0.0;
+                active.pop_front();
+            } else if (state.deficit < 1.0) {
+                std::string next = std::move(active.front());
+                active.pop_front();
+                active.push_back(std::move(next));
+            }
+        }
+        return ready;
+    }
+
+    void WalletAdmissionController::Run(std::vector<std::pair<std::string, Work>> works)
+    {
+        // 실패한 작업 자리에 다음 요청을 이어서 디스패치 (Complete 재귀 대신 반복)
+        for (size_t i = 0; i < works.size(); ++i) {
+            try {
+                works[i].second();
+            } catch (const std::exception& e) {
+                LOG_ERRORF("WalletAdmissionController", "Dispatch for tenant %s failed: %s", works[i].first.c_str(), e.what());
+                std::lock_guard<std::mutex> lock(mutex);
+                for (auto& next : CompleteLocked(works[i].first)) {
+                    works.push_back(std::move(next));
+                }
+            }
+        }
+    }
+
+    void WalletAdmissionController::RefillLocked(TenantState& state, const TenantLimit& limit,
+                                                 std::chrono::steady_clock::time_point now) const
+    {
+        double elapsed = std::chrono::duration<double>(now - state.last_refill).count();
+        state.tokens = std::min(BucketCapacity(limit), state.tokens + elapsed * limit.requests_per_second);
+        state.last_refill = now;
+    }
+
+    void WalletAdmissionController::SweepIdleLocked(std::chrono::steady_clock::time_point now)
+    {
+        // 대기/처리 중 요청이 없고 bucket이 다 찬 tenant는 새로 만든 상태와 같음 - 제거해 tenant 수만큼 메모리가 쌓이지 않게
+        submits_since_sweep = 0;
+        for (auto it = tenants.begin(); it != tenants.end();) {
+            TenantState& state = it->second;
+            const TenantLimit& limit = config.LimitFor(it->first);
+            RefillLocked(state, limit, now);
+            if (!state.active && state.running == 0 && state.tokens >= BucketCapacity(limit)) {
+                it = tenants.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void WalletAdmissionController::SetConfig(WalletAdmissionConfig next)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        config = std::move(next);
+        for (auto& entry : tenants) {
+            entry.second.tokens = std::min(entry.second.tokens, BucketCapacity(config.LimitFor(entry.first)));
+        }
+        LOG_INFOF("WalletAdmissionController", "Admission limits updated: %zu tenant overrides, default %.0f req/s, concurrency %zu",
+                  config.tenants.size(), config.default_limit.requests_per_second, config.default_limit.max_concurrent);
+    }
+
+    WalletAdmissionConfig WalletAdmissionController::GetConfig() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return config;
+    }
+
+    std::string WalletAdmissionController::ResolveTenant(const std::string& api_key, const std::string& client_identity) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return config.ResolveTenant(api_key, client_identity);
+    }
+
+    void WalletAdmissionController::Shutdown()
+    {
+        std::vector<std::deque<Work>> dropped;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+            for (auto& entry : tenants) {
+                if (!entry.second.queue.empty()) {
+                    dropped.push_back(std::move(entry.second.queue));
+                    entry.second.queue.clear();
+                }
+                entry.second.active = false;
+            }
+            active.clear();
+            queued = 0;
+        }
+        // 대기 요청의 context 소멸(응답 promise 해제)은 lock 밖에서
+    }
+
+    std::vector<TenantAdmissionStats> WalletAdmissionController::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<TenantAdmissionStats> result;
+        result.reserve(tenants.size());
+        for (const auto& entry : tenants) {
+            TenantAdmissionStats stats;
+            stats.tenant_id = entry.first;
+            stats.queued = entry.second.queue.size();
+            stats.running = entry.second.running;
+            stats.admitted = entry.second.admitted;
+            stats.rejected = entry.second.rejected;
+            result.push_back(std::move(stats));
+        }
+        return result;
+    }
+
+    size_t WalletAdmissionController::GetQueuedCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return queued;
+    }
+
+} // namespace mpc_engine::coordinator::network::wallet_server
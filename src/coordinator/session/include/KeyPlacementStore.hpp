@@ -0,0 +1,65 @@
+// src/coordinator/session/include/KeyPlacementStore.hpp
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mpc_engine::coordinator::session
+{
+    // 키를 만들 때 정해진 배치 - 이후 서명은 ring 재계산 없이 이 노드들로만
+    struct KeyPlacement
+    {
+        std::string key_id;
+        std::string set_id;                     // 생성 시 노드가 속한 engine set (없으면 빈 문자열)
+        std::vector<std::string> node_ids;      // keygen 참여 노드 (key share 보유)
+        uint32_t threshold = 0;
+    };
+
+    /**
+     * @brief key_id → 배치 기록 (append-only journal 파일 + 메모리 index)
+     *
+     * engine set ring은 새 키를 어디에 만들지 정할 때만 쓰고, 만들어진 키의 서명 노드는 여기 기록된 값으로 결정
+     * (재시작 / AddEngineSet / RemoveEngineSet 후에도 share가 있는 노드로 라우팅).
+     * - 파일: 한 줄에 배치 하나 (key_id \t set_id \t threshold \t node,node...), Record마다 fdatasync 후 반환
+     * - Open 시 기존 기록을 모두 읽어 index 구성 - 끝이 잘린 줄(기록 중 중단)은 무시
+     * - 배치는 바뀌지 않으므로 같은 key의 재기록은 내용이 같으면 무시, 다르면 거부
+     * - Open하지 않으면 메모리에만 보관 (테스트 / 단일 프로세스 수명)
+     */
+    class KeyPlacementStore
+    {
+    public:
+        KeyPlacementStore() = default;
+        ~KeyPlacementStore();
+
+        KeyPlacementStore(const KeyPlacementStore&) = delete;
+        KeyPlacementStore& operator=(const KeyPlacementStore&) = delete;
+
+        /**
+        * @brief journal 파일 열기 (없으면 생성) + 기존 기록 적재
+        * @return 파일을 열 수 없으면 false (메모리 보관으로 계속)
+        */
+        bool Open(const std::string& path);
+
+        /**
+        * @brief 배치 기록 - journal에 쓴 뒤 index 반영
+        * @return journal 쓰기 실패 / 다른 배치가 이미 기록됨 / 구분자가 들어간 id면 false
+        */
+        bool Record(const KeyPlacement& placement);
+
+        std::optional<KeyPlacement> Find(const std::string& key_id) const;
+        size_t Size() const;
+        bool IsDurable() const;
+
+    private:
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, KeyPlacement> placements;
+        int fd = -1;
+        std::string path;
+
+        static std::string Serialize(const KeyPlacement& placement);
+        static bool Parse(const std::string& line, KeyPlacement* placement);
+    };
+}
@@ -0,0 +1,109 @@
+// src/coordinator/session/include/MpcKeygenBatch.hpp
+#pragma once
+#include "coordinator/session/include/MpcSessionEngine.hpp"
+#include "proto/coordinator_node/generated/message.pb.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mpc_engine::coordinator::session
+{
+    using namespace mpc_engine::proto::coordinator_node;
+
+    struct MpcKeygenBatchSpec
+    {
+        std::string batch_id;                   // 비어 있으면 생성 - 키별 session_id = batch_id + "-" + index
+        std::vector<std::string> key_ids;
+        std::vector<std::string> node_ids;      // keygen은 모든 노드 참여 (연결되지 않은 노드가 있으면 실패)
+        uint32_t threshold = 0;
+        std::string session_input;              // round 1 입력 (모든 키 공통 - 알고리즘 등)
+        std::chrono::milliseconds round_timeout{0};     // 0 = 기본값
+        utils::Deadline deadline = utils::NO_DEADLINE;  // 배치 전체 처리 기한 - 지나면 남은 키 모두 TIMED_OUT
+        size_t max_keys_per_message = 256;      // 노드당 라운드 메시지 1개에 담는 키 수 상한 (프레임 크기 1MB 대비, 0 = 무제한)
+    };
+
+    struct MpcKeygenKeyResult
+    {
+        std::string key_id;
+        std::string session_id;
+        MpcSessionStatus status = MpcSessionStatus::RUNNING;
+        uint32_t completed_rounds = 0;
+        std::string public_key;                 // 마지막 라운드 결과 (모든 참여자 일치)
+        std::string error_message;
+        std::string failed_node;
+    };
+
+    struct MpcKeygenBatchResult
+    {
+        std::string batch_id;
+        std::vector<std::string> participants;
+        std::vector<MpcKeygenKeyResult> keys;   // spec.key_ids 순서
+        size_t completed = 0;
+        size_t failed = 0;
+        uint64_t messages_sent = 0;             // 노드로 보낸 라운드 배치 메시지 수 (BUSY 재전송 포함)
+        uint64_t elapsed_ms = 0;
+    };
+
+    /**
+     * @brief 여러 키의 keygen 세션을 라운드 단위로 함께 진행 (lockstep)
+     *
+     * 라운드 r: 노드마다 살아 있는 모든 키의 MpcRoundRequest를 MpcRoundBatchRequest 하나로 전송
+     *        → 모든 노드 응답 수집 → 키별 round r+1 입력 조립 → ... → 키별 마지막 라운드 결과 합의 확인
+     *
+     * - 키마다 독립 세션 (노드는 배치 요청 안의 세션별로 라운드를 검증/실행) - 한 키의 실패는 그 키만 제외하고
+     *   나머지는 계속 진행, 실패한 키는 끝난 뒤 모든 노드에 MpcSessionAbortRequest 전송
+     * - BUSY 응답은 retry_after_ms 후 같은 메시지 재전송 (노드는 같은 라운드 재요청에 저장된 출력 반환)
+     * - 라운드 타임아웃 안에 응답하지 않은 노드가 있으면 그 메시지의 키는 TIMED_OUT
+     * - 호출 스레드가 라운드를 구동 (응답 콜백은 결과만 넘기고 즉시 반환)
+     */
+    class MpcKeygenBatch
+    {
+    public:
+        MpcKeygenBatch(NodeClientResolver resolver, std::chrono::milliseconds default_round_timeout);
+
+        MpcKeygenBatch(const MpcKeygenBatch&) = delete;
+        MpcKeygenBatch& operator=(const MpcKeygenBatch&) = delete;
+
+        // 모든 키가 완료/실패할 때까지 대기
+        MpcKeygenBatchResult Run(MpcKeygenBatchSpec spec);
+
+    private:
+        struct Participant
+        {
+            std::string node_id;
+            uint64_t player_id = 0;
+            std::shared_ptr<network::NodeTcpClient> client;
+        };
+
+        // 노드 1개로 가는 라운드 배치 메시지 1개 (키 묶음)
+        struct Message
+        {
+            size_t participant = 0;
+            std::vector<size_t> keys;               // keys[i] ↔ 배치 rounds[i]
+            CoordinatorNodeMessage request;
+            uint64_t request_id = 0;                // NodeTcpClient 요청 id (타임아웃 시 취소)
+            uint32_t busy_retries = 0;
+            bool answered = false;
+            std::chrono::steady_clock::time_point retry_at;     // BUSY 재전송 예정 (time_point() = 없음)
+        };
+
+        // 응답 콜백 → Run 스레드 전달 (콜백은 Run 반환 후에 올 수도 있으므로 shared_ptr)
+        struct Inbox
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::vector<std::pair<size_t, std::unique_ptr<CoordinatorNodeMessage>>> responses;   // (message index, 응답)
+        };
+
+        NodeClientResolver resolver;
+        std::chrono::milliseconds default_round_timeout;
+
+        bool SendMessage(network::NodeTcpClient* client, Message& message, const std::shared_ptr<Inbox>& inbox, size_t index,
+                         utils::Deadline deadline);
+        void SendAborts(const std::vector<Participant>& participants, const MpcKeygenBatchResult& result);
+    };
+}
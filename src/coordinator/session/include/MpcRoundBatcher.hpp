@@ -0,0 +1,94 @@
+// src/coordinator/session/include/MpcRoundBatcher.hpp
+#pragma once
+#include "coordinator/network/node_client/include/NodeTcpClient.hpp"
+#include "proto/coordinator_node/generated/message.pb.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace mpc_engine::coordinator::session
+{
+    using namespace mpc_engine::proto::coordinator_node;
+
+    struct MpcRoundBatchConfig
+    {
+        std::chrono::microseconds window{0};    // 0 = 배칭 안 함 (라운드마다 즉시 전송)
+        size_t max_batch = 32;                  // 이 수에 도달하면 window를 기다리지 않고 전송
+
+        bool Enabled() const { return window.count() > 0 && max_batch > 1; }
+    };
+
+    struct MpcRoundBatcherStats
+    {
+        uint64_t batches_sent = 0;
+        uint64_t rounds_sent = 0;
+    };
+
+    /**
+     * @brief 노드별 라운드 요청 묶음 전송 (세션 무관)
+     *
+     * 같은 노드로 가는 라운드 요청을 window 동안(또는 max_batch개까지) 모아 MpcRoundBatchRequest 하나로 전송하고,
+     * 배치 응답을 라운드별 CoordinatorNodeMessage(mpc_round_response)로 나눠 각 callback에 전달합니다.
+     * - flush는 전용 스레드 1개가 담당 (Submit 호출자는 세션 lock을 잡고 있으므로 직렬화/전송을 하지 않음)
+     * - 배치 전체 실패(BUSY 등 error_response / 연결 끊김)는 묶인 모든 라운드의 callback에 그대로 전달
+     */
+    class MpcRoundBatcher
+    {
+    public:
+        explicit MpcRoundBatcher(MpcRoundBatchConfig config);
+        ~MpcRoundBatcher();
+
+        MpcRoundBatcher(const MpcRoundBatcher&) = delete;
+        MpcRoundBatcher& operator=(const MpcRoundBatcher&) = delete;
+
+        /**
+        * @brief 라운드 요청 추가 (request는 복사됨)
+        * @param callback 응답 (nullptr = 전송 실패/연결 끊김) - flush 스레드 또는 노드 수신 스레드에서 호출
+        * @param deadline 라운드 처리 기한 - 배치는 묶인 라운드 중 가장 늦은 기한으로 전송
+        * @return Shutdown 이후면 false (callback은 호출되지 않음 - 호출자가 직접 전송)
+        */
+        bool Submit(std::shared_ptr<network::NodeTcpClient> client, const MpcRoundRequest& request, network::NodeResponseCallback callback,
+                    utils::Deadline deadline = utils::NO_DEADLINE);
+
+        // 남은 묶음 즉시 전송 후 flush 스레드 종료
+        void Shutdown();
+
+        const MpcRoundBatchConfig& GetConfig() const { return config; }
+        MpcRoundBatcherStats GetStats() const;
+
+    private:
+        struct Item
+        {
+            MpcRoundRequest request;
+            network::NodeResponseCallback callback;
+            utils::Deadline deadline = utils::NO_DEADLINE;
+        };
+
+        struct PendingBatch
+        {
+            std::shared_ptr<network::NodeTcpClient> client;     // 전송 전 노드 등록 해제와 무관하게 보유
+            std::vector<Item> items;
+            std::chrono::steady_clock::time_point deadline;     // flush 시각
+        };
+
+        MpcRoundBatchConfig config;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::unordered_map<network::NodeTcpClient*, PendingBatch> pending;
+        bool stop = false;
+        std::thread flush_thread;
+
+        std::atomic<uint64_t> next_request_id{1};
+        std::atomic<uint64_t> batches_sent{0};
+        std::atomic<uint64_t> rounds_sent{0};
+
+        void FlushLoop();
+        void SendBatch(const std::shared_ptr<network::NodeTcpClient>& client, std::vector<Item> items);
+    };
+}
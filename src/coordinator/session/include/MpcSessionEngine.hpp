@@ -0,0 +1,342 @@
+// src/coordinator/session/include/MpcSessionEngine.hpp
+#pragma once
+#include "coordinator/network/node_client/include/NodeTcpClient.hpp"
+#include "coordinator/session/include/MpcRoundBatcher.hpp"
+#include "common/network/framing/relay.hpp"
+#include "proto/coordinator_node/generated/message.pb.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace mpc_engine::coordinator::session
+{
+    using namespace mpc_engine::proto::coordinator_node;
+    namespace framing = mpc_engine::network::framing;
+
+    // 프로토콜별 라운드 수 (mpc-sdk의 Phase1~5)
+    uint32_t MpcProtocolRoundCount(MpcProtocol protocol);
+
+    enum class MpcSessionStatus
+    {
+        RUNNING = 0,
+        COMPLETED = 1,
+        FAILED = 2,         // 노드 에러 응답 / 연결 끊김 / 결과 불일치
+        TIMED_OUT = 3,      // 라운드 타임아웃 / 세션 기한 초과
+        ABORTED = 4         // 외부 Abort / 엔진 종료
+    };
+
+    const char* MpcSessionStatusToString(MpcSessionStatus status);
+
+    struct MpcSessionSpec
+    {
+        std::string session_id;                 // 비어 있으면 엔진이 생성
+        MpcProtocol protocol = MPC_PROTOCOL_UNSPECIFIED;
+        std::string key_id;
+        std::vector<std::string> node_ids;      // 후보 노드 (연결된 노드 중 앞에서부터 참여자 선택)
+        uint32_t threshold = 0;                 // 서명: threshold개 노드 참여 / keygen: 후보 전체 참여
+        std::string session_input;              // round 1 입력 (서명할 메시지 해시 등)
+        std::string presignature_id;            // ONLINE_SIGNING: 소비할 presignature (참여자는 presign 때와 같아야 함)
+        std::chrono::milliseconds round_timeout{0};     // 0 = 엔진 기본값
+        utils::Deadline deadline = utils::NO_DEADLINE;  // 세션 전체 처리 기한 (요청자의 남은 budget) - 라운드 타임아웃보다 먼저 오면 이 시각에 TIMED_OUT
+    };
+
+    struct MpcSessionResult
+    {
+        std::string session_id;
+        MpcSessionStatus status = MpcSessionStatus::RUNNING;
+        uint32_t completed_rounds = 0;
+        std::vector<std::string> participants;
+        std::string output;                     // 마지막 라운드 결과 (모든 참여자 일치)
+        std::string error_message;
+        std::string failed_node;                // 실패/타임아웃을 일으킨 노드 (있으면)
+        uint64_t elapsed_ms = 0;
+        bool hedged = false;                    // 느린 참여자 때문에 예비 노드로 hedge 세션을 시작했는지
+        bool hedge_won = false;                 // hedge 세션이 먼저 끝남 (participants는 hedge 세션의 참여자)
+    };
+
+    // 세션 종료 시 1회 호출 (노드 수신 스레드 또는 타이머 스레드에서 실행 - 짧게 끝나야 함)
+    using MpcSessionCallback = std::function<void(const MpcSessionResult& result)>;
+    // 반환한 클라이언트는 세션이 끝날 때까지 보유 (그 사이 노드 등록 해제와 무관)
+    using NodeClientResolver = std::function<std::shared_ptr<network::NodeTcpClient>(const std::string& node_id)>;
+    // 서명 참여자 후보 정렬 (앞에서부터 선택) - 후보가 threshold보다 많을 때만 호출
+    using NodeCandidateOrder = std::function<std::vector<std::string>(const std::vector<std::string>& node_ids)>;
+
+    /**
+     * @brief 느린 참여자 hedge 설정
+     * 참여자가 자신의 최근 응답 지연 p95(와 min_delay 중 큰 값) 안에 응답하지 않으면 그 노드를 예비 후보로 바꾼
+     * 같은 세션을 하나 더 시작하고 먼저 끝나는 쪽 결과를 사용 (나머지는 abort)
+     */
+    struct MpcHedgeConfig
+    {
+        double max_ratio = 0.0;                         // hedge 세션 수 / 대상 세션 수 상한 (0 = 끔, 예: 0.05)
+        std::chrono::microseconds min_delay{2000};      // 빠른 노드의 일상적인 지연 변동으로 hedge하지 않도록
+
+        bool Enabled() const { return max_ratio > 0.0; }
+    };
+
+    struct MpcSessionEngineStats
+    {
+        size_t active_sessions = 0;
+        uint64_t started = 0;
+        uint64_t completed = 0;
+        uint64_t failed = 0;
+        uint64_t timed_out = 0;
+        uint64_t aborted = 0;
+        uint64_t round_batches = 0;     // 전송한 라운드 배치 수
+        uint64_t batched_rounds = 0;    // 배치로 전송한 라운드 요청 수
+        uint64_t hedge_eligible = 0;    // hedge 대상 세션 수 (예비 후보가 있는 서명 세션)
+        uint64_t hedges = 0;            // 시작한 hedge 세션 수
+        uint64_t hedge_wins = 0;        // hedge 세션이 먼저 끝난 수
+        uint64_t mesh_sessions = 0;     // 노드 간 mesh로 실행한 세션 수
+        uint64_t relay_sessions = 0;    // 라운드 출력을 opaque envelope로 중계한 세션 수
+
+        double HedgeRate() const { return hedge_eligible > 0 ? static_cast<double>(hedges) / static_cast<double>(hedge_eligible) : 0.0; }
+    };
+
+    // Drain 결과 (drain 중 새 세션은 시작되지 않으므로 모두 drain 시작 시 진행 중이던 세션)
+    struct MpcDrainReport
+    {
+        size_t in_flight = 0;       // drain 시작 시 진행 중인 세션
+        uint64_t completed = 0;     // deadline 안에 완료
+        uint64_t failed = 0;        // deadline 안에 실패 / 타임아웃
+        uint64_t aborted = 0;       // deadline 후 abort - 모든 참여 노드에 abort 전달
+        uint64_t lost = 0;          // deadline 후 abort했지만 일부 노드에 abort를 전달하지 못함 (노드 유휴 만료에 맡김)
+        uint64_t elapsed_ms = 0;
+    };
+
+    /**
+     * @brief 다중 라운드 MPC 세션 상태 머신 (session_id 기준)
+     *
+     * 라운드 r: 모든 참여자에게 MpcRoundRequest(직전 라운드 출력 전체) 전송
+     *        → 모든 참여자 응답 수집 → 라운드 r+1 입력 조립 → ... → 마지막 라운드 결과 합의 확인
+     *
+     * - 스레드: 세션당 스레드 없음. 응답은 NodeTcpClient 수신 스레드의 완료 콜백에서 처리하고
+     *   라운드 전환도 그 콜백에서 수행. 라운드 타임아웃은 엔진 전체에서 타이머 스레드 1개가 감시.
+     * - 라운드 배칭이 켜져 있으면 라운드 요청을 MpcRoundBatcher로 노드별로 묶어 전송
+     * - BUSY 응답은 retry_after_ms 후 같은 참여자에게 재전송 (노드는 같은 라운드 재요청에 저장된 출력 반환)
+     * - hedge가 켜져 있으면 느린 참여자를 예비 후보로 바꾼 세션을 하나 더 시작 (서명 세션, 세션당 1회, 비율 상한)
+     * - 실패/타임아웃/Abort 시 남은 요청 취소 후 참여 노드에 MpcSessionAbortRequest 전송 (상태 폐기)
+     * - peer mesh가 켜져 있고 모든 참여자에 mesh 주소가 있으면 세션 전체를 MpcMeshSessionRequest 1회로 시작
+     *   (라운드 메시지는 노드끼리 직접 교환, coordinator는 결과 합의만 확인 - 타임아웃은 round_timeout × 라운드 수)
+     * - opaque relay가 켜져 있으면 라운드를 MPC_RELAY_ROUND 프레임으로 중계 - 노드 출력 envelope의 routing header만 읽고
+     *   응답 body를 그대로 다음 라운드 요청 프레임의 segment로 공유 (payload 파싱/재직렬화/복사 없음, 배칭 대상 아님)
+     */
+    class MpcSessionEngine
+    {
+    public:
+        MpcSessionEngine(NodeClientResolver resolver, std::chrono::milliseconds default_round_timeout,
+                         MpcRoundBatchConfig batching = MpcRoundBatchConfig(),
+                         NodeCandidateOrder candidate_order = nullptr);
+        ~MpcSessionEngine();
+
+        MpcSessionEngine(const MpcSessionEngine&) = delete;
+        MpcSessionEngine& operator=(const MpcSessionEngine&) = delete;
+
+        /**
+        * @brief 세션 시작 (즉시 반환) - 결과는 callback으로 전달
+        * @return 시작된 session_id (시작 실패 시에도 callback은 호출됨)
+        */
+        std::string Start(MpcSessionSpec spec, MpcSessionCallback callback);
+
+        // 동기 실행 (테스트/단순 호출자용) - 호출 스레드만 대기
+        MpcSessionResult Run(MpcSessionSpec spec);
+
+        // @return 진행 중인 세션이 있었는지
+        bool Abort(const std::string& session_id, const std::string& reason);
+
+        // 진행 중인 모든 세션 ABORTED 처리 후 타이머 종료
+        void Shutdown();
+
+        // 새 세션 거부 (ABORTED로 즉시 완료) - 진행 중 세션은 계속
+        void StopAccepting();
+
+        /**
+        * @brief 새 세션을 거부하고 진행 중 세션이 끝나기를 timeout까지 대기, 남은 세션은 abort (노드에 abort 전달)
+        * 이후 Shutdown은 타이머만 정리
+        */
+        MpcDrainReport Drain(std::chrono::milliseconds timeout);
+
+        MpcSessionEngineStats GetStats() const;
+
+        /**
+        * @brief 라운드 배칭 설정 변경 (운영 중 튜닝용)
+        * 이미 모인 요청은 이전 설정으로 즉시 전송되고 이후 라운드부터 적용
+        */
+        void SetRoundBatching(const MpcRoundBatchConfig& config);
+        MpcRoundBatchConfig GetRoundBatching() const;
+
+        // hedge 설정 변경 - 이후 시작하는 세션부터 적용
+        void SetHedging(const MpcHedgeConfig& config);
+        MpcHedgeConfig GetHedging() const;
+
+        // 노드 간 mesh 사용 여부 - 이후 시작하는 세션부터 적용 (온라인 서명은 1 라운드라 항상 중계)
+        void SetPeerMesh(bool enabled);
+        bool IsPeerMeshEnabled() const { return peer_mesh.load(); }
+
+        // opaque relay 사용 여부 - 이후 시작하는 세션부터 적용 (mesh 세션은 해당 없음)
+        void SetOpaqueRelay(bool enabled);
+        bool IsOpaqueRelayEnabled() const { return opaque_relay.load(); }
+
+    private:
+        static constexpr uint64_t BATCHED_REQUEST = static_cast<uint64_t>(-1);   // 배치 대기/전송 중 (개별 취소 불가)
+
+        struct Participant
+        {
+            std::string node_id;
+            uint64_t player_id = 0;
+            std::shared_ptr<network::NodeTcpClient> client;
+            uint64_t request_id = 0;    // 현재 라운드 요청 (0 = 응답 완료/없음, BATCHED_REQUEST = 배치로 전송)
+            uint32_t busy_retries = 0;  // 현재 라운드 BUSY 재전송 횟수
+            bool retry_pending = false; // BUSY → 타이머가 재전송
+        };
+
+        // primary 세션과 hedge 세션 중 먼저 끝나는 결과를 원래 callback에 1회 전달
+        struct HedgeGroup
+        {
+            std::mutex mutex;
+            MpcSessionCallback callback;
+            std::string primary_id;
+            std::string hedge_id;
+            std::chrono::steady_clock::time_point start_time;   // primary 시작 시각
+            size_t outstanding = 2;
+            bool delivered = false;
+            MpcSessionResult primary_result;    // 둘 다 실패하면 primary 결과 전달
+        };
+
+        // 노드가 보낸 라운드 출력 envelope (응답 body 전체) - 다음 라운드 요청에 그대로 이어 붙임
+        struct RelayEnvelope
+        {
+            std::shared_ptr<const std::vector<uint8_t>> frame;
+            framing::RelayEnvelopeView view;    // frame을 참조
+            uint32_t checksum = 0;              // 응답 프레임 header의 checksum (수신 시 검증됨)
+        };
+
+        struct Session
+        {
+            std::mutex mutex;
+            MpcSessionSpec spec;
+            MpcSessionCallback callback;
+            uint32_t total_rounds = 0;
+            uint32_t round = 0;
+            std::vector<Participant> participants;
+            std::vector<uint64_t> player_ids;
+            CoordinatorNodeMessage round_message;             // 현재 라운드 요청 (참여자별 player_id만 다름)
+            std::map<uint64_t, std::string> round_outputs;    // 현재 라운드 수집 (player_id → output)
+            std::chrono::steady_clock::time_point start_time;
+            std::chrono::steady_clock::time_point round_deadline;   // 현재 라운드 타임아웃 (spec.deadline 이하 - 요청에 남은 budget으로 전달)
+            bool finished = false;
+            MpcHedgeConfig hedge;                       // Enabled() = hedge 대상 (hedge 세션 자신은 제외)
+            bool mesh = false;                          // 노드 간 mesh로 실행 (round_message는 MpcMeshSessionRequest)
+            bool relay = false;                         // opaque relay (round_message는 peer_messages 없는 라운드 요청)
+            std::map<uint64_t, RelayEnvelope> round_envelopes;     // relay: 현재 라운드 수집 (player_id → envelope)
+            std::vector<RelayEnvelope> forward_envelopes;           // relay: 이번 라운드 요청에 붙이는 직전 라운드 출력
+            std::shared_ptr<HedgeGroup> hedge_group;    // hedge 시작 후 설정
+        };
+
+        enum class DeadlineKind
+        {
+            ROUND_TIMEOUT,
+            BUSY_RETRY,     // 참여자 BUSY 재전송
+            HEDGE           // 참여자 p95 경과 - 아직 응답이 없으면 hedge
+        };
+
+        // 라운드 타임아웃 / 참여자 BUSY 재전송 / hedge 검사 예약
+        struct RoundDeadline
+        {
+            std::chrono::steady_clock::time_point deadline;
+            std::weak_ptr<Session> session;
+            uint32_t round;
+            DeadlineKind kind = DeadlineKind::ROUND_TIMEOUT;
+            size_t participant = 0;     // BUSY_RETRY / HEDGE 대상 참여자 index
+
+            bool operator>(const RoundDeadline& other) const { return deadline > other.deadline; }
+        };
+
+        NodeClientResolver resolver;
+        NodeCandidateOrder candidate_order;
+        std::chrono::milliseconds default_round_timeout;
+
+        mutable std::mutex sessions_mutex;
+        std::unordered_map<std::string, std::shared_ptr<Session>> sessions;
+        std::condition_variable sessions_cv;       // 세션 종료 시 notify (Drain 대기)
+        std::atomic<uint64_t> next_session_number{1};
+        std::atomic<uint64_t> next_request_id{1};
+        bool accepting = true;
+
+        // 라운드 배칭 (교체 시 이전 batcher는 남은 요청 전송 후 종료)
+        mutable std::mutex batcher_mutex;
+        std::shared_ptr<MpcRoundBatcher> batcher;
+        MpcRoundBatcherStats retired_batch_stats;
+
+        mutable std::mutex hedge_mutex;
+        MpcHedgeConfig hedging;
+
+        std::atomic<bool> peer_mesh{false};
+        std::atomic<bool> opaque_relay{false};
+
+        // 라운드 타임아웃/재전송 (min-heap, 지난 라운드 항목은 꺼낼 때 무시)
+        std::mutex timer_mutex;
+        std::condition_variable timer_cv;
+        std::priority_queue<RoundDeadline, std::vector<RoundDeadline>, std::greater<RoundDeadline>> deadlines;
+        std::thread timer_thread;
+        bool timer_stop = false;
+
+        std::atomic<uint64_t> started_count{0};
+        std::atomic<uint64_t> completed_count{0};
+        std::atomic<uint64_t> failed_count{0};
+        std::atomic<uint64_t> timed_out_count{0};
+        std::atomic<uint64_t> aborted_count{0};
+        std::atomic<uint64_t> hedge_eligible_count{0};
+        std::atomic<uint64_t> hedge_count{0};
+        std::atomic<uint64_t> hedge_win_count{0};
+        std::atomic<uint64_t> mesh_session_count{0};
+        std::atomic<uint64_t> relay_session_count{0};
+        std::atomic<uint64_t> abort_undelivered_count{0};   // abort를 일부 참여 노드에 전달하지 못한 세션
+
+        std::string StartSession(MpcSessionSpec spec, MpcSessionCallback callback, bool allow_hedge);
+        void TimerLoop();
+
+        // session->mutex 보유 상태에서 호출
+        bool StartRoundLocked(const std::shared_ptr<Session>& session, uint32_t round);
+        bool SendToParticipantLocked(const std::shared_ptr<Session>& session, size_t index);
+        void ScheduleLocked(RoundDeadline entry);
+        void OnRoundResponse(const std::shared_ptr<Session>& session, uint32_t round, size_t index,
+                             std::unique_ptr<CoordinatorNodeMessage> response);
+        // relay 세션 응답 - envelope면 header만 검증해 보관, 아니면(에러 응답) 파싱해서 OnRoundResponse
+        void OnRelayResponse(const std::shared_ptr<Session>& session, uint32_t round, size_t index,
+                             std::unique_ptr<framing::NetworkMessage> response);
+        // 참여자 player_id 앞 relay 요청 프레임 (라운드 요청 직렬화 + forward_envelopes 공유)
+        framing::NetworkMessage BuildRelayFrameLocked(const Session& session, uint64_t player_id) const;
+        /**
+        * @brief 라운드 출력이 모두 모였으면 다음 라운드 시작 / 최종 결과 합의 확인
+        * @return 세션이 끝났으면 true (result 채움) - 아직 수집 중이거나 다음 라운드를 시작했으면 false
+        */
+        bool AdvanceLocked(const std::shared_ptr<Session>& session, uint32_t round, MpcSessionResult* result);
+        void OnRoundTimeout(const std::shared_ptr<Session>& session, uint32_t round);
+        void OnRetryDue(const std::shared_ptr<Session>& session, uint32_t round, size_t index);
+        void OnHedgeDue(const std::shared_ptr<Session>& session, uint32_t round, size_t index);
+        void OnHedgedSessionDone(const std::shared_ptr<HedgeGroup>& group, bool is_hedge, const MpcSessionResult& result);
+        // hedge 수가 max_ratio × 대상 세션 수를 넘지 않으면 1 증가
+        bool TryAcquireHedge(double max_ratio);
+
+        /**
+        * @brief 세션 종료 처리 (lock 보유 상태에서 호출, 반환 후 lock 해제하고 callback 호출)
+        * @return callback에 넘길 결과
+        */
+        MpcSessionResult FinishLocked(Session& session, MpcSessionStatus status,
+                                      const std::string& error_message, const std::string& failed_node,
+                                      std::string output = std::string());
+        void Complete(const MpcSessionCallback& callback, const MpcSessionResult& result);
+        // @return abort를 전송하지 못한 참여자 수 (연결 끊김)
+        size_t SendAbortToParticipants(const Session& session, const std::string& reason);
+    };
+}
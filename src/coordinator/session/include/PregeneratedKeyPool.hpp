@@ -0,0 +1,134 @@
+// src/coordinator/session/include/PregeneratedKeyPool.hpp
+#pragma once
+#include "coordinator/session/include/MpcSessionEngine.hpp"
+#include "coordinator/session/include/MpcKeygenBatch.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mpc_engine::coordinator::session
+{
+    struct PregeneratedKeyPoolConfig
+    {
+        size_t target_depth = 0;                // 미리 생성해 둘 미배정 키 수 (0 = pool 사용 안 함)
+        size_t low_watermark = 0;               // depth가 이 값 이하로 내려가면 target_depth까지 보충 시작
+        size_t batch_size = 32;                 // keygen 배치 1회에 생성하는 키 수
+        double keys_per_second = 200.0;         // 키 생성 속도 상한 (token bucket)
+        size_t max_active_sessions = 32;        // 엔진 진행 중 세션이 이보다 많으면 보충 보류 (서명 우선, 0 = 검사 안 함)
+        std::vector<std::string> node_ids;      // keygen 참여 노드 (비어 있으면 키별 placement - engine set)
+        uint32_t threshold = 2;
+
+        bool Enabled() const { return target_depth > 0 && batch_size > 0 && keys_per_second > 0 && threshold > 0; }
+    };
+
+    // 모든 노드에서 keygen이 끝난 키 (배정 전에는 어느 지갑에도 속하지 않음)
+    struct PregeneratedKey
+    {
+        std::string key_id;
+        std::string public_key;
+        std::vector<std::string> node_ids;      // keygen 참여 노드
+        uint32_t threshold = 0;
+        std::chrono::steady_clock::time_point created;
+    };
+
+    struct PregeneratedKeyPoolStats
+    {
+        size_t depth = 0;               // 배정 대기 중인 키 수
+        size_t in_flight = 0;           // 생성 중인 키 수
+        size_t assigned = 0;            // 배정된 (tenant, wallet) 수
+        uint64_t hits = 0;              // pool에서 바로 배정
+        uint64_t misses = 0;            // pool이 비어 요청 시 keygen
+        uint64_t generated = 0;
+        uint64_t failed = 0;
+        uint64_t batches = 0;
+        uint64_t deferred = 0;          // 진행 중 세션이 많아 보충을 미룬 횟수
+
+        double HitRate() const { return hits + misses > 0 ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0; }
+    };
+
+    /**
+     * @brief 미리 생성된 threshold 키 pool (백그라운드 keygen 배치로 보충)
+     *
+     * 지갑 키 생성 요청은 Assign으로 준비된 키 하나를 (tenant, wallet)에 배정만 하므로 keygen을 기다리지 않음.
+     * - 보충: depth <= low_watermark가 되면 보충 스레드가 MpcKeygenBatch로 batch_size개씩 target_depth까지 생성
+     * - 보충 속도는 token bucket(keys_per_second) + 엔진 진행 중 세션 수(max_active_sessions)로 제한
+     *   (노드가 서명 라운드 처리 중이면 keygen 배치를 미룸)
+     * - 배정은 mutex 안에서 pool 제거 + 배정 기록을 함께 하는 메타데이터 연산 - 같은 키가 두 지갑에 나가지 않음
+     * - 같은 (tenant, wallet) 재요청은 처음 배정된 키를 그대로 반환 (Wallet 재시도 안전)
+     * - 키마다 placement로 참여 노드를 정하고, 같은 노드 목록끼리 묶어 keygen 배치 실행
+     */
+    class PregeneratedKeyPool
+    {
+    public:
+        using KeyPlacement = std::function<std::vector<std::string>(const std::string& key_id)>;
+
+        /**
+        * @param placement config.node_ids가 비어 있을 때 key_id의 keygen 참여 노드 (보충할 때마다 조회)
+        */
+        PregeneratedKeyPool(MpcSessionEngine& engine, std::shared_ptr<MpcKeygenBatch> keygen,
+                            KeyPlacement placement, PregeneratedKeyPoolConfig config);
+        ~PregeneratedKeyPool();
+
+        PregeneratedKeyPool(const PregeneratedKeyPool&) = delete;
+        PregeneratedKeyPool& operator=(const PregeneratedKeyPool&) = delete;
+
+        /**
+        * @brief 준비된 키 하나를 (tenant, wallet)에 배정 (이미 배정되어 있으면 그 키)
+        * @param threshold 0이 아니고 pool 키의 threshold와 다르면 배정하지 않음
+        * @return pool이 비어 있으면 nullopt (호출자는 요청 시 keygen 후 Adopt)
+        */
+        std::optional<PregeneratedKey> Assign(const std::string& tenant_id, const std::string& wallet_id, uint32_t threshold);
+
+        /**
+        * @brief pool 밖에서 생성한 키를 배정 기록 (요청 시 keygen 경로)
+        * 그 사이 같은 (tenant, wallet)이 배정되었으면 기존 키를 반환하고 새 키는 pool에 넣음
+        */
+        PregeneratedKey Adopt(const std::string& tenant_id, const std::string& wallet_id, PregeneratedKey key);
+
+        std::optional<PregeneratedKey> FindAssignment(const std::string& tenant_id, const std::string& wallet_id) const;
+
+        // 보충 중단 후 진행 중 keygen 배치 완료 대기
+        void Shutdown();
+
+        const PregeneratedKeyPoolConfig& GetConfig() const { return config; }
+        PregeneratedKeyPoolStats GetStats() const;
+
+    private:
+        MpcSessionEngine& engine;
+        std::shared_ptr<MpcKeygenBatch> keygen;
+        KeyPlacement placement;
+        PregeneratedKeyPoolConfig config;
+
+        mutable std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<PregeneratedKey> ready;      // 생성 순
+        std::map<std::pair<std::string, std::string>, PregeneratedKey> assignments;     // (tenant, wallet) → 키
+        PregeneratedKeyPoolStats stats;         // depth/assigned는 조회 시 계산
+        bool refilling = false;                 // low_watermark 도달 후 target_depth를 채울 때까지
+        bool stop = false;
+        uint64_t next_key_number = 1;
+        std::chrono::steady_clock::time_point retry_after;      // keygen 실패 후 보충 보류
+
+        // token bucket (키 단위)
+        double tokens = 0.0;
+        std::chrono::steady_clock::time_point last_refill;
+
+        std::thread refill_thread;
+
+        void RefillLoop();
+        std::vector<MpcKeygenBatchSpec> GroupByPlacement(const std::vector<std::string>& key_ids) const;
+
+        // mutex 보유 상태에서 호출
+        void RefillTokensLocked(std::chrono::steady_clock::time_point now);
+        void AddBatchLocked(const MpcKeygenBatchSpec& spec, const MpcKeygenBatchResult& result);
+    };
+}
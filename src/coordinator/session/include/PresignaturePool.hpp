@@ -0,0 +1,154 @@
+// src/coordinator/session/include/PresignaturePool.hpp
+#pragma once
+#include "coordinator/session/include/MpcSessionEngine.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mpc_engine::coordinator::session
+{
+    struct PresignaturePoolConfig
+    {
+        size_t target_depth = 0;                // key당 유지할 presignature 수 (0 = pool 사용 안 함)
+        size_t max_in_flight = 8;               // 동시에 진행하는 presign 세션 상한 (전체 key 합산)
+        double refill_per_second = 50.0;        // presign 세션 시작 속도 상한 (token bucket, 노드 부하 제한)
+        std::chrono::milliseconds max_age{30 * 60 * 1000};     // 이보다 오래된 presignature는 폐기 (노드 TTL보다 짧게)
+        size_t max_keys = 1024;                 // 등록 key 상한 (key마다 target_depth만큼 노드 presign 상태/보충 트래픽이 생김)
+        std::chrono::milliseconds idle_ttl{10 * 60 * 1000};    // 이 기간 Acquire가 없는 key는 등록 해제 (0 = 해제 안 함)
+        bool enroll_wallet_keys = false;        // CreateWalletKey로 만든 키를 배치된 노드로 자동 등록
+
+        bool Enabled() const { return target_depth > 0 && max_in_flight > 0 && refill_per_second > 0; }
+    };
+
+    // 소비할 presignature - 온라인 서명은 presign 때의 참여자 전원이 그대로 참여해야 함
+    struct Presignature
+    {
+        std::string presignature_id;            // presign 세션 id
+        std::string key_id;
+        std::vector<std::string> node_ids;      // presign 참여 노드
+        std::chrono::steady_clock::time_point created;
+    };
+
+    struct PresignatureKeyStats
+    {
+        std::string key_id;
+        size_t depth = 0;
+        size_t in_flight = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t generated = 0;
+        uint64_t failed = 0;
+        uint64_t expired = 0;
+
+        double HitRate() const { return hits + misses > 0 ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0; }
+    };
+
+    struct PresignaturePoolStats
+    {
+        size_t keys = 0;
+        size_t depth = 0;           // 전체 key 합산
+        size_t in_flight = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t generated = 0;
+        uint64_t failed = 0;
+        uint64_t expired = 0;
+        uint64_t rejected_keys = 0;     // max_keys 초과로 등록 거부
+        uint64_t idle_removed = 0;      // idle_ttl 동안 사용되지 않아 등록 해제
+
+        double HitRate() const { return hits + misses > 0 ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0; }
+    };
+
+    /**
+     * @brief key별 ECDSA presignature pool (백그라운드 보충)
+     *
+     * 등록은 명시적으로만 (AddKey) - 서명 경로는 Acquire만 하고 key를 등록하지 않음
+     * 등록된 key마다 depth + 진행 중 presign 수가 target_depth가 될 때까지 MPC_PROTOCOL_ECDSA_PRESIGN 세션을
+     * 시작하고, 서명 요청은 Acquire로 하나를 꺼내 1 라운드 온라인 서명만 수행합니다.
+     * - 스레드: 보충 스레드 1개 (세션 진행은 엔진 콜백 - presign당 스레드 없음)
+     * - 보충 속도는 max_in_flight + token bucket(refill_per_second)으로 제한 (온라인 서명 라운드가 밀리지 않도록)
+     * - 오래된 것부터 꺼냄 (FIFO), max_age 초과분은 보충 스레드/Acquire에서 폐기
+     * - presignature는 Acquire에서 pool에서 제거되므로 같은 것이 두 번 나가지 않음 (노드도 1회 소비만 허용)
+     * - 등록 key 수는 max_keys로 제한, idle_ttl 동안 Acquire가 없는 key는 보충 스레드가 RemoveKey
+     */
+    class PresignaturePool
+    {
+    public:
+        PresignaturePool(MpcSessionEngine& engine, PresignaturePoolConfig config);
+        ~PresignaturePool();
+
+        PresignaturePool(const PresignaturePool&) = delete;
+        PresignaturePool& operator=(const PresignaturePool&) = delete;
+
+        /**
+        * @brief key 등록 (이미 있으면 후보 노드/threshold 갱신) - 이후 보충 스레드가 target_depth까지 채움
+        * @param node_ids 후보 노드 (엔진이 연결된 노드 중 threshold개 선택)
+        * @return 새 key인데 max_keys에 도달했으면 false
+        */
+        bool AddKey(const std::string& key_id, const std::vector<std::string>& node_ids, uint32_t threshold);
+
+        // key의 남은 presignature 폐기 후 보충 중단
+        void RemoveKey(const std::string& key_id);
+
+        bool HasKey(const std::string& key_id) const;
+
+        /**
+        * @brief presignature 하나 꺼내기 (hit/miss 집계, 꺼낸 만큼 보충)
+        * @return 없으면 nullopt (호출자는 전체 서명 프로토콜로 진행)
+        */
+        std::optional<Presignature> Acquire(const std::string& key_id);
+
+        // 보충 중단 후 진행 중 presign 세션 완료 대기 (엔진 Shutdown을 먼저 하면 즉시 반환)
+        void Shutdown();
+
+        const PresignaturePoolConfig& GetConfig() const { return config; }
+        PresignaturePoolStats GetStats() const;
+        std::vector<PresignatureKeyStats> GetKeyStats() const;
+
+    private:
+        struct KeyPool
+        {
+            std::vector<std::string> node_ids;
+            uint32_t threshold = 0;
+            std::deque<Presignature> ready;     // 생성 순 (앞쪽이 가장 오래됨)
+            PresignatureKeyStats stats;         // hit/miss 등 카운터 + in_flight (depth는 ready.size())
+            uint64_t generation = 0;            // RemoveKey/AddKey 후 이전 세션 결과 무시용
+            std::chrono::steady_clock::time_point retry_after;     // presign 실패 후 보충 보류 (노드 장애 시 실패 세션 반복 방지)
+            std::chrono::steady_clock::time_point last_used;       // 등록 또는 마지막 Acquire (idle_ttl 기준)
+        };
+
+        MpcSessionEngine& engine;
+        PresignaturePoolConfig config;
+
+        mutable std::mutex mutex;
+        std::condition_variable cv;
+        std::map<std::string, KeyPool> keys;
+        size_t in_flight = 0;
+        uint64_t next_presign_number = 1;
+        uint64_t next_generation = 1;
+        uint64_t rejected_keys = 0;
+        uint64_t idle_removed = 0;
+        bool stop = false;
+
+        // token bucket
+        double tokens = 0.0;
+        std::chrono::steady_clock::time_point last_refill;
+
+        std::thread refill_thread;
+
+        void RefillLoop();
+
+        // mutex 보유 상태에서 호출
+        void DropExpiredLocked(KeyPool& pool, std::chrono::steady_clock::time_point now);
+        void RefillTokensLocked(std::chrono::steady_clock::time_point now);
+        void RemoveIdleKeysLocked(std::chrono::steady_clock::time_point now);
+
+        void OnPresignComplete(const std::string& key_id, uint64_t generation, const MpcSessionResult& result);
+    };
+}
@@ -0,0 +1,198 @@
+// src/coordinator/session/src/KeyPlacementStore.cpp
+#include "coordinator/session/include/KeyPlacementStore.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sstream>
+#include <unistd.h>
+
+namespace mpc_engine::coordinator::session
+{
+    namespace
+    {
+        // journal 구분자가 들어간 id는 기록하지 않음 (coordinator가 만드는 id에는 없음)
+        bool IsJournalSafe(const std::string& value)
+        {
+            return value.find_first_of("\t\n,") == std::string::npos;
+        }
+    }
+
+    KeyPlacementStore::~KeyPlacementStore()
+    {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    bool KeyPlacementStore::Open(const std::string& journal_path)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        int new_fd = ::open(journal_path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+        if (new_fd < 0) {
+            LOG_ERRORF("KeyPlacementStore", "Cannot open %s: %s", journal_path.c_str(), std::strerror(errno));
+            return false;
+        }
+
+        std::string contents;
+        char buffer[64 * 1024];
+        ssize_t n;
+        while ((n = ::pread(new_fd, buffer, sizeof(buffer), static_cast<off_t>(contents.size()))) > 0) {
+            contents.append(buffer, static_cast<size_t>(n));
+        }
+        if (n < 0) {
+            LOG_ERRORF("KeyPlacementStore", "Cannot read %s: %s", journal_path.c_str(), std::strerror(errno));
+            ::close(new_fd);
+            return false;
+        }
+
+        size_t loaded = 0;
+        size_t invalid = 0;
+        size_t start = 0;
+        for (size_t end = contents.find('\n'); end != std::string::npos; start = end + 1, end = contents.find('\n', start)) {
+            KeyPlacement placement;
+            if (Parse(contents.substr(start, end - start), &placement)) {
+                placements[placement.key_id] = std::move(placement);
+                loaded++;
+            } else {
+                invalid++;
+            }
+        }
+        if (start < contents.size()) {
+            // 기록 중 중단된 마지막 줄 - 이어 쓰기 전에 잘라냄 (Record는 fsync 후 반환하므로 응답한 배치는 아님)
+            LOG_WARNF("KeyPlacementStore", "Dropping %zu trailing bytes of an incomplete record in %s",
+                      contents.size() - start, journal_path.c_str());
+            if (::ftruncate(new_fd, static_cast<off_t>(start)) != 0) {
+                LOG_ERRORF("KeyPlacementStore", "Cannot truncate %s: %s", journal_path.c_str(), std::strerror(errno));
+                ::close(new_fd);
+                return false;
+            }
+        }
+        if (invalid > 0) {
+            LOG_WARNF("KeyPlacementStore", "Skipped %zu malformed records in %s", invalid, journal_path.c_str());
+        }
+
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        fd = new_fd;
+        path = journal_path;
+        LOG_INFOF("KeyPlacementStore", "Loaded %zu key placements from %s", loaded, path.c_str());
+        return true;
+    }
+
+    bool KeyPlacementStore::Record(const KeyPlacement& placement)
+    {
+        if (placement.key_id.empty() || !IsJournalSafe(placement.key_id) || !IsJournalSafe(placement.set_id)) {
+            LOG_ERRORF("KeyPlacementStore", "Invalid key placement id: %s", placement.key_id.c_str());
+            return false;
+        }
+        for (const std::string& node_id : placement.node_ids) {
+            if (node_id.empty() || !IsJournalSafe(node_id)) {
+                LOG_ERRORF("KeyPlacementStore", "Invalid node id in placement of %s", placement.key_id.c_str());
+                return false;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = placements.find(placement.key_id);
+        if (it != placements.end()) {
+            const KeyPlacement& existing = it->second;
+            if (existing.node_ids == placement.node_ids && existing.threshold == placement.threshold) {
+                return true;
+            }
+            LOG_ERRORF("KeyPlacementStore", "Key %s is already placed on other nodes", placement.key_id.c_str());
+            return false;
+        }
+
+        if (fd >= 0) {
+            std::string line = Serialize(placement);
+            size_t written = 0;
+            while (written < line.size()) {
+                ssize_t n = ::write(fd, line.data() + written, line.size() - written);
+                if (n < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (n <= 0) {
+                    LOG_ERRORF("KeyPlacementStore", "Cannot write placement of %s to %s: %s", placement.key_id.c_str(),
+                               path.c_str(), std::strerror(errno));
+                    return false;
+                }
+                written += static_cast<size_t>(n);
+            }
+            if (::fdatasync(fd) != 0) {
+                LOG_ERRORF("KeyPlacementStore", "Cannot sync %s: %s", path.c_str(), std::strerror(errno));
+                return false;
+            }
+        }
+
+        placements.emplace(placement.key_id, placement);
+        return true;
+    }
+
+    std::optional<KeyPlacement> KeyPlacementStore::Find(const std::string& key_id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = placements.find(key_id);
+        if (it == placements.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    size_t KeyPlacementStore::Size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return placements.size();
+    }
+
+    bool KeyPlacementStore::IsDurable() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return fd >= 0;
+    }
+
+    std::string KeyPlacementStore::Serialize(const KeyPlacement& placement)
+    {
+        std::string line = placement.key_id;
+        line += '\t';
+        line += placement.set_id;
+        line += '\t';
+        line += std::to_string(placement.threshold);
+        line += '\t';
+        for (size_t i = 0; i < placement.node_ids.size(); ++i) {
+            if (i > 0) {
+                line += ',';
+            }
+            line += placement.node_ids[i];
+        }
+        line += '\n';
+        return line;
+    }
+
+    bool KeyPlacementStore::Parse(const std::string& line, KeyPlacement* placement)
+    {
+        std::vector<std::string> fields;
+        std::istringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, '\t')) {
+            fields.push_back(field);
+        }
+        if (fields.size() != 4 || fields[0].empty() || fields[3].empty()) {
+            return false;
+        }
+
+        placement->key_id = fields[0];
+        placement->set_id = fields[1];
+        try {
+            placement->threshold = static_cast<uint32_t>(std::stoul(fields[2]));
+        } catch (const std::exception&) {
+            return false;
+        }
+        std::istringstream nodes(fields[3]);
+        while (std::getline(nodes, field, ',')) {
+            placement->node_ids.push_back(field);
+        }
+        return true;
+    }
+}
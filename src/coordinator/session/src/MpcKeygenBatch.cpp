@@ -0,0 +1,365 @@
+// src/coordinator/session/src/MpcKeygenBatch.cpp
+#include "coordinator/session/include/MpcKeygenBatch.hpp"
+#include "types/MessageTypes.hpp"
+#include "common/utils/socket/SocketUtils.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include <algorithm>
+#include <atomic>
+#include <map>
+
+namespace mpc_engine::coordinator::session
+{
+    namespace
+    {
+        std::atomic<uint64_t> next_batch_number{1};
+        std::atomic<uint64_t> next_request_id{1};
+    }
+
+    MpcKeygenBatch::MpcKeygenBatch(NodeClientResolver resolver, std::chrono::milliseconds default_round_timeout)
+        : resolver(std::move(resolver)), default_round_timeout(default_round_timeout)
+    {
+    }
+
+    MpcKeygenBatchResult MpcKeygenBatch::Run(MpcKeygenBatchSpec spec)
+    {
+        auto start_time = std::chrono::steady_clock::now();
+        if (spec.batch_id.empty()) {
+            spec.batch_id = "keygen-" + std::to_string(utils::GetCurrentTimeMs()) + "-" + std::to_string(next_batch_number.fetch_add(1));
+        }
+        if (spec.round_timeout.count() <= 0) {
+            spec.round_timeout = default_round_timeout;
+        }
+
+        const size_t key_count = spec.key_ids.size();
+        MpcKeygenBatchResult result;
+        result.batch_id = spec.batch_id;
+        result.keys.resize(key_count);
+        for (size_t k = 0; k < key_count; ++k) {
+            result.keys[k].key_id = spec.key_ids[k];
+            result.keys[k].session_id = spec.batch_id + "-" + std::to_string(k);
+        }
+
+        // 키 실패 기록 (처음 실패 사유 유지)
+        auto fail_key = [&result](size_t k, MpcSessionStatus status, const std::string& error, const std::string& node_id) {
+            MpcKeygenKeyResult& key = result.keys[k];
+            if (key.status != MpcSessionStatus::RUNNING) {
+                return;
+            }
+            key.status = status;
+            key.error_message = error;
+            key.failed_node = node_id;
+        };
+        auto finish = [&]() {
+            for (const MpcKeygenKeyResult& key : result.keys) {
+                (key.status == MpcSessionStatus::COMPLETED ? result.completed : result.failed)++;
+            }
+            result.elapsed_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start_time).count());
+        };
+
+        // 1. 파라미터 검증 / 참여자 (keygen은 후보 전체)
+        if (spec.node_ids.empty() || spec.threshold == 0 || spec.threshold > spec.node_ids.size()) {
+            for (size_t k = 0; k < key_count; ++k) {
+                fail_key(k, MpcSessionStatus::FAILED, "Invalid threshold " + std::to_string(spec.threshold) +
+                         " for " + std::to_string(spec.node_ids.size()) + " nodes", std::string());
+            }
+            finish();
+            return result;
+        }
+        if (start_time >= spec.deadline) {
+            for (size_t k = 0; k < key_count; ++k) {
+                fail_key(k, MpcSessionStatus::TIMED_OUT, "Deadline exceeded before keygen start", std::string());
+            }
+            finish();
+            return result;
+        }
+
+        std::vector<Participant> participants;
+        std::vector<uint64_t> player_ids;
+        for (const std::string& node_id : spec.node_ids) {
+            std::shared_ptr<network::NodeTcpClient> client = resolver(node_id);
+            if (!client || !client->IsConnected()) {
+                continue;
+            }
+            participants.push_back(Participant{ node_id, static_cast<uint64_t>(client->GetShardIndex()) + 1, client });
+            player_ids.push_back(participants.back().player_id);
+            result.participants.push_back(node_id);
+        }
+        if (participants.size() < spec.node_ids.size()) {
+            for (size_t k = 0; k < key_count; ++k) {
+                fail_key(k, MpcSessionStatus::FAILED, "Only " + std::to_string(participants.size()) + " of " +
+                         std::to_string(spec.node_ids.size()) + " required nodes connected", std::string());
+            }
+            finish();
+            return result;
+        }
+
+        const uint32_t total_rounds = MpcProtocolRoundCount(MPC_PROTOCOL_KEYGEN);
+        std::vector<size_t> live(key_count);
+        for (size_t k = 0; k < key_count; ++k) {
+            live[k] = k;
+        }
+        std::vector<std::map<uint64_t, std::string>> outputs(key_count);   // 키별 직전 라운드 출력 (player_id → output)
+
+        for (uint32_t round = 1; round <= total_rounds && !live.empty(); ++round) {
+            // 2. 노드별 라운드 메시지 (살아 있는 키를 max_keys_per_message개씩)
+            size_t per_message = spec.max_keys_per_message > 0 ? spec.max_keys_per_message : live.size();
+            std::vector<Message> messages;
+            messages.reserve(participants.size() * ((live.size() + per_message - 1) / per_message));
+            for (size_t p = 0; p < participants.size(); ++p) {
+                for (size_t offset = 0; offset < live.size(); offset += per_message) {
+                    messages.emplace_back();
+                    Message& message = messages.back();
+                    message.participant = p;
+                    message.keys.assign(live.begin() + offset, live.begin() + std::min(live.size(), offset + per_message));
+
+                    message.request.set_message_type(static_cast<int32_t>(MessageType::MPC_ROUND_BATCH));
+                    MpcRoundBatchRequest* batch = message.request.mutable_mpc_round_batch_request();
+                    batch->mutable_header()->set_uid(spec.batch_id);
+                    batch->mutable_rounds()->Reserve(static_cast<int>(message.keys.size()));
+                    for (size_t k : message.keys) {
+                        MpcRoundRequest* request = batch->add_rounds();
+                        request->mutable_header()->set_uid(result.keys[k].session_id);
+                        request->set_session_id(result.keys[k].session_id);
+                        request->set_protocol(MPC_PROTOCOL_KEYGEN);
+                        request->set_round(round);
+                        request->set_total_rounds(total_rounds);
+                        request->set_key_id(spec.key_ids[k]);
+                        request->set_player_id(participants[p].player_id);
+                        request->set_threshold(spec.threshold);
+                        for (uint64_t player_id : player_ids) {
+                            request->add_player_ids(player_id);
+                        }
+                        if (round == 1) {
+                            request->set_session_input(spec.session_input);
+                        } else {
+                            request->mutable_peer_messages()->insert(outputs[k].begin(), outputs[k].end());
+                        }
+                    }
+                }
+            }
+            for (size_t k : live) {
+                outputs[k].clear();
+            }
+
+            auto inbox = std::make_shared<Inbox>();
+            // 요청자 기한이 먼저 오면 그 시각에 라운드를 끊음 (노드에는 남은 budget으로 전달)
+            auto deadline = std::min(std::chrono::steady_clock::now() + spec.round_timeout, spec.deadline);
+            bool deadline_cut = deadline == spec.deadline;
+            size_t pending = 0;
+            for (size_t i = 0; i < messages.size(); ++i) {
+                if (SendMessage(participants[messages[i].participant].client.get(), messages[i], inbox, i, deadline)) {
+                    result.messages_sent++;
+                    pending++;
+                    continue;
+                }
+                messages[i].answered = true;
+                const Participant& participant = participants[messages[i].participant];
+                for (size_t k : messages[i].keys) {
+                    fail_key(k, MpcSessionStatus::FAILED, "Failed to send round " + std::to_string(round) + " to " +
+                             participant.node_id, participant.node_id);
+                }
+            }
+
+            // 3. 응답 수집 (BUSY 재전송 / 라운드 타임아웃)
+            while (pending > 0) {
+                std::vector<std::pair<size_t, std::unique_ptr<CoordinatorNodeMessage>>> arrived;
+                {
+                    auto wake = deadline;
+                    for (const Message& message : messages) {
+                        if (message.retry_at != std::chrono::steady_clock::time_point()) {
+                            wake = std::min(wake, message.retry_at);
+                        }
+                    }
+                    std::unique_lock<std::mutex> lock(inbox->mutex);
+                    inbox->cv.wait_until(lock, wake, [&inbox] { return !inbox->responses.empty(); });
+                    arrived.swap(inbox->responses);
+                }
+                auto now = std::chrono::steady_clock::now();
+
+                for (auto& entry : arrived) {
+                    Message& message = messages[entry.first];
+                    std::unique_ptr<CoordinatorNodeMessage>& response = entry.second;
+                    if (message.answered) {
+                        continue;
+                    }
+                    message.request_id = 0;
+                    const Participant& participant = participants[message.participant];
+
+                    if (response && response->has_error_response() &&
+                        response->error_response().code() == NODE_ERROR_BUSY &&
+                        message.busy_retries < participant.client->GetBusyRetryLimit()) {
+                        participant.client->RecordBusyResponse();
+                        message.busy_retries++;
+                        message.retry_at = now + std::chrono::milliseconds(response->error_response().retry_after_ms());
+                        continue;
+                    }
+                    message.answered = true;
+                    pending--;
+
+                    // 메시지 전체 실패 → 묶인 키 모두 실패
+                    std::string error;
+                    if (!response) {
+                        error = "No response (connection lost)";
+                    } else if (response->has_error_response()) {
+                        error = NodeErrorCode_Name(response->error_response().code()) + ": " +
+                                response->error_response().header().error_message();
+                    } else if (!response->has_mpc_round_batch_response() ||
+                               response->mpc_round_batch_response().rounds_size() != static_cast<int>(message.keys.size())) {
+                        error = "Unexpected response payload";
+                    }
+                    if (!error.empty()) {
+                        for (size_t k : message.keys) {
+                            fail_key(k, MpcSessionStatus::FAILED, "Round " + std::to_string(round) + " failed on " +
+                                     participant.node_id + ": " + error, participant.node_id);
+                        }
+                        continue;
+                    }
+
+                    // 키별 결과
+                    MpcRoundBatchResponse* batch = response->mutable_mpc_round_batch_response();
+                    for (size_t i = 0; i < message.keys.size(); ++i) {
+                        size_t k = message.keys[i];
+                        MpcRoundResponse* round_response = batch->mutable_rounds(static_cast<int>(i));
+                        if (!round_response->header().success()) {
+                            error = round_response->header().error_message();
+                        } else if (round_response->session_id() != result.keys[k].session_id ||
+                                   round_response->round() != round || round_response->player_id() != participant.player_id) {
+                            error = "Mismatched round response";
+                        } else {
+                            outputs[k][participant.player_id] = std::move(*round_response->mutable_output());
+                            continue;
+                        }
+                        fail_key(k, MpcSessionStatus::FAILED, "Round " + std::to_string(round) + " failed on " +
+                                 participant.node_id + ": " + error, participant.node_id);
+                    }
+                }
+
+                for (size_t i = 0; i < messages.size(); ++i) {
+                    Message& message = messages[i];
+                    if (message.answered || message.retry_at == std::chrono::steady_clock::time_point() || message.retry_at > now) {
+                        continue;
+                    }
+                    message.retry_at = std::chrono::steady_clock::time_point();
+                    if (SendMessage(participants[message.participant].client.get(), message, inbox, i, deadline)) {
+                        result.messages_sent++;
+                        continue;
+                    }
+                    message.answered = true;
+                    pending--;
+                    const Participant& participant = participants[message.participant];
+                    for (size_t k : message.keys) {
+                        fail_key(k, MpcSessionStatus::FAILED, "Failed to resend round " + std::to_string(round) + " to " +
+                                 participant.node_id, participant.node_id);
+                    }
+                }
+
+                if (pending > 0 && now >= deadline) {
+                    for (Message& message : messages) {
+                        if (message.answered) {
+                            continue;
+                        }
+                        const Participant& participant = participants[message.participant];
+                        if (message.request_id != 0) {
+                            participant.client->CancelRequest(message.request_id);
+                        }
+                        if (!deadline_cut) {
+                            participant.client->MarkDegraded();
+                        }
+                        message.answered = true;
+                        for (size_t k : message.keys) {
+                            fail_key(k, MpcSessionStatus::TIMED_OUT,
+                                     deadline_cut
+                                         ? "Deadline exceeded in round " + std::to_string(round) + " waiting for " + participant.node_id
+                                         : "Round " + std::to_string(round) + " timed out after " +
+                                           std::to_string(spec.round_timeout.count()) + "ms waiting for " + participant.node_id,
+                                     participant.node_id);
+                        }
+                    }
+                    pending = 0;
+                }
+            }
+
+            // 4. 라운드 완료 - 남은 키만 다음 라운드로, 마지막 라운드면 결과 합의 확인
+            std::vector<size_t> next_live;
+            next_live.reserve(live.size());
+            for (size_t k : live) {
+                MpcKeygenKeyResult& key = result.keys[k];
+                if (key.status != MpcSessionStatus::RUNNING) {
+                    continue;
+                }
+                key.completed_rounds = round;
+                if (round < total_rounds) {
+                    next_live.push_back(k);
+                    continue;
+                }
+
+                const std::string& output = outputs[k].begin()->second;
+                bool agreed = true;
+                for (const auto& entry : outputs[k]) {
+                    agreed = agreed && entry.second == output;
+                }
+                if (agreed) {
+                    key.status = MpcSessionStatus::COMPLETED;
+                    key.public_key = output;
+                } else {
+                    fail_key(k, MpcSessionStatus::FAILED, "Participants disagree on final output", std::string());
+                }
+            }
+            live.swap(next_live);
+        }
+
+        // 5. 실패한 키는 노드 상태 폐기 요청 (응답 대기 없음)
+        SendAborts(participants, result);
+
+        finish();
+        LOG_INFOF("MpcKeygenBatch", "Batch %s: %zu/%zu keys generated in %llums (%llu messages)",
+                  result.batch_id.c_str(), result.completed, key_count,
+                  static_cast<unsigned long long>(result.elapsed_ms),
+                  static_cast<unsigned long long>(result.messages_sent));
+        return result;
+    }
+
+    bool MpcKeygenBatch::SendMessage(network::NodeTcpClient* client, Message& message,
+                                     const std::shared_ptr<Inbox>& inbox, size_t index, utils::Deadline deadline)
+    {
+        MpcRoundBatchRequest* batch = message.request.mutable_mpc_round_batch_request();
+        batch->mutable_header()->set_request_id(next_request_id.fetch_add(1));
+        batch->mutable_header()->set_send_time(std::to_string(utils::GetCurrentTimeMs()));
+
+        // 콜백은 응답만 넘김 (Run이 이미 반환했으면 inbox와 함께 버려짐)
+        message.request_id = client->SendRequestWithCallback(&message.request,
+            [inbox, index](std::unique_ptr<CoordinatorNodeMessage> response) {
+                {
+                    std::lock_guard<std::mutex> lock(inbox->mutex);
+                    inbox->responses.emplace_back(index, std::move(response));
+                }
+                inbox->cv.notify_one();
+            }, deadline);
+        if (message.request_id == 0) {
+            LOG_ERRORF("MpcKeygenBatch", "Failed to send %zu keygen rounds to %s", message.keys.size(), client->GetNodeId().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void MpcKeygenBatch::SendAborts(const std::vector<Participant>& participants, const MpcKeygenBatchResult& result)
+    {
+        CoordinatorNodeMessage message;
+        message.set_message_type(static_cast<int32_t>(MessageType::MPC_SESSION_ABORT));
+        MpcSessionAbortRequest* request = message.mutable_mpc_abort_request();
+
+        for (const MpcKeygenKeyResult& key : result.keys) {
+            if (key.status == MpcSessionStatus::COMPLETED) {
+                continue;
+            }
+            request->mutable_header()->set_uid(key.session_id);
+            request->set_session_id(key.session_id);
+            request->set_reason(key.error_message);
+            for (const Participant& participant : participants) {
+                request->mutable_header()->set_request_id(next_request_id.fetch_add(1));
+                participant.client->SendRequestWithCallback(&message, [](std::unique_ptr<CoordinatorNodeMessage>) {});
+            }
+        }
+    }
+}
@@ -0,0 +1,171 @@
+// src/coordinator/session/src/MpcRoundBatcher.cpp
+#include "coordinator/session/include/MpcRoundBatcher.hpp"
+#include "types/MessageTypes.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include <algorithm>
+
+namespace mpc_engine::coordinator::session
+{
+    namespace
+    {
+        // 배치 응답 → 라운드별 응답
+        void DispatchBatchResponse(std::vector<network::NodeResponseCallback>& callbacks,
+                                   std::unique_ptr<CoordinatorNodeMessage> response)
+        {
+            bool split = response && response->has_mpc_round_batch_response() &&
+                         response->mpc_round_batch_response().rounds_size() == static_cast<int>(callbacks.size());
+            if (!split) {
+                // 연결 끊김 / 배치 전체 에러 → 모든 라운드에 같은 결과
+                for (size_t i = 0; i < callbacks.size(); ++i) {
+                    callbacks[i](response ? std::make_unique<CoordinatorNodeMessage>(*response) : nullptr);
+                }
+                return;
+            }
+
+            MpcRoundBatchResponse* batch = response->mutable_mpc_round_batch_response();
+            for (size_t i = 0; i < callbacks.size(); ++i) {
+                auto message = std::make_unique<CoordinatorNodeMessage>();
+                message->set_message_type(static_cast<int32_t>(MessageType::MPC_ROUND));
+                message->mutable_mpc_round_response()->Swap(batch->mutable_rounds(static_cast<int>(i)));
+                callbacks[i](std::move(message));
+            }
+        }
+    }
+
+    MpcRoundBatcher::MpcRoundBatcher(MpcRoundBatchConfig config)
+        : config(config)
+    {
+        flush_thread = std::thread(&MpcRoundBatcher::FlushLoop, this);
+    }
+
+    MpcRoundBatcher::~MpcRoundBatcher()
+    {
+        Shutdown();
+    }
+
+    bool MpcRoundBatcher::Submit(std::shared_ptr<network::NodeTcpClient> client, const MpcRoundRequest& request,
+                                 network::NodeResponseCallback callback, utils::Deadline deadline)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stop) {
+            return false;
+        }
+
+        PendingBatch& batch = pending[client.get()];
+        bool first = batch.items.empty();
+        if (first) {
+            batch.client = std::move(client);
+            batch.deadline = std::chrono::steady_clock::now() + config.window;
+        }
+        batch.items.push_back(Item{ request, std::move(callback), deadline });
+
+        // 가득 차면 즉시 전송 대상
+        bool full = batch.items.size() == config.max_batch;
+        if (full) {
+            batch.deadline = std::chrono::steady_clock::time_point::min();
+        }
+        if (first || full) {
+            cv.notify_one();
+        }
+        return true;
+    }
+
+    void MpcRoundBatcher::FlushLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            auto now = std::chrono::steady_clock::now();
+            auto next_deadline = std::chrono::steady_clock::time_point::max();
+            std::vector<std::pair<std::shared_ptr<network::NodeTcpClient>, std::vector<Item>>> due;
+
+            // 보낼 묶음은 항목째 제거 - 해제된 노드의 클라이언트를 pending이 붙잡고 있지 않도록
+            for (auto it = pending.begin(); it != pending.end();) {
+                PendingBatch& batch = it->second;
+                if (stop || batch.deadline <= now) {
+                    due.emplace_back(std::move(batch.client), std::move(batch.items));
+                    it = pending.erase(it);
+                } else {
+                    next_deadline = std::min(next_deadline, batch.deadline);
+                    ++it;
+                }
+            }
+
+            if (!due.empty()) {
+                lock.unlock();
+                for (auto& entry : due) {
+                    // max_batch 초과분(flush 전에 더 들어온 것)은 나눠서 전송
+                    std::vector<Item>& items = entry.second;
+                    for (size_t offset = 0; offset < items.size(); offset += config.max_batch) {
+                        size_t end = std::min(items.size(), offset + config.max_batch);
+                        SendBatch(entry.first, std::vector<Item>(std::make_move_iterator(items.begin() + offset),
+                                                                 std::make_move_iterator(items.begin() + end)));
+                    }
+                }
+                lock.lock();
+                continue;
+            }
+
+            if (stop) {
+                break;
+            }
+            if (next_deadline == std::chrono::steady_clock::time_point::max()) {
+                cv.wait(lock);
+            } else {
+                cv.wait_until(lock, next_deadline);
+            }
+        }
+    }
+
+    void MpcRoundBatcher::SendBatch(const std::shared_ptr<network::NodeTcpClient>& client, std::vector<Item> items)
+    {
+        auto callbacks = std::make_shared<std::vector<network::NodeResponseCallback>>();
+        callbacks->reserve(items.size());
+
+        CoordinatorNodeMessage message;
+        message.set_message_type(static_cast<int32_t>(MessageType::MPC_ROUND_BATCH));
+        MpcRoundBatchRequest* batch = message.mutable_mpc_round_batch_request();
+        batch->mutable_header()->set_request_id(next_request_id.fetch_add(1));
+        batch->mutable_rounds()->Reserve(static_cast<int>(items.size()));
+        // 한 라운드라도 아직 기한 안이면 보냄 (기한이 지난 라운드는 세션 타이머가 먼저 끝냄)
+        utils::Deadline deadline = std::chrono::steady_clock::time_point::min();
+        for (Item& item : items) {
+            batch->add_rounds()->Swap(&item.request);
+            callbacks->push_back(std::move(item.callback));
+            deadline = std::max(deadline, item.deadline);
+        }
+
+        uint64_t request_id = client->SendRequestWithCallback(&message,
+            [callbacks](std::unique_ptr<CoordinatorNodeMessage> response) {
+                DispatchBatchResponse(*callbacks, std::move(response));
+            }, deadline);
+        if (request_id == 0) {
+            LOG_ERRORF("MpcRoundBatcher", "Failed to send batch of %zu rounds to %s",
+                       callbacks->size(), client->GetNodeId().c_str());
+            DispatchBatchResponse(*callbacks, nullptr);
+            return;
+        }
+
+        batches_sent++;
+        rounds_sent += callbacks->size();
+    }
+
+    void MpcRoundBatcher::Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_all();
+        if (flush_thread.joinable()) {
+            flush_thread.join();
+        }
+    }
+
+    MpcRoundBatcherStats MpcRoundBatcher::GetStats() const
+    {
+        MpcRoundBatcherStats stats;
+        stats.batches_sent = batches_sent.load();
+        stats.rounds_sent = rounds_sent.load();
+        return stats;
+    }
+}
@@ -0,0 +1,1005 @@
+// src/coordinator/session/src/MpcSessionEngine.cpp
+#include "coordinator/session/include/MpcSessionEngine.hpp"
+#include "types/MessageTypes.hpp"
+#include "common/utils/socket/SocketUtils.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include <algorithm>
+#include <cstring>
+#include <future>
+
+namespace mpc_engine::coordinator::session
+{
+    uint32_t MpcProtocolRoundCount(MpcProtocol protocol)
+    {
+        switch (protocol) {
+            case MPC_PROTOCOL_KEYGEN:           return 5;   // commitment → decommitment → ZK proof → Paillier proof → public key
+            case MPC_PROTOCOL_ECDSA_SIGNING:    return 5;   // MtA request → MtA response → delta → partial sig → final sig
+            case MPC_PROTOCOL_EDDSA_SIGNING:    return 5;   // commitment → R → R/commitments → partial sig → final sig
+            case MPC_PROTOCOL_ECDSA_PRESIGN:    return 4;   // MtA request → MtA response → delta → presignature (메시지 무관)
+            case MPC_PROTOCOL_ECDSA_ONLINE_SIGNING: return 1;   // presignature + 메시지 해시 → final sig
+            default:                            return 0;
+        }
+    }
+
+    const char* MpcSessionStatusToString(MpcSessionStatus status)
+    {
+        switch (status) {
+            case MpcSessionStatus::RUNNING:     return "RUNNING";
+            case MpcSessionStatus::COMPLETED:   return "COMPLETED";
+            case MpcSessionStatus::FAILED:      return "FAILED";
+            case MpcSessionStatus::TIMED_OUT:   return "TIMED_OUT";
+            case MpcSessionStatus::ABORTED:     return "ABORTED";
+            default:                            return "UNKNOWN";
+        }
+    }
+
+    namespace
+    {
+        // 참여자를 바꿔 다시 시작해도 되는 프로토콜 (keygen은 후보 전체, 온라인 서명은 presign 참여자 고정, presign은 백그라운드)
+        bool IsHedgeableProtocol(MpcProtocol protocol)
+        {
+            return protocol == MPC_PROTOCOL_ECDSA_SIGNING || protocol == MPC_PROTOCOL_EDDSA_SIGNING;
+        }
+
+        // round_message에서 참여자별로 바뀌는 라운드 요청 (mesh 세션은 감싼 round 1 요청)
+        MpcRoundRequest* MutableRoundRequest(CoordinatorNodeMessage& message, bool mesh)
+        {
+            return mesh ? message.mutable_mpc_mesh_session_request()->mutable_session() : message.mutable_mpc_round_request();
+        }
+    }
+
+    MpcSessionEngine::MpcSessionEngine(NodeClientResolver resolver, std::chrono::milliseconds default_round_timeout,
+                                       MpcRoundBatchConfig batching, NodeCandidateOrder candidate_order)
+        : resolver(std::move(resolver)), candidate_order(std::move(candidate_order)), default_round_timeout(default_round_timeout)
+    {
+        SetRoundBatching(batching);
+        timer_thread = std::thread(&MpcSessionEngine::TimerLoop, this);
+    }
+
+    MpcSessionEngine::~MpcSessionEngine()
+    {
+        Shutdown();
+    }
+
+    std::string MpcSessionEngine::Start(MpcSessionSpec spec, MpcSessionCallback callback)
+    {
+        return StartSession(std::move(spec), std::move(callback), true);
+    }
+
+    std::string MpcSessionEngine::StartSession(MpcSessionSpec spec, MpcSessionCallback callback, bool allow_hedge)
+    {
+        if (spec.session_id.empty()) {
+            spec.session_id = "mpc-" + std::to_string(utils::GetCurrentTimeMs()) + "-" + std::to_string(next_session_number.fetch_add(1));
+        }
+        if (spec.round_timeout.count() <= 0) {
+            spec.round_timeout = default_round_timeout;
+        }
+
+        auto session = std::make_shared<Session>();
+        session->spec = std::move(spec);
+        session->callback = std::move(callback);
+        session->total_rounds = MpcProtocolRoundCount(session->spec.protocol);
+        session->start_time = std::chrono::steady_clock::now();
+        const std::string session_id = session->spec.session_id;
+
+        auto reject = [&](MpcSessionStatus status, const std::string& reason) {
+            LOG_ERRORF("MpcSessionEngine", "Session %s not started: %s", session_id.c_str(), reason.c_str());
+            MpcSessionResult result;
+            result.session_id = session_id;
+            result.status = status;
+            result.error_message = reason;
+            (status == MpcSessionStatus::ABORTED ? aborted_count :
+             status == MpcSessionStatus::TIMED_OUT ? timed_out_count : failed_count)++;
+            Complete(session->callback, result);
+            return session_id;
+        };
+
+        // 1. 파라미터 검증
+        const MpcSessionSpec& s = session->spec;
+        if (session->total_rounds == 0) {
+            return reject(MpcSessionStatus::FAILED, "Unsupported MPC protocol");
+        }
+        if (session->start_time >= s.deadline) {
+            return reject(MpcSessionStatus::TIMED_OUT, "Deadline exceeded before session start");
+        }
+        if (s.node_ids.empty() || s.threshold == 0 || s.threshold > s.node_ids.size()) {
+            return reject(MpcSessionStatus::FAILED, "Invalid threshold " + std::to_string(s.threshold) +
+                          " for " + std::to_string(s.node_ids.size()) + " nodes");
+        }
+
+        // 2. 참여자 선택 - keygen은 후보 전체, 서명은 연결된 노드 중 threshold개 (여유 후보가 있으면 선택 정책 순)
+        size_t needed = (s.protocol == MPC_PROTOCOL_KEYGEN) ? s.node_ids.size() : s.threshold;
+        std::vector<std::string> candidates = (candidate_order && s.node_ids.size() > needed) ? candidate_order(s.node_ids) : s.node_ids;
+        for (const std::string& node_id : candidates) {
+            if (session->participants.size() == needed) {
+                break;
+            }
+            std::shared_ptr<network::NodeTcpClient> client = resolver(node_id);
+            if (!client || !client->IsConnected()) {
+                continue;
+            }
+            Participant participant;
+            participant.node_id = node_id;
+            participant.player_id = static_cast<uint64_t>(client->GetShardIndex()) + 1;   // player id는 0이 아니어야 함
+            participant.client = client;
+            session->participants.push_back(participant);
+            session->player_ids.push_back(participant.player_id);
+        }
+        if (session->participants.size() < needed) {
+            return reject(MpcSessionStatus::FAILED, "Only " + std::to_string(session->participants.size()) + " of " +
+                          std::to_string(needed) + " required nodes connected");
+        }
+        // 라운드 메시지 중계가 없는 mesh 세션은 라운드 단위 hedge 대상이 아님
+        session->mesh = peer_mesh.load() && session->total_rounds > 1 &&
+            std::all_of(session->participants.begin(), session->participants.end(), [](const Participant& participant) {
+                return participant.client->GetPeerMeshPort() > 0;
+            });
+        session->relay = !session->mesh && opaque_relay.load() && session->total_rounds > 1;
+        if (allow_hedge && !session->mesh && IsHedgeableProtocol(s.protocol) && s.node_ids.size() > needed) {
+            session->hedge = GetHedging();
+        }
+
+        // 3. 등록
+        {
+            std::lock_guard<std::mutex> lock(sessions_mutex);
+            if (!accepting) {
+                return reject(MpcSessionStatus::ABORTED, "Session engine is shutting down");
+            }
+            if (!sessions.emplace(session_id, session).second) {
+                return reject(MpcSessionStatus::FAILED, "Duplicate session id");
+            }
+        }
+        started_count++;
+        if (session->hedge.Enabled()) {
+            hedge_eligible_count++;
+        }
+        if (session->mesh) {
+            mesh_session_count++;
+        }
+        if (session->relay) {
+            relay_session_count++;
+        }
+
+        // 4. Round 1 시작 - 이후 라운드는 응답 콜백에서 진행
+        MpcSessionResult result;
+        MpcSessionCallback completion;
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            if (session->finished || StartRoundLocked(session, 1)) {
+                return session_id;
+            }
+            result = FinishLocked(*session, MpcSessionStatus::FAILED, "Failed to dispatch round 1", std::string());
+            completion = std::move(session->callback);
+        }
+        Complete(completion, result);
+        return session_id;
+    }
+
+    MpcSessionResult MpcSessionEngine::Run(MpcSessionSpec spec)
+    {
+        std::promise<MpcSessionResult> promise;
+        std::future<MpcSessionResult> future = promise.get_future();
+        Start(std::move(spec), [&promise](const MpcSessionResult& result) {
+            promise.set_value(result);
+        });
+        return future.get();
+    }
+
+    bool MpcSessionEngine::StartRoundLocked(const std::shared_ptr<Session>& session, uint32_t round)
+    {
+        const MpcSessionSpec& spec = session->spec;
+
+        // 직전 라운드 출력 → 이번 라운드 입력
+        std::map<uint64_t, std::string> previous_outputs;
+        previous_outputs.swap(session->round_outputs);
+        session->forward_envelopes.clear();
+        for (auto& entry : session->round_envelopes) {
+            session->forward_envelopes.push_back(std::move(entry.second));
+        }
+        session->round_envelopes.clear();
+        session->round = round;
+
+        CoordinatorNodeMessage& message = session->round_message;
+        message.Clear();
+        if (session->mesh) {
+            message.set_message_type(static_cast<int32_t>(MessageType::MPC_MESH_SESSION));
+            MpcMeshSessionRequest* mesh_request = message.mutable_mpc_mesh_session_request();
+            mesh_request->mutable_header()->set_uid(spec.session_id);
+            mesh_request->set_round_timeout_ms(static_cast<uint32_t>(spec.round_timeout.count()));
+            for (const Participant& participant : session->participants) {
+                MpcMeshPeer* peer = mesh_request->add_peers();
+                peer->set_player_id(participant.player_id);
+                peer->set_node_id(participant.node_id);
+                peer->set_host(participant.client->GetPeerMeshHost());
+                peer->set_port(participant.client->GetPeerMeshPort());
+            }
+        } else {
+            message.set_message_type(static_cast<int32_t>(MessageType::MPC_ROUND));
+        }
+        MpcRoundRequest* request = MutableRoundRequest(message, session->mesh);
+        request->mutable_header()->set_uid(spec.session_id);
+        request->mutable_header()->set_send_time(std::to_string(utils::GetCurrentTimeMs()));
+        request->set_session_id(spec.session_id);
+        request->set_protocol(spec.protocol);
+        request->set_round(round);
+        request->set_total_rounds(session->total_rounds);
+        request->set_key_id(spec.key_id);
+        request->set_threshold(spec.threshold);
+        for (uint64_t player_id : session->player_ids) {
+            request->add_player_ids(player_id);
+        }
+        if (round == 1) {
+            request->set_session_input(spec.session_input);
+            request->set_presignature_id(spec.presignature_id);
+        } else {
+            for (auto& entry : previous_outputs) {
+                (*request->mutable_peer_messages())[entry.first] = std::move(entry.second);
+            }
+        }
+
+        // 라운드 타임아웃 (mesh 세션은 세션 전체) - 전송 전에 정해야 노드에 남은 budget으로 함께 전달됨
+        auto now = std::chrono::steady_clock::now();
+        session->round_deadline = std::min(now + spec.round_timeout * (session->mesh ? session->total_rounds : 1), spec.deadline);
+
+        for (size_t i = 0; i < session->participants.size(); ++i) {
+            session->participants[i].busy_retries = 0;
+            if (!SendToParticipantLocked(session, i)) {
+                return false;
+            }
+        }
+
+        ScheduleLocked(RoundDeadline{ session->round_deadline, session, round });
+
+        // 참여자별 hedge 검사 (자기 p95 경과 시점) - 세션당 1회, 비율 상한이 남아 있을 때만
+        if (session->hedge.Enabled() && !session->hedge_group &&
+            static_cast<double>(hedge_count.load()) < session->hedge.max_ratio * static_cast<double>(hedge_eligible_count.load())) {
+            for (size_t i = 0; i < session->participants.size(); ++i) {
+                uint64_t p95_ns = session->participants[i].client->GetLatencyP95Ns();
+                if (p95_ns == 0) {
+                    continue;   // 표본 부족
+                }
+                auto delay = std::max<std::chrono::nanoseconds>(std::chrono::nanoseconds(p95_ns), session->hedge.min_delay);
+                ScheduleLocked(RoundDeadline{ now + delay, session, round, DeadlineKind::HEDGE, i });
+            }
+        }
+        return true;
+    }
+
+    bool MpcSessionEngine::SendToParticipantLocked(const std::shared_ptr<Session>& session, size_t index)
+    {
+        Participant& participant = session->participants[index];
+        MpcRoundRequest* request = MutableRoundRequest(session->round_message, session->mesh);
+        uint32_t round = session->round;
+        request->set_player_id(participant.player_id);
+        request->mutable_header()->set_request_id(next_request_id.fetch_add(1));
+        if (session->mesh) {
+            session->round_message.mutable_mpc_mesh_session_request()->mutable_header()->set_request_id(request->header().request_id());
+        }
+
+        auto on_response = [this, session, round, index](std::unique_ptr<CoordinatorNodeMessage> response) {
+            OnRoundResponse(session, round, index, std::move(response));
+        };
+
+        if (session->relay) {
+            framing::NetworkMessage frame = BuildRelayFrameLocked(*session, participant.player_id);
+            if (frame.header.body_length > framing::MAX_BODY_SIZE) {
+                LOG_ERRORF("MpcSessionEngine", "Session %s: round %u relay frame for %s is %u bytes (max %u)",
+                           session->spec.session_id.c_str(), round, participant.node_id.c_str(),
+                           frame.header.body_length, framing::MAX_BODY_SIZE);
+                return false;
+            }
+            participant.request_id = participant.client->SendFrameWithCallback(std::move(frame),
+                [this, session, round, index](std::unique_ptr<framing::NetworkMessage> response) {
+                    OnRelayResponse(session, round, index, std::move(response));
+                }, session->round_deadline);
+        } else {
+            std::shared_ptr<MpcRoundBatcher> round_batcher;
+            {
+                std::lock_guard<std::mutex> lock(batcher_mutex);
+                round_batcher = batcher;
+            }
+            if (round_batcher && !session->mesh &&
+                round_batcher->Submit(participant.client, *request, on_response, session->round_deadline)) {
+                participant.request_id = BATCHED_REQUEST;
+                return true;
+            }
+            participant.request_id = participant.client->SendRequestWithCallback(&session->round_message, on_response,
+                                                                                 session->round_deadline);
+        }
+        if (participant.request_id == 0) {
+            LOG_ERRORF("MpcSessionEngine", "Session %s: failed to send round %u to %s",
+                       session->spec.session_id.c_str(), round, participant.node_id.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    framing::NetworkMessage MpcSessionEngine::BuildRelayFrameLocked(const Session& session, uint64_t player_id) const
+    {
+        uint32_t envelope_count = 0;
+        for (const RelayEnvelope& envelope : session.forward_envelopes) {
+            envelope_count += envelope.view.AddressedTo(player_id) ? 1 : 0;
+        }
+
+        // 라운드 요청만 직렬화 (envelope 크기와 무관)
+        framing::NetworkMessage frame;
+        framing::RelayFrameHeader header;
+        header.request_length = static_cast<uint32_t>(session.round_message.ByteSizeLong());
+        header.envelope_count = envelope_count;
+        frame.body.resize(framing::RelayFramePrefixSize(header.request_length));
+        memcpy(frame.body.data(), &header, sizeof(header));
+        session.round_message.SerializeWithCachedSizesToArray(frame.body.data() + sizeof(header));
+
+        // envelope는 응답 body를 그대로 공유 - checksum도 응답 header 값을 XOR (4바이트 정렬)
+        uint32_t checksum = framing::MessageHeader::ComputeChecksum(frame.body);
+        size_t body_length = frame.body.size();
+        for (const RelayEnvelope& envelope : session.forward_envelopes) {
+            if (envelope.view.AddressedTo(player_id)) {
+                frame.segments.push_back(envelope.frame);
+                checksum ^= envelope.checksum;
+                body_length += envelope.frame->size();
+            }
+        }
+
+        frame.header.message_type = static_cast<uint16_t>(MessageType::MPC_RELAY_ROUND);
+        frame.header.body_length = static_cast<uint32_t>(std::min<size_t>(body_length, UINT32_MAX));
+        frame.header.checksum = checksum;
+        return frame;
+    }
+
+    void MpcSessionEngine::ScheduleLocked(RoundDeadline entry)
+    {
+        std::lock_guard<std::mutex> lock(timer_mutex);
+        bool earliest = deadlines.empty() || entry.deadline < deadlines.top().deadline;
+        deadlines.push(std::move(entry));
+        if (earliest) {
+            timer_cv.notify_one();
+        }
+    }
+
+    void MpcSessionEngine::OnRoundResponse(const std::shared_ptr<Session>& session, uint32_t round, size_t index,
+                                           std::unique_ptr<CoordinatorNodeMessage> response)
+    {
+        MpcSessionResult result;
+        MpcSessionCallback completion;
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            if (session->finished || session->round != round) {
+                return;     // 이미 종료 / 지난 라운드
+            }
+
+            Participant& participant = session->participants[index];
+            if (participant.request_id == 0) {
+                return;
+            }
+            participant.request_id = 0;
+
+            // 1. 응답 검증 - 한 참여자라도 실패하면 세션 실패 (참여자 집합은 세션 동안 고정)
+            // BUSY: retry_after_ms 후 같은 참여자에게 재전송 (라운드 타임아웃 안에서만)
+            if (response && response->has_error_response() &&
+                response->error_response().code() == NODE_ERROR_BUSY &&
+                participant.busy_retries < participant.client->GetBusyRetryLimit()) {
+                participant.client->RecordBusyResponse();
+                participant.busy_retries++;
+                participant.retry_pending = true;
+                ScheduleLocked(RoundDeadline{ std::chrono::steady_clock::now() +
+                                              std::chrono::milliseconds(response->error_response().retry_after_ms()),
+                                              session, round, DeadlineKind::BUSY_RETRY, index });
+                return;
+            }
+
+            std::string error;
+            if (!response) {
+                error = "No response (connection lost)";
+            } else if (response->has_error_response()) {
+                error = NodeErrorCode_Name(response->error_response().code()) + ": " +
+                        response->error_response().header().error_message();
+            } else if (session->mesh) {
+                const MpcMeshSessionResponse& mesh_response = response->mpc_mesh_session_response();
+                if (!response->has_mpc_mesh_session_response()) {
+                    error = "Unexpected response payload";
+                } else if (!mesh_response.header().success()) {
+                    error = mesh_response.header().error_message();
+                } else if (mesh_response.session_id() != session->spec.session_id ||
+                           mesh_response.player_id() != participant.player_id ||
+                           mesh_response.completed_rounds() != session->total_rounds) {
+                    error = "Mismatched mesh session response";
+                }
+            } else if (session->relay || !response->has_mpc_round_response()) {
+                error = "Unexpected response payload";
+            } else if (!response->mpc_round_response().header().success()) {
+                error = response->mpc_round_response().header().error_message();
+            } else if (response->mpc_round_response().session_id() != session->spec.session_id ||
+                       response->mpc_round_response().round() != round ||
+                       response->mpc_round_response().player_id() != participant.player_id) {
+                error = "Mismatched round response";
+            }
+
+            if (!error.empty()) {
+                result = FinishLocked(*session, MpcSessionStatus::FAILED,
+                                      (session->mesh ? std::string("Mesh session") : "Round " + std::to_string(round)) +
+                                      " failed on " + participant.node_id + ": " + error,
+                                      participant.node_id);
+                completion = std::move(session->callback);
+            } else {
+                session->round_outputs[participant.player_id] = session->mesh
+                    ? std::move(*response->mutable_mpc_mesh_session_response()->mutable_output())
+                    : std::move(*response->mutable_mpc_round_response()->mutable_output());
+
+                // 2. 라운드 완료 → 다음 라운드 / 최종 결과
+                if (!AdvanceLocked(session, round, &result)) {
+                    return;
+                }
+                completion = std::move(session->callback);
+            }
+        }
+        Complete(completion, result);
+    }
+
+    void MpcSessionEngine::OnRelayResponse(const std::shared_ptr<Session>& session, uint32_t round, size_t index,
+                                           std::unique_ptr<framing::NetworkMessage> response)
+    {
+        RelayEnvelope envelope;
+        bool is_envelope = response && response->header.message_type == static_cast<uint16_t>(MessageType::MPC_RELAY_ROUND) &&
+            framing::DecodeRelayEnvelope(response->body.data(), response->body.size(), &envelope.view) &&
+            envelope.view.size == response->body.size();
+
+        // 에러 응답(BUSY 등, protobuf body) / 연결 끊김은 기존 경로로
+        if (!is_envelope) {
+            std::unique_ptr<CoordinatorNodeMessage> message;
+            if (response) {
+                message = std::make_unique<CoordinatorNodeMessage>();
+                if (!message->ParseFromArray(response->body.data(), static_cast<int>(response->body.size()))) {
+                    message->Clear();
+                    message->mutable_error_response()->set_code(NODE_ERROR_INVALID);
+                    message->mutable_error_response()->mutable_header()->set_error_message("Malformed relay response");
+                } else if (network::NodeTcpClient::IsRetryableNodeError(*message)) {
+                    session->participants[index].client->MarkDegraded();
+                }
+            }
+            OnRoundResponse(session, round, index, std::move(message));
+            return;
+        }
+
+        // view는 body 버퍼를 가리킴 - vector move는 버퍼를 그대로 넘기므로 유효
+        envelope.checksum = response->header.checksum;
+        envelope.frame = std::make_shared<const std::vector<uint8_t>>(std::move(response->body));
+
+        MpcSessionResult result;
+        MpcSessionCallback completion;
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            if (session->finished || session->round != round) {
+                return;
+            }
+
+            Participant& participant = session->participants[index];
+            if (participant.request_id == 0) {
+                return;
+            }
+            participant.request_id = 0;
+
+            if (envelope.view.session_id != session->spec.session_id || envelope.view.round != round ||
+                envelope.view.from_player != participant.player_id) {
+                result = FinishLocked(*session, MpcSessionStatus::FAILED,
+                                      "Round " + std::to_string(round) + " failed on " + participant.node_id + ": Mismatched relay envelope",
+                                      participant.node_id);
+            } else {
+                session->round_envelopes[participant.player_id] = std::move(envelope);
+                if (!AdvanceLocked(session, round, &result)) {
+                    return;
+                }
+            }
+            completion = std::move(session->callback);
+        }
+        Complete(completion, result);
+    }
+
+    bool MpcSessionEngine::AdvanceLocked(const std::shared_ptr<Session>& session, uint32_t round, MpcSessionResult* result)
+    {
+        size_t collected = session->relay ? session->round_envelopes.size() : session->round_outputs.size();
+        if (collected < session->participants.size()) {
+            return false;
+        }
+
+        if (round < session->total_rounds && !session->mesh) {
+            if (StartRoundLocked(session, round + 1)) {
+                return false;
+            }
+            *result = FinishLocked(*session, MpcSessionStatus::FAILED,
+                                   "Failed to dispatch round " + std::to_string(round + 1), std::string());
+            return true;
+        }
+
+        // 모든 참여자가 같은 결과(공개키/서명)를 내야 함 - relay 세션은 여기서만 payload를 읽음
+        for (const auto& entry : session->round_envelopes) {
+            session->round_outputs[entry.first] = std::string(entry.second.view.payload);
+        }
+        const std::string& output = session->round_outputs.begin()->second;
+        bool agreed = true;
+        for (const auto& entry : session->round_outputs) {
+            agreed = agreed && entry.second == output;
+        }
+        *result = agreed
+            ? FinishLocked(*session, MpcSessionStatus::COMPLETED, std::string(), std::string(), output)
+            : FinishLocked(*session, MpcSessionStatus::FAILED, "Participants disagree on final output", std::string());
+        return true;
+    }
+
+    void MpcSessionEngine::OnRoundTimeout(const std::shared_ptr<Session>& session, uint32_t round)
+    {
+        MpcSessionResult result;
+        MpcSessionCallback completion;
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            if (session->finished || session->round != round) {
+                return;
+            }
+
+            // 요청자 기한으로 잘린 라운드는 노드가 느린 것이 아님 - 참여자 선택 순위를 바꾸지 않음
+            bool deadline_cut = session->round_deadline == session->spec.deadline;
+            std::string straggler;
+            for (const Participant& participant : session->participants) {
+                if (participant.request_id != 0 || participant.retry_pending) {
+                    straggler = participant.node_id;
+                    if (!deadline_cut) {
+                        participant.client->MarkDegraded();     // 다음 세션의 참여자 선택에서 후순위
+                    }
+                    break;
+                }
+            }
+            auto timeout = session->spec.round_timeout * (session->mesh ? session->total_rounds : 1);
+            std::string scope = session->mesh ? std::string("Mesh session") : "Round " + std::to_string(round);
+            result = FinishLocked(*session, MpcSessionStatus::TIMED_OUT,
+                                  deadline_cut
+                                      ? "Deadline exceeded in " + (session->mesh ? std::string("mesh session") : "round " + std::to_string(round)) +
+                                        " waiting for " + straggler
+                                      : scope + " timed out after " + std::to_string(timeout.count()) + "ms waiting for " + straggler,
+                                  straggler);
+            completion = std::move(session->callback);
+        }
+        Complete(completion, result);
+    }
+
+    void MpcSessionEngine::OnRetryDue(const std::shared_ptr<Session>& session, uint32_t round, size_t index)
+    {
+        MpcSessionResult result;
+        MpcSessionCallback completion;
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            Participant& participant = session->participants[index];
+            if (session->finished || session->round != round || !participant.retry_pending) {
+                return;
+            }
+            participant.retry_pending = false;
+            if (SendToParticipantLocked(session, index)) {
+                return;
+            }
+            result = FinishLocked(*session, MpcSessionStatus::FAILED,
+                                  "Failed to resend round " + std::to_string(round) + " to " + participant.node_id,
+                                  participant.node_id);
+            completion = std::move(session->callback);
+        }
+        Complete(completion, result);
+    }
+
+    void MpcSessionEngine::OnHedgeDue(const std::shared_ptr<Session>& session, uint32_t round, size_t index)
+    {
+        auto still_waiting = [&]() {
+            const Participant& participant = session->participants[index];
+            return !session->finished && session->round == round && !session->hedge_group &&
+                   (participant.request_id != 0 || participant.retry_pending);
+        };
+
+        // 1. 느린 참여자를 뺀 후보 (예비 후보가 threshold를 채울 만큼 연결되어 있어야 함)
+        MpcSessionSpec hedge_spec;
+        std::string slow_node;
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            if (!still_waiting()) {
+                return;
+            }
+            slow_node = session->participants[index].node_id;
+            hedge_spec = session->spec;
+        }
+        hedge_spec.node_ids.erase(std::remove(hedge_spec.node_ids.begin(), hedge_spec.node_ids.end(), slow_node),
+                                  hedge_spec.node_ids.end());
+        size_t connected = std::count_if(hedge_spec.node_ids.begin(), hedge_spec.node_ids.end(), [this](const std::string& node_id) {
+            std::shared_ptr<network::NodeTcpClient> client = resolver(node_id);
+            return client && client->IsConnected();
+        });
+        if (connected < hedge_spec.threshold) {
+            return;
+        }
+
+        // 2. 원래 callback을 그룹으로 옮기고 hedge 세션 시작 (hedge 세션은 다시 hedge하지 않음)
+        auto group = std::make_shared<HedgeGroup>();
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            if (!still_waiting() || !TryAcquireHedge(session->hedge.max_ratio)) {
+                return;
+            }
+            session->participants[index].client->MarkDegraded();
+            group->callback = std::move(session->callback);
+            group->primary_id = session->spec.session_id;
+            group->hedge_id = session->spec.session_id + "-hedge";
+            group->start_time = session->start_time;
+            session->callback = [this, group](const MpcSessionResult& result) {
+                OnHedgedSessionDone(group, false, result);
+            };
+            session->hedge_group = group;
+        }
+
+        LOG_DEBUGF("MpcSessionEngine", "Session %s: %s has not answered round %u within its p95, hedging",
+                   group->primary_id.c_str(), slow_node.c_str(), round);
+        hedge_spec.session_id = group->hedge_id;
+        StartSession(std::move(hedge_spec), [this, group](const MpcSessionResult& result) {
+            OnHedgedSessionDone(group, true, result);
+        }, false);
+    }
+
+    void MpcSessionEngine::OnHedgedSessionDone(const std::shared_ptr<HedgeGroup>& group, bool is_hedge, const MpcSessionResult& result)
+    {
+        MpcSessionResult delivered;
+        MpcSessionCallback completion;
+        std::string loser;
+        {
+            std::lock_guard<std::mutex> lock(group->mutex);
+            if (group->delivered) {
+                return;     // 이미 다른 쪽 결과 전달 (진 쪽의 abort 통보)
+            }
+            if (!is_hedge) {
+                group->primary_result = result;
+            }
+
+            if (result.status == MpcSessionStatus::COMPLETED) {
+                delivered = result;
+                loser = is_hedge ? group->primary_id : group->hedge_id;
+            } else if (--group->outstanding == 0) {
+                delivered = group->primary_result;
+            } else {
+                return;     // 다른 쪽 결과 대기
+            }
+            group->delivered = true;
+            completion = std::move(group->callback);
+        }
+
+        delivered.session_id = group->primary_id;
+        delivered.hedged = true;
+        delivered.hedge_won = is_hedge && result.status == MpcSessionStatus::COMPLETED;
+        delivered.elapsed_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - group->start_time).count());
+        if (delivered.hedge_won) {
+            hedge_win_count++;
+        }
+        Complete(completion, delivered);
+
+        if (!loser.empty()) {
+            Abort(loser, "Hedged session finished first");
+        }
+    }
+
+    bool MpcSessionEngine::TryAcquireHedge(double max_ratio)
+    {
+        uint64_t current = hedge_count.load();
+        while (static_cast<double>(current + 1) <= max_ratio * static_cast<double>(hedge_eligible_count.load())) {
+            if (hedge_count.compare_exchange_weak(current, current + 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool MpcSessionEngine::Abort(const std::string& session_id, const std::string& reason)
+    {
+        std::shared_ptr<Session> session;
+        {
+            std::lock_guard<std::mutex> lock(sessions_mutex);
+            auto it = sessions.find(session_id);
+            if (it == sessions.end()) {
+                return false;
+            }
+            session = it->second;
+        }
+
+        MpcSessionResult result;
+        MpcSessionCallback completion;
+        std::shared_ptr<HedgeGroup> hedge_group;
+        {
+            std::lock_guard<std::mutex> lock(session->mutex);
+            if (session->finished) {
+                return false;
+            }
+            result = FinishLocked(*session, MpcSessionStatus::ABORTED, reason, std::string());
+            completion = std::move(session->callback);
+            hedge_group = session->hedge_group;
+        }
+        Complete(completion, result);
+
+        // 진행 중인 hedge 세션도 함께 중단
+        if (hedge_group) {
+            Abort(hedge_group->hedge_id, reason);
+        }
+        return true;
+    }
+
+    MpcSessionResult MpcSessionEngine::FinishLocked(Session& session, MpcSessionStatus status,
+                                                    const std::string& error_message, const std::string& failed_node,
+                                                    std::string output)
+    {
+        session.finished = true;
+        session.round_message.Clear();
+        session.round_envelopes.clear();
+        session.forward_envelopes.clear();
+
+        // 남은 요청 취소 (늦은 응답은 수신 스레드에서 버려짐)
+        for (Participant& participant : session.participants) {
+            if (participant.request_id != 0 && participant.request_id != BATCHED_REQUEST) {
+                participant.client->CancelRequest(participant.request_id);
+            }
+            participant.request_id = 0;
+        }
+
+        MpcSessionResult result;
+        result.session_id = session.spec.session_id;
+        result.status = status;
+        result.completed_rounds = (status == MpcSessionStatus::COMPLETED) ? session.total_rounds : session.round - 1;
+        result.output = std::move(output);
+        result.error_message = error_message;
+        result.failed_node = failed_node;
+        result.elapsed_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - session.start_time).count());
+        for (const Participant& participant : session.participants) {
+            result.participants.push_back(participant.node_id);
+        }
+
+        switch (status) {
+            case MpcSessionStatus::COMPLETED:
+                completed_count++;
+                LOG_DEBUGF("MpcSessionEngine", "Session %s completed in %llums", result.session_id.c_str(),
+                           static_cast<unsigned long long>(result.elapsed_ms));
+                break;
+            case MpcSessionStatus::TIMED_OUT:   timed_out_count++;  break;
+            case MpcSessionStatus::ABORTED:     aborted_count++;    break;
+            default:                            failed_count++;     break;
+        }
+
+        if (status != MpcSessionStatus::COMPLETED) {
+            LOG_WARNF("MpcSessionEngine", "Session %s %s at round %u: %s", result.session_id.c_str(),
+                      MpcSessionStatusToString(status), session.round, error_message.c_str());
+            if (SendAbortToParticipants(session, error_message) > 0) {
+                abort_undelivered_count++;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(sessions_mutex);
+            sessions.erase(session.spec.session_id);
+        }
+        sessions_cv.notify_all();
+        return result;
+    }
+
+    void MpcSessionEngine::Complete(const MpcSessionCallback& callback, const MpcSessionResult& result)
+    {
+        if (!callback) {
+            return;
+        }
+        try {
+            callback(result);
+        } catch (const std::exception& e) {
+            LOG_ERRORF("MpcSessionEngine", "Session %s callback threw: %s", result.session_id.c_str(), e.what());
+        }
+    }
+
+    size_t MpcSessionEngine::SendAbortToParticipants(const Session& session, const std::string& reason)
+    {
+        CoordinatorNodeMessage message;
+        message.set_message_type(static_cast<int32_t>(MessageType::MPC_SESSION_ABORT));
+        MpcSessionAbortRequest* request = message.mutable_mpc_abort_request();
+        request->mutable_header()->set_uid(session.spec.session_id);
+        request->set_session_id(session.spec.session_id);
+        request->set_reason(reason);
+
+        // 응답은 기다리지 않음 - 전달되지 않으면 노드의 유휴 만료가 정리
+        size_t undelivered = 0;
+        for (const Participant& participant : session.participants) {
+            request->mutable_header()->set_request_id(next_request_id.fetch_add(1));
+            if (participant.client->SendRequestWithCallback(&message, [](std::unique_ptr<CoordinatorNodeMessage>) {}) == 0) {
+                undelivered++;
+            }
+        }
+        return undelivered;
+    }
+
+    void MpcSessionEngine::TimerLoop()
+    {
+        std::unique_lock<std::mutex> lock(timer_mutex);
+        while (!timer_stop) {
+            if (deadlines.empty()) {
+                timer_cv.wait(lock);
+                continue;
+            }
+
+            auto deadline = deadlines.top().deadline;
+            if (std::chrono::steady_clock::now() < deadline) {
+                timer_cv.wait_until(lock, deadline);
+                continue;
+            }
+
+            RoundDeadline entry = deadlines.top();
+            deadlines.pop();
+
+            // 이미 끝난 세션/라운드는 OnRoundTimeout/OnRetryDue에서 무시
+            lock.unlock();
+            if (std::shared_ptr<Session> session = entry.session.lock()) {
+                switch (entry.kind) {
+                    case DeadlineKind::ROUND_TIMEOUT:   OnRoundTimeout(session, entry.round);                       break;
+                    case DeadlineKind::BUSY_RETRY:      OnRetryDue(session, entry.round, entry.participant);        break;
+                    case DeadlineKind::HEDGE:           OnHedgeDue(session, entry.round, entry.participant);        break;
+                }
+            }
+            lock.lock();
+        }
+    }
+
+    void MpcSessionEngine::Shutdown()
+    {
+        std::vector<std::string> active;
+        {
+            std::lock_guard<std::mutex> lock(sessions_mutex);
+            accepting = false;
+            for (const auto& entry : sessions) {
+                active.push_back(entry.first);
+            }
+        }
+        for (const std::string& session_id : active) {
+            Abort(session_id, "Session engine shutting down");
+        }
+
+        SetRoundBatching(MpcRoundBatchConfig());   // 남은 배치 전송 후 flush 스레드 종료
+
+        {
+            std::lock_guard<std::mutex> lock(timer_mutex);
+            timer_stop = true;
+        }
+        timer_cv.notify_all();
+        if (timer_thread.joinable()) {
+            timer_thread.join();
+        }
+    }
+
+    void MpcSessionEngine::StopAccepting()
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        accepting = false;
+    }
+
+    MpcDrainReport MpcSessionEngine::Drain(std::chrono::milliseconds timeout)
+    {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t completed_before = completed_count.load();
+        uint64_t failed_before = failed_count.load() + timed_out_count.load();
+
+        MpcDrainReport report;
+        std::vector<std::string> remaining;
+        {
+            std::unique_lock<std::mutex> lock(sessions_mutex);
+            accepting = false;
+            report.in_flight = sessions.size();
+            sessions_cv.wait_until(lock, start + timeout, [this]() { return sessions.empty(); });
+            for (const auto& entry : sessions) {
+                remaining.push_back(entry.first);
+            }
+        }
+        report.completed = completed_count.load() - completed_before;
+        report.failed = failed_count.load() + timed_out_count.load() - failed_before;
+
+        // deadline 초과 세션 abort (hedge 세션은 primary와 함께 abort되면 여기서는 false)
+        uint64_t aborted_before = aborted_count.load();
+        uint64_t undelivered_before = abort_undelivered_count.load();
+        for (const std::string& session_id : remaining) {
+            Abort(session_id, "Coordinator draining");
+        }
+        report.lost = abort_undelivered_count.load() - undelivered_before;
+        report.aborted = aborted_count.load() - aborted_before - report.lost;
+        report.elapsed_ms = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count());
+
+        LOG_INFOF("MpcSessionEngine", "Drained %zu sessions in %llums: %llu completed, %llu failed, %llu aborted, %llu lost",
+                  report.in_flight, static_cast<unsigned long long>(report.elapsed_ms),
+                  static_cast<unsigned long long>(report.completed), static_cast<unsigned long long>(report.failed),
+                  static_cast<unsigned long long>(report.aborted), static_cast<unsigned long long>(report.lost));
+        return report;
+    }
+
+    MpcSessionEngineStats MpcSessionEngine::GetStats() const
+    {
+        MpcSessionEngineStats stats;
+        {
+            std::lock_guard<std::mutex> lock(sessions_mutex);
+            stats.active_sessions = sessions.size();
+        }
+        stats.started = started_count.load();
+        stats.completed = completed_count.load();
+        stats.failed = failed_count.load();
+        stats.timed_out = timed_out_count.load();
+        stats.aborted = aborted_count.load();
+        stats.hedge_eligible = hedge_eligible_count.load();
+        stats.hedges = hedge_count.load();
+        stats.hedge_wins = hedge_win_count.load();
+        stats.mesh_sessions = mesh_session_count.load();
+        stats.relay_sessions = relay_session_count.load();
+
+        std::lock_guard<std::mutex> lock(batcher_mutex);
+        stats.round_batches = retired_batch_stats.batches_sent;
+        stats.batched_rounds = retired_batch_stats.rounds_sent;
+        if (batcher) {
+            MpcRoundBatcherStats current = batcher->GetStats();
+            stats.round_batches += current.batches_sent;
+            stats.batched_rounds += current.rounds_sent;
+        }
+        return stats;
+    }
+
+    void MpcSessionEngine::SetRoundBatching(const MpcRoundBatchConfig& config)
+    {
+        std::shared_ptr<MpcRoundBatcher> retired;
+        {
+            std::lock_guard<std::mutex> lock(batcher_mutex);
+            retired = std::move(batcher);
+            if (config.Enabled()) {
+                batcher = std::make_shared<MpcRoundBatcher>(config);
+            }
+        }
+
+        // 이미 모인 요청 전송 (Shutdown 이후 Submit은 실패 → 호출자가 직접 전송)
+        if (retired) {
+            retired->Shutdown();
+            std::lock_guard<std::mutex> lock(batcher_mutex);
+            retired_batch_stats.batches_sent += retired->GetStats().batches_sent;
+            retired_batch_stats.rounds_sent += retired->GetStats().rounds_sent;
+        }
+
+        if (config.Enabled()) {
+            LOG_INFOF("MpcSessionEngine", "Round batching: window %lldus, max %zu rounds per batch",
+                      static_cast<long long>(config.window.count()), config.max_batch);
+        }
+    }
+
+    MpcRoundBatchConfig MpcSessionEngine::GetRoundBatching() const
+    {
+        std::lock_guard<std::mutex> lock(batcher_mutex);
+        return batcher ? batcher->GetConfig() : MpcRoundBatchConfig();
+    }
+
+    void MpcSessionEngine::SetHedging(const MpcHedgeConfig& config)
+    {
+        {
+            std::lock_guard<std::mutex> lock(hedge_mutex);
+            hedging = config;
+        }
+        if (config.Enabled()) {
+            LOG_INFOF("MpcSessionEngine", "Hedging: up to %.1f%% of signing sessions, after max(node p95, %lldus)",
+                      config.max_ratio * 100.0, static_cast<long long>(config.min_delay.count()));
+        }
+    }
+
+    MpcHedgeConfig MpcSessionEngine::GetHedging() const
+    {
+        std::lock_guard<std::mutex> lock(hedge_mutex);
+        return hedging;
+    }
+
+    void MpcSessionEngine::SetPeerMesh(bool enabled)
+    {
+        peer_mesh = enabled;
+        LOG_INFOF("MpcSessionEngine", "Peer mesh for MPC rounds: %s", enabled ? "enabled" : "disabled");
+    }
+
+    void MpcSessionEngine::SetOpaqueRelay(bool enabled)
+    {
+        opaque_relay = enabled;
+        LOG_INFOF("MpcSessionEngine", "Opaque relay for MPC rounds: %s", enabled ? "enabled" : "disabled");
+    }
+}
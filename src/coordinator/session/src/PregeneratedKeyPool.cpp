@@ -0,0 +1,231 @@
+// src/coordinator/session/src/PregeneratedKeyPool.cpp
+#include "coordinator/session/include/PregeneratedKeyPool.hpp"
+#include "common/utils/socket/SocketUtils.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include <algorithm>
+
+namespace mpc_engine::coordinator::session
+{
+    constexpr auto FAILURE_BACKOFF = std::chrono::milliseconds(1000);
+    constexpr auto LOAD_RECHECK_INTERVAL = std::chrono::milliseconds(10);
+
+    PregeneratedKeyPool::PregeneratedKeyPool(MpcSessionEngine& engine, std::shared_ptr<MpcKeygenBatch> keygen,
+                                             KeyPlacement placement, PregeneratedKeyPoolConfig config)
+        : engine(engine), keygen(std::move(keygen)), placement(std::move(placement)), config(config),
+          last_refill(std::chrono::steady_clock::now())
+    {
+        // 시작 직후 첫 배치는 바로 생성
+        tokens = static_cast<double>(std::min(config.batch_size, config.target_depth));
+        refill_thread = std::thread(&PregeneratedKeyPool::RefillLoop, this);
+        LOG_INFOF("PregeneratedKeyPool", "Key pool: target depth %zu, low watermark %zu, batch %zu, %.0f keys/s",
+                  config.target_depth, config.low_watermark, config.batch_size, config.keys_per_second);
+    }
+
+    PregeneratedKeyPool::~PregeneratedKeyPool()
+    {
+        Shutdown();
+    }
+
+    std::optional<PregeneratedKey> PregeneratedKeyPool::Assign(const std::string& tenant_id, const std::string& wallet_id, uint32_t threshold)
+    {
+        std::optional<PregeneratedKey> key;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto owner = std::make_pair(tenant_id, wallet_id);
+            auto it = assignments.find(owner);
+            if (it != assignments.end()) {
+                return it->second;
+            }
+
+            if ((threshold != 0 && threshold != config.threshold) || ready.empty()) {
+                stats.misses++;
+            } else {
+                key = std::move(ready.front());
+                ready.pop_front();
+                assignments.emplace(std::move(owner), *key);
+                stats.hits++;
+            }
+        }
+        cv.notify_one();
+        return key;
+    }
+
+    PregeneratedKey PregeneratedKeyPool::Adopt(const std::string& tenant_id, const std::string& wallet_id, PregeneratedKey key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto result = assignments.emplace(std::make_pair(tenant_id, wallet_id), key);
+        if (!result.second && key.threshold == config.threshold) {
+            // 동시 요청이 먼저 배정됨 - 새로 만든 키는 다음 지갑용으로 보관
+            ready.push_back(std::move(key));
+        }
+        return result.first->second;
+    }
+
+    std::optional<PregeneratedKey> PregeneratedKeyPool::FindAssignment(const std::string& tenant_id, const std::string& wallet_id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = assignments.find(std::make_pair(tenant_id, wallet_id));
+        if (it == assignments.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void PregeneratedKeyPool::RefillLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stop) {
+            auto now = std::chrono::steady_clock::now();
+            RefillTokensLocked(now);
+
+            // low_watermark 이하로 내려가면 target_depth까지 채움 (그 사이 배정은 보충을 다시 시작하지 않음)
+            if (!refilling && ready.size() <= config.low_watermark) {
+                refilling = true;
+            }
+            if (refilling && ready.size() >= config.target_depth) {
+                refilling = false;
+            }
+            if (!refilling) {
+                cv.wait(lock);
+                continue;
+            }
+            if (now < retry_after) {
+                cv.wait_until(lock, retry_after);
+                continue;
+            }
+
+            size_t count = std::min(config.batch_size, config.target_depth - ready.size());
+            if (tokens < static_cast<double>(count)) {
+                auto until_tokens = std::chrono::milliseconds(
+                    static_cast<int64_t>((static_cast<double>(count) - tokens) * 1000.0 / config.keys_per_second) + 1);
+                cv.wait_for(lock, until_tokens);
+                continue;
+            }
+
+            // 진행 중 세션(서명)이 많으면 keygen 배치를 미룸 - 노드 핸들러를 서명 라운드에 양보
+            lock.unlock();
+            bool busy = config.max_active_sessions > 0 && engine.GetStats().active_sessions > config.max_active_sessions;
+            lock.lock();
+            if (stop) {
+                break;
+            }
+            if (busy) {
+                stats.deferred++;
+                cv.wait_for(lock, LOAD_RECHECK_INTERVAL);
+                continue;
+            }
+
+            tokens -= static_cast<double>(count);
+            stats.in_flight = count;
+            stats.batches++;
+
+            std::vector<std::string> key_ids;
+            std::string prefix = "pool-" + std::to_string(utils::GetCurrentTimeMs()) + "-";
+            for (size_t i = 0; i < count; ++i) {
+                key_ids.push_back(prefix + std::to_string(next_key_number++));
+            }
+
+            // 배치는 이 스레드에서 실행 (한 번에 배치 1개 - 배정은 lock 밖에서 계속 처리)
+            lock.unlock();
+            for (MpcKeygenBatchSpec& spec : GroupByPlacement(key_ids)) {
+                MpcKeygenBatchResult result = keygen->Run(spec);
+                lock.lock();
+                AddBatchLocked(spec, result);
+                bool stopping = stop;
+                lock.unlock();
+                if (stopping) {
+                    break;
+                }
+            }
+            lock.lock();
+            stats.in_flight = 0;
+        }
+    }
+
+    std::vector<MpcKeygenBatchSpec> PregeneratedKeyPool::GroupByPlacement(const std::vector<std::string>& key_ids) const
+    {
+        // 같은 노드 목록(engine set)끼리 배치 1개 - 노드당 라운드 메시지 1개 유지
+        std::map<std::vector<std::string>, MpcKeygenBatchSpec> groups;
+        for (const std::string& key_id : key_ids) {
+            std::vector<std::string> node_ids = config.node_ids.empty() ? placement(key_id) : config.node_ids;
+            MpcKeygenBatchSpec& spec = groups[node_ids];
+            if (spec.key_ids.empty()) {
+                spec.node_ids = std::move(node_ids);
+                spec.threshold = config.threshold;
+            }
+            spec.key_ids.push_back(key_id);
+        }
+
+        std::vector<MpcKeygenBatchSpec> specs;
+        specs.reserve(groups.size());
+        for (auto& entry : groups) {
+            specs.push_back(std::move(entry.second));
+        }
+        return specs;
+    }
+
+    void PregeneratedKeyPool::AddBatchLocked(const MpcKeygenBatchSpec& spec, const MpcKeygenBatchResult& result)
+    {
+        auto now = std::chrono::steady_clock::now();
+        stats.in_flight -= std::min(stats.in_flight, spec.key_ids.size());
+        for (const MpcKeygenKeyResult& key_result : result.keys) {
+            if (key_result.status != MpcSessionStatus::COMPLETED) {
+                continue;
+            }
+            PregeneratedKey key;
+            key.key_id = key_result.key_id;
+            key.public_key = key_result.public_key;
+            key.node_ids = result.participants;
+            key.threshold = spec.threshold;
+            key.created = now;
+            ready.push_back(std::move(key));
+        }
+        stats.generated += result.completed;
+        stats.failed += result.failed;
+
+        if (result.failed > 0) {
+            // 노드 연결 끊김 등 - 실패 배치 반복 방지
+            retry_after = now + FAILURE_BACKOFF;
+            const MpcKeygenKeyResult* first_failure = nullptr;
+            for (const MpcKeygenKeyResult& key_result : result.keys) {
+                if (key_result.status != MpcSessionStatus::COMPLETED) {
+                    first_failure = &key_result;
+                    break;
+                }
+            }
+            LOG_WARNF("PregeneratedKeyPool", "Keygen batch %s: %zu/%zu keys failed (%s)", result.batch_id.c_str(),
+                      result.failed, result.keys.size(), first_failure ? first_failure->error_message.c_str() : "");
+        }
+    }
+
+    void PregeneratedKeyPool::RefillTokensLocked(std::chrono::steady_clock::time_point now)
+    {
+        // burst는 1초 분량 (최소 배치 1개)까지
+        double capacity = std::max(static_cast<double>(config.batch_size), config.keys_per_second);
+        double elapsed = std::chrono::duration<double>(now - last_refill).count();
+        tokens = std::min(capacity, tokens + elapsed * config.keys_per_second);
+        last_refill = now;
+    }
+
+    void PregeneratedKeyPool::Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_all();
+        // 진행 중 keygen 배치는 라운드 타임아웃으로 상한
+        if (refill_thread.joinable()) {
+            refill_thread.join();
+        }
+    }
+
+    PregeneratedKeyPoolStats PregeneratedKeyPool::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        PregeneratedKeyPoolStats result = stats;
+        result.depth = ready.size();
+        result.assigned = assignments.size();
+        return result;
+    }
+}
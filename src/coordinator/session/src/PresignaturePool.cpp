@@ -0,0 +1,278 @@
+// src/coordinator/session/src/PresignaturePool.cpp
+#include "coordinator/session/include/PresignaturePool.hpp"
+#include "common/utils/socket/SocketUtils.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include <algorithm>
+
+namespace mpc_engine::coordinator::session
+{
+    constexpr auto EXPIRY_SWEEP_INTERVAL = std::chrono::milliseconds(1000);
+    constexpr auto FAILURE_BACKOFF = std::chrono::milliseconds(1000);
+
+    PresignaturePool::PresignaturePool(MpcSessionEngine& engine, PresignaturePoolConfig config)
+        : engine(engine), config(config), tokens(1.0), last_refill(std::chrono::steady_clock::now())
+    {
+        refill_thread = std::thread(&PresignaturePool::RefillLoop, this);
+    }
+
+    PresignaturePool::~PresignaturePool()
+    {
+        Shutdown();
+    }
+
+    bool PresignaturePool::AddKey(const std::string& key_id, const std::vector<std::string>& node_ids, uint32_t threshold)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = keys.find(key_id);
+            if (it == keys.end()) {
+                if (keys.size() >= config.max_keys) {
+                    rejected_keys++;
+                    LOG_WARNF("PresignaturePool", "Key %s not registered: %zu keys already registered", key_id.c_str(), keys.size());
+                    return false;
+                }
+                it = keys.emplace(key_id, KeyPool()).first;
+                it->second.stats.key_id = key_id;
+                it->second.generation = next_generation++;
+                LOG_INFOF("PresignaturePool", "Key %s registered (target depth %zu)", key_id.c_str(), config.target_depth);
+            } else if (it->second.node_ids != node_ids || it->second.threshold != threshold) {
+                // 노드 집합이 바뀌면 기존 presignature는 새 후보와 맞지 않을 수 있음 - 온라인 서명 실패 시 fallback으로 처리
+                LOG_INFOF("PresignaturePool", "Key %s signer candidates updated", key_id.c_str());
+            }
+            it->second.node_ids = node_ids;
+            it->second.threshold = threshold;
+            it->second.last_used = std::chrono::steady_clock::now();
+        }
+        cv.notify_one();
+        return true;
+    }
+
+    void PresignaturePool::RemoveKey(const std::string& key_id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (keys.erase(key_id) > 0) {
+            LOG_INFOF("PresignaturePool", "Key %s removed", key_id.c_str());
+        }
+    }
+
+    bool PresignaturePool::HasKey(const std::string& key_id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return keys.find(key_id) != keys.end();
+    }
+
+    std::optional<Presignature> PresignaturePool::Acquire(const std::string& key_id)
+    {
+        std::optional<Presignature> presignature;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = keys.find(key_id);
+            if (it == keys.end()) {
+                return std::nullopt;
+            }
+
+            KeyPool& pool = it->second;
+            auto now = std::chrono::steady_clock::now();
+            pool.last_used = now;
+            DropExpiredLocked(pool, now);
+            if (pool.ready.empty()) {
+                pool.stats.misses++;
+            } else {
+                presignature = std::move(pool.ready.front());
+                pool.ready.pop_front();
+                pool.stats.hits++;
+            }
+        }
+        cv.notify_one();
+        return presignature;
+    }
+
+    void PresignaturePool::RefillLoop()
+    {
+        struct PendingStart
+        {
+            MpcSessionSpec spec;
+            uint64_t generation;
+        };
+
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stop) {
+            auto now = std::chrono::steady_clock::now();
+            RefillTokensLocked(now);
+            RemoveIdleKeysLocked(now);
+
+            // key마다 한 번에 하나씩 돌아가며 시작 (한 key가 token을 독점하지 않도록)
+            std::vector<PendingStart> starts;
+            bool short_of_target = false;
+            bool progress = true;
+            while (progress) {
+                progress = false;
+                for (auto& entry : keys) {
+                    KeyPool& pool = entry.second;
+                    DropExpiredLocked(pool, now);
+                    if (pool.ready.size() + pool.stats.in_flight >= config.target_depth) {
+                        continue;
+                    }
+                    short_of_target = true;
+                    if (in_flight >= config.max_in_flight || tokens < 1.0 || now < pool.retry_after) {
+                        continue;
+                    }
+
+                    tokens -= 1.0;
+                    in_flight++;
+                    pool.stats.in_flight++;
+                    progress = true;
+
+                    PendingStart start;
+                    start.spec.session_id = "presig-" + std::to_string(utils::GetCurrentTimeMs()) + "-" + std::to_string(next_presign_number++);
+                    start.spec.protocol = MPC_PROTOCOL_ECDSA_PRESIGN;
+                    start.spec.key_id = entry.first;
+                    start.spec.node_ids = pool.node_ids;
+                    start.spec.threshold = pool.threshold;
+                    start.generation = pool.generation;
+                    starts.push_back(std::move(start));
+                }
+            }
+
+            if (!starts.empty()) {
+                // 엔진은 시작 실패 시 callback을 즉시 호출하므로 lock 밖에서 시작
+                lock.unlock();
+                for (PendingStart& start : starts) {
+                    std::string key_id = start.spec.key_id;
+                    uint64_t generation = start.generation;
+                    engine.Start(std::move(start.spec), [this, key_id, generation](const MpcSessionResult& result) {
+                        OnPresignComplete(key_id, generation, result);
+                    });
+                }
+                lock.lock();
+                continue;
+            }
+
+            // 다음 token까지 대기 (in-flight 상한이면 완료 콜백이 깨움), 아니면 만료 검사 주기
+            auto wait = EXPIRY_SWEEP_INTERVAL;
+            if (short_of_target && in_flight < config.max_in_flight && tokens < 1.0) {
+                auto until_token = std::chrono::milliseconds(static_cast<int64_t>((1.0 - tokens) * 1000.0 / config.refill_per_second) + 1);
+                wait = std::min(wait, until_token);
+            }
+            cv.wait_for(lock, wait);
+        }
+    }
+
+    void PresignaturePool::OnPresignComplete(const std::string& key_id, uint64_t generation, const MpcSessionResult& result)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            in_flight--;
+
+            auto it = keys.find(key_id);
+            if (stop || it == keys.end() || it->second.generation != generation) {
+                cv.notify_all();    // Shutdown 대기 중일 수 있음
+                return;             // 종료 중 / 그 사이 제거된 key - 노드 쪽 presignature는 TTL로 정리
+            }
+
+            KeyPool& pool = it->second;
+            pool.stats.in_flight--;
+            if (result.status == MpcSessionStatus::COMPLETED) {
+                Presignature presignature;
+                presignature.presignature_id = result.session_id;
+                presignature.key_id = key_id;
+                presignature.node_ids = result.participants;
+                presignature.created = std::chrono::steady_clock::now();
+                pool.ready.push_back(std::move(presignature));
+                pool.stats.generated++;
+            } else {
+                pool.stats.failed++;
+                pool.retry_after = std::chrono::steady_clock::now() + FAILURE_BACKOFF;
+                if (result.status != MpcSessionStatus::ABORTED) {   // ABORTED = 엔진 종료
+                    LOG_WARNF("PresignaturePool", "Presign %s for key %s %s: %s", result.session_id.c_str(), key_id.c_str(),
+                              MpcSessionStatusToString(result.status), result.error_message.c_str());
+                }
+            }
+        }
+        cv.notify_all();
+    }
+
+    void PresignaturePool::DropExpiredLocked(KeyPool& pool, std::chrono::steady_clock::time_point now)
+    {
+        while (!pool.ready.empty() && now - pool.ready.front().created > config.max_age) {
+            pool.ready.pop_front();
+            pool.stats.expired++;
+        }
+    }
+
+    void PresignaturePool::RemoveIdleKeysLocked(std::chrono::steady_clock::time_point now)
+    {
+        if (config.idle_ttl.count() <= 0) {
+            return;
+        }
+        for (auto it = keys.begin(); it != keys.end();) {
+            if (now - it->second.last_used > config.idle_ttl) {
+                // 진행 중 presign 결과는 generation 불일치로 버려짐
+                LOG_INFOF("PresignaturePool", "Key %s removed after %lld ms idle (%zu presignatures dropped)", it->first.c_str(),
+                          static_cast<long long>(config.idle_ttl.count()), it->second.ready.size());
+                it = keys.erase(it);
+                idle_removed++;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void PresignaturePool::RefillTokensLocked(std::chrono::steady_clock::time_point now)
+    {
+        // burst는 1초 분량까지
+        double capacity = std::max(1.0, config.refill_per_second);
+        double elapsed = std::chrono::duration<double>(now - last_refill).count();
+        tokens = std::min(capacity, tokens + elapsed * config.refill_per_second);
+        last_refill = now;
+    }
+
+    void PresignaturePool::Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_all();
+        if (refill_thread.joinable()) {
+            refill_thread.join();
+        }
+
+        // 진행 중 presign 세션 콜백이 this를 참조하므로 모두 끝날 때까지 대기 (라운드 타임아웃으로 상한)
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return in_flight == 0; });
+    }
+
+    PresignaturePoolStats PresignaturePool::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        PresignaturePoolStats stats;
+        stats.keys = keys.size();
+        stats.in_flight = in_flight;
+        stats.rejected_keys = rejected_keys;
+        stats.idle_removed = idle_removed;
+        for (const auto& entry : keys) {
+            const KeyPool& pool = entry.second;
+            stats.depth += pool.ready.size();
+            stats.hits += pool.stats.hits;
+            stats.misses += pool.stats.misses;
+            stats.generated += pool.stats.generated;
+            stats.failed += pool.stats.failed;
+            stats.expired += pool.stats.expired;
+        }
+        return stats;
+    }
+
+    std::vector<PresignatureKeyStats> PresignaturePool::GetKeyStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<PresignatureKeyStats> result;
+        result.reserve(keys.size());
+        for (const auto& entry : keys) {
+            PresignatureKeyStats stats = entry.second.stats;
+            stats.depth = entry.second.ready.size();
+            result.push_back(std::move(stats));
+        }
+        return result;
+    }
+}
@@ -2,8 +2,15 @@
 #include "node/NodeServer.hpp"
 #include "common/env/EnvManager.hpp"
 #include "node/handlers/include/NodeMessageRouter.hpp"
+#include "common/network/framing/relay.hpp"
+#include "types/MessageTypes.hpp"
 #include "common/utils/socket/SocketUtils.hpp"
 #include "common/utils/logger/Logger.hpp"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
 
 namespace mpc_engine::node
 {
@@ -48,12 +55,32 @@ namespace mpc_engine::node
 
         uint16_t handler_threads = Config::GetUInt16("NODE_HANDLER_THREADS");
         tcp_server = std::make_unique<network::NodeTcpServer>(node_config.bind_address, node_config.bind_port, handler_threads);
+        if (node_config.inherited_listener != INVALID_SOCKET_VALUE) {
+            tcp_server->SetInheritedListener(node_config.inherited_listener);
+        }
 
         if (!tcp_server->Initialize(node_config.certificate_path, node_config.private_key_id)) {
             LOG_ERROR("NodeTcpServer", "Failed to initialize TCP server");
             return false;
         }
 
+        if (node_config.mesh_port > 0) {
+            std::string mesh_address = node_config.mesh_bind_address.empty() ? node_config.bind_address : node_config.mesh_bind_address;
+            peer_mesh = std::make_shared<network::NodePeerMesh>(node_config.node_id, mesh_address, node_config.mesh_port);
+            if (!peer_mesh->Initialize(node_config.certificate_path, node_config.private_key_id)) {
+                LOG_ERROR("NodeTcpServer", "Failed to initialize peer mesh");
+                return false;
+            }
+            if (node_config.inherited_mesh_listener != INVALID_SOCKET_VALUE) {
+                peer_mesh->SetInheritedListener(node_config.inherited_mesh_listener);
+                node_config.inherited_mesh_listener = INVALID_SOCKET_VALUE;
+            }
+        } else if (node_config.inherited_mesh_listener != INVALID_SOCKET_VALUE) {
+            // 이전 프로세스만 mesh를 켰던 경우 - 포트를 계속 잡고 있지 않도록 닫음
+            utils::CloseSocket(node_config.inherited_mesh_listener);
+            node_config.inherited_mesh_listener = INVALID_SOCKET_VALUE;
+        }
+
         SetupCallbacks();
         is_initialized = true;
 
@@ -72,6 +99,11 @@ namespace mpc_engine::node
             return false;
         }
 
+        // mesh 포트는 핸드오프로 인수한 소켓을 사용 - 인수 없이 이전 프로세스가 포트를 잡고 있으면 mesh 없이 시작 (mesh 세션은 거절됨)
+        if (peer_mesh && !peer_mesh->Start()) {
+            LOG_WARNF("NodeTcpServer", "Peer mesh unavailable on %s, mesh sessions will be rejected", node_config.node_id.c_str());
+        }
+
         is_running = true;
         LOG_INFOF("NodeTcpServer", "Node server started: %s", node_config.node_id.c_str());
         LOG_INFOF("NodeTcpServer", " on %s:%d", node_config.bind_address.c_str(), node_config.bind_port);
@@ -94,6 +126,9 @@ namespace mpc_engine::node
         if (tcp_server) {
             tcp_server->Stop();
         }
+        if (peer_mesh) {
+            peer_mesh->Stop();
+        }
 
         LOG_INFOF("NodeTcpServer", "Node server stopped: %s", node_config.node_id.c_str());
     }
@@ -117,6 +152,9 @@ namespace mpc_engine::node
         stats.status = is_running.load() ? ConnectionStatus::CONNECTED : ConnectionStatus::DISCONNECTED;
         stats.active_connections = tcp_server && tcp_server->HasActiveConnection() ? 1 : 0;
         stats.uptime_seconds = (utils::GetCurrentTimeMs() - start_time) / 1000;
+        if (tcp_server) {
+            stats.latency = tcp_server->GetLatencyStats().Collect();
+        }
         
         // TCP 서버에서 추가 통계 수집 (향후 구현)
         // stats.total_requests = tcp_server->GetTotalRequests();
@@ -139,30 +177,16 @@ namespace mpc_engine::node
         LOG_INFOF("NodeTcpServer", "Node %s processing message type: %d", 
             node_config.node_id.c_str(), message.header.message_type);
 
-        try {
-            // 1. NetworkMessage → Proto 변환
-            std::unique_ptr<CoordinatorNodeMessage> proto_request = NetworkMessageToProto(message);
-            if (!proto_request) {
-                LOG_ERROR("NodeTcpServer", "Failed to parse protobuf message");
-                return CreateErrorResponse(message.header.message_type, "Invalid protobuf format");
-            }
-
-            // 2. NodeMessageRouter로 처리 (Proto 메시지 사용)
-            std::unique_ptr<CoordinatorNodeMessage> proto_response = 
-                handlers::NodeMessageRouter::Instance().ProcessMessage(proto_request.get());
-
-            if (!proto_response) {
-                LOG_ERROR("NodeTcpServer", "No response from message router");
-                return CreateErrorResponse(message.header.message_type, "No response generated");
-            }
-
-            // 3. Proto → NetworkMessage 변환
-            return ProtoToNetworkMessage(proto_response.get());
+        // parse → 타입 지정 핸들러 → serialize 각 1회 (요청/응답 proto는 arena)
+        // 배치 요청의 세션별 연산은 이 노드의 다른 핸들러 워커에도 분배
+        uint64_t serialize_ns = 0;
+        utils::ScopedParallelRunner parallel(tcp_server.get());
+        NetworkMessage response = handlers::NodeMessageRouter::Instance().Process(message, &serialize_ns);
 
-        } catch (const std::exception& e) {
-            LOG_ERRORF("NodeTcpServer", "Exception in ProcessMessage: %s", e.what());
-            return CreateErrorResponse(message.header.message_type, "Processing failed: " + std::string(e.what()));
+        if (tcp_server) {
+            tcp_server->GetLatencyStats().Record(response.header.message_type, network::LatencyStage::SERIALIZATION, serialize_ns);
         }
+        return response;
     }
 
     void NodeServer::SetupCallbacks() {
@@ -182,53 +206,85 @@ namespace mpc_engine::node
         tcp_server->SetMessageHandler([this](const NetworkMessage& msg) {
             return ProcessMessage(msg);
         });
+
+        // 같은 key의 요청은 같은 handler lane에서 순서대로 처리
+        tcp_server->SetAffinityKeyExtractor(&NodeServer::ExtractAffinityKey);
+
+        // mesh 세션은 모든 라운드가 끝날 때까지 peer 수신을 기다림 - 핸들러 lane을 막지 않도록 전용 풀에서 실행
+        tcp_server->SetLongRunningFilter([](const NetworkMessage& message) {
+            return message.header.message_type == static_cast<uint16_t>(MessageType::MPC_MESH_SESSION);
+        });
+
+        // 무중단 재시작 시 mesh 포트도 새 프로세스로 - 새 프로세스가 bind하지 못해 mesh 없이 뜨는 일이 없도록
+        if (peer_mesh) {
+            tcp_server->SetHandoffMeshListener(
+                [this]() { return peer_mesh->DetachListener(); },
+                [this]() { peer_mesh->ResumeListener(); });
+        }
         
         LOG_INFO("NodeTcpServer", "Node server callbacks configured");
     }
 
-    // NetworkMessage → Proto 변환
-    std::unique_ptr<CoordinatorNodeMessage> NodeServer::NetworkMessageToProto(const NetworkMessage& message) {
-        auto proto_msg = std::make_unique<CoordinatorNodeMessage>();
-        
-        // body에서 Proto 메시지 역직렬화
-        if (!message.body.empty()) {
-            if (!proto_msg->ParseFromArray(message.body.data(), message.body.size())) {
-                LOG_ERROR("NodeTcpServer", "Failed to parse protobuf from NetworkMessage");
-                return nullptr;
+    /**
+    * @brief 요청의 affinity key 추출 (전체 파싱 없이 wire 스캔)
+    * 
+    * signing_request.key_id / MPC 세션 요청의 session_id 해시를 반환합니다.
+    * (같은 세션의 라운드들이 같은 lane에서 순서대로 처리됨)
+    * 키가 없으면 request_id를 사용합니다 (lane 분산만 보장).
+    * relay 프레임은 앞부분의 라운드 요청만 스캔합니다.
+    */
+    uint64_t NodeServer::ExtractAffinityKey(const NetworkMessage& message) {
+        using google::protobuf::internal::WireFormatLite;
+
+        const uint8_t* data = message.body.data();
+        size_t size = message.body.size();
+        if (message.header.message_type == static_cast<uint16_t>(MessageType::MPC_RELAY_ROUND)) {
+            RelayFrameHeader relay;
+            if (size < sizeof(relay)) {
+                return message.header.request_id;
             }
+            memcpy(&relay, data, sizeof(relay));
+            data += sizeof(relay);
+            size = std::min<size_t>(relay.request_length, size - sizeof(relay));
         }
-        
-        return proto_msg;
-    }
 
-    // Proto → NetworkMessage 변환
-    NetworkMessage NodeServer::ProtoToNetworkMessage(const CoordinatorNodeMessage* proto_msg) {
-        if (!proto_msg) {
-            LOG_ERROR("NodeTcpServer", "Proto message is null");
-            throw std::invalid_argument("Proto message is null");
-        }
-        
-        // Proto 메시지 직렬화
-        std::string serialized;
-        if (!proto_msg->SerializeToString(&serialized)) {
-            LOG_ERROR("NodeTcpServer", "Failed to serialize protobuf message");
-            throw std::runtime_error("Failed to serialize protobuf message");
+        google::protobuf::io::CodedInputStream input(data, static_cast<int>(size));
+
+        uint32_t tag;
+        while ((tag = input.ReadTag()) != 0) {
+            uint32_t payload_field = WireFormatLite::GetTagFieldNumber(tag);
+            bool keyed_payload = payload_field == CoordinatorNodeMessage::kSigningRequestFieldNumber ||
+                                 payload_field == CoordinatorNodeMessage::kMpcRoundRequestFieldNumber ||
+                                 payload_field == CoordinatorNodeMessage::kMpcAbortRequestFieldNumber;
+            if (!keyed_payload || WireFormatLite::GetTagWireType(tag) != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+                if (!WireFormatLite::SkipField(&input, tag)) break;
+                continue;
+            }
+
+            uint32_t length;
+            if (!input.ReadVarint32(&length)) break;
+            google::protobuf::io::CodedInputStream::Limit limit = input.PushLimit(static_cast<int>(length));
+
+            while ((tag = input.ReadTag()) != 0) {
+                // key_id / session_id 모두 field 2
+                static_assert(static_cast<int>(SigningRequest::kKeyIdFieldNumber) == static_cast<int>(MpcRoundRequest::kSessionIdFieldNumber) &&
+                              static_cast<int>(MpcRoundRequest::kSessionIdFieldNumber) == static_cast<int>(MpcSessionAbortRequest::kSessionIdFieldNumber),
+                              "affinity key field numbers must match");
+                if (WireFormatLite::GetTagFieldNumber(tag) == SigningRequest::kKeyIdFieldNumber &&
+                    WireFormatLite::GetTagWireType(tag) == WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+                    std::string key_id;
+                    if (WireFormatLite::ReadString(&input, &key_id) && !key_id.empty()) {
+                        return std::hash<std::string>{}(key_id);
+                    }
+                    break;
+                }
+                if (!WireFormatLite::SkipField(&input, tag)) break;
+            }
+
+            input.PopLimit(limit);
+            break;
         }
-        
-        // NetworkMessage 생성
-        NetworkMessage network_msg;
-        network_msg.header.message_type = static_cast<uint16_t>(proto_msg->message_type());
-        network_msg.header.body_length = static_cast<uint32_t>(serialized.size());
-        network_msg.body.assign(serialized.begin(), serialized.end());
-        
-        // Checksum 계산
-        network_msg.header.checksum = MessageHeader::ComputeChecksum(network_msg.body);
-        
-        return network_msg;
-    }
 
-    NetworkMessage NodeServer::CreateErrorResponse(uint16_t messageType, const std::string& errorMessage) {
-        std::string payload = "success=false|error=" + errorMessage;
-        return NetworkMessage(messageType, payload);
+        return message.header.request_id;
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #pragma once
 #include "types/BasicTypes.hpp"
 #include "node/network/include/NodeTcpServer.hpp"
+#include "node/network/include/NodePeerMesh.hpp"
 #include "proto/coordinator_node/generated/message.pb.h"
 #include <memory>
 #include <string>
@@ -20,6 +21,10 @@ namespace mpc_engine::node
         uint16_t bind_port = 8081;
         std::string certificate_path;
         std::string private_key_id;
+        socket_t inherited_listener = INVALID_SOCKET_VALUE;  // 무중단 재시작 시 이전 프로세스에서 인수한 소켓
+        std::string mesh_bind_address;                       // 노드 간 MPC 라운드 mesh (NODE_MESH_HOSTS)
+        uint16_t mesh_port = 0;                              // 0 = mesh 끔
+        socket_t inherited_mesh_listener = INVALID_SOCKET_VALUE;  // 무중단 재시작 시 함께 인수한 mesh 소켓
 
         bool IsValid() const;
     };
@@ -33,12 +38,14 @@ namespace mpc_engine::node
         uint32_t successful_requests = 0;
         uint32_t active_connections = 0;
         uint64_t uptime_seconds = 0;
+        std::vector<network::MessageLatencyStats> latency;   // MessageType × 구간별 지연 분포
     };
 
     class NodeServer 
     {
     private:
         std::unique_ptr<network::NodeTcpServer> tcp_server;
+        std::shared_ptr<network::NodePeerMesh> peer_mesh;
         NodeConfig node_config;
         std::atomic<bool> is_running{false};
         std::atomic<bool> is_initialized{false};
@@ -55,6 +62,7 @@ namespace mpc_engine::node
 
         // TCP 서버 접근 (방화벽 설정용)
         network::NodeTcpServer* GetTcpServer() { return tcp_server.get(); }
+        network::NodePeerMesh* GetPeerMesh() { return peer_mesh.get(); }
         
         std::string GetNodeId() const;
         PlatformType GetPlatformType() const;
@@ -64,10 +72,7 @@ namespace mpc_engine::node
         void OnCoordinatorConnected(const network::NodeConnectionInfo& connection);
         void OnCoordinatorDisconnected(const network::NodeConnectionInfo::DisconnectionInfo& connection);
         NetworkMessage ProcessMessage(const NetworkMessage& message);
+        static uint64_t ExtractAffinityKey(const NetworkMessage& message);
         void SetupCallbacks();
-        
-        std::unique_ptr<CoordinatorNodeMessage> NetworkMessageToProto(const NetworkMessage& message);
-        NetworkMessage ProtoToNetworkMessage(const CoordinatorNodeMessage* proto_msg);
-        NetworkMessage CreateErrorResponse(uint16_t messageType, const std::string& errorMessage);
     };
 }
\ No newline at end of file
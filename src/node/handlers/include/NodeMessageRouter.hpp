@@ -2,34 +2,146 @@
 #pragma once
 
 #include "types/MessageTypes.hpp"
+#include "common/network/framing/tcp.hpp"
 #include "proto/coordinator_node/generated/message.pb.h"
-#include <functional>
-#include <memory>
 #include <array>
+#include <cstdint>
 
 namespace mpc_engine::node::handlers
 {
     using namespace mpc_engine::proto::coordinator_node;
+    using namespace mpc_engine::network::framing;
 
-    using NodeMessageHandler = std::function<std::unique_ptr<CoordinatorNodeMessage>(const CoordinatorNodeMessage*)>;
-    
-    class NodeMessageRouter 
+    /**
+     * @brief 요청 payload 타입 → CoordinatorNodeMessage oneof 접근자
+     *
+     * 새 요청 타입은 specialization 하나와 Register<TRequest>(handler) 호출로 추가합니다.
+     */
+    template<typename TRequest>
+    struct NodePayloadTraits;
+
+    template<>
+    struct NodePayloadTraits<SigningRequest>
+    {
+        using Response = SigningResponse;
+        static constexpr MessageType TYPE = MessageType::SIGNING_REQUEST;
+        static constexpr CoordinatorNodeMessage::PayloadCase REQUEST_CASE = CoordinatorNodeMessage::kSigningRequest;
+
+        static const SigningRequest& Get(const CoordinatorNodeMessage& message) { return message.signing_request(); }
+        static SigningResponse* MutableResponse(CoordinatorNodeMessage* message) { return message->mutable_signing_response(); }
+    };
+
+    template<>
+    struct NodePayloadTraits<MpcRoundRequest>
+    {
+        using Response = MpcRoundResponse;
+        static constexpr MessageType TYPE = MessageType::MPC_ROUND;
+        static constexpr CoordinatorNodeMessage::PayloadCase REQUEST_CASE = CoordinatorNodeMessage::kMpcRoundRequest;
+
+        static const MpcRoundRequest& Get(const CoordinatorNodeMessage& message) { return message.mpc_round_request(); }
+        static MpcRoundResponse* MutableResponse(CoordinatorNodeMessage* message) { return message->mutable_mpc_round_response(); }
+    };
+
+    template<>
+    struct NodePayloadTraits<MpcRoundBatchRequest>
+    {
+        using Response = MpcRoundBatchResponse;
+        static constexpr MessageType TYPE = MessageType::MPC_ROUND_BATCH;
+        static constexpr CoordinatorNodeMessage::PayloadCase REQUEST_CASE = CoordinatorNodeMessage::kMpcRoundBatchRequest;
+
+        static const MpcRoundBatchRequest& Get(const CoordinatorNodeMessage& message) { return message.mpc_round_batch_request(); }
+        static MpcRoundBatchResponse* MutableResponse(CoordinatorNodeMessage* message) { return message->mutable_mpc_round_batch_response(); }
+    };
+
+    template<>
+    struct NodePayloadTraits<MpcSessionAbortRequest>
+    {
+        using Response = MpcSessionAbortResponse;
+        static constexpr MessageType TYPE = MessageType::MPC_SESSION_ABORT;
+        static constexpr CoordinatorNodeMessage::PayloadCase REQUEST_CASE = CoordinatorNodeMessage::kMpcAbortRequest;
+
+        static const MpcSessionAbortRequest& Get(const CoordinatorNodeMessage& message) { return message.mpc_abort_request(); }
+        static MpcSessionAbortResponse* MutableResponse(CoordinatorNodeMessage* message) { return message->mutable_mpc_abort_response(); }
+    };
+
+    template<>
+    struct NodePayloadTraits<MpcMeshSessionRequest>
+    {
+        using Response = MpcMeshSessionResponse;
+        static constexpr MessageType TYPE = MessageType::MPC_MESH_SESSION;
+        static constexpr CoordinatorNodeMessage::PayloadCase REQUEST_CASE = CoordinatorNodeMessage::kMpcMeshSessionRequest;
+
+        static const MpcMeshSessionRequest& Get(const CoordinatorNodeMessage& message) { return message.mpc_mesh_session_request(); }
+        static MpcMeshSessionResponse* MutableResponse(CoordinatorNodeMessage* message) { return message->mutable_mpc_mesh_session_response(); }
+    };
+
+    /**
+     * @brief 타입 지정 핸들러 - 요청 payload를 읽고 arena에 할당된 응답 payload에 직접 기록
+     * @return false면 응답을 만들지 못한 것 (NODE_ERROR_INTERNAL로 응답)
+     * @note 처리 실패(서명 실패 등)는 응답 header.success=false로 표현
+     */
+    template<typename TRequest>
+    using TypedNodeHandler = bool (*)(const TRequest& request, typename NodePayloadTraits<TRequest>::Response* response);
+
+    /**
+     * @brief Node 요청 처리 파이프라인
+     *
+     * 프레임 body → (parse 1회) arena 요청 → 타입 지정 핸들러 → arena 응답 → (serialize 1회) 응답 프레임
+     *
+     * - 요청/응답 메시지는 스레드별 초기 블록을 쓰는 Arena에 할당 → 메시지 객체 malloc/free 없음
+     * - 에러도 같은 응답 메시지에 error_response로 기록 (별도 proto 생성 없음)
+     * - 응답은 ByteSizeLong 후 프레임 body에 바로 직렬화 (중간 string 복사 없음)
+     */
+    class NodeMessageRouter
     {
     private:
         NodeMessageRouter() = default;
         bool initialized = false;
 
     public:
-        static NodeMessageRouter& Instance() 
+        static NodeMessageRouter& Instance()
         {
             static NodeMessageRouter instance;
             return instance;
         }
-        
+
         bool Initialize();
-        std::unique_ptr<CoordinatorNodeMessage> ProcessMessage(const CoordinatorNodeMessage* request);
-       
+
+        /**
+        * @brief 요청 프레임 처리 → 응답 프레임
+        * @param serialize_ns 응답 직렬화 소요 시간 (optional, 지연 통계용)
+        */
+        NetworkMessage Process(const NetworkMessage& request, uint64_t* serialize_ns = nullptr) const;
+
+        template<typename TRequest>
+        void Register(TypedNodeHandler<TRequest> handler)
+        {
+            using Traits = NodePayloadTraits<TRequest>;
+
+            Route& route = routes_[static_cast<size_t>(Traits::TYPE)];
+            route.request_case = Traits::REQUEST_CASE;
+            route.handler = reinterpret_cast<ErasedHandler>(handler);
+            route.invoke = &InvokeTyped<TRequest>;
+        }
+
     private:
-        std::array<NodeMessageHandler, static_cast<size_t>(MessageType::MAX_MESSAGE_TYPE)> handlers_{};
+        using ErasedHandler = void (*)();
+        using RouteInvoker = bool (*)(ErasedHandler handler, const CoordinatorNodeMessage& request, CoordinatorNodeMessage* response);
+
+        struct Route {
+            CoordinatorNodeMessage::PayloadCase request_case = CoordinatorNodeMessage::PAYLOAD_NOT_SET;
+            ErasedHandler handler = nullptr;
+            RouteInvoker invoke = nullptr;
+        };
+
+        template<typename TRequest>
+        static bool InvokeTyped(ErasedHandler handler, const CoordinatorNodeMessage& request, CoordinatorNodeMessage* response)
+        {
+            using Traits = NodePayloadTraits<TRequest>;
+            return reinterpret_cast<TypedNodeHandler<TRequest>>(handler)(
+                Traits::Get(request), Traits::MutableResponse(response));
+        }
+
+        std::array<Route, static_cast<size_t>(MessageType::MAX_MESSAGE_TYPE)> routes_{};
     };
-} // namespace mpc_engine::node::handlers
\ No newline at end of file
+} // namespace mpc_engine::node::handlers
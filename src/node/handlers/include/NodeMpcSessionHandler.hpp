@@ -0,0 +1,105 @@
+// src/node/handlers/include/NodeMpcSessionHandler.hpp
+#pragma once
+#include "proto/coordinator_node/generated/message.pb.h"
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace mpc_engine::node::handlers
+{
+    using namespace mpc_engine::proto::coordinator_node;
+
+    /**
+     * @brief 노드 측 MPC 세션 상태 ((session_id, player_id) → 진행 라운드)
+     *
+     * Coordinator가 라운드 단위로 구동하고 노드는 라운드 순서만 검증합니다.
+     * - 같은 라운드 재요청(재전송)에는 저장된 출력을 그대로 반환
+     * - 마지막 라운드 완료 / abort / 유휴 만료 시 상태 폐기
+     * - ECDSA_PRESIGN 완료 시 presignature를 (key_id, presignature_id, player_id)로 보관하고
+     *   ECDSA_ONLINE_SIGNING이 1회 소비 (재사용/만료/참여자 불일치는 거부 - nonce 재사용 방지)
+     */
+    class NodeMpcSessionStore
+    {
+    private:
+        struct Session
+        {
+            MpcProtocol protocol = MPC_PROTOCOL_UNSPECIFIED;
+            std::string key_id;
+            std::vector<uint64_t> player_ids;
+            uint32_t total_rounds = 0;
+            uint32_t completed_round = 0;
+            std::string last_output;
+            uint64_t last_active_ms = 0;
+        };
+
+        struct Presignature
+        {
+            std::string data;                   // presign 마지막 라운드 결과 (모든 참여자 동일)
+            std::vector<uint64_t> player_ids;   // 온라인 서명도 같은 참여자 집합이어야 함
+            uint64_t created_ms = 0;
+        };
+
+        // 한 프로세스에 여러 노드가 떠 있는 경우(테스트)에도 참여자별로 분리
+        using SessionKey = std::pair<std::string, uint64_t>;
+        using PresignatureKey = std::tuple<std::string, std::string, uint64_t>;   // (key_id, presignature_id, player_id)
+
+        mutable std::mutex mutex;
+        std::map<SessionKey, Session> sessions;
+        std::map<PresignatureKey, Presignature> presignatures;
+        uint64_t last_sweep_ms = 0;
+
+        NodeMpcSessionStore() = default;
+
+    public:
+        static NodeMpcSessionStore& Instance()
+        {
+            static NodeMpcSessionStore instance;
+            return instance;
+        }
+
+        struct RoundOutcome
+        {
+            bool success = false;
+            std::string output;     // 이 라운드의 출력 (다음 라운드 peer message / 마지막 라운드 결과)
+            std::string error;      // 실패 사유
+        };
+
+        /**
+        * @brief 여러 세션의 라운드를 한 번에 실행 (lock 2회, key_id별 준비 1회)
+        * key_id 묶음별 연산은 현재 스레드의 ParallelRunner(핸들러 워커)에 분배 - 없으면 순차 실행
+        * @param outcomes requests[i]의 결과
+        */
+        void ExecuteRounds(const std::vector<const MpcRoundRequest*>& requests, std::vector<RoundOutcome>* outcomes);
+
+        /**
+        * @brief 한 라운드 실행
+        * @param output 이 라운드의 출력 (다음 라운드 peer message / 마지막 라운드 결과)
+        * @param error 실패 사유
+        * @return 라운드 순서/참여자 검증 실패 시 false
+        */
+        bool ExecuteRound(const MpcRoundRequest& request, std::string* output, std::string* error);
+
+        // session_id의 모든 참여자 상태 (presign 세션이면 저장된 presignature 포함) 폐기 - @return 폐기한 상태가 있었는지
+        bool Abort(const std::string& session_id);
+
+        size_t GetActiveSessionCount() const;
+        size_t GetPresignatureCount() const;
+
+    private:
+        void SweepExpiredLocked(uint64_t now_ms);
+    };
+
+    bool NodeHandleMpcRound(const MpcRoundRequest& request, MpcRoundResponse* response);
+    bool NodeHandleMpcRoundBatch(const MpcRoundBatchRequest& request, MpcRoundBatchResponse* response);
+    bool NodeHandleMpcSessionAbort(const MpcSessionAbortRequest& request, MpcSessionAbortResponse* response);
+
+    /**
+    * @brief 세션 전체를 노드 간 mesh로 실행 (라운드마다 ExecuteRound → peer 전송 → peer 메시지 수신)
+    * 세션이 끝날 때까지 핸들러 워커 하나를 점유 - peer 메시지 수신은 mesh 링크 스레드가 처리하므로 교착 없음
+    */
+    bool NodeHandleMpcMeshSession(const MpcMeshSessionRequest& request, MpcMeshSessionResponse* response);
+}
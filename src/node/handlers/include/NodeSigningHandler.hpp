@@ -5,5 +5,5 @@
 namespace mpc_engine::node::handlers
 {
     using namespace mpc_engine::proto::coordinator_node;
-    std::unique_ptr<CoordinatorNodeMessage> NodeHandleSigningRequest(const CoordinatorNodeMessage* request);
-}
\ No newline at end of file
+    bool NodeHandleSigningRequest(const SigningRequest& request, SigningResponse* response);
+}
@@ -1,12 +1,78 @@
 // src/node/handlers/src/NodeMessageRouter.cpp
 #include "node/handlers/include/NodeMessageRouter.hpp"
 #include "node/handlers/include/NodeSigningHandler.hpp"
+#include "node/handlers/include/NodeMpcSessionHandler.hpp"
 #include "types/MessageTypes.hpp"
+#include "common/network/framing/relay.hpp"
+#include "common/utils/metrics/LatencyHistogram.hpp"
+#include "common/utils/threading/CpuAffinity.hpp"
 #include "common/utils/logger/Logger.hpp"
+#include <google/protobuf/arena.h>
 
 namespace mpc_engine::node::handlers
 {
-    bool NodeMessageRouter::Initialize() 
+    // 요청당 arena 초기 블록 (스레드별 재사용) - 일반적인 요청/응답은 이 안에서 끝남
+    constexpr size_t ARENA_INITIAL_BLOCK_SIZE = 16 * 1024;
+
+    namespace
+    {
+        /**
+         * @brief 스레드별 arena 초기 블록
+         * 핸들러 워커가 처음 요청을 처리할 때 할당/first-touch → 워커가 고정된 NUMA 노드의 메모리 사용
+         */
+        struct ThreadArenaBlock
+        {
+            void* memory = utils::AllocateNumaLocal(ARENA_INITIAL_BLOCK_SIZE);
+            ~ThreadArenaBlock() { utils::FreeNumaLocal(memory, ARENA_INITIAL_BLOCK_SIZE); }
+        };
+
+        void WriteError(CoordinatorNodeMessage* response, int32_t message_type, uint64_t request_id,
+                        NodeErrorCode code, const char* error_message)
+        {
+            response->Clear();
+            response->set_message_type(message_type);
+
+            ErrorResponse* error = response->mutable_error_response();
+            ResponseHeader* header = error->mutable_header();
+            header->set_success(false);
+            header->set_error_message(error_message);
+            header->set_request_id(request_id);
+            error->set_code(code);
+        }
+
+        /**
+         * @brief relay 프레임 → 일반 MPC_ROUND 요청 (직전 라운드 envelope를 peer_messages로)
+         * @param error 실패 사유 (정적 문자열)
+         */
+        bool DecodeRelayRound(const NetworkMessage& request, CoordinatorNodeMessage* proto_request, const char** error)
+        {
+            std::string_view round_bytes;
+            std::vector<RelayEnvelopeView> envelopes;
+            if (!DecodeRelayFrame(request.body, &round_bytes, &envelopes)) {
+                *error = "Malformed relay frame";
+                return false;
+            }
+            if (!proto_request->ParseFromArray(round_bytes.data(), static_cast<int>(round_bytes.size())) ||
+                proto_request->message_type() != static_cast<int32_t>(MessageType::MPC_ROUND) ||
+                !proto_request->has_mpc_round_request()) {
+                *error = "Invalid relay round request";
+                return false;
+            }
+
+            MpcRoundRequest* round = proto_request->mutable_mpc_round_request();
+            for (const RelayEnvelopeView& envelope : envelopes) {
+                if (envelope.session_id != round->session_id() || envelope.round + 1 != round->round() ||
+                    !envelope.AddressedTo(round->player_id())) {
+                    *error = "Relay envelope does not match round";
+                    return false;
+                }
+                (*round->mutable_peer_messages())[envelope.from_player].assign(envelope.payload.data(), envelope.payload.size());
+            }
+            return true;
+        }
+    }
+
+    bool NodeMessageRouter::Initialize()
     {
         if (initialized) {
             return true;
@@ -14,38 +80,106 @@ namespace mpc_engine::node::handlers
 
         LOG_INFO("NodeMessageRouter", "Initializing Node Message Router...");
 
-        // 모든 핸들러를 nullptr로 초기화
-        handlers_[static_cast<size_t>(MessageType::SIGNING_REQUEST)] = NodeHandleSigningRequest;
+        Register<SigningRequest>(NodeHandleSigningRequest);
+        Register<MpcRoundRequest>(NodeHandleMpcRound);
+        Register<MpcRoundBatchRequest>(NodeHandleMpcRoundBatch);
+        Register<MpcSessionAbortRequest>(NodeHandleMpcSessionAbort);
+        Register<MpcMeshSessionRequest>(NodeHandleMpcMeshSession);
 
         initialized = true;
         LOG_INFO("NodeMessageRouter", "Node Message Router initialized successfully");
         return true;
     }
 
-    std::unique_ptr<CoordinatorNodeMessage> NodeMessageRouter::ProcessMessage(const CoordinatorNodeMessage* request) 
+    NetworkMessage NodeMessageRouter::Process(const NetworkMessage& request, uint64_t* serialize_ns) const
     {
+        static thread_local ThreadArenaBlock arena_block;
+
+        // 할당 실패 시 초기 블록 없이 arena가 직접 확보
+        google::protobuf::ArenaOptions options;
+        if (arena_block.memory) {
+            options.initial_block = static_cast<char*>(arena_block.memory);
+            options.initial_block_size = ARENA_INITIAL_BLOCK_SIZE;
+        }
+        google::protobuf::Arena arena(options);
+
+        uint16_t message_type = request.header.message_type;
+        uint64_t request_id = request.header.request_id;
+        bool relay = message_type == static_cast<uint16_t>(MessageType::MPC_RELAY_ROUND);
+        const char* relay_error = nullptr;
+
+        auto* proto_request = google::protobuf::Arena::CreateMessage<CoordinatorNodeMessage>(&arena);
+        auto* proto_response = google::protobuf::Arena::CreateMessage<CoordinatorNodeMessage>(&arena);
+
+        // 1. Parse (1회)
+        const Route* route = nullptr;
         if (!initialized) {
             LOG_ERROR("NodeMessageRouter", "NodeMessageRouter not initialized");
-            return nullptr;
+            WriteError(proto_response, message_type, request_id, NODE_ERROR_INTERNAL, "Router not initialized");
         }
-
-        if (!request) {
-            LOG_ERROR("NodeMessageRouter", "Invalid request pointer");
-            return nullptr;
+        else if (relay && !DecodeRelayRound(request, proto_request, &relay_error)) {
+            LOG_ERRORF("NodeMessageRouter", "Rejected relay frame: %s", relay_error);
+            WriteError(proto_response, message_type, request_id, NODE_ERROR_INVALID, relay_error);
+        }
+        else if (!relay && !proto_request->ParseFromArray(request.body.data(), static_cast<int>(request.body.size()))) {
+            LOG_ERROR("NodeMessageRouter", "Failed to parse protobuf message");
+            WriteError(proto_response, message_type, request_id, NODE_ERROR_INVALID, "Invalid protobuf format");
+        }
+        else if (proto_request->message_type() < 0 ||
+                 proto_request->message_type() >= static_cast<int32_t>(MessageType::MAX_MESSAGE_TYPE) ||
+                 !routes_[proto_request->message_type()].invoke) {
+            LOG_ERRORF("NodeMessageRouter", "No handler for message type: %d", proto_request->message_type());
+            WriteError(proto_response, message_type, request_id, NODE_ERROR_INVALID, "Unsupported message type");
         }
+        else {
+            route = &routes_[proto_request->message_type()];
+            if (proto_request->payload_case() != route->request_case) {
+                LOG_ERRORF("NodeMessageRouter", "Unexpected payload %d for message type %d",
+                           static_cast<int>(proto_request->payload_case()), proto_request->message_type());
+                WriteError(proto_response, message_type, request_id, NODE_ERROR_INVALID, "Payload does not match message type");
+                route = nullptr;
+            }
+        }
+
+        // 2. Dispatch - 핸들러가 arena 응답에 직접 기록
+        if (route) {
+            LOG_DEBUGF("NodeMessageRouter", "Processing message type: %d", proto_request->message_type());
+            proto_response->set_message_type(proto_request->message_type());
+
+            bool handled = false;
+            try {
+                handled = route->invoke(route->handler, *proto_request, proto_response);
+            } catch (const std::exception& e) {
+                LOG_ERRORF("NodeMessageRouter", "Handler threw: %s", e.what());
+            }
 
-        int32_t index = request->message_type();
-        if (index >= static_cast<int32_t>(MessageType::MAX_MESSAGE_TYPE)) {
-            LOG_ERRORF("NodeMessageRouter", "Invalid message type: %d", index);
-            return nullptr;
+            if (!handled) {
+                WriteError(proto_response, message_type, request_id, NODE_ERROR_INTERNAL, "No response generated");
+            }
         }
 
-        if (!handlers_[index]) {
-            LOG_ERRORF("NodeMessageRouter", "No handler for message type: %d", index);
-            return nullptr;
+        // 3. Serialize (1회) - 프레임 body에 직접
+        // relay 요청의 성공 응답은 envelope (coordinator가 파싱 없이 다음 라운드에 전달), 실패는 일반 protobuf 응답
+        uint64_t serialize_start_ns = serialize_ns ? utils::MonotonicNowNs() : 0;
+
+        NetworkMessage response;
+        if (route && relay && proto_response->has_mpc_round_response() && proto_response->mpc_round_response().header().success()) {
+            const MpcRoundResponse& round = proto_response->mpc_round_response();
+            response.body = EncodeRelayEnvelope(round.session_id(), round.round(), round.player_id(), {}, round.output());
+            response.header.message_type = message_type;
+        } else {
+            response.body.resize(proto_response->ByteSizeLong());
+            proto_response->SerializeWithCachedSizesToArray(response.body.data());
+            response.header.message_type = static_cast<uint16_t>(proto_response->message_type());
         }
 
-        LOG_DEBUGF("NodeMessageRouter", "Processing message type: %d", index);
-        return handlers_[index](request);
+        response.header.body_length = static_cast<uint32_t>(response.body.size());
+        response.header.request_id = request_id;
+        response.header.checksum = MessageHeader::ComputeChecksum(response.body);
+
+        if (serialize_ns) {
+            *serialize_ns = utils::MonotonicNowNs() - serialize_start_ns;
+        }
+        return response;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,514 @@
+// src/node/handlers/src/NodeMpcSessionHandler.cpp
+#include "node/handlers/include/NodeMpcSessionHandler.hpp"
+#include "common/utils/socket/SocketUtils.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include "common/utils/threading/ParallelRunner.hpp"
+#include "node/network/include/NodePeerMesh.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <unordered_map>
+
+namespace mpc_engine::node::handlers
+{
+    constexpr uint64_t SESSION_IDLE_TIMEOUT_MS = 5 * 60 * 1000;   // 라운드 사이 유휴 상한 (coordinator 유실 대비)
+    constexpr uint64_t SESSION_SWEEP_INTERVAL_MS = 1000;
+    constexpr uint64_t PRESIGNATURE_TTL_MS = 60 * 60 * 1000;      // coordinator pool의 max age보다 길게
+    constexpr uint32_t MESH_ROUND_TIMEOUT_MS = 10000;              // 요청에 round_timeout_ms가 없을 때
+
+    namespace
+    {
+        // FNV-1a (mock 라운드 출력용 - 실제 프로토콜 연산은 mpc-sdk provider가 대체)
+        class Digest
+        {
+        private:
+            uint64_t hash = 1469598103934665603ULL;
+
+        public:
+            Digest& Add(const std::string& data)
+            {
+                for (unsigned char c : data) {
+                    hash = (hash ^ c) * 1099511628211ULL;
+                }
+                hash = (hash ^ 0xFF) * 1099511628211ULL;   // 필드 구분자
+                return *this;
+            }
+
+            Digest& Add(uint64_t value) { return Add(std::to_string(value)); }
+
+            std::string Hex() const
+            {
+                char buffer[17];
+                std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(hash));
+                return buffer;
+            }
+        };
+
+        const char* FinalOutputPrefix(MpcProtocol protocol)
+        {
+            switch (protocol) {
+                case MPC_PROTOCOL_KEYGEN:           return "MOCK_PUBKEY_";
+                case MPC_PROTOCOL_ECDSA_PRESIGN:    return "MOCK_PRESIG_";
+                default:                            return "MOCK_SIGNATURE_";
+            }
+        }
+
+        /**
+        * @brief key_id별 세션 공통 준비 (mock: key_id로 시드한 digest)
+        * 실제 provider에서는 키 share 로딩 / Paillier·곡선 사전 계산이 여기에 해당 - 배치 안에서 key_id당 1회
+        */
+        Digest PrepareKeyContext(const std::string& key_id)
+        {
+            Digest context;
+            context.Add(key_id);
+            return context;
+        }
+
+        /**
+        * @brief 라운드 출력 (mock)
+        * 중간 라운드: 참여자별 메시지 / 마지막 라운드: 모든 참여자가 같은 결과 (공개키, presignature 또는 서명)
+        * @param presignature ONLINE_SIGNING에서 소비한 presignature
+        */
+        std::string ComputeRoundOutput(const MpcRoundRequest& request, const Digest& key_context, const std::string& presignature)
+        {
+            // 온라인 서명: presignature + 메시지 해시만으로 1 라운드에 완료
+            if (request.protocol() == MPC_PROTOCOL_ECDSA_ONLINE_SIGNING) {
+                Digest digest = key_context;
+                digest.Add(presignature).Add(request.session_input());
+                return FinalOutputPrefix(request.protocol()) + digest.Hex();
+            }
+
+            // map 순서는 보장되지 않으므로 player_id 순으로 정렬해서 입력
+            std::vector<uint64_t> players(request.player_ids().begin(), request.player_ids().end());
+            std::sort(players.begin(), players.end());
+
+            Digest digest = key_context;
+            digest.Add(request.session_id()).Add(request.round());
+            for (uint64_t player : players) {
+                auto it = request.peer_messages().find(player);
+                digest.Add(player).Add(it != request.peer_messages().end() ? it->second : std::string());
+            }
+
+            if (request.round() == request.total_rounds()) {
+                return FinalOutputPrefix(request.protocol()) + digest.Hex();
+            }
+            if (request.round() == 1) {
+                digest.Add(request.session_input());
+            }
+            return "R" + std::to_string(request.round()) + "_P" + std::to_string(request.player_id()) + "_" +
+                   digest.Add(request.player_id()).Hex();
+        }
+
+        bool ValidateRequest(const MpcRoundRequest& request, std::string* error)
+        {
+            if (request.session_id().empty() || request.protocol() == MPC_PROTOCOL_UNSPECIFIED) {
+                *error = "Missing session_id or protocol";
+                return false;
+            }
+            if (request.round() == 0 || request.round() > request.total_rounds()) {
+                *error = "Invalid round " + std::to_string(request.round()) + "/" + std::to_string(request.total_rounds());
+                return false;
+            }
+            if (request.threshold() == 0 || static_cast<int>(request.threshold()) > request.player_ids_size()) {
+                *error = "Invalid threshold";
+                return false;
+            }
+            if (std::find(request.player_ids().begin(), request.player_ids().end(), request.player_id()) == request.player_ids().end()) {
+                *error = "Player " + std::to_string(request.player_id()) + " is not a session participant";
+                return false;
+            }
+
+            // round 2부터는 직전 라운드의 모든 참여자 출력이 필요
+            if (request.round() > 1) {
+                for (uint64_t player : request.player_ids()) {
+                    if (request.peer_messages().find(player) == request.peer_messages().end()) {
+                        *error = "Missing round " + std::to_string(request.round() - 1) + " message from player " + std::to_string(player);
+                        return false;
+                    }
+                }
+            }
+            if (request.protocol() == MPC_PROTOCOL_ECDSA_ONLINE_SIGNING &&
+                (request.presignature_id().empty() || request.total_rounds() != 1)) {
+                *error = "Online signing requires a presignature_id and a single round";
+                return false;
+            }
+            return true;
+        }
+
+        std::vector<uint64_t> SortedPlayers(const MpcRoundRequest& request)
+        {
+            std::vector<uint64_t> players(request.player_ids().begin(), request.player_ids().end());
+            std::sort(players.begin(), players.end());
+            return players;
+        }
+    }
+
+    bool NodeMpcSessionStore::ExecuteRound(const MpcRoundRequest& request, std::string* output, std::string* error)
+    {
+        std::vector<RoundOutcome> outcomes;
+        ExecuteRounds({ &request }, &outcomes);
+        if (!outcomes[0].success) {
+            *error = std::move(outcomes[0].error);
+            return false;
+        }
+        *output = std::move(outcomes[0].output);
+        return true;
+    }
+
+    void NodeMpcSessionStore::ExecuteRounds(const std::vector<const MpcRoundRequest*>& requests, std::vector<RoundOutcome>* outcomes)
+    {
+        outcomes->assign(requests.size(), RoundOutcome());
+        std::vector<bool> compute(requests.size(), false);
+        std::vector<std::string> consumed(requests.size());     // ONLINE_SIGNING이 소비한 presignature
+        uint64_t now_ms = utils::GetCurrentTimeMs();
+
+        // 1. 라운드 순서 확인 (재전송이면 저장된 출력 반환) - 배치 전체에 lock 1회
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            SweepExpiredLocked(now_ms);
+
+            for (size_t i = 0; i < requests.size(); ++i) {
+                const MpcRoundRequest& request = *requests[i];
+                RoundOutcome& outcome = (*outcomes)[i];
+                if (!ValidateRequest(request, &outcome.error)) {
+                    continue;
+                }
+
+                uint32_t round = request.round();
+                auto it = sessions.find(SessionKey(request.session_id(), request.player_id()));
+                if (it != sessions.end() && it->second.completed_round == round) {
+                    it->second.last_active_ms = now_ms;
+                    outcome.output = it->second.last_output;
+                    outcome.success = true;
+                    continue;
+                }
+
+                uint32_t completed = (it != sessions.end()) ? it->second.completed_round : 0;
+                if (completed + 1 != round) {
+                    outcome.error = "Out-of-order round " + std::to_string(round) + " (completed " + std::to_string(completed) + ")";
+                    continue;
+                }
+                if (it != sessions.end() &&
+                    (it->second.protocol != request.protocol() || it->second.total_rounds != request.total_rounds())) {
+                    outcome.error = "Session parameters changed between rounds";
+                    continue;
+                }
+
+                // presignature는 여기서 제거 - 이후 같은 id로 오는 요청은 모두 거부 (1회용)
+                if (request.protocol() == MPC_PROTOCOL_ECDSA_ONLINE_SIGNING) {
+                    auto presig = presignatures.find(PresignatureKey(request.key_id(), request.presignature_id(), request.player_id()));
+                    if (presig == presignatures.end()) {
+                        outcome.error = "Unknown or already consumed presignature " + request.presignature_id();
+                        continue;
+                    }
+                    if (presig->second.player_ids != SortedPlayers(request)) {
+                        outcome.error = "Presignature " + request.presignature_id() + " was generated for a different signer set";
+                        continue;
+                    }
+                    consumed[i] = std::move(presig->second.data);
+                    presignatures.erase(presig);
+                }
+                compute[i] = true;
+            }
+        }
+
+        // 2. 라운드 연산 (lock 밖) - key_id별로 묶어 준비는 1회, 묶음 단위로 핸들러 워커에 분배
+        std::unordered_map<std::string, size_t> key_groups;
+        std::vector<std::vector<size_t>> groups;
+        for (size_t i = 0; i < requests.size(); ++i) {
+            if (!compute[i]) {
+                continue;
+            }
+            auto inserted = key_groups.emplace(requests[i]->key_id(), groups.size());
+            if (inserted.second) {
+                groups.emplace_back();
+            }
+            groups[inserted.first->second].push_back(i);
+        }
+        utils::ParallelFor(groups.size(), [&](size_t group) {
+            Digest key_context = PrepareKeyContext(requests[groups[group].front()]->key_id());
+            for (size_t i : groups[group]) {
+                (*outcomes)[i].output = ComputeRoundOutput(*requests[i], key_context, consumed[i]);
+            }
+        });
+
+        // 3. 결과 기록 - 마지막 라운드면 세션 종료
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < requests.size(); ++i) {
+            if (!compute[i]) {
+                continue;
+            }
+            const MpcRoundRequest& request = *requests[i];
+            RoundOutcome& outcome = (*outcomes)[i];
+            const SessionKey key(request.session_id(), request.player_id());
+            uint32_t round = request.round();
+
+            if (round == request.total_rounds()) {
+                sessions.erase(key);
+                if (request.protocol() == MPC_PROTOCOL_ECDSA_PRESIGN) {
+                    Presignature& presig = presignatures[PresignatureKey(request.key_id(), request.session_id(), request.player_id())];
+                    presig.data = outcome.output;
+                    presig.player_ids = SortedPlayers(request);
+                    presig.created_ms = now_ms;
+                }
+                outcome.success = true;
+                continue;
+            }
+
+            Session& session = sessions[key];
+            if (session.completed_round + 1 != round) {
+                outcome.error = "Concurrent request for the same round";
+                outcome.output.clear();
+                continue;
+            }
+            if (round == 1) {
+                session.protocol = request.protocol();
+                session.key_id = request.key_id();
+                session.player_ids.assign(request.player_ids().begin(), request.player_ids().end());
+                session.total_rounds = request.total_rounds();
+            }
+            session.completed_round = round;
+            session.last_output = outcome.output;
+            session.last_active_ms = now_ms;
+            outcome.success = true;
+        }
+    }
+
+    bool NodeMpcSessionStore::Abort(const std::string& session_id)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto first = sessions.lower_bound(SessionKey(session_id, 0));
+        auto last = first;
+        while (last != sessions.end() && last->first.first == session_id) {
+            ++last;
+        }
+        bool existed = first != last;
+        sessions.erase(first, last);
+
+        // presign 세션이 마지막 라운드 합의에 실패한 경우 - 일부 노드에만 저장된 presignature도 폐기 (abort는 드묾)
+        for (auto it = presignatures.begin(); it != presignatures.end(); ) {
+            if (std::get<1>(it->first) == session_id) {
+                it = presignatures.erase(it);
+                existed = true;
+            } else {
+                ++it;
+            }
+        }
+        return existed;
+    }
+
+    size_t NodeMpcSessionStore::GetActiveSessionCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return sessions.size();
+    }
+
+    size_t NodeMpcSessionStore::GetPresignatureCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return presignatures.size();
+    }
+
+    void NodeMpcSessionStore::SweepExpiredLocked(uint64_t now_ms)
+    {
+        if (now_ms - last_sweep_ms < SESSION_SWEEP_INTERVAL_MS) {
+            return;
+        }
+        last_sweep_ms = now_ms;
+
+        for (auto it = sessions.begin(); it != sessions.end(); ) {
+            if (now_ms - it->second.last_active_ms > SESSION_IDLE_TIMEOUT_MS) {
+                LOG_WARNF("NodeMpcSessionHandler", "Session %s expired at round %u", it->first.first.c_str(), it->second.completed_round);
+                it = sessions.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        for (auto it = presignatures.begin(); it != presignatures.end(); ) {
+            if (now_ms - it->second.created_ms > PRESIGNATURE_TTL_MS) {
+                it = presignatures.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    namespace
+    {
+        void FillRoundResponse(const MpcRoundRequest& request, NodeMpcSessionStore::RoundOutcome& outcome, MpcRoundResponse* response)
+        {
+            ResponseHeader* header = response->mutable_header();
+            header->set_request_id(request.header().request_id());
+            response->set_session_id(request.session_id());
+            response->set_round(request.round());
+            response->set_player_id(request.player_id());
+
+            if (!outcome.success) {
+                LOG_ERRORF("NodeMpcSessionHandler", "Session %s round %u rejected: %s",
+                           request.session_id().c_str(), request.round(), outcome.error.c_str());
+                header->set_success(false);
+                header->set_error_message(outcome.error);
+                return;
+            }
+
+            header->set_success(true);
+            response->set_output(std::move(outcome.output));
+        }
+    }
+
+    bool NodeHandleMpcRound(const MpcRoundRequest& request, MpcRoundResponse* response)
+    {
+        LOG_DEBUGF("NodeMpcSessionHandler", "Session %s round %u/%u (player %llu)", request.session_id().c_str(),
+                   request.round(), request.total_rounds(), static_cast<unsigned long long>(request.player_id()));
+
+        std::vector<NodeMpcSessionStore::RoundOutcome> outcomes;
+        NodeMpcSessionStore::Instance().ExecuteRounds({ &request }, &outcomes);
+        FillRoundResponse(request, outcomes[0], response);
+        return true;
+    }
+
+    bool NodeHandleMpcRoundBatch(const MpcRoundBatchRequest& request, MpcRoundBatchResponse* response)
+    {
+        LOG_DEBUGF("NodeMpcSessionHandler", "Round batch of %d", request.rounds_size());
+
+        std::vector<const MpcRoundRequest*> rounds;
+        rounds.reserve(request.rounds_size());
+        for (const MpcRoundRequest& round : request.rounds()) {
+            rounds.push_back(&round);
+        }
+
+        std::vector<NodeMpcSessionStore::RoundOutcome> outcomes;
+        NodeMpcSessionStore::Instance().ExecuteRounds(rounds, &outcomes);
+
+        response->mutable_rounds()->Reserve(request.rounds_size());
+        for (int i = 0; i < request.rounds_size(); ++i) {
+            FillRoundResponse(request.rounds(i), outcomes[i], response->add_rounds());
+        }
+
+        // 배치 자체는 항상 성공 - 세션별 결과는 rounds[i].header
+        ResponseHeader* header = response->mutable_header();
+        header->set_success(true);
+        header->set_request_id(request.header().request_id());
+        return true;
+    }
+
+    bool NodeHandleMpcSessionAbort(const MpcSessionAbortRequest& request, MpcSessionAbortResponse* response)
+    {
+        bool existed = NodeMpcSessionStore::Instance().Abort(request.session_id());
+        network::NodePeerMesh::DropSessionAll(request.session_id());     // mesh 세션이면 peer 메시지 대기도 중단
+        LOG_DEBUGF("NodeMpcSessionHandler", "Session %s aborted (%s): %s", request.session_id().c_str(),
+                   existed ? "dropped" : "unknown", request.reason().c_str());
+
+        ResponseHeader* header = response->mutable_header();
+        header->set_success(true);
+        header->set_request_id(request.header().request_id());
+        response->set_session_id(request.session_id());
+        return true;
+    }
+    namespace
+    {
+        /**
+        * @brief mesh 세션 실행 - 라운드 출력은 다른 참여자에게 직접 보내고, 다음 라운드 입력은 mesh에서 수신
+        * 라운드 요청은 coordinator 중계와 같은 내용이므로 결과도 같음
+        */
+        bool RunMeshSession(const MpcMeshSessionRequest& request, std::string* output, uint32_t* completed_rounds, std::string* error)
+        {
+            const MpcRoundRequest& session = request.session();
+            const MpcMeshPeer* self = nullptr;
+            std::map<uint64_t, network::PeerEndpoint> targets;     // player_id → 그 player의 노드
+            std::map<uint64_t, std::string> senders;
+            for (const MpcMeshPeer& peer : request.peers()) {
+                if (peer.player_id() == session.player_id()) {
+                    self = &peer;
+                    continue;
+                }
+                targets[peer.player_id()] = { peer.node_id(), peer.host(), static_cast<uint16_t>(peer.port()) };
+                senders[peer.player_id()] = peer.node_id();
+            }
+            if (!self || request.peers_size() != session.player_ids_size()) {
+                *error = "Mesh peers do not match the session participants";
+                return false;
+            }
+
+            std::shared_ptr<network::NodePeerMesh> mesh = network::NodePeerMesh::Find(self->node_id());
+            if (!mesh) {
+                *error = "Peer mesh is not enabled on " + self->node_id();
+                return false;
+            }
+
+            uint32_t round_timeout_ms = request.round_timeout_ms() > 0 ? request.round_timeout_ms() : MESH_ROUND_TIMEOUT_MS;
+            MpcRoundRequest round_request = session;
+            for (uint32_t round = 1; round <= session.total_rounds(); ++round) {
+                round_request.set_round(round);
+                std::string round_output;
+                if (!NodeMpcSessionStore::Instance().ExecuteRound(round_request, &round_output, error)) {
+                    return false;
+                }
+                *completed_rounds = round;
+                if (round == session.total_rounds()) {
+                    *output = std::move(round_output);
+                    return true;
+                }
+
+                // 수신 노드별 mTLS 링크로만 전송 (coordinator는 라운드 메시지를 보지 않음)
+                MpcPeerMessage message;
+                message.set_session_id(session.session_id());
+                message.set_round(round);
+                message.set_from_player(session.player_id());
+                message.set_payload(round_output);
+                for (const auto& target : targets) {
+                    message.set_to_player(target.first);
+                    if (!mesh->Send(target.second, message, error)) {
+                        return false;
+                    }
+                }
+
+                std::map<uint64_t, std::string> received;
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(round_timeout_ms);
+                if (!mesh->Receive(session.session_id(), round, session.player_id(), senders, deadline, &received, error)) {
+                    return false;
+                }
+
+                round_request.clear_session_input();
+                auto* peer_messages = round_request.mutable_peer_messages();
+                peer_messages->clear();
+                (*peer_messages)[session.player_id()] = std::move(round_output);
+                for (auto& entry : received) {
+                    (*peer_messages)[entry.first] = std::move(entry.second);
+                }
+            }
+            *error = "Session has no rounds";
+            return false;
+        }
+    }
+
+    bool NodeHandleMpcMeshSession(const MpcMeshSessionRequest& request, MpcMeshSessionResponse* response)
+    {
+        const MpcRoundRequest& session = request.session();
+        LOG_DEBUGF("NodeMpcSessionHandler", "Mesh session %s (%u rounds, player %llu)", session.session_id().c_str(),
+                   session.total_rounds(), static_cast<unsigned long long>(session.player_id()));
+
+        std::string output;
+        std::string error;
+        uint32_t completed_rounds = 0;
+        bool success = RunMeshSession(request, &output, &completed_rounds, &error);
+
+        ResponseHeader* header = response->mutable_header();
+        header->set_request_id(request.header().request_id());
+        response->set_session_id(session.session_id());
+        response->set_player_id(session.player_id());
+        response->set_completed_rounds(completed_rounds);
+        if (!success) {
+            LOG_ERRORF("NodeMpcSessionHandler", "Mesh session %s failed after %u rounds: %s",
+                       session.session_id().c_str(), completed_rounds, error.c_str());
+            header->set_success(false);
+            header->set_error_message(error);
+            return true;
+        }
+
+        header->set_success(true);
+        response->set_output(std::move(output));
+        return true;
+    }
+}
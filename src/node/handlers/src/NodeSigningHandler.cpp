@@ -6,26 +6,15 @@
 
 namespace mpc_engine::node::handlers
 {
-    std::unique_ptr<CoordinatorNodeMessage> NodeHandleSigningRequest(const CoordinatorNodeMessage* request) 
+    // 응답 payload는 NodeMessageRouter가 arena에 할당해 넘겨줌 (payload 타입 검사도 router 담당)
+    bool NodeHandleSigningRequest(const SigningRequest& signingReq, SigningResponse* signingRes) 
     {
         LOG_DEBUG("NodeSigningHandler", "=== NodeHandleSigningRequest ===");
 
-        if (!request->has_signing_request()) {
-            LOG_ERROR("NodeSigningHandler", "Request does not contain signing_request");
-            return nullptr;
-        }
-
-        const SigningRequest& signingReq = request->signing_request();
-
-        auto response = std::make_unique<CoordinatorNodeMessage>();
-        response->set_message_type(static_cast<int32_t>(mpc_engine::MessageType::SIGNING_REQUEST));
-        
-        SigningResponse* signingRes = response->mutable_signing_response();
-
         try 
         {
             LOG_DEBUGF("NodeSigningHandler", "Processing key: %s", signingReq.key_id().c_str());
-            LOG_DEBUGF("NodeSigningHandler", "Transaction data (first 50 chars): %s...", signingReq.transaction_data().substr(0, 50).c_str());
+            LOG_DEBUGF("NodeSigningHandler", "Transaction data (first 50 chars): %.50s...", signingReq.transaction_data().c_str());
             LOG_DEBUGF("NodeSigningHandler", "Threshold: %d", signingReq.threshold());
             LOG_DEBUGF("NodeSigningHandler", "Total shards: %d", signingReq.total_shards());
 
@@ -35,7 +24,10 @@ namespace mpc_engine::node::handlers
 
             // 간단한 시뮬레이션 서명 생성
             signingRes->set_key_id(signingReq.key_id());
-            signingRes->set_signature("NODE_MOCK_SIGNATURE_" + signingReq.key_id() + "_" + std::to_string(utils::GetCurrentTimeMs()));
+            std::string* signature = signingRes->mutable_signature();
+            signature->reserve(32 + signingReq.key_id().size());
+            signature->append("NODE_MOCK_SIGNATURE_").append(signingReq.key_id()).append("_");
+            signature->append(std::to_string(utils::GetCurrentTimeMs()));
             signingRes->set_shard_index(0);
 
             LOG_DEBUG("NodeSigningHandler", "Mock signing completed successfully");
@@ -50,6 +42,6 @@ namespace mpc_engine::node::handlers
             header->set_request_id(signingReq.header().request_id());
         }
         
-        return response;
+        return true;
     }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 // src/node/main.cpp
 #include "NodeServer.hpp"
+#include "node/network/include/ListenerHandoff.hpp"
 #include "types/BasicTypes.hpp"
 #include "common/env/EnvManager.hpp"
 #include "common/kms/include/KMSManager.hpp"
@@ -7,6 +8,7 @@
 #include "common/resource/include/ReadOnlyResLoaderManager.hpp"
 #include "common/utils/logger/Logger.hpp"
 #include <signal.h>
+#include <unistd.h>
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
@@ -23,6 +25,7 @@ static NodeServer* g_node_server = nullptr;
 static std::atomic<bool> g_shutdown_requested{false};
 static std::condition_variable g_shutdown_cv;
 static std::mutex g_shutdown_mutex;
+static std::atomic<bool> g_latency_dump_requested{false};
 
 void SignalHandler(int signal) {
     LOG_INFOF("NodeTcpServer", "Received signal %d, shutting down gracefully...", signal);
@@ -38,6 +41,22 @@ void SignalHandler(int signal) {
     g_shutdown_cv.notify_one();
 }
 
+// SIGUSR1: 지연 히스토그램 즉시 덤프 (메인 루프에서 출력)
+void LatencyDumpSignalHandler(int) {
+    g_latency_dump_requested.store(true);
+    g_shutdown_cv.notify_one();
+}
+
+// 후속 프로세스가 listening socket을 인수함 → drain 후 종료 (핸드오프 스레드에서 호출)
+void OnListenerHandedOff() {
+    LOG_INFO("NodeTcpServer", "Listener handed off to new process, draining...");
+    {
+        std::lock_guard<std::mutex> lock(g_shutdown_mutex);
+        g_shutdown_requested.store(true);
+    }
+    g_shutdown_cv.notify_one();
+}
+
 void PrintUsage(const char* program_name) {
     LOG_INFOF("NodeTcpServer", "Usage: %s [--env ENVIRONMENT] --id NODE_ID", program_name);
     LOG_INFO("NodeTcpServer", "");
@@ -46,9 +65,11 @@ void PrintUsage(const char* program_name) {
     LOG_INFO("NodeTcpServer", "Options:");
     LOG_INFO("NodeTcpServer", "  --env ENV      Environment (local, dev, qa, production). Default: local");
     LOG_INFO("NodeTcpServer", "  --id NODE_ID   Node identifier (must match NODE_IDS in config)");
+    LOG_INFO("NodeTcpServer", "  --takeover     Take over the listening socket of the running node (zero-downtime restart)");
     LOG_INFO("NodeTcpServer", "");
     LOG_INFO("NodeTcpServer", "Examples:");
     LOG_INFOF("NodeTcpServer", "  %s --id node_1", program_name);
+    LOG_INFOF("NodeTcpServer", "  %s --id node_1 --takeover", program_name);
     LOG_INFOF("NodeTcpServer", "  %s --env production --id node_aws_1", program_name);
 }
 
@@ -59,6 +80,7 @@ int main(int argc, char* argv[]) {
     // 명령행 인자 파싱
     std::string env_type = "local";
     std::string node_id = "";
+    bool takeover = false;
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -70,6 +92,8 @@ int main(int argc, char* argv[]) {
             env_type = argv[++i];
         } else if (arg == "--id" && i + 1 < argc) {
             node_id = argv[++i];
+        } else if (arg == "--takeover") {
+            takeover = true;
         }
     }
 
@@ -105,6 +129,10 @@ int main(int argc, char* argv[]) {
         std::vector<std::string> platforms = Config::GetStringArray("NODE_PLATFORMS");
         std::vector<std::string> tls_cert_paths = Config::GetStringArray("TLS_CERT_PATHS");
         std::vector<std::string> tls_kms_nodes_coordinator_key_ids = Config::GetStringArray("TLS_KMS_NODES_COORDINATOR_KEY_IDS");
+        std::vector<std::pair<std::string, uint16_t>> mesh_hosts;
+        if (Config::HasKey("NODE_MESH_HOSTS")) {
+            mesh_hosts = Config::GetNodeEndpoints("NODE_MESH_HOSTS");
+        }
 
         // NodeConfig 설정
         NodeConfig config;
@@ -119,6 +147,10 @@ int main(int argc, char* argv[]) {
                     config.platform_type = PlatformTypeFromString(platforms[i]);
                     config.certificate_path = tls_cert_paths[i];
                     config.private_key_id = tls_kms_nodes_coordinator_key_ids[i];
+                    if (i < mesh_hosts.size()) {
+                        config.mesh_bind_address = mesh_hosts[i].first;
+                        config.mesh_port = mesh_hosts[i].second;
+                    }
                     found = true;
                     break;
                 }
@@ -138,6 +170,9 @@ int main(int argc, char* argv[]) {
         LOG_INFOF("NodeTcpServer", "  Node ID: %s", node_id.c_str());
         LOG_INFOF("NodeTcpServer", "  Platform: %s", PlatformTypeToString(config.platform_type).c_str());
         LOG_INFOF("NodeTcpServer", "  Bind Address: %s:%d", config.bind_address.c_str(), config.bind_port);
+        if (config.mesh_port > 0) {
+            LOG_INFOF("NodeTcpServer", "  Peer Mesh: %s:%d", config.mesh_bind_address.c_str(), config.mesh_port);
+        }
         LOG_INFO("NodeTcpServer", "");
 
         // readonly resource loader 초기화
@@ -153,6 +188,26 @@ int main(int argc, char* argv[]) {
         KMSManager::InitializeLocal(config.platform_type, kms_config_path); // 기본값 설정
         LOG_INFO("NodeTcpServer", "✓ KMS initialized successfully");
 
+        // 무중단 재시작: 실행 중인 프로세스의 listening socket 인수
+        std::string handoff_dir = Config::HasKey("NODE_HANDOFF_SOCKET_DIR") ? Config::GetString("NODE_HANDOFF_SOCKET_DIR") : "";
+        std::string handoff_path = handoff_dir.empty() ? "" : ListenerHandoff::GetPath(handoff_dir, node_id);
+        std::unique_ptr<ListenerHandoff> handoff;
+
+        if (takeover) {
+            if (handoff_path.empty()) {
+                LOG_ERROR("NodeTcpServer", "--takeover requires NODE_HANDOFF_SOCKET_DIR");
+                return 1;
+            }
+            uint32_t handoff_timeout_ms = Config::HasKey("NODE_HANDOFF_TIMEOUT_MS") ? Config::GetUInt32("NODE_HANDOFF_TIMEOUT_MS") : 10000;
+            handoff = ListenerHandoff::Acquire(handoff_path, handoff_timeout_ms);
+            if (!handoff) {
+                LOG_ERROR("NodeTcpServer", "Failed to take over listening socket");
+                return 1;
+            }
+            config.inherited_listener = handoff->ReleaseListener();
+            config.inherited_mesh_listener = handoff->ReleaseMeshListener();
+        }
+
         // NodeServer 생성
         NodeServer node_server(config);
         g_node_server = &node_server;
@@ -160,6 +215,7 @@ int main(int argc, char* argv[]) {
         // 시그널 핸들러
         signal(SIGINT, SignalHandler);
         signal(SIGTERM, SignalHandler);
+        signal(SIGUSR1, LatencyDumpSignalHandler);
 
         // 서버 초기화
         if (!node_server.Initialize()) {
@@ -183,6 +239,18 @@ int main(int argc, char* argv[]) {
             return 1;
         }
 
+        // 이전 프로세스에 인수 완료 통지 → 이전 프로세스는 drain 후 종료
+        if (handoff) {
+            handoff->Confirm();
+            handoff.reset();
+        }
+
+        // 다음 재시작을 위한 핸드오프 대기
+        if (tcp_server && !handoff_path.empty()) {
+            tcp_server->SetHandoffHandler(OnListenerHandedOff);
+            tcp_server->EnableListenerHandoff(handoff_path);
+        }
+
         // 시작 정보 출력
         LOG_INFO("NodeTcpServer", "========================================");
         LOG_INFO("NodeTcpServer", "  Node Server Running");
@@ -196,14 +264,29 @@ int main(int argc, char* argv[]) {
         }
         LOG_INFO("NodeTcpServer", "========================================");
         LOG_INFO("NodeTcpServer", "Server is running. Press Ctrl+C to stop.");
+        LOG_INFOF("NodeTcpServer", "Send SIGUSR1 (kill -USR1 %d) to dump latency histograms.", getpid());
         LOG_INFO("NodeTcpServer", "");
 
         // 메인 루프
-        {
-            std::unique_lock<std::mutex> lock(g_shutdown_mutex);
-            g_shutdown_cv.wait(lock, []{ 
-                return g_shutdown_requested.load() || !g_node_server->IsRunning(); 
-            });
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(g_shutdown_mutex);
+                g_shutdown_cv.wait(lock, []{ 
+                    return g_shutdown_requested.load() || !g_node_server->IsRunning() || g_latency_dump_requested.load(); 
+                });
+            }
+
+            if (g_latency_dump_requested.exchange(false) && tcp_server) {
+                tcp_server->DumpLatencyStats();
+            }
+            if (g_shutdown_requested.load() || !g_node_server->IsRunning()) {
+                break;
+            }
+        }
+
+        // 핸드오프로 깨어난 경우: 진행 중인 요청 drain 후 종료 (시그널 경로는 이미 Stop됨)
+        if (node_server.IsRunning()) {
+            node_server.Stop();
         }
 
     } catch (const ConfigMissingException& e) {
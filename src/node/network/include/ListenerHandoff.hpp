@@ -0,0 +1,61 @@
+// src/node/network/include/ListenerHandoff.hpp
+#pragma once
+#include "types/BasicTypes.hpp"
+#include <memory>
+#include <string>
+
+namespace mpc_engine::node::network
+{
+    /**
+     * @brief 무중단 재시작 - 새 프로세스 측 listening socket 인수
+     *
+     * 핸드오프 프로토콜 (Unix domain socket):
+     *   1. 새 프로세스 → 기존: HANDOFF_REQUEST
+     *   2. 기존 → 새: accept 중단 후 listening socket 전달 (HANDOFF_LISTENER + SCM_RIGHTS)
+     *      이어서 peer mesh listening socket 전달 (HANDOFF_MESH_LISTENER + SCM_RIGHTS, mesh가 없으면 HANDOFF_NO_MESH)
+     *   3. 새 프로세스: 전달받은 소켓으로 서버 시작 후 Confirm() → HANDOFF_READY
+     *   4. 기존: READY 수신 시 drain(PrepareShutdown) 후 종료
+     *      READY 없이 채널이 끊기면 기존 프로세스가 다시 accept (롤백)
+     *
+     * 포트를 닫았다 다시 여는 구간이 없으므로 Coordinator 재접속은 바로 새 프로세스로 연결됩니다.
+     */
+    class ListenerHandoff
+    {
+    public:
+        static constexpr char HANDOFF_REQUEST = 'T';
+        static constexpr char HANDOFF_LISTENER = 'L';
+        static constexpr char HANDOFF_READY = 'R';
+        static constexpr char HANDOFF_MESH_LISTENER = 'M';
+        static constexpr char HANDOFF_NO_MESH = 'N';
+
+        /**
+        * @brief 실행 중인 프로세스로부터 listening socket 인수
+        * @return 실패 시 nullptr
+        */
+        static std::unique_ptr<ListenerHandoff> Acquire(const std::string& path, uint32_t timeout_ms);
+
+        // 노드별 핸드오프 경로 (dir/mpc-node-<node_id>.sock)
+        static std::string GetPath(const std::string& dir, const std::string& node_id);
+
+        ~ListenerHandoff();
+
+        ListenerHandoff(const ListenerHandoff&) = delete;
+        ListenerHandoff& operator=(const ListenerHandoff&) = delete;
+
+        // 인수한 listening socket 소유권을 넘김 (NodeConfig.inherited_listener로 전달)
+        socket_t ReleaseListener();
+
+        // 인수한 mesh listening socket 소유권을 넘김 (NodeConfig.inherited_mesh_listener, 없으면 INVALID_SOCKET_VALUE)
+        socket_t ReleaseMeshListener();
+
+        // 새 서버가 accept를 시작했음을 통지 → 기존 프로세스 drain 시작
+        bool Confirm();
+
+    private:
+        ListenerHandoff(socket_t channel, socket_t listener, socket_t mesh_listener);
+
+        socket_t channel;
+        socket_t listener;
+        socket_t mesh_listener;
+    };
+}
@@ -12,6 +12,7 @@ namespace mpc_engine::node::network
     struct NodeConnectionInfo 
     {
         std::unique_ptr<TlsConnection> tls_connection;
+        socket_t socket_fd = INVALID_SOCKET_VALUE;
 
         std::string coordinator_address;
         uint16_t coordinator_port = 0;
@@ -21,7 +22,7 @@ namespace mpc_engine::node::network
         uint32_t total_responses_sent = 0;
         ConnectionStatus status = ConnectionStatus::DISCONNECTED;
 
-        void InitializeWithTls(const std::string& addr, uint16_t port, std::unique_ptr<TlsConnection> tls_conn);
+        void InitializeWithTls(const std::string& addr, uint16_t port, socket_t sock, std::unique_ptr<TlsConnection> tls_conn);
         bool IsValid() const;
         bool IsActive() const;
         std::string ToString() const;
@@ -38,13 +39,14 @@ namespace mpc_engine::node::network
         NodeConnectionInfo(NodeConnectionInfo&&) = default;
         NodeConnectionInfo& operator=(NodeConnectionInfo&&) = default;
         
-        void Disconnect() {
-            status = ConnectionStatus::DISCONNECTED;
-            if (tls_connection) {
-                tls_connection->Close();
-                tls_connection.reset();
-            }
-        }
+        /**
+         * @brief 블로킹 중인 Read/Write를 깨움 (소켓 shutdown)
+         * @note TLS 객체는 해제하지 않음 - 송수신 스레드 join 이후 Disconnect() 호출
+         */
+        void Interrupt();
+
+        // TLS 종료 + 소켓 close (송수신 스레드 종료 후에만 호출)
+        void Disconnect();
 
         // 콜백용 복사 가능한 정보만 추출
         struct DisconnectionInfo {
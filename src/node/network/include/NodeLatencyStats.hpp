@@ -0,0 +1,77 @@
+// src/node/network/include/NodeLatencyStats.hpp
+#pragma once
+#include "common/utils/metrics/LatencyHistogram.hpp"
+#include "types/MessageTypes.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace mpc_engine::node::network
+{
+    /**
+     * @brief 노드 내부 요청 처리 구간
+     * - QUEUE_WAIT: 수신 → 핸들러 시작 (executor 큐 대기)
+     * - HANDLER: 핸들러 실행 (protobuf parse / 라우팅 / serialize 포함)
+     * - SERIALIZATION: 응답 직렬화 (HANDLER 중 직렬화 비중)
+     * - SEND_QUEUE_WAIT: 응답 push → TLS write 완료
+     * - TOTAL: 수신 → TLS write 완료
+     */
+    enum class LatencyStage : uint8_t {
+        QUEUE_WAIT = 0,
+        HANDLER,
+        SERIALIZATION,
+        SEND_QUEUE_WAIT,
+        TOTAL,
+        STAGE_COUNT
+    };
+
+    constexpr size_t LATENCY_STAGE_COUNT = static_cast<size_t>(LatencyStage::STAGE_COUNT);
+
+    const char* LatencyStageToString(LatencyStage stage);
+
+    struct MessageLatencyStats {
+        uint16_t message_type;
+        std::array<utils::LatencySnapshot, LATENCY_STAGE_COUNT> stages;
+    };
+
+    /**
+     * @brief MessageType × 구간별 지연 히스토그램
+     *
+     * 기록은 lock-free (핸들러/송신 스레드에서 직접 호출).
+     * 범위를 벗어난 message_type은 마지막 슬롯(UNKNOWN)에 모음.
+     */
+    class NodeLatencyStats
+    {
+    public:
+        static constexpr size_t TYPE_SLOTS = static_cast<size_t>(MessageType::MAX_MESSAGE_TYPE) + 1;
+
+        void Record(uint16_t message_type, LatencyStage stage, uint64_t latency_ns)
+        {
+            histograms[TypeSlot(message_type)][static_cast<size_t>(stage)].Record(latency_ns);
+        }
+
+        void RecordSince(uint16_t message_type, LatencyStage stage, uint64_t start_ns)
+        {
+            histograms[TypeSlot(message_type)][static_cast<size_t>(stage)].RecordSince(start_ns);
+        }
+
+        utils::LatencySnapshot Snapshot(uint16_t message_type, LatencyStage stage) const
+        {
+            return histograms[TypeSlot(message_type)][static_cast<size_t>(stage)].Snapshot();
+        }
+
+        // 기록이 있는 message type만 반환
+        std::vector<MessageLatencyStats> Collect() const;
+
+        // 누적 분포를 로그로 출력 (주기 덤프 / SIGUSR1)
+        void Dump() const;
+
+    private:
+        static size_t TypeSlot(uint16_t message_type)
+        {
+            return message_type < TYPE_SLOTS - 1 ? message_type : TYPE_SLOTS - 1;
+        }
+
+        std::array<std::array<utils::LatencyHistogram, LATENCY_STAGE_COUNT>, TYPE_SLOTS> histograms;
+    };
+}
@@ -0,0 +1,206 @@
+// src/node/network/include/NodePeerMesh.hpp
+#pragma once
+#include "types/BasicTypes.hpp"
+#include "common/network/tls/include/TlsContext.hpp"
+#include "common/network/tls/include/TlsConnection.hpp"
+#include "common/utils/threading/ThreadPool.hpp"
+#include "proto/coordinator_node/generated/mpc.pb.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+
+namespace mpc_engine::node::network
+{
+    using namespace mpc_engine::network::tls;
+    using mpc_engine::proto::coordinator_node::MpcPeerMessage;
+
+    struct PeerEndpoint
+    {
+        std::string node_id;
+        std::string host;
+        uint16_t port = 0;
+    };
+
+    struct PeerMeshStats
+    {
+        uint64_t sent = 0;
+        uint64_t received = 0;
+        uint64_t rejected = 0;          // 인증서 불일치 / 형식 오류 / mailbox 초과
+        uint64_t connections_rejected = 0;  // 핸드셰이크 / 수신 링크 상한 초과로 accept 직후 닫은 연결
+        uint32_t pending_handshakes = 0;
+        size_t inbound_links = 0;
+        size_t outbound_links = 0;
+        size_t buffered = 0;            // 아직 Receive되지 않은 메시지
+    };
+
+    /**
+     * @brief 노드 간 MPC 라운드 메시지용 mTLS mesh
+     *
+     * Coordinator를 거치지 않고 참여 노드끼리 라운드 메시지를 직접 주고받습니다.
+     * - 링크는 단방향: 송신 측이 수신 노드로 연결(outbound)해 MPC_PEER_MESSAGE만 쓰고, 수신 측은 읽기만 함
+     * - 양쪽 모두 노드 인증서로 mTLS - 송신 측은 서버 인증서가 수신 노드 이름(node_id + TLS_DOMAIN_SUFFIX)인지,
+     *   수신 측은 Receive 시 메시지를 보낸 링크의 인증서가 그 player에 배정된 노드 이름인지 검증
+     * - 수신 메시지는 (session_id, round, from_player) mailbox에 보관 - 라운드 핸들러가 Receive로 대기
+     *   (TTL / 개수 상한으로 정리, DropSession 시 즉시 폐기)
+     * - 수신 TLS 핸드셰이크는 고정 크기 풀에서 (동시 핸드셰이크 / 수신 링크 수 상한 초과 연결은 accept 직후 닫음),
+     *   인증된 링크만 읽기 스레드를 가짐
+     *
+     * 노드 핸들러는 Find(node_id)로 자기 노드의 mesh를 찾음 (한 프로세스에 노드가 여러 개일 수 있음 - 테스트)
+     */
+    class NodePeerMesh : public std::enable_shared_from_this<NodePeerMesh>
+    {
+    public:
+        NodePeerMesh(const std::string& node_id, const std::string& bind_address, uint16_t bind_port);
+        ~NodePeerMesh();
+
+        NodePeerMesh(const NodePeerMesh&) = delete;
+        NodePeerMesh& operator=(const NodePeerMesh&) = delete;
+
+        // 노드 인증서로 서버/클라이언트 TLS context 준비 (NodeTcpServer와 같은 인증서/CA)
+        bool Initialize(const std::string& certificate_path, const std::string& private_key_id);
+
+        // listen + accept 스레드 시작, Find 레지스트리에 등록 (shared_ptr로 소유된 상태여야 함)
+        bool Start();
+        void Stop();
+
+        /**
+        * @brief 이전 프로세스에서 넘겨받은 mesh listening socket 사용 (Start 전에 호출)
+        * @note bind 없이 같은 포트를 이어받음 - 소유권 이전
+        */
+        void SetInheritedListener(socket_t listener);
+
+        /**
+        * @brief 무중단 재시작 - accept를 멈추고 listening socket 반환 (새 프로세스로 전달)
+        * 이미 연결된 수신 링크는 계속 읽음 (진행 중인 세션은 이 프로세스에서 마무리)
+        * @return 실행 중이 아니면 INVALID_SOCKET_VALUE
+        */
+        socket_t DetachListener();
+
+        // 핸드오프 롤백 - accept 재개
+        void ResumeListener();
+
+        /**
+        * @brief peer 노드로 라운드 메시지 전송
+        * 링크가 없거나 끊겼으면 연결(+ 인증서 이름 검증) 후 전송, 전송 실패 시 한 번 재연결
+        */
+        bool Send(const PeerEndpoint& peer, const MpcPeerMessage& message, std::string* error);
+
+        /**
+        * @brief (session_id, round)에서 senders의 모든 player 메시지가 도착할 때까지 대기
+        * @param to_player 이 노드의 player id (다른 player 앞 메시지는 거부)
+        * @param senders player_id → 그 player에 배정된 node_id (링크 인증서 검증용)
+        * @param payloads player_id → payload
+        * @return deadline 초과 / 인증서 불일치 / DropSession 시 false
+        */
+        bool Receive(const std::string& session_id, uint32_t round, uint64_t to_player,
+                     const std::map<uint64_t, std::string>& senders, std::chrono::steady_clock::time_point deadline,
+                     std::map<uint64_t, std::string>* payloads, std::string* error);
+
+        // session_id의 수신 메시지 폐기 + 대기 중인 Receive 중단
+        void DropSession(const std::string& session_id);
+
+        // 등록된 모든 mesh에서 DropSession (세션 abort)
+        static void DropSessionAll(const std::string& session_id);
+
+        static std::shared_ptr<NodePeerMesh> Find(const std::string& node_id);
+
+        const std::string& GetNodeId() const { return node_id; }
+        uint16_t GetPort() const { return bind_port; }      // Start 후 실제 포트 (0으로 bind한 경우 포함)
+        PeerMeshStats GetStats() const;
+
+    private:
+        struct InboundLink
+        {
+            socket_t socket = INVALID_SOCKET_VALUE;
+            std::unique_ptr<TlsConnection> tls;
+            std::shared_ptr<X509> certificate;
+            std::thread thread;
+            std::atomic<bool> finished{false};
+        };
+
+        // 핸드셰이크 풀 작업 - link는 inbound 목록이 소유 (Stop은 풀 종료 후 정리)
+        struct HandshakeContext
+        {
+            NodePeerMesh* mesh;
+            InboundLink* link;
+
+            HandshakeContext(NodePeerMesh* m, InboundLink* l) : mesh(m), link(l) {}
+        };
+
+        struct OutboundLink
+        {
+            std::mutex mutex;                   // 링크별 송신 직렬화
+            socket_t socket = INVALID_SOCKET_VALUE;
+            std::unique_ptr<TlsConnection> tls;
+            uint64_t last_used_ms = 0;
+        };
+
+        struct Mail
+        {
+            uint64_t to_player = 0;
+            std::string payload;
+            std::shared_ptr<X509> certificate;  // 수신 링크의 peer 인증서
+            uint64_t received_ms = 0;
+        };
+
+        using MailKey = std::tuple<std::string, uint32_t, uint64_t>;   // (session_id, round, from_player)
+
+        const std::string node_id;
+        const std::string bind_address;
+        uint16_t bind_port;
+        std::string domain_suffix;
+
+        std::unique_ptr<TlsContext> server_context;
+        std::unique_ptr<TlsContext> client_context;
+
+        socket_t listen_socket = INVALID_SOCKET_VALUE;
+        socket_t inherited_listener = INVALID_SOCKET_VALUE;
+        std::atomic<bool> running{false};
+        std::thread accept_thread;
+        std::mutex listener_mutex;                      // 진행 중인 accept와 핸드오프 직렬화
+        std::atomic<bool> listener_detached{false};     // 핸드오프 중 / 후 accept 중단
+
+        mutable std::mutex inbound_mutex;
+        std::list<std::unique_ptr<InboundLink>> inbound;
+
+        // 수신 연결 상한 (NODE_MESH_MAX_PENDING_HANDSHAKES / NODE_MESH_MAX_INBOUND_LINKS)
+        std::unique_ptr<utils::ThreadPool<HandshakeContext>> handshake_pool;
+        uint32_t max_pending_handshakes = 4;
+        size_t max_inbound_links = 64;
+        std::atomic<uint32_t> pending_handshakes{0};
+        std::atomic<uint64_t> connections_rejected{0};
+
+        mutable std::mutex outbound_mutex;
+        std::map<std::string, std::shared_ptr<OutboundLink>> outbound;
+
+        mutable std::mutex mail_mutex;
+        std::condition_variable mail_cv;
+        std::map<MailKey, Mail> mailbox;
+        std::map<std::string, uint64_t> dropped_sessions;   // session_id → drop 시각 (늦게 도착한 메시지 폐기)
+        uint64_t last_sweep_ms = 0;
+
+        std::atomic<uint64_t> sent{0};
+        std::atomic<uint64_t> received{0};
+        std::atomic<uint64_t> rejected{0};
+
+        bool InitializeContext(TlsContext* context, TlsMode mode, const std::string& certificate_path, const std::string& private_key_id);
+        bool CreateListenSocket();
+        void AcceptLoop();
+        void ReapFinishedLinks(bool all);
+        static void ProcessHandshake(HandshakeContext* context);
+        void Handshake(InboundLink* link);
+        void ReadLoop(InboundLink* link);
+        void Deliver(MpcPeerMessage message, const std::shared_ptr<X509>& certificate);
+        void SweepMailboxLocked(uint64_t now_ms);
+
+        bool ConnectLocked(const PeerEndpoint& peer, OutboundLink& link, std::string* error);
+        static void CloseLocked(OutboundLink& link);
+    };
+}
@@ -2,10 +2,17 @@
 #pragma once
 #include "types/BasicTypes.hpp"
 #include "common/utils/threading/ThreadPool.hpp"
-#include "common/utils/queue/ThreadSafeQueue.hpp"
+#include "common/utils/threading/OrderedExecutor.hpp"
+#include "common/utils/threading/CpuAffinity.hpp"
+#include "common/utils/threading/ParallelRunner.hpp"
+#include "common/utils/queue/MpscQueue.hpp"
 #include "common/network/tls/include/TlsContext.hpp"
 #include "common/network/framing/tcp.hpp"
 #include "NodeConnectionInfo.hpp"
+#include "NodeLatencyStats.hpp"
+#include "proto/coordinator_node/generated/error.pb.h"
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <thread>
 #include <atomic>
@@ -21,6 +28,20 @@ namespace mpc_engine::node::network
     using MessageHandler = std::function<NetworkMessage(const NetworkMessage&)>;
     using ConnectionHandler = std::function<void(const NodeConnectionInfo&)>;
     using DisconnectionHandler = std::function<void(const NodeConnectionInfo::DisconnectionInfo&)>;
+    using AffinityKeyExtractor = std::function<uint64_t(const NetworkMessage&)>;
+    using LongRunningFilter = std::function<bool(const NetworkMessage&)>;
+    using HandoffHandler = std::function<void()>;
+    using ListenerDetacher = std::function<socket_t()>;
+
+    /**
+     * @brief 핸들러 실행 방식
+     * - POOL: 공유 ThreadPool (요청 간 순서 보장 없음)
+     * - AFFINITY: affinity key(key_id 등) 기준 lane 고정, lane 내 FIFO
+     */
+    enum class HandlerExecutorMode {
+        POOL,
+        AFFINITY
+    };
 
     struct SecurityConfig {
         std::string trusted_coordinator_ip;
@@ -31,16 +52,56 @@ namespace mpc_engine::node::network
         }
     };
 
+    /**
+     * @brief 송신 큐 항목 - 응답 + 지연 측정용 시각 (MonotonicNowNs)
+     */
+    struct OutboundMessage {
+        NetworkMessage message;
+        uint64_t received_ns = 0;   // 원 요청 수신 시각 (TOTAL 구간)
+        uint64_t enqueued_ns = 0;   // 송신 큐 push 시각 (SEND_QUEUE_WAIT 구간)
+
+        OutboundMessage() = default;
+        OutboundMessage(NetworkMessage msg, uint64_t received)
+            : message(std::move(msg)), received_ns(received), enqueued_ns(utils::MonotonicNowNs()) {}
+    };
+
     struct HandlerContext {
         NetworkMessage request;
         MessageHandler handler;
-        utils::ThreadSafeQueue<NetworkMessage>* send_queue;
+        utils::MpscQueue<OutboundMessage>* send_queue;
+        std::chrono::steady_clock::time_point deadline;  // 이 시각까지 핸들러가 시작하지 못하면 처리하지 않음
+        NodeLatencyStats* latency_stats = nullptr;
+        uint64_t received_ns = 0;
+        std::function<void()> parallel_task;    // RunParallel 보조 작업 (설정되면 request 대신 실행)
+        std::atomic<uint32_t>* long_running_slot = nullptr;    // long-running 풀 작업: 끝나면 반환할 슬롯 카운터
+
+        HandlerContext(NetworkMessage req, MessageHandler h, utils::MpscQueue<OutboundMessage>* sq,
+                       std::chrono::steady_clock::time_point dl = std::chrono::steady_clock::time_point::max())
+            : request(std::move(req)), handler(h), send_queue(sq), deadline(dl) {}
+    };
 
-        HandlerContext(const NetworkMessage& req, MessageHandler h, utils::ThreadSafeQueue<NetworkMessage>* sq)
-            : request(req), handler(h), send_queue(sq) {}
+    class NodeTcpServer;
+
+    /**
+     * @brief accept 이후 연결 수명주기 작업 컨텍스트 (TLS 핸드셰이크 / 세션 해제)
+     * @note client_socket 소유권을 가짐 - 넘기지 못하고 소멸되면 소켓을 닫음
+     */
+    struct ConnectionContext {
+        NodeTcpServer* server;
+        socket_t client_socket;
+        std::string client_ip;
+        uint16_t client_port;
+        uint64_t generation;
+
+        ConnectionContext(NodeTcpServer* s, socket_t sock, const std::string& ip, uint16_t port, uint64_t gen = 0)
+            : server(s), client_socket(sock), client_ip(ip), client_port(port), generation(gen) {}
+        ~ConnectionContext();
+
+        ConnectionContext(const ConnectionContext&) = delete;
+        ConnectionContext& operator=(const ConnectionContext&) = delete;
     };
 
-    class NodeTcpServer 
+    class NodeTcpServer : public utils::ParallelRunner
     {
     private:
         socket_t server_socket = INVALID_SOCKET_VALUE;
@@ -62,13 +123,64 @@ namespace mpc_engine::node::network
         std::thread connection_thread;
         std::thread receive_thread;
         std::thread send_thread;
+
+        // 세션 교체 직렬화 (핸드셰이크 완료 / 수신 종료 / Stop)
+        std::mutex session_mutex;
+        uint64_t session_generation = 0;
+
+        // TLS 핸드셰이크는 accept 스레드가 아닌 별도 풀에서 수행
+        std::unique_ptr<utils::ThreadPool<ConnectionContext>> handshake_pool;
+        size_t num_handshake_threads = 0;
+        uint32_t max_pending_handshakes = 4;
+        uint32_t handshake_timeout_ms = 5000;
+        std::atomic<uint32_t> pending_handshakes{0};
+
+        // 과부하 응답 (BUSY 재시도 힌트 / 큐 대기 상한)
+        uint32_t busy_retry_after_ms = 50;
+        uint32_t max_queue_wait_ms = 30000;
         
-        // ThreadPool
+        // 무중단 재시작: listening socket 인계/인수
+        socket_t inherited_listener = INVALID_SOCKET_VALUE;
+        bool listener_inherited = false;
+        std::string handoff_path;
+        socket_t handoff_socket = INVALID_SOCKET_VALUE;
+        std::thread handoff_thread;
+        uint32_t handoff_timeout_ms = 10000;
+        std::mutex listener_mutex;                      // 진행 중인 accept와 핸드오프 직렬화
+        std::atomic<bool> listener_detached{false};     // 핸드오프 중 accept 중단
+        std::atomic<bool> listener_handed_off{false};   // 새 프로세스가 listener 소유
+        HandoffHandler handoff_handler;
+        ListenerDetacher mesh_listener_detacher;        // 함께 넘길 mesh listener (accept 중단 후 반환)
+        HandoffHandler mesh_listener_resumer;           // 핸드오프 롤백 시 mesh accept 재개
+
+        // Handler executor (mode에 따라 둘 중 하나만 사용)
+        HandlerExecutorMode executor_mode = HandlerExecutorMode::POOL;
         std::unique_ptr<utils::ThreadPool<HandlerContext>> handler_pool;
+        std::unique_ptr<utils::OrderedExecutor<HandlerContext>> affinity_executor;
+        std::unique_ptr<utils::ThreadPool<HandlerContext>> parallel_pool;     // affinity 모드의 RunParallel 보조 작업 전용 (key lane에 끼워 넣지 않음)
+        AffinityKeyExtractor affinity_key_extractor;
         size_t num_handler_threads;
+
+        // 여러 라운드 동안 워커를 점유하는 요청 (mesh MPC 세션) 전용 - 핸들러 워커를 막지 않도록 분리
+        // 상한만큼 스레드를 두고 초과분은 큐에 넣지 않고 BUSY (대기 중인 세션은 peer들이 기다리는 라운드를 진행 못 함)
+        std::unique_ptr<utils::ThreadPool<HandlerContext>> long_running_pool;
+        LongRunningFilter long_running_filter;
+        uint32_t max_long_running = 16;
+        std::atomic<uint32_t> pending_long_running{0};
+
+        // 스레드 배치 (NODE_IO_CPUSET: accept/수신/송신/핸드셰이크, NODE_HANDLER_CPUSET: 핸들러 워커)
+        utils::ThreadPlacement io_placement;
+        utils::ThreadPlacement handler_placement;
         
-        // Send queue
-        std::unique_ptr<utils::ThreadSafeQueue<NetworkMessage>> send_queue;
+        // Send queue (handler N개 → SendLoop 1개, lock-free MPSC)
+        std::unique_ptr<utils::MpscQueue<OutboundMessage>> send_queue;
+
+        // MessageType × 구간별 지연 히스토그램 (주기 덤프: NODE_LATENCY_DUMP_INTERVAL_MS, 0 = 끔)
+        NodeLatencyStats latency_stats;
+        uint32_t latency_dump_interval_ms = 0;
+        std::thread stats_thread;
+        std::mutex stats_mutex;
+        std::condition_variable stats_cv;
         
         SecurityConfig security_config;
         
@@ -81,6 +193,13 @@ namespace mpc_engine::node::network
         std::atomic<uint64_t> total_messages_sent{0};
         std::atomic<uint64_t> total_messages_processed{0};
         std::atomic<uint64_t> handler_errors{0};
+        std::atomic<uint64_t> total_send_batches{0};
+        std::atomic<uint64_t> handshakes_completed{0};
+        std::atomic<uint64_t> handshake_failures{0};
+        std::atomic<uint64_t> handshakes_rejected{0};
+        std::atomic<uint64_t> requests_rejected_busy{0};
+        std::atomic<uint64_t> requests_rejected_shutdown{0};
+        std::atomic<uint64_t> parallel_tasks_run{0};
 
         bool enable_kernel_firewall = false;
 
@@ -101,6 +220,44 @@ namespace mpc_engine::node::network
         void SetConnectedHandler(ConnectionHandler handler);
         void SetDisconnectedHandler(DisconnectionHandler handler);
 
+        /**
+        * @brief AFFINITY 모드에서 요청 → lane key 추출 함수 설정
+        * @note 미설정 시 request_id 사용 (순서 보장 없음)
+        */
+        void SetAffinityKeyExtractor(AffinityKeyExtractor extractor);
+
+        /**
+        * @brief 핸들러 워커 대신 long-running 풀에서 실행할 요청 판별 함수 설정
+        * @note 동시 실행 상한(NODE_MAX_LONG_RUNNING_HANDLERS)을 넘는 요청은 BUSY로 거절
+        */
+        void SetLongRunningFilter(LongRunningFilter filter);
+        HandlerExecutorMode GetExecutorMode() const { return executor_mode; }
+
+        /**
+        * @brief 이전 프로세스에서 넘겨받은 listening socket 사용 (Initialize 전에 호출)
+        * @note bind 없이 같은 포트를 이어받음 - 소유권 이전
+        */
+        void SetInheritedListener(socket_t listener);
+
+        /**
+        * @brief 새 프로세스의 핸드오프 요청 대기 시작 (Start 이후)
+        * @param path Unix domain socket 경로
+        */
+        bool EnableListenerHandoff(const std::string& path);
+
+        /**
+        * @brief 핸드오프 완료 시 호출 (핸드오프 스레드에서 호출되므로 Stop은 다른 스레드에서)
+        */
+        void SetHandoffHandler(HandoffHandler handler);
+
+        /**
+        * @brief 핸드오프 때 함께 넘길 peer mesh listener 설정
+        * @param detacher accept를 멈추고 listening socket 반환 (mesh가 없으면 INVALID_SOCKET_VALUE)
+        * @param resumer 새 프로세스가 인수를 확정하지 않았을 때 accept 재개
+        */
+        void SetHandoffMeshListener(ListenerDetacher detacher, HandoffHandler resumer);
+        bool IsListenerHandedOff() const { return listener_handed_off.load(); }
+
         void SetTrustedCoordinator(const std::string& ip);
         bool HasActiveConnection() const;
         
@@ -112,17 +269,57 @@ namespace mpc_engine::node::network
             uint64_t messages_sent;
             uint64_t messages_processed;
             uint64_t handler_errors;
+            uint64_t send_batches;
             size_t pending_send_queue;
             size_t active_handlers;
+            uint64_t handshakes_completed;
+            uint64_t handshake_failures;
+            uint64_t handshakes_rejected;
+            uint32_t pending_handshakes;
+            uint32_t active_long_running;
+            uint64_t requests_rejected_busy;
+            uint64_t requests_rejected_shutdown;
+            uint64_t parallel_tasks;                    // 배치 요청을 도운 보조 작업 수 (RunParallel)
+            std::vector<MessageLatencyStats> latency;   // 기록이 있는 message type별 누적 분포
         };
         ServerStats GetStats() const;
 
+        NodeLatencyStats& GetLatencyStats() { return latency_stats; }
+
+        /**
+        * @brief 핸들러 안의 독립 작업을 다른 핸들러 워커에 나눠 실행 (배치 요청 처리용)
+        * 호출 스레드도 작업을 가져가 처리하므로 워커가 모두 바쁘거나 큐가 가득 차도 그대로 진행됨
+        * (워커 안에서 같은 풀을 기다리는 deadlock 없음)
+        * affinity 모드에서는 다른 key의 lane 순서를 깨지 않도록 별도 보조 풀(parallel_pool)을 사용
+        */
+        void RunParallel(size_t count, const utils::ParallelWork& work) override;
+        void DumpLatencyStats() const { latency_stats.Dump(); }
+
+        /**
+        * @brief 구조화된 에러 응답 생성 (CoordinatorNodeMessage.error_response)
+        * 
+        * Coordinator가 코드로 재시도/우회를 판단할 수 있도록 protobuf로 직렬화합니다.
+        * @param retry_after_ms BUSY일 때 재시도까지 권장 대기 시간 (0 = 힌트 없음)
+        */
+        static NetworkMessage CreateErrorResponse(
+            uint16_t original_message_type,
+            mpc_engine::proto::coordinator_node::NodeErrorCode code,
+            const std::string& error_message,
+            uint64_t request_id,
+            uint32_t retry_after_ms = 0);
+
     private:
         bool InitializeTlsContext(const std::string& certificate_path, const std::string& private_key_id);
+        bool CreateListenSocket();
+        void LoadThreadPlacement();
+        void ApplyIoPlacement(const char* thread_name) const;
         
         void ConnectionLoop();
-        void ReceiveLoop();
+        void HandoffLoop();
+        bool TransferListener(socket_t channel);
+        void ReceiveLoop(uint64_t generation);
         void SendLoop();
+        void StatsLoop();
         
         /**
         * @brief 메시지 처리 핸들러 (static 함수)
@@ -130,15 +327,42 @@ namespace mpc_engine::node::network
         * @warning unique_ptr로 감싸지 말 것!
         */
         static void ProcessMessage(HandlerContext* context);
+        static void ProcessParallelTask(HandlerContext* context);
+        static void ProcessLongRunning(HandlerContext* context);
+        static void PushResponse(HandlerContext* context, NetworkMessage response, std::chrono::milliseconds timeout);
+
+        /**
+        * @brief 핸들러 executor에 제출 (대기 없음)
+        * @return SUCCESS / FULL(과부하) / SHUTDOWN
+        */
+        utils::QueueResult SubmitHandler(std::unique_ptr<HandlerContext> context);
+        void RejectRequest(uint16_t message_type, uint64_t request_id, mpc_engine::proto::coordinator_node::NodeErrorCode code, const std::string& error_message, uint32_t retry_after_ms);
+        void ShutdownHandlers();
+        size_t GetActiveHandlerCount() const;
         
-        void HandleCoordinatorConnection(socket_t client_socket, const std::string& client_ip, uint16_t client_port);
+        /**
+        * @brief 핸드셰이크 풀에서 호출 - TLS 핸드셰이크 후 세션 활성화
+        * @param context Task-owned pointer (자동 삭제됨)
+        */
+        static void ProcessHandshake(ConnectionContext* context);
+
+        /**
+        * @brief 핸드셰이크 풀에서 호출 - 수신 종료된 세션 정리
+        * @param context Task-owned pointer (자동 삭제됨)
+        */
+        static void ProcessRelease(ConnectionContext* context);
+
+        void DispatchHandshake(socket_t client_socket, const std::string& client_ip, uint16_t client_port);
+        void HandleCoordinatorConnection(ConnectionContext& context);
+        void ActivateConnection(socket_t client_socket, const std::string& client_ip, uint16_t client_port, std::unique_ptr<TlsConnection> tls_connection);
+        void ReleaseSession(uint64_t generation);
+        void ReleaseConnection();
         
         bool IsAuthorized(const std::string& client_ip);
-        void ForceCloseExistingConnection();
+        void InterruptExistingConnection();
         void SetSocketOptions(socket_t sock);
         
-        bool SendMessage(const NetworkMessage& outMessage);
+        bool SendBatch(const std::vector<OutboundMessage>& batch, std::vector<uint8_t>& write_buffer);
         bool ReceiveMessage(NetworkMessage& outMessage);
-        static NetworkMessage CreateErrorResponse(uint16_t original_message_type, const std::string& error_message, uint64_t request_id);
     };
 }
\ No newline at end of file
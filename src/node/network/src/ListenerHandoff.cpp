@@ -0,0 +1,105 @@
+// src/node/network/src/ListenerHandoff.cpp
+#include "node/network/include/ListenerHandoff.hpp"
+#include "common/utils/socket/SocketHandoff.hpp"
+#include "common/utils/socket/SocketUtils.hpp"
+#include "common/utils/logger/Logger.hpp"
+
+namespace mpc_engine::node::network
+{
+    ListenerHandoff::ListenerHandoff(socket_t channel, socket_t listener, socket_t mesh_listener)
+        : channel(channel), listener(listener), mesh_listener(mesh_listener) {}
+
+    ListenerHandoff::~ListenerHandoff()
+    {
+        // Confirm 전에 소멸되면 채널이 끊기고 기존 프로세스가 accept를 재개함
+        if (listener != INVALID_SOCKET_VALUE) {
+            utils::CloseSocket(listener);
+        }
+        if (mesh_listener != INVALID_SOCKET_VALUE) {
+            utils::CloseSocket(mesh_listener);
+        }
+        if (channel != INVALID_SOCKET_VALUE) {
+            utils::CloseSocket(channel);
+        }
+    }
+
+    std::unique_ptr<ListenerHandoff> ListenerHandoff::Acquire(const std::string& path, uint32_t timeout_ms)
+    {
+        socket_t channel = utils::ConnectUnix(path);
+        if (channel == INVALID_SOCKET_VALUE) {
+            LOG_ERRORF("ListenerHandoff", "No running node at %s", path.c_str());
+            return nullptr;
+        }
+
+        if (!utils::SendControlByte(channel, HANDOFF_REQUEST)) {
+            LOG_ERRORF("ListenerHandoff", "Failed to request listener from %s", path.c_str());
+            utils::CloseSocket(channel);
+            return nullptr;
+        }
+
+        char tag = 0;
+        socket_t listener = utils::ReceiveSocketHandle(channel, &tag, timeout_ms);
+        if (listener == INVALID_SOCKET_VALUE || tag != HANDOFF_LISTENER) {
+            LOG_ERRORF("ListenerHandoff", "Failed to receive listener from %s", path.c_str());
+            if (listener != INVALID_SOCKET_VALUE) {
+                utils::CloseSocket(listener);
+            }
+            utils::CloseSocket(channel);
+            return nullptr;
+        }
+
+        // mesh 포트도 같이 인수 - 기존 프로세스가 잡고 있는 포트에 새로 bind할 수 없음
+        tag = 0;
+        socket_t mesh_listener = utils::ReceiveSocketHandle(channel, &tag, timeout_ms);
+        if (mesh_listener == INVALID_SOCKET_VALUE ? tag != HANDOFF_NO_MESH : tag != HANDOFF_MESH_LISTENER) {
+            LOG_ERRORF("ListenerHandoff", "Failed to receive mesh listener from %s", path.c_str());
+            if (mesh_listener != INVALID_SOCKET_VALUE) {
+                utils::CloseSocket(mesh_listener);
+            }
+            utils::CloseSocket(listener);
+            utils::CloseSocket(channel);
+            return nullptr;
+        }
+
+        LOG_INFOF("ListenerHandoff", "Listening socket acquired from %s (fd=%d, mesh fd=%d)", path.c_str(), listener, mesh_listener);
+        return std::unique_ptr<ListenerHandoff>(new ListenerHandoff(channel, listener, mesh_listener));
+    }
+
+    std::string ListenerHandoff::GetPath(const std::string& dir, const std::string& node_id)
+    {
+        return dir + "/mpc-node-" + node_id + ".sock";
+    }
+
+    socket_t ListenerHandoff::ReleaseListener()
+    {
+        socket_t released = listener;
+        listener = INVALID_SOCKET_VALUE;
+        return released;
+    }
+
+    socket_t ListenerHandoff::ReleaseMeshListener()
+    {
+        socket_t released = mesh_listener;
+        mesh_listener = INVALID_SOCKET_VALUE;
+        return released;
+    }
+
+    bool ListenerHandoff::Confirm()
+    {
+        if (channel == INVALID_SOCKET_VALUE) {
+            return false;
+        }
+
+        bool sent = utils::SendControlByte(channel, HANDOFF_READY);
+        utils::CloseSocket(channel);
+        channel = INVALID_SOCKET_VALUE;
+
+        if (!sent) {
+            LOG_ERROR("ListenerHandoff", "Failed to confirm handoff");
+            return false;
+        }
+
+        LOG_INFO("ListenerHandoff", "Handoff confirmed, previous process will drain");
+        return true;
+    }
+}
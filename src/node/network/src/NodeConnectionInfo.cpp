@@ -3,12 +3,14 @@
 #include "common/utils/socket/SocketUtils.hpp"
 #include "common/utils/logger/Logger.hpp"
 #include <stdexcept>
+#include <sys/socket.h>
 
 namespace mpc_engine::node::network
 {
-    void NodeConnectionInfo::InitializeWithTls(const std::string& addr, uint16_t port, std::unique_ptr<TlsConnection> tls_conn) 
+    void NodeConnectionInfo::InitializeWithTls(const std::string& addr, uint16_t port, socket_t sock, std::unique_ptr<TlsConnection> tls_conn) 
     {
         tls_connection = std::move(tls_conn);
+        socket_fd = sock;
         coordinator_address = addr;
         coordinator_port = port;
         connection_start_time = utils::GetCurrentTimeMs();
@@ -16,6 +18,27 @@ namespace mpc_engine::node::network
         status = ConnectionStatus::CONNECTED;
     }
 
+    void NodeConnectionInfo::Interrupt()
+    {
+        status = ConnectionStatus::DISCONNECTED;
+        if (socket_fd != INVALID_SOCKET_VALUE) {
+            shutdown(socket_fd, SHUT_RDWR);
+        }
+    }
+
+    void NodeConnectionInfo::Disconnect()
+    {
+        status = ConnectionStatus::DISCONNECTED;
+        if (tls_connection) {
+            tls_connection->Close();
+            tls_connection.reset();
+        }
+        if (socket_fd != INVALID_SOCKET_VALUE) {
+            utils::CloseSocket(socket_fd);
+            socket_fd = INVALID_SOCKET_VALUE;
+        }
+    }
+
     bool NodeConnectionInfo::IsValid() const 
     {
         return tls_connection != nullptr && !coordinator_address.empty() && coordinator_port > 0;
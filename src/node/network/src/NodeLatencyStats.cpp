@@ -0,0 +1,70 @@
+// src/node/network/src/NodeLatencyStats.cpp
+#include "node/network/include/NodeLatencyStats.hpp"
+#include "common/utils/logger/Logger.hpp"
+
+namespace mpc_engine::node::network
+{
+    const char* LatencyStageToString(LatencyStage stage)
+    {
+        switch (stage) {
+            case LatencyStage::QUEUE_WAIT:      return "queue_wait";
+            case LatencyStage::HANDLER:         return "handler";
+            case LatencyStage::SERIALIZATION:   return "serialize";
+            case LatencyStage::SEND_QUEUE_WAIT: return "send_wait";
+            case LatencyStage::TOTAL:           return "total";
+            default:                            return "unknown";
+        }
+    }
+
+    std::vector<MessageLatencyStats> NodeLatencyStats::Collect() const
+    {
+        std::vector<MessageLatencyStats> result;
+
+        for (size_t slot = 0; slot < TYPE_SLOTS; ++slot) {
+            MessageLatencyStats entry;
+            entry.message_type = static_cast<uint16_t>(slot);
+
+            bool has_samples = false;
+            for (size_t stage = 0; stage < LATENCY_STAGE_COUNT; ++stage) {
+                entry.stages[stage] = histograms[slot][stage].Snapshot();
+                has_samples = has_samples || entry.stages[stage].count > 0;
+            }
+
+            if (has_samples) {
+                result.push_back(entry);
+            }
+        }
+
+        return result;
+    }
+
+    void NodeLatencyStats::Dump() const
+    {
+        std::vector<MessageLatencyStats> stats = Collect();
+        if (stats.empty()) {
+            LOG_INFO("NodeLatencyStats", "No latency samples recorded");
+            return;
+        }
+
+        // 단위: us
+        for (const MessageLatencyStats& entry : stats) {
+            const char* type_name = entry.message_type < TYPE_SLOTS - 1
+                ? MessageTypeToString(static_cast<MessageType>(entry.message_type))
+                : "UNKNOWN";
+
+            for (size_t stage = 0; stage < LATENCY_STAGE_COUNT; ++stage) {
+                const utils::LatencySnapshot& s = entry.stages[stage];
+                if (s.count == 0) {
+                    continue;
+                }
+
+                LOG_INFOF("NodeLatencyStats",
+                    "%s %-10s n=%llu mean=%.1fus p50=%.1fus p90=%.1fus p99=%.1fus p99.9=%.1fus max=%.1fus",
+                    type_name, LatencyStageToString(static_cast<LatencyStage>(stage)),
+                    (unsigned long long)s.count,
+                    s.mean_ns / 1000.0, s.p50_ns / 1000.0, s.p90_ns / 1000.0,
+                    s.p99_ns / 1000.0, s.p999_ns / 1000.0, s.max_ns / 1000.0);
+            }
+        }
+    }
+}
@@ -0,0 +1,682 @@
+// src/node/network/src/NodePeerMesh.cpp
+#include "node/network/include/NodePeerMesh.hpp"
+#include "common/env/EnvManager.hpp"
+#include "common/kms/include/KMSManager.hpp"
+#include "common/resource/include/ReadOnlyResLoaderManager.hpp"
+#include "common/network/framing/tcp.hpp"
+#include "common/utils/socket/SocketUtils.hpp"
+#include "common/utils/logger/Logger.hpp"
+#include "types/MessageTypes.hpp"
+#include <openssl/x509v3.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <vector>
+
+namespace mpc_engine::node::network
+{
+    using namespace mpc_engine::env;
+    using namespace mpc_engine::kms;
+    using namespace mpc_engine::resource;
+    using namespace mpc_engine::network::framing;
+
+    constexpr int LISTEN_BACKLOG = 16;
+    constexpr uint32_t ACCEPT_POLL_INTERVAL_MS = 100;      // accept 루프 종료 감지 주기
+    constexpr uint32_t HANDSHAKE_TIMEOUT_MS = 5000;
+    constexpr uint32_t CONNECT_TIMEOUT_MS = 5000;
+    constexpr uint32_t WRITE_TIMEOUT_MS = 5000;
+    constexpr uint64_t LINK_IDLE_TIMEOUT_MS = 120000;      // 수신 측은 이만큼 조용한 링크를 닫음
+    constexpr uint64_t LINK_REFRESH_MS = LINK_IDLE_TIMEOUT_MS / 2;  // 송신 측은 그 전에 새로 연결 (닫힌 링크에 쓰는 유실 방지)
+    constexpr uint64_t MAIL_TTL_MS = 60000;                // Receive되지 않은 메시지 / drop 기록 보관 시간
+    constexpr uint64_t MAIL_SWEEP_INTERVAL_MS = 1000;
+    constexpr size_t MAX_BUFFERED_MESSAGES = 65536;
+
+    namespace
+    {
+        std::mutex registry_mutex;
+        std::map<std::string, std::weak_ptr<NodePeerMesh>> registry;
+    }
+
+    NodePeerMesh::NodePeerMesh(const std::string& node_id, const std::string& bind_address, uint16_t bind_port)
+        : node_id(node_id), bind_address(bind_address), bind_port(bind_port)
+    {
+    }
+
+    NodePeerMesh::~NodePeerMesh()
+    {
+        Stop();
+        if (inherited_listener != INVALID_SOCKET_VALUE) {
+            utils::CloseSocket(inherited_listener);
+        }
+    }
+
+    bool NodePeerMesh::Initialize(const std::string& certificate_path, const std::string& private_key_id)
+    {
+        domain_suffix = Config::HasKey("TLS_DOMAIN_SUFFIX") ? Config::GetString("TLS_DOMAIN_SUFFIX") : "";
+        if (Config::HasKey("NODE_MESH_MAX_PENDING_HANDSHAKES")) {
+            max_pending_handshakes = std::max<uint32_t>(1, Config::GetUInt32("NODE_MESH_MAX_PENDING_HANDSHAKES"));
+        }
+        if (Config::HasKey("NODE_MESH_MAX_INBOUND_LINKS")) {
+            max_inbound_links = std::max<uint32_t>(1, Config::GetUInt32("NODE_MESH_MAX_INBOUND_LINKS"));
+        }
+
+        server_context = std::make_unique<TlsContext>();
+        client_context = std::make_unique<TlsContext>();
+        if (!InitializeContext(server_context.get(), TlsMode::SERVER, certificate_path, private_key_id) ||
+            !InitializeContext(client_context.get(), TlsMode::CLIENT, certificate_path, private_key_id)) {
+            LOG_ERRORF("NodePeerMesh", "Failed to initialize mesh TLS for %s", node_id.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool NodePeerMesh::InitializeContext(TlsContext* context, TlsMode mode, const std::string& certificate_path,
+                                         const std::string& private_key_id)
+    {
+        TlsConfig config = mode == TlsMode::SERVER ? TlsConfig::CreateSecureServerConfig() : TlsConfig::CreateSecureClientConfig();
+        if (!context->Initialize(config)) {
+            return false;
+        }
+
+        try {
+            // 양방향 모두 같은 CA로 검증 (서버 모드는 peer 인증서 필수)
+            std::string tls_cert_path = EnvManager::Instance().GetString("TLS_CERT_PATH");
+            std::string ca_pem = ReadOnlyResLoaderManager::Instance().ReadFile(tls_cert_path + EnvManager::Instance().GetString("TLS_CERT_CA"));
+            if (ca_pem.empty() || !context->LoadCA(ca_pem)) {
+                LOG_ERROR("NodePeerMesh", "Failed to load CA certificate");
+                return false;
+            }
+
+            CertificateData cert_data;
+            cert_data.certificate_pem = ReadOnlyResLoaderManager::Instance().ReadFile(tls_cert_path + certificate_path);
+            cert_data.private_key_pem = KMSManager::Instance().GetSecret(private_key_id);
+            if (!cert_data.IsValid()) {
+                LOG_ERROR("NodePeerMesh", "Failed to load certificate or private key");
+                return false;
+            }
+            return context->LoadCertificate(cert_data);
+
+        } catch (const std::exception& e) {
+            LOG_ERRORF("NodePeerMesh", "TLS setup exception: %s", e.what());
+            return false;
+        }
+    }
+
+    bool NodePeerMesh::CreateListenSocket()
+    {
+        listen_socket = socket(AF_INET, SOCK_STREAM, 0);
+        if (listen_socket == INVALID_SOCKET_VALUE) {
+            LOG_ERROR("NodePeerMesh", "Failed to create mesh socket");
+            return false;
+        }
+        utils::SetSocketReuseAddr(listen_socket);
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(bind_port);
+        if (inet_pton(AF_INET, bind_address.c_str(), &addr.sin_addr) <= 0 ||
+            bind(listen_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+            listen(listen_socket, LISTEN_BACKLOG) < 0) {
+            LOG_ERRORF("NodePeerMesh", "Failed to listen on %s:%u: %s", bind_address.c_str(), bind_port, std::strerror(errno));
+            utils::CloseSocket(listen_socket);
+            listen_socket = INVALID_SOCKET_VALUE;
+            return false;
+        }
+
+        socklen_t length = sizeof(addr);
+        if (getsockname(listen_socket, reinterpret_cast<sockaddr*>(&addr), &length) == 0) {
+            bind_port = ntohs(addr.sin_port);
+        }
+        return true;
+    }
+
+    bool NodePeerMesh::Start()
+    {
+        if (running.load()) {
+            return true;
+        }
+        if (!server_context || !client_context) {
+            LOG_ERROR("NodePeerMesh", "Not initialized. Call Initialize() first");
+            return false;
+        }
+        // 이전 프로세스에서 인수한 소켓이 있으면 bind 없이 그대로 사용
+        if (inherited_listener != INVALID_SOCKET_VALUE) {
+            listen_socket = inherited_listener;
+            inherited_listener = INVALID_SOCKET_VALUE;
+            sockaddr_in addr{};
+            socklen_t length = sizeof(addr);
+            if (getsockname(listen_socket, reinterpret_cast<sockaddr*>(&addr), &length) == 0) {
+                bind_port = ntohs(addr.sin_port);
+            }
+            LOG_INFOF("NodePeerMesh", "Using inherited mesh listening socket for %s", node_id.c_str());
+        } else if (!CreateListenSocket()) {
+            return false;
+        }
+        listener_detached = false;
+
+        // 상한 내의 핸드셰이크는 큐 대기 없이 바로 시작되도록 상한만큼 스레드 확보
+        handshake_pool = std::make_unique<utils::ThreadPool<HandshakeContext>>(max_pending_handshakes);
+        running = true;
+        accept_thread = std::thread(&NodePeerMesh::AcceptLoop, this);
+        {
+            std::lock_guard<std::mutex> lock(registry_mutex);
+            registry[node_id] = weak_from_this();
+        }
+
+        LOG_INFOF("NodePeerMesh", "Peer mesh for %s listening on %s:%u", node_id.c_str(), bind_address.c_str(), bind_port);
+        return true;
+    }
+
+    void NodePeerMesh::Stop()
+    {
+        if (!running.exchange(false)) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(registry_mutex);
+            auto it = registry.find(node_id);
+            if (it != registry.end() && (it->second.expired() || it->second.lock().get() == this)) {
+                registry.erase(it);
+            }
+        }
+
+        if (accept_thread.joinable()) {
+            accept_thread.join();
+        }
+        utils::CloseSocket(listen_socket);
+        listen_socket = INVALID_SOCKET_VALUE;
+
+        // 핸드셰이크 / 읽기 대기 중인 수신 링크 깨우기 → 핸드셰이크 풀 종료 (새 읽기 스레드 없음) 후 정리
+        {
+            std::lock_guard<std::mutex> lock(inbound_mutex);
+            for (auto& link : inbound) {
+                shutdown(link->socket, SHUT_RDWR);
+            }
+        }
+        if (handshake_pool) {
+            handshake_pool->Shutdown();
+            handshake_pool.reset();
+        }
+        ReapFinishedLinks(true);
+
+        {
+            std::lock_guard<std::mutex> lock(outbound_mutex);
+            for (auto& entry : outbound) {
+                std::lock_guard<std::mutex> link_lock(entry.second->mutex);
+                CloseLocked(*entry.second);
+            }
+            outbound.clear();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mail_mutex);
+            mailbox.clear();
+            dropped_sessions.clear();
+        }
+        mail_cv.notify_all();
+
+        LOG_INFOF("NodePeerMesh", "Peer mesh for %s stopped", node_id.c_str());
+    }
+
+    void NodePeerMesh::SetInheritedListener(socket_t listener)
+    {
+        if (inherited_listener != INVALID_SOCKET_VALUE) {
+            utils::CloseSocket(inherited_listener);
+        }
+        inherited_listener = listener;
+    }
+
+    socket_t NodePeerMesh::DetachListener()
+    {
+        if (!running.load()) {
+            return INVALID_SOCKET_VALUE;
+        }
+        // 진행 중인 poll/accept가 끝날 때까지 대기
+        listener_detached = true;
+        {
+            std::lock_guard<std::mutex> lock(listener_mutex);
+        }
+        LOG_INFOF("NodePeerMesh", "Mesh listener of %s detached for handoff", node_id.c_str());
+        return listen_socket;
+    }
+
+    void NodePeerMesh::ResumeListener()
+    {
+        if (listener_detached.exchange(false)) {
+            LOG_INFOF("NodePeerMesh", "Mesh listener of %s resumed", node_id.c_str());
+        }
+    }
+
+    void NodePeerMesh::AcceptLoop()
+    {
+        while (running.load()) {
+            socket_t client = INVALID_SOCKET_VALUE;
+            {
+                // 핸드오프는 이 락으로 진행 중인 accept가 끝났음을 확인
+                std::unique_lock<std::mutex> lock(listener_mutex);
+                if (listener_detached.load()) {
+                    lock.unlock();
+                    ReapFinishedLinks(false);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(ACCEPT_POLL_INTERVAL_MS));
+                    continue;
+                }
+                pollfd pfd{ listen_socket, POLLIN, 0 };
+                int ready = poll(&pfd, 1, ACCEPT_POLL_INTERVAL_MS);
+                if (ready > 0) {
+                    client = accept(listen_socket, nullptr, nullptr);
+                }
+            }
+            ReapFinishedLinks(false);
+            if (client == INVALID_SOCKET_VALUE) {
+                continue;
+            }
+            utils::SetSocketNoDelay(client);
+
+            // 동시 핸드셰이크 / 수신 링크 상한 - 초과 시 즉시 닫음 (인증 전 연결이 스레드를 만들지 못하도록)
+            // peer 노드당 링크 하나이므로 정상 mesh는 상한에 닿지 않음
+            uint32_t pending = pending_handshakes.load();
+            do {
+                if (pending >= max_pending_handshakes) {
+                    break;
+                }
+            } while (!pending_handshakes.compare_exchange_weak(pending, pending + 1));
+            if (pending >= max_pending_handshakes) {
+                LOG_WARNF("NodePeerMesh", "Too many pending mesh handshakes on %s (%u), rejecting connection",
+                          node_id.c_str(), pending);
+                connections_rejected++;
+                utils::CloseSocket(client);
+                continue;
+            }
+
+            InboundLink* raw = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(inbound_mutex);
+                if (inbound.size() < max_inbound_links) {
+                    auto link = std::make_unique<InboundLink>();
+                    link->socket = client;
+                    raw = link.get();
+                    inbound.push_back(std::move(link));
+                }
+            }
+            if (!raw) {
+                LOG_WARNF("NodePeerMesh", "Too many mesh links on %s (%zu), rejecting connection", node_id.c_str(), max_inbound_links);
+                pending_handshakes--;
+                connections_rejected++;
+                utils::CloseSocket(client);
+                continue;
+            }
+
+            utils::QueueResult result = handshake_pool->TrySubmitOwned(ProcessHandshake, std::make_unique<HandshakeContext>(this, raw));
+            if (result != utils::QueueResult::SUCCESS) {
+                // 소켓은 inbound 목록에 남아 있으므로 다음 정리 때 닫힘
+                pending_handshakes--;
+                connections_rejected++;
+                raw->finished = true;
+            }
+        }
+    }
+
+    void NodePeerMesh::ProcessHandshake(HandshakeContext* context)
+    {
+        NodePeerMesh* mesh = context->mesh;
+        // 예외로 빠져나가도 슬롯 반환 - 누수가 쌓이면 모든 연결을 거절하게 됨
+        try {
+            mesh->Handshake(context->link);
+        } catch (...) {
+            context->link->finished = true;
+            mesh->pending_handshakes--;
+            throw;
+        }
+        mesh->pending_handshakes--;
+    }
+
+    void NodePeerMesh::Handshake(InboundLink* link)
+    {
+        TlsConnectionConfig tls_config;
+        tls_config.handshake_timeout_ms = HANDSHAKE_TIMEOUT_MS;
+        tls_config.read_timeout_ms = static_cast<uint32_t>(LINK_IDLE_TIMEOUT_MS);
+        tls_config.write_timeout_ms = WRITE_TIMEOUT_MS;
+
+        link->tls = std::make_unique<TlsConnection>();
+        if (!running.load() || !link->tls->AcceptServer(*server_context, link->socket, tls_config) || !link->tls->DoHandshake()) {
+            LOG_WARNF("NodePeerMesh", "Mesh handshake failed on %s: %s", node_id.c_str(), link->tls->GetLastErrorMessage().c_str());
+            rejected++;
+            link->finished = true;
+            return;
+        }
+        link->certificate.reset(link->tls->GetPeerCertificate(), X509_free);
+        if (!link->certificate) {
+            rejected++;
+            link->finished = true;
+            return;
+        }
+
+        // 인증된 링크만 읽기 스레드 (링크 수는 accept에서 제한)
+        std::lock_guard<std::mutex> lock(inbound_mutex);
+        link->thread = std::thread(&NodePeerMesh::ReadLoop, this, link);
+    }
+
+    void NodePeerMesh::ReapFinishedLinks(bool all)
+    {
+        std::list<std::unique_ptr<InboundLink>> finished;
+        {
+            std::lock_guard<std::mutex> lock(inbound_mutex);
+            for (auto it = inbound.begin(); it != inbound.end();) {
+                if (all || (*it)->finished.load()) {
+                    finished.push_back(std::move(*it));
+                    it = inbound.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        for (auto& link : finished) {
+            if (link->thread.joinable()) {
+                link->thread.join();
+            }
+            link->tls.reset();
+            utils::CloseSocket(link->socket);
+        }
+    }
+
+    void NodePeerMesh::ReadLoop(InboundLink* link)
+    {
+        while (running.load()) {
+            NetworkMessage message;
+            if (link->tls->ReadExact(&message.header, sizeof(MessageHeader)) != TlsError::NONE) {
+                break;      // 종료 / 유휴 timeout / peer 종료 - 송신 측이 다시 연결
+            }
+            if (message.header.ValidateBasic() != ValidationResult::OK ||
+                message.header.message_type != static_cast<uint16_t>(MessageType::MPC_PEER_MESSAGE)) {
+                LOG_WARNF("NodePeerMesh", "Invalid mesh frame on %s (type %u)", node_id.c_str(), message.header.message_type);
+                rejected++;
+                break;
+            }
+
+            message.body.resize(message.header.body_length);
+            if (message.header.body_length > 0 &&
+                link->tls->ReadExact(message.body.data(), message.header.body_length) != TlsError::NONE) {
+                break;
+            }
+
+            MpcPeerMessage peer_message;
+            if (message.Validate() != ValidationResult::OK ||
+                !peer_message.ParseFromArray(message.body.data(), static_cast<int>(message.body.size()))) {
+                LOG_WARNF("NodePeerMesh", "Corrupted mesh message on %s", node_id.c_str());
+                rejected++;
+                break;
+            }
+            Deliver(std::move(peer_message), link->certificate);
+        }
+
+        link->tls->Close();
+        link->finished = true;
+    }
+
+    void NodePeerMesh::Deliver(MpcPeerMessage message, const std::shared_ptr<X509>& certificate)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mail_mutex);
+            uint64_t now_ms = utils::GetCurrentTimeMs();
+            if (now_ms - last_sweep_ms >= MAIL_SWEEP_INTERVAL_MS) {
+                SweepMailboxLocked(now_ms);
+            }
+
+            if (dropped_sessions.count(message.session_id()) > 0) {
+                return;     // abort된 세션의 늦은 메시지
+            }
+            if (mailbox.size() >= MAX_BUFFERED_MESSAGES) {
+                LOG_WARNF("NodePeerMesh", "Mesh mailbox full on %s, dropping session %s round %u", node_id.c_str(),
+                          message.session_id().c_str(), message.round());
+                rejected++;
+                return;
+            }
+
+            MailKey key(message.session_id(), message.round(), message.from_player());
+            Mail mail;
+            mail.to_player = message.to_player();
+            mail.payload = std::move(*message.mutable_payload());
+            mail.certificate = certificate;
+            mail.received_ms = now_ms;
+            // 같은 메시지의 재전송(재연결 후)은 처음 받은 것 유지
+            if (!mailbox.emplace(std::move(key), std::move(mail)).second) {
+                return;
+            }
+            received++;
+        }
+        mail_cv.notify_all();
+    }
+
+    bool NodePeerMesh::Receive(const std::string& session_id, uint32_t round, uint64_t to_player,
+                               const std::map<uint64_t, std::string>& senders, std::chrono::steady_clock::time_point deadline,
+                               std::map<uint64_t, std::string>* payloads, std::string* error)
+    {
+        std::unique_lock<std::mutex> lock(mail_mutex);
+        while (true) {
+            if (!running.load()) {
+                *error = "Peer mesh stopped";
+                return false;
+            }
+            if (dropped_sessions.count(session_id) > 0) {
+                *error = "Session aborted";
+                return false;
+            }
+
+            std::string missing;
+            for (const auto& sender : senders) {
+                auto it = mailbox.find(MailKey(session_id, round, sender.first));
+                if (it == mailbox.end()) {
+                    missing += (missing.empty() ? "" : ",") + std::to_string(sender.first);
+                    continue;
+                }
+
+                // 메시지를 보낸 링크가 그 player에 배정된 노드인지 (다른 참여 노드의 사칭 방지)
+                std::string expected = sender.second + domain_suffix;
+                if (it->second.to_player != to_player ||
+                    X509_check_host(it->second.certificate.get(), expected.c_str(), expected.size(), 0, nullptr) != 1) {
+                    *error = "Round " + std::to_string(round) + " message from player " + std::to_string(sender.first) +
+                             " was not sent by " + expected;
+                    mailbox.erase(it);
+                    rejected++;
+                    return false;
+                }
+            }
+
+            if (missing.empty()) {
+                for (const auto& sender : senders) {
+                    auto it = mailbox.find(MailKey(session_id, round, sender.first));
+                    (*payloads)[sender.first] = std::move(it->second.payload);
+                    mailbox.erase(it);
+                }
+                return true;
+            }
+
+            if (mail_cv.wait_until(lock, deadline) == std::cv_status::timeout && std::chrono::steady_clock::now() >= deadline) {
+                *error = "Timed out waiting for round " + std::to_string(round) + " messages from players " + missing;
+                return false;
+            }
+        }
+    }
+
+    void NodePeerMesh::DropSession(const std::string& session_id)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mail_mutex);
+            for (auto it = mailbox.lower_bound(MailKey(session_id, 0, 0));
+                 it != mailbox.end() && std::get<0>(it->first) == session_id;) {
+                it = mailbox.erase(it);
+            }
+            dropped_sessions[session_id] = utils::GetCurrentTimeMs();
+        }
+        mail_cv.notify_all();
+    }
+
+    void NodePeerMesh::DropSessionAll(const std::string& session_id)
+    {
+        std::vector<std::shared_ptr<NodePeerMesh>> meshes;
+        {
+            std::lock_guard<std::mutex> lock(registry_mutex);
+            for (const auto& entry : registry) {
+                if (auto mesh = entry.second.lock()) {
+                    meshes.push_back(std::move(mesh));
+                }
+            }
+        }
+        for (auto& mesh : meshes) {
+            mesh->DropSession(session_id);
+        }
+    }
+
+    std::shared_ptr<NodePeerMesh> NodePeerMesh::Find(const std::string& node_id)
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        auto it = registry.find(node_id);
+        return it != registry.end() ? it->second.lock() : nullptr;
+    }
+
+    void NodePeerMesh::SweepMailboxLocked(uint64_t now_ms)
+    {
+        last_sweep_ms = now_ms;
+        for (auto it = mailbox.begin(); it != mailbox.end();) {
+            it = now_ms - it->second.received_ms > MAIL_TTL_MS ? mailbox.erase(it) : std::next(it);
+        }
+        for (auto it = dropped_sessions.begin(); it != dropped_sessions.end();) {
+            it = now_ms - it->second > MAIL_TTL_MS ? dropped_sessions.erase(it) : std::next(it);
+        }
+    }
+
+    bool NodePeerMesh::Send(const PeerEndpoint& peer, const MpcPeerMessage& message, std::string* error)
+    {
+        std::shared_ptr<OutboundLink> link;
+        {
+            std::lock_guard<std::mutex> lock(outbound_mutex);
+            if (!running.load()) {
+                *error = "Peer mesh stopped";
+                return false;
+            }
+            auto& slot = outbound[peer.node_id];
+            if (!slot) {
+                slot = std::make_shared<OutboundLink>();
+            }
+            link = slot;
+        }
+
+        NetworkMessage frame(static_cast<uint16_t>(MessageType::MPC_PEER_MESSAGE), message.SerializeAsString());
+        std::vector<uint8_t> buffer(sizeof(MessageHeader) + frame.body.size());
+        std::memcpy(buffer.data(), &frame.header, sizeof(MessageHeader));
+        if (!frame.body.empty()) {
+            std::memcpy(buffer.data() + sizeof(MessageHeader), frame.body.data(), frame.body.size());
+        }
+
+        std::lock_guard<std::mutex> link_lock(link->mutex);
+        for (int attempt = 0; attempt < 2; ++attempt) {
+            uint64_t now_ms = utils::GetCurrentTimeMs();
+            if (link->tls && now_ms - link->last_used_ms >= LINK_REFRESH_MS) {
+                CloseLocked(*link);
+            }
+            if (!link->tls && !ConnectLocked(peer, *link, error)) {
+                continue;
+            }
+
+            TlsError result = link->tls->WriteExact(buffer.data(), buffer.size());
+            if (result == TlsError::NONE) {
+                link->last_used_ms = now_ms;
+                sent++;
+                return true;
+            }
+            *error = std::string("Write to ") + peer.node_id + " failed: " + TlsErrorToString(result);
+            CloseLocked(*link);
+        }
+
+        LOG_WARNF("NodePeerMesh", "%s → %s: %s", node_id.c_str(), peer.node_id.c_str(), error->c_str());
+        return false;
+    }
+
+    bool NodePeerMesh::ConnectLocked(const PeerEndpoint& peer, OutboundLink& link, std::string* error)
+    {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(peer.port);
+        if (inet_pton(AF_INET, peer.host.c_str(), &addr.sin_addr) <= 0) {
+            *error = "Invalid mesh address for " + peer.node_id + ": " + peer.host;
+            return false;
+        }
+
+        link.socket = socket(AF_INET, SOCK_STREAM, 0);
+        if (link.socket == INVALID_SOCKET_VALUE) {
+            *error = "Failed to create mesh socket";
+            return false;
+        }
+        utils::SetSocketNoDelay(link.socket);
+        utils::SetSocketSendTimeout(link.socket, CONNECT_TIMEOUT_MS);     // connect 대기 상한 겸용
+
+        if (connect(link.socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            *error = "Connect to " + peer.node_id + " (" + peer.host + ":" + std::to_string(peer.port) + ") failed: " + std::strerror(errno);
+            CloseLocked(link);
+            return false;
+        }
+
+        TlsConnectionConfig tls_config;
+        tls_config.handshake_timeout_ms = HANDSHAKE_TIMEOUT_MS;
+        tls_config.write_timeout_ms = WRITE_TIMEOUT_MS;
+        tls_config.sni_hostname = peer.node_id + domain_suffix;
+
+        link.tls = std::make_unique<TlsConnection>();
+        if (!link.tls->ConnectClient(*client_context, link.socket, tls_config) || !link.tls->DoHandshake()) {
+            *error = "Mesh handshake with " + peer.node_id + " failed: " + link.tls->GetLastErrorMessage();
+            CloseLocked(link);
+            return false;
+        }
+
+        // CA 검증만으로는 같은 CA의 다른 노드일 수 있음 - 수신 노드 이름으로 발급된 인증서인지 확인
+        if (!link.tls->VerifyPeerName(tls_config.sni_hostname)) {
+            *error = "Mesh peer at " + peer.host + ":" + std::to_string(peer.port) + " is not " + tls_config.sni_hostname;
+            CloseLocked(link);
+            return false;
+        }
+
+        LOG_DEBUGF("NodePeerMesh", "Mesh link %s → %s established", node_id.c_str(), peer.node_id.c_str());
+        return true;
+    }
+
+    void NodePeerMesh::CloseLocked(OutboundLink& link)
+    {
+        if (link.tls) {
+            link.tls->Close();
+            link.tls.reset();
+        }
+        if (link.socket != INVALID_SOCKET_VALUE) {
+            utils::CloseSocket(link.socket);
+            link.socket = INVALID_SOCKET_VALUE;
+        }
+    }
+
+    PeerMeshStats NodePeerMesh::GetStats() const
+    {
+        PeerMeshStats stats;
+        stats.sent = sent.load();
+        stats.received = received.load();
+        stats.rejected = rejected.load();
+        stats.connections_rejected = connections_rejected.load();
+        stats.pending_handshakes = pending_handshakes.load();
+        {
+            std::lock_guard<std::mutex> lock(inbound_mutex);
+            stats.inbound_links = inbound.size();
+        }
+        {
+            std::lock_guard<std::mutex> lock(outbound_mutex);
+            stats.outbound_links = outbound.size();
+        }
+        std::lock_guard<std::mutex> lock(mail_mutex);
+        stats.buffered = mailbox.size();
+        return stats;
+    }
+}
@@ -4,20 +4,42 @@
 #include "common/utils/socket/SocketUtils.hpp"
 #include "common/utils/firewall/KernelFirewall.hpp"
 #include "common/utils/threading/ThreadUtils.hpp"
+#include "common/utils/time/Deadline.hpp"
 #include "common/kms/include/KMSManager.hpp"
 #include "common/resource/include/ReadOnlyResLoaderManager.hpp"
 #include "common/utils/logger/Logger.hpp"
+#include "proto/coordinator_node/generated/message.pb.h"
+#include "common/utils/socket/SocketHandoff.hpp"
+#include "node/network/include/ListenerHandoff.hpp"
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <poll.h>
+#include <unistd.h>
 #include <arpa/inet.h>
+#include <algorithm>
+#include <cstring>
+#include <exception>
 
 namespace mpc_engine::node::network
 {
     using namespace mpc_engine::env;
     using namespace mpc_engine::kms;
     using namespace mpc_engine::resource;
+    using namespace mpc_engine::proto::coordinator_node;
 
     constexpr uint32_t THREAD_JOIN_TIMEOUT_MS = 5000;  // 5초
+    constexpr int LISTEN_BACKLOG = 16;                 // 핸드셰이크 중 재접속 버스트 흡수
+    constexpr uint32_t SEND_POP_TIMEOUT_MS = 100;      // 연결 종료 감지 주기
+    constexpr size_t SEND_BATCH_MAX_MESSAGES = 64;     // 한 번의 TLS write로 묶을 최대 응답 수
+    constexpr uint32_t ACCEPT_POLL_INTERVAL_MS = 100;  // accept 루프 종료/핸드오프 감지 주기
+    constexpr uint32_t DRAIN_POLL_INTERVAL_MS = 50;    // PrepareShutdown 대기 확인 주기
+
+    ConnectionContext::~ConnectionContext()
+    {
+        if (client_socket != INVALID_SOCKET_VALUE) {
+            utils::CloseSocket(client_socket);
+        }
+    }
 
     NodeTcpServer::NodeTcpServer(const std::string& address, uint16_t port, size_t handler_threads)
     : bind_address(address), bind_port(port), num_handler_threads(handler_threads)
@@ -93,7 +115,132 @@ namespace mpc_engine::node::network
             return false;
         }
 
-        // Create server socket
+        // Server socket: 이전 프로세스에서 인수한 소켓이 있으면 bind 없이 그대로 사용
+        if (inherited_listener != INVALID_SOCKET_VALUE) {
+            server_socket = inherited_listener;
+            inherited_listener = INVALID_SOCKET_VALUE;
+            listener_inherited = true;
+            LOG_INFOF("NodeTcpServer", "Using inherited listening socket for %s:%d", bind_address.c_str(), bind_port);
+        } else if (!CreateListenSocket()) {
+            return false;
+        }
+
+        // Thread placement (executor 생성 전에 결정)
+        LoadThreadPlacement();
+
+        // Initialize handler executor
+        std::string executor_name = Config::HasKey("NODE_HANDLER_EXECUTOR") ? Config::GetString("NODE_HANDLER_EXECUTOR") : "pool";
+        if (executor_name == "affinity") {
+            executor_mode = HandlerExecutorMode::AFFINITY;
+            affinity_executor = std::make_unique<utils::OrderedExecutor<HandlerContext>>(num_handler_threads, 100, handler_placement);
+
+            // RunParallel 보조 작업용 - lane 워커에 넣으면 그 lane의 key 순서/캐시 지역성이 깨짐
+            size_t cores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            size_t parallel_threads = std::min(num_handler_threads, cores - 1);
+            if (parallel_threads > 0) {
+                parallel_pool = std::make_unique<utils::ThreadPool<HandlerContext>>(parallel_threads, handler_placement);
+            }
+        } else {
+            if (executor_name != "pool") {
+                LOG_WARNF("NodeTcpServer", "Unknown NODE_HANDLER_EXECUTOR '%s', using pool", executor_name.c_str());
+            }
+            executor_mode = HandlerExecutorMode::POOL;
+            handler_pool = std::make_unique<utils::ThreadPool<HandlerContext>>(num_handler_threads, handler_placement);
+        }
+
+        // Handshake pool (accept 스레드와 분리)
+        // 상한 내의 핸드셰이크는 큐 대기 없이 즉시 시작되도록 상한만큼 스레드 확보 (+1: 세션 해제용)
+        if (Config::HasKey("NODE_MAX_PENDING_HANDSHAKES")) {
+            max_pending_handshakes = std::max<uint32_t>(1, Config::GetUInt32("NODE_MAX_PENDING_HANDSHAKES"));
+        }
+        if (Config::HasKey("NODE_HANDSHAKE_TIMEOUT_MS")) {
+            handshake_timeout_ms = Config::GetUInt32("NODE_HANDSHAKE_TIMEOUT_MS");
+        }
+        num_handshake_threads = max_pending_handshakes + 1;
+
+        // 과부하 응답 설정
+        if (Config::HasKey("NODE_BUSY_RETRY_AFTER_MS")) {
+            busy_retry_after_ms = Config::GetUInt32("NODE_BUSY_RETRY_AFTER_MS");
+        }
+        if (Config::HasKey("NODE_MAX_QUEUE_WAIT_MS")) {
+            max_queue_wait_ms = Config::GetUInt32("NODE_MAX_QUEUE_WAIT_MS");
+        }
+        handshake_pool = std::make_unique<utils::ThreadPool<ConnectionContext>>(num_handshake_threads, io_placement);
+
+        // Long-running pool (mesh 세션) - 상한만큼 스레드 확보해 받은 요청은 큐 대기 없이 바로 시작
+        if (Config::HasKey("NODE_MAX_LONG_RUNNING_HANDLERS")) {
+            max_long_running = std::max<uint32_t>(1, Config::GetUInt32("NODE_MAX_LONG_RUNNING_HANDLERS"));
+        }
+        long_running_pool = std::make_unique<utils::ThreadPool<HandlerContext>>(max_long_running, handler_placement);
+        
+        // Initialize send queue
+        uint16_t handler_queue_size = Config::GetUInt16("NODE_SEND_QUEUE_SIZE_PER_HANDLER_THREAD");
+        send_queue = std::make_unique<utils::MpscQueue<OutboundMessage>>(
+            num_handler_threads * handler_queue_size
+        );
+
+        if (Config::HasKey("NODE_LATENCY_DUMP_INTERVAL_MS")) {
+            latency_dump_interval_ms = Config::GetUInt32("NODE_LATENCY_DUMP_INTERVAL_MS");
+        }
+
+        is_initialized = true;
+        LOG_INFOF("NodeTcpServer", "NodeTcpServer initialized with %d handler threads (%s), %d handshake threads (max pending: %u, timeout: %ums), %u long-running handler threads",
+                  num_handler_threads, executor_mode == HandlerExecutorMode::AFFINITY ? "affinity" : "pool",
+                  num_handshake_threads, max_pending_handshakes, handshake_timeout_ms, max_long_running);
+        return true;
+    }
+
+    void NodeTcpServer::LoadThreadPlacement()
+    {
+        auto load_cpuset = [](const char* key, utils::CpuSet& out) {
+            if (!Config::HasKey(key)) {
+                return;
+            }
+            std::string spec;
+            try {
+                spec = Config::GetString(key);
+            } catch (const std::exception&) {
+                return;     // 빈 값 = 배치 안 함
+            }
+            if (!utils::CpuSet::Parse(spec, out)) {
+                LOG_WARNF("NodeTcpServer", "Invalid %s '%s', threads left unpinned", key, spec.c_str());
+                return;
+            }
+
+            long configured_cpus = sysconf(_SC_NPROCESSORS_CONF);
+            if (configured_cpus > 0 && out.Cpus().back() >= configured_cpus) {
+                LOG_WARNF("NodeTcpServer", "%s '%s' exceeds available CPUs (%ld), threads left unpinned",
+                          key, spec.c_str(), configured_cpus);
+                out = utils::CpuSet();
+            }
+        };
+
+        load_cpuset("NODE_IO_CPUSET", io_placement.cpus);
+        load_cpuset("NODE_HANDLER_CPUSET", handler_placement.cpus);
+
+        // I/O 스레드는 집합 안에서 자유롭게, 핸들러 워커는 코어 하나씩 고정 (migration 방지)
+        bool numa_local = Config::HasKey("NODE_HANDLER_NUMA_LOCAL") ? Config::GetBool("NODE_HANDLER_NUMA_LOCAL") : true;
+        io_placement.per_worker = false;
+        io_placement.numa_local_memory = numa_local;
+        handler_placement.per_worker = true;
+        handler_placement.numa_local_memory = numa_local;
+
+        LOG_INFOF("NodeTcpServer", "Thread placement - I/O threads: %s",
+                  utils::DescribeCpuSet(io_placement.cpus).c_str());
+        LOG_INFOF("NodeTcpServer", "Thread placement - handler threads: %zu workers on %s%s",
+                  num_handler_threads, utils::DescribeCpuSet(handler_placement.cpus).c_str(),
+                  handler_placement.Enabled() ? (numa_local ? ", one core per worker, NUMA-local memory" : ", one core per worker") : "");
+    }
+
+    void NodeTcpServer::ApplyIoPlacement(const char* thread_name) const
+    {
+        if (!utils::ApplyWorkerPlacement(io_placement, 0)) {
+            LOG_WARNF("NodeTcpServer", "Failed to apply NODE_IO_CPUSET to %s thread", thread_name);
+        }
+    }
+
+    bool NodeTcpServer::CreateListenSocket()
+    {
         server_socket = socket(AF_INET, SOCK_STREAM, 0);
         if (server_socket == INVALID_SOCKET_VALUE) {
             LOG_ERROR("NodeTcpServer", "Failed to create server socket");
@@ -109,26 +256,17 @@ namespace mpc_engine::node::network
         if (inet_pton(AF_INET, bind_address.c_str(), &server_addr.sin_addr) <= 0) {
             LOG_ERRORF("NodeTcpServer", "Invalid bind address: %s", bind_address.c_str());
             utils::CloseSocket(server_socket);
+            server_socket = INVALID_SOCKET_VALUE;
             return false;
         }
 
         if (bind(server_socket, (sockaddr*)&server_addr, sizeof(server_addr)) < 0) {
             LOG_ERRORF("NodeTcpServer", "Failed to bind to %s:%d", bind_address.c_str(), bind_port);
             utils::CloseSocket(server_socket);
+            server_socket = INVALID_SOCKET_VALUE;
             return false;
         }
 
-        // Initialize thread pool
-        handler_pool = std::make_unique<utils::ThreadPool<HandlerContext>>(num_handler_threads);
-        
-        // Initialize send queue
-        uint16_t handler_queue_size = Config::GetUInt16("NODE_SEND_QUEUE_SIZE_PER_HANDLER_THREAD");
-        send_queue = std::make_unique<utils::ThreadSafeQueue<NetworkMessage>>(
-            num_handler_threads * handler_queue_size
-        );
-
-        is_initialized = true;
-        LOG_INFOF("NodeTcpServer", "NodeTcpServer initialized with %d handler threads", num_handler_threads);
         return true;
     }
 
@@ -139,13 +277,13 @@ namespace mpc_engine::node::network
             return false;
         }
 
-        if (listen(server_socket, 1) < 0) {
+        if (listen(server_socket, LISTEN_BACKLOG) < 0) {
             LOG_ERROR("NodeTcpServer", "Failed to listen on socket");
             return false;
         }
 
-        // 커널 방화벽 설정 (옵션)
-        if (enable_kernel_firewall) {
+        // 커널 방화벽 설정 (옵션) - 인수한 소켓이면 이전 프로세스가 설정한 규칙 유지
+        if (enable_kernel_firewall && !listener_inherited) {
             if (!security_config.trusted_coordinator_ip.empty()) {
                 LOG_INFO("NodeTcpServer", "Configuring kernel-level firewall...");
                 
@@ -169,6 +307,9 @@ namespace mpc_engine::node::network
         
         // Start Connection threads
         connection_thread = std::thread(&NodeTcpServer::ConnectionLoop, this);
+        if (latency_dump_interval_ms > 0) {
+            stats_thread = std::thread(&NodeTcpServer::StatsLoop, this);
+        }
 
         LOG_INFOF("NodeTcpServer", "NodeTcpServer started on %s:%d", bind_address.c_str(), bind_port);
         return true;
@@ -184,65 +325,76 @@ namespace mpc_engine::node::network
         LOG_INFO("NodeTcpServer", "Stopping NodeTcpServer...");
         is_running = false;
 
-        // 🔹 1단계: 서버 소켓 종료 (accept 차단)
+        // 🔹 1단계: Connection / Handoff thread 종료 대기 (poll 주기 내 종료, 더 이상 핸드셰이크 제출 없음)
+        LOG_INFOF("NodeTcpServer", "Waiting for threads to stop (timeout: %d ms)", THREAD_JOIN_TIMEOUT_MS);
+
+        if (connection_thread.joinable()) {
+            utils::JoinResult result = utils::JoinWithTimeout(connection_thread, THREAD_JOIN_TIMEOUT_MS);
+            LOG_INFOF("NodeTcpServer", "  Connection thread: %s", utils::JoinResultToString(result));
+
+            if (result == utils::JoinResult::TIMEOUT) {
+                LOG_ERROR("NodeTcpServer", "  ⚠️  Connection thread did not stop in time!");
+            }
+        }
+
+        if (handoff_thread.joinable()) {
+            handoff_thread.join();
+        }
+        {
+            std::lock_guard<std::mutex> lock(stats_mutex);
+        }
+        stats_cv.notify_all();
+        if (stats_thread.joinable()) {
+            stats_thread.join();
+        }
+        if (handoff_socket != INVALID_SOCKET_VALUE) {
+            utils::CloseSocket(handoff_socket);
+            handoff_socket = INVALID_SOCKET_VALUE;
+            // 핸드오프했다면 경로는 새 프로세스 소유
+            if (!listener_handed_off.load()) {
+                unlink(handoff_path.c_str());
+            }
+        }
+
+        // 🔹 2단계: 서버 소켓 종료
+        // 핸드오프 후에는 새 프로세스와 공유 중이므로 shutdown 없이 이 프로세스의 fd만 닫음
         if (server_socket != INVALID_SOCKET_VALUE) {
-            shutdown(server_socket, SHUT_RDWR);
+            if (!listener_handed_off.load()) {
+                shutdown(server_socket, SHUT_RDWR);
+            }
             utils::CloseSocket(server_socket);
             server_socket = INVALID_SOCKET_VALUE;
         }
 
-        // 🔹 2단계: 커널 방화벽 규칙 제거
-        if (enable_kernel_firewall) {
+        // 🔹 3단계: 커널 방화벽 규칙 제거 (핸드오프 시 새 프로세스가 계속 사용)
+        if (enable_kernel_firewall && !listener_handed_off.load()) {
             LOG_INFO("NodeTcpServer", "Removing kernel firewall rules...");
             utils::KernelFirewall::RemoveNodeFirewall(bind_port);
         }
 
-        // 🔹 3단계: 기존 연결 강제 종료 (recv 차단)
-        ForceCloseExistingConnection();
-
-        // 🔹 4단계: ThreadPool Shutdown
-        if (handler_pool) {
-            LOG_INFO("NodeTcpServer", "Shutting down handlers...");
-            handler_pool->Shutdown();
+        // 🔹 4단계: 진행 중인 핸드셰이크 정리 (최대 handshake_timeout_ms)
+        if (handshake_pool) {
+            LOG_INFO("NodeTcpServer", "Shutting down handshake pool...");
+            handshake_pool->Shutdown();
         }
 
-        // 🔹 5단계: Send Queue Shutdown
+        // 🔹 5단계: 기존 연결 깨우기 (recv/send 차단 해제)
+        InterruptExistingConnection();
+
+        // 🔹 6단계: Handler executor Shutdown
+        LOG_INFO("NodeTcpServer", "Shutting down handlers...");
+        ShutdownHandlers();
+
+        // 🔹 7단계: Send Queue Shutdown
         if (send_queue) {
             LOG_INFO("NodeTcpServer", "Shutting down send queue...");
             send_queue->Shutdown();
         }
 
-        // 6단계: 스레드 안전 종료 (타임아웃 적용)
-        LOG_INFOF("NodeTcpServer", "Waiting for threads to stop (timeout: %d ms)", THREAD_JOIN_TIMEOUT_MS);
-
-        // Connection thread
-        if (connection_thread.joinable()) {
-            utils::JoinResult result = utils::JoinWithTimeout(connection_thread, THREAD_JOIN_TIMEOUT_MS);
-            LOG_INFOF("NodeTcpServer", "  Connection thread: %s", utils::JoinResultToString(result));
-
-            if (result == utils::JoinResult::TIMEOUT) {
-                LOG_ERROR("NodeTcpServer", "  ⚠️  Connection thread did not stop in time!");
-            }
-        }
-
-        // Receive thread
-        if (receive_thread.joinable()) {
-            utils::JoinResult result = utils::JoinWithTimeout(receive_thread, THREAD_JOIN_TIMEOUT_MS);
-            LOG_INFOF("NodeTcpServer", "  Receive thread: %s", utils::JoinResultToString(result));
-            
-            if (result == utils::JoinResult::TIMEOUT) {
-                LOG_ERROR("NodeTcpServer", "  ⚠️  Receive thread did not stop in time!");
-            }
-        }
-
-        // Send thread
-        if (send_thread.joinable()) {
-            utils::JoinResult result = utils::JoinWithTimeout(send_thread, THREAD_JOIN_TIMEOUT_MS);
-            LOG_INFOF("NodeTcpServer", "  Send thread: %s", utils::JoinResultToString(result));
-            
-            if (result == utils::JoinResult::TIMEOUT) {
-                LOG_ERROR("NodeTcpServer", "  ⚠️  Send thread did not stop in time!");
-            }
+        // 🔹 8단계: 송수신 스레드 join 및 연결 해제
+        {
+            std::lock_guard<std::mutex> session_lock(session_mutex);
+            ReleaseConnection();
         }
 
         LOG_INFO("NodeTcpServer", "NodeTcpServer stopped");
@@ -260,6 +412,7 @@ namespace mpc_engine::node::network
         LOG_INFO("NodeTcpServer", "[2/3] Waiting for pending requests...");
         auto start = std::chrono::steady_clock::now();
         bool completed = false;
+        int64_t last_logged_ms = -500;
 
         while (true) {
             uint32_t pending = GetPendingRequests();
@@ -278,8 +431,11 @@ namespace mpc_engine::node::network
                 break;
             }
 
-            LOG_INFOF("NodeTcpServer", "  Pending: %d (%dms)", pending, elapsed);
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            if (elapsed - last_logged_ms >= 500) {
+                LOG_INFOF("NodeTcpServer", "  Pending: %d (%dms)", pending, elapsed);
+                last_logged_ms = elapsed;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(DRAIN_POLL_INTERVAL_MS));
         }
 
         LOG_INFO("NodeTcpServer", "[3/3] Additional cleanup...");
@@ -299,10 +455,7 @@ namespace mpc_engine::node::network
 
     uint32_t NodeTcpServer::GetPendingRequests() const 
     {
-        uint32_t pending = 0;
-        if (handler_pool) {
-            pending += handler_pool->GetActiveTaskCount();
-        }
+        uint32_t pending = static_cast<uint32_t>(GetActiveHandlerCount());
         if (send_queue) {
             pending += send_queue->Size();
         }
@@ -311,6 +464,7 @@ namespace mpc_engine::node::network
 
     void NodeTcpServer::ConnectionLoop() 
     {
+        ApplyIoPlacement("accept");
         LOG_INFOF("NodeTcpServer", "ConnectionLoop Listening on %s:%d", bind_address.c_str(), bind_port);
         
         if (!security_config.trusted_coordinator_ip.empty()) {
@@ -324,12 +478,30 @@ namespace mpc_engine::node::network
                 continue;
             }
 
+            if (listener_detached.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(ACCEPT_POLL_INTERVAL_MS));
+                continue;
+            }
+
             sockaddr_in client_addr{};
             socklen_t addr_len = sizeof(client_addr);
+            socket_t client_socket = INVALID_SOCKET_VALUE;
+
+            {
+                // 핸드오프 스레드는 이 락으로 진행 중인 accept가 끝났음을 확인
+                std::lock_guard<std::mutex> lock(listener_mutex);
+                if (listener_detached.load() || !utils::WaitReadable(server_socket, ACCEPT_POLL_INTERVAL_MS)) {
+                    continue;
+                }
+                client_socket = accept(server_socket, (sockaddr*)&client_addr, &addr_len);
+            }
             
-            socket_t client_socket = accept(server_socket, (sockaddr*)&client_addr, &addr_len);
-            
-            if (!is_running.load()) break;
+            if (!is_running.load()) {
+                if (client_socket != INVALID_SOCKET_VALUE) {
+                    utils::CloseSocket(client_socket);
+                }
+                break;
+            }
             
             if (client_socket == INVALID_SOCKET_VALUE) {
                 if (is_running.load()) {
@@ -349,53 +521,263 @@ namespace mpc_engine::node::network
                 continue;
             }
 
-            // Close existing connection
-            ForceCloseExistingConnection();
-
             LOG_INFOF("NodeTcpServer", "[SECURITY] Accepted connection from %s:%d", client_ip, client_port);
-            HandleCoordinatorConnection(client_socket, client_ip, client_port);
+            DispatchHandshake(client_socket, client_ip, client_port);
         }
         
         LOG_INFO("NodeTcpServer", "Connection thread stopped");
     }
 
-    void NodeTcpServer::HandleCoordinatorConnection(socket_t client_socket, const std::string& client_ip, uint16_t client_port) 
+    void NodeTcpServer::SetInheritedListener(socket_t listener)
+    {
+        inherited_listener = listener;
+    }
+
+    void NodeTcpServer::SetHandoffHandler(HandoffHandler handler)
+    {
+        handoff_handler = handler;
+    }
+
+    void NodeTcpServer::SetHandoffMeshListener(ListenerDetacher detacher, HandoffHandler resumer)
+    {
+        mesh_listener_detacher = detacher;
+        mesh_listener_resumer = resumer;
+    }
+
+    bool NodeTcpServer::EnableListenerHandoff(const std::string& path)
+    {
+        if (!is_running.load() || handoff_thread.joinable()) {
+            LOG_WARN("NodeTcpServer", "Listener handoff requires a running server (once)");
+            return false;
+        }
+
+        if (Config::HasKey("NODE_HANDOFF_TIMEOUT_MS")) {
+            handoff_timeout_ms = Config::GetUInt32("NODE_HANDOFF_TIMEOUT_MS");
+        }
+
+        handoff_socket = utils::CreateUnixListener(path);
+        if (handoff_socket == INVALID_SOCKET_VALUE) {
+            LOG_ERRORF("NodeTcpServer", "Failed to listen for handoff on %s", path.c_str());
+            return false;
+        }
+
+        handoff_path = path;
+        handoff_thread = std::thread(&NodeTcpServer::HandoffLoop, this);
+
+        LOG_INFOF("NodeTcpServer", "Listener handoff enabled: %s", path.c_str());
+        return true;
+    }
+
+    void NodeTcpServer::HandoffLoop()
+    {
+        while (is_running.load() && !listener_handed_off.load()) {
+            if (!utils::WaitReadable(handoff_socket, ACCEPT_POLL_INTERVAL_MS)) {
+                continue;
+            }
+
+            socket_t channel = accept(handoff_socket, nullptr, nullptr);
+            if (channel == INVALID_SOCKET_VALUE) {
+                continue;
+            }
+
+            char request = 0;
+            if (utils::ReceiveControlByte(channel, &request, handoff_timeout_ms) &&
+                request == ListenerHandoff::HANDOFF_REQUEST) {
+                TransferListener(channel);
+            } else {
+                LOG_WARN("NodeTcpServer", "Invalid handoff request ignored");
+            }
+
+            utils::CloseSocket(channel);
+        }
+    }
+
+    bool NodeTcpServer::TransferListener(socket_t channel)
+    {
+        LOG_INFO("NodeTcpServer", "Handoff requested, transferring listening socket...");
+
+        // 1. accept 중단 (진행 중인 poll/accept가 끝날 때까지 대기)
+        listener_detached = true;
+        {
+            std::lock_guard<std::mutex> lock(listener_mutex);
+        }
+
+        // 2. listening socket 전달 - 대기 중인 연결(backlog)은 새 프로세스가 accept
+        if (!utils::SendSocketHandle(channel, server_socket, ListenerHandoff::HANDOFF_LISTENER)) {
+            LOG_ERROR("NodeTcpServer", "Failed to send listening socket, resuming accept");
+            listener_detached = false;
+            return false;
+        }
+
+        // 3. mesh listening socket 전달 - 새 프로세스는 같은 포트에 bind할 수 없으므로 함께 넘김 (mesh 없으면 NO_MESH)
+        socket_t mesh_listener = mesh_listener_detacher ? mesh_listener_detacher() : INVALID_SOCKET_VALUE;
+        auto resume = [this]() {
+            listener_detached = false;
+            if (mesh_listener_resumer) {
+                mesh_listener_resumer();
+            }
+        };
+        bool mesh_sent = mesh_listener != INVALID_SOCKET_VALUE
+            ? utils::SendSocketHandle(channel, mesh_listener, ListenerHandoff::HANDOFF_MESH_LISTENER)
+            : utils::SendControlByte(channel, ListenerHandoff::HANDOFF_NO_MESH);
+        if (!mesh_sent) {
+            LOG_ERROR("NodeTcpServer", "Failed to send mesh listening socket, resuming accept");
+            resume();
+            return false;
+        }
+
+        // 4. 새 프로세스가 accept를 시작할 때까지 대기 - 실패하면 롤백
+        char ack = 0;
+        if (!utils::ReceiveControlByte(channel, &ack, handoff_timeout_ms) || ack != ListenerHandoff::HANDOFF_READY) {
+            LOG_ERROR("NodeTcpServer", "Successor did not confirm handoff, resuming accept");
+            resume();
+            return false;
+        }
+
+        listener_handed_off = true;
+        LOG_INFO("NodeTcpServer", "✓ Listening socket handed off to successor");
+
+        if (handoff_handler) {
+            handoff_handler();
+        }
+        return true;
+    }
+
+    void NodeTcpServer::DispatchHandshake(socket_t client_socket, const std::string& client_ip, uint16_t client_port)
+    {
+        // 동시 핸드셰이크 상한 - 초과 시 즉시 거절 (느린 peer가 풀을 점유하지 못하도록)
+        uint32_t pending = pending_handshakes.load();
+        do {
+            if (pending >= max_pending_handshakes) {
+                LOG_WARNF("NodeTcpServer", "Too many pending handshakes (%u), rejecting %s:%d",
+                          pending, client_ip.c_str(), client_port);
+                handshakes_rejected++;
+                utils::CloseSocket(client_socket);
+                return;
+            }
+        } while (!pending_handshakes.compare_exchange_weak(pending, pending + 1));
+
+        try {
+            auto context = std::make_unique<ConnectionContext>(this, client_socket, client_ip, client_port);
+            handshake_pool->SubmitOwned(ProcessHandshake, std::move(context));
+        } catch (const std::exception& e) {
+            // SubmitOwned 실패 시 context 소멸자가 소켓을 닫음
+            LOG_ERRORF("NodeTcpServer", "Failed to submit handshake: %s", e.what());
+            pending_handshakes--;
+        }
+    }
+
+    void NodeTcpServer::ProcessHandshake(ConnectionContext* context)
+    {
+        assert(context != nullptr && "ConnectionContext must not be null");
+
+        NodeTcpServer* server = context->server;
+        // 예외(bad_alloc, 스레드 생성 실패 등)로 빠져나가도 슬롯 반환 - 누수가 쌓이면 모든 연결을 거절하게 됨
+        try {
+            server->HandleCoordinatorConnection(*context);
+        } catch (...) {
+            server->pending_handshakes--;
+            throw;
+        }
+        server->pending_handshakes--;
+    }
+
+    void NodeTcpServer::ProcessRelease(ConnectionContext* context)
+    {
+        assert(context != nullptr && "ConnectionContext must not be null");
+        context->server->ReleaseSession(context->generation);
+    }
+
+    void NodeTcpServer::HandleCoordinatorConnection(ConnectionContext& context)
     {
+        if (!is_running.load()) {
+            return;
+        }
+
         // TLS Connection 생성 및 핸드셰이크
         auto tls_connection = std::make_unique<TlsConnection>();
 
         TlsConnectionConfig tls_config;
-        tls_config.handshake_timeout_ms = 10000;
+        tls_config.handshake_timeout_ms = handshake_timeout_ms;
 
-        if (!tls_connection->AcceptServer(*tls_context, client_socket, tls_config)) {
-            LOG_ERROR("NodeTcpServer", "TLS Accept failed");
-            utils::CloseSocket(client_socket);
+        if (!tls_connection->AcceptServer(*tls_context, context.client_socket, tls_config)) {
+            LOG_ERRORF("NodeTcpServer", "TLS Accept failed (%s:%d)", context.client_ip.c_str(), context.client_port);
+            handshake_failures++;
             return;
         }
 
         if (!tls_connection->DoHandshake()) {
-            LOG_ERROR("NodeTcpServer", "TLS Handshake failed");
-            utils::CloseSocket(client_socket);
+            LOG_ERRORF("NodeTcpServer", "TLS Handshake failed (%s:%d)", context.client_ip.c_str(), context.client_port);
+            handshake_failures++;
+            return;
+        }
+
+        if (!is_running.load()) {
+            tls_connection->Close();
             return;
         }
 
+        handshakes_completed++;
+
+        // 소켓 소유권을 세션으로 이전
+        socket_t client_socket = context.client_socket;
+        context.client_socket = INVALID_SOCKET_VALUE;
+
+        ActivateConnection(client_socket, context.client_ip, context.client_port, std::move(tls_connection));
+    }
+
+    void NodeTcpServer::ActivateConnection(
+        socket_t client_socket, 
+        const std::string& client_ip, 
+        uint16_t client_port, 
+        std::unique_ptr<TlsConnection> tls_connection)
+    {
+        std::lock_guard<std::mutex> session_lock(session_mutex);
+
+        // mTLS 검증을 통과한 연결만 기존 세션을 대체
+        ReleaseConnection();
+
         // NodeConnectionInfo 생성 (TLS Connection 포함)
         {
             std::lock_guard<std::mutex> lock(connection_mutex);
             coordinator_connection = std::make_unique<NodeConnectionInfo>();
-            coordinator_connection->InitializeWithTls(client_ip, client_port, std::move(tls_connection));
+            coordinator_connection->InitializeWithTls(client_ip, client_port, client_socket, std::move(tls_connection));
         }
 
+        uint64_t generation = ++session_generation;
+
         // connected_handler 호출
         if (connected_handler) {
             connected_handler(*coordinator_connection);
         }
 
-        // 스레드 시작
-        receive_thread = std::thread(&NodeTcpServer::ReceiveLoop, this);
+        // 스레드 시작 (종료는 ReceiveLoop → ProcessRelease 경로에서 처리)
+        receive_thread = std::thread(&NodeTcpServer::ReceiveLoop, this, generation);
         send_thread = std::thread(&NodeTcpServer::SendLoop, this);
 
-        // 스레드가 종료될 때까지 대기
+        LOG_INFOF("NodeTcpServer", "Coordinator session #%llu active (%s:%d)",
+                  static_cast<unsigned long long>(generation), client_ip.c_str(), client_port);
+    }
+
+    void NodeTcpServer::ReleaseSession(uint64_t generation)
+    {
+        std::lock_guard<std::mutex> session_lock(session_mutex);
+
+        // 이미 새 세션으로 교체되었으면 무시
+        if (generation != session_generation) {
+            return;
+        }
+        ReleaseConnection();
+    }
+
+    /**
+    * @brief 현재 세션 종료 (송수신 스레드 join → TLS/소켓 해제 → 콜백)
+    * @note session_mutex를 잡은 상태에서 호출
+    */
+    void NodeTcpServer::ReleaseConnection()
+    {
+        InterruptExistingConnection();
+
         if (receive_thread.joinable()) {
             receive_thread.join();
         }
@@ -404,37 +786,48 @@ namespace mpc_engine::node::network
             send_thread.join();
         }
 
-        // 연결 종료 처리 (TLS Close 추가)
-        std::cout << "[NodeTcpServer] Worker threads finished" << std::endl;
         NodeConnectionInfo::DisconnectionInfo disconnect_info;
+        bool had_connection = false;
         {
             std::lock_guard<std::mutex> lock(connection_mutex);
             if (coordinator_connection) {
                 // 종료 전 정보 백업
                 disconnect_info = coordinator_connection->GetDisconnectionInfo();
-                
+                had_connection = true;
+
                 // 안전한 종료
                 coordinator_connection->Disconnect();
                 coordinator_connection.reset();
             }
         }
-    
+
+        if (!had_connection) {
+            return;
+        }
+
+        // 이전 세션 응답이 새 세션으로 흘러가지 않도록 정리
+        if (send_queue) {
+            send_queue->Clear();
+        }
+
+        LOG_INFO("NodeTcpServer", "Coordinator session released");
+
         // 콜백 호출 (나중에 로깅, 통계, 재연결 로직 등 추가 가능)
-        if (disconnected_handler && !disconnect_info.coordinator_address.empty()) {
+        if (disconnected_handler) {
             disconnected_handler(disconnect_info);
         }
     }
 
-    void NodeTcpServer::ReceiveLoop()
+    void NodeTcpServer::ReceiveLoop(uint64_t generation)
     {
         LOG_DEBUG("NodeTcpServer", "Receive thread started");
+        ApplyIoPlacement("receive");
 
         if (!message_handler) {
             LOG_ERROR("NodeTcpServer", "message_handler is null, cannot process messages");
-            return;
         }
 
-        while (is_running.load() && HasActiveConnection()) {
+        while (message_handler && is_running.load() && HasActiveConnection()) {
             NetworkMessage request;
 
             // socket 파라미터 제거 - ReceiveMessage 내부에서 TLS Connection 가져옴
@@ -442,6 +835,7 @@ namespace mpc_engine::node::network
                 LOG_ERROR("NodeTcpServer", "Connection lost or receive failed");
                 break;
             }
+            uint64_t received_ns = utils::MonotonicNowNs();
         
             total_messages_received++;
 
@@ -453,41 +847,61 @@ namespace mpc_engine::node::network
                 }
             }
         
-            try {
-                auto context = std::make_unique<HandlerContext>(
-                    request, 
-                    message_handler, 
-                    send_queue.get()
-                );
-                handler_pool->SubmitOwned(ProcessMessage, std::move(context));
+            uint16_t message_type = request.header.message_type;
+            uint64_t request_id = request.header.request_id;
 
-            } catch (const std::runtime_error& e) {
-                LOG_ERRORF("NodeTcpServer", "Failed to submit task (pool stopped): %s", e.what());
+            // 종료 준비 중: 새 요청은 실행하지 않고 즉시 다른 노드로 보내도록 응답 (진행 중 응답은 계속 전송)
+            if (!accepting_connections.load()) {
+                requests_rejected_shutdown++;
+                RejectRequest(message_type, request_id, NODE_ERROR_SHUTTING_DOWN, "Server shutting down", 0);
+                continue;
+            }
 
-                utils::QueueResult result = send_queue->TryPush(
-                    CreateErrorResponse(request.header.message_type, "Server shutting down", -1),
-                    std::chrono::milliseconds(100)
-                );
+            // 큐 대기 상한과 Coordinator가 보낸 남은 budget 중 먼저 오는 쪽 - 기한이 지난 요청은 실행 전에 버려짐
+            auto now = std::chrono::steady_clock::now();
+            utils::Deadline deadline = std::min(
+                now + std::chrono::milliseconds(max_queue_wait_ms),
+                utils::DeadlineAfter(request.header.timeout_ms, now));
+
+            auto context = std::make_unique<HandlerContext>(
+                std::move(request), 
+                message_handler, 
+                send_queue.get(),
+                deadline
+            );
+            context->latency_stats = &latency_stats;
+            context->received_ns = received_ns;
+            utils::QueueResult submit_result = SubmitHandler(std::move(context));
 
-                if (result != utils::QueueResult::SUCCESS) {
-                    LOG_ERRORF("NodeTcpServer", "Failed to push error response: %s", utils::QueueResultToString(result));
-                }
+            if (submit_result == utils::QueueResult::SUCCESS) {
+                continue;
+            }
 
-                break;
+            if (submit_result == utils::QueueResult::FULL) {
+                // 큐가 빌 때까지 수신을 막지 않고 BUSY로 즉시 거절 → Coordinator가 다른 연결/노드로 재시도
+                LOG_DEBUGF("NodeTcpServer", "Handler queue full, rejecting request %llu", (unsigned long long)request_id);
+                requests_rejected_busy++;
+                RejectRequest(message_type, request_id, NODE_ERROR_BUSY, "Server busy", busy_retry_after_ms);
+                continue;
+            }
 
-            } catch (const std::exception& e) {
-                LOG_ERRORF("NodeTcpServer", "Failed to submit task: %s", e.what());
+            LOG_ERRORF("NodeTcpServer", "Failed to submit task: %s", utils::QueueResultToString(submit_result));
+            requests_rejected_shutdown++;
+            RejectRequest(message_type, request_id, NODE_ERROR_SHUTTING_DOWN, "Server shutting down", 0);
+            break;
+        }
 
-                utils::QueueResult result = send_queue->TryPush(
-                    CreateErrorResponse(request.header.message_type, "Server busy", -1),
-                    std::chrono::milliseconds(100)
+        // 송신 스레드 종료 유도 후 세션 정리는 핸드셰이크 풀에 위임 (자기 자신 join 불가)
+        InterruptExistingConnection();
+        if (is_running.load()) {
+            try {
+                handshake_pool->SubmitOwned(
+                    ProcessRelease,
+                    std::make_unique<ConnectionContext>(this, INVALID_SOCKET_VALUE, "", 0, generation)
                 );
-
-                if (result != utils::QueueResult::SUCCESS) {
-                    LOG_ERRORF("NodeTcpServer", "Failed to push error response: %s", utils::QueueResultToString(result));
-                }
-
-                handler_errors++;
+            } catch (const std::exception& e) {
+                // Stop()이 정리 담당
+                LOG_DEBUGF("NodeTcpServer", "Release not scheduled: %s", e.what());
             }
         }
 
@@ -497,28 +911,49 @@ namespace mpc_engine::node::network
     void NodeTcpServer::SendLoop()
     {
         LOG_DEBUG("NodeTcpServer", "Send thread started");
+        ApplyIoPlacement("send");
+
+        // 배치/버퍼는 루프 간 재사용 (capacity 유지)
+        std::vector<OutboundMessage> batch;
+        std::vector<uint8_t> write_buffer;
+        batch.reserve(SEND_BATCH_MAX_MESSAGES);
 
         while (is_running.load() && HasActiveConnection()) {
-            NetworkMessage outMessage;
-            utils::QueueResult result = send_queue->Pop(outMessage);
+            batch.clear();
+            utils::QueueResult result = send_queue->TryPopAll(
+                batch, std::chrono::milliseconds(SEND_POP_TIMEOUT_MS), SEND_BATCH_MAX_MESSAGES
+            );
+            if (result == utils::QueueResult::TIMEOUT) {
+                continue;
+            }
             if (result != utils::QueueResult::SUCCESS) {
                 LOG_ERRORF("NodeTcpServer", "Failed to pop message from send queue: %s", utils::QueueResultToString(result));
-                continue;
+                break;
             }
         
-            // socket 파라미터 제거 - SendMessage 내부에서 TLS Connection 가져옴
-            if (!SendMessage(outMessage)) {  // socket 파라미터는 더미값
+            // 준비된 응답 전체를 하나의 TLS write로 전송
+            if (!SendBatch(batch, write_buffer)) {
                 LOG_ERROR("NodeTcpServer", "Connection lost or send failed");
                 break;
             }
         
-            total_messages_sent++;
+            total_messages_sent += batch.size();
+            total_send_batches++;
+
+            uint64_t sent_ns = utils::MonotonicNowNs();
+            for (const OutboundMessage& outbound : batch) {
+                uint16_t message_type = outbound.message.header.message_type;
+                latency_stats.Record(message_type, LatencyStage::SEND_QUEUE_WAIT,
+                                     sent_ns > outbound.enqueued_ns ? sent_ns - outbound.enqueued_ns : 0);
+                latency_stats.Record(message_type, LatencyStage::TOTAL,
+                                     sent_ns > outbound.received_ns ? sent_ns - outbound.received_ns : 0);
+            }
         
             {
                 std::lock_guard<std::mutex> lock(connection_mutex);
                 if (coordinator_connection) {
                     coordinator_connection->last_activity_time = utils::GetCurrentTimeMs();
-                    coordinator_connection->total_responses_sent++;
+                    coordinator_connection->total_responses_sent += static_cast<uint32_t>(batch.size());
                 }
             }
         }
@@ -526,6 +961,25 @@ namespace mpc_engine::node::network
         LOG_DEBUG("NodeTcpServer", "Send thread stopped");
     }
 
+    /**
+    * @brief 지연 히스토그램 주기 덤프 (NODE_LATENCY_DUMP_INTERVAL_MS)
+    */
+    void NodeTcpServer::StatsLoop()
+    {
+        while (is_running.load()) {
+            {
+                std::unique_lock<std::mutex> lock(stats_mutex);
+                stats_cv.wait_for(lock, std::chrono::milliseconds(latency_dump_interval_ms), [this]() {
+                    return !is_running.load();
+                });
+            }
+            if (!is_running.load()) {
+                break;
+            }
+            latency_stats.Dump();
+        }
+    }
+
     /**
     * @brief 메시지 처리 핸들러 (ThreadPool Worker에서 호출)
     * 
@@ -546,25 +1000,43 @@ namespace mpc_engine::node::network
         assert(context->send_queue != nullptr && "send_queue must not be null");
 
         uint64_t request_id = context->request.header.request_id;
+        uint16_t message_type = context->request.header.message_type;
+
+        if (context->latency_stats) {
+            context->latency_stats->RecordSince(message_type, LatencyStage::QUEUE_WAIT, context->received_ns);
+        }
 
         try {
+            // 0. 큐 대기 중 기한 초과 - Coordinator가 이미 타임아웃 처리했을 요청은 실행하지 않음
+            if (std::chrono::steady_clock::now() > context->deadline) {
+                LOG_WARNF("NodeTcpServer", "Request %llu expired in handler queue", (unsigned long long)request_id);
+
+                PushResponse(context,
+                    CreateErrorResponse(
+                        context->request.header.message_type,
+                        NODE_ERROR_DEADLINE_EXCEEDED,
+                        "Deadline exceeded while queued",
+                        request_id
+                    ),
+                    std::chrono::milliseconds(100)
+                );
+                return;
+            }
+
             // 1. 요청 검증
             ValidationResult validation = context->request.Validate();
             if (validation != ValidationResult::OK) {
                 LOG_ERRORF("NodeTcpServer", "Invalid request in handler: %s", ValidationResultToString(validation));
 
-                utils::QueueResult result = context->send_queue->TryPush(
+                PushResponse(context,
                     CreateErrorResponse(
                         context->request.header.message_type, 
+                        NODE_ERROR_INVALID,
                         std::string("Invalid request: ") + ValidationResultToString(validation),
                         request_id
                     ),
                     std::chrono::milliseconds(100)
                 );
-
-                if (result != utils::QueueResult::SUCCESS) {
-                    LOG_ERRORF("NodeTcpServer", "Failed to push response: %s", utils::QueueResultToString(result));
-                }
                 return;
             }
 
@@ -572,45 +1044,40 @@ namespace mpc_engine::node::network
             if (!context->handler) {
                 LOG_ERROR("NodeTcpServer", "Handler is null");
 
-                utils::QueueResult result = context->send_queue->TryPush(
+                PushResponse(context,
                     CreateErrorResponse(
                         context->request.header.message_type,
+                        NODE_ERROR_INTERNAL,
                         "Handler not configured",
                         request_id
-                    ), 
+                    ),
                     std::chrono::milliseconds(100)
                 );
-
-                if (result != utils::QueueResult::SUCCESS) {
-                    LOG_ERRORF("NodeTcpServer", "Failed to push response: %s", utils::QueueResultToString(result));
-                }
                 return;
             }
 
             // 3. 핸들러 호출
+            uint64_t handler_start_ns = utils::MonotonicNowNs();
             NetworkMessage response = context->handler(context->request);
+            if (context->latency_stats) {
+                context->latency_stats->RecordSince(message_type, LatencyStage::HANDLER, handler_start_ns);
+            }
 
             // 4. ✅ Request ID 복사 (중요!)
             response.header.request_id = request_id;
 
             // 5. 응답 전송
-            utils::QueueResult result = context->send_queue->TryPush(
-                std::move(response), 
-                std::chrono::milliseconds(5000)
-            );
-
-            if (result != utils::QueueResult::SUCCESS) {
-                LOG_ERRORF("NodeTcpServer", "Failed to push response: %s", utils::QueueResultToString(result));
-            }
+            PushResponse(context, std::move(response), std::chrono::milliseconds(5000));
 
         } catch (const std::exception& e) {
             LOG_ERRORF("NodeTcpServer", "Exception in ProcessMessage: %s", e.what());
 
             // 예외 발생 시에도 에러 응답 시도
             try {
-                context->send_queue->TryPush(
+                PushResponse(context,
                     CreateErrorResponse(
                         context->request.header.message_type,
+                        NODE_ERROR_INTERNAL,
                         "Internal error",
                         request_id
                     ),
@@ -622,7 +1089,177 @@ namespace mpc_engine::node::network
         }
     }
 
-    bool NodeTcpServer::SendMessage(const NetworkMessage& outMessage)
+    void NodeTcpServer::PushResponse(HandlerContext* context, NetworkMessage response, std::chrono::milliseconds timeout)
+    {
+        utils::QueueResult result = context->send_queue->TryPush(
+            OutboundMessage(std::move(response), context->received_ns),
+            timeout
+        );
+
+        if (result != utils::QueueResult::SUCCESS) {
+            LOG_ERRORF("NodeTcpServer", "Failed to push response: %s", utils::QueueResultToString(result));
+        }
+    }
+
+    utils::QueueResult NodeTcpServer::SubmitHandler(std::unique_ptr<HandlerContext> context)
+    {
+        if (long_running_pool && long_running_filter && long_running_filter(context->request)) {
+            // 슬롯을 먼저 잡고 제출 - 상한 초과는 큐에 쌓지 않고 FULL (→ BUSY)
+            uint32_t pending = pending_long_running.load();
+            do {
+                if (pending >= max_long_running) {
+                    return utils::QueueResult::FULL;
+                }
+            } while (!pending_long_running.compare_exchange_weak(pending, pending + 1));
+
+            context->long_running_slot = &pending_long_running;
+            utils::QueueResult result = long_running_pool->TrySubmitOwned(ProcessLongRunning, std::move(context));
+            if (result != utils::QueueResult::SUCCESS) {
+                pending_long_running--;
+            }
+            return result;
+        }
+
+        if (executor_mode == HandlerExecutorMode::AFFINITY) {
+            uint64_t key = affinity_key_extractor
+                ? affinity_key_extractor(context->request)
+                : context->request.header.request_id;
+            return affinity_executor->TrySubmitOwned(key, ProcessMessage, std::move(context));
+        }
+        return handler_pool->TrySubmitOwned(ProcessMessage, std::move(context));
+    }
+
+    namespace
+    {
+        // RunParallel 공유 상태 - 늦게 시작한 보조 작업이 호출자 반환 후에도 안전하게 끝나도록 shared_ptr로 보관
+        struct ParallelBatch
+        {
+            size_t count = 0;
+            const utils::ParallelWork* work = nullptr;     // 작업을 가져간 동안만 유효 (호출자가 완료를 기다림)
+            std::atomic<size_t> next{0};
+            std::atomic<size_t> done{0};
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::exception_ptr error;
+
+            // 남은 작업을 하나씩 가져가 실행 - @return 실행한 작업 수
+            size_t Drain()
+            {
+                size_t ran = 0;
+                for (size_t index = next.fetch_add(1); index < count; index = next.fetch_add(1)) {
+                    try {
+                        (*work)(index);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+                    }
+                    ran++;
+                    if (done.fetch_add(1) + 1 == count) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        cv.notify_all();
+                    }
+                }
+                return ran;
+            }
+        };
+    }
+
+    void NodeTcpServer::RunParallel(size_t count, const utils::ParallelWork& work)
+    {
+        auto batch = std::make_shared<ParallelBatch>();
+        batch->count = count;
+        batch->work = &work;
+
+        // 보조 작업은 (워커 수, 코어 수 - 1, count - 1)개까지 - 코어보다 많이 나눠도 문맥 전환만 늘어남
+        // 제출 실패(큐 가득 참/종료)는 호출자가 대신 처리
+        // affinity 모드는 전용 보조 풀로 (없으면 호출자 lane에서 전부 처리)
+        utils::ThreadPool<HandlerContext>* pool = (executor_mode == HandlerExecutorMode::AFFINITY)
+            ? parallel_pool.get() : handler_pool.get();
+        size_t cores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        size_t helpers = pool ? std::min({ count > 0 ? count - 1 : 0, num_handler_threads, cores - 1 }) : 0;
+        for (size_t i = 0; i < helpers; ++i) {
+            auto context = std::make_unique<HandlerContext>(NetworkMessage(), nullptr, nullptr);
+            context->parallel_task = [this, batch]() {
+                if (batch->Drain() > 0) {
+                    parallel_tasks_run++;
+                }
+            };
+            if (pool->TrySubmitOwned(ProcessParallelTask, std::move(context)) != utils::QueueResult::SUCCESS) {
+                break;
+            }
+        }
+
+        batch->Drain();
+        {
+            std::unique_lock<std::mutex> lock(batch->mutex);
+            batch->cv.wait(lock, [&batch]() { return batch->done.load() == batch->count; });
+        }
+        if (batch->error) {
+            std::rethrow_exception(batch->error);
+        }
+    }
+
+    void NodeTcpServer::ProcessParallelTask(HandlerContext* context)
+    {
+        context->parallel_task();
+    }
+
+    void NodeTcpServer::ProcessLongRunning(HandlerContext* context)
+    {
+        std::atomic<uint32_t>* slot = context->long_running_slot;
+        // 예외로 빠져나가도 슬롯 반환 - 누수가 쌓이면 모든 세션을 BUSY로 거절하게 됨
+        try {
+            ProcessMessage(context);
+        } catch (...) {
+            (*slot)--;
+            throw;
+        }
+        (*slot)--;
+    }
+
+    void NodeTcpServer::RejectRequest(uint16_t message_type, uint64_t request_id, NodeErrorCode code, const std::string& error_message, uint32_t retry_after_ms)
+    {
+        utils::QueueResult result = send_queue->TryPush(
+            OutboundMessage(CreateErrorResponse(message_type, code, error_message, request_id, retry_after_ms), utils::MonotonicNowNs()),
+            std::chrono::milliseconds(100)
+        );
+
+        if (result != utils::QueueResult::SUCCESS) {
+            LOG_ERRORF("NodeTcpServer", "Failed to push error response: %s", utils::QueueResultToString(result));
+        }
+    }
+
+    void NodeTcpServer::ShutdownHandlers()
+    {
+        if (handler_pool) {
+            handler_pool->Shutdown();
+        }
+        if (affinity_executor) {
+            affinity_executor->Shutdown();
+        }
+        if (parallel_pool) {
+            parallel_pool->Shutdown();
+        }
+        if (long_running_pool) {
+            long_running_pool->Shutdown();
+        }
+    }
+
+    size_t NodeTcpServer::GetActiveHandlerCount() const
+    {
+        size_t active = pending_long_running.load();
+        if (handler_pool) {
+            return active + handler_pool->GetActiveTaskCount();
+        }
+        if (affinity_executor) {
+            return active + affinity_executor->GetActiveTaskCount();
+        }
+        return active;
+    }
+
+    bool NodeTcpServer::SendBatch(const std::vector<OutboundMessage>& batch, std::vector<uint8_t>& write_buffer)
     {
         // TLS Connection 획득
         TlsConnection* tls_conn = nullptr;
@@ -638,21 +1275,30 @@ namespace mpc_engine::node::network
             return false;
         }
 
-        // 기존 utils::SendExact 로직을 TLS로 교체
-        TlsError error = tls_conn->WriteExact(&outMessage.header, sizeof(MessageHeader));
-        if (error != TlsError::NONE) {
-            LOG_ERRORF("NodeTcpServer", "Failed to send message header: %s", TlsErrorToString(error));
-            return false;
+        // header+body 프레임들을 연속 버퍼로 합침 → TLS 레코드/syscall 수 최소화
+        size_t total_size = 0;
+        for (const OutboundMessage& outbound : batch) {
+            total_size += sizeof(MessageHeader) + outbound.message.body.size();
         }
 
-        if (outMessage.header.body_length > 0) {
-            error = tls_conn->WriteExact(outMessage.body.data(), outMessage.body.size());
-            if (error != TlsError::NONE) {
-                LOG_ERRORF("NodeTcpServer", "Failed to send message body: %s", TlsErrorToString(error));
-                return false;
+        write_buffer.resize(total_size);
+        uint8_t* cursor = write_buffer.data();
+        for (const OutboundMessage& outbound : batch) {
+            const NetworkMessage& message = outbound.message;
+            std::memcpy(cursor, &message.header, sizeof(MessageHeader));
+            cursor += sizeof(MessageHeader);
+            if (!message.body.empty()) {
+                std::memcpy(cursor, message.body.data(), message.body.size());
+                cursor += message.body.size();
             }
         }
 
+        TlsError error = tls_conn->WriteExact(write_buffer.data(), total_size);
+        if (error != TlsError::NONE) {
+            LOG_ERRORF("NodeTcpServer", "Failed to send %zu messages: %s", batch.size(), TlsErrorToString(error));
+            return false;
+        }
+
         return true;
     }
 
@@ -720,18 +1366,13 @@ namespace mpc_engine::node::network
         return security_config.IsAllowed(client_ip);
     }
 
-    void NodeTcpServer::ForceCloseExistingConnection()
+    void NodeTcpServer::InterruptExistingConnection()
     {
         std::lock_guard<std::mutex> lock(connection_mutex);
         
-        if (coordinator_connection) {
-            LOG_INFO("NodeTcpServer", "Closing existing connection");
-            
-            if (coordinator_connection->tls_connection) {
-                coordinator_connection->tls_connection->Close();
-            }
-            
-            coordinator_connection.reset();
+        if (coordinator_connection && coordinator_connection->status != ConnectionStatus::DISCONNECTED) {
+            LOG_INFO("NodeTcpServer", "Interrupting existing connection");
+            coordinator_connection->Interrupt();
         }
     }
 
@@ -778,6 +1419,16 @@ namespace mpc_engine::node::network
         disconnected_handler = handler;
     }
 
+    void NodeTcpServer::SetAffinityKeyExtractor(AffinityKeyExtractor extractor)
+    {
+        affinity_key_extractor = extractor;
+    }
+
+    void NodeTcpServer::SetLongRunningFilter(LongRunningFilter filter)
+    {
+        long_running_filter = filter;
+    }
+
     NodeTcpServer::ServerStats NodeTcpServer::GetStats() const
     {
         ServerStats stats;
@@ -785,8 +1436,18 @@ namespace mpc_engine::node::network
         stats.messages_sent = total_messages_sent.load();
         stats.messages_processed = total_messages_processed.load();
         stats.handler_errors = handler_errors.load();
+        stats.send_batches = total_send_batches.load();
         stats.pending_send_queue = send_queue ? send_queue->Size() : 0;
-        stats.active_handlers = handler_pool ? handler_pool->GetActiveTaskCount() : 0;
+        stats.active_handlers = GetActiveHandlerCount();
+        stats.handshakes_completed = handshakes_completed.load();
+        stats.handshake_failures = handshake_failures.load();
+        stats.handshakes_rejected = handshakes_rejected.load();
+        stats.pending_handshakes = pending_handshakes.load();
+        stats.active_long_running = pending_long_running.load();
+        stats.requests_rejected_busy = requests_rejected_busy.load();
+        stats.requests_rejected_shutdown = requests_rejected_shutdown.load();
+        stats.parallel_tasks = parallel_tasks_run.load();
+        stats.latency = latency_stats.Collect();
         return stats;
     }
 
@@ -796,11 +1457,26 @@ namespace mpc_engine::node::network
     }
     
     // 에러 응답 생성 헬퍼
-    NetworkMessage NodeTcpServer::CreateErrorResponse(uint16_t original_message_type, const std::string& error_message, uint64_t request_id)
+    NetworkMessage NodeTcpServer::CreateErrorResponse(uint16_t original_message_type, NodeErrorCode code, const std::string& error_message, uint64_t request_id, uint32_t retry_after_ms)
     {
-        std::string payload = "success=false|error=" + error_message;
-        NetworkMessage error_msg(original_message_type, payload);
+        CoordinatorNodeMessage message;
+        message.set_message_type(original_message_type);
+
+        ErrorResponse* error = message.mutable_error_response();
+        error->mutable_header()->set_success(false);
+        error->mutable_header()->set_error_message(error_message);
+        error->mutable_header()->set_request_id(request_id);
+        error->set_code(code);
+        error->set_retry_after_ms(retry_after_ms);
+
+        // 중간 string 없이 프레임 body에 직접 직렬화
+        NetworkMessage error_msg;
+        error_msg.body.resize(message.ByteSizeLong());
+        message.SerializeWithCachedSizesToArray(error_msg.body.data());
+        error_msg.header.message_type = original_message_type;
+        error_msg.header.body_length = static_cast<uint32_t>(error_msg.body.size());
         error_msg.header.request_id = request_id;
+        error_msg.header.checksum = MessageHeader::ComputeChecksum(error_msg.body);
         return error_msg;
     }
 }
\ No newline at end of file
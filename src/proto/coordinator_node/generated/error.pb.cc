@@ -0,0 +1,393 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: error.proto
+
+#include "error.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace mpc_engine {
+namespace proto {
+namespace coordinator_node {
+PROTOBUF_CONSTEXPR ErrorResponse::ErrorResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.code_)*/0
+  , /*decltype(_impl_.retry_after_ms_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ErrorResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ErrorResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ErrorResponseDefaultTypeInternal() {}
+  union {
+    ErrorResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ErrorResponseDefaultTypeInternal _ErrorResponse_default_instance_;
+}  // namespace coordinator_node
+}  // namespace proto
+}  // namespace mpc_engine
+static ::_pb::Metadata file_level_metadata_error_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_error_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_error_2eproto = nullptr;
+
+const uint32_t TableStruct_error_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::ErrorResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::ErrorResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::ErrorResponse, _impl_.code_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::ErrorResponse, _impl_.retry_after_ms_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::ErrorResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::mpc_engine::proto::coordinator_node::_ErrorResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_error_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013error.proto\022!mpc_engine.proto.coordina"
+  "tor_node\032\014common.proto\"\252\001\n\rErrorResponse"
+  "\022A\n\006header\030\001 \001(\01321.mpc_engine.proto.coor"
+  "dinator_node.ResponseHeader\022>\n\004code\030\002 \001("
+  "\01620.mpc_engine.proto.coordinator_node.No"
+  "deErrorCode\022\026\n\016retry_after_ms\030\003 \001(\r*\261\001\n\r"
+  "NodeErrorCode\022\032\n\026NODE_ERROR_UNSPECIFIED\020"
+  "\000\022\023\n\017NODE_ERROR_BUSY\020\001\022\034\n\030NODE_ERROR_SHU"
+  "TTING_DOWN\020\002\022 \n\034NODE_ERROR_DEADLINE_EXCE"
+  "EDED\020\003\022\026\n\022NODE_ERROR_INVALID\020\004\022\027\n\023NODE_E"
+  "RROR_INTERNAL\020\005b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_error_2eproto_deps[1] = {
+  &::descriptor_table_common_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_error_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_error_2eproto = {
+    false, false, 423, descriptor_table_protodef_error_2eproto,
+    "error.proto",
+    &descriptor_table_error_2eproto_once, descriptor_table_error_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_error_2eproto::offsets,
+    file_level_metadata_error_2eproto, file_level_enum_descriptors_error_2eproto,
+    file_level_service_descriptors_error_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_error_2eproto_getter() {
+  return &descriptor_table_error_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_error_2eproto(&descriptor_table_error_2eproto);
+namespace mpc_engine {
+namespace proto {
+namespace coordinator_node {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NodeErrorCode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_error_2eproto);
+  return file_level_enum_descriptors_error_2eproto[0];
+}
+bool NodeErrorCode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class ErrorResponse::_Internal {
+ public:
+  static const ::mpc_engine::proto::coordinator_node::ResponseHeader& header(const ErrorResponse* msg);
+};
+
+const ::mpc_engine::proto::coordinator_node::ResponseHeader&
+ErrorResponse::_Internal::header(const ErrorResponse* msg) {
+  return *msg->_impl_.header_;
+}
+void ErrorResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+ErrorResponse::ErrorResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.ErrorResponse)
+}
+ErrorResponse::ErrorResponse(const ErrorResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ErrorResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.code_){}
+    , decltype(_impl_.retry_after_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::coordinator_node::ResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.code_, &from._impl_.code_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.retry_after_ms_) -
+    reinterpret_cast<char*>(&_impl_.code_)) + sizeof(_impl_.retry_after_ms_));
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.ErrorResponse)
+}
+
+inline void ErrorResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.code_){0}
+    , decltype(_impl_.retry_after_ms_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ErrorResponse::~ErrorResponse() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.ErrorResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ErrorResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void ErrorResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ErrorResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.ErrorResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.code_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.retry_after_ms_) -
+      reinterpret_cast<char*>(&_impl_.code_)) + sizeof(_impl_.retry_after_ms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ErrorResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.NodeErrorCode code = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_code(static_cast<::mpc_engine::proto::coordinator_node::NodeErrorCode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 retry_after_ms = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.retry_after_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ErrorResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.ErrorResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.NodeErrorCode code = 2;
+  if (this->_internal_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_code(), target);
+  }
+
+  // uint32 retry_after_ms = 3;
+  if (this->_internal_retry_after_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_retry_after_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.ErrorResponse)
+  return target;
+}
+
+size_t ErrorResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.ErrorResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // .mpc_engine.proto.coordinator_node.NodeErrorCode code = 2;
+  if (this->_internal_code() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_code());
+  }
+
+  // uint32 retry_after_ms = 3;
+  if (this->_internal_retry_after_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_retry_after_ms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ErrorResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ErrorResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ErrorResponse::GetClassData() const { return &_class_data_; }
+
+
+void ErrorResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ErrorResponse*>(&to_msg);
+  auto& from = static_cast<const ErrorResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.ErrorResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::coordinator_node::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_code() != 0) {
+    _this->_internal_set_code(from._internal_code());
+  }
+  if (from._internal_retry_after_ms() != 0) {
+    _this->_internal_set_retry_after_ms(from._internal_retry_after_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ErrorResponse::CopyFrom(const ErrorResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.ErrorResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ErrorResponse::IsInitialized() const {
+  return true;
+}
+
+void ErrorResponse::InternalSwap(ErrorResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ErrorResponse, _impl_.retry_after_ms_)
+      + sizeof(ErrorResponse::_impl_.retry_after_ms_)
+      - PROTOBUF_FIELD_OFFSET(ErrorResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ErrorResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_error_2eproto_getter, &descriptor_table_error_2eproto_once,
+      file_level_metadata_error_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace coordinator_node
+}  // namespace proto
+}  // namespace mpc_engine
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::ErrorResponse*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::ErrorResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::ErrorResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
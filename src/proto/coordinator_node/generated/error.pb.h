@@ -0,0 +1,432 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: error.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_error_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_error_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "common.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_error_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_error_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_error_2eproto;
+namespace mpc_engine {
+namespace proto {
+namespace coordinator_node {
+class ErrorResponse;
+struct ErrorResponseDefaultTypeInternal;
+extern ErrorResponseDefaultTypeInternal _ErrorResponse_default_instance_;
+}  // namespace coordinator_node
+}  // namespace proto
+}  // namespace mpc_engine
+PROTOBUF_NAMESPACE_OPEN
+template<> ::mpc_engine::proto::coordinator_node::ErrorResponse* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::ErrorResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace mpc_engine {
+namespace proto {
+namespace coordinator_node {
+
+enum NodeErrorCode : int {
+  NODE_ERROR_UNSPECIFIED = 0,
+  NODE_ERROR_BUSY = 1,
+  NODE_ERROR_SHUTTING_DOWN = 2,
+  NODE_ERROR_DEADLINE_EXCEEDED = 3,
+  NODE_ERROR_INVALID = 4,
+  NODE_ERROR_INTERNAL = 5,
+  NodeErrorCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  NodeErrorCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool NodeErrorCode_IsValid(int value);
+constexpr NodeErrorCode NodeErrorCode_MIN = NODE_ERROR_UNSPECIFIED;
+constexpr NodeErrorCode NodeErrorCode_MAX = NODE_ERROR_INTERNAL;
+constexpr int NodeErrorCode_ARRAYSIZE = NodeErrorCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* NodeErrorCode_descriptor();
+template<typename T>
+inline const std::string& NodeErrorCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, NodeErrorCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function NodeErrorCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    NodeErrorCode_descriptor(), enum_t_value);
+}
+inline bool NodeErrorCode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, NodeErrorCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<NodeErrorCode>(
+    NodeErrorCode_descriptor(), name, value);
+}
+// ===================================================================
+
+class ErrorResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.ErrorResponse) */ {
+ public:
+  inline ErrorResponse() : ErrorResponse(nullptr) {}
+  ~ErrorResponse() override;
+  explicit PROTOBUF_CONSTEXPR ErrorResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ErrorResponse(const ErrorResponse& from);
+  ErrorResponse(ErrorResponse&& from) noexcept
+    : ErrorResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ErrorResponse& operator=(const ErrorResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ErrorResponse& operator=(ErrorResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ErrorResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ErrorResponse* internal_default_instance() {
+    return reinterpret_cast<const ErrorResponse*>(
+               &_ErrorResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ErrorResponse& a, ErrorResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ErrorResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ErrorResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ErrorResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ErrorResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ErrorResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ErrorResponse& from) {
+    ErrorResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ErrorResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.ErrorResponse";
+  }
+  protected:
+  explicit ErrorResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kCodeFieldNumber = 2,
+    kRetryAfterMsFieldNumber = 3,
+  };
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::ResponseHeader* release_header();
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  private:
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& _internal_header() const;
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* unsafe_arena_release_header();
+
+  // .mpc_engine.proto.coordinator_node.NodeErrorCode code = 2;
+  void clear_code();
+  ::mpc_engine::proto::coordinator_node::NodeErrorCode code() const;
+  void set_code(::mpc_engine::proto::coordinator_node::NodeErrorCode value);
+  private:
+  ::mpc_engine::proto::coordinator_node::NodeErrorCode _internal_code() const;
+  void _internal_set_code(::mpc_engine::proto::coordinator_node::NodeErrorCode value);
+  public:
+
+  // uint32 retry_after_ms = 3;
+  void clear_retry_after_ms();
+  uint32_t retry_after_ms() const;
+  void set_retry_after_ms(uint32_t value);
+  private:
+  uint32_t _internal_retry_after_ms() const;
+  void _internal_set_retry_after_ms(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.ErrorResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header_;
+    int code_;
+    uint32_t retry_after_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_error_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ErrorResponse
+
+// .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+inline bool ErrorResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool ErrorResponse::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& ErrorResponse::_internal_header() const {
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::ResponseHeader&>(
+      ::mpc_engine::proto::coordinator_node::_ResponseHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& ErrorResponse::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.ErrorResponse.header)
+  return _internal_header();
+}
+inline void ErrorResponse::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.ErrorResponse.header)
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* ErrorResponse::release_header() {
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* ErrorResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.ErrorResponse.header)
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* ErrorResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* ErrorResponse::mutable_header() {
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.ErrorResponse.header)
+  return _msg;
+}
+inline void ErrorResponse::set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.ErrorResponse.header)
+}
+
+// .mpc_engine.proto.coordinator_node.NodeErrorCode code = 2;
+inline void ErrorResponse::clear_code() {
+  _impl_.code_ = 0;
+}
+inline ::mpc_engine::proto::coordinator_node::NodeErrorCode ErrorResponse::_internal_code() const {
+  return static_cast< ::mpc_engine::proto::coordinator_node::NodeErrorCode >(_impl_.code_);
+}
+inline ::mpc_engine::proto::coordinator_node::NodeErrorCode ErrorResponse::code() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.ErrorResponse.code)
+  return _internal_code();
+}
+inline void ErrorResponse::_internal_set_code(::mpc_engine::proto::coordinator_node::NodeErrorCode value) {
+  
+  _impl_.code_ = value;
+}
+inline void ErrorResponse::set_code(::mpc_engine::proto::coordinator_node::NodeErrorCode value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.ErrorResponse.code)
+}
+
+// uint32 retry_after_ms = 3;
+inline void ErrorResponse::clear_retry_after_ms() {
+  _impl_.retry_after_ms_ = 0u;
+}
+inline uint32_t ErrorResponse::_internal_retry_after_ms() const {
+  return _impl_.retry_after_ms_;
+}
+inline uint32_t ErrorResponse::retry_after_ms() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.ErrorResponse.retry_after_ms)
+  return _internal_retry_after_ms();
+}
+inline void ErrorResponse::_internal_set_retry_after_ms(uint32_t value) {
+  
+  _impl_.retry_after_ms_ = value;
+}
+inline void ErrorResponse::set_retry_after_ms(uint32_t value) {
+  _internal_set_retry_after_ms(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.ErrorResponse.retry_after_ms)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace coordinator_node
+}  // namespace proto
+}  // namespace mpc_engine
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::mpc_engine::proto::coordinator_node::NodeErrorCode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mpc_engine::proto::coordinator_node::NodeErrorCode>() {
+  return ::mpc_engine::proto::coordinator_node::NodeErrorCode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_error_2eproto
@@ -55,6 +55,15 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::CoordinatorNodeMessage, _impl_.message_type_),
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
   PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::CoordinatorNodeMessage, _impl_.payload_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -67,23 +76,46 @@ static const ::_pb::Message* const file_default_instances[] = {
 
 const char descriptor_table_protodef_message_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\rmessage.proto\022!mpc_engine.proto.coordi"
-  "nator_node\032\014common.proto\032\rsigning.proto\""
-  "\327\001\n\026CoordinatorNodeMessage\022\024\n\014message_ty"
-  "pe\030\001 \001(\005\022L\n\017signing_request\030\002 \001(\01321.mpc_"
-  "engine.proto.coordinator_node.SigningReq"
-  "uestH\000\022N\n\020signing_response\030\003 \001(\01322.mpc_e"
-  "ngine.proto.coordinator_node.SigningResp"
-  "onseH\000B\t\n\007payloadb\006proto3"
+  "nator_node\032\014common.proto\032\rsigning.proto\032"
+  "\013error.proto\032\tmpc.proto\"\361\007\n\026CoordinatorN"
+  "odeMessage\022\024\n\014message_type\030\001 \001(\005\022L\n\017sign"
+  "ing_request\030\002 \001(\01321.mpc_engine.proto.coo"
+  "rdinator_node.SigningRequestH\000\022N\n\020signin"
+  "g_response\030\003 \001(\01322.mpc_engine.proto.coor"
+  "dinator_node.SigningResponseH\000\022J\n\016error_"
+  "response\030\004 \001(\01320.mpc_engine.proto.coordi"
+  "nator_node.ErrorResponseH\000\022O\n\021mpc_round_"
+  "request\030\005 \001(\01322.mpc_engine.proto.coordin"
+  "ator_node.MpcRoundRequestH\000\022Q\n\022mpc_round"
+  "_response\030\006 \001(\01323.mpc_engine.proto.coord"
+  "inator_node.MpcRoundResponseH\000\022V\n\021mpc_ab"
+  "ort_request\030\007 \001(\01329.mpc_engine.proto.coo"
+  "rdinator_node.MpcSessionAbortRequestH\000\022X"
+  "\n\022mpc_abort_response\030\010 \001(\0132:.mpc_engine."
+  "proto.coordinator_node.MpcSessionAbortRe"
+  "sponseH\000\022Z\n\027mpc_round_batch_request\030\t \001("
+  "\01327.mpc_engine.proto.coordinator_node.Mp"
+  "cRoundBatchRequestH\000\022\\\n\030mpc_round_batch_"
+  "response\030\n \001(\01328.mpc_engine.proto.coordi"
+  "nator_node.MpcRoundBatchResponseH\000\022\\\n\030mp"
+  "c_mesh_session_request\030\013 \001(\01328.mpc_engin"
+  "e.proto.coordinator_node.MpcMeshSessionR"
+  "equestH\000\022^\n\031mpc_mesh_session_response\030\014 "
+  "\001(\01329.mpc_engine.proto.coordinator_node."
+  "MpcMeshSessionResponseH\000B\t\n\007payloadb\006pro"
+  "to3"
   ;
-static const ::_pbi::DescriptorTable* const descriptor_table_message_2eproto_deps[2] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_message_2eproto_deps[4] = {
   &::descriptor_table_common_2eproto,
+  &::descriptor_table_error_2eproto,
+  &::descriptor_table_mpc_2eproto,
   &::descriptor_table_signing_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_message_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_message_2eproto = {
-    false, false, 305, descriptor_table_protodef_message_2eproto,
+    false, false, 1123, descriptor_table_protodef_message_2eproto,
     "message.proto",
-    &descriptor_table_message_2eproto_once, descriptor_table_message_2eproto_deps, 2, 1,
+    &descriptor_table_message_2eproto_once, descriptor_table_message_2eproto_deps, 4, 1,
     schemas, file_default_instances, TableStruct_message_2eproto::offsets,
     file_level_metadata_message_2eproto, file_level_enum_descriptors_message_2eproto,
     file_level_service_descriptors_message_2eproto,
@@ -104,6 +136,15 @@ class CoordinatorNodeMessage::_Internal {
  public:
   static const ::mpc_engine::proto::coordinator_node::SigningRequest& signing_request(const CoordinatorNodeMessage* msg);
   static const ::mpc_engine::proto::coordinator_node::SigningResponse& signing_response(const CoordinatorNodeMessage* msg);
+  static const ::mpc_engine::proto::coordinator_node::ErrorResponse& error_response(const CoordinatorNodeMessage* msg);
+  static const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& mpc_round_request(const CoordinatorNodeMessage* msg);
+  static const ::mpc_engine::proto::coordinator_node::MpcRoundResponse& mpc_round_response(const CoordinatorNodeMessage* msg);
+  static const ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest& mpc_abort_request(const CoordinatorNodeMessage* msg);
+  static const ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse& mpc_abort_response(const CoordinatorNodeMessage* msg);
+  static const ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest& mpc_round_batch_request(const CoordinatorNodeMessage* msg);
+  static const ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse& mpc_round_batch_response(const CoordinatorNodeMessage* msg);
+  static const ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest& mpc_mesh_session_request(const CoordinatorNodeMessage* msg);
+  static const ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse& mpc_mesh_session_response(const CoordinatorNodeMessage* msg);
 };
 
 const ::mpc_engine::proto::coordinator_node::SigningRequest&
@@ -114,6 +155,42 @@ const ::mpc_engine::proto::coordinator_node::SigningResponse&
 CoordinatorNodeMessage::_Internal::signing_response(const CoordinatorNodeMessage* msg) {
   return *msg->_impl_.payload_.signing_response_;
 }
+const ::mpc_engine::proto::coordinator_node::ErrorResponse&
+CoordinatorNodeMessage::_Internal::error_response(const CoordinatorNodeMessage* msg) {
+  return *msg->_impl_.payload_.error_response_;
+}
+const ::mpc_engine::proto::coordinator_node::MpcRoundRequest&
+CoordinatorNodeMessage::_Internal::mpc_round_request(const CoordinatorNodeMessage* msg) {
+  return *msg->_impl_.payload_.mpc_round_request_;
+}
+const ::mpc_engine::proto::coordinator_node::MpcRoundResponse&
+CoordinatorNodeMessage::_Internal::mpc_round_response(const CoordinatorNodeMessage* msg) {
+  return *msg->_impl_.payload_.mpc_round_response_;
+}
+const ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest&
+CoordinatorNodeMessage::_Internal::mpc_abort_request(const CoordinatorNodeMessage* msg) {
+  return *msg->_impl_.payload_.mpc_abort_request_;
+}
+const ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse&
+CoordinatorNodeMessage::_Internal::mpc_abort_response(const CoordinatorNodeMessage* msg) {
+  return *msg->_impl_.payload_.mpc_abort_response_;
+}
+const ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest&
+CoordinatorNodeMessage::_Internal::mpc_round_batch_request(const CoordinatorNodeMessage* msg) {
+  return *msg->_impl_.payload_.mpc_round_batch_request_;
+}
+const ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse&
+CoordinatorNodeMessage::_Internal::mpc_round_batch_response(const CoordinatorNodeMessage* msg) {
+  return *msg->_impl_.payload_.mpc_round_batch_response_;
+}
+const ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest&
+CoordinatorNodeMessage::_Internal::mpc_mesh_session_request(const CoordinatorNodeMessage* msg) {
+  return *msg->_impl_.payload_.mpc_mesh_session_request_;
+}
+const ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse&
+CoordinatorNodeMessage::_Internal::mpc_mesh_session_response(const CoordinatorNodeMessage* msg) {
+  return *msg->_impl_.payload_.mpc_mesh_session_response_;
+}
 void CoordinatorNodeMessage::set_allocated_signing_request(::mpc_engine::proto::coordinator_node::SigningRequest* signing_request) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_payload();
@@ -162,6 +239,222 @@ void CoordinatorNodeMessage::clear_signing_response() {
     clear_has_payload();
   }
 }
+void CoordinatorNodeMessage::set_allocated_error_response(::mpc_engine::proto::coordinator_node::ErrorResponse* error_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (error_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(error_response));
+    if (message_arena != submessage_arena) {
+      error_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, error_response, submessage_arena);
+    }
+    set_has_error_response();
+    _impl_.payload_.error_response_ = error_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.error_response)
+}
+void CoordinatorNodeMessage::clear_error_response() {
+  if (_internal_has_error_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.error_response_;
+    }
+    clear_has_payload();
+  }
+}
+void CoordinatorNodeMessage::set_allocated_mpc_round_request(::mpc_engine::proto::coordinator_node::MpcRoundRequest* mpc_round_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (mpc_round_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mpc_round_request));
+    if (message_arena != submessage_arena) {
+      mpc_round_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mpc_round_request, submessage_arena);
+    }
+    set_has_mpc_round_request();
+    _impl_.payload_.mpc_round_request_ = mpc_round_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_request)
+}
+void CoordinatorNodeMessage::clear_mpc_round_request() {
+  if (_internal_has_mpc_round_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.mpc_round_request_;
+    }
+    clear_has_payload();
+  }
+}
+void CoordinatorNodeMessage::set_allocated_mpc_round_response(::mpc_engine::proto::coordinator_node::MpcRoundResponse* mpc_round_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (mpc_round_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mpc_round_response));
+    if (message_arena != submessage_arena) {
+      mpc_round_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mpc_round_response, submessage_arena);
+    }
+    set_has_mpc_round_response();
+    _impl_.payload_.mpc_round_response_ = mpc_round_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_response)
+}
+void CoordinatorNodeMessage::clear_mpc_round_response() {
+  if (_internal_has_mpc_round_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.mpc_round_response_;
+    }
+    clear_has_payload();
+  }
+}
+void CoordinatorNodeMessage::set_allocated_mpc_abort_request(::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* mpc_abort_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (mpc_abort_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mpc_abort_request));
+    if (message_arena != submessage_arena) {
+      mpc_abort_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mpc_abort_request, submessage_arena);
+    }
+    set_has_mpc_abort_request();
+    _impl_.payload_.mpc_abort_request_ = mpc_abort_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_request)
+}
+void CoordinatorNodeMessage::clear_mpc_abort_request() {
+  if (_internal_has_mpc_abort_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.mpc_abort_request_;
+    }
+    clear_has_payload();
+  }
+}
+void CoordinatorNodeMessage::set_allocated_mpc_abort_response(::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* mpc_abort_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (mpc_abort_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mpc_abort_response));
+    if (message_arena != submessage_arena) {
+      mpc_abort_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mpc_abort_response, submessage_arena);
+    }
+    set_has_mpc_abort_response();
+    _impl_.payload_.mpc_abort_response_ = mpc_abort_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_response)
+}
+void CoordinatorNodeMessage::clear_mpc_abort_response() {
+  if (_internal_has_mpc_abort_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.mpc_abort_response_;
+    }
+    clear_has_payload();
+  }
+}
+void CoordinatorNodeMessage::set_allocated_mpc_round_batch_request(::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* mpc_round_batch_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (mpc_round_batch_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mpc_round_batch_request));
+    if (message_arena != submessage_arena) {
+      mpc_round_batch_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mpc_round_batch_request, submessage_arena);
+    }
+    set_has_mpc_round_batch_request();
+    _impl_.payload_.mpc_round_batch_request_ = mpc_round_batch_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_request)
+}
+void CoordinatorNodeMessage::clear_mpc_round_batch_request() {
+  if (_internal_has_mpc_round_batch_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.mpc_round_batch_request_;
+    }
+    clear_has_payload();
+  }
+}
+void CoordinatorNodeMessage::set_allocated_mpc_round_batch_response(::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* mpc_round_batch_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (mpc_round_batch_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mpc_round_batch_response));
+    if (message_arena != submessage_arena) {
+      mpc_round_batch_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mpc_round_batch_response, submessage_arena);
+    }
+    set_has_mpc_round_batch_response();
+    _impl_.payload_.mpc_round_batch_response_ = mpc_round_batch_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_response)
+}
+void CoordinatorNodeMessage::clear_mpc_round_batch_response() {
+  if (_internal_has_mpc_round_batch_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.mpc_round_batch_response_;
+    }
+    clear_has_payload();
+  }
+}
+void CoordinatorNodeMessage::set_allocated_mpc_mesh_session_request(::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* mpc_mesh_session_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (mpc_mesh_session_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mpc_mesh_session_request));
+    if (message_arena != submessage_arena) {
+      mpc_mesh_session_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mpc_mesh_session_request, submessage_arena);
+    }
+    set_has_mpc_mesh_session_request();
+    _impl_.payload_.mpc_mesh_session_request_ = mpc_mesh_session_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_request)
+}
+void CoordinatorNodeMessage::clear_mpc_mesh_session_request() {
+  if (_internal_has_mpc_mesh_session_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.mpc_mesh_session_request_;
+    }
+    clear_has_payload();
+  }
+}
+void CoordinatorNodeMessage::set_allocated_mpc_mesh_session_response(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* mpc_mesh_session_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (mpc_mesh_session_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(mpc_mesh_session_response));
+    if (message_arena != submessage_arena) {
+      mpc_mesh_session_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mpc_mesh_session_response, submessage_arena);
+    }
+    set_has_mpc_mesh_session_response();
+    _impl_.payload_.mpc_mesh_session_response_ = mpc_mesh_session_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_response)
+}
+void CoordinatorNodeMessage::clear_mpc_mesh_session_response() {
+  if (_internal_has_mpc_mesh_session_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.mpc_mesh_session_response_;
+    }
+    clear_has_payload();
+  }
+}
 CoordinatorNodeMessage::CoordinatorNodeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -191,6 +484,51 @@ CoordinatorNodeMessage::CoordinatorNodeMessage(const CoordinatorNodeMessage& fro
           from._internal_signing_response());
       break;
     }
+    case kErrorResponse: {
+      _this->_internal_mutable_error_response()->::mpc_engine::proto::coordinator_node::ErrorResponse::MergeFrom(
+          from._internal_error_response());
+      break;
+    }
+    case kMpcRoundRequest: {
+      _this->_internal_mutable_mpc_round_request()->::mpc_engine::proto::coordinator_node::MpcRoundRequest::MergeFrom(
+          from._internal_mpc_round_request());
+      break;
+    }
+    case kMpcRoundResponse: {
+      _this->_internal_mutable_mpc_round_response()->::mpc_engine::proto::coordinator_node::MpcRoundResponse::MergeFrom(
+          from._internal_mpc_round_response());
+      break;
+    }
+    case kMpcAbortRequest: {
+      _this->_internal_mutable_mpc_abort_request()->::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest::MergeFrom(
+          from._internal_mpc_abort_request());
+      break;
+    }
+    case kMpcAbortResponse: {
+      _this->_internal_mutable_mpc_abort_response()->::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse::MergeFrom(
+          from._internal_mpc_abort_response());
+      break;
+    }
+    case kMpcRoundBatchRequest: {
+      _this->_internal_mutable_mpc_round_batch_request()->::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest::MergeFrom(
+          from._internal_mpc_round_batch_request());
+      break;
+    }
+    case kMpcRoundBatchResponse: {
+      _this->_internal_mutable_mpc_round_batch_response()->::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse::MergeFrom(
+          from._internal_mpc_round_batch_response());
+      break;
+    }
+    case kMpcMeshSessionRequest: {
+      _this->_internal_mutable_mpc_mesh_session_request()->::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest::MergeFrom(
+          from._internal_mpc_mesh_session_request());
+      break;
+    }
+    case kMpcMeshSessionResponse: {
+      _this->_internal_mutable_mpc_mesh_session_response()->::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse::MergeFrom(
+          from._internal_mpc_mesh_session_response());
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -246,6 +584,60 @@ void CoordinatorNodeMessage::clear_payload() {
       }
       break;
     }
+    case kErrorResponse: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.error_response_;
+      }
+      break;
+    }
+    case kMpcRoundRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.mpc_round_request_;
+      }
+      break;
+    }
+    case kMpcRoundResponse: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.mpc_round_response_;
+      }
+      break;
+    }
+    case kMpcAbortRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.mpc_abort_request_;
+      }
+      break;
+    }
+    case kMpcAbortResponse: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.mpc_abort_response_;
+      }
+      break;
+    }
+    case kMpcRoundBatchRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.mpc_round_batch_request_;
+      }
+      break;
+    }
+    case kMpcRoundBatchResponse: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.mpc_round_batch_response_;
+      }
+      break;
+    }
+    case kMpcMeshSessionRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.mpc_mesh_session_request_;
+      }
+      break;
+    }
+    case kMpcMeshSessionResponse: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.mpc_mesh_session_response_;
+      }
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -295,6 +687,78 @@ const char* CoordinatorNodeMessage::_InternalParse(const char* ptr, ::_pbi::Pars
         } else
           goto handle_unusual;
         continue;
+      // .mpc_engine.proto.coordinator_node.ErrorResponse error_response = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcRoundRequest mpc_round_request = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mpc_round_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcRoundResponse mpc_round_response = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mpc_round_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcSessionAbortRequest mpc_abort_request = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mpc_abort_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcSessionAbortResponse mpc_abort_response = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mpc_abort_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcRoundBatchRequest mpc_round_batch_request = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mpc_round_batch_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcRoundBatchResponse mpc_round_batch_response = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mpc_round_batch_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcMeshSessionRequest mpc_mesh_session_request = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mpc_mesh_session_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcMeshSessionResponse mpc_mesh_session_response = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mpc_mesh_session_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -344,6 +808,69 @@ uint8_t* CoordinatorNodeMessage::_InternalSerialize(
         _Internal::signing_response(this).GetCachedSize(), target, stream);
   }
 
+  // .mpc_engine.proto.coordinator_node.ErrorResponse error_response = 4;
+  if (_internal_has_error_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::error_response(this),
+        _Internal::error_response(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundRequest mpc_round_request = 5;
+  if (_internal_has_mpc_round_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::mpc_round_request(this),
+        _Internal::mpc_round_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundResponse mpc_round_response = 6;
+  if (_internal_has_mpc_round_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::mpc_round_response(this),
+        _Internal::mpc_round_response(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcSessionAbortRequest mpc_abort_request = 7;
+  if (_internal_has_mpc_abort_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::mpc_abort_request(this),
+        _Internal::mpc_abort_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcSessionAbortResponse mpc_abort_response = 8;
+  if (_internal_has_mpc_abort_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::mpc_abort_response(this),
+        _Internal::mpc_abort_response(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundBatchRequest mpc_round_batch_request = 9;
+  if (_internal_has_mpc_round_batch_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::mpc_round_batch_request(this),
+        _Internal::mpc_round_batch_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundBatchResponse mpc_round_batch_response = 10;
+  if (_internal_has_mpc_round_batch_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::mpc_round_batch_response(this),
+        _Internal::mpc_round_batch_response(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcMeshSessionRequest mpc_mesh_session_request = 11;
+  if (_internal_has_mpc_mesh_session_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::mpc_mesh_session_request(this),
+        _Internal::mpc_mesh_session_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcMeshSessionResponse mpc_mesh_session_response = 12;
+  if (_internal_has_mpc_mesh_session_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::mpc_mesh_session_response(this),
+        _Internal::mpc_mesh_session_response(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -380,6 +907,69 @@ size_t CoordinatorNodeMessage::ByteSizeLong() const {
           *_impl_.payload_.signing_response_);
       break;
     }
+    // .mpc_engine.proto.coordinator_node.ErrorResponse error_response = 4;
+    case kErrorResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.error_response_);
+      break;
+    }
+    // .mpc_engine.proto.coordinator_node.MpcRoundRequest mpc_round_request = 5;
+    case kMpcRoundRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.mpc_round_request_);
+      break;
+    }
+    // .mpc_engine.proto.coordinator_node.MpcRoundResponse mpc_round_response = 6;
+    case kMpcRoundResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.mpc_round_response_);
+      break;
+    }
+    // .mpc_engine.proto.coordinator_node.MpcSessionAbortRequest mpc_abort_request = 7;
+    case kMpcAbortRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.mpc_abort_request_);
+      break;
+    }
+    // .mpc_engine.proto.coordinator_node.MpcSessionAbortResponse mpc_abort_response = 8;
+    case kMpcAbortResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.mpc_abort_response_);
+      break;
+    }
+    // .mpc_engine.proto.coordinator_node.MpcRoundBatchRequest mpc_round_batch_request = 9;
+    case kMpcRoundBatchRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.mpc_round_batch_request_);
+      break;
+    }
+    // .mpc_engine.proto.coordinator_node.MpcRoundBatchResponse mpc_round_batch_response = 10;
+    case kMpcRoundBatchResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.mpc_round_batch_response_);
+      break;
+    }
+    // .mpc_engine.proto.coordinator_node.MpcMeshSessionRequest mpc_mesh_session_request = 11;
+    case kMpcMeshSessionRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.mpc_mesh_session_request_);
+      break;
+    }
+    // .mpc_engine.proto.coordinator_node.MpcMeshSessionResponse mpc_mesh_session_response = 12;
+    case kMpcMeshSessionResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.mpc_mesh_session_response_);
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -416,6 +1006,51 @@ void CoordinatorNodeMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg,
           from._internal_signing_response());
       break;
     }
+    case kErrorResponse: {
+      _this->_internal_mutable_error_response()->::mpc_engine::proto::coordinator_node::ErrorResponse::MergeFrom(
+          from._internal_error_response());
+      break;
+    }
+    case kMpcRoundRequest: {
+      _this->_internal_mutable_mpc_round_request()->::mpc_engine::proto::coordinator_node::MpcRoundRequest::MergeFrom(
+          from._internal_mpc_round_request());
+      break;
+    }
+    case kMpcRoundResponse: {
+      _this->_internal_mutable_mpc_round_response()->::mpc_engine::proto::coordinator_node::MpcRoundResponse::MergeFrom(
+          from._internal_mpc_round_response());
+      break;
+    }
+    case kMpcAbortRequest: {
+      _this->_internal_mutable_mpc_abort_request()->::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest::MergeFrom(
+          from._internal_mpc_abort_request());
+      break;
+    }
+    case kMpcAbortResponse: {
+      _this->_internal_mutable_mpc_abort_response()->::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse::MergeFrom(
+          from._internal_mpc_abort_response());
+      break;
+    }
+    case kMpcRoundBatchRequest: {
+      _this->_internal_mutable_mpc_round_batch_request()->::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest::MergeFrom(
+          from._internal_mpc_round_batch_request());
+      break;
+    }
+    case kMpcRoundBatchResponse: {
+      _this->_internal_mutable_mpc_round_batch_response()->::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse::MergeFrom(
+          from._internal_mpc_round_batch_response());
+      break;
+    }
+    case kMpcMeshSessionRequest: {
+      _this->_internal_mutable_mpc_mesh_session_request()->::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest::MergeFrom(
+          from._internal_mpc_mesh_session_request());
+      break;
+    }
+    case kMpcMeshSessionResponse: {
+      _this->_internal_mutable_mpc_mesh_session_response()->::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse::MergeFrom(
+          from._internal_mpc_mesh_session_response());
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -32,6 +32,8 @@
 #include <google/protobuf/unknown_field_set.h>
 #include "common.pb.h"
 #include "signing.pb.h"
+#include "error.pb.h"
+#include "mpc.pb.h"
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_message_2eproto
@@ -110,6 +112,15 @@ class CoordinatorNodeMessage final :
   enum PayloadCase {
     kSigningRequest = 2,
     kSigningResponse = 3,
+    kErrorResponse = 4,
+    kMpcRoundRequest = 5,
+    kMpcRoundResponse = 6,
+    kMpcAbortRequest = 7,
+    kMpcAbortResponse = 8,
+    kMpcRoundBatchRequest = 9,
+    kMpcRoundBatchResponse = 10,
+    kMpcMeshSessionRequest = 11,
+    kMpcMeshSessionResponse = 12,
     PAYLOAD_NOT_SET = 0,
   };
 
@@ -194,6 +205,15 @@ class CoordinatorNodeMessage final :
     kMessageTypeFieldNumber = 1,
     kSigningRequestFieldNumber = 2,
     kSigningResponseFieldNumber = 3,
+    kErrorResponseFieldNumber = 4,
+    kMpcRoundRequestFieldNumber = 5,
+    kMpcRoundResponseFieldNumber = 6,
+    kMpcAbortRequestFieldNumber = 7,
+    kMpcAbortResponseFieldNumber = 8,
+    kMpcRoundBatchRequestFieldNumber = 9,
+    kMpcRoundBatchResponseFieldNumber = 10,
+    kMpcMeshSessionRequestFieldNumber = 11,
+    kMpcMeshSessionResponseFieldNumber = 12,
   };
   // int32 message_type = 1;
   void clear_message_type();
@@ -240,6 +260,168 @@ class CoordinatorNodeMessage final :
       ::mpc_engine::proto::coordinator_node::SigningResponse* signing_response);
   ::mpc_engine::proto::coordinator_node::SigningResponse* unsafe_arena_release_signing_response();
 
+  // .mpc_engine.proto.coordinator_node.ErrorResponse error_response = 4;
+  bool has_error_response() const;
+  private:
+  bool _internal_has_error_response() const;
+  public:
+  void clear_error_response();
+  const ::mpc_engine::proto::coordinator_node::ErrorResponse& error_response() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::ErrorResponse* release_error_response();
+  ::mpc_engine::proto::coordinator_node::ErrorResponse* mutable_error_response();
+  void set_allocated_error_response(::mpc_engine::proto::coordinator_node::ErrorResponse* error_response);
+  private:
+  const ::mpc_engine::proto::coordinator_node::ErrorResponse& _internal_error_response() const;
+  ::mpc_engine::proto::coordinator_node::ErrorResponse* _internal_mutable_error_response();
+  public:
+  void unsafe_arena_set_allocated_error_response(
+      ::mpc_engine::proto::coordinator_node::ErrorResponse* error_response);
+  ::mpc_engine::proto::coordinator_node::ErrorResponse* unsafe_arena_release_error_response();
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundRequest mpc_round_request = 5;
+  bool has_mpc_round_request() const;
+  private:
+  bool _internal_has_mpc_round_request() const;
+  public:
+  void clear_mpc_round_request();
+  const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& mpc_round_request() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::MpcRoundRequest* release_mpc_round_request();
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* mutable_mpc_round_request();
+  void set_allocated_mpc_round_request(::mpc_engine::proto::coordinator_node::MpcRoundRequest* mpc_round_request);
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& _internal_mpc_round_request() const;
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* _internal_mutable_mpc_round_request();
+  public:
+  void unsafe_arena_set_allocated_mpc_round_request(
+      ::mpc_engine::proto::coordinator_node::MpcRoundRequest* mpc_round_request);
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* unsafe_arena_release_mpc_round_request();
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundResponse mpc_round_response = 6;
+  bool has_mpc_round_response() const;
+  private:
+  bool _internal_has_mpc_round_response() const;
+  public:
+  void clear_mpc_round_response();
+  const ::mpc_engine::proto::coordinator_node::MpcRoundResponse& mpc_round_response() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::MpcRoundResponse* release_mpc_round_response();
+  ::mpc_engine::proto::coordinator_node::MpcRoundResponse* mutable_mpc_round_response();
+  void set_allocated_mpc_round_response(::mpc_engine::proto::coordinator_node::MpcRoundResponse* mpc_round_response);
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcRoundResponse& _internal_mpc_round_response() const;
+  ::mpc_engine::proto::coordinator_node::MpcRoundResponse* _internal_mutable_mpc_round_response();
+  public:
+  void unsafe_arena_set_allocated_mpc_round_response(
+      ::mpc_engine::proto::coordinator_node::MpcRoundResponse* mpc_round_response);
+  ::mpc_engine::proto::coordinator_node::MpcRoundResponse* unsafe_arena_release_mpc_round_response();
+
+  // .mpc_engine.proto.coordinator_node.MpcSessionAbortRequest mpc_abort_request = 7;
+  bool has_mpc_abort_request() const;
+  private:
+  bool _internal_has_mpc_abort_request() const;
+  public:
+  void clear_mpc_abort_request();
+  const ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest& mpc_abort_request() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* release_mpc_abort_request();
+  ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* mutable_mpc_abort_request();
+  void set_allocated_mpc_abort_request(::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* mpc_abort_request);
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest& _internal_mpc_abort_request() const;
+  ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* _internal_mutable_mpc_abort_request();
+  public:
+  void unsafe_arena_set_allocated_mpc_abort_request(
+      ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* mpc_abort_request);
+  ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* unsafe_arena_release_mpc_abort_request();
+
+  // .mpc_engine.proto.coordinator_node.MpcSessionAbortResponse mpc_abort_response = 8;
+  bool has_mpc_abort_response() const;
+  private:
+  bool _internal_has_mpc_abort_response() const;
+  public:
+  void clear_mpc_abort_response();
+  const ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse& mpc_abort_response() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* release_mpc_abort_response();
+  ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* mutable_mpc_abort_response();
+  void set_allocated_mpc_abort_response(::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* mpc_abort_response);
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse& _internal_mpc_abort_response() const;
+  ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* _internal_mutable_mpc_abort_response();
+  public:
+  void unsafe_arena_set_allocated_mpc_abort_response(
+      ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* mpc_abort_response);
+  ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* unsafe_arena_release_mpc_abort_response();
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundBatchRequest mpc_round_batch_request = 9;
+  bool has_mpc_round_batch_request() const;
+  private:
+  bool _internal_has_mpc_round_batch_request() const;
+  public:
+  void clear_mpc_round_batch_request();
+  const ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest& mpc_round_batch_request() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* release_mpc_round_batch_request();
+  ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* mutable_mpc_round_batch_request();
+  void set_allocated_mpc_round_batch_request(::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* mpc_round_batch_request);
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest& _internal_mpc_round_batch_request() const;
+  ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* _internal_mutable_mpc_round_batch_request();
+  public:
+  void unsafe_arena_set_allocated_mpc_round_batch_request(
+      ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* mpc_round_batch_request);
+  ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* unsafe_arena_release_mpc_round_batch_request();
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundBatchResponse mpc_round_batch_response = 10;
+  bool has_mpc_round_batch_response() const;
+  private:
+  bool _internal_has_mpc_round_batch_response() const;
+  public:
+  void clear_mpc_round_batch_response();
+  const ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse& mpc_round_batch_response() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* release_mpc_round_batch_response();
+  ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* mutable_mpc_round_batch_response();
+  void set_allocated_mpc_round_batch_response(::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* mpc_round_batch_response);
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse& _internal_mpc_round_batch_response() const;
+  ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* _internal_mutable_mpc_round_batch_response();
+  public:
+  void unsafe_arena_set_allocated_mpc_round_batch_response(
+      ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* mpc_round_batch_response);
+  ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* unsafe_arena_release_mpc_round_batch_response();
+
+  // .mpc_engine.proto.coordinator_node.MpcMeshSessionRequest mpc_mesh_session_request = 11;
+  bool has_mpc_mesh_session_request() const;
+  private:
+  bool _internal_has_mpc_mesh_session_request() const;
+  public:
+  void clear_mpc_mesh_session_request();
+  const ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest& mpc_mesh_session_request() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* release_mpc_mesh_session_request();
+  ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* mutable_mpc_mesh_session_request();
+  void set_allocated_mpc_mesh_session_request(::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* mpc_mesh_session_request);
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest& _internal_mpc_mesh_session_request() const;
+  ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* _internal_mutable_mpc_mesh_session_request();
+  public:
+  void unsafe_arena_set_allocated_mpc_mesh_session_request(
+      ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* mpc_mesh_session_request);
+  ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* unsafe_arena_release_mpc_mesh_session_request();
+
+  // .mpc_engine.proto.coordinator_node.MpcMeshSessionResponse mpc_mesh_session_response = 12;
+  bool has_mpc_mesh_session_response() const;
+  private:
+  bool _internal_has_mpc_mesh_session_response() const;
+  public:
+  void clear_mpc_mesh_session_response();
+  const ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse& mpc_mesh_session_response() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* release_mpc_mesh_session_response();
+  ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* mutable_mpc_mesh_session_response();
+  void set_allocated_mpc_mesh_session_response(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* mpc_mesh_session_response);
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse& _internal_mpc_mesh_session_response() const;
+  ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* _internal_mutable_mpc_mesh_session_response();
+  public:
+  void unsafe_arena_set_allocated_mpc_mesh_session_response(
+      ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* mpc_mesh_session_response);
+  ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* unsafe_arena_release_mpc_mesh_session_response();
+
   void clear_payload();
   PayloadCase payload_case() const;
   // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage)
@@ -247,6 +429,15 @@ class CoordinatorNodeMessage final :
   class _Internal;
   void set_has_signing_request();
   void set_has_signing_response();
+  void set_has_error_response();
+  void set_has_mpc_round_request();
+  void set_has_mpc_round_response();
+  void set_has_mpc_abort_request();
+  void set_has_mpc_abort_response();
+  void set_has_mpc_round_batch_request();
+  void set_has_mpc_round_batch_response();
+  void set_has_mpc_mesh_session_request();
+  void set_has_mpc_mesh_session_response();
 
   inline bool has_payload() const;
   inline void clear_has_payload();
@@ -261,6 +452,15 @@ class CoordinatorNodeMessage final :
         ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
       ::mpc_engine::proto::coordinator_node::SigningRequest* signing_request_;
       ::mpc_engine::proto::coordinator_node::SigningResponse* signing_response_;
+      ::mpc_engine::proto::coordinator_node::ErrorResponse* error_response_;
+      ::mpc_engine::proto::coordinator_node::MpcRoundRequest* mpc_round_request_;
+      ::mpc_engine::proto::coordinator_node::MpcRoundResponse* mpc_round_response_;
+      ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* mpc_abort_request_;
+      ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* mpc_abort_response_;
+      ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* mpc_round_batch_request_;
+      ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* mpc_round_batch_response_;
+      ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* mpc_mesh_session_request_;
+      ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* mpc_mesh_session_response_;
     } payload_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     uint32_t _oneof_case_[1];
@@ -432,6 +632,600 @@ inline ::mpc_engine::proto::coordinator_node::SigningResponse* CoordinatorNodeMe
   return _msg;
 }
 
+// .mpc_engine.proto.coordinator_node.ErrorResponse error_response = 4;
+inline bool CoordinatorNodeMessage::_internal_has_error_response() const {
+  return payload_case() == kErrorResponse;
+}
+inline bool CoordinatorNodeMessage::has_error_response() const {
+  return _internal_has_error_response();
+}
+inline void CoordinatorNodeMessage::set_has_error_response() {
+  _impl_._oneof_case_[0] = kErrorResponse;
+}
+inline ::mpc_engine::proto::coordinator_node::ErrorResponse* CoordinatorNodeMessage::release_error_response() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.error_response)
+  if (_internal_has_error_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::ErrorResponse* temp = _impl_.payload_.error_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.error_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::coordinator_node::ErrorResponse& CoordinatorNodeMessage::_internal_error_response() const {
+  return _internal_has_error_response()
+      ? *_impl_.payload_.error_response_
+      : reinterpret_cast< ::mpc_engine::proto::coordinator_node::ErrorResponse&>(::mpc_engine::proto::coordinator_node::_ErrorResponse_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::ErrorResponse& CoordinatorNodeMessage::error_response() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.error_response)
+  return _internal_error_response();
+}
+inline ::mpc_engine::proto::coordinator_node::ErrorResponse* CoordinatorNodeMessage::unsafe_arena_release_error_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.error_response)
+  if (_internal_has_error_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::ErrorResponse* temp = _impl_.payload_.error_response_;
+    _impl_.payload_.error_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void CoordinatorNodeMessage::unsafe_arena_set_allocated_error_response(::mpc_engine::proto::coordinator_node::ErrorResponse* error_response) {
+  clear_payload();
+  if (error_response) {
+    set_has_error_response();
+    _impl_.payload_.error_response_ = error_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.error_response)
+}
+inline ::mpc_engine::proto::coordinator_node::ErrorResponse* CoordinatorNodeMessage::_internal_mutable_error_response() {
+  if (!_internal_has_error_response()) {
+    clear_payload();
+    set_has_error_response();
+    _impl_.payload_.error_response_ = CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::ErrorResponse >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.error_response_;
+}
+inline ::mpc_engine::proto::coordinator_node::ErrorResponse* CoordinatorNodeMessage::mutable_error_response() {
+  ::mpc_engine::proto::coordinator_node::ErrorResponse* _msg = _internal_mutable_error_response();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.error_response)
+  return _msg;
+}
+
+// .mpc_engine.proto.coordinator_node.MpcRoundRequest mpc_round_request = 5;
+inline bool CoordinatorNodeMessage::_internal_has_mpc_round_request() const {
+  return payload_case() == kMpcRoundRequest;
+}
+inline bool CoordinatorNodeMessage::has_mpc_round_request() const {
+  return _internal_has_mpc_round_request();
+}
+inline void CoordinatorNodeMessage::set_has_mpc_round_request() {
+  _impl_._oneof_case_[0] = kMpcRoundRequest;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* CoordinatorNodeMessage::release_mpc_round_request() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_request)
+  if (_internal_has_mpc_round_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcRoundRequest* temp = _impl_.payload_.mpc_round_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.mpc_round_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& CoordinatorNodeMessage::_internal_mpc_round_request() const {
+  return _internal_has_mpc_round_request()
+      ? *_impl_.payload_.mpc_round_request_
+      : reinterpret_cast< ::mpc_engine::proto::coordinator_node::MpcRoundRequest&>(::mpc_engine::proto::coordinator_node::_MpcRoundRequest_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& CoordinatorNodeMessage::mpc_round_request() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_request)
+  return _internal_mpc_round_request();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* CoordinatorNodeMessage::unsafe_arena_release_mpc_round_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_request)
+  if (_internal_has_mpc_round_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcRoundRequest* temp = _impl_.payload_.mpc_round_request_;
+    _impl_.payload_.mpc_round_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void CoordinatorNodeMessage::unsafe_arena_set_allocated_mpc_round_request(::mpc_engine::proto::coordinator_node::MpcRoundRequest* mpc_round_request) {
+  clear_payload();
+  if (mpc_round_request) {
+    set_has_mpc_round_request();
+    _impl_.payload_.mpc_round_request_ = mpc_round_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_request)
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* CoordinatorNodeMessage::_internal_mutable_mpc_round_request() {
+  if (!_internal_has_mpc_round_request()) {
+    clear_payload();
+    set_has_mpc_round_request();
+    _impl_.payload_.mpc_round_request_ = CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcRoundRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.mpc_round_request_;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* CoordinatorNodeMessage::mutable_mpc_round_request() {
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* _msg = _internal_mutable_mpc_round_request();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_request)
+  return _msg;
+}
+
+// .mpc_engine.proto.coordinator_node.MpcRoundResponse mpc_round_response = 6;
+inline bool CoordinatorNodeMessage::_internal_has_mpc_round_response() const {
+  return payload_case() == kMpcRoundResponse;
+}
+inline bool CoordinatorNodeMessage::has_mpc_round_response() const {
+  return _internal_has_mpc_round_response();
+}
+inline void CoordinatorNodeMessage::set_has_mpc_round_response() {
+  _impl_._oneof_case_[0] = kMpcRoundResponse;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundResponse* CoordinatorNodeMessage::release_mpc_round_response() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_response)
+  if (_internal_has_mpc_round_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcRoundResponse* temp = _impl_.payload_.mpc_round_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.mpc_round_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundResponse& CoordinatorNodeMessage::_internal_mpc_round_response() const {
+  return _internal_has_mpc_round_response()
+      ? *_impl_.payload_.mpc_round_response_
+      : reinterpret_cast< ::mpc_engine::proto::coordinator_node::MpcRoundResponse&>(::mpc_engine::proto::coordinator_node::_MpcRoundResponse_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundResponse& CoordinatorNodeMessage::mpc_round_response() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_response)
+  return _internal_mpc_round_response();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundResponse* CoordinatorNodeMessage::unsafe_arena_release_mpc_round_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_response)
+  if (_internal_has_mpc_round_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcRoundResponse* temp = _impl_.payload_.mpc_round_response_;
+    _impl_.payload_.mpc_round_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void CoordinatorNodeMessage::unsafe_arena_set_allocated_mpc_round_response(::mpc_engine::proto::coordinator_node::MpcRoundResponse* mpc_round_response) {
+  clear_payload();
+  if (mpc_round_response) {
+    set_has_mpc_round_response();
+    _impl_.payload_.mpc_round_response_ = mpc_round_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_response)
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundResponse* CoordinatorNodeMessage::_internal_mutable_mpc_round_response() {
+  if (!_internal_has_mpc_round_response()) {
+    clear_payload();
+    set_has_mpc_round_response();
+    _impl_.payload_.mpc_round_response_ = CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcRoundResponse >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.mpc_round_response_;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundResponse* CoordinatorNodeMessage::mutable_mpc_round_response() {
+  ::mpc_engine::proto::coordinator_node::MpcRoundResponse* _msg = _internal_mutable_mpc_round_response();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_response)
+  return _msg;
+}
+
+// .mpc_engine.proto.coordinator_node.MpcSessionAbortRequest mpc_abort_request = 7;
+inline bool CoordinatorNodeMessage::_internal_has_mpc_abort_request() const {
+  return payload_case() == kMpcAbortRequest;
+}
+inline bool CoordinatorNodeMessage::has_mpc_abort_request() const {
+  return _internal_has_mpc_abort_request();
+}
+inline void CoordinatorNodeMessage::set_has_mpc_abort_request() {
+  _impl_._oneof_case_[0] = kMpcAbortRequest;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* CoordinatorNodeMessage::release_mpc_abort_request() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_request)
+  if (_internal_has_mpc_abort_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* temp = _impl_.payload_.mpc_abort_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.mpc_abort_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest& CoordinatorNodeMessage::_internal_mpc_abort_request() const {
+  return _internal_has_mpc_abort_request()
+      ? *_impl_.payload_.mpc_abort_request_
+      : reinterpret_cast< ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest&>(::mpc_engine::proto::coordinator_node::_MpcSessionAbortRequest_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest& CoordinatorNodeMessage::mpc_abort_request() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_request)
+  return _internal_mpc_abort_request();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* CoordinatorNodeMessage::unsafe_arena_release_mpc_abort_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_request)
+  if (_internal_has_mpc_abort_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* temp = _impl_.payload_.mpc_abort_request_;
+    _impl_.payload_.mpc_abort_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void CoordinatorNodeMessage::unsafe_arena_set_allocated_mpc_abort_request(::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* mpc_abort_request) {
+  clear_payload();
+  if (mpc_abort_request) {
+    set_has_mpc_abort_request();
+    _impl_.payload_.mpc_abort_request_ = mpc_abort_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_request)
+}
+inline ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* CoordinatorNodeMessage::_internal_mutable_mpc_abort_request() {
+  if (!_internal_has_mpc_abort_request()) {
+    clear_payload();
+    set_has_mpc_abort_request();
+    _impl_.payload_.mpc_abort_request_ = CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.mpc_abort_request_;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* CoordinatorNodeMessage::mutable_mpc_abort_request() {
+  ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* _msg = _internal_mutable_mpc_abort_request();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_request)
+  return _msg;
+}
+
+// .mpc_engine.proto.coordinator_node.MpcSessionAbortResponse mpc_abort_response = 8;
+inline bool CoordinatorNodeMessage::_internal_has_mpc_abort_response() const {
+  return payload_case() == kMpcAbortResponse;
+}
+inline bool CoordinatorNodeMessage::has_mpc_abort_response() const {
+  return _internal_has_mpc_abort_response();
+}
+inline void CoordinatorNodeMessage::set_has_mpc_abort_response() {
+  _impl_._oneof_case_[0] = kMpcAbortResponse;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* CoordinatorNodeMessage::release_mpc_abort_response() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_response)
+  if (_internal_has_mpc_abort_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* temp = _impl_.payload_.mpc_abort_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.mpc_abort_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse& CoordinatorNodeMessage::_internal_mpc_abort_response() const {
+  return _internal_has_mpc_abort_response()
+      ? *_impl_.payload_.mpc_abort_response_
+      : reinterpret_cast< ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse&>(::mpc_engine::proto::coordinator_node::_MpcSessionAbortResponse_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse& CoordinatorNodeMessage::mpc_abort_response() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_response)
+  return _internal_mpc_abort_response();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* CoordinatorNodeMessage::unsafe_arena_release_mpc_abort_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_response)
+  if (_internal_has_mpc_abort_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* temp = _impl_.payload_.mpc_abort_response_;
+    _impl_.payload_.mpc_abort_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void CoordinatorNodeMessage::unsafe_arena_set_allocated_mpc_abort_response(::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* mpc_abort_response) {
+  clear_payload();
+  if (mpc_abort_response) {
+    set_has_mpc_abort_response();
+    _impl_.payload_.mpc_abort_response_ = mpc_abort_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_response)
+}
+inline ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* CoordinatorNodeMessage::_internal_mutable_mpc_abort_response() {
+  if (!_internal_has_mpc_abort_response()) {
+    clear_payload();
+    set_has_mpc_abort_response();
+    _impl_.payload_.mpc_abort_response_ = CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.mpc_abort_response_;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* CoordinatorNodeMessage::mutable_mpc_abort_response() {
+  ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* _msg = _internal_mutable_mpc_abort_response();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_abort_response)
+  return _msg;
+}
+
+// .mpc_engine.proto.coordinator_node.MpcRoundBatchRequest mpc_round_batch_request = 9;
+inline bool CoordinatorNodeMessage::_internal_has_mpc_round_batch_request() const {
+  return payload_case() == kMpcRoundBatchRequest;
+}
+inline bool CoordinatorNodeMessage::has_mpc_round_batch_request() const {
+  return _internal_has_mpc_round_batch_request();
+}
+inline void CoordinatorNodeMessage::set_has_mpc_round_batch_request() {
+  _impl_._oneof_case_[0] = kMpcRoundBatchRequest;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* CoordinatorNodeMessage::release_mpc_round_batch_request() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_request)
+  if (_internal_has_mpc_round_batch_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* temp = _impl_.payload_.mpc_round_batch_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.mpc_round_batch_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest& CoordinatorNodeMessage::_internal_mpc_round_batch_request() const {
+  return _internal_has_mpc_round_batch_request()
+      ? *_impl_.payload_.mpc_round_batch_request_
+      : reinterpret_cast< ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest&>(::mpc_engine::proto::coordinator_node::_MpcRoundBatchRequest_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest& CoordinatorNodeMessage::mpc_round_batch_request() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_request)
+  return _internal_mpc_round_batch_request();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* CoordinatorNodeMessage::unsafe_arena_release_mpc_round_batch_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_request)
+  if (_internal_has_mpc_round_batch_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* temp = _impl_.payload_.mpc_round_batch_request_;
+    _impl_.payload_.mpc_round_batch_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void CoordinatorNodeMessage::unsafe_arena_set_allocated_mpc_round_batch_request(::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* mpc_round_batch_request) {
+  clear_payload();
+  if (mpc_round_batch_request) {
+    set_has_mpc_round_batch_request();
+    _impl_.payload_.mpc_round_batch_request_ = mpc_round_batch_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_request)
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* CoordinatorNodeMessage::_internal_mutable_mpc_round_batch_request() {
+  if (!_internal_has_mpc_round_batch_request()) {
+    clear_payload();
+    set_has_mpc_round_batch_request();
+    _impl_.payload_.mpc_round_batch_request_ = CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.mpc_round_batch_request_;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* CoordinatorNodeMessage::mutable_mpc_round_batch_request() {
+  ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* _msg = _internal_mutable_mpc_round_batch_request();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_request)
+  return _msg;
+}
+
+// .mpc_engine.proto.coordinator_node.MpcRoundBatchResponse mpc_round_batch_response = 10;
+inline bool CoordinatorNodeMessage::_internal_has_mpc_round_batch_response() const {
+  return payload_case() == kMpcRoundBatchResponse;
+}
+inline bool CoordinatorNodeMessage::has_mpc_round_batch_response() const {
+  return _internal_has_mpc_round_batch_response();
+}
+inline void CoordinatorNodeMessage::set_has_mpc_round_batch_response() {
+  _impl_._oneof_case_[0] = kMpcRoundBatchResponse;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* CoordinatorNodeMessage::release_mpc_round_batch_response() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_response)
+  if (_internal_has_mpc_round_batch_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* temp = _impl_.payload_.mpc_round_batch_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.mpc_round_batch_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse& CoordinatorNodeMessage::_internal_mpc_round_batch_response() const {
+  return _internal_has_mpc_round_batch_response()
+      ? *_impl_.payload_.mpc_round_batch_response_
+      : reinterpret_cast< ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse&>(::mpc_engine::proto::coordinator_node::_MpcRoundBatchResponse_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse& CoordinatorNodeMessage::mpc_round_batch_response() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_response)
+  return _internal_mpc_round_batch_response();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* CoordinatorNodeMessage::unsafe_arena_release_mpc_round_batch_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_response)
+  if (_internal_has_mpc_round_batch_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* temp = _impl_.payload_.mpc_round_batch_response_;
+    _impl_.payload_.mpc_round_batch_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void CoordinatorNodeMessage::unsafe_arena_set_allocated_mpc_round_batch_response(::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* mpc_round_batch_response) {
+  clear_payload();
+  if (mpc_round_batch_response) {
+    set_has_mpc_round_batch_response();
+    _impl_.payload_.mpc_round_batch_response_ = mpc_round_batch_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_response)
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* CoordinatorNodeMessage::_internal_mutable_mpc_round_batch_response() {
+  if (!_internal_has_mpc_round_batch_response()) {
+    clear_payload();
+    set_has_mpc_round_batch_response();
+    _impl_.payload_.mpc_round_batch_response_ = CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.mpc_round_batch_response_;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* CoordinatorNodeMessage::mutable_mpc_round_batch_response() {
+  ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* _msg = _internal_mutable_mpc_round_batch_response();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_round_batch_response)
+  return _msg;
+}
+
+// .mpc_engine.proto.coordinator_node.MpcMeshSessionRequest mpc_mesh_session_request = 11;
+inline bool CoordinatorNodeMessage::_internal_has_mpc_mesh_session_request() const {
+  return payload_case() == kMpcMeshSessionRequest;
+}
+inline bool CoordinatorNodeMessage::has_mpc_mesh_session_request() const {
+  return _internal_has_mpc_mesh_session_request();
+}
+inline void CoordinatorNodeMessage::set_has_mpc_mesh_session_request() {
+  _impl_._oneof_case_[0] = kMpcMeshSessionRequest;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* CoordinatorNodeMessage::release_mpc_mesh_session_request() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_request)
+  if (_internal_has_mpc_mesh_session_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* temp = _impl_.payload_.mpc_mesh_session_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.mpc_mesh_session_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest& CoordinatorNodeMessage::_internal_mpc_mesh_session_request() const {
+  return _internal_has_mpc_mesh_session_request()
+      ? *_impl_.payload_.mpc_mesh_session_request_
+      : reinterpret_cast< ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest&>(::mpc_engine::proto::coordinator_node::_MpcMeshSessionRequest_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest& CoordinatorNodeMessage::mpc_mesh_session_request() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_request)
+  return _internal_mpc_mesh_session_request();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* CoordinatorNodeMessage::unsafe_arena_release_mpc_mesh_session_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_request)
+  if (_internal_has_mpc_mesh_session_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* temp = _impl_.payload_.mpc_mesh_session_request_;
+    _impl_.payload_.mpc_mesh_session_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void CoordinatorNodeMessage::unsafe_arena_set_allocated_mpc_mesh_session_request(::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* mpc_mesh_session_request) {
+  clear_payload();
+  if (mpc_mesh_session_request) {
+    set_has_mpc_mesh_session_request();
+    _impl_.payload_.mpc_mesh_session_request_ = mpc_mesh_session_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_request)
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* CoordinatorNodeMessage::_internal_mutable_mpc_mesh_session_request() {
+  if (!_internal_has_mpc_mesh_session_request()) {
+    clear_payload();
+    set_has_mpc_mesh_session_request();
+    _impl_.payload_.mpc_mesh_session_request_ = CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.mpc_mesh_session_request_;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* CoordinatorNodeMessage::mutable_mpc_mesh_session_request() {
+  ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* _msg = _internal_mutable_mpc_mesh_session_request();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_request)
+  return _msg;
+}
+
+// .mpc_engine.proto.coordinator_node.MpcMeshSessionResponse mpc_mesh_session_response = 12;
+inline bool CoordinatorNodeMessage::_internal_has_mpc_mesh_session_response() const {
+  return payload_case() == kMpcMeshSessionResponse;
+}
+inline bool CoordinatorNodeMessage::has_mpc_mesh_session_response() const {
+  return _internal_has_mpc_mesh_session_response();
+}
+inline void CoordinatorNodeMessage::set_has_mpc_mesh_session_response() {
+  _impl_._oneof_case_[0] = kMpcMeshSessionResponse;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* CoordinatorNodeMessage::release_mpc_mesh_session_response() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_response)
+  if (_internal_has_mpc_mesh_session_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* temp = _impl_.payload_.mpc_mesh_session_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.mpc_mesh_session_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse& CoordinatorNodeMessage::_internal_mpc_mesh_session_response() const {
+  return _internal_has_mpc_mesh_session_response()
+      ? *_impl_.payload_.mpc_mesh_session_response_
+      : reinterpret_cast< ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse&>(::mpc_engine::proto::coordinator_node::_MpcMeshSessionResponse_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse& CoordinatorNodeMessage::mpc_mesh_session_response() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_response)
+  return _internal_mpc_mesh_session_response();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* CoordinatorNodeMessage::unsafe_arena_release_mpc_mesh_session_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_response)
+  if (_internal_has_mpc_mesh_session_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* temp = _impl_.payload_.mpc_mesh_session_response_;
+    _impl_.payload_.mpc_mesh_session_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void CoordinatorNodeMessage::unsafe_arena_set_allocated_mpc_mesh_session_response(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* mpc_mesh_session_response) {
+  clear_payload();
+  if (mpc_mesh_session_response) {
+    set_has_mpc_mesh_session_response();
+    _impl_.payload_.mpc_mesh_session_response_ = mpc_mesh_session_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_response)
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* CoordinatorNodeMessage::_internal_mutable_mpc_mesh_session_response() {
+  if (!_internal_has_mpc_mesh_session_response()) {
+    clear_payload();
+    set_has_mpc_mesh_session_response();
+    _impl_.payload_.mpc_mesh_session_response_ = CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.mpc_mesh_session_response_;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* CoordinatorNodeMessage::mutable_mpc_mesh_session_response() {
+  ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* _msg = _internal_mutable_mpc_mesh_session_response();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.CoordinatorNodeMessage.mpc_mesh_session_response)
+  return _msg;
+}
+
 inline bool CoordinatorNodeMessage::has_payload() const {
   return payload_case() != PAYLOAD_NOT_SET;
 }
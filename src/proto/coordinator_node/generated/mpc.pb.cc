@@ -0,0 +1,3819 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: mpc.proto
+
+#include "mpc.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace mpc_engine {
+namespace proto {
+namespace coordinator_node {
+PROTOBUF_CONSTEXPR MpcRoundRequest_PeerMessagesEntry_DoNotUse::MpcRoundRequest_PeerMessagesEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct MpcRoundRequest_PeerMessagesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcRoundRequest_PeerMessagesEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcRoundRequest_PeerMessagesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MpcRoundRequest_PeerMessagesEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcRoundRequest_PeerMessagesEntry_DoNotUseDefaultTypeInternal _MpcRoundRequest_PeerMessagesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR MpcRoundRequest::MpcRoundRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.player_ids_)*/{}
+  , /*decltype(_impl_._player_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.peer_messages_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_input_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.presignature_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.protocol_)*/0
+  , /*decltype(_impl_.round_)*/0u
+  , /*decltype(_impl_.player_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_rounds_)*/0u
+  , /*decltype(_impl_.threshold_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcRoundRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcRoundRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcRoundRequestDefaultTypeInternal() {}
+  union {
+    MpcRoundRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcRoundRequestDefaultTypeInternal _MpcRoundRequest_default_instance_;
+PROTOBUF_CONSTEXPR MpcRoundResponse::MpcRoundResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.output_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.player_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.round_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcRoundResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcRoundResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcRoundResponseDefaultTypeInternal() {}
+  union {
+    MpcRoundResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcRoundResponseDefaultTypeInternal _MpcRoundResponse_default_instance_;
+PROTOBUF_CONSTEXPR MpcSessionAbortRequest::MpcSessionAbortRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.reason_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcSessionAbortRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcSessionAbortRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcSessionAbortRequestDefaultTypeInternal() {}
+  union {
+    MpcSessionAbortRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcSessionAbortRequestDefaultTypeInternal _MpcSessionAbortRequest_default_instance_;
+PROTOBUF_CONSTEXPR MpcSessionAbortResponse::MpcSessionAbortResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcSessionAbortResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcSessionAbortResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcSessionAbortResponseDefaultTypeInternal() {}
+  union {
+    MpcSessionAbortResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcSessionAbortResponseDefaultTypeInternal _MpcSessionAbortResponse_default_instance_;
+PROTOBUF_CONSTEXPR MpcRoundBatchRequest::MpcRoundBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rounds_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcRoundBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcRoundBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcRoundBatchRequestDefaultTypeInternal() {}
+  union {
+    MpcRoundBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcRoundBatchRequestDefaultTypeInternal _MpcRoundBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR MpcRoundBatchResponse::MpcRoundBatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rounds_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcRoundBatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcRoundBatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcRoundBatchResponseDefaultTypeInternal() {}
+  union {
+    MpcRoundBatchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcRoundBatchResponseDefaultTypeInternal _MpcRoundBatchResponse_default_instance_;
+PROTOBUF_CONSTEXPR MpcMeshPeer::MpcMeshPeer(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.node_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.host_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.player_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.port_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcMeshPeerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcMeshPeerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcMeshPeerDefaultTypeInternal() {}
+  union {
+    MpcMeshPeer _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcMeshPeerDefaultTypeInternal _MpcMeshPeer_default_instance_;
+PROTOBUF_CONSTEXPR MpcMeshSessionRequest::MpcMeshSessionRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.peers_)*/{}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.session_)*/nullptr
+  , /*decltype(_impl_.round_timeout_ms_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcMeshSessionRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcMeshSessionRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcMeshSessionRequestDefaultTypeInternal() {}
+  union {
+    MpcMeshSessionRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcMeshSessionRequestDefaultTypeInternal _MpcMeshSessionRequest_default_instance_;
+PROTOBUF_CONSTEXPR MpcMeshSessionResponse::MpcMeshSessionResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.output_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.player_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.completed_rounds_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcMeshSessionResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcMeshSessionResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcMeshSessionResponseDefaultTypeInternal() {}
+  union {
+    MpcMeshSessionResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcMeshSessionResponseDefaultTypeInternal _MpcMeshSessionResponse_default_instance_;
+PROTOBUF_CONSTEXPR MpcPeerMessage::MpcPeerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.payload_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.from_player_)*/uint64_t{0u}
+  , /*decltype(_impl_.to_player_)*/uint64_t{0u}
+  , /*decltype(_impl_.round_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MpcPeerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MpcPeerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MpcPeerMessageDefaultTypeInternal() {}
+  union {
+    MpcPeerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MpcPeerMessageDefaultTypeInternal _MpcPeerMessage_default_instance_;
+}  // namespace coordinator_node
+}  // namespace proto
+}  // namespace mpc_engine
+static ::_pb::Metadata file_level_metadata_mpc_2eproto[11];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_mpc_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_mpc_2eproto = nullptr;
+
+const uint32_t TableStruct_mpc_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.protocol_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.round_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.total_rounds_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.key_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.player_ids_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.threshold_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.session_input_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.peer_messages_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundRequest, _impl_.presignature_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundResponse, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundResponse, _impl_.round_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundResponse, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundResponse, _impl_.output_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest, _impl_.reason_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse, _impl_.session_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest, _impl_.rounds_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse, _impl_.rounds_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshPeer, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshPeer, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshPeer, _impl_.node_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshPeer, _impl_.host_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshPeer, _impl_.port_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest, _impl_.session_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest, _impl_.peers_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest, _impl_.round_timeout_ms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse, _impl_.completed_rounds_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse, _impl_.output_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcPeerMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcPeerMessage, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcPeerMessage, _impl_.round_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcPeerMessage, _impl_.from_player_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcPeerMessage, _impl_.to_player_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::coordinator_node::MpcPeerMessage, _impl_.payload_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse)},
+  { 10, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcRoundRequest)},
+  { 28, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcRoundResponse)},
+  { 39, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest)},
+  { 48, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse)},
+  { 56, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest)},
+  { 64, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse)},
+  { 72, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcMeshPeer)},
+  { 82, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest)},
+  { 92, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse)},
+  { 103, -1, -1, sizeof(::mpc_engine::proto::coordinator_node::MpcPeerMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::mpc_engine::proto::coordinator_node::_MpcRoundRequest_PeerMessagesEntry_DoNotUse_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcRoundRequest_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcRoundResponse_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcSessionAbortRequest_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcSessionAbortResponse_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcRoundBatchRequest_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcRoundBatchResponse_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcMeshPeer_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcMeshSessionRequest_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcMeshSessionResponse_default_instance_._instance,
+  &::mpc_engine::proto::coordinator_node::_MpcPeerMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_mpc_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\tmpc.proto\022!mpc_engine.proto.coordinato"
+  "r_node\032\014common.proto\"\332\003\n\017MpcRoundRequest"
+  "\022@\n\006header\030\001 \001(\01320.mpc_engine.proto.coor"
+  "dinator_node.RequestHeader\022\022\n\nsession_id"
+  "\030\002 \001(\t\022@\n\010protocol\030\003 \001(\0162..mpc_engine.pr"
+  "oto.coordinator_node.MpcProtocol\022\r\n\005roun"
+  "d\030\004 \001(\r\022\024\n\014total_rounds\030\005 \001(\r\022\016\n\006key_id\030"
+  "\006 \001(\t\022\021\n\tplayer_id\030\007 \001(\004\022\022\n\nplayer_ids\030\010"
+  " \003(\004\022\021\n\tthreshold\030\t \001(\r\022\025\n\rsession_input"
+  "\030\n \001(\014\022[\n\rpeer_messages\030\013 \003(\0132D.mpc_engi"
+  "ne.proto.coordinator_node.MpcRoundReques"
+  "t.PeerMessagesEntry\022\027\n\017presignature_id\030\014"
+  " \001(\t\0323\n\021PeerMessagesEntry\022\013\n\003key\030\001 \001(\004\022\r"
+  "\n\005value\030\002 \001(\014:\0028\001\"\233\001\n\020MpcRoundResponse\022A"
+  "\n\006header\030\001 \001(\01321.mpc_engine.proto.coordi"
+  "nator_node.ResponseHeader\022\022\n\nsession_id\030"
+  "\002 \001(\t\022\r\n\005round\030\003 \001(\r\022\021\n\tplayer_id\030\004 \001(\004\022"
+  "\016\n\006output\030\005 \001(\014\"~\n\026MpcSessionAbortReques"
+  "t\022@\n\006header\030\001 \001(\01320.mpc_engine.proto.coo"
+  "rdinator_node.RequestHeader\022\022\n\nsession_i"
+  "d\030\002 \001(\t\022\016\n\006reason\030\003 \001(\t\"p\n\027MpcSessionAbo"
+  "rtResponse\022A\n\006header\030\001 \001(\01321.mpc_engine."
+  "proto.coordinator_node.ResponseHeader\022\022\n"
+  "\nsession_id\030\002 \001(\t\"\234\001\n\024MpcRoundBatchReque"
+  "st\022@\n\006header\030\001 \001(\01320.mpc_engine.proto.co"
+  "ordinator_node.RequestHeader\022B\n\006rounds\030\002"
+  " \003(\01322.mpc_engine.proto.coordinator_node"
+  ".MpcRoundRequest\"\237\001\n\025MpcRoundBatchRespon"
+  "se\022A\n\006header\030\001 \001(\01321.mpc_engine.proto.co"
+  "ordinator_node.ResponseHeader\022C\n\006rounds\030"
+  "\002 \003(\01323.mpc_engine.proto.coordinator_nod"
+  "e.MpcRoundResponse\"M\n\013MpcMeshPeer\022\021\n\tpla"
+  "yer_id\030\001 \001(\004\022\017\n\007node_id\030\002 \001(\t\022\014\n\004host\030\003 "
+  "\001(\t\022\014\n\004port\030\004 \001(\r\"\367\001\n\025MpcMeshSessionRequ"
+  "est\022@\n\006header\030\001 \001(\01320.mpc_engine.proto.c"
+  "oordinator_node.RequestHeader\022C\n\007session"
+  "\030\002 \001(\01322.mpc_engine.proto.coordinator_no"
+  "de.MpcRoundRequest\022=\n\005peers\030\003 \003(\0132..mpc_"
+  "engine.proto.coordinator_node.MpcMeshPee"
+  "r\022\030\n\020round_timeout_ms\030\004 \001(\r\"\254\001\n\026MpcMeshS"
+  "essionResponse\022A\n\006header\030\001 \001(\01321.mpc_eng"
+  "ine.proto.coordinator_node.ResponseHeade"
+  "r\022\022\n\nsession_id\030\002 \001(\t\022\021\n\tplayer_id\030\003 \001(\004"
+  "\022\030\n\020completed_rounds\030\004 \001(\r\022\016\n\006output\030\005 \001"
+  "(\014\"l\n\016MpcPeerMessage\022\022\n\nsession_id\030\001 \001(\t"
+  "\022\r\n\005round\030\002 \001(\r\022\023\n\013from_player\030\003 \001(\004\022\021\n\t"
+  "to_player\030\004 \001(\004\022\017\n\007payload\030\005 \001(\014*\313\001\n\013Mpc"
+  "Protocol\022\034\n\030MPC_PROTOCOL_UNSPECIFIED\020\000\022\027"
+  "\n\023MPC_PROTOCOL_KEYGEN\020\001\022\036\n\032MPC_PROTOCOL_"
+  "ECDSA_SIGNING\020\002\022\036\n\032MPC_PROTOCOL_EDDSA_SI"
+  "GNING\020\003\022\036\n\032MPC_PROTOCOL_ECDSA_PRESIGN\020\004\022"
+  "%\n!MPC_PROTOCOL_ECDSA_ONLINE_SIGNING\020\005b\006"
+  "proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_mpc_2eproto_deps[1] = {
+  &::descriptor_table_common_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_mpc_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_mpc_2eproto = {
+    false, false, 2086, descriptor_table_protodef_mpc_2eproto,
+    "mpc.proto",
+    &descriptor_table_mpc_2eproto_once, descriptor_table_mpc_2eproto_deps, 1, 11,
+    schemas, file_default_instances, TableStruct_mpc_2eproto::offsets,
+    file_level_metadata_mpc_2eproto, file_level_enum_descriptors_mpc_2eproto,
+    file_level_service_descriptors_mpc_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_mpc_2eproto_getter() {
+  return &descriptor_table_mpc_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_mpc_2eproto(&descriptor_table_mpc_2eproto);
+namespace mpc_engine {
+namespace proto {
+namespace coordinator_node {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MpcProtocol_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_mpc_2eproto);
+  return file_level_enum_descriptors_mpc_2eproto[0];
+}
+bool MpcProtocol_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+MpcRoundRequest_PeerMessagesEntry_DoNotUse::MpcRoundRequest_PeerMessagesEntry_DoNotUse() {}
+MpcRoundRequest_PeerMessagesEntry_DoNotUse::MpcRoundRequest_PeerMessagesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MpcRoundRequest_PeerMessagesEntry_DoNotUse::MergeFrom(const MpcRoundRequest_PeerMessagesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MpcRoundRequest_PeerMessagesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[0]);
+}
+
+// ===================================================================
+
+class MpcRoundRequest::_Internal {
+ public:
+  static const ::mpc_engine::proto::coordinator_node::RequestHeader& header(const MpcRoundRequest* msg);
+};
+
+const ::mpc_engine::proto::coordinator_node::RequestHeader&
+MpcRoundRequest::_Internal::header(const MpcRoundRequest* msg) {
+  return *msg->_impl_.header_;
+}
+void MpcRoundRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+MpcRoundRequest::MpcRoundRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &MpcRoundRequest::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+}
+MpcRoundRequest::MpcRoundRequest(const MpcRoundRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcRoundRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.player_ids_){from._impl_.player_ids_}
+    , /*decltype(_impl_._player_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_.peer_messages_)*/{}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.key_id_){}
+    , decltype(_impl_.session_input_){}
+    , decltype(_impl_.presignature_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.protocol_){}
+    , decltype(_impl_.round_){}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.total_rounds_){}
+    , decltype(_impl_.threshold_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.peer_messages_.MergeFrom(from._impl_.peer_messages_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key_id().empty()) {
+    _this->_impl_.key_id_.Set(from._internal_key_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.session_input_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_input_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_input().empty()) {
+    _this->_impl_.session_input_.Set(from._internal_session_input(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.presignature_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.presignature_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_presignature_id().empty()) {
+    _this->_impl_.presignature_id_.Set(from._internal_presignature_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::coordinator_node::RequestHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.protocol_, &from._impl_.protocol_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.threshold_) -
+    reinterpret_cast<char*>(&_impl_.protocol_)) + sizeof(_impl_.threshold_));
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+}
+
+inline void MpcRoundRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.player_ids_){arena}
+    , /*decltype(_impl_._player_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_.peer_messages_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.key_id_){}
+    , decltype(_impl_.session_input_){}
+    , decltype(_impl_.presignature_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.protocol_){0}
+    , decltype(_impl_.round_){0u}
+    , decltype(_impl_.player_id_){uint64_t{0u}}
+    , decltype(_impl_.total_rounds_){0u}
+    , decltype(_impl_.threshold_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.session_input_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_input_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.presignature_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.presignature_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MpcRoundRequest::~MpcRoundRequest() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcRoundRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.player_ids_.~RepeatedField();
+  _impl_.peer_messages_.Destruct();
+  _impl_.peer_messages_.~MapField();
+  _impl_.session_id_.Destroy();
+  _impl_.key_id_.Destroy();
+  _impl_.session_input_.Destroy();
+  _impl_.presignature_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void MpcRoundRequest::ArenaDtor(void* object) {
+  MpcRoundRequest* _this = reinterpret_cast< MpcRoundRequest* >(object);
+  _this->_impl_.peer_messages_.Destruct();
+}
+void MpcRoundRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcRoundRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.player_ids_.Clear();
+  _impl_.peer_messages_.Clear();
+  _impl_.session_id_.ClearToEmpty();
+  _impl_.key_id_.ClearToEmpty();
+  _impl_.session_input_.ClearToEmpty();
+  _impl_.presignature_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.protocol_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.threshold_) -
+      reinterpret_cast<char*>(&_impl_.protocol_)) + sizeof(_impl_.threshold_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcRoundRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string session_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcRoundRequest.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcProtocol protocol = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_protocol(static_cast<::mpc_engine::proto::coordinator_node::MpcProtocol>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 round = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 total_rounds = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.total_rounds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string key_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_key_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcRoundRequest.key_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 player_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 player_ids = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_player_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_player_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 threshold = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes session_input = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_session_input();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // map<uint64, bytes> peer_messages = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.peer_messages_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<90>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string presignature_id = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          auto str = _internal_mutable_presignature_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcRoundRequest.presignature_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcRoundRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcRoundRequest.session_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_session_id(), target);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcProtocol protocol = 3;
+  if (this->_internal_protocol() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_protocol(), target);
+  }
+
+  // uint32 round = 4;
+  if (this->_internal_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_round(), target);
+  }
+
+  // uint32 total_rounds = 5;
+  if (this->_internal_total_rounds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_total_rounds(), target);
+  }
+
+  // string key_id = 6;
+  if (!this->_internal_key_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key_id().data(), static_cast<int>(this->_internal_key_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcRoundRequest.key_id");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_key_id(), target);
+  }
+
+  // uint64 player_id = 7;
+  if (this->_internal_player_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_player_id(), target);
+  }
+
+  // repeated uint64 player_ids = 8;
+  {
+    int byte_size = _impl_._player_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          8, _internal_player_ids(), byte_size, target);
+    }
+  }
+
+  // uint32 threshold = 9;
+  if (this->_internal_threshold() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_threshold(), target);
+  }
+
+  // bytes session_input = 10;
+  if (!this->_internal_session_input().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        10, this->_internal_session_input(), target);
+  }
+
+  // map<uint64, bytes> peer_messages = 11;
+  if (!this->_internal_peer_messages().empty()) {
+    using MapType = ::_pb::Map<uint64_t, std::string>;
+    using WireHelper = MpcRoundRequest_PeerMessagesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_peer_messages();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(11, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(11, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // string presignature_id = 12;
+  if (!this->_internal_presignature_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_presignature_id().data(), static_cast<int>(this->_internal_presignature_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcRoundRequest.presignature_id");
+    target = stream->WriteStringMaybeAliased(
+        12, this->_internal_presignature_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+  return target;
+}
+
+size_t MpcRoundRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 player_ids = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.player_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._player_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // map<uint64, bytes> peer_messages = 11;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_peer_messages_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint64_t, std::string >::const_iterator
+      it = this->_internal_peer_messages().begin();
+      it != this->_internal_peer_messages().end(); ++it) {
+    total_size += MpcRoundRequest_PeerMessagesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_id());
+  }
+
+  // string key_id = 6;
+  if (!this->_internal_key_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key_id());
+  }
+
+  // bytes session_input = 10;
+  if (!this->_internal_session_input().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_session_input());
+  }
+
+  // string presignature_id = 12;
+  if (!this->_internal_presignature_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_presignature_id());
+  }
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcProtocol protocol = 3;
+  if (this->_internal_protocol() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_protocol());
+  }
+
+  // uint32 round = 4;
+  if (this->_internal_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_round());
+  }
+
+  // uint64 player_id = 7;
+  if (this->_internal_player_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_player_id());
+  }
+
+  // uint32 total_rounds = 5;
+  if (this->_internal_total_rounds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_total_rounds());
+  }
+
+  // uint32 threshold = 9;
+  if (this->_internal_threshold() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_threshold());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcRoundRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcRoundRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcRoundRequest::GetClassData() const { return &_class_data_; }
+
+
+void MpcRoundRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcRoundRequest*>(&to_msg);
+  auto& from = static_cast<const MpcRoundRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.player_ids_.MergeFrom(from._impl_.player_ids_);
+  _this->_impl_.peer_messages_.MergeFrom(from._impl_.peer_messages_);
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
+  }
+  if (!from._internal_key_id().empty()) {
+    _this->_internal_set_key_id(from._internal_key_id());
+  }
+  if (!from._internal_session_input().empty()) {
+    _this->_internal_set_session_input(from._internal_session_input());
+  }
+  if (!from._internal_presignature_id().empty()) {
+    _this->_internal_set_presignature_id(from._internal_presignature_id());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::coordinator_node::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_protocol() != 0) {
+    _this->_internal_set_protocol(from._internal_protocol());
+  }
+  if (from._internal_round() != 0) {
+    _this->_internal_set_round(from._internal_round());
+  }
+  if (from._internal_player_id() != 0) {
+    _this->_internal_set_player_id(from._internal_player_id());
+  }
+  if (from._internal_total_rounds() != 0) {
+    _this->_internal_set_total_rounds(from._internal_total_rounds());
+  }
+  if (from._internal_threshold() != 0) {
+    _this->_internal_set_threshold(from._internal_threshold());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcRoundRequest::CopyFrom(const MpcRoundRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcRoundRequest::IsInitialized() const {
+  return true;
+}
+
+void MpcRoundRequest::InternalSwap(MpcRoundRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.player_ids_.InternalSwap(&other->_impl_.player_ids_);
+  _impl_.peer_messages_.InternalSwap(&other->_impl_.peer_messages_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_id_, lhs_arena,
+      &other->_impl_.key_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_input_, lhs_arena,
+      &other->_impl_.session_input_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.presignature_id_, lhs_arena,
+      &other->_impl_.presignature_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MpcRoundRequest, _impl_.threshold_)
+      + sizeof(MpcRoundRequest::_impl_.threshold_)
+      - PROTOBUF_FIELD_OFFSET(MpcRoundRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcRoundRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[1]);
+}
+
+// ===================================================================
+
+class MpcRoundResponse::_Internal {
+ public:
+  static const ::mpc_engine::proto::coordinator_node::ResponseHeader& header(const MpcRoundResponse* msg);
+};
+
+const ::mpc_engine::proto::coordinator_node::ResponseHeader&
+MpcRoundResponse::_Internal::header(const MpcRoundResponse* msg) {
+  return *msg->_impl_.header_;
+}
+void MpcRoundResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+MpcRoundResponse::MpcRoundResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+}
+MpcRoundResponse::MpcRoundResponse(const MpcRoundResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcRoundResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.output_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.round_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.output_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_output().empty()) {
+    _this->_impl_.output_.Set(from._internal_output(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::coordinator_node::ResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.player_id_, &from._impl_.player_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.round_) -
+    reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.round_));
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+}
+
+inline void MpcRoundResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.output_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.player_id_){uint64_t{0u}}
+    , decltype(_impl_.round_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.output_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MpcRoundResponse::~MpcRoundResponse() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcRoundResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_id_.Destroy();
+  _impl_.output_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void MpcRoundResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcRoundResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_id_.ClearToEmpty();
+  _impl_.output_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.player_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.round_) -
+      reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.round_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcRoundResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string session_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcRoundResponse.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 round = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 player_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes output = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_output();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcRoundResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcRoundResponse.session_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_session_id(), target);
+  }
+
+  // uint32 round = 3;
+  if (this->_internal_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_round(), target);
+  }
+
+  // uint64 player_id = 4;
+  if (this->_internal_player_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_player_id(), target);
+  }
+
+  // bytes output = 5;
+  if (!this->_internal_output().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_output(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+  return target;
+}
+
+size_t MpcRoundResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_id());
+  }
+
+  // bytes output = 5;
+  if (!this->_internal_output().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_output());
+  }
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint64 player_id = 4;
+  if (this->_internal_player_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_player_id());
+  }
+
+  // uint32 round = 3;
+  if (this->_internal_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_round());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcRoundResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcRoundResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcRoundResponse::GetClassData() const { return &_class_data_; }
+
+
+void MpcRoundResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcRoundResponse*>(&to_msg);
+  auto& from = static_cast<const MpcRoundResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
+  }
+  if (!from._internal_output().empty()) {
+    _this->_internal_set_output(from._internal_output());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::coordinator_node::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_player_id() != 0) {
+    _this->_internal_set_player_id(from._internal_player_id());
+  }
+  if (from._internal_round() != 0) {
+    _this->_internal_set_round(from._internal_round());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcRoundResponse::CopyFrom(const MpcRoundResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcRoundResponse::IsInitialized() const {
+  return true;
+}
+
+void MpcRoundResponse::InternalSwap(MpcRoundResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.output_, lhs_arena,
+      &other->_impl_.output_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MpcRoundResponse, _impl_.round_)
+      + sizeof(MpcRoundResponse::_impl_.round_)
+      - PROTOBUF_FIELD_OFFSET(MpcRoundResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcRoundResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[2]);
+}
+
+// ===================================================================
+
+class MpcSessionAbortRequest::_Internal {
+ public:
+  static const ::mpc_engine::proto::coordinator_node::RequestHeader& header(const MpcSessionAbortRequest* msg);
+};
+
+const ::mpc_engine::proto::coordinator_node::RequestHeader&
+MpcSessionAbortRequest::_Internal::header(const MpcSessionAbortRequest* msg) {
+  return *msg->_impl_.header_;
+}
+void MpcSessionAbortRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+MpcSessionAbortRequest::MpcSessionAbortRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+}
+MpcSessionAbortRequest::MpcSessionAbortRequest(const MpcSessionAbortRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcSessionAbortRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.reason_){}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.reason_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reason_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_reason().empty()) {
+    _this->_impl_.reason_.Set(from._internal_reason(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::coordinator_node::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+}
+
+inline void MpcSessionAbortRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.reason_){}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.reason_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reason_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MpcSessionAbortRequest::~MpcSessionAbortRequest() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcSessionAbortRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_id_.Destroy();
+  _impl_.reason_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void MpcSessionAbortRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcSessionAbortRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_id_.ClearToEmpty();
+  _impl_.reason_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcSessionAbortRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string session_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string reason = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_reason();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.reason"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcSessionAbortRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.session_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_session_id(), target);
+  }
+
+  // string reason = 3;
+  if (!this->_internal_reason().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_reason().data(), static_cast<int>(this->_internal_reason().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.reason");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_reason(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+  return target;
+}
+
+size_t MpcSessionAbortRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_id());
+  }
+
+  // string reason = 3;
+  if (!this->_internal_reason().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_reason());
+  }
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcSessionAbortRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcSessionAbortRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcSessionAbortRequest::GetClassData() const { return &_class_data_; }
+
+
+void MpcSessionAbortRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcSessionAbortRequest*>(&to_msg);
+  auto& from = static_cast<const MpcSessionAbortRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
+  }
+  if (!from._internal_reason().empty()) {
+    _this->_internal_set_reason(from._internal_reason());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::coordinator_node::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcSessionAbortRequest::CopyFrom(const MpcSessionAbortRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcSessionAbortRequest::IsInitialized() const {
+  return true;
+}
+
+void MpcSessionAbortRequest::InternalSwap(MpcSessionAbortRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reason_, lhs_arena,
+      &other->_impl_.reason_, rhs_arena
+  );
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcSessionAbortRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[3]);
+}
+
+// ===================================================================
+
+class MpcSessionAbortResponse::_Internal {
+ public:
+  static const ::mpc_engine::proto::coordinator_node::ResponseHeader& header(const MpcSessionAbortResponse* msg);
+};
+
+const ::mpc_engine::proto::coordinator_node::ResponseHeader&
+MpcSessionAbortResponse::_Internal::header(const MpcSessionAbortResponse* msg) {
+  return *msg->_impl_.header_;
+}
+void MpcSessionAbortResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+MpcSessionAbortResponse::MpcSessionAbortResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+}
+MpcSessionAbortResponse::MpcSessionAbortResponse(const MpcSessionAbortResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcSessionAbortResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::coordinator_node::ResponseHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+}
+
+inline void MpcSessionAbortResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MpcSessionAbortResponse::~MpcSessionAbortResponse() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcSessionAbortResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void MpcSessionAbortResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcSessionAbortResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcSessionAbortResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string session_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcSessionAbortResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.session_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_session_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+  return target;
+}
+
+size_t MpcSessionAbortResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_id());
+  }
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcSessionAbortResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcSessionAbortResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcSessionAbortResponse::GetClassData() const { return &_class_data_; }
+
+
+void MpcSessionAbortResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcSessionAbortResponse*>(&to_msg);
+  auto& from = static_cast<const MpcSessionAbortResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::coordinator_node::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcSessionAbortResponse::CopyFrom(const MpcSessionAbortResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcSessionAbortResponse::IsInitialized() const {
+  return true;
+}
+
+void MpcSessionAbortResponse::InternalSwap(MpcSessionAbortResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcSessionAbortResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[4]);
+}
+
+// ===================================================================
+
+class MpcRoundBatchRequest::_Internal {
+ public:
+  static const ::mpc_engine::proto::coordinator_node::RequestHeader& header(const MpcRoundBatchRequest* msg);
+};
+
+const ::mpc_engine::proto::coordinator_node::RequestHeader&
+MpcRoundBatchRequest::_Internal::header(const MpcRoundBatchRequest* msg) {
+  return *msg->_impl_.header_;
+}
+void MpcRoundBatchRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+MpcRoundBatchRequest::MpcRoundBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+}
+MpcRoundBatchRequest::MpcRoundBatchRequest(const MpcRoundBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcRoundBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rounds_){from._impl_.rounds_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::coordinator_node::RequestHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+}
+
+inline void MpcRoundBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rounds_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MpcRoundBatchRequest::~MpcRoundBatchRequest() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcRoundBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rounds_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void MpcRoundBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcRoundBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rounds_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcRoundBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .mpc_engine.proto.coordinator_node.MpcRoundRequest rounds = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rounds(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcRoundBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .mpc_engine.proto.coordinator_node.MpcRoundRequest rounds = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rounds_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rounds(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+  return target;
+}
+
+size_t MpcRoundBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .mpc_engine.proto.coordinator_node.MpcRoundRequest rounds = 2;
+  total_size += 1UL * this->_internal_rounds_size();
+  for (const auto& msg : this->_impl_.rounds_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcRoundBatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcRoundBatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcRoundBatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void MpcRoundBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcRoundBatchRequest*>(&to_msg);
+  auto& from = static_cast<const MpcRoundBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rounds_.MergeFrom(from._impl_.rounds_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::coordinator_node::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcRoundBatchRequest::CopyFrom(const MpcRoundBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcRoundBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void MpcRoundBatchRequest::InternalSwap(MpcRoundBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rounds_.InternalSwap(&other->_impl_.rounds_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcRoundBatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[5]);
+}
+
+// ===================================================================
+
+class MpcRoundBatchResponse::_Internal {
+ public:
+  static const ::mpc_engine::proto::coordinator_node::ResponseHeader& header(const MpcRoundBatchResponse* msg);
+};
+
+const ::mpc_engine::proto::coordinator_node::ResponseHeader&
+MpcRoundBatchResponse::_Internal::header(const MpcRoundBatchResponse* msg) {
+  return *msg->_impl_.header_;
+}
+void MpcRoundBatchResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+MpcRoundBatchResponse::MpcRoundBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+}
+MpcRoundBatchResponse::MpcRoundBatchResponse(const MpcRoundBatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcRoundBatchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rounds_){from._impl_.rounds_}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::coordinator_node::ResponseHeader(*from._impl_.header_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+}
+
+inline void MpcRoundBatchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rounds_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MpcRoundBatchResponse::~MpcRoundBatchResponse() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcRoundBatchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rounds_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void MpcRoundBatchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcRoundBatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rounds_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcRoundBatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .mpc_engine.proto.coordinator_node.MpcRoundResponse rounds = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rounds(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcRoundBatchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .mpc_engine.proto.coordinator_node.MpcRoundResponse rounds = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rounds_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rounds(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+  return target;
+}
+
+size_t MpcRoundBatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .mpc_engine.proto.coordinator_node.MpcRoundResponse rounds = 2;
+  total_size += 1UL * this->_internal_rounds_size();
+  for (const auto& msg : this->_impl_.rounds_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcRoundBatchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcRoundBatchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcRoundBatchResponse::GetClassData() const { return &_class_data_; }
+
+
+void MpcRoundBatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcRoundBatchResponse*>(&to_msg);
+  auto& from = static_cast<const MpcRoundBatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rounds_.MergeFrom(from._impl_.rounds_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::coordinator_node::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcRoundBatchResponse::CopyFrom(const MpcRoundBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcRoundBatchResponse::IsInitialized() const {
+  return true;
+}
+
+void MpcRoundBatchResponse::InternalSwap(MpcRoundBatchResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rounds_.InternalSwap(&other->_impl_.rounds_);
+  swap(_impl_.header_, other->_impl_.header_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcRoundBatchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[6]);
+}
+
+// ===================================================================
+
+class MpcMeshPeer::_Internal {
+ public:
+};
+
+MpcMeshPeer::MpcMeshPeer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+}
+MpcMeshPeer::MpcMeshPeer(const MpcMeshPeer& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcMeshPeer* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_id_){}
+    , decltype(_impl_.host_){}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.port_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_node_id().empty()) {
+    _this->_impl_.node_id_.Set(from._internal_node_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.host_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.host_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_host().empty()) {
+    _this->_impl_.host_.Set(from._internal_host(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.player_id_, &from._impl_.player_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port_) -
+    reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.port_));
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+}
+
+inline void MpcMeshPeer::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_id_){}
+    , decltype(_impl_.host_){}
+    , decltype(_impl_.player_id_){uint64_t{0u}}
+    , decltype(_impl_.port_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.node_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.host_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.host_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MpcMeshPeer::~MpcMeshPeer() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcMeshPeer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.node_id_.Destroy();
+  _impl_.host_.Destroy();
+}
+
+void MpcMeshPeer::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcMeshPeer::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.node_id_.ClearToEmpty();
+  _impl_.host_.ClearToEmpty();
+  ::memset(&_impl_.player_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.port_) -
+      reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.port_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcMeshPeer::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 player_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string node_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_node_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcMeshPeer.node_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string host = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_host();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcMeshPeer.host"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 port = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcMeshPeer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 player_id = 1;
+  if (this->_internal_player_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_player_id(), target);
+  }
+
+  // string node_id = 2;
+  if (!this->_internal_node_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_node_id().data(), static_cast<int>(this->_internal_node_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcMeshPeer.node_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_node_id(), target);
+  }
+
+  // string host = 3;
+  if (!this->_internal_host().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_host().data(), static_cast<int>(this->_internal_host().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcMeshPeer.host");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_host(), target);
+  }
+
+  // uint32 port = 4;
+  if (this->_internal_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_port(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+  return target;
+}
+
+size_t MpcMeshPeer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string node_id = 2;
+  if (!this->_internal_node_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_node_id());
+  }
+
+  // string host = 3;
+  if (!this->_internal_host().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_host());
+  }
+
+  // uint64 player_id = 1;
+  if (this->_internal_player_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_player_id());
+  }
+
+  // uint32 port = 4;
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_port());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcMeshPeer::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcMeshPeer::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcMeshPeer::GetClassData() const { return &_class_data_; }
+
+
+void MpcMeshPeer::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcMeshPeer*>(&to_msg);
+  auto& from = static_cast<const MpcMeshPeer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_node_id().empty()) {
+    _this->_internal_set_node_id(from._internal_node_id());
+  }
+  if (!from._internal_host().empty()) {
+    _this->_internal_set_host(from._internal_host());
+  }
+  if (from._internal_player_id() != 0) {
+    _this->_internal_set_player_id(from._internal_player_id());
+  }
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcMeshPeer::CopyFrom(const MpcMeshPeer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcMeshPeer::IsInitialized() const {
+  return true;
+}
+
+void MpcMeshPeer::InternalSwap(MpcMeshPeer* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.node_id_, lhs_arena,
+      &other->_impl_.node_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.host_, lhs_arena,
+      &other->_impl_.host_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MpcMeshPeer, _impl_.port_)
+      + sizeof(MpcMeshPeer::_impl_.port_)
+      - PROTOBUF_FIELD_OFFSET(MpcMeshPeer, _impl_.player_id_)>(
+          reinterpret_cast<char*>(&_impl_.player_id_),
+          reinterpret_cast<char*>(&other->_impl_.player_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcMeshPeer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[7]);
+}
+
+// ===================================================================
+
+class MpcMeshSessionRequest::_Internal {
+ public:
+  static const ::mpc_engine::proto::coordinator_node::RequestHeader& header(const MpcMeshSessionRequest* msg);
+  static const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& session(const MpcMeshSessionRequest* msg);
+};
+
+const ::mpc_engine::proto::coordinator_node::RequestHeader&
+MpcMeshSessionRequest::_Internal::header(const MpcMeshSessionRequest* msg) {
+  return *msg->_impl_.header_;
+}
+const ::mpc_engine::proto::coordinator_node::MpcRoundRequest&
+MpcMeshSessionRequest::_Internal::session(const MpcMeshSessionRequest* msg) {
+  return *msg->_impl_.session_;
+}
+void MpcMeshSessionRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+MpcMeshSessionRequest::MpcMeshSessionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+}
+MpcMeshSessionRequest::MpcMeshSessionRequest(const MpcMeshSessionRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcMeshSessionRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.peers_){from._impl_.peers_}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.session_){nullptr}
+    , decltype(_impl_.round_timeout_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::coordinator_node::RequestHeader(*from._impl_.header_);
+  }
+  if (from._internal_has_session()) {
+    _this->_impl_.session_ = new ::mpc_engine::proto::coordinator_node::MpcRoundRequest(*from._impl_.session_);
+  }
+  _this->_impl_.round_timeout_ms_ = from._impl_.round_timeout_ms_;
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+}
+
+inline void MpcMeshSessionRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.peers_){arena}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.session_){nullptr}
+    , decltype(_impl_.round_timeout_ms_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MpcMeshSessionRequest::~MpcMeshSessionRequest() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcMeshSessionRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.peers_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.header_;
+  if (this != internal_default_instance()) delete _impl_.session_;
+}
+
+void MpcMeshSessionRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcMeshSessionRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.peers_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.session_ != nullptr) {
+    delete _impl_.session_;
+  }
+  _impl_.session_ = nullptr;
+  _impl_.round_timeout_ms_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcMeshSessionRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.coordinator_node.MpcRoundRequest session = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_session(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .mpc_engine.proto.coordinator_node.MpcMeshPeer peers = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_peers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 round_timeout_ms = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.round_timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcMeshSessionRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundRequest session = 2;
+  if (this->_internal_has_session()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::session(this),
+        _Internal::session(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .mpc_engine.proto.coordinator_node.MpcMeshPeer peers = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_peers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_peers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 round_timeout_ms = 4;
+  if (this->_internal_round_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_round_timeout_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+  return target;
+}
+
+size_t MpcMeshSessionRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .mpc_engine.proto.coordinator_node.MpcMeshPeer peers = 3;
+  total_size += 1UL * this->_internal_peers_size();
+  for (const auto& msg : this->_impl_.peers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundRequest session = 2;
+  if (this->_internal_has_session()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.session_);
+  }
+
+  // uint32 round_timeout_ms = 4;
+  if (this->_internal_round_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_round_timeout_ms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcMeshSessionRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcMeshSessionRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcMeshSessionRequest::GetClassData() const { return &_class_data_; }
+
+
+void MpcMeshSessionRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcMeshSessionRequest*>(&to_msg);
+  auto& from = static_cast<const MpcMeshSessionRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.peers_.MergeFrom(from._impl_.peers_);
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::coordinator_node::RequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_has_session()) {
+    _this->_internal_mutable_session()->::mpc_engine::proto::coordinator_node::MpcRoundRequest::MergeFrom(
+        from._internal_session());
+  }
+  if (from._internal_round_timeout_ms() != 0) {
+    _this->_internal_set_round_timeout_ms(from._internal_round_timeout_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcMeshSessionRequest::CopyFrom(const MpcMeshSessionRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcMeshSessionRequest::IsInitialized() const {
+  return true;
+}
+
+void MpcMeshSessionRequest::InternalSwap(MpcMeshSessionRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.peers_.InternalSwap(&other->_impl_.peers_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MpcMeshSessionRequest, _impl_.round_timeout_ms_)
+      + sizeof(MpcMeshSessionRequest::_impl_.round_timeout_ms_)
+      - PROTOBUF_FIELD_OFFSET(MpcMeshSessionRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcMeshSessionRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[8]);
+}
+
+// ===================================================================
+
+class MpcMeshSessionResponse::_Internal {
+ public:
+  static const ::mpc_engine::proto::coordinator_node::ResponseHeader& header(const MpcMeshSessionResponse* msg);
+};
+
+const ::mpc_engine::proto::coordinator_node::ResponseHeader&
+MpcMeshSessionResponse::_Internal::header(const MpcMeshSessionResponse* msg) {
+  return *msg->_impl_.header_;
+}
+void MpcMeshSessionResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+MpcMeshSessionResponse::MpcMeshSessionResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+}
+MpcMeshSessionResponse::MpcMeshSessionResponse(const MpcMeshSessionResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcMeshSessionResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.output_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.completed_rounds_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.output_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_output().empty()) {
+    _this->_impl_.output_.Set(from._internal_output(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::coordinator_node::ResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.player_id_, &from._impl_.player_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.completed_rounds_) -
+    reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.completed_rounds_));
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+}
+
+inline void MpcMeshSessionResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.output_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.player_id_){uint64_t{0u}}
+    , decltype(_impl_.completed_rounds_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.output_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.output_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MpcMeshSessionResponse::~MpcMeshSessionResponse() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcMeshSessionResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_id_.Destroy();
+  _impl_.output_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void MpcMeshSessionResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcMeshSessionResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_id_.ClearToEmpty();
+  _impl_.output_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.player_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.completed_rounds_) -
+      reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.completed_rounds_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcMeshSessionResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string session_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 player_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 completed_rounds = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.completed_rounds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes output = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_output();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcMeshSessionResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.session_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_session_id(), target);
+  }
+
+  // uint64 player_id = 3;
+  if (this->_internal_player_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_player_id(), target);
+  }
+
+  // uint32 completed_rounds = 4;
+  if (this->_internal_completed_rounds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_completed_rounds(), target);
+  }
+
+  // bytes output = 5;
+  if (!this->_internal_output().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_output(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+  return target;
+}
+
+size_t MpcMeshSessionResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session_id = 2;
+  if (!this->_internal_session_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_id());
+  }
+
+  // bytes output = 5;
+  if (!this->_internal_output().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_output());
+  }
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint64 player_id = 3;
+  if (this->_internal_player_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_player_id());
+  }
+
+  // uint32 completed_rounds = 4;
+  if (this->_internal_completed_rounds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_completed_rounds());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcMeshSessionResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcMeshSessionResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcMeshSessionResponse::GetClassData() const { return &_class_data_; }
+
+
+void MpcMeshSessionResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcMeshSessionResponse*>(&to_msg);
+  auto& from = static_cast<const MpcMeshSessionResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
+  }
+  if (!from._internal_output().empty()) {
+    _this->_internal_set_output(from._internal_output());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::coordinator_node::ResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_player_id() != 0) {
+    _this->_internal_set_player_id(from._internal_player_id());
+  }
+  if (from._internal_completed_rounds() != 0) {
+    _this->_internal_set_completed_rounds(from._internal_completed_rounds());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcMeshSessionResponse::CopyFrom(const MpcMeshSessionResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcMeshSessionResponse::IsInitialized() const {
+  return true;
+}
+
+void MpcMeshSessionResponse::InternalSwap(MpcMeshSessionResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.output_, lhs_arena,
+      &other->_impl_.output_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MpcMeshSessionResponse, _impl_.completed_rounds_)
+      + sizeof(MpcMeshSessionResponse::_impl_.completed_rounds_)
+      - PROTOBUF_FIELD_OFFSET(MpcMeshSessionResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcMeshSessionResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[9]);
+}
+
+// ===================================================================
+
+class MpcPeerMessage::_Internal {
+ public:
+};
+
+MpcPeerMessage::MpcPeerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+}
+MpcPeerMessage::MpcPeerMessage(const MpcPeerMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MpcPeerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.from_player_){}
+    , decltype(_impl_.to_player_){}
+    , decltype(_impl_.round_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session_id().empty()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_payload().empty()) {
+    _this->_impl_.payload_.Set(from._internal_payload(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.from_player_, &from._impl_.from_player_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.round_) -
+    reinterpret_cast<char*>(&_impl_.from_player_)) + sizeof(_impl_.round_));
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+}
+
+inline void MpcPeerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_id_){}
+    , decltype(_impl_.payload_){}
+    , decltype(_impl_.from_player_){uint64_t{0u}}
+    , decltype(_impl_.to_player_){uint64_t{0u}}
+    , decltype(_impl_.round_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.payload_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MpcPeerMessage::~MpcPeerMessage() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MpcPeerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_id_.Destroy();
+  _impl_.payload_.Destroy();
+}
+
+void MpcPeerMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MpcPeerMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_id_.ClearToEmpty();
+  _impl_.payload_.ClearToEmpty();
+  ::memset(&_impl_.from_player_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.round_) -
+      reinterpret_cast<char*>(&_impl_.from_player_)) + sizeof(_impl_.round_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MpcPeerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string session_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.coordinator_node.MpcPeerMessage.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 round = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.round_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 from_player = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.from_player_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 to_player = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.to_player_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes payload = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_payload();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MpcPeerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string session_id = 1;
+  if (!this->_internal_session_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.coordinator_node.MpcPeerMessage.session_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_session_id(), target);
+  }
+
+  // uint32 round = 2;
+  if (this->_internal_round() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_round(), target);
+  }
+
+  // uint64 from_player = 3;
+  if (this->_internal_from_player() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_from_player(), target);
+  }
+
+  // uint64 to_player = 4;
+  if (this->_internal_to_player() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_to_player(), target);
+  }
+
+  // bytes payload = 5;
+  if (!this->_internal_payload().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_payload(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+  return target;
+}
+
+size_t MpcPeerMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session_id = 1;
+  if (!this->_internal_session_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session_id());
+  }
+
+  // bytes payload = 5;
+  if (!this->_internal_payload().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_payload());
+  }
+
+  // uint64 from_player = 3;
+  if (this->_internal_from_player() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from_player());
+  }
+
+  // uint64 to_player = 4;
+  if (this->_internal_to_player() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_to_player());
+  }
+
+  // uint32 round = 2;
+  if (this->_internal_round() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_round());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MpcPeerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MpcPeerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MpcPeerMessage::GetClassData() const { return &_class_data_; }
+
+
+void MpcPeerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MpcPeerMessage*>(&to_msg);
+  auto& from = static_cast<const MpcPeerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session_id().empty()) {
+    _this->_internal_set_session_id(from._internal_session_id());
+  }
+  if (!from._internal_payload().empty()) {
+    _this->_internal_set_payload(from._internal_payload());
+  }
+  if (from._internal_from_player() != 0) {
+    _this->_internal_set_from_player(from._internal_from_player());
+  }
+  if (from._internal_to_player() != 0) {
+    _this->_internal_set_to_player(from._internal_to_player());
+  }
+  if (from._internal_round() != 0) {
+    _this->_internal_set_round(from._internal_round());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MpcPeerMessage::CopyFrom(const MpcPeerMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MpcPeerMessage::IsInitialized() const {
+  return true;
+}
+
+void MpcPeerMessage::InternalSwap(MpcPeerMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.payload_, lhs_arena,
+      &other->_impl_.payload_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MpcPeerMessage, _impl_.round_)
+      + sizeof(MpcPeerMessage::_impl_.round_)
+      - PROTOBUF_FIELD_OFFSET(MpcPeerMessage, _impl_.from_player_)>(
+          reinterpret_cast<char*>(&_impl_.from_player_),
+          reinterpret_cast<char*>(&other->_impl_.from_player_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MpcPeerMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_mpc_2eproto_getter, &descriptor_table_mpc_2eproto_once,
+      file_level_metadata_mpc_2eproto[10]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace coordinator_node
+}  // namespace proto
+}  // namespace mpc_engine
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcRoundRequest*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcRoundRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcRoundRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcRoundResponse*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcRoundResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcRoundResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcMeshPeer*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcMeshPeer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcMeshPeer >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::coordinator_node::MpcPeerMessage*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::coordinator_node::MpcPeerMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::coordinator_node::MpcPeerMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,4335 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: mpc.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_mpc_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_mpc_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "common.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_mpc_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_mpc_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_mpc_2eproto;
+namespace mpc_engine {
+namespace proto {
+namespace coordinator_node {
+class MpcMeshPeer;
+struct MpcMeshPeerDefaultTypeInternal;
+extern MpcMeshPeerDefaultTypeInternal _MpcMeshPeer_default_instance_;
+class MpcMeshSessionRequest;
+struct MpcMeshSessionRequestDefaultTypeInternal;
+extern MpcMeshSessionRequestDefaultTypeInternal _MpcMeshSessionRequest_default_instance_;
+class MpcMeshSessionResponse;
+struct MpcMeshSessionResponseDefaultTypeInternal;
+extern MpcMeshSessionResponseDefaultTypeInternal _MpcMeshSessionResponse_default_instance_;
+class MpcPeerMessage;
+struct MpcPeerMessageDefaultTypeInternal;
+extern MpcPeerMessageDefaultTypeInternal _MpcPeerMessage_default_instance_;
+class MpcRoundBatchRequest;
+struct MpcRoundBatchRequestDefaultTypeInternal;
+extern MpcRoundBatchRequestDefaultTypeInternal _MpcRoundBatchRequest_default_instance_;
+class MpcRoundBatchResponse;
+struct MpcRoundBatchResponseDefaultTypeInternal;
+extern MpcRoundBatchResponseDefaultTypeInternal _MpcRoundBatchResponse_default_instance_;
+class MpcRoundRequest;
+struct MpcRoundRequestDefaultTypeInternal;
+extern MpcRoundRequestDefaultTypeInternal _MpcRoundRequest_default_instance_;
+class MpcRoundRequest_PeerMessagesEntry_DoNotUse;
+struct MpcRoundRequest_PeerMessagesEntry_DoNotUseDefaultTypeInternal;
+extern MpcRoundRequest_PeerMessagesEntry_DoNotUseDefaultTypeInternal _MpcRoundRequest_PeerMessagesEntry_DoNotUse_default_instance_;
+class MpcRoundResponse;
+struct MpcRoundResponseDefaultTypeInternal;
+extern MpcRoundResponseDefaultTypeInternal _MpcRoundResponse_default_instance_;
+class MpcSessionAbortRequest;
+struct MpcSessionAbortRequestDefaultTypeInternal;
+extern MpcSessionAbortRequestDefaultTypeInternal _MpcSessionAbortRequest_default_instance_;
+class MpcSessionAbortResponse;
+struct MpcSessionAbortResponseDefaultTypeInternal;
+extern MpcSessionAbortResponseDefaultTypeInternal _MpcSessionAbortResponse_default_instance_;
+}  // namespace coordinator_node
+}  // namespace proto
+}  // namespace mpc_engine
+PROTOBUF_NAMESPACE_OPEN
+template<> ::mpc_engine::proto::coordinator_node::MpcMeshPeer* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcMeshPeer>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcMeshSessionRequest>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcMeshSessionResponse>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcPeerMessage* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcPeerMessage>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcRoundBatchRequest>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcRoundBatchResponse>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcRoundRequest* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcRoundRequest>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcRoundRequest_PeerMessagesEntry_DoNotUse>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcRoundResponse* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcRoundResponse>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcSessionAbortRequest>(Arena*);
+template<> ::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse* Arena::CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcSessionAbortResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace mpc_engine {
+namespace proto {
+namespace coordinator_node {
+
+enum MpcProtocol : int {
+  MPC_PROTOCOL_UNSPECIFIED = 0,
+  MPC_PROTOCOL_KEYGEN = 1,
+  MPC_PROTOCOL_ECDSA_SIGNING = 2,
+  MPC_PROTOCOL_EDDSA_SIGNING = 3,
+  MPC_PROTOCOL_ECDSA_PRESIGN = 4,
+  MPC_PROTOCOL_ECDSA_ONLINE_SIGNING = 5,
+  MpcProtocol_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MpcProtocol_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool MpcProtocol_IsValid(int value);
+constexpr MpcProtocol MpcProtocol_MIN = MPC_PROTOCOL_UNSPECIFIED;
+constexpr MpcProtocol MpcProtocol_MAX = MPC_PROTOCOL_ECDSA_ONLINE_SIGNING;
+constexpr int MpcProtocol_ARRAYSIZE = MpcProtocol_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MpcProtocol_descriptor();
+template<typename T>
+inline const std::string& MpcProtocol_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MpcProtocol>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MpcProtocol_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MpcProtocol_descriptor(), enum_t_value);
+}
+inline bool MpcProtocol_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MpcProtocol* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MpcProtocol>(
+    MpcProtocol_descriptor(), name, value);
+}
+// ===================================================================
+
+class MpcRoundRequest_PeerMessagesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MpcRoundRequest_PeerMessagesEntry_DoNotUse, 
+    uint64_t, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MpcRoundRequest_PeerMessagesEntry_DoNotUse, 
+    uint64_t, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES> SuperType;
+  MpcRoundRequest_PeerMessagesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR MpcRoundRequest_PeerMessagesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit MpcRoundRequest_PeerMessagesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MpcRoundRequest_PeerMessagesEntry_DoNotUse& other);
+  static const MpcRoundRequest_PeerMessagesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MpcRoundRequest_PeerMessagesEntry_DoNotUse*>(&_MpcRoundRequest_PeerMessagesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_mpc_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class MpcRoundRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcRoundRequest) */ {
+ public:
+  inline MpcRoundRequest() : MpcRoundRequest(nullptr) {}
+  ~MpcRoundRequest() override;
+  explicit PROTOBUF_CONSTEXPR MpcRoundRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcRoundRequest(const MpcRoundRequest& from);
+  MpcRoundRequest(MpcRoundRequest&& from) noexcept
+    : MpcRoundRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcRoundRequest& operator=(const MpcRoundRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcRoundRequest& operator=(MpcRoundRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcRoundRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcRoundRequest* internal_default_instance() {
+    return reinterpret_cast<const MpcRoundRequest*>(
+               &_MpcRoundRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(MpcRoundRequest& a, MpcRoundRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcRoundRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcRoundRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcRoundRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcRoundRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcRoundRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcRoundRequest& from) {
+    MpcRoundRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcRoundRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcRoundRequest";
+  }
+  protected:
+  explicit MpcRoundRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPlayerIdsFieldNumber = 8,
+    kPeerMessagesFieldNumber = 11,
+    kSessionIdFieldNumber = 2,
+    kKeyIdFieldNumber = 6,
+    kSessionInputFieldNumber = 10,
+    kPresignatureIdFieldNumber = 12,
+    kHeaderFieldNumber = 1,
+    kProtocolFieldNumber = 3,
+    kRoundFieldNumber = 4,
+    kPlayerIdFieldNumber = 7,
+    kTotalRoundsFieldNumber = 5,
+    kThresholdFieldNumber = 9,
+  };
+  // repeated uint64 player_ids = 8;
+  int player_ids_size() const;
+  private:
+  int _internal_player_ids_size() const;
+  public:
+  void clear_player_ids();
+  private:
+  uint64_t _internal_player_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_player_ids() const;
+  void _internal_add_player_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_player_ids();
+  public:
+  uint64_t player_ids(int index) const;
+  void set_player_ids(int index, uint64_t value);
+  void add_player_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      player_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_player_ids();
+
+  // map<uint64, bytes> peer_messages = 11;
+  int peer_messages_size() const;
+  private:
+  int _internal_peer_messages_size() const;
+  public:
+  void clear_peer_messages();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, std::string >&
+      _internal_peer_messages() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, std::string >*
+      _internal_mutable_peer_messages();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, std::string >&
+      peer_messages() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, std::string >*
+      mutable_peer_messages();
+
+  // string session_id = 2;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // string key_id = 6;
+  void clear_key_id();
+  const std::string& key_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key_id();
+  PROTOBUF_NODISCARD std::string* release_key_id();
+  void set_allocated_key_id(std::string* key_id);
+  private:
+  const std::string& _internal_key_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key_id(const std::string& value);
+  std::string* _internal_mutable_key_id();
+  public:
+
+  // bytes session_input = 10;
+  void clear_session_input();
+  const std::string& session_input() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_input(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_input();
+  PROTOBUF_NODISCARD std::string* release_session_input();
+  void set_allocated_session_input(std::string* session_input);
+  private:
+  const std::string& _internal_session_input() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_input(const std::string& value);
+  std::string* _internal_mutable_session_input();
+  public:
+
+  // string presignature_id = 12;
+  void clear_presignature_id();
+  const std::string& presignature_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_presignature_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_presignature_id();
+  PROTOBUF_NODISCARD std::string* release_presignature_id();
+  void set_allocated_presignature_id(std::string* presignature_id);
+  private:
+  const std::string& _internal_presignature_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_presignature_id(const std::string& value);
+  std::string* _internal_mutable_presignature_id();
+  public:
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::coordinator_node::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::RequestHeader* release_header();
+  ::mpc_engine::proto::coordinator_node::RequestHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::coordinator_node::RequestHeader* header);
+  private:
+  const ::mpc_engine::proto::coordinator_node::RequestHeader& _internal_header() const;
+  ::mpc_engine::proto::coordinator_node::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::coordinator_node::RequestHeader* header);
+  ::mpc_engine::proto::coordinator_node::RequestHeader* unsafe_arena_release_header();
+
+  // .mpc_engine.proto.coordinator_node.MpcProtocol protocol = 3;
+  void clear_protocol();
+  ::mpc_engine::proto::coordinator_node::MpcProtocol protocol() const;
+  void set_protocol(::mpc_engine::proto::coordinator_node::MpcProtocol value);
+  private:
+  ::mpc_engine::proto::coordinator_node::MpcProtocol _internal_protocol() const;
+  void _internal_set_protocol(::mpc_engine::proto::coordinator_node::MpcProtocol value);
+  public:
+
+  // uint32 round = 4;
+  void clear_round();
+  uint32_t round() const;
+  void set_round(uint32_t value);
+  private:
+  uint32_t _internal_round() const;
+  void _internal_set_round(uint32_t value);
+  public:
+
+  // uint64 player_id = 7;
+  void clear_player_id();
+  uint64_t player_id() const;
+  void set_player_id(uint64_t value);
+  private:
+  uint64_t _internal_player_id() const;
+  void _internal_set_player_id(uint64_t value);
+  public:
+
+  // uint32 total_rounds = 5;
+  void clear_total_rounds();
+  uint32_t total_rounds() const;
+  void set_total_rounds(uint32_t value);
+  private:
+  uint32_t _internal_total_rounds() const;
+  void _internal_set_total_rounds(uint32_t value);
+  public:
+
+  // uint32 threshold = 9;
+  void clear_threshold();
+  uint32_t threshold() const;
+  void set_threshold(uint32_t value);
+  private:
+  uint32_t _internal_threshold() const;
+  void _internal_set_threshold(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcRoundRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > player_ids_;
+    mutable std::atomic<int> _player_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        MpcRoundRequest_PeerMessagesEntry_DoNotUse,
+        uint64_t, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_BYTES> peer_messages_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_input_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr presignature_id_;
+    ::mpc_engine::proto::coordinator_node::RequestHeader* header_;
+    int protocol_;
+    uint32_t round_;
+    uint64_t player_id_;
+    uint32_t total_rounds_;
+    uint32_t threshold_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MpcRoundResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcRoundResponse) */ {
+ public:
+  inline MpcRoundResponse() : MpcRoundResponse(nullptr) {}
+  ~MpcRoundResponse() override;
+  explicit PROTOBUF_CONSTEXPR MpcRoundResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcRoundResponse(const MpcRoundResponse& from);
+  MpcRoundResponse(MpcRoundResponse&& from) noexcept
+    : MpcRoundResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcRoundResponse& operator=(const MpcRoundResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcRoundResponse& operator=(MpcRoundResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcRoundResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcRoundResponse* internal_default_instance() {
+    return reinterpret_cast<const MpcRoundResponse*>(
+               &_MpcRoundResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(MpcRoundResponse& a, MpcRoundResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcRoundResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcRoundResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcRoundResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcRoundResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcRoundResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcRoundResponse& from) {
+    MpcRoundResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcRoundResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcRoundResponse";
+  }
+  protected:
+  explicit MpcRoundResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionIdFieldNumber = 2,
+    kOutputFieldNumber = 5,
+    kHeaderFieldNumber = 1,
+    kPlayerIdFieldNumber = 4,
+    kRoundFieldNumber = 3,
+  };
+  // string session_id = 2;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // bytes output = 5;
+  void clear_output();
+  const std::string& output() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_output(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_output();
+  PROTOBUF_NODISCARD std::string* release_output();
+  void set_allocated_output(std::string* output);
+  private:
+  const std::string& _internal_output() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_output(const std::string& value);
+  std::string* _internal_mutable_output();
+  public:
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::ResponseHeader* release_header();
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  private:
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& _internal_header() const;
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* unsafe_arena_release_header();
+
+  // uint64 player_id = 4;
+  void clear_player_id();
+  uint64_t player_id() const;
+  void set_player_id(uint64_t value);
+  private:
+  uint64_t _internal_player_id() const;
+  void _internal_set_player_id(uint64_t value);
+  public:
+
+  // uint32 round = 3;
+  void clear_round();
+  uint32_t round() const;
+  void set_round(uint32_t value);
+  private:
+  uint32_t _internal_round() const;
+  void _internal_set_round(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcRoundResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr output_;
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header_;
+    uint64_t player_id_;
+    uint32_t round_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MpcSessionAbortRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest) */ {
+ public:
+  inline MpcSessionAbortRequest() : MpcSessionAbortRequest(nullptr) {}
+  ~MpcSessionAbortRequest() override;
+  explicit PROTOBUF_CONSTEXPR MpcSessionAbortRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcSessionAbortRequest(const MpcSessionAbortRequest& from);
+  MpcSessionAbortRequest(MpcSessionAbortRequest&& from) noexcept
+    : MpcSessionAbortRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcSessionAbortRequest& operator=(const MpcSessionAbortRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcSessionAbortRequest& operator=(MpcSessionAbortRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcSessionAbortRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcSessionAbortRequest* internal_default_instance() {
+    return reinterpret_cast<const MpcSessionAbortRequest*>(
+               &_MpcSessionAbortRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(MpcSessionAbortRequest& a, MpcSessionAbortRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcSessionAbortRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcSessionAbortRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcSessionAbortRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcSessionAbortRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcSessionAbortRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcSessionAbortRequest& from) {
+    MpcSessionAbortRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcSessionAbortRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcSessionAbortRequest";
+  }
+  protected:
+  explicit MpcSessionAbortRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionIdFieldNumber = 2,
+    kReasonFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+  };
+  // string session_id = 2;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // string reason = 3;
+  void clear_reason();
+  const std::string& reason() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reason(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reason();
+  PROTOBUF_NODISCARD std::string* release_reason();
+  void set_allocated_reason(std::string* reason);
+  private:
+  const std::string& _internal_reason() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reason(const std::string& value);
+  std::string* _internal_mutable_reason();
+  public:
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::coordinator_node::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::RequestHeader* release_header();
+  ::mpc_engine::proto::coordinator_node::RequestHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::coordinator_node::RequestHeader* header);
+  private:
+  const ::mpc_engine::proto::coordinator_node::RequestHeader& _internal_header() const;
+  ::mpc_engine::proto::coordinator_node::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::coordinator_node::RequestHeader* header);
+  ::mpc_engine::proto::coordinator_node::RequestHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reason_;
+    ::mpc_engine::proto::coordinator_node::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MpcSessionAbortResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse) */ {
+ public:
+  inline MpcSessionAbortResponse() : MpcSessionAbortResponse(nullptr) {}
+  ~MpcSessionAbortResponse() override;
+  explicit PROTOBUF_CONSTEXPR MpcSessionAbortResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcSessionAbortResponse(const MpcSessionAbortResponse& from);
+  MpcSessionAbortResponse(MpcSessionAbortResponse&& from) noexcept
+    : MpcSessionAbortResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcSessionAbortResponse& operator=(const MpcSessionAbortResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcSessionAbortResponse& operator=(MpcSessionAbortResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcSessionAbortResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcSessionAbortResponse* internal_default_instance() {
+    return reinterpret_cast<const MpcSessionAbortResponse*>(
+               &_MpcSessionAbortResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(MpcSessionAbortResponse& a, MpcSessionAbortResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcSessionAbortResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcSessionAbortResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcSessionAbortResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcSessionAbortResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcSessionAbortResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcSessionAbortResponse& from) {
+    MpcSessionAbortResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcSessionAbortResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcSessionAbortResponse";
+  }
+  protected:
+  explicit MpcSessionAbortResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionIdFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // string session_id = 2;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::ResponseHeader* release_header();
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  private:
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& _internal_header() const;
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MpcRoundBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest) */ {
+ public:
+  inline MpcRoundBatchRequest() : MpcRoundBatchRequest(nullptr) {}
+  ~MpcRoundBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR MpcRoundBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcRoundBatchRequest(const MpcRoundBatchRequest& from);
+  MpcRoundBatchRequest(MpcRoundBatchRequest&& from) noexcept
+    : MpcRoundBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcRoundBatchRequest& operator=(const MpcRoundBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcRoundBatchRequest& operator=(MpcRoundBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcRoundBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcRoundBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const MpcRoundBatchRequest*>(
+               &_MpcRoundBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(MpcRoundBatchRequest& a, MpcRoundBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcRoundBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcRoundBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcRoundBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcRoundBatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcRoundBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcRoundBatchRequest& from) {
+    MpcRoundBatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcRoundBatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcRoundBatchRequest";
+  }
+  protected:
+  explicit MpcRoundBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoundsFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated .mpc_engine.proto.coordinator_node.MpcRoundRequest rounds = 2;
+  int rounds_size() const;
+  private:
+  int _internal_rounds_size() const;
+  public:
+  void clear_rounds();
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* mutable_rounds(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundRequest >*
+      mutable_rounds();
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& _internal_rounds(int index) const;
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* _internal_add_rounds();
+  public:
+  const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& rounds(int index) const;
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* add_rounds();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundRequest >&
+      rounds() const;
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::coordinator_node::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::RequestHeader* release_header();
+  ::mpc_engine::proto::coordinator_node::RequestHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::coordinator_node::RequestHeader* header);
+  private:
+  const ::mpc_engine::proto::coordinator_node::RequestHeader& _internal_header() const;
+  ::mpc_engine::proto::coordinator_node::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::coordinator_node::RequestHeader* header);
+  ::mpc_engine::proto::coordinator_node::RequestHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundRequest > rounds_;
+    ::mpc_engine::proto::coordinator_node::RequestHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MpcRoundBatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse) */ {
+ public:
+  inline MpcRoundBatchResponse() : MpcRoundBatchResponse(nullptr) {}
+  ~MpcRoundBatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR MpcRoundBatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcRoundBatchResponse(const MpcRoundBatchResponse& from);
+  MpcRoundBatchResponse(MpcRoundBatchResponse&& from) noexcept
+    : MpcRoundBatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcRoundBatchResponse& operator=(const MpcRoundBatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcRoundBatchResponse& operator=(MpcRoundBatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcRoundBatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcRoundBatchResponse* internal_default_instance() {
+    return reinterpret_cast<const MpcRoundBatchResponse*>(
+               &_MpcRoundBatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(MpcRoundBatchResponse& a, MpcRoundBatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcRoundBatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcRoundBatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcRoundBatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcRoundBatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcRoundBatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcRoundBatchResponse& from) {
+    MpcRoundBatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcRoundBatchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcRoundBatchResponse";
+  }
+  protected:
+  explicit MpcRoundBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoundsFieldNumber = 2,
+    kHeaderFieldNumber = 1,
+  };
+  // repeated .mpc_engine.proto.coordinator_node.MpcRoundResponse rounds = 2;
+  int rounds_size() const;
+  private:
+  int _internal_rounds_size() const;
+  public:
+  void clear_rounds();
+  ::mpc_engine::proto::coordinator_node::MpcRoundResponse* mutable_rounds(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundResponse >*
+      mutable_rounds();
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcRoundResponse& _internal_rounds(int index) const;
+  ::mpc_engine::proto::coordinator_node::MpcRoundResponse* _internal_add_rounds();
+  public:
+  const ::mpc_engine::proto::coordinator_node::MpcRoundResponse& rounds(int index) const;
+  ::mpc_engine::proto::coordinator_node::MpcRoundResponse* add_rounds();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundResponse >&
+      rounds() const;
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::ResponseHeader* release_header();
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  private:
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& _internal_header() const;
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* unsafe_arena_release_header();
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundResponse > rounds_;
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MpcMeshPeer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcMeshPeer) */ {
+ public:
+  inline MpcMeshPeer() : MpcMeshPeer(nullptr) {}
+  ~MpcMeshPeer() override;
+  explicit PROTOBUF_CONSTEXPR MpcMeshPeer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcMeshPeer(const MpcMeshPeer& from);
+  MpcMeshPeer(MpcMeshPeer&& from) noexcept
+    : MpcMeshPeer() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcMeshPeer& operator=(const MpcMeshPeer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcMeshPeer& operator=(MpcMeshPeer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcMeshPeer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcMeshPeer* internal_default_instance() {
+    return reinterpret_cast<const MpcMeshPeer*>(
+               &_MpcMeshPeer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(MpcMeshPeer& a, MpcMeshPeer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcMeshPeer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcMeshPeer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcMeshPeer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcMeshPeer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcMeshPeer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcMeshPeer& from) {
+    MpcMeshPeer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcMeshPeer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcMeshPeer";
+  }
+  protected:
+  explicit MpcMeshPeer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodeIdFieldNumber = 2,
+    kHostFieldNumber = 3,
+    kPlayerIdFieldNumber = 1,
+    kPortFieldNumber = 4,
+  };
+  // string node_id = 2;
+  void clear_node_id();
+  const std::string& node_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_node_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_node_id();
+  PROTOBUF_NODISCARD std::string* release_node_id();
+  void set_allocated_node_id(std::string* node_id);
+  private:
+  const std::string& _internal_node_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_node_id(const std::string& value);
+  std::string* _internal_mutable_node_id();
+  public:
+
+  // string host = 3;
+  void clear_host();
+  const std::string& host() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_host(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_host();
+  PROTOBUF_NODISCARD std::string* release_host();
+  void set_allocated_host(std::string* host);
+  private:
+  const std::string& _internal_host() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host(const std::string& value);
+  std::string* _internal_mutable_host();
+  public:
+
+  // uint64 player_id = 1;
+  void clear_player_id();
+  uint64_t player_id() const;
+  void set_player_id(uint64_t value);
+  private:
+  uint64_t _internal_player_id() const;
+  void _internal_set_player_id(uint64_t value);
+  public:
+
+  // uint32 port = 4;
+  void clear_port();
+  uint32_t port() const;
+  void set_port(uint32_t value);
+  private:
+  uint32_t _internal_port() const;
+  void _internal_set_port(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcMeshPeer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr node_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr host_;
+    uint64_t player_id_;
+    uint32_t port_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MpcMeshSessionRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest) */ {
+ public:
+  inline MpcMeshSessionRequest() : MpcMeshSessionRequest(nullptr) {}
+  ~MpcMeshSessionRequest() override;
+  explicit PROTOBUF_CONSTEXPR MpcMeshSessionRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcMeshSessionRequest(const MpcMeshSessionRequest& from);
+  MpcMeshSessionRequest(MpcMeshSessionRequest&& from) noexcept
+    : MpcMeshSessionRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcMeshSessionRequest& operator=(const MpcMeshSessionRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcMeshSessionRequest& operator=(MpcMeshSessionRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcMeshSessionRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcMeshSessionRequest* internal_default_instance() {
+    return reinterpret_cast<const MpcMeshSessionRequest*>(
+               &_MpcMeshSessionRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(MpcMeshSessionRequest& a, MpcMeshSessionRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcMeshSessionRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcMeshSessionRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcMeshSessionRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcMeshSessionRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcMeshSessionRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcMeshSessionRequest& from) {
+    MpcMeshSessionRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcMeshSessionRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcMeshSessionRequest";
+  }
+  protected:
+  explicit MpcMeshSessionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPeersFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kSessionFieldNumber = 2,
+    kRoundTimeoutMsFieldNumber = 4,
+  };
+  // repeated .mpc_engine.proto.coordinator_node.MpcMeshPeer peers = 3;
+  int peers_size() const;
+  private:
+  int _internal_peers_size() const;
+  public:
+  void clear_peers();
+  ::mpc_engine::proto::coordinator_node::MpcMeshPeer* mutable_peers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcMeshPeer >*
+      mutable_peers();
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcMeshPeer& _internal_peers(int index) const;
+  ::mpc_engine::proto::coordinator_node::MpcMeshPeer* _internal_add_peers();
+  public:
+  const ::mpc_engine::proto::coordinator_node::MpcMeshPeer& peers(int index) const;
+  ::mpc_engine::proto::coordinator_node::MpcMeshPeer* add_peers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcMeshPeer >&
+      peers() const;
+
+  // .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::coordinator_node::RequestHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::RequestHeader* release_header();
+  ::mpc_engine::proto::coordinator_node::RequestHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::coordinator_node::RequestHeader* header);
+  private:
+  const ::mpc_engine::proto::coordinator_node::RequestHeader& _internal_header() const;
+  ::mpc_engine::proto::coordinator_node::RequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::coordinator_node::RequestHeader* header);
+  ::mpc_engine::proto::coordinator_node::RequestHeader* unsafe_arena_release_header();
+
+  // .mpc_engine.proto.coordinator_node.MpcRoundRequest session = 2;
+  bool has_session() const;
+  private:
+  bool _internal_has_session() const;
+  public:
+  void clear_session();
+  const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& session() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::MpcRoundRequest* release_session();
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* mutable_session();
+  void set_allocated_session(::mpc_engine::proto::coordinator_node::MpcRoundRequest* session);
+  private:
+  const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& _internal_session() const;
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* _internal_mutable_session();
+  public:
+  void unsafe_arena_set_allocated_session(
+      ::mpc_engine::proto::coordinator_node::MpcRoundRequest* session);
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* unsafe_arena_release_session();
+
+  // uint32 round_timeout_ms = 4;
+  void clear_round_timeout_ms();
+  uint32_t round_timeout_ms() const;
+  void set_round_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_round_timeout_ms() const;
+  void _internal_set_round_timeout_ms(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcMeshPeer > peers_;
+    ::mpc_engine::proto::coordinator_node::RequestHeader* header_;
+    ::mpc_engine::proto::coordinator_node::MpcRoundRequest* session_;
+    uint32_t round_timeout_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MpcMeshSessionResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse) */ {
+ public:
+  inline MpcMeshSessionResponse() : MpcMeshSessionResponse(nullptr) {}
+  ~MpcMeshSessionResponse() override;
+  explicit PROTOBUF_CONSTEXPR MpcMeshSessionResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcMeshSessionResponse(const MpcMeshSessionResponse& from);
+  MpcMeshSessionResponse(MpcMeshSessionResponse&& from) noexcept
+    : MpcMeshSessionResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcMeshSessionResponse& operator=(const MpcMeshSessionResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcMeshSessionResponse& operator=(MpcMeshSessionResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcMeshSessionResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcMeshSessionResponse* internal_default_instance() {
+    return reinterpret_cast<const MpcMeshSessionResponse*>(
+               &_MpcMeshSessionResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(MpcMeshSessionResponse& a, MpcMeshSessionResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcMeshSessionResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcMeshSessionResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcMeshSessionResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcMeshSessionResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcMeshSessionResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcMeshSessionResponse& from) {
+    MpcMeshSessionResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcMeshSessionResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcMeshSessionResponse";
+  }
+  protected:
+  explicit MpcMeshSessionResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionIdFieldNumber = 2,
+    kOutputFieldNumber = 5,
+    kHeaderFieldNumber = 1,
+    kPlayerIdFieldNumber = 3,
+    kCompletedRoundsFieldNumber = 4,
+  };
+  // string session_id = 2;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // bytes output = 5;
+  void clear_output();
+  const std::string& output() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_output(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_output();
+  PROTOBUF_NODISCARD std::string* release_output();
+  void set_allocated_output(std::string* output);
+  private:
+  const std::string& _internal_output() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_output(const std::string& value);
+  std::string* _internal_mutable_output();
+  public:
+
+  // .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::coordinator_node::ResponseHeader* release_header();
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  private:
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader& _internal_header() const;
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::coordinator_node::ResponseHeader* header);
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* unsafe_arena_release_header();
+
+  // uint64 player_id = 3;
+  void clear_player_id();
+  uint64_t player_id() const;
+  void set_player_id(uint64_t value);
+  private:
+  uint64_t _internal_player_id() const;
+  void _internal_set_player_id(uint64_t value);
+  public:
+
+  // uint32 completed_rounds = 4;
+  void clear_completed_rounds();
+  uint32_t completed_rounds() const;
+  void set_completed_rounds(uint32_t value);
+  private:
+  uint32_t _internal_completed_rounds() const;
+  void _internal_set_completed_rounds(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr output_;
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header_;
+    uint64_t player_id_;
+    uint32_t completed_rounds_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MpcPeerMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.coordinator_node.MpcPeerMessage) */ {
+ public:
+  inline MpcPeerMessage() : MpcPeerMessage(nullptr) {}
+  ~MpcPeerMessage() override;
+  explicit PROTOBUF_CONSTEXPR MpcPeerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MpcPeerMessage(const MpcPeerMessage& from);
+  MpcPeerMessage(MpcPeerMessage&& from) noexcept
+    : MpcPeerMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline MpcPeerMessage& operator=(const MpcPeerMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MpcPeerMessage& operator=(MpcPeerMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MpcPeerMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MpcPeerMessage* internal_default_instance() {
+    return reinterpret_cast<const MpcPeerMessage*>(
+               &_MpcPeerMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(MpcPeerMessage& a, MpcPeerMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MpcPeerMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MpcPeerMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MpcPeerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MpcPeerMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MpcPeerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MpcPeerMessage& from) {
+    MpcPeerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MpcPeerMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.coordinator_node.MpcPeerMessage";
+  }
+  protected:
+  explicit MpcPeerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionIdFieldNumber = 1,
+    kPayloadFieldNumber = 5,
+    kFromPlayerFieldNumber = 3,
+    kToPlayerFieldNumber = 4,
+    kRoundFieldNumber = 2,
+  };
+  // string session_id = 1;
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // bytes payload = 5;
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
+
+  // uint64 from_player = 3;
+  void clear_from_player();
+  uint64_t from_player() const;
+  void set_from_player(uint64_t value);
+  private:
+  uint64_t _internal_from_player() const;
+  void _internal_set_from_player(uint64_t value);
+  public:
+
+  // uint64 to_player = 4;
+  void clear_to_player();
+  uint64_t to_player() const;
+  void set_to_player(uint64_t value);
+  private:
+  uint64_t _internal_to_player() const;
+  void _internal_set_to_player(uint64_t value);
+  public:
+
+  // uint32 round = 2;
+  void clear_round();
+  uint32_t round() const;
+  void set_round(uint32_t value);
+  private:
+  uint32_t _internal_round() const;
+  void _internal_set_round(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.coordinator_node.MpcPeerMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    uint64_t from_player_;
+    uint64_t to_player_;
+    uint32_t round_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_mpc_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// MpcRoundRequest
+
+// .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+inline bool MpcRoundRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MpcRoundRequest::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::coordinator_node::RequestHeader& MpcRoundRequest::_internal_header() const {
+  const ::mpc_engine::proto::coordinator_node::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::RequestHeader&>(
+      ::mpc_engine::proto::coordinator_node::_RequestHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::RequestHeader& MpcRoundRequest::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.header)
+  return _internal_header();
+}
+inline void MpcRoundRequest::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::coordinator_node::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundRequest.header)
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcRoundRequest::release_header() {
+  
+  ::mpc_engine::proto::coordinator_node::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcRoundRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundRequest.header)
+  
+  ::mpc_engine::proto::coordinator_node::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcRoundRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcRoundRequest::mutable_header() {
+  ::mpc_engine::proto::coordinator_node::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundRequest.header)
+  return _msg;
+}
+inline void MpcRoundRequest::set_allocated_header(::mpc_engine::proto::coordinator_node::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundRequest.header)
+}
+
+// string session_id = 2;
+inline void MpcRoundRequest::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& MpcRoundRequest::session_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcRoundRequest::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_id)
+}
+inline std::string* MpcRoundRequest::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_id)
+  return _s;
+}
+inline const std::string& MpcRoundRequest::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void MpcRoundRequest::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcRoundRequest::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcRoundRequest::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void MpcRoundRequest::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_id)
+}
+
+// .mpc_engine.proto.coordinator_node.MpcProtocol protocol = 3;
+inline void MpcRoundRequest::clear_protocol() {
+  _impl_.protocol_ = 0;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcProtocol MpcRoundRequest::_internal_protocol() const {
+  return static_cast< ::mpc_engine::proto::coordinator_node::MpcProtocol >(_impl_.protocol_);
+}
+inline ::mpc_engine::proto::coordinator_node::MpcProtocol MpcRoundRequest::protocol() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.protocol)
+  return _internal_protocol();
+}
+inline void MpcRoundRequest::_internal_set_protocol(::mpc_engine::proto::coordinator_node::MpcProtocol value) {
+  
+  _impl_.protocol_ = value;
+}
+inline void MpcRoundRequest::set_protocol(::mpc_engine::proto::coordinator_node::MpcProtocol value) {
+  _internal_set_protocol(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.protocol)
+}
+
+// uint32 round = 4;
+inline void MpcRoundRequest::clear_round() {
+  _impl_.round_ = 0u;
+}
+inline uint32_t MpcRoundRequest::_internal_round() const {
+  return _impl_.round_;
+}
+inline uint32_t MpcRoundRequest::round() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.round)
+  return _internal_round();
+}
+inline void MpcRoundRequest::_internal_set_round(uint32_t value) {
+  
+  _impl_.round_ = value;
+}
+inline void MpcRoundRequest::set_round(uint32_t value) {
+  _internal_set_round(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.round)
+}
+
+// uint32 total_rounds = 5;
+inline void MpcRoundRequest::clear_total_rounds() {
+  _impl_.total_rounds_ = 0u;
+}
+inline uint32_t MpcRoundRequest::_internal_total_rounds() const {
+  return _impl_.total_rounds_;
+}
+inline uint32_t MpcRoundRequest::total_rounds() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.total_rounds)
+  return _internal_total_rounds();
+}
+inline void MpcRoundRequest::_internal_set_total_rounds(uint32_t value) {
+  
+  _impl_.total_rounds_ = value;
+}
+inline void MpcRoundRequest::set_total_rounds(uint32_t value) {
+  _internal_set_total_rounds(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.total_rounds)
+}
+
+// string key_id = 6;
+inline void MpcRoundRequest::clear_key_id() {
+  _impl_.key_id_.ClearToEmpty();
+}
+inline const std::string& MpcRoundRequest::key_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.key_id)
+  return _internal_key_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcRoundRequest::set_key_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.key_id)
+}
+inline std::string* MpcRoundRequest::mutable_key_id() {
+  std::string* _s = _internal_mutable_key_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundRequest.key_id)
+  return _s;
+}
+inline const std::string& MpcRoundRequest::_internal_key_id() const {
+  return _impl_.key_id_.Get();
+}
+inline void MpcRoundRequest::_internal_set_key_id(const std::string& value) {
+  
+  _impl_.key_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcRoundRequest::_internal_mutable_key_id() {
+  
+  return _impl_.key_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcRoundRequest::release_key_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundRequest.key_id)
+  return _impl_.key_id_.Release();
+}
+inline void MpcRoundRequest::set_allocated_key_id(std::string* key_id) {
+  if (key_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_id_.SetAllocated(key_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_id_.IsDefault()) {
+    _impl_.key_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundRequest.key_id)
+}
+
+// uint64 player_id = 7;
+inline void MpcRoundRequest::clear_player_id() {
+  _impl_.player_id_ = uint64_t{0u};
+}
+inline uint64_t MpcRoundRequest::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint64_t MpcRoundRequest::player_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.player_id)
+  return _internal_player_id();
+}
+inline void MpcRoundRequest::_internal_set_player_id(uint64_t value) {
+  
+  _impl_.player_id_ = value;
+}
+inline void MpcRoundRequest::set_player_id(uint64_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.player_id)
+}
+
+// repeated uint64 player_ids = 8;
+inline int MpcRoundRequest::_internal_player_ids_size() const {
+  return _impl_.player_ids_.size();
+}
+inline int MpcRoundRequest::player_ids_size() const {
+  return _internal_player_ids_size();
+}
+inline void MpcRoundRequest::clear_player_ids() {
+  _impl_.player_ids_.Clear();
+}
+inline uint64_t MpcRoundRequest::_internal_player_ids(int index) const {
+  return _impl_.player_ids_.Get(index);
+}
+inline uint64_t MpcRoundRequest::player_ids(int index) const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.player_ids)
+  return _internal_player_ids(index);
+}
+inline void MpcRoundRequest::set_player_ids(int index, uint64_t value) {
+  _impl_.player_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.player_ids)
+}
+inline void MpcRoundRequest::_internal_add_player_ids(uint64_t value) {
+  _impl_.player_ids_.Add(value);
+}
+inline void MpcRoundRequest::add_player_ids(uint64_t value) {
+  _internal_add_player_ids(value);
+  // @@protoc_insertion_point(field_add:mpc_engine.proto.coordinator_node.MpcRoundRequest.player_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+MpcRoundRequest::_internal_player_ids() const {
+  return _impl_.player_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+MpcRoundRequest::player_ids() const {
+  // @@protoc_insertion_point(field_list:mpc_engine.proto.coordinator_node.MpcRoundRequest.player_ids)
+  return _internal_player_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+MpcRoundRequest::_internal_mutable_player_ids() {
+  return &_impl_.player_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+MpcRoundRequest::mutable_player_ids() {
+  // @@protoc_insertion_point(field_mutable_list:mpc_engine.proto.coordinator_node.MpcRoundRequest.player_ids)
+  return _internal_mutable_player_ids();
+}
+
+// uint32 threshold = 9;
+inline void MpcRoundRequest::clear_threshold() {
+  _impl_.threshold_ = 0u;
+}
+inline uint32_t MpcRoundRequest::_internal_threshold() const {
+  return _impl_.threshold_;
+}
+inline uint32_t MpcRoundRequest::threshold() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.threshold)
+  return _internal_threshold();
+}
+inline void MpcRoundRequest::_internal_set_threshold(uint32_t value) {
+  
+  _impl_.threshold_ = value;
+}
+inline void MpcRoundRequest::set_threshold(uint32_t value) {
+  _internal_set_threshold(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.threshold)
+}
+
+// bytes session_input = 10;
+inline void MpcRoundRequest::clear_session_input() {
+  _impl_.session_input_.ClearToEmpty();
+}
+inline const std::string& MpcRoundRequest::session_input() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_input)
+  return _internal_session_input();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcRoundRequest::set_session_input(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_input_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_input)
+}
+inline std::string* MpcRoundRequest::mutable_session_input() {
+  std::string* _s = _internal_mutable_session_input();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_input)
+  return _s;
+}
+inline const std::string& MpcRoundRequest::_internal_session_input() const {
+  return _impl_.session_input_.Get();
+}
+inline void MpcRoundRequest::_internal_set_session_input(const std::string& value) {
+  
+  _impl_.session_input_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcRoundRequest::_internal_mutable_session_input() {
+  
+  return _impl_.session_input_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcRoundRequest::release_session_input() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_input)
+  return _impl_.session_input_.Release();
+}
+inline void MpcRoundRequest::set_allocated_session_input(std::string* session_input) {
+  if (session_input != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_input_.SetAllocated(session_input, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_input_.IsDefault()) {
+    _impl_.session_input_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundRequest.session_input)
+}
+
+// map<uint64, bytes> peer_messages = 11;
+inline int MpcRoundRequest::_internal_peer_messages_size() const {
+  return _impl_.peer_messages_.size();
+}
+inline int MpcRoundRequest::peer_messages_size() const {
+  return _internal_peer_messages_size();
+}
+inline void MpcRoundRequest::clear_peer_messages() {
+  _impl_.peer_messages_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, std::string >&
+MpcRoundRequest::_internal_peer_messages() const {
+  return _impl_.peer_messages_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, std::string >&
+MpcRoundRequest::peer_messages() const {
+  // @@protoc_insertion_point(field_map:mpc_engine.proto.coordinator_node.MpcRoundRequest.peer_messages)
+  return _internal_peer_messages();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, std::string >*
+MpcRoundRequest::_internal_mutable_peer_messages() {
+  return _impl_.peer_messages_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, std::string >*
+MpcRoundRequest::mutable_peer_messages() {
+  // @@protoc_insertion_point(field_mutable_map:mpc_engine.proto.coordinator_node.MpcRoundRequest.peer_messages)
+  return _internal_mutable_peer_messages();
+}
+
+// string presignature_id = 12;
+inline void MpcRoundRequest::clear_presignature_id() {
+  _impl_.presignature_id_.ClearToEmpty();
+}
+inline const std::string& MpcRoundRequest::presignature_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundRequest.presignature_id)
+  return _internal_presignature_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcRoundRequest::set_presignature_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.presignature_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundRequest.presignature_id)
+}
+inline std::string* MpcRoundRequest::mutable_presignature_id() {
+  std::string* _s = _internal_mutable_presignature_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundRequest.presignature_id)
+  return _s;
+}
+inline const std::string& MpcRoundRequest::_internal_presignature_id() const {
+  return _impl_.presignature_id_.Get();
+}
+inline void MpcRoundRequest::_internal_set_presignature_id(const std::string& value) {
+  
+  _impl_.presignature_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcRoundRequest::_internal_mutable_presignature_id() {
+  
+  return _impl_.presignature_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcRoundRequest::release_presignature_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundRequest.presignature_id)
+  return _impl_.presignature_id_.Release();
+}
+inline void MpcRoundRequest::set_allocated_presignature_id(std::string* presignature_id) {
+  if (presignature_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.presignature_id_.SetAllocated(presignature_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.presignature_id_.IsDefault()) {
+    _impl_.presignature_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundRequest.presignature_id)
+}
+
+// -------------------------------------------------------------------
+
+// MpcRoundResponse
+
+// .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+inline bool MpcRoundResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MpcRoundResponse::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& MpcRoundResponse::_internal_header() const {
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::ResponseHeader&>(
+      ::mpc_engine::proto::coordinator_node::_ResponseHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& MpcRoundResponse::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundResponse.header)
+  return _internal_header();
+}
+inline void MpcRoundResponse::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundResponse.header)
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcRoundResponse::release_header() {
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcRoundResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundResponse.header)
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcRoundResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcRoundResponse::mutable_header() {
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundResponse.header)
+  return _msg;
+}
+inline void MpcRoundResponse::set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundResponse.header)
+}
+
+// string session_id = 2;
+inline void MpcRoundResponse::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& MpcRoundResponse::session_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundResponse.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcRoundResponse::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundResponse.session_id)
+}
+inline std::string* MpcRoundResponse::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundResponse.session_id)
+  return _s;
+}
+inline const std::string& MpcRoundResponse::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void MpcRoundResponse::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcRoundResponse::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcRoundResponse::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundResponse.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void MpcRoundResponse::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundResponse.session_id)
+}
+
+// uint32 round = 3;
+inline void MpcRoundResponse::clear_round() {
+  _impl_.round_ = 0u;
+}
+inline uint32_t MpcRoundResponse::_internal_round() const {
+  return _impl_.round_;
+}
+inline uint32_t MpcRoundResponse::round() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundResponse.round)
+  return _internal_round();
+}
+inline void MpcRoundResponse::_internal_set_round(uint32_t value) {
+  
+  _impl_.round_ = value;
+}
+inline void MpcRoundResponse::set_round(uint32_t value) {
+  _internal_set_round(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundResponse.round)
+}
+
+// uint64 player_id = 4;
+inline void MpcRoundResponse::clear_player_id() {
+  _impl_.player_id_ = uint64_t{0u};
+}
+inline uint64_t MpcRoundResponse::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint64_t MpcRoundResponse::player_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundResponse.player_id)
+  return _internal_player_id();
+}
+inline void MpcRoundResponse::_internal_set_player_id(uint64_t value) {
+  
+  _impl_.player_id_ = value;
+}
+inline void MpcRoundResponse::set_player_id(uint64_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundResponse.player_id)
+}
+
+// bytes output = 5;
+inline void MpcRoundResponse::clear_output() {
+  _impl_.output_.ClearToEmpty();
+}
+inline const std::string& MpcRoundResponse::output() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundResponse.output)
+  return _internal_output();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcRoundResponse::set_output(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.output_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcRoundResponse.output)
+}
+inline std::string* MpcRoundResponse::mutable_output() {
+  std::string* _s = _internal_mutable_output();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundResponse.output)
+  return _s;
+}
+inline const std::string& MpcRoundResponse::_internal_output() const {
+  return _impl_.output_.Get();
+}
+inline void MpcRoundResponse::_internal_set_output(const std::string& value) {
+  
+  _impl_.output_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcRoundResponse::_internal_mutable_output() {
+  
+  return _impl_.output_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcRoundResponse::release_output() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundResponse.output)
+  return _impl_.output_.Release();
+}
+inline void MpcRoundResponse::set_allocated_output(std::string* output) {
+  if (output != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.output_.SetAllocated(output, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.output_.IsDefault()) {
+    _impl_.output_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundResponse.output)
+}
+
+// -------------------------------------------------------------------
+
+// MpcSessionAbortRequest
+
+// .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+inline bool MpcSessionAbortRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MpcSessionAbortRequest::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::coordinator_node::RequestHeader& MpcSessionAbortRequest::_internal_header() const {
+  const ::mpc_engine::proto::coordinator_node::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::RequestHeader&>(
+      ::mpc_engine::proto::coordinator_node::_RequestHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::RequestHeader& MpcSessionAbortRequest::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.header)
+  return _internal_header();
+}
+inline void MpcSessionAbortRequest::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::coordinator_node::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.header)
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcSessionAbortRequest::release_header() {
+  
+  ::mpc_engine::proto::coordinator_node::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcSessionAbortRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.header)
+  
+  ::mpc_engine::proto::coordinator_node::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcSessionAbortRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcSessionAbortRequest::mutable_header() {
+  ::mpc_engine::proto::coordinator_node::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.header)
+  return _msg;
+}
+inline void MpcSessionAbortRequest::set_allocated_header(::mpc_engine::proto::coordinator_node::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.header)
+}
+
+// string session_id = 2;
+inline void MpcSessionAbortRequest::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& MpcSessionAbortRequest::session_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcSessionAbortRequest::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.session_id)
+}
+inline std::string* MpcSessionAbortRequest::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.session_id)
+  return _s;
+}
+inline const std::string& MpcSessionAbortRequest::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void MpcSessionAbortRequest::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcSessionAbortRequest::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcSessionAbortRequest::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void MpcSessionAbortRequest::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.session_id)
+}
+
+// string reason = 3;
+inline void MpcSessionAbortRequest::clear_reason() {
+  _impl_.reason_.ClearToEmpty();
+}
+inline const std::string& MpcSessionAbortRequest::reason() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.reason)
+  return _internal_reason();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcSessionAbortRequest::set_reason(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.reason_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.reason)
+}
+inline std::string* MpcSessionAbortRequest::mutable_reason() {
+  std::string* _s = _internal_mutable_reason();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.reason)
+  return _s;
+}
+inline const std::string& MpcSessionAbortRequest::_internal_reason() const {
+  return _impl_.reason_.Get();
+}
+inline void MpcSessionAbortRequest::_internal_set_reason(const std::string& value) {
+  
+  _impl_.reason_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcSessionAbortRequest::_internal_mutable_reason() {
+  
+  return _impl_.reason_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcSessionAbortRequest::release_reason() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.reason)
+  return _impl_.reason_.Release();
+}
+inline void MpcSessionAbortRequest::set_allocated_reason(std::string* reason) {
+  if (reason != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.reason_.SetAllocated(reason, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reason_.IsDefault()) {
+    _impl_.reason_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcSessionAbortRequest.reason)
+}
+
+// -------------------------------------------------------------------
+
+// MpcSessionAbortResponse
+
+// .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+inline bool MpcSessionAbortResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MpcSessionAbortResponse::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& MpcSessionAbortResponse::_internal_header() const {
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::ResponseHeader&>(
+      ::mpc_engine::proto::coordinator_node::_ResponseHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& MpcSessionAbortResponse::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.header)
+  return _internal_header();
+}
+inline void MpcSessionAbortResponse::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.header)
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcSessionAbortResponse::release_header() {
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcSessionAbortResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.header)
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcSessionAbortResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcSessionAbortResponse::mutable_header() {
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.header)
+  return _msg;
+}
+inline void MpcSessionAbortResponse::set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.header)
+}
+
+// string session_id = 2;
+inline void MpcSessionAbortResponse::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& MpcSessionAbortResponse::session_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcSessionAbortResponse::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.session_id)
+}
+inline std::string* MpcSessionAbortResponse::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.session_id)
+  return _s;
+}
+inline const std::string& MpcSessionAbortResponse::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void MpcSessionAbortResponse::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcSessionAbortResponse::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcSessionAbortResponse::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void MpcSessionAbortResponse::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcSessionAbortResponse.session_id)
+}
+
+// -------------------------------------------------------------------
+
+// MpcRoundBatchRequest
+
+// .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+inline bool MpcRoundBatchRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MpcRoundBatchRequest::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::coordinator_node::RequestHeader& MpcRoundBatchRequest::_internal_header() const {
+  const ::mpc_engine::proto::coordinator_node::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::RequestHeader&>(
+      ::mpc_engine::proto::coordinator_node::_RequestHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::RequestHeader& MpcRoundBatchRequest::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.header)
+  return _internal_header();
+}
+inline void MpcRoundBatchRequest::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::coordinator_node::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.header)
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcRoundBatchRequest::release_header() {
+  
+  ::mpc_engine::proto::coordinator_node::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcRoundBatchRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.header)
+  
+  ::mpc_engine::proto::coordinator_node::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcRoundBatchRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcRoundBatchRequest::mutable_header() {
+  ::mpc_engine::proto::coordinator_node::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.header)
+  return _msg;
+}
+inline void MpcRoundBatchRequest::set_allocated_header(::mpc_engine::proto::coordinator_node::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.header)
+}
+
+// repeated .mpc_engine.proto.coordinator_node.MpcRoundRequest rounds = 2;
+inline int MpcRoundBatchRequest::_internal_rounds_size() const {
+  return _impl_.rounds_.size();
+}
+inline int MpcRoundBatchRequest::rounds_size() const {
+  return _internal_rounds_size();
+}
+inline void MpcRoundBatchRequest::clear_rounds() {
+  _impl_.rounds_.Clear();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* MpcRoundBatchRequest::mutable_rounds(int index) {
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.rounds)
+  return _impl_.rounds_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundRequest >*
+MpcRoundBatchRequest::mutable_rounds() {
+  // @@protoc_insertion_point(field_mutable_list:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.rounds)
+  return &_impl_.rounds_;
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& MpcRoundBatchRequest::_internal_rounds(int index) const {
+  return _impl_.rounds_.Get(index);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& MpcRoundBatchRequest::rounds(int index) const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.rounds)
+  return _internal_rounds(index);
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* MpcRoundBatchRequest::_internal_add_rounds() {
+  return _impl_.rounds_.Add();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* MpcRoundBatchRequest::add_rounds() {
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* _add = _internal_add_rounds();
+  // @@protoc_insertion_point(field_add:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.rounds)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundRequest >&
+MpcRoundBatchRequest::rounds() const {
+  // @@protoc_insertion_point(field_list:mpc_engine.proto.coordinator_node.MpcRoundBatchRequest.rounds)
+  return _impl_.rounds_;
+}
+
+// -------------------------------------------------------------------
+
+// MpcRoundBatchResponse
+
+// .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+inline bool MpcRoundBatchResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MpcRoundBatchResponse::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& MpcRoundBatchResponse::_internal_header() const {
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::ResponseHeader&>(
+      ::mpc_engine::proto::coordinator_node::_ResponseHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& MpcRoundBatchResponse::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.header)
+  return _internal_header();
+}
+inline void MpcRoundBatchResponse::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.header)
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcRoundBatchResponse::release_header() {
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcRoundBatchResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.header)
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcRoundBatchResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcRoundBatchResponse::mutable_header() {
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.header)
+  return _msg;
+}
+inline void MpcRoundBatchResponse::set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.header)
+}
+
+// repeated .mpc_engine.proto.coordinator_node.MpcRoundResponse rounds = 2;
+inline int MpcRoundBatchResponse::_internal_rounds_size() const {
+  return _impl_.rounds_.size();
+}
+inline int MpcRoundBatchResponse::rounds_size() const {
+  return _internal_rounds_size();
+}
+inline void MpcRoundBatchResponse::clear_rounds() {
+  _impl_.rounds_.Clear();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundResponse* MpcRoundBatchResponse::mutable_rounds(int index) {
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.rounds)
+  return _impl_.rounds_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundResponse >*
+MpcRoundBatchResponse::mutable_rounds() {
+  // @@protoc_insertion_point(field_mutable_list:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.rounds)
+  return &_impl_.rounds_;
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundResponse& MpcRoundBatchResponse::_internal_rounds(int index) const {
+  return _impl_.rounds_.Get(index);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundResponse& MpcRoundBatchResponse::rounds(int index) const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.rounds)
+  return _internal_rounds(index);
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundResponse* MpcRoundBatchResponse::_internal_add_rounds() {
+  return _impl_.rounds_.Add();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundResponse* MpcRoundBatchResponse::add_rounds() {
+  ::mpc_engine::proto::coordinator_node::MpcRoundResponse* _add = _internal_add_rounds();
+  // @@protoc_insertion_point(field_add:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.rounds)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcRoundResponse >&
+MpcRoundBatchResponse::rounds() const {
+  // @@protoc_insertion_point(field_list:mpc_engine.proto.coordinator_node.MpcRoundBatchResponse.rounds)
+  return _impl_.rounds_;
+}
+
+// -------------------------------------------------------------------
+
+// MpcMeshPeer
+
+// uint64 player_id = 1;
+inline void MpcMeshPeer::clear_player_id() {
+  _impl_.player_id_ = uint64_t{0u};
+}
+inline uint64_t MpcMeshPeer::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint64_t MpcMeshPeer::player_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshPeer.player_id)
+  return _internal_player_id();
+}
+inline void MpcMeshPeer::_internal_set_player_id(uint64_t value) {
+  
+  _impl_.player_id_ = value;
+}
+inline void MpcMeshPeer::set_player_id(uint64_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcMeshPeer.player_id)
+}
+
+// string node_id = 2;
+inline void MpcMeshPeer::clear_node_id() {
+  _impl_.node_id_.ClearToEmpty();
+}
+inline const std::string& MpcMeshPeer::node_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshPeer.node_id)
+  return _internal_node_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcMeshPeer::set_node_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.node_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcMeshPeer.node_id)
+}
+inline std::string* MpcMeshPeer::mutable_node_id() {
+  std::string* _s = _internal_mutable_node_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcMeshPeer.node_id)
+  return _s;
+}
+inline const std::string& MpcMeshPeer::_internal_node_id() const {
+  return _impl_.node_id_.Get();
+}
+inline void MpcMeshPeer::_internal_set_node_id(const std::string& value) {
+  
+  _impl_.node_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcMeshPeer::_internal_mutable_node_id() {
+  
+  return _impl_.node_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcMeshPeer::release_node_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcMeshPeer.node_id)
+  return _impl_.node_id_.Release();
+}
+inline void MpcMeshPeer::set_allocated_node_id(std::string* node_id) {
+  if (node_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.node_id_.SetAllocated(node_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.node_id_.IsDefault()) {
+    _impl_.node_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshPeer.node_id)
+}
+
+// string host = 3;
+inline void MpcMeshPeer::clear_host() {
+  _impl_.host_.ClearToEmpty();
+}
+inline const std::string& MpcMeshPeer::host() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshPeer.host)
+  return _internal_host();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcMeshPeer::set_host(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.host_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcMeshPeer.host)
+}
+inline std::string* MpcMeshPeer::mutable_host() {
+  std::string* _s = _internal_mutable_host();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcMeshPeer.host)
+  return _s;
+}
+inline const std::string& MpcMeshPeer::_internal_host() const {
+  return _impl_.host_.Get();
+}
+inline void MpcMeshPeer::_internal_set_host(const std::string& value) {
+  
+  _impl_.host_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcMeshPeer::_internal_mutable_host() {
+  
+  return _impl_.host_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcMeshPeer::release_host() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcMeshPeer.host)
+  return _impl_.host_.Release();
+}
+inline void MpcMeshPeer::set_allocated_host(std::string* host) {
+  if (host != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.host_.SetAllocated(host, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.host_.IsDefault()) {
+    _impl_.host_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshPeer.host)
+}
+
+// uint32 port = 4;
+inline void MpcMeshPeer::clear_port() {
+  _impl_.port_ = 0u;
+}
+inline uint32_t MpcMeshPeer::_internal_port() const {
+  return _impl_.port_;
+}
+inline uint32_t MpcMeshPeer::port() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshPeer.port)
+  return _internal_port();
+}
+inline void MpcMeshPeer::_internal_set_port(uint32_t value) {
+  
+  _impl_.port_ = value;
+}
+inline void MpcMeshPeer::set_port(uint32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcMeshPeer.port)
+}
+
+// -------------------------------------------------------------------
+
+// MpcMeshSessionRequest
+
+// .mpc_engine.proto.coordinator_node.RequestHeader header = 1;
+inline bool MpcMeshSessionRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MpcMeshSessionRequest::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::coordinator_node::RequestHeader& MpcMeshSessionRequest::_internal_header() const {
+  const ::mpc_engine::proto::coordinator_node::RequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::RequestHeader&>(
+      ::mpc_engine::proto::coordinator_node::_RequestHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::RequestHeader& MpcMeshSessionRequest::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.header)
+  return _internal_header();
+}
+inline void MpcMeshSessionRequest::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::coordinator_node::RequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.header)
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcMeshSessionRequest::release_header() {
+  
+  ::mpc_engine::proto::coordinator_node::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcMeshSessionRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.header)
+  
+  ::mpc_engine::proto::coordinator_node::RequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcMeshSessionRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::RequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::coordinator_node::RequestHeader* MpcMeshSessionRequest::mutable_header() {
+  ::mpc_engine::proto::coordinator_node::RequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.header)
+  return _msg;
+}
+inline void MpcMeshSessionRequest::set_allocated_header(::mpc_engine::proto::coordinator_node::RequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.header)
+}
+
+// .mpc_engine.proto.coordinator_node.MpcRoundRequest session = 2;
+inline bool MpcMeshSessionRequest::_internal_has_session() const {
+  return this != internal_default_instance() && _impl_.session_ != nullptr;
+}
+inline bool MpcMeshSessionRequest::has_session() const {
+  return _internal_has_session();
+}
+inline void MpcMeshSessionRequest::clear_session() {
+  if (GetArenaForAllocation() == nullptr && _impl_.session_ != nullptr) {
+    delete _impl_.session_;
+  }
+  _impl_.session_ = nullptr;
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& MpcMeshSessionRequest::_internal_session() const {
+  const ::mpc_engine::proto::coordinator_node::MpcRoundRequest* p = _impl_.session_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::MpcRoundRequest&>(
+      ::mpc_engine::proto::coordinator_node::_MpcRoundRequest_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcRoundRequest& MpcMeshSessionRequest::session() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.session)
+  return _internal_session();
+}
+inline void MpcMeshSessionRequest::unsafe_arena_set_allocated_session(
+    ::mpc_engine::proto::coordinator_node::MpcRoundRequest* session) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.session_);
+  }
+  _impl_.session_ = session;
+  if (session) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.session)
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* MpcMeshSessionRequest::release_session() {
+  
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* temp = _impl_.session_;
+  _impl_.session_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* MpcMeshSessionRequest::unsafe_arena_release_session() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.session)
+  
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* temp = _impl_.session_;
+  _impl_.session_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* MpcMeshSessionRequest::_internal_mutable_session() {
+  
+  if (_impl_.session_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::MpcRoundRequest>(GetArenaForAllocation());
+    _impl_.session_ = p;
+  }
+  return _impl_.session_;
+}
+inline ::mpc_engine::proto::coordinator_node::MpcRoundRequest* MpcMeshSessionRequest::mutable_session() {
+  ::mpc_engine::proto::coordinator_node::MpcRoundRequest* _msg = _internal_mutable_session();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.session)
+  return _msg;
+}
+inline void MpcMeshSessionRequest::set_allocated_session(::mpc_engine::proto::coordinator_node::MpcRoundRequest* session) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.session_;
+  }
+  if (session) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session);
+    if (message_arena != submessage_arena) {
+      session = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, session, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.session_ = session;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.session)
+}
+
+// repeated .mpc_engine.proto.coordinator_node.MpcMeshPeer peers = 3;
+inline int MpcMeshSessionRequest::_internal_peers_size() const {
+  return _impl_.peers_.size();
+}
+inline int MpcMeshSessionRequest::peers_size() const {
+  return _internal_peers_size();
+}
+inline void MpcMeshSessionRequest::clear_peers() {
+  _impl_.peers_.Clear();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshPeer* MpcMeshSessionRequest::mutable_peers(int index) {
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.peers)
+  return _impl_.peers_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcMeshPeer >*
+MpcMeshSessionRequest::mutable_peers() {
+  // @@protoc_insertion_point(field_mutable_list:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.peers)
+  return &_impl_.peers_;
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcMeshPeer& MpcMeshSessionRequest::_internal_peers(int index) const {
+  return _impl_.peers_.Get(index);
+}
+inline const ::mpc_engine::proto::coordinator_node::MpcMeshPeer& MpcMeshSessionRequest::peers(int index) const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.peers)
+  return _internal_peers(index);
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshPeer* MpcMeshSessionRequest::_internal_add_peers() {
+  return _impl_.peers_.Add();
+}
+inline ::mpc_engine::proto::coordinator_node::MpcMeshPeer* MpcMeshSessionRequest::add_peers() {
+  ::mpc_engine::proto::coordinator_node::MpcMeshPeer* _add = _internal_add_peers();
+  // @@protoc_insertion_point(field_add:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.peers)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mpc_engine::proto::coordinator_node::MpcMeshPeer >&
+MpcMeshSessionRequest::peers() const {
+  // @@protoc_insertion_point(field_list:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.peers)
+  return _impl_.peers_;
+}
+
+// uint32 round_timeout_ms = 4;
+inline void MpcMeshSessionRequest::clear_round_timeout_ms() {
+  _impl_.round_timeout_ms_ = 0u;
+}
+inline uint32_t MpcMeshSessionRequest::_internal_round_timeout_ms() const {
+  return _impl_.round_timeout_ms_;
+}
+inline uint32_t MpcMeshSessionRequest::round_timeout_ms() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.round_timeout_ms)
+  return _internal_round_timeout_ms();
+}
+inline void MpcMeshSessionRequest::_internal_set_round_timeout_ms(uint32_t value) {
+  
+  _impl_.round_timeout_ms_ = value;
+}
+inline void MpcMeshSessionRequest::set_round_timeout_ms(uint32_t value) {
+  _internal_set_round_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcMeshSessionRequest.round_timeout_ms)
+}
+
+// -------------------------------------------------------------------
+
+// MpcMeshSessionResponse
+
+// .mpc_engine.proto.coordinator_node.ResponseHeader header = 1;
+inline bool MpcMeshSessionResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool MpcMeshSessionResponse::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& MpcMeshSessionResponse::_internal_header() const {
+  const ::mpc_engine::proto::coordinator_node::ResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::coordinator_node::ResponseHeader&>(
+      ::mpc_engine::proto::coordinator_node::_ResponseHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::coordinator_node::ResponseHeader& MpcMeshSessionResponse::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.header)
+  return _internal_header();
+}
+inline void MpcMeshSessionResponse::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.header)
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcMeshSessionResponse::release_header() {
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcMeshSessionResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.header)
+  
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcMeshSessionResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::coordinator_node::ResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::coordinator_node::ResponseHeader* MpcMeshSessionResponse::mutable_header() {
+  ::mpc_engine::proto::coordinator_node::ResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.header)
+  return _msg;
+}
+inline void MpcMeshSessionResponse::set_allocated_header(::mpc_engine::proto::coordinator_node::ResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.header)
+}
+
+// string session_id = 2;
+inline void MpcMeshSessionResponse::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& MpcMeshSessionResponse::session_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcMeshSessionResponse::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.session_id)
+}
+inline std::string* MpcMeshSessionResponse::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.session_id)
+  return _s;
+}
+inline const std::string& MpcMeshSessionResponse::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void MpcMeshSessionResponse::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcMeshSessionResponse::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcMeshSessionResponse::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void MpcMeshSessionResponse::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.session_id)
+}
+
+// uint64 player_id = 3;
+inline void MpcMeshSessionResponse::clear_player_id() {
+  _impl_.player_id_ = uint64_t{0u};
+}
+inline uint64_t MpcMeshSessionResponse::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint64_t MpcMeshSessionResponse::player_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.player_id)
+  return _internal_player_id();
+}
+inline void MpcMeshSessionResponse::_internal_set_player_id(uint64_t value) {
+  
+  _impl_.player_id_ = value;
+}
+inline void MpcMeshSessionResponse::set_player_id(uint64_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.player_id)
+}
+
+// uint32 completed_rounds = 4;
+inline void MpcMeshSessionResponse::clear_completed_rounds() {
+  _impl_.completed_rounds_ = 0u;
+}
+inline uint32_t MpcMeshSessionResponse::_internal_completed_rounds() const {
+  return _impl_.completed_rounds_;
+}
+inline uint32_t MpcMeshSessionResponse::completed_rounds() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.completed_rounds)
+  return _internal_completed_rounds();
+}
+inline void MpcMeshSessionResponse::_internal_set_completed_rounds(uint32_t value) {
+  
+  _impl_.completed_rounds_ = value;
+}
+inline void MpcMeshSessionResponse::set_completed_rounds(uint32_t value) {
+  _internal_set_completed_rounds(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.completed_rounds)
+}
+
+// bytes output = 5;
+inline void MpcMeshSessionResponse::clear_output() {
+  _impl_.output_.ClearToEmpty();
+}
+inline const std::string& MpcMeshSessionResponse::output() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.output)
+  return _internal_output();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcMeshSessionResponse::set_output(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.output_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.output)
+}
+inline std::string* MpcMeshSessionResponse::mutable_output() {
+  std::string* _s = _internal_mutable_output();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.output)
+  return _s;
+}
+inline const std::string& MpcMeshSessionResponse::_internal_output() const {
+  return _impl_.output_.Get();
+}
+inline void MpcMeshSessionResponse::_internal_set_output(const std::string& value) {
+  
+  _impl_.output_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcMeshSessionResponse::_internal_mutable_output() {
+  
+  return _impl_.output_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcMeshSessionResponse::release_output() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.output)
+  return _impl_.output_.Release();
+}
+inline void MpcMeshSessionResponse::set_allocated_output(std::string* output) {
+  if (output != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.output_.SetAllocated(output, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.output_.IsDefault()) {
+    _impl_.output_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcMeshSessionResponse.output)
+}
+
+// -------------------------------------------------------------------
+
+// MpcPeerMessage
+
+// string session_id = 1;
+inline void MpcPeerMessage::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+}
+inline const std::string& MpcPeerMessage::session_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcPeerMessage.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcPeerMessage::set_session_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcPeerMessage.session_id)
+}
+inline std::string* MpcPeerMessage::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcPeerMessage.session_id)
+  return _s;
+}
+inline const std::string& MpcPeerMessage::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void MpcPeerMessage::_internal_set_session_id(const std::string& value) {
+  
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcPeerMessage::_internal_mutable_session_id() {
+  
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcPeerMessage::release_session_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcPeerMessage.session_id)
+  return _impl_.session_id_.Release();
+}
+inline void MpcPeerMessage::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcPeerMessage.session_id)
+}
+
+// uint32 round = 2;
+inline void MpcPeerMessage::clear_round() {
+  _impl_.round_ = 0u;
+}
+inline uint32_t MpcPeerMessage::_internal_round() const {
+  return _impl_.round_;
+}
+inline uint32_t MpcPeerMessage::round() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcPeerMessage.round)
+  return _internal_round();
+}
+inline void MpcPeerMessage::_internal_set_round(uint32_t value) {
+  
+  _impl_.round_ = value;
+}
+inline void MpcPeerMessage::set_round(uint32_t value) {
+  _internal_set_round(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcPeerMessage.round)
+}
+
+// uint64 from_player = 3;
+inline void MpcPeerMessage::clear_from_player() {
+  _impl_.from_player_ = uint64_t{0u};
+}
+inline uint64_t MpcPeerMessage::_internal_from_player() const {
+  return _impl_.from_player_;
+}
+inline uint64_t MpcPeerMessage::from_player() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcPeerMessage.from_player)
+  return _internal_from_player();
+}
+inline void MpcPeerMessage::_internal_set_from_player(uint64_t value) {
+  
+  _impl_.from_player_ = value;
+}
+inline void MpcPeerMessage::set_from_player(uint64_t value) {
+  _internal_set_from_player(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcPeerMessage.from_player)
+}
+
+// uint64 to_player = 4;
+inline void MpcPeerMessage::clear_to_player() {
+  _impl_.to_player_ = uint64_t{0u};
+}
+inline uint64_t MpcPeerMessage::_internal_to_player() const {
+  return _impl_.to_player_;
+}
+inline uint64_t MpcPeerMessage::to_player() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcPeerMessage.to_player)
+  return _internal_to_player();
+}
+inline void MpcPeerMessage::_internal_set_to_player(uint64_t value) {
+  
+  _impl_.to_player_ = value;
+}
+inline void MpcPeerMessage::set_to_player(uint64_t value) {
+  _internal_set_to_player(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcPeerMessage.to_player)
+}
+
+// bytes payload = 5;
+inline void MpcPeerMessage::clear_payload() {
+  _impl_.payload_.ClearToEmpty();
+}
+inline const std::string& MpcPeerMessage::payload() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.coordinator_node.MpcPeerMessage.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MpcPeerMessage::set_payload(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.coordinator_node.MpcPeerMessage.payload)
+}
+inline std::string* MpcPeerMessage::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.coordinator_node.MpcPeerMessage.payload)
+  return _s;
+}
+inline const std::string& MpcPeerMessage::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void MpcPeerMessage::_internal_set_payload(const std::string& value) {
+  
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MpcPeerMessage::_internal_mutable_payload() {
+  
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MpcPeerMessage::release_payload() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.coordinator_node.MpcPeerMessage.payload)
+  return _impl_.payload_.Release();
+}
+inline void MpcPeerMessage::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.coordinator_node.MpcPeerMessage.payload)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace coordinator_node
+}  // namespace proto
+}  // namespace mpc_engine
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::mpc_engine::proto::coordinator_node::MpcProtocol> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mpc_engine::proto::coordinator_node::MpcProtocol>() {
+  return ::mpc_engine::proto::coordinator_node::MpcProtocol_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_mpc_2eproto
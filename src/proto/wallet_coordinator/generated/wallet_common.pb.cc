@@ -29,6 +29,7 @@ PROTOBUF_CONSTEXPR WalletRequestHeader::WalletRequestHeader(
   , /*decltype(_impl_.timestamp_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.coordinator_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.message_type_)*/0u
+  , /*decltype(_impl_.timeout_ms_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct WalletRequestHeaderDefaultTypeInternal {
   PROTOBUF_CONSTEXPR WalletRequestHeaderDefaultTypeInternal()
@@ -74,6 +75,7 @@ const uint32_t TableStruct_wallet_5fcommon_2eproto::offsets[] PROTOBUF_SECTION_V
   PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletRequestHeader, _impl_.request_id_),
   PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletRequestHeader, _impl_.timestamp_),
   PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletRequestHeader, _impl_.coordinator_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletRequestHeader, _impl_.timeout_ms_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletResponseHeader, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -88,7 +90,7 @@ const uint32_t TableStruct_wallet_5fcommon_2eproto::offsets[] PROTOBUF_SECTION_V
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::mpc_engine::proto::wallet_coordinator::WalletRequestHeader)},
-  { 10, -1, -1, sizeof(::mpc_engine::proto::wallet_coordinator::WalletResponseHeader)},
+  { 11, -1, -1, sizeof(::mpc_engine::proto::wallet_coordinator::WalletResponseHeader)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -98,17 +100,17 @@ static const ::_pb::Message* const file_default_instances[] = {
 
 const char descriptor_table_protodef_wallet_5fcommon_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\023wallet_common.proto\022#mpc_engine.proto."
-  "wallet_coordinator\"j\n\023WalletRequestHeade"
+  "wallet_coordinator\"~\n\023WalletRequestHeade"
   "r\022\024\n\014message_type\030\001 \001(\r\022\022\n\nrequest_id\030\002 "
   "\001(\t\022\021\n\ttimestamp\030\003 \001(\t\022\026\n\016coordinator_id"
-  "\030\004 \001(\t\"{\n\024WalletResponseHeader\022\024\n\014messag"
-  "e_type\030\001 \001(\r\022\017\n\007success\030\002 \001(\010\022\025\n\rerror_m"
-  "essage\030\003 \001(\t\022\022\n\nrequest_id\030\004 \001(\t\022\021\n\ttime"
-  "stamp\030\005 \001(\tb\006proto3"
+  "\030\004 \001(\t\022\022\n\ntimeout_ms\030\005 \001(\r\"{\n\024WalletResp"
+  "onseHeader\022\024\n\014message_type\030\001 \001(\r\022\017\n\007succ"
+  "ess\030\002 \001(\010\022\025\n\rerror_message\030\003 \001(\t\022\022\n\nrequ"
+  "est_id\030\004 \001(\t\022\021\n\ttimestamp\030\005 \001(\tb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_wallet_5fcommon_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_wallet_5fcommon_2eproto = {
-    false, false, 299, descriptor_table_protodef_wallet_5fcommon_2eproto,
+    false, false, 319, descriptor_table_protodef_wallet_5fcommon_2eproto,
     "wallet_common.proto",
     &descriptor_table_wallet_5fcommon_2eproto_once, nullptr, 0, 2,
     schemas, file_default_instances, TableStruct_wallet_5fcommon_2eproto::offsets,
@@ -145,6 +147,7 @@ WalletRequestHeader::WalletRequestHeader(const WalletRequestHeader& from)
     , decltype(_impl_.timestamp_){}
     , decltype(_impl_.coordinator_id_){}
     , decltype(_impl_.message_type_){}
+    , decltype(_impl_.timeout_ms_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -172,7 +175,9 @@ WalletRequestHeader::WalletRequestHeader(const WalletRequestHeader& from)
     _this->_impl_.coordinator_id_.Set(from._internal_coordinator_id(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.message_type_ = from._impl_.message_type_;
+  ::memcpy(&_impl_.message_type_, &from._impl_.message_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timeout_ms_) -
+    reinterpret_cast<char*>(&_impl_.message_type_)) + sizeof(_impl_.timeout_ms_));
   // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.wallet_coordinator.WalletRequestHeader)
 }
 
@@ -185,6 +190,7 @@ inline void WalletRequestHeader::SharedCtor(
     , decltype(_impl_.timestamp_){}
     , decltype(_impl_.coordinator_id_){}
     , decltype(_impl_.message_type_){0u}
+    , decltype(_impl_.timeout_ms_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.request_id_.InitDefault();
@@ -230,7 +236,9 @@ void WalletRequestHeader::Clear() {
   _impl_.request_id_.ClearToEmpty();
   _impl_.timestamp_.ClearToEmpty();
   _impl_.coordinator_id_.ClearToEmpty();
-  _impl_.message_type_ = 0u;
+  ::memset(&_impl_.message_type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.timeout_ms_) -
+      reinterpret_cast<char*>(&_impl_.message_type_)) + sizeof(_impl_.timeout_ms_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -278,6 +286,14 @@ const char* WalletRequestHeader::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
+      // uint32 timeout_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -343,6 +359,12 @@ uint8_t* WalletRequestHeader::_InternalSerialize(
         4, this->_internal_coordinator_id(), target);
   }
 
+  // uint32 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_timeout_ms(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -385,6 +407,11 @@ size_t WalletRequestHeader::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_message_type());
   }
 
+  // uint32 timeout_ms = 5;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timeout_ms());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -415,6 +442,9 @@ void WalletRequestHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   if (from._internal_message_type() != 0) {
     _this->_internal_set_message_type(from._internal_message_type());
   }
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -446,7 +476,12 @@ void WalletRequestHeader::InternalSwap(WalletRequestHeader* other) {
       &_impl_.coordinator_id_, lhs_arena,
       &other->_impl_.coordinator_id_, rhs_arena
   );
-  swap(_impl_.message_type_, other->_impl_.message_type_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WalletRequestHeader, _impl_.timeout_ms_)
+      + sizeof(WalletRequestHeader::_impl_.timeout_ms_)
+      - PROTOBUF_FIELD_OFFSET(WalletRequestHeader, _impl_.message_type_)>(
+          reinterpret_cast<char*>(&_impl_.message_type_),
+          reinterpret_cast<char*>(&other->_impl_.message_type_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata WalletRequestHeader::GetMetadata() const {
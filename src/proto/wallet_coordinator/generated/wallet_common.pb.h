@@ -191,6 +191,7 @@ class WalletRequestHeader final :
     kTimestampFieldNumber = 3,
     kCoordinatorIdFieldNumber = 4,
     kMessageTypeFieldNumber = 1,
+    kTimeoutMsFieldNumber = 5,
   };
   // string request_id = 2;
   void clear_request_id();
@@ -243,6 +244,15 @@ class WalletRequestHeader final :
   void _internal_set_message_type(uint32_t value);
   public:
 
+  // uint32 timeout_ms = 5;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:mpc_engine.proto.wallet_coordinator.WalletRequestHeader)
  private:
   class _Internal;
@@ -255,6 +265,7 @@ class WalletRequestHeader final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr timestamp_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr coordinator_id_;
     uint32_t message_type_;
+    uint32_t timeout_ms_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -648,6 +659,26 @@ inline void WalletRequestHeader::set_allocated_coordinator_id(std::string* coord
   // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.wallet_coordinator.WalletRequestHeader.coordinator_id)
 }
 
+// uint32 timeout_ms = 5;
+inline void WalletRequestHeader::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
+}
+inline uint32_t WalletRequestHeader::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline uint32_t WalletRequestHeader::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletRequestHeader.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void WalletRequestHeader::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void WalletRequestHeader::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletRequestHeader.timeout_ms)
+}
+
 // -------------------------------------------------------------------
 
 // WalletResponseHeader
@@ -0,0 +1,883 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: wallet_key.proto
+
+#include "wallet_key.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace mpc_engine {
+namespace proto {
+namespace wallet_coordinator {
+PROTOBUF_CONSTEXPR WalletKeyCreateRequest::WalletKeyCreateRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tenant_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.wallet_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.threshold_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WalletKeyCreateRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WalletKeyCreateRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WalletKeyCreateRequestDefaultTypeInternal() {}
+  union {
+    WalletKeyCreateRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WalletKeyCreateRequestDefaultTypeInternal _WalletKeyCreateRequest_default_instance_;
+PROTOBUF_CONSTEXPR WalletKeyCreateResponse::WalletKeyCreateResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.node_ids_)*/{}
+  , /*decltype(_impl_.key_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.public_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.header_)*/nullptr
+  , /*decltype(_impl_.threshold_)*/0u
+  , /*decltype(_impl_.pregenerated_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WalletKeyCreateResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WalletKeyCreateResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WalletKeyCreateResponseDefaultTypeInternal() {}
+  union {
+    WalletKeyCreateResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WalletKeyCreateResponseDefaultTypeInternal _WalletKeyCreateResponse_default_instance_;
+}  // namespace wallet_coordinator
+}  // namespace proto
+}  // namespace mpc_engine
+static ::_pb::Metadata file_level_metadata_wallet_5fkey_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_wallet_5fkey_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_wallet_5fkey_2eproto = nullptr;
+
+const uint32_t TableStruct_wallet_5fkey_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest, _impl_.tenant_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest, _impl_.wallet_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest, _impl_.threshold_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse, _impl_.header_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse, _impl_.key_id_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse, _impl_.public_key_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse, _impl_.threshold_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse, _impl_.node_ids_),
+  PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse, _impl_.pregenerated_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest)},
+  { 10, -1, -1, sizeof(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::mpc_engine::proto::wallet_coordinator::_WalletKeyCreateRequest_default_instance_._instance,
+  &::mpc_engine::proto::wallet_coordinator::_WalletKeyCreateResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_wallet_5fkey_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020wallet_key.proto\022#mpc_engine.proto.wal"
+  "let_coordinator\032\023wallet_common.proto\"\233\001\n"
+  "\026WalletKeyCreateRequest\022H\n\006header\030\001 \001(\0132"
+  "8.mpc_engine.proto.wallet_coordinator.Wa"
+  "lletRequestHeader\022\021\n\ttenant_id\030\002 \001(\t\022\021\n\t"
+  "wallet_id\030\003 \001(\t\022\021\n\tthreshold\030\004 \001(\r\"\303\001\n\027W"
+  "alletKeyCreateResponse\022I\n\006header\030\001 \001(\01329"
+  ".mpc_engine.proto.wallet_coordinator.Wal"
+  "letResponseHeader\022\016\n\006key_id\030\002 \001(\t\022\022\n\npub"
+  "lic_key\030\003 \001(\t\022\021\n\tthreshold\030\004 \001(\r\022\020\n\010node"
+  "_ids\030\005 \003(\t\022\024\n\014pregenerated\030\006 \001(\010b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_wallet_5fkey_2eproto_deps[1] = {
+  &::descriptor_table_wallet_5fcommon_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_wallet_5fkey_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_wallet_5fkey_2eproto = {
+    false, false, 440, descriptor_table_protodef_wallet_5fkey_2eproto,
+    "wallet_key.proto",
+    &descriptor_table_wallet_5fkey_2eproto_once, descriptor_table_wallet_5fkey_2eproto_deps, 1, 2,
+    schemas, file_default_instances, TableStruct_wallet_5fkey_2eproto::offsets,
+    file_level_metadata_wallet_5fkey_2eproto, file_level_enum_descriptors_wallet_5fkey_2eproto,
+    file_level_service_descriptors_wallet_5fkey_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_wallet_5fkey_2eproto_getter() {
+  return &descriptor_table_wallet_5fkey_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_wallet_5fkey_2eproto(&descriptor_table_wallet_5fkey_2eproto);
+namespace mpc_engine {
+namespace proto {
+namespace wallet_coordinator {
+
+// ===================================================================
+
+class WalletKeyCreateRequest::_Internal {
+ public:
+  static const ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader& header(const WalletKeyCreateRequest* msg);
+};
+
+const ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader&
+WalletKeyCreateRequest::_Internal::header(const WalletKeyCreateRequest* msg) {
+  return *msg->_impl_.header_;
+}
+void WalletKeyCreateRequest::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+WalletKeyCreateRequest::WalletKeyCreateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+}
+WalletKeyCreateRequest::WalletKeyCreateRequest(const WalletKeyCreateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WalletKeyCreateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tenant_id_){}
+    , decltype(_impl_.wallet_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.threshold_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.tenant_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tenant_id().empty()) {
+    _this->_impl_.tenant_id_.Set(from._internal_tenant_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.wallet_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.wallet_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_wallet_id().empty()) {
+    _this->_impl_.wallet_id_.Set(from._internal_wallet_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader(*from._impl_.header_);
+  }
+  _this->_impl_.threshold_ = from._impl_.threshold_;
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+}
+
+inline void WalletKeyCreateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tenant_id_){}
+    , decltype(_impl_.wallet_id_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.threshold_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.tenant_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.wallet_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.wallet_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WalletKeyCreateRequest::~WalletKeyCreateRequest() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WalletKeyCreateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tenant_id_.Destroy();
+  _impl_.wallet_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void WalletKeyCreateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WalletKeyCreateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tenant_id_.ClearToEmpty();
+  _impl_.wallet_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  _impl_.threshold_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WalletKeyCreateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.wallet_coordinator.WalletRequestHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string tenant_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_tenant_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.tenant_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string wallet_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_wallet_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.wallet_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 threshold = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WalletKeyCreateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.wallet_coordinator.WalletRequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string tenant_id = 2;
+  if (!this->_internal_tenant_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_tenant_id().data(), static_cast<int>(this->_internal_tenant_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.tenant_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_tenant_id(), target);
+  }
+
+  // string wallet_id = 3;
+  if (!this->_internal_wallet_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_wallet_id().data(), static_cast<int>(this->_internal_wallet_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.wallet_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_wallet_id(), target);
+  }
+
+  // uint32 threshold = 4;
+  if (this->_internal_threshold() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_threshold(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+  return target;
+}
+
+size_t WalletKeyCreateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string tenant_id = 2;
+  if (!this->_internal_tenant_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_tenant_id());
+  }
+
+  // string wallet_id = 3;
+  if (!this->_internal_wallet_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_wallet_id());
+  }
+
+  // .mpc_engine.proto.wallet_coordinator.WalletRequestHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 threshold = 4;
+  if (this->_internal_threshold() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_threshold());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WalletKeyCreateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WalletKeyCreateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WalletKeyCreateRequest::GetClassData() const { return &_class_data_; }
+
+
+void WalletKeyCreateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WalletKeyCreateRequest*>(&to_msg);
+  auto& from = static_cast<const WalletKeyCreateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_tenant_id().empty()) {
+    _this->_internal_set_tenant_id(from._internal_tenant_id());
+  }
+  if (!from._internal_wallet_id().empty()) {
+    _this->_internal_set_wallet_id(from._internal_wallet_id());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::wallet_coordinator::WalletRequestHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_threshold() != 0) {
+    _this->_internal_set_threshold(from._internal_threshold());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WalletKeyCreateRequest::CopyFrom(const WalletKeyCreateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WalletKeyCreateRequest::IsInitialized() const {
+  return true;
+}
+
+void WalletKeyCreateRequest::InternalSwap(WalletKeyCreateRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.tenant_id_, lhs_arena,
+      &other->_impl_.tenant_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.wallet_id_, lhs_arena,
+      &other->_impl_.wallet_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WalletKeyCreateRequest, _impl_.threshold_)
+      + sizeof(WalletKeyCreateRequest::_impl_.threshold_)
+      - PROTOBUF_FIELD_OFFSET(WalletKeyCreateRequest, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WalletKeyCreateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wallet_5fkey_2eproto_getter, &descriptor_table_wallet_5fkey_2eproto_once,
+      file_level_metadata_wallet_5fkey_2eproto[0]);
+}
+
+// ===================================================================
+
+class WalletKeyCreateResponse::_Internal {
+ public:
+  static const ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader& header(const WalletKeyCreateResponse* msg);
+};
+
+const ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader&
+WalletKeyCreateResponse::_Internal::header(const WalletKeyCreateResponse* msg) {
+  return *msg->_impl_.header_;
+}
+void WalletKeyCreateResponse::clear_header() {
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+}
+WalletKeyCreateResponse::WalletKeyCreateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+}
+WalletKeyCreateResponse::WalletKeyCreateResponse(const WalletKeyCreateResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WalletKeyCreateResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_ids_){from._impl_.node_ids_}
+    , decltype(_impl_.key_id_){}
+    , decltype(_impl_.public_key_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.threshold_){}
+    , decltype(_impl_.pregenerated_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key_id().empty()) {
+    _this->_impl_.key_id_.Set(from._internal_key_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.public_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.public_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_public_key().empty()) {
+    _this->_impl_.public_key_.Set(from._internal_public_key(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_header()) {
+    _this->_impl_.header_ = new ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader(*from._impl_.header_);
+  }
+  ::memcpy(&_impl_.threshold_, &from._impl_.threshold_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.pregenerated_) -
+    reinterpret_cast<char*>(&_impl_.threshold_)) + sizeof(_impl_.pregenerated_));
+  // @@protoc_insertion_point(copy_constructor:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+}
+
+inline void WalletKeyCreateResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.node_ids_){arena}
+    , decltype(_impl_.key_id_){}
+    , decltype(_impl_.public_key_){}
+    , decltype(_impl_.header_){nullptr}
+    , decltype(_impl_.threshold_){0u}
+    , decltype(_impl_.pregenerated_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.public_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.public_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WalletKeyCreateResponse::~WalletKeyCreateResponse() {
+  // @@protoc_insertion_point(destructor:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WalletKeyCreateResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.node_ids_.~RepeatedPtrField();
+  _impl_.key_id_.Destroy();
+  _impl_.public_key_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.header_;
+}
+
+void WalletKeyCreateResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WalletKeyCreateResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.node_ids_.Clear();
+  _impl_.key_id_.ClearToEmpty();
+  _impl_.public_key_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.header_ != nullptr) {
+    delete _impl_.header_;
+  }
+  _impl_.header_ = nullptr;
+  ::memset(&_impl_.threshold_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.pregenerated_) -
+      reinterpret_cast<char*>(&_impl_.threshold_)) + sizeof(_impl_.pregenerated_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WalletKeyCreateResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mpc_engine.proto.wallet_coordinator.WalletResponseHeader header = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_header(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string key_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.key_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string public_key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_public_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.public_key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 threshold = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string node_ids = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_node_ids();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool pregenerated = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.pregenerated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WalletKeyCreateResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mpc_engine.proto.wallet_coordinator.WalletResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::header(this),
+        _Internal::header(this).GetCachedSize(), target, stream);
+  }
+
+  // string key_id = 2;
+  if (!this->_internal_key_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key_id().data(), static_cast<int>(this->_internal_key_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.key_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_key_id(), target);
+  }
+
+  // string public_key = 3;
+  if (!this->_internal_public_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_public_key().data(), static_cast<int>(this->_internal_public_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.public_key");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_public_key(), target);
+  }
+
+  // uint32 threshold = 4;
+  if (this->_internal_threshold() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_threshold(), target);
+  }
+
+  // repeated string node_ids = 5;
+  for (int i = 0, n = this->_internal_node_ids_size(); i < n; i++) {
+    const auto& s = this->_internal_node_ids(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids");
+    target = stream->WriteString(5, s, target);
+  }
+
+  // bool pregenerated = 6;
+  if (this->_internal_pregenerated() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_pregenerated(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+  return target;
+}
+
+size_t WalletKeyCreateResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string node_ids = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.node_ids_.size());
+  for (int i = 0, n = _impl_.node_ids_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.node_ids_.Get(i));
+  }
+
+  // string key_id = 2;
+  if (!this->_internal_key_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key_id());
+  }
+
+  // string public_key = 3;
+  if (!this->_internal_public_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_public_key());
+  }
+
+  // .mpc_engine.proto.wallet_coordinator.WalletResponseHeader header = 1;
+  if (this->_internal_has_header()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.header_);
+  }
+
+  // uint32 threshold = 4;
+  if (this->_internal_threshold() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_threshold());
+  }
+
+  // bool pregenerated = 6;
+  if (this->_internal_pregenerated() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WalletKeyCreateResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WalletKeyCreateResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WalletKeyCreateResponse::GetClassData() const { return &_class_data_; }
+
+
+void WalletKeyCreateResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WalletKeyCreateResponse*>(&to_msg);
+  auto& from = static_cast<const WalletKeyCreateResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.node_ids_.MergeFrom(from._impl_.node_ids_);
+  if (!from._internal_key_id().empty()) {
+    _this->_internal_set_key_id(from._internal_key_id());
+  }
+  if (!from._internal_public_key().empty()) {
+    _this->_internal_set_public_key(from._internal_public_key());
+  }
+  if (from._internal_has_header()) {
+    _this->_internal_mutable_header()->::mpc_engine::proto::wallet_coordinator::WalletResponseHeader::MergeFrom(
+        from._internal_header());
+  }
+  if (from._internal_threshold() != 0) {
+    _this->_internal_set_threshold(from._internal_threshold());
+  }
+  if (from._internal_pregenerated() != 0) {
+    _this->_internal_set_pregenerated(from._internal_pregenerated());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WalletKeyCreateResponse::CopyFrom(const WalletKeyCreateResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WalletKeyCreateResponse::IsInitialized() const {
+  return true;
+}
+
+void WalletKeyCreateResponse::InternalSwap(WalletKeyCreateResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.node_ids_.InternalSwap(&other->_impl_.node_ids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_id_, lhs_arena,
+      &other->_impl_.key_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.public_key_, lhs_arena,
+      &other->_impl_.public_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WalletKeyCreateResponse, _impl_.pregenerated_)
+      + sizeof(WalletKeyCreateResponse::_impl_.pregenerated_)
+      - PROTOBUF_FIELD_OFFSET(WalletKeyCreateResponse, _impl_.header_)>(
+          reinterpret_cast<char*>(&_impl_.header_),
+          reinterpret_cast<char*>(&other->_impl_.header_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WalletKeyCreateResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_wallet_5fkey_2eproto_getter, &descriptor_table_wallet_5fkey_2eproto_once,
+      file_level_metadata_wallet_5fkey_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace wallet_coordinator
+}  // namespace proto
+}  // namespace mpc_engine
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse*
+Arena::CreateMaybeMessage< ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1040 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: wallet_key.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_wallet_5fkey_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_wallet_5fkey_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "wallet_common.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_wallet_5fkey_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_wallet_5fkey_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_wallet_5fkey_2eproto;
+namespace mpc_engine {
+namespace proto {
+namespace wallet_coordinator {
+class WalletKeyCreateRequest;
+struct WalletKeyCreateRequestDefaultTypeInternal;
+extern WalletKeyCreateRequestDefaultTypeInternal _WalletKeyCreateRequest_default_instance_;
+class WalletKeyCreateResponse;
+struct WalletKeyCreateResponseDefaultTypeInternal;
+extern WalletKeyCreateResponseDefaultTypeInternal _WalletKeyCreateResponse_default_instance_;
+}  // namespace wallet_coordinator
+}  // namespace proto
+}  // namespace mpc_engine
+PROTOBUF_NAMESPACE_OPEN
+template<> ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* Arena::CreateMaybeMessage<::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest>(Arena*);
+template<> ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* Arena::CreateMaybeMessage<::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace mpc_engine {
+namespace proto {
+namespace wallet_coordinator {
+
+// ===================================================================
+
+class WalletKeyCreateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest) */ {
+ public:
+  inline WalletKeyCreateRequest() : WalletKeyCreateRequest(nullptr) {}
+  ~WalletKeyCreateRequest() override;
+  explicit PROTOBUF_CONSTEXPR WalletKeyCreateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WalletKeyCreateRequest(const WalletKeyCreateRequest& from);
+  WalletKeyCreateRequest(WalletKeyCreateRequest&& from) noexcept
+    : WalletKeyCreateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WalletKeyCreateRequest& operator=(const WalletKeyCreateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WalletKeyCreateRequest& operator=(WalletKeyCreateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WalletKeyCreateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WalletKeyCreateRequest* internal_default_instance() {
+    return reinterpret_cast<const WalletKeyCreateRequest*>(
+               &_WalletKeyCreateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(WalletKeyCreateRequest& a, WalletKeyCreateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WalletKeyCreateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WalletKeyCreateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WalletKeyCreateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WalletKeyCreateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WalletKeyCreateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WalletKeyCreateRequest& from) {
+    WalletKeyCreateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WalletKeyCreateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest";
+  }
+  protected:
+  explicit WalletKeyCreateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTenantIdFieldNumber = 2,
+    kWalletIdFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kThresholdFieldNumber = 4,
+  };
+  // string tenant_id = 2;
+  void clear_tenant_id();
+  const std::string& tenant_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tenant_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_tenant_id();
+  PROTOBUF_NODISCARD std::string* release_tenant_id();
+  void set_allocated_tenant_id(std::string* tenant_id);
+  private:
+  const std::string& _internal_tenant_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tenant_id(const std::string& value);
+  std::string* _internal_mutable_tenant_id();
+  public:
+
+  // string wallet_id = 3;
+  void clear_wallet_id();
+  const std::string& wallet_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_wallet_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_wallet_id();
+  PROTOBUF_NODISCARD std::string* release_wallet_id();
+  void set_allocated_wallet_id(std::string* wallet_id);
+  private:
+  const std::string& _internal_wallet_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_wallet_id(const std::string& value);
+  std::string* _internal_mutable_wallet_id();
+  public:
+
+  // .mpc_engine.proto.wallet_coordinator.WalletRequestHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* release_header();
+  ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* header);
+  private:
+  const ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader& _internal_header() const;
+  ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* header);
+  ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* unsafe_arena_release_header();
+
+  // uint32 threshold = 4;
+  void clear_threshold();
+  uint32_t threshold() const;
+  void set_threshold(uint32_t value);
+  private:
+  uint32_t _internal_threshold() const;
+  void _internal_set_threshold(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tenant_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr wallet_id_;
+    ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* header_;
+    uint32_t threshold_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wallet_5fkey_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WalletKeyCreateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse) */ {
+ public:
+  inline WalletKeyCreateResponse() : WalletKeyCreateResponse(nullptr) {}
+  ~WalletKeyCreateResponse() override;
+  explicit PROTOBUF_CONSTEXPR WalletKeyCreateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WalletKeyCreateResponse(const WalletKeyCreateResponse& from);
+  WalletKeyCreateResponse(WalletKeyCreateResponse&& from) noexcept
+    : WalletKeyCreateResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline WalletKeyCreateResponse& operator=(const WalletKeyCreateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WalletKeyCreateResponse& operator=(WalletKeyCreateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WalletKeyCreateResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WalletKeyCreateResponse* internal_default_instance() {
+    return reinterpret_cast<const WalletKeyCreateResponse*>(
+               &_WalletKeyCreateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(WalletKeyCreateResponse& a, WalletKeyCreateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WalletKeyCreateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WalletKeyCreateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WalletKeyCreateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WalletKeyCreateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WalletKeyCreateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WalletKeyCreateResponse& from) {
+    WalletKeyCreateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WalletKeyCreateResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse";
+  }
+  protected:
+  explicit WalletKeyCreateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodeIdsFieldNumber = 5,
+    kKeyIdFieldNumber = 2,
+    kPublicKeyFieldNumber = 3,
+    kHeaderFieldNumber = 1,
+    kThresholdFieldNumber = 4,
+    kPregeneratedFieldNumber = 6,
+  };
+  // repeated string node_ids = 5;
+  int node_ids_size() const;
+  private:
+  int _internal_node_ids_size() const;
+  public:
+  void clear_node_ids();
+  const std::string& node_ids(int index) const;
+  std::string* mutable_node_ids(int index);
+  void set_node_ids(int index, const std::string& value);
+  void set_node_ids(int index, std::string&& value);
+  void set_node_ids(int index, const char* value);
+  void set_node_ids(int index, const char* value, size_t size);
+  std::string* add_node_ids();
+  void add_node_ids(const std::string& value);
+  void add_node_ids(std::string&& value);
+  void add_node_ids(const char* value);
+  void add_node_ids(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& node_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_node_ids();
+  private:
+  const std::string& _internal_node_ids(int index) const;
+  std::string* _internal_add_node_ids();
+  public:
+
+  // string key_id = 2;
+  void clear_key_id();
+  const std::string& key_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key_id();
+  PROTOBUF_NODISCARD std::string* release_key_id();
+  void set_allocated_key_id(std::string* key_id);
+  private:
+  const std::string& _internal_key_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key_id(const std::string& value);
+  std::string* _internal_mutable_key_id();
+  public:
+
+  // string public_key = 3;
+  void clear_public_key();
+  const std::string& public_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_public_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_public_key();
+  PROTOBUF_NODISCARD std::string* release_public_key();
+  void set_allocated_public_key(std::string* public_key);
+  private:
+  const std::string& _internal_public_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_public_key(const std::string& value);
+  std::string* _internal_mutable_public_key();
+  public:
+
+  // .mpc_engine.proto.wallet_coordinator.WalletResponseHeader header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader& header() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* release_header();
+  ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* mutable_header();
+  void set_allocated_header(::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* header);
+  private:
+  const ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader& _internal_header() const;
+  ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* _internal_mutable_header();
+  public:
+  void unsafe_arena_set_allocated_header(
+      ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* header);
+  ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* unsafe_arena_release_header();
+
+  // uint32 threshold = 4;
+  void clear_threshold();
+  uint32_t threshold() const;
+  void set_threshold(uint32_t value);
+  private:
+  uint32_t _internal_threshold() const;
+  void _internal_set_threshold(uint32_t value);
+  public:
+
+  // bool pregenerated = 6;
+  void clear_pregenerated();
+  bool pregenerated() const;
+  void set_pregenerated(bool value);
+  private:
+  bool _internal_pregenerated() const;
+  void _internal_set_pregenerated(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> node_ids_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr public_key_;
+    ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* header_;
+    uint32_t threshold_;
+    bool pregenerated_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wallet_5fkey_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// WalletKeyCreateRequest
+
+// .mpc_engine.proto.wallet_coordinator.WalletRequestHeader header = 1;
+inline bool WalletKeyCreateRequest::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool WalletKeyCreateRequest::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader& WalletKeyCreateRequest::_internal_header() const {
+  const ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader&>(
+      ::mpc_engine::proto::wallet_coordinator::_WalletRequestHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader& WalletKeyCreateRequest::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.header)
+  return _internal_header();
+}
+inline void WalletKeyCreateRequest::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.header)
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* WalletKeyCreateRequest::release_header() {
+  
+  ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* WalletKeyCreateRequest::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.header)
+  
+  ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* WalletKeyCreateRequest::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::wallet_coordinator::WalletRequestHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* WalletKeyCreateRequest::mutable_header() {
+  ::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.header)
+  return _msg;
+}
+inline void WalletKeyCreateRequest::set_allocated_header(::mpc_engine::proto::wallet_coordinator::WalletRequestHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.header)
+}
+
+// string tenant_id = 2;
+inline void WalletKeyCreateRequest::clear_tenant_id() {
+  _impl_.tenant_id_.ClearToEmpty();
+}
+inline const std::string& WalletKeyCreateRequest::tenant_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.tenant_id)
+  return _internal_tenant_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WalletKeyCreateRequest::set_tenant_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.tenant_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.tenant_id)
+}
+inline std::string* WalletKeyCreateRequest::mutable_tenant_id() {
+  std::string* _s = _internal_mutable_tenant_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.tenant_id)
+  return _s;
+}
+inline const std::string& WalletKeyCreateRequest::_internal_tenant_id() const {
+  return _impl_.tenant_id_.Get();
+}
+inline void WalletKeyCreateRequest::_internal_set_tenant_id(const std::string& value) {
+  
+  _impl_.tenant_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WalletKeyCreateRequest::_internal_mutable_tenant_id() {
+  
+  return _impl_.tenant_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WalletKeyCreateRequest::release_tenant_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.tenant_id)
+  return _impl_.tenant_id_.Release();
+}
+inline void WalletKeyCreateRequest::set_allocated_tenant_id(std::string* tenant_id) {
+  if (tenant_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.tenant_id_.SetAllocated(tenant_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tenant_id_.IsDefault()) {
+    _impl_.tenant_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.tenant_id)
+}
+
+// string wallet_id = 3;
+inline void WalletKeyCreateRequest::clear_wallet_id() {
+  _impl_.wallet_id_.ClearToEmpty();
+}
+inline const std::string& WalletKeyCreateRequest::wallet_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.wallet_id)
+  return _internal_wallet_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WalletKeyCreateRequest::set_wallet_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.wallet_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.wallet_id)
+}
+inline std::string* WalletKeyCreateRequest::mutable_wallet_id() {
+  std::string* _s = _internal_mutable_wallet_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.wallet_id)
+  return _s;
+}
+inline const std::string& WalletKeyCreateRequest::_internal_wallet_id() const {
+  return _impl_.wallet_id_.Get();
+}
+inline void WalletKeyCreateRequest::_internal_set_wallet_id(const std::string& value) {
+  
+  _impl_.wallet_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WalletKeyCreateRequest::_internal_mutable_wallet_id() {
+  
+  return _impl_.wallet_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WalletKeyCreateRequest::release_wallet_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.wallet_id)
+  return _impl_.wallet_id_.Release();
+}
+inline void WalletKeyCreateRequest::set_allocated_wallet_id(std::string* wallet_id) {
+  if (wallet_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.wallet_id_.SetAllocated(wallet_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.wallet_id_.IsDefault()) {
+    _impl_.wallet_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.wallet_id)
+}
+
+// uint32 threshold = 4;
+inline void WalletKeyCreateRequest::clear_threshold() {
+  _impl_.threshold_ = 0u;
+}
+inline uint32_t WalletKeyCreateRequest::_internal_threshold() const {
+  return _impl_.threshold_;
+}
+inline uint32_t WalletKeyCreateRequest::threshold() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.threshold)
+  return _internal_threshold();
+}
+inline void WalletKeyCreateRequest::_internal_set_threshold(uint32_t value) {
+  
+  _impl_.threshold_ = value;
+}
+inline void WalletKeyCreateRequest::set_threshold(uint32_t value) {
+  _internal_set_threshold(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest.threshold)
+}
+
+// -------------------------------------------------------------------
+
+// WalletKeyCreateResponse
+
+// .mpc_engine.proto.wallet_coordinator.WalletResponseHeader header = 1;
+inline bool WalletKeyCreateResponse::_internal_has_header() const {
+  return this != internal_default_instance() && _impl_.header_ != nullptr;
+}
+inline bool WalletKeyCreateResponse::has_header() const {
+  return _internal_has_header();
+}
+inline const ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader& WalletKeyCreateResponse::_internal_header() const {
+  const ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* p = _impl_.header_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader&>(
+      ::mpc_engine::proto::wallet_coordinator::_WalletResponseHeader_default_instance_);
+}
+inline const ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader& WalletKeyCreateResponse::header() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.header)
+  return _internal_header();
+}
+inline void WalletKeyCreateResponse::unsafe_arena_set_allocated_header(
+    ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* header) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  _impl_.header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.header)
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* WalletKeyCreateResponse::release_header() {
+  
+  ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* WalletKeyCreateResponse::unsafe_arena_release_header() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.header)
+  
+  ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* temp = _impl_.header_;
+  _impl_.header_ = nullptr;
+  return temp;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* WalletKeyCreateResponse::_internal_mutable_header() {
+  
+  if (_impl_.header_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mpc_engine::proto::wallet_coordinator::WalletResponseHeader>(GetArenaForAllocation());
+    _impl_.header_ = p;
+  }
+  return _impl_.header_;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* WalletKeyCreateResponse::mutable_header() {
+  ::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* _msg = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.header)
+  return _msg;
+}
+inline void WalletKeyCreateResponse::set_allocated_header(::mpc_engine::proto::wallet_coordinator::WalletResponseHeader* header) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.header_);
+  }
+  if (header) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(header));
+    if (message_arena != submessage_arena) {
+      header = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, header, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.header_ = header;
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.header)
+}
+
+// string key_id = 2;
+inline void WalletKeyCreateResponse::clear_key_id() {
+  _impl_.key_id_.ClearToEmpty();
+}
+inline const std::string& WalletKeyCreateResponse::key_id() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.key_id)
+  return _internal_key_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WalletKeyCreateResponse::set_key_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.key_id)
+}
+inline std::string* WalletKeyCreateResponse::mutable_key_id() {
+  std::string* _s = _internal_mutable_key_id();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.key_id)
+  return _s;
+}
+inline const std::string& WalletKeyCreateResponse::_internal_key_id() const {
+  return _impl_.key_id_.Get();
+}
+inline void WalletKeyCreateResponse::_internal_set_key_id(const std::string& value) {
+  
+  _impl_.key_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WalletKeyCreateResponse::_internal_mutable_key_id() {
+  
+  return _impl_.key_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WalletKeyCreateResponse::release_key_id() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.key_id)
+  return _impl_.key_id_.Release();
+}
+inline void WalletKeyCreateResponse::set_allocated_key_id(std::string* key_id) {
+  if (key_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_id_.SetAllocated(key_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_id_.IsDefault()) {
+    _impl_.key_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.key_id)
+}
+
+// string public_key = 3;
+inline void WalletKeyCreateResponse::clear_public_key() {
+  _impl_.public_key_.ClearToEmpty();
+}
+inline const std::string& WalletKeyCreateResponse::public_key() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.public_key)
+  return _internal_public_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WalletKeyCreateResponse::set_public_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.public_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.public_key)
+}
+inline std::string* WalletKeyCreateResponse::mutable_public_key() {
+  std::string* _s = _internal_mutable_public_key();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.public_key)
+  return _s;
+}
+inline const std::string& WalletKeyCreateResponse::_internal_public_key() const {
+  return _impl_.public_key_.Get();
+}
+inline void WalletKeyCreateResponse::_internal_set_public_key(const std::string& value) {
+  
+  _impl_.public_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WalletKeyCreateResponse::_internal_mutable_public_key() {
+  
+  return _impl_.public_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WalletKeyCreateResponse::release_public_key() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.public_key)
+  return _impl_.public_key_.Release();
+}
+inline void WalletKeyCreateResponse::set_allocated_public_key(std::string* public_key) {
+  if (public_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.public_key_.SetAllocated(public_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.public_key_.IsDefault()) {
+    _impl_.public_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.public_key)
+}
+
+// uint32 threshold = 4;
+inline void WalletKeyCreateResponse::clear_threshold() {
+  _impl_.threshold_ = 0u;
+}
+inline uint32_t WalletKeyCreateResponse::_internal_threshold() const {
+  return _impl_.threshold_;
+}
+inline uint32_t WalletKeyCreateResponse::threshold() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.threshold)
+  return _internal_threshold();
+}
+inline void WalletKeyCreateResponse::_internal_set_threshold(uint32_t value) {
+  
+  _impl_.threshold_ = value;
+}
+inline void WalletKeyCreateResponse::set_threshold(uint32_t value) {
+  _internal_set_threshold(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.threshold)
+}
+
+// repeated string node_ids = 5;
+inline int WalletKeyCreateResponse::_internal_node_ids_size() const {
+  return _impl_.node_ids_.size();
+}
+inline int WalletKeyCreateResponse::node_ids_size() const {
+  return _internal_node_ids_size();
+}
+inline void WalletKeyCreateResponse::clear_node_ids() {
+  _impl_.node_ids_.Clear();
+}
+inline std::string* WalletKeyCreateResponse::add_node_ids() {
+  std::string* _s = _internal_add_node_ids();
+  // @@protoc_insertion_point(field_add_mutable:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+  return _s;
+}
+inline const std::string& WalletKeyCreateResponse::_internal_node_ids(int index) const {
+  return _impl_.node_ids_.Get(index);
+}
+inline const std::string& WalletKeyCreateResponse::node_ids(int index) const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+  return _internal_node_ids(index);
+}
+inline std::string* WalletKeyCreateResponse::mutable_node_ids(int index) {
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+  return _impl_.node_ids_.Mutable(index);
+}
+inline void WalletKeyCreateResponse::set_node_ids(int index, const std::string& value) {
+  _impl_.node_ids_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+}
+inline void WalletKeyCreateResponse::set_node_ids(int index, std::string&& value) {
+  _impl_.node_ids_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+}
+inline void WalletKeyCreateResponse::set_node_ids(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.node_ids_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+}
+inline void WalletKeyCreateResponse::set_node_ids(int index, const char* value, size_t size) {
+  _impl_.node_ids_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+}
+inline std::string* WalletKeyCreateResponse::_internal_add_node_ids() {
+  return _impl_.node_ids_.Add();
+}
+inline void WalletKeyCreateResponse::add_node_ids(const std::string& value) {
+  _impl_.node_ids_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+}
+inline void WalletKeyCreateResponse::add_node_ids(std::string&& value) {
+  _impl_.node_ids_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+}
+inline void WalletKeyCreateResponse::add_node_ids(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.node_ids_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+}
+inline void WalletKeyCreateResponse::add_node_ids(const char* value, size_t size) {
+  _impl_.node_ids_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+WalletKeyCreateResponse::node_ids() const {
+  // @@protoc_insertion_point(field_list:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+  return _impl_.node_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+WalletKeyCreateResponse::mutable_node_ids() {
+  // @@protoc_insertion_point(field_mutable_list:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.node_ids)
+  return &_impl_.node_ids_;
+}
+
+// bool pregenerated = 6;
+inline void WalletKeyCreateResponse::clear_pregenerated() {
+  _impl_.pregenerated_ = false;
+}
+inline bool WalletKeyCreateResponse::_internal_pregenerated() const {
+  return _impl_.pregenerated_;
+}
+inline bool WalletKeyCreateResponse::pregenerated() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.pregenerated)
+  return _internal_pregenerated();
+}
+inline void WalletKeyCreateResponse::_internal_set_pregenerated(bool value) {
+  
+  _impl_.pregenerated_ = value;
+}
+inline void WalletKeyCreateResponse::set_pregenerated(bool value) {
+  _internal_set_pregenerated(value);
+  // @@protoc_insertion_point(field_set:mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse.pregenerated)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace wallet_coordinator
+}  // namespace proto
+}  // namespace mpc_engine
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_wallet_5fkey_2eproto
@@ -55,6 +55,8 @@ const uint32_t TableStruct_wallet_5fmessage_2eproto::offsets[] PROTOBUF_SECTION_
   PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletCoordinatorMessage, _impl_.message_type_),
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
   PROTOBUF_FIELD_OFFSET(::mpc_engine::proto::wallet_coordinator::WalletCoordinatorMessage, _impl_.payload_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -68,23 +70,29 @@ static const ::_pb::Message* const file_default_instances[] = {
 const char descriptor_table_protodef_wallet_5fmessage_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\024wallet_message.proto\022#mpc_engine.proto"
   ".wallet_coordinator\032\023wallet_common.proto"
-  "\032\024wallet_signing.proto\"\351\001\n\030WalletCoordin"
-  "atorMessage\022\024\n\014message_type\030\001 \001(\r\022T\n\017sig"
-  "ning_request\030\002 \001(\01329.mpc_engine.proto.wa"
-  "llet_coordinator.WalletSigningRequestH\000\022"
-  "V\n\020signing_response\030\003 \001(\0132:.mpc_engine.p"
-  "roto.wallet_coordinator.WalletSigningRes"
-  "ponseH\000B\t\n\007payloadb\006proto3"
+  "\032\024wallet_signing.proto\032\020wallet_key.proto"
+  "\"\241\003\n\030WalletCoordinatorMessage\022\024\n\014message"
+  "_type\030\001 \001(\r\022T\n\017signing_request\030\002 \001(\01329.m"
+  "pc_engine.proto.wallet_coordinator.Walle"
+  "tSigningRequestH\000\022V\n\020signing_response\030\003 "
+  "\001(\0132:.mpc_engine.proto.wallet_coordinato"
+  "r.WalletSigningResponseH\000\022Y\n\022key_create_"
+  "request\030\004 \001(\0132;.mpc_engine.proto.wallet_"
+  "coordinator.WalletKeyCreateRequestH\000\022[\n\023"
+  "key_create_response\030\005 \001(\0132<.mpc_engine.p"
+  "roto.wallet_coordinator.WalletKeyCreateR"
+  "esponseH\000B\t\n\007payloadb\006proto3"
   ;
-static const ::_pbi::DescriptorTable* const descriptor_table_wallet_5fmessage_2eproto_deps[2] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_wallet_5fmessage_2eproto_deps[3] = {
   &::descriptor_table_wallet_5fcommon_2eproto,
+  &::descriptor_table_wallet_5fkey_2eproto,
   &::descriptor_table_wallet_5fsigning_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_wallet_5fmessage_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_wallet_5fmessage_2eproto = {
-    false, false, 346, descriptor_table_protodef_wallet_5fmessage_2eproto,
+    false, false, 548, descriptor_table_protodef_wallet_5fmessage_2eproto,
     "wallet_message.proto",
-    &descriptor_table_wallet_5fmessage_2eproto_once, descriptor_table_wallet_5fmessage_2eproto_deps, 2, 1,
+    &descriptor_table_wallet_5fmessage_2eproto_once, descriptor_table_wallet_5fmessage_2eproto_deps, 3, 1,
     schemas, file_default_instances, TableStruct_wallet_5fmessage_2eproto::offsets,
     file_level_metadata_wallet_5fmessage_2eproto, file_level_enum_descriptors_wallet_5fmessage_2eproto,
     file_level_service_descriptors_wallet_5fmessage_2eproto,
@@ -105,6 +113,8 @@ class WalletCoordinatorMessage::_Internal {
  public:
   static const ::mpc_engine::proto::wallet_coordinator::WalletSigningRequest& signing_request(const WalletCoordinatorMessage* msg);
   static const ::mpc_engine::proto::wallet_coordinator::WalletSigningResponse& signing_response(const WalletCoordinatorMessage* msg);
+  static const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest& key_create_request(const WalletCoordinatorMessage* msg);
+  static const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse& key_create_response(const WalletCoordinatorMessage* msg);
 };
 
 const ::mpc_engine::proto::wallet_coordinator::WalletSigningRequest&
@@ -115,6 +125,14 @@ const ::mpc_engine::proto::wallet_coordinator::WalletSigningResponse&
 WalletCoordinatorMessage::_Internal::signing_response(const WalletCoordinatorMessage* msg) {
   return *msg->_impl_.payload_.signing_response_;
 }
+const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest&
+WalletCoordinatorMessage::_Internal::key_create_request(const WalletCoordinatorMessage* msg) {
+  return *msg->_impl_.payload_.key_create_request_;
+}
+const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse&
+WalletCoordinatorMessage::_Internal::key_create_response(const WalletCoordinatorMessage* msg) {
+  return *msg->_impl_.payload_.key_create_response_;
+}
 void WalletCoordinatorMessage::set_allocated_signing_request(::mpc_engine::proto::wallet_coordinator::WalletSigningRequest* signing_request) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_payload();
@@ -163,6 +181,54 @@ void WalletCoordinatorMessage::clear_signing_response() {
     clear_has_payload();
   }
 }
+void WalletCoordinatorMessage::set_allocated_key_create_request(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* key_create_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (key_create_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_create_request));
+    if (message_arena != submessage_arena) {
+      key_create_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key_create_request, submessage_arena);
+    }
+    set_has_key_create_request();
+    _impl_.payload_.key_create_request_ = key_create_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_request)
+}
+void WalletCoordinatorMessage::clear_key_create_request() {
+  if (_internal_has_key_create_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.key_create_request_;
+    }
+    clear_has_payload();
+  }
+}
+void WalletCoordinatorMessage::set_allocated_key_create_response(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* key_create_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (key_create_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_create_response));
+    if (message_arena != submessage_arena) {
+      key_create_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key_create_response, submessage_arena);
+    }
+    set_has_key_create_response();
+    _impl_.payload_.key_create_response_ = key_create_response;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_response)
+}
+void WalletCoordinatorMessage::clear_key_create_response() {
+  if (_internal_has_key_create_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.key_create_response_;
+    }
+    clear_has_payload();
+  }
+}
 WalletCoordinatorMessage::WalletCoordinatorMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -192,6 +258,16 @@ WalletCoordinatorMessage::WalletCoordinatorMessage(const WalletCoordinatorMessag
           from._internal_signing_response());
       break;
     }
+    case kKeyCreateRequest: {
+      _this->_internal_mutable_key_create_request()->::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest::MergeFrom(
+          from._internal_key_create_request());
+      break;
+    }
+    case kKeyCreateResponse: {
+      _this->_internal_mutable_key_create_response()->::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse::MergeFrom(
+          from._internal_key_create_response());
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -247,6 +323,18 @@ void WalletCoordinatorMessage::clear_payload() {
       }
       break;
     }
+    case kKeyCreateRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.key_create_request_;
+      }
+      break;
+    }
+    case kKeyCreateResponse: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.key_create_response_;
+      }
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -296,6 +384,22 @@ const char* WalletCoordinatorMessage::_InternalParse(const char* ptr, ::_pbi::Pa
         } else
           goto handle_unusual;
         continue;
+      // .mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest key_create_request = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key_create_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse key_create_response = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_key_create_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -345,6 +449,20 @@ uint8_t* WalletCoordinatorMessage::_InternalSerialize(
         _Internal::signing_response(this).GetCachedSize(), target, stream);
   }
 
+  // .mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest key_create_request = 4;
+  if (_internal_has_key_create_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::key_create_request(this),
+        _Internal::key_create_request(this).GetCachedSize(), target, stream);
+  }
+
+  // .mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse key_create_response = 5;
+  if (_internal_has_key_create_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::key_create_response(this),
+        _Internal::key_create_response(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -381,6 +499,20 @@ size_t WalletCoordinatorMessage::ByteSizeLong() const {
           *_impl_.payload_.signing_response_);
       break;
     }
+    // .mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest key_create_request = 4;
+    case kKeyCreateRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.key_create_request_);
+      break;
+    }
+    // .mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse key_create_response = 5;
+    case kKeyCreateResponse: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.key_create_response_);
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -417,6 +549,16 @@ void WalletCoordinatorMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_ms
           from._internal_signing_response());
       break;
     }
+    case kKeyCreateRequest: {
+      _this->_internal_mutable_key_create_request()->::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest::MergeFrom(
+          from._internal_key_create_request());
+      break;
+    }
+    case kKeyCreateResponse: {
+      _this->_internal_mutable_key_create_response()->::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse::MergeFrom(
+          from._internal_key_create_response());
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -32,6 +32,7 @@
 #include <google/protobuf/unknown_field_set.h>
 #include "wallet_common.pb.h"
 #include "wallet_signing.pb.h"
+#include "wallet_key.pb.h"
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_wallet_5fmessage_2eproto
@@ -110,6 +111,8 @@ class WalletCoordinatorMessage final :
   enum PayloadCase {
     kSigningRequest = 2,
     kSigningResponse = 3,
+    kKeyCreateRequest = 4,
+    kKeyCreateResponse = 5,
     PAYLOAD_NOT_SET = 0,
   };
 
@@ -194,6 +197,8 @@ class WalletCoordinatorMessage final :
     kMessageTypeFieldNumber = 1,
     kSigningRequestFieldNumber = 2,
     kSigningResponseFieldNumber = 3,
+    kKeyCreateRequestFieldNumber = 4,
+    kKeyCreateResponseFieldNumber = 5,
   };
   // uint32 message_type = 1;
   void clear_message_type();
@@ -240,6 +245,42 @@ class WalletCoordinatorMessage final :
       ::mpc_engine::proto::wallet_coordinator::WalletSigningResponse* signing_response);
   ::mpc_engine::proto::wallet_coordinator::WalletSigningResponse* unsafe_arena_release_signing_response();
 
+  // .mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest key_create_request = 4;
+  bool has_key_create_request() const;
+  private:
+  bool _internal_has_key_create_request() const;
+  public:
+  void clear_key_create_request();
+  const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest& key_create_request() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* release_key_create_request();
+  ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* mutable_key_create_request();
+  void set_allocated_key_create_request(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* key_create_request);
+  private:
+  const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest& _internal_key_create_request() const;
+  ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* _internal_mutable_key_create_request();
+  public:
+  void unsafe_arena_set_allocated_key_create_request(
+      ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* key_create_request);
+  ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* unsafe_arena_release_key_create_request();
+
+  // .mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse key_create_response = 5;
+  bool has_key_create_response() const;
+  private:
+  bool _internal_has_key_create_response() const;
+  public:
+  void clear_key_create_response();
+  const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse& key_create_response() const;
+  PROTOBUF_NODISCARD ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* release_key_create_response();
+  ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* mutable_key_create_response();
+  void set_allocated_key_create_response(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* key_create_response);
+  private:
+  const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse& _internal_key_create_response() const;
+  ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* _internal_mutable_key_create_response();
+  public:
+  void unsafe_arena_set_allocated_key_create_response(
+      ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* key_create_response);
+  ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* unsafe_arena_release_key_create_response();
+
   void clear_payload();
   PayloadCase payload_case() const;
   // @@protoc_insertion_point(class_scope:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage)
@@ -247,6 +288,8 @@ class WalletCoordinatorMessage final :
   class _Internal;
   void set_has_signing_request();
   void set_has_signing_response();
+  void set_has_key_create_request();
+  void set_has_key_create_response();
 
   inline bool has_payload() const;
   inline void clear_has_payload();
@@ -261,6 +304,8 @@ class WalletCoordinatorMessage final :
         ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
       ::mpc_engine::proto::wallet_coordinator::WalletSigningRequest* signing_request_;
       ::mpc_engine::proto::wallet_coordinator::WalletSigningResponse* signing_response_;
+      ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* key_create_request_;
+      ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* key_create_response_;
     } payload_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     uint32_t _oneof_case_[1];
@@ -432,6 +477,138 @@ inline ::mpc_engine::proto::wallet_coordinator::WalletSigningResponse* WalletCoo
   return _msg;
 }
 
+// .mpc_engine.proto.wallet_coordinator.WalletKeyCreateRequest key_create_request = 4;
+inline bool WalletCoordinatorMessage::_internal_has_key_create_request() const {
+  return payload_case() == kKeyCreateRequest;
+}
+inline bool WalletCoordinatorMessage::has_key_create_request() const {
+  return _internal_has_key_create_request();
+}
+inline void WalletCoordinatorMessage::set_has_key_create_request() {
+  _impl_._oneof_case_[0] = kKeyCreateRequest;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* WalletCoordinatorMessage::release_key_create_request() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_request)
+  if (_internal_has_key_create_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* temp = _impl_.payload_.key_create_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.key_create_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest& WalletCoordinatorMessage::_internal_key_create_request() const {
+  return _internal_has_key_create_request()
+      ? *_impl_.payload_.key_create_request_
+      : reinterpret_cast< ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest&>(::mpc_engine::proto::wallet_coordinator::_WalletKeyCreateRequest_default_instance_);
+}
+inline const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest& WalletCoordinatorMessage::key_create_request() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_request)
+  return _internal_key_create_request();
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* WalletCoordinatorMessage::unsafe_arena_release_key_create_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_request)
+  if (_internal_has_key_create_request()) {
+    clear_has_payload();
+    ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* temp = _impl_.payload_.key_create_request_;
+    _impl_.payload_.key_create_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void WalletCoordinatorMessage::unsafe_arena_set_allocated_key_create_request(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* key_create_request) {
+  clear_payload();
+  if (key_create_request) {
+    set_has_key_create_request();
+    _impl_.payload_.key_create_request_ = key_create_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_request)
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* WalletCoordinatorMessage::_internal_mutable_key_create_request() {
+  if (!_internal_has_key_create_request()) {
+    clear_payload();
+    set_has_key_create_request();
+    _impl_.payload_.key_create_request_ = CreateMaybeMessage< ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.key_create_request_;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* WalletCoordinatorMessage::mutable_key_create_request() {
+  ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateRequest* _msg = _internal_mutable_key_create_request();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_request)
+  return _msg;
+}
+
+// .mpc_engine.proto.wallet_coordinator.WalletKeyCreateResponse key_create_response = 5;
+inline bool WalletCoordinatorMessage::_internal_has_key_create_response() const {
+  return payload_case() == kKeyCreateResponse;
+}
+inline bool WalletCoordinatorMessage::has_key_create_response() const {
+  return _internal_has_key_create_response();
+}
+inline void WalletCoordinatorMessage::set_has_key_create_response() {
+  _impl_._oneof_case_[0] = kKeyCreateResponse;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* WalletCoordinatorMessage::release_key_create_response() {
+  // @@protoc_insertion_point(field_release:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_response)
+  if (_internal_has_key_create_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* temp = _impl_.payload_.key_create_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.key_create_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse& WalletCoordinatorMessage::_internal_key_create_response() const {
+  return _internal_has_key_create_response()
+      ? *_impl_.payload_.key_create_response_
+      : reinterpret_cast< ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse&>(::mpc_engine::proto::wallet_coordinator::_WalletKeyCreateResponse_default_instance_);
+}
+inline const ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse& WalletCoordinatorMessage::key_create_response() const {
+  // @@protoc_insertion_point(field_get:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_response)
+  return _internal_key_create_response();
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* WalletCoordinatorMessage::unsafe_arena_release_key_create_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_response)
+  if (_internal_has_key_create_response()) {
+    clear_has_payload();
+    ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* temp = _impl_.payload_.key_create_response_;
+    _impl_.payload_.key_create_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void WalletCoordinatorMessage::unsafe_arena_set_allocated_key_create_response(::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* key_create_response) {
+  clear_payload();
+  if (key_create_response) {
+    set_has_key_create_response();
+    _impl_.payload_.key_create_response_ = key_create_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_response)
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* WalletCoordinatorMessage::_internal_mutable_key_create_response() {
+  if (!_internal_has_key_create_response()) {
+    clear_payload();
+    set_has_key_create_response();
+    _impl_.payload_.key_create_response_ = CreateMaybeMessage< ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.key_create_response_;
+}
+inline ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* WalletCoordinatorMessage::mutable_key_create_response() {
+  ::mpc_engine::proto::wallet_coordinator::WalletKeyCreateResponse* _msg = _internal_mutable_key_create_response();
+  // @@protoc_insertion_point(field_mutable:mpc_engine.proto.wallet_coordinator.WalletCoordinatorMessage.key_create_response)
+  return _msg;
+}
+
 inline bool WalletCoordinatorMessage::has_payload() const {
   return payload_case() != PAYLOAD_NOT_SET;
 }
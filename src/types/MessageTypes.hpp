@@ -7,6 +7,34 @@ namespace mpc_engine
     enum class MessageType : uint32_t 
     {
         SIGNING_REQUEST = 0,
+        MPC_ROUND = 1,              // 다중 라운드 MPC 세션의 한 라운드
+        MPC_SESSION_ABORT = 2,      // MPC 세션 중단 (노드 상태 폐기)
+        MPC_ROUND_BATCH = 3,        // 여러 세션의 라운드 묶음
+        MPC_MESH_SESSION = 4,       // 노드 간 mesh로 실행하는 MPC 세션 (coordinator는 시작/결과만)
+        MPC_PEER_MESSAGE = 5,       // 노드 → 노드 라운드 메시지 (mesh 링크 전용, coordinator 연결에서는 처리하지 않음)
+        MPC_RELAY_ROUND = 6,        // 중계 라운드 - body는 protobuf가 아닌 relay 프레임 (framing/relay.hpp)
         MAX_MESSAGE_TYPE  // 항상 마지막
     };
+
+    inline const char* MessageTypeToString(MessageType type)
+    {
+        switch (type) {
+            case MessageType::SIGNING_REQUEST:
+                return "SIGNING_REQUEST";
+            case MessageType::MPC_ROUND:
+                return "MPC_ROUND";
+            case MessageType::MPC_SESSION_ABORT:
+                return "MPC_SESSION_ABORT";
+            case MessageType::MPC_ROUND_BATCH:
+                return "MPC_ROUND_BATCH";
+            case MessageType::MPC_MESH_SESSION:
+                return "MPC_MESH_SESSION";
+            case MessageType::MPC_PEER_MESSAGE:
+                return "MPC_PEER_MESSAGE";
+            case MessageType::MPC_RELAY_ROUND:
+                return "MPC_RELAY_ROUND";
+            default:
+                return "UNKNOWN";
+        }
+    }
 }
\ No newline at end of file
@@ -10,6 +10,7 @@ namespace mpc_engine
     enum class WalletMessageType : uint32_t 
     {
         SIGNING_REQUEST = 1001,    // 서명 요청 프로토콜
+        KEY_CREATE_REQUEST = 1002, // 지갑 키 생성 (미리 생성된 키 배정)
         MAX_MESSAGE_TYPE
     };
 
@@ -18,6 +19,8 @@ namespace mpc_engine
         switch (type) {
             case WalletMessageType::SIGNING_REQUEST:
                 return "SIGNING_REQUEST";
+            case WalletMessageType::KEY_CREATE_REQUEST:
+                return "KEY_CREATE_REQUEST";
             default:
                 return "UNKNOWN";
         }
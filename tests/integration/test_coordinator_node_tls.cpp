@@ -1,6 +1,8 @@
 // tests/integration/test_coordinator_node_tls.cpp
 #include "coordinator/CoordinatorServer.hpp"
 #include "node/NodeServer.hpp"
+#include "node/handlers/include/NodeMessageRouter.hpp"
+#include "common/utils/threading/ThreadUtils.hpp"
 #include "common/env/EnvManager.hpp"
 #include "types/BasicTypes.hpp"
 #include "common/kms/include/KMSManager.hpp"
@@ -10,12 +12,23 @@
 #include "proto/coordinator_node/generated/message.pb.h"
 #include "proto/coordinator_node/generated/signing.pb.h"
 #include "proto/coordinator_node/generated/common.pb.h"
+#include "proto/coordinator_node/generated/mpc.pb.h"
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <vector>
 #include <future>
+#include <functional>
+#include <map>
+#include <algorithm>
+#include <cstdio>
 #include <cassert>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include <pthread.h>
 
 using namespace mpc_engine;
 using namespace mpc_engine::coordinator;
@@ -25,6 +38,17 @@ using namespace mpc_engine::kms;
 using namespace mpc_engine::proto::coordinator_node;
 using namespace mpc_engine::resource;
 
+// ===== 스레드 생성 카운터 (pthread_create 가로채기) =====
+static std::atomic<uint64_t> g_threads_created{0};
+
+extern "C" int pthread_create(pthread_t* thread, const pthread_attr_t* attr, void* (*start)(void*), void* arg)
+{
+    using CreateFn = int (*)(pthread_t*, const pthread_attr_t*, void* (*)(void*), void*);
+    static CreateFn real_create = reinterpret_cast<CreateFn>(dlsym(RTLD_NEXT, "pthread_create"));
+    g_threads_created.fetch_add(1, std::memory_order_relaxed);
+    return real_create(thread, attr, start, arg);
+}
+
 class TlsTestEnvironment 
 {
 private:
@@ -162,6 +186,7 @@ public:
     }
 
     CoordinatorServer* GetCoordinator() { return coordinator_server.get(); }
+    NodeServer* GetNode(size_t index) { return index < node_servers.size() ? node_servers[index].get() : nullptr; }
     size_t GetNodeCount() const { return node_servers.size(); }
     bool IsSetup() const { return is_setup; }
 };
@@ -366,6 +391,1205 @@ bool TestStressTest(TlsTestEnvironment& env)
     }
 }
 
+bool TestStalledHandshakeDoesNotBlockReconnect(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 5: Stalled Handshake vs Reconnect ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    if (!coordinator) {
+        std::cerr << "Coordinator not available" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    std::vector<std::pair<std::string, uint16_t>> node_hosts = Config::GetNodeEndpoints("NODE_HOSTS");
+    const std::string& node_id = node_ids[0];
+
+    // TLS ClientHello를 보내지 않는 peer 2개로 핸드셰이크 슬롯 점유
+    std::vector<int> stalled_sockets;
+    for (int i = 0; i < 2; ++i) {
+        int sock = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(node_hosts[0].second);
+        inet_pton(AF_INET, node_hosts[0].first.c_str(), &addr.sin_addr);
+        if (connect(sock, (sockaddr*)&addr, sizeof(addr)) != 0) {
+            std::cerr << "Failed to open stalled connection" << std::endl;
+            close(sock);
+            continue;
+        }
+        stalled_sockets.push_back(sock);
+    }
+    std::cout << "Opened " << stalled_sockets.size() << " stalled connections" << std::endl;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // Coordinator 재접속
+    coordinator->DisconnectFromNode(node_id);
+
+    auto start_time = std::chrono::steady_clock::now();
+    bool reconnected = coordinator->ConnectToNode(node_id);
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+
+    for (int sock : stalled_sockets) {
+        close(sock);
+    }
+
+    std::cout << "Reconnect: " << (reconnected ? "OK" : "FAILED") << " in " << elapsed_ms << "ms" << std::endl;
+    if (!reconnected) {
+        return false;
+    }
+
+    // 느린 핸드셰이크를 기다리지 않아야 함 (핸드셰이크 타임아웃 5s)
+    if (elapsed_ms > 2000) {
+        std::cerr << "Reconnect was blocked by stalled handshakes" << std::endl;
+        return false;
+    }
+
+    auto request = CreateSigningRequest("reconnect_test", "reconnect_key", "0x" + std::string(64, 'd'));
+    if (!coordinator->BroadcastToAllConnectedNodes(request.get())) {
+        std::cerr << "Signing after reconnect failed" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ Reconnect not blocked by stalled handshakes" << std::endl;
+    return true;
+}
+
+bool TestShuttingDownNodeFailsOver(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 6: Shutting-down Node Fails Over ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    auto* draining_node = env.GetNode(0);
+    if (!coordinator || !draining_node || !draining_node->GetTcpServer()) {
+        std::cerr << "Environment not available" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+
+    // node1이 종료 준비 상태 → 새 요청은 SHUTTING_DOWN으로 즉시 거절되어야 함
+    draining_node->GetTcpServer()->StopAcceptingConnections();
+
+    auto request = CreateSigningRequest("failover_test", "failover_key", "0x" + std::string(64, 'e'));
+
+    auto start_time = std::chrono::steady_clock::now();
+    auto rejected = coordinator->SendToNode(node_ids[0], request.get());
+    auto reject_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+
+    if (!rejected || !rejected->has_error_response() ||
+        rejected->error_response().code() != NODE_ERROR_SHUTTING_DOWN) {
+        std::cerr << "Expected SHUTTING_DOWN error response from draining node" << std::endl;
+        return false;
+    }
+    std::cout << "Draining node answered " << NodeErrorCode_Name(rejected->error_response().code())
+              << " in " << reject_ms << "ms" << std::endl;
+
+    // 다른 노드로 즉시 우회
+    std::string served_by;
+    start_time = std::chrono::steady_clock::now();
+    auto response = coordinator->SendToAnyNode(node_ids, request.get(), &served_by);
+    auto failover_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+
+    if (!response || !response->has_signing_response() || served_by == node_ids[0]) {
+        std::cerr << "Failover to another node failed" << std::endl;
+        return false;
+    }
+    std::cout << "Served by " << served_by << " in " << failover_ms << "ms" << std::endl;
+
+    // 요청 타임아웃(30s)을 기다리지 않아야 함
+    if (reject_ms > 1000 || failover_ms > 2000) {
+        std::cerr << "Failover waited for timeout" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ Typed SHUTTING_DOWN response triggers immediate failover" << std::endl;
+    return true;
+}
+
+bool TestLatencyHistograms(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 7: Per-stage Latency Histograms ===" << std::endl;
+
+    auto* node = env.GetNode(1);
+    if (!node || !node->GetTcpServer()) {
+        std::cerr << "Node not available" << std::endl;
+        return false;
+    }
+
+    NodeStats stats = node->GetStats();
+    const node::network::MessageLatencyStats* signing = nullptr;
+    for (const auto& entry : stats.latency) {
+        if (entry.message_type == static_cast<uint16_t>(mpc_engine::MessageType::SIGNING_REQUEST)) {
+            signing = &entry;
+        }
+    }
+    if (!signing) {
+        std::cerr << "No SIGNING_REQUEST latency recorded" << std::endl;
+        return false;
+    }
+
+    // 모든 구간에 샘플이 있어야 하고 구간 합이 TOTAL을 넘지 않아야 함 (p50 기준)
+    for (size_t stage = 0; stage < node::network::LATENCY_STAGE_COUNT; ++stage) {
+        const auto& s = signing->stages[stage];
+        std::cout << "[PERF] " << node::network::LatencyStageToString(static_cast<node::network::LatencyStage>(stage))
+                  << ": n=" << s.count << " p50=" << s.p50_ns / 1000.0 << "us p99=" << s.p99_ns / 1000.0
+                  << "us max=" << s.max_ns / 1000.0 << "us" << std::endl;
+        if (s.count == 0) {
+            std::cerr << "Stage without samples" << std::endl;
+            return false;
+        }
+    }
+
+    const auto& total = signing->stages[static_cast<size_t>(node::network::LatencyStage::TOTAL)];
+    const auto& handler = signing->stages[static_cast<size_t>(node::network::LatencyStage::HANDLER)];
+    if (handler.count > total.count || handler.max_ns > total.max_ns) {
+        std::cerr << "Handler stage exceeds end-to-end latency" << std::endl;
+        return false;
+    }
+
+    node->GetTcpServer()->DumpLatencyStats();
+    std::cout << "✓ Queue/handler/serialize/send latency recorded per message type" << std::endl;
+    return true;
+}
+
+bool TestQuorumFanOut(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 8: Threshold Quorum Fan-out ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    auto* slow_node = env.GetNode(2);
+    if (!coordinator || !slow_node || !slow_node->GetTcpServer()) {
+        std::cerr << "Environment not available" << std::endl;
+        return false;
+    }
+
+    // node1은 Test 6 이후 SHUTTING_DOWN 응답, node3는 응답 지연 → node2가 가장 빠른 노드
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    const auto slow_delay = std::chrono::milliseconds(1500);
+    static std::atomic<bool> slow_enabled{true};
+    slow_node->GetTcpServer()->SetMessageHandler([slow_delay](const mpc_engine::network::framing::NetworkMessage& message) {
+        if (slow_enabled.load()) {
+            std::this_thread::sleep_for(slow_delay);
+        }
+        return node::handlers::NodeMessageRouter::Instance().Process(message);
+    });
+
+    // 호출마다 다른 key → 느린 노드의 같은 affinity lane에 쌓이지 않음
+    auto request = CreateSigningRequest("quorum_test_1", "quorum_key_1", "0x" + std::string(64, 'f'));
+    bool passed = true;
+
+    // 1-of-{node2, node3}: 느린 노드를 기다리지 않음
+    QuorumResult fastest = coordinator->BroadcastToQuorum({ node_ids[1], node_ids[2] }, request.get(), 1);
+    std::cout << "[PERF] 1-of-2 (one slow node): " << fastest.elapsed_ms << "ms" << std::endl;
+    if (!fastest.reached || fastest.participants != std::vector<std::string>{ node_ids[1] } ||
+        fastest.stragglers != std::vector<std::string>{ node_ids[2] } ||
+        fastest.elapsed_ms >= static_cast<uint64_t>(slow_delay.count())) {
+        std::cerr << "1-of-2 quorum waited for the straggler" << std::endl;
+        passed = false;
+    }
+
+    // 2-of-3 (node1 down, node3 slow): node3 응답 시점에 완료, node1 실패 보고
+    request = CreateSigningRequest("quorum_test_2", "quorum_key_2", "0x" + std::string(64, 'f'));
+    QuorumResult two_of_three = coordinator->BroadcastToQuorum(node_ids, request.get(), 2);
+    std::cout << "[PERF] 2-of-3 (one failed, one slow): " << two_of_three.elapsed_ms << "ms" << std::endl;
+    if (!two_of_three.reached || two_of_three.participants.size() != 2 ||
+        two_of_three.participants[0] != node_ids[1] ||
+        two_of_three.failed != std::vector<std::string>{ node_ids[0] } ||
+        two_of_three.responses.size() != 2 || !two_of_three.responses[1]->has_signing_response()) {
+        std::cerr << "2-of-3 quorum did not complete with node2/node3" << std::endl;
+        passed = false;
+    }
+
+    // 3-of-3: node1 실패로 정족수 불가능 → 느린 노드를 기다리지 않고 즉시 실패
+    request = CreateSigningRequest("quorum_test_3", "quorum_key_3", "0x" + std::string(64, 'f'));
+    QuorumResult impossible = coordinator->BroadcastToQuorum(node_ids, request.get(), 3);
+    std::cout << "[PERF] 3-of-3 (impossible): " << impossible.elapsed_ms << "ms" << std::endl;
+    if (impossible.reached || impossible.elapsed_ms >= static_cast<uint64_t>(slow_delay.count())) {
+        std::cerr << "Impossible quorum was not detected early" << std::endl;
+        passed = false;
+    }
+
+    slow_enabled = false;
+    if (passed) {
+        std::cout << "✓ Fan-out completes at the t-th fastest node and cancels stragglers" << std::endl;
+    }
+    return passed;
+}
+
+// 변경 전 BroadcastToNodes 재현: 노드마다 std::async 스레드를 띄우고 차례로 대기
+bool LegacyAsyncBroadcast(CoordinatorServer* coordinator, const std::vector<std::string>& node_ids,
+                          const CoordinatorNodeMessage* request)
+{
+    std::vector<std::future<std::unique_ptr<CoordinatorNodeMessage>>> futures;
+    for (const std::string& node_id : node_ids) {
+        futures.push_back(std::async(std::launch::async, [coordinator, node_id, request]() {
+            return coordinator->SendToNode(node_id, request);
+        }));
+    }
+
+    bool all_success = true;
+    for (auto& future : futures) {
+        auto response = future.get();
+        all_success = all_success && response && response->has_signing_response() &&
+                      response->signing_response().header().success();
+    }
+    return all_success;
+}
+
+struct FanOutLoadResult {
+    uint64_t threads_created = 0;
+    uint32_t peak_threads = 0;
+    double fanouts_per_sec = 0;
+    int failures = 0;
+};
+
+// caller 스레드는 측정 구간 전에 생성 → 구간 내 스레드 생성은 fan-out 구현에서만 발생
+template<typename TBroadcast>
+FanOutLoadResult RunFanOutLoad(int callers, int per_caller, TBroadcast broadcast)
+{
+    FanOutLoadResult result;
+    std::atomic<bool> go{false};
+    std::atomic<bool> done{false};
+    std::atomic<int> ready{0};
+    std::atomic<int> failures{0};
+    std::atomic<uint32_t> peak{utils::GetProcessThreadCount()};
+
+    std::thread sampler([&]() {
+        while (!done.load()) {
+            uint32_t current = utils::GetProcessThreadCount();
+            uint32_t previous = peak.load();
+            while (current > previous && !peak.compare_exchange_weak(previous, current)) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    });
+
+    std::vector<std::thread> workers;
+    for (int c = 0; c < callers; ++c) {
+        workers.emplace_back([&, c]() {
+            auto request = CreateSigningRequest("fanout_load_" + std::to_string(c), "fanout_key_" + std::to_string(c),
+                                                "0x" + std::string(64, 'a'));
+            ready++;
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < per_caller; ++i) {
+                if (!broadcast(request.get())) {
+                    failures++;
+                }
+            }
+        });
+    }
+    while (ready.load() < callers) {
+        std::this_thread::yield();
+    }
+
+    uint64_t created_before = g_threads_created.load();
+    auto start_time = std::chrono::steady_clock::now();
+    go = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double elapsed_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    result.threads_created = g_threads_created.load() - created_before;
+
+    done = true;
+    sampler.join();
+
+    result.peak_threads = peak.load();
+    result.fanouts_per_sec = callers * per_caller / elapsed_sec;
+    result.failures = failures.load();
+    return result;
+}
+
+bool TestFanOutThreadCreation(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 9: Fan-out Load without Per-node Threads ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    if (!coordinator) {
+        std::cerr << "Coordinator not available" << std::endl;
+        return false;
+    }
+
+    // node1은 Test 6 이후 draining → 정상 노드 2개로 n-of-n fan-out
+    std::vector<std::string> all_ids = Config::GetStringArray("NODE_IDS");
+    std::vector<std::string> node_ids = { all_ids[1], all_ids[2] };
+    const int callers = 8;
+    const int per_caller = 250;
+
+    FanOutLoadResult legacy = RunFanOutLoad(callers, per_caller, [&](const CoordinatorNodeMessage* request) {
+        return LegacyAsyncBroadcast(coordinator, node_ids, request);
+    });
+    FanOutLoadResult callback = RunFanOutLoad(callers, per_caller, [&](const CoordinatorNodeMessage* request) {
+        return coordinator->BroadcastToNodes(node_ids, request);
+    });
+
+    std::cout << "[PERF] std::async per node:  " << legacy.threads_created << " threads created, peak "
+              << legacy.peak_threads << " threads, " << static_cast<int>(legacy.fanouts_per_sec) << " fan-outs/s" << std::endl;
+    std::cout << "[PERF] completion callbacks: " << callback.threads_created << " threads created, peak "
+              << callback.peak_threads << " threads, " << static_cast<int>(callback.fanouts_per_sec) << " fan-outs/s" << std::endl;
+    std::cout << "Coordinator threads after load: " << coordinator->GetStats().thread_count << std::endl;
+
+    const uint64_t total_node_requests = static_cast<uint64_t>(callers) * per_caller * node_ids.size();
+    if (legacy.failures != 0 || callback.failures != 0) {
+        std::cerr << "Fan-out failures: legacy " << legacy.failures << ", callback " << callback.failures << std::endl;
+        return false;
+    }
+    if (legacy.threads_created < total_node_requests) {
+        std::cerr << "Legacy baseline did not create a thread per node request" << std::endl;
+        return false;
+    }
+    if (callback.threads_created != 0) {
+        std::cerr << "Callback fan-out created threads under load" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ Fan-out thread count stays constant under load" << std::endl;
+    return true;
+}
+
+bool TestMultiRoundMpcSessions(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 10: Multi-round MPC Sessions ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    auto* slow_node = env.GetNode(2);
+    if (!coordinator || !slow_node || !slow_node->GetTcpServer()) {
+        std::cerr << "Environment not available" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    bool passed = true;
+
+    // 1. 2-of-3 ECDSA 서명: node1은 draining → node2/node3가 5라운드 완료, 최종 서명 일치
+    session::MpcSessionSpec spec;
+    spec.session_id = "mpc_sign_1";
+    spec.protocol = MPC_PROTOCOL_ECDSA_SIGNING;
+    spec.key_id = "mpc_key_1";
+    spec.node_ids = { node_ids[1], node_ids[2] };
+    spec.threshold = 2;
+    spec.session_input = "0x" + std::string(64, 'b');
+
+    session::MpcSessionResult signing = coordinator->RunMpcSession(spec);
+    std::cout << "ECDSA signing: " << session::MpcSessionStatusToString(signing.status) << ", "
+              << signing.completed_rounds << " rounds, " << signing.elapsed_ms << "ms, output " << signing.output << std::endl;
+    if (signing.status != session::MpcSessionStatus::COMPLETED || signing.completed_rounds != 5 ||
+        signing.output.rfind("MOCK_SIGNATURE_", 0) != 0 || signing.participants.size() != 2) {
+        std::cerr << "Signing session did not complete: " << signing.error_message << std::endl;
+        passed = false;
+    }
+
+    // 2. keygen은 후보 전체 참여 → draining 노드가 round 1에서 거절, 세션 실패
+    spec.session_id = "mpc_keygen_1";
+    spec.protocol = MPC_PROTOCOL_KEYGEN;
+    spec.node_ids = node_ids;
+    session::MpcSessionResult keygen = coordinator->RunMpcSession(spec);
+    std::cout << "Keygen with draining node: " << session::MpcSessionStatusToString(keygen.status)
+              << " (" << keygen.error_message << ")" << std::endl;
+    if (keygen.status != session::MpcSessionStatus::FAILED || keygen.completed_rounds != 0 ||
+        keygen.failed_node != node_ids[0]) {
+        std::cerr << "Keygen failure was not attributed to the draining node" << std::endl;
+        passed = false;
+    }
+
+    // 3. 라운드 타임아웃: node3 응답 지연 > round_timeout
+    static std::atomic<bool> slow_enabled{true};
+    slow_node->GetTcpServer()->SetMessageHandler([](const mpc_engine::network::framing::NetworkMessage& message) {
+        if (slow_enabled.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(600));
+        }
+        return node::handlers::NodeMessageRouter::Instance().Process(message);
+    });
+    spec.session_id = "mpc_sign_timeout";
+    spec.protocol = MPC_PROTOCOL_ECDSA_SIGNING;
+    spec.node_ids = { node_ids[1], node_ids[2] };
+    spec.round_timeout = std::chrono::milliseconds(200);
+    session::MpcSessionResult timed_out = coordinator->RunMpcSession(spec);
+    std::cout << "Slow participant: " << session::MpcSessionStatusToString(timed_out.status) << " after "
+              << timed_out.elapsed_ms << "ms (" << timed_out.error_message << ")" << std::endl;
+    if (timed_out.status != session::MpcSessionStatus::TIMED_OUT || timed_out.failed_node != node_ids[2] ||
+        timed_out.elapsed_ms >= 600) {
+        std::cerr << "Round timeout was not enforced" << std::endl;
+        passed = false;
+    }
+    slow_enabled = false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(700));   // 지연된 요청 소진
+
+    // 4. 동시 세션: 200개를 유지하며 완료 콜백에서 다음 세션 시작, 스레드 생성 없음
+    const int sessions = 1000;
+    const int in_flight = 200;
+    spec.round_timeout = std::chrono::milliseconds(0);
+    std::atomic<int> next{0};
+    std::atomic<int> remaining{sessions};
+    std::atomic<int> completed{0};
+    std::promise<void> all_done;
+
+    std::function<void()> start_next = [&]() {
+        int i = next++;
+        if (i >= sessions) {
+            return;
+        }
+        session::MpcSessionSpec load_spec = spec;
+        load_spec.session_id = "mpc_load_" + std::to_string(i);
+        load_spec.key_id = "mpc_load_key_" + std::to_string(i);
+        coordinator->StartMpcSession(std::move(load_spec), [&](const session::MpcSessionResult& result) {
+            if (result.status == session::MpcSessionStatus::COMPLETED) {
+                completed++;
+            } else {
+                std::cerr << result.session_id << ": " << result.error_message << std::endl;
+            }
+            if (--remaining == 0) {
+                all_done.set_value();
+            } else {
+                start_next();
+            }
+        });
+    };
+
+    uint64_t created_before = g_threads_created.load();
+    auto start_time = std::chrono::steady_clock::now();
+    for (int i = 0; i < in_flight; ++i) {
+        start_next();
+    }
+    all_done.get_future().wait();
+    double elapsed_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    uint64_t threads_created = g_threads_created.load() - created_before;
+
+    session::MpcSessionEngineStats stats = coordinator->GetMpcSessionStats();
+    std::cout << "[PERF] " << sessions << " 5-round sessions (" << in_flight << " in flight): " << static_cast<int>(sessions / elapsed_sec)
+              << " sessions/s (" << static_cast<int>(sessions * 5 * spec.node_ids.size() / elapsed_sec)
+              << " round requests/s), " << threads_created << " threads created" << std::endl;
+    std::cout << "Engine stats: started " << stats.started << ", completed " << stats.completed << ", failed "
+              << stats.failed << ", timed out " << stats.timed_out << ", active " << stats.active_sessions << std::endl;
+    if (completed.load() != sessions || threads_created != 0 || stats.active_sessions != 0) {
+        std::cerr << "Concurrent sessions: " << completed.load() << "/" << sessions << " completed" << std::endl;
+        passed = false;
+    }
+
+    if (passed) {
+        std::cout << "✓ Sessions advance round by round and fail fast on errors/timeouts" << std::endl;
+    }
+    return passed;
+}
+
+struct BatchingPoint {
+    double sessions_per_sec = 0;
+    double p50_ms = 0;
+    double p99_ms = 0;
+    double rounds_per_batch = 0;
+    int completed = 0;
+};
+
+// in_flight개 세션을 유지하며 total개 실행 (완료 콜백에서 다음 세션 시작)
+BatchingPoint RunBatchingPoint(CoordinatorServer* coordinator, const session::MpcSessionSpec& base,
+                               const std::string& tag, int total, int in_flight)
+{
+    std::vector<std::chrono::steady_clock::time_point> started(total);
+    std::vector<double> latencies_ms(total, 0);
+    std::atomic<int> next{0};
+    std::atomic<int> remaining{total};
+    std::atomic<int> completed{0};
+    std::promise<void> all_done;
+
+    std::function<void()> start_next = [&]() {
+        int i = next++;
+        if (i >= total) {
+            return;
+        }
+        session::MpcSessionSpec spec = base;
+        spec.session_id = "mpc_batch_" + tag + "_" + std::to_string(i);
+        spec.key_id = "mpc_batch_key_" + std::to_string(i % 16);
+        started[i] = std::chrono::steady_clock::now();
+        coordinator->StartMpcSession(std::move(spec), [&, i](const session::MpcSessionResult& result) {
+            latencies_ms[i] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started[i]).count();
+            if (result.status == session::MpcSessionStatus::COMPLETED) {
+                completed++;
+            } else {
+                std::cerr << result.session_id << ": " << result.error_message << std::endl;
+            }
+            if (--remaining == 0) {
+                all_done.set_value();
+            } else {
+                start_next();
+            }
+        });
+    };
+
+    session::MpcSessionEngineStats before = coordinator->GetMpcSessionStats();
+    auto start_time = std::chrono::steady_clock::now();
+    for (int i = 0; i < in_flight; ++i) {
+        start_next();
+    }
+    all_done.get_future().wait();
+    double elapsed_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    session::MpcSessionEngineStats after = coordinator->GetMpcSessionStats();
+
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    BatchingPoint point;
+    point.sessions_per_sec = total / elapsed_sec;
+    point.p50_ms = latencies_ms[total / 2];
+    point.p99_ms = latencies_ms[std::min(total - 1, total * 99 / 100)];
+    uint64_t batches = after.round_batches - before.round_batches;
+    point.rounds_per_batch = batches ? static_cast<double>(after.batched_rounds - before.batched_rounds) / batches : 1.0;
+    point.completed = completed.load();
+    return point;
+}
+
+bool TestCrossSessionRoundBatching(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 11: Cross-session Round Batching ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    if (!coordinator) {
+        std::cerr << "Coordinator not available" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    session::MpcSessionSpec spec;
+    spec.protocol = MPC_PROTOCOL_ECDSA_SIGNING;
+    spec.node_ids = { node_ids[1], node_ids[2] };
+    spec.threshold = 2;
+    spec.session_input = "0x" + std::string(64, 'c');
+
+    const std::vector<int> windows_us = { 0, 250, 1000, 2000 };
+    const std::vector<int> loads = { 1, 32, 256 };
+    bool passed = true;
+
+    std::cout << "[PERF] window   in-flight   sessions/s   p50 ms   p99 ms   rounds/batch" << std::endl;
+    for (int window_us : windows_us) {
+        session::MpcRoundBatchConfig config;
+        config.window = std::chrono::microseconds(window_us);
+        config.max_batch = 64;
+        coordinator->SetMpcRoundBatching(config);
+
+        for (int in_flight : loads) {
+            int total = (in_flight == 1) ? 50 : 1000;
+            std::string tag = std::to_string(window_us) + "_" + std::to_string(in_flight);
+            BatchingPoint point = RunBatchingPoint(coordinator, spec, tag, total, in_flight);
+
+            char line[160];
+            std::snprintf(line, sizeof(line), "[PERF] %5dus   %9d   %10.0f   %6.2f   %6.2f   %12.1f",
+                          window_us, in_flight, point.sessions_per_sec, point.p50_ms, point.p99_ms, point.rounds_per_batch);
+            std::cout << line << std::endl;
+
+            if (point.completed != total) {
+                std::cerr << "window " << window_us << "us, " << in_flight << " in flight: "
+                          << point.completed << "/" << total << " completed" << std::endl;
+                passed = false;
+            }
+            // 부하가 있으면 실제로 여러 세션의 라운드가 한 요청에 묶여야 함
+            if (window_us > 0 && in_flight >= 32 && point.rounds_per_batch < 2.0) {
+                std::cerr << "window " << window_us << "us did not batch rounds under load" << std::endl;
+                passed = false;
+            }
+        }
+    }
+
+    // env 설정으로 복원
+    session::MpcRoundBatchConfig restored;
+    if (Config::HasKey("COORDINATOR_MPC_BATCH_WINDOW_US")) {
+        restored.window = std::chrono::microseconds(Config::GetUInt32("COORDINATOR_MPC_BATCH_WINDOW_US"));
+    }
+    if (Config::HasKey("COORDINATOR_MPC_BATCH_MAX")) {
+        restored.max_batch = Config::GetUInt32("COORDINATOR_MPC_BATCH_MAX");
+    }
+    coordinator->SetMpcRoundBatching(restored);
+
+    if (passed) {
+        std::cout << "✓ Rounds from concurrent sessions are coalesced per node" << std::endl;
+    }
+    return passed;
+}
+
+double Percentile(std::vector<double> values, int percentile)
+{
+    std::sort(values.begin(), values.end());
+    return values.empty() ? 0.0 : values[std::min(values.size() - 1, values.size() * percentile / 100)];
+}
+
+bool TestPresignaturePool(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 12: Presignature Pool ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    if (!coordinator) {
+        std::cerr << "Coordinator not available" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    const std::vector<std::string> signers = { node_ids[1], node_ids[2] };
+    const std::string key_id = "presig_key_1";
+    const std::string message_hash = "0x" + std::string(64, 'd');
+    bool passed = true;
+
+    session::PresignaturePoolConfig config;
+    config.target_depth = 32;
+    config.max_in_flight = 8;
+    config.refill_per_second = 200;
+    coordinator->SetPresignaturePool(config);
+    coordinator->AddPresignatureKey(key_id, signers, 2);
+
+    auto wait_for_depth = [&](size_t depth) {
+        auto start = std::chrono::steady_clock::now();
+        while (coordinator->GetPresignatureStats().depth < depth) {
+            if (std::chrono::steady_clock::now() - start > std::chrono::seconds(10)) {
+                return -1.0;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // 1. 백그라운드 보충 - target depth까지 (refill 속도 제한)
+    double fill_ms = wait_for_depth(config.target_depth);
+    std::cout << "Pool filled to " << config.target_depth << " in " << fill_ms << "ms" << std::endl;
+    if (fill_ms < 0) {
+        std::cerr << "Pool did not reach target depth" << std::endl;
+        coordinator->SetPresignaturePool(session::PresignaturePoolConfig());
+        return false;
+    }
+
+    // 2. 전체 서명 (5 라운드) vs presignature hit (온라인 1 라운드) 지연 비교
+    const int samples = 32;
+    std::vector<double> full_ms, online_ms;
+    for (int i = 0; i < samples; ++i) {
+        session::MpcSessionSpec spec;
+        spec.protocol = MPC_PROTOCOL_ECDSA_SIGNING;
+        spec.key_id = key_id;
+        spec.node_ids = signers;
+        spec.threshold = 2;
+        spec.session_input = message_hash;
+        auto start = std::chrono::steady_clock::now();
+        session::MpcSessionResult result = coordinator->RunMpcSession(spec);
+        full_ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        if (result.status != session::MpcSessionStatus::COMPLETED) {
+            passed = false;
+        }
+    }
+
+    int hits = 0;
+    for (int i = 0; i < samples; ++i) {
+        bool used_presignature = false;
+        auto start = std::chrono::steady_clock::now();
+        session::MpcSessionResult result = coordinator->SignEcdsa(key_id, message_hash, signers, 2, &used_presignature);
+        online_ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        if (result.status != session::MpcSessionStatus::COMPLETED || result.output.rfind("MOCK_SIGNATURE_", 0) != 0) {
+            std::cerr << "Online signing failed: " << result.error_message << std::endl;
+            passed = false;
+        }
+        hits += used_presignature ? 1 : 0;
+    }
+
+    std::cout << "[PERF] full 5-round signing: p50 " << Percentile(full_ms, 50) << "ms, p99 " << Percentile(full_ms, 99) << "ms" << std::endl;
+    std::cout << "[PERF] pool hit (1 round):   p50 " << Percentile(online_ms, 50) << "ms, p99 " << Percentile(online_ms, 99)
+              << "ms (" << hits << "/" << samples << " hits)" << std::endl;
+    if (hits != samples || Percentile(online_ms, 50) >= Percentile(full_ms, 50)) {
+        std::cerr << "Warm pool should serve every request with the faster online round" << std::endl;
+        passed = false;
+    }
+
+    // 3. 보충 속도보다 빠른 연속 요청 → pool 소진 후 miss는 전체 서명으로 처리, 이후 다시 채워짐
+    const int burst = 200;
+    int burst_failures = 0;
+    for (int i = 0; i < burst; ++i) {
+        session::MpcSessionResult result = coordinator->SignEcdsa(key_id, message_hash, signers, 2);
+        burst_failures += (result.status != session::MpcSessionStatus::COMPLETED) ? 1 : 0;
+    }
+
+    session::PresignaturePoolStats stats = coordinator->GetPresignatureStats();
+    CoordinatorStats coordinator_stats = coordinator->GetStats();
+    std::cout << "[PERF] after " << burst << "-request burst: hit rate " << stats.HitRate() * 100.0 << "% ("
+              << stats.hits << " hits, " << stats.misses << " misses), generated " << stats.generated
+              << ", failed " << stats.failed << ", depth " << coordinator_stats.presignature_depth << std::endl;
+    if (burst_failures != 0 || stats.misses == 0 || stats.hits < static_cast<uint64_t>(samples) ||
+        coordinator_stats.presignature_hit_rate != stats.HitRate()) {
+        std::cerr << "Burst: " << burst_failures << " failures, " << stats.misses << " misses" << std::endl;
+        passed = false;
+    }
+
+    double refill_ms = wait_for_depth(config.target_depth);
+    std::cout << "Pool refilled in " << refill_ms << "ms" << std::endl;
+    if (refill_ms < 0) {
+        passed = false;
+    }
+
+    std::vector<session::PresignatureKeyStats> key_stats = coordinator->GetPresignatureKeyStats();
+    if (key_stats.size() != 1 || key_stats[0].key_id != key_id || key_stats[0].depth != config.target_depth) {
+        std::cerr << "Per-key stats do not match the pool" << std::endl;
+        passed = false;
+    }
+
+    // 4. 서명 요청은 key를 등록하지 않음, 등록 상한, 사용되지 않는 key는 idle_ttl 후 해제
+    session::PresignaturePoolConfig bounded = config;
+    bounded.target_depth = 2;
+    bounded.max_keys = 1;
+    bounded.idle_ttl = std::chrono::milliseconds(300);
+    coordinator->SetPresignaturePool(bounded);
+    session::MpcSessionResult unenrolled = coordinator->SignEcdsa("presig_unenrolled", message_hash, signers, 2);
+    bool first_added = coordinator->AddPresignatureKey(key_id, signers, 2);
+    bool second_added = coordinator->AddPresignatureKey("presig_key_2", signers, 2);
+    stats = coordinator->GetPresignatureStats();
+    std::cout << "Bounded pool: unenrolled sign " << session::MpcSessionStatusToString(unenrolled.status) << ", keys " << stats.keys
+              << ", rejected " << stats.rejected_keys << std::endl;
+    if (unenrolled.status != session::MpcSessionStatus::COMPLETED || !first_added || second_added ||
+        stats.keys != 1 || stats.rejected_keys != 1) {
+        std::cerr << "Pool should only hold explicitly enrolled keys up to max_keys" << std::endl;
+        passed = false;
+    }
+
+    auto idle_start = std::chrono::steady_clock::now();
+    while (coordinator->GetPresignatureStats().keys != 0 &&
+           std::chrono::steady_clock::now() - idle_start < std::chrono::seconds(5)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    stats = coordinator->GetPresignatureStats();
+    std::cout << "Idle key removed: keys " << stats.keys << ", idle_removed " << stats.idle_removed << std::endl;
+    if (stats.keys != 0 || stats.idle_removed != 1) {
+        std::cerr << "Idle key should be removed after idle_ttl" << std::endl;
+        passed = false;
+    }
+
+    coordinator->SetPresignaturePool(session::PresignaturePoolConfig());
+
+    if (passed) {
+        std::cout << "✓ Signing consumes pooled presignatures and falls back to full sessions when empty" << std::endl;
+    }
+    return passed;
+}
+
+bool TestLatencyAwareNodeSelection(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 13: Latency-aware Node Selection ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    auto* node2 = env.GetNode(1);
+    auto* node3 = env.GetNode(2);
+    if (!coordinator || !node2 || !node2->GetTcpServer() || !node3 || !node3->GetTcpServer()) {
+        std::cerr << "Environment not available" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    bool passed = true;
+
+    // 느린 노드 지정 (-1 = 없음): 메시지마다 10ms 지연
+    static std::atomic<int> slow_node_index{-1};
+    for (int index : { 1, 2 }) {
+        env.GetNode(index)->GetTcpServer()->SetMessageHandler([index](const mpc_engine::network::framing::NetworkMessage& message) {
+            if (slow_node_index.load() == index) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            return node::handlers::NodeMessageRouter::Instance().Process(message);
+        });
+    }
+
+    // 1-of-3 서명을 duration 동안 연속 실행, 선택된 참여자 집계
+    // node1은 draining (Test 6) → 회피 목록으로 제외
+    const std::vector<std::string> candidates = { node_ids[0], node_ids[2], node_ids[1] };
+    struct PhaseResult
+    {
+        std::map<std::string, int> picks;
+        int sessions = 0;
+        int failures = 0;
+        double p50_ms = 0.0;
+    };
+    auto run_phase = [&](std::chrono::milliseconds duration) {
+        PhaseResult phase;
+        std::vector<double> latencies;
+        auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end) {
+            session::MpcSessionSpec spec;
+            spec.protocol = MPC_PROTOCOL_ECDSA_SIGNING;
+            spec.key_id = "selection_key";
+            spec.node_ids = candidates;
+            spec.threshold = 1;
+            spec.session_input = "0x" + std::string(64, 'e');
+            auto start = std::chrono::steady_clock::now();
+            session::MpcSessionResult result = coordinator->RunMpcSession(spec);
+            latencies.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            phase.sessions++;
+            if (result.status != session::MpcSessionStatus::COMPLETED || result.participants.size() != 1) {
+                phase.failures++;
+                continue;
+            }
+            phase.picks[result.participants[0]]++;
+        }
+        phase.p50_ms = Percentile(latencies, 50);
+        return phase;
+    };
+    auto share = [](PhaseResult& phase, const std::string& node_id) {
+        return phase.sessions > 0 ? 100.0 * phase.picks[node_id] / phase.sessions : 0.0;
+    };
+    auto report = [&](const char* label, PhaseResult& phase) {
+        std::cout << "[PERF] " << label << ": " << phase.sessions << " sessions, p50 " << phase.p50_ms << "ms, "
+                  << node_ids[1] << " " << share(phase, node_ids[1]) << "% / " << node_ids[2] << " "
+                  << share(phase, node_ids[2]) << "%, failures " << phase.failures << std::endl;
+    };
+
+    const auto phase_duration = std::chrono::milliseconds(1500);
+    coordinator::network::NodeSelectionConfig config;
+    config.avoided_nodes = { node_ids[0] };
+
+    // 1. 기준: 후보 순서 고정 - node3이 느려도 계속 선택
+    config.policy = coordinator::network::NodeSelectionPolicy::ORDERED;
+    coordinator->SetNodeSelection(config);
+    slow_node_index = 2;
+    PhaseResult ordered = run_phase(phase_duration);
+    report("ordered, node3 slow", ordered);
+    if (ordered.failures != 0 || share(ordered, node_ids[2]) != 100.0) {
+        std::cerr << "Ordered policy should keep the first non-avoided candidate" << std::endl;
+        passed = false;
+    }
+
+    // 2. 지연 기반: node3이 느리면 node2로 이동
+    config.policy = coordinator::network::NodeSelectionPolicy::LOWEST_LATENCY;
+    coordinator->SetNodeSelection(config);
+    PhaseResult latency_a = run_phase(phase_duration);
+    report("latency, node3 slow", latency_a);
+
+    // 3. 조건 변경: node2가 느려지면 node3으로 재조정 (node3은 오래된 표본 → 재시도로 회복 감지)
+    slow_node_index = 1;
+    PhaseResult latency_b = run_phase(phase_duration);
+    report("latency, node2 slow", latency_b);
+
+    slow_node_index = -1;
+    coordinator->SetNodeSelection(coordinator::network::NodeSelectionConfig());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    bool avoided_used = latency_a.picks.count(node_ids[0]) > 0 || latency_b.picks.count(node_ids[0]) > 0;
+    if (latency_a.failures + latency_b.failures != 0 || avoided_used ||
+        share(latency_a, node_ids[1]) < 80.0 || share(latency_b, node_ids[2]) < 80.0 ||
+        latency_a.sessions <= ordered.sessions * 2) {
+        std::cerr << "Latency-aware selection did not follow the fast node" << std::endl;
+        passed = false;
+    }
+
+    // 4. SelectNodes - 회피 노드는 다른 후보가 부족할 때만
+    config.policy = coordinator::network::NodeSelectionPolicy::LOWEST_LATENCY;
+    coordinator->SetNodeSelection(config);
+    std::vector<std::string> two = coordinator->SelectNodes(candidates, 2);
+    std::vector<std::string> three = coordinator->SelectNodes(candidates, 3);
+    coordinator->SetNodeSelection(coordinator::network::NodeSelectionConfig());
+    if (two.size() != 2 || std::find(two.begin(), two.end(), node_ids[0]) != two.end() ||
+        three.size() != 3 || three.back() != node_ids[0]) {
+        std::cerr << "Avoided node should only fill the remaining slots" << std::endl;
+        passed = false;
+    }
+
+    if (passed) {
+        std::cout << "✓ Threshold sessions pick the currently fastest nodes and rebalance when latency shifts" << std::endl;
+    }
+    return passed;
+}
+
+bool TestHedgedSessions(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 14: Hedged MPC Sessions ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    auto* node3 = env.GetNode(2);
+    if (!coordinator || !node3 || !node3->GetTcpServer()) {
+        std::cerr << "Environment not available" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    bool passed = true;
+
+    // node3이 가끔(4% 세션) 메시지마다 30ms씩 멈춤 - 후보 순서 고정이라 항상 node3이 참여자
+    static std::atomic<bool> stalled{false};
+    node3->GetTcpServer()->SetMessageHandler([](const mpc_engine::network::framing::NetworkMessage& message) {
+        if (stalled.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        }
+        return node::handlers::NodeMessageRouter::Instance().Process(message);
+    });
+    coordinator::network::NodeSelectionConfig selection;
+    selection.policy = coordinator::network::NodeSelectionPolicy::ORDERED;
+    coordinator->SetNodeSelection(selection);
+
+    const int sessions = 400;
+    const int stall_every = 25;
+    struct PhaseResult
+    {
+        std::vector<double> latencies;
+        int failures = 0;
+        int hedged = 0;
+    };
+    auto run_phase = [&]() {
+        PhaseResult phase;
+        for (int i = 0; i < sessions; ++i) {
+            bool stall = (i % stall_every) == stall_every - 1;
+            stalled = stall;
+
+            session::MpcSessionSpec spec;
+            spec.protocol = MPC_PROTOCOL_ECDSA_SIGNING;
+            spec.key_id = "hedge_key";
+            spec.node_ids = { node_ids[2], node_ids[1] };
+            spec.threshold = 1;
+            spec.session_input = "0x" + std::string(64, 'f');
+            auto start = std::chrono::steady_clock::now();
+            session::MpcSessionResult result = coordinator->RunMpcSession(spec);
+            phase.latencies.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            phase.failures += (result.status != session::MpcSessionStatus::COMPLETED) ? 1 : 0;
+            phase.hedged += result.hedged ? 1 : 0;
+
+            if (stall) {
+                stalled = false;
+                std::this_thread::sleep_for(std::chrono::milliseconds(40));   // 멈춘 요청 소진 (측정 제외)
+            }
+        }
+        return phase;
+    };
+
+    // 1. hedge 없음
+    PhaseResult plain = run_phase();
+
+    // 2. hedge 5% - node3이 자기 p95(최소 2ms) 안에 응답하지 않으면 node2로 한 번 더
+    session::MpcHedgeConfig hedging;
+    hedging.max_ratio = 0.05;
+    coordinator->SetMpcHedging(hedging);
+    session::MpcSessionEngineStats before = coordinator->GetMpcSessionStats();
+    PhaseResult hedged = run_phase();
+    session::MpcSessionEngineStats after = coordinator->GetMpcSessionStats();
+
+    coordinator->SetMpcHedging(session::MpcHedgeConfig());
+    coordinator->SetNodeSelection(coordinator::network::NodeSelectionConfig());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    uint64_t eligible = after.hedge_eligible - before.hedge_eligible;
+    uint64_t hedges = after.hedges - before.hedges;
+    uint64_t wins = after.hedge_wins - before.hedge_wins;
+    double hedge_rate = eligible > 0 ? 100.0 * static_cast<double>(hedges) / static_cast<double>(eligible) : 0.0;
+
+    std::cout << "[PERF] no hedging: p50 " << Percentile(plain.latencies, 50) << "ms, p99 " << Percentile(plain.latencies, 99)
+              << "ms, failures " << plain.failures << std::endl;
+    std::cout << "[PERF] 5% hedging: p50 " << Percentile(hedged.latencies, 50) << "ms, p99 " << Percentile(hedged.latencies, 99)
+              << "ms, failures " << hedged.failures << std::endl;
+    std::cout << "[PERF] hedge rate " << hedge_rate << "% (" << hedges << "/" << eligible << " sessions, "
+              << wins << " won by the spare)" << std::endl;
+
+    if (plain.failures + hedged.failures != 0) {
+        std::cerr << "Sessions failed" << std::endl;
+        passed = false;
+    }
+    if (eligible != static_cast<uint64_t>(sessions) || static_cast<double>(hedges) > 0.05 * static_cast<double>(eligible) ||
+        hedged.hedged != static_cast<int>(hedges) || wins < static_cast<uint64_t>(sessions / stall_every / 2)) {
+        std::cerr << "Hedge budget / accounting mismatch" << std::endl;
+        passed = false;
+    }
+    if (Percentile(hedged.latencies, 99) * 2 >= Percentile(plain.latencies, 99)) {
+        std::cerr << "Hedging did not cut the tail" << std::endl;
+        passed = false;
+    }
+
+    if (passed) {
+        std::cout << "✓ Stalled participants are hedged to a spare node within the 5% budget" << std::endl;
+    }
+    return passed;
+}
+
+bool TestBatchedKeygen(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 15: Batched Key Generation ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    if (!coordinator || !env.GetNode(1) || !env.GetNode(2)) {
+        std::cerr << "Environment not available" << std::endl;
+        return false;
+    }
+
+    // 이전 테스트가 교체한 핸들러 복원 - 배치 요청의 키별 연산을 노드의 핸들러 워커에 분배
+    for (size_t index : { 1, 2 }) {
+        node::network::NodeTcpServer* server = env.GetNode(index)->GetTcpServer();
+        server->SetMessageHandler([server](const mpc_engine::network::framing::NetworkMessage& message) {
+            utils::ScopedParallelRunner parallel(server);
+            return node::handlers::NodeMessageRouter::Instance().Process(message);
+        });
+    }
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    const std::vector<std::string> keygen_nodes = { node_ids[1], node_ids[2] };
+    const size_t batch_size = 100;
+    bool passed = true;
+
+    // 1. 기준: 키마다 keygen 세션 1개씩 순차 실행 (라운드 배칭 window 없이 - 순차 호출에는 대기만 추가됨)
+    coordinator->SetMpcRoundBatching(session::MpcRoundBatchConfig());
+    size_t sequential_completed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < batch_size; ++i) {
+        session::MpcSessionSpec spec;
+        spec.protocol = MPC_PROTOCOL_KEYGEN;
+        spec.key_id = "seq_key_" + std::to_string(i);
+        spec.node_ids = keygen_nodes;
+        spec.threshold = 2;
+        sequential_completed += (coordinator->RunMpcSession(spec).status == session::MpcSessionStatus::COMPLETED) ? 1 : 0;
+    }
+    double sequential_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    session::MpcRoundBatchConfig restored;
+    if (Config::HasKey("COORDINATOR_MPC_BATCH_WINDOW_US")) {
+        restored.window = std::chrono::microseconds(Config::GetUInt32("COORDINATOR_MPC_BATCH_WINDOW_US"));
+    }
+    if (Config::HasKey("COORDINATOR_MPC_BATCH_MAX")) {
+        restored.max_batch = Config::GetUInt32("COORDINATOR_MPC_BATCH_MAX");
+    }
+    coordinator->SetMpcRoundBatching(restored);
+
+    // 2. 배치: 같은 수의 키를 라운드마다 노드당 메시지 1개로
+    uint64_t parallel_before = env.GetNode(1)->GetTcpServer()->GetStats().parallel_tasks +
+                               env.GetNode(2)->GetTcpServer()->GetStats().parallel_tasks;
+    session::MpcKeygenBatchSpec batch_spec;
+    for (size_t i = 0; i < batch_size; ++i) {
+        batch_spec.key_ids.push_back("batch_key_" + std::to_string(i));
+    }
+    batch_spec.node_ids = keygen_nodes;
+    batch_spec.threshold = 2;
+    start = std::chrono::steady_clock::now();
+    session::MpcKeygenBatchResult batch = coordinator->RunKeygenBatch(batch_spec);
+    double batch_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    uint64_t parallel_after = env.GetNode(1)->GetTcpServer()->GetStats().parallel_tasks +
+                              env.GetNode(2)->GetTcpServer()->GetStats().parallel_tasks;
+
+    double sequential_rate = batch_size * 60000.0 / sequential_ms;
+    double batch_rate = batch_size * 60000.0 / batch_ms;
+    std::cout << "[PERF] sequential: " << batch_size << " keys in " << sequential_ms << "ms (" << sequential_rate << " keys/min)" << std::endl;
+    std::cout << "[PERF] batch of " << batch_size << ": " << batch_ms << "ms (" << batch_rate << " keys/min, "
+              << batch.messages_sent << " messages, " << (parallel_after - parallel_before) << " node helper tasks) → "
+              << batch_rate / sequential_rate << "x" << std::endl;
+
+    if (sequential_completed != batch_size || batch.completed != batch_size || batch.failed != 0) {
+        std::cerr << "Keygen failed: sequential " << sequential_completed << ", batch " << batch.completed << "/" << batch_size << std::endl;
+        for (const session::MpcKeygenKeyResult& key : batch.keys) {
+            if (key.status != session::MpcSessionStatus::COMPLETED) {
+                std::cerr << "  " << key.key_id << ": " << key.error_message << std::endl;
+                break;
+            }
+        }
+        passed = false;
+    }
+    // 5 라운드 × 2 노드 - 라운드마다 노드당 메시지 1개
+    if (batch.messages_sent != 10) {
+        std::cerr << "Expected 10 round messages, sent " << batch.messages_sent << std::endl;
+        passed = false;
+    }
+    std::map<std::string, size_t> public_keys;
+    for (const session::MpcKeygenKeyResult& key : batch.keys) {
+        if (key.public_key.rfind("MOCK_PUBKEY_", 0) != 0 || ++public_keys[key.public_key] != 1) {
+            std::cerr << "Unexpected public key for " << key.key_id << ": " << key.public_key << std::endl;
+            passed = false;
+            break;
+        }
+    }
+    // 루프백/단일 코어에서도 유지되는 하한 - 노드 간 RTT가 클수록 배율은 커짐
+    if (batch_rate < sequential_rate * 3) {
+        std::cerr << "Batch keygen is not 3x faster than the sequential loop" << std::endl;
+        passed = false;
+    }
+
+    // 3. 큰 배치는 max_keys_per_message 단위로 나눠 전송
+    batch_spec.key_ids.clear();
+    for (size_t i = 0; i < 1000; ++i) {
+        batch_spec.key_ids.push_back("bulk_key_" + std::to_string(i));
+    }
+    start = std::chrono::steady_clock::now();
+    session::MpcKeygenBatchResult bulk = coordinator->RunKeygenBatch(batch_spec);
+    double bulk_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[PERF] batch of 1000: " << bulk_ms << "ms (" << 1000 * 60000.0 / bulk_ms << " keys/min, "
+              << bulk.messages_sent << " messages)" << std::endl;
+    if (bulk.completed != 1000 || bulk.messages_sent != 5 * 2 * 4) {
+        std::cerr << "Bulk batch: " << bulk.completed << "/1000 keys, " << bulk.messages_sent << " messages" << std::endl;
+        passed = false;
+    }
+
+    // 4. 연결되지 않은 노드가 있으면 시작하지 않음
+    batch_spec.key_ids = { "orphan_key" };
+    batch_spec.node_ids = { node_ids[1], "missing-node" };
+    session::MpcKeygenBatchResult rejected = coordinator->RunKeygenBatch(batch_spec);
+    if (rejected.failed != 1 || rejected.messages_sent != 0) {
+        std::cerr << "Batch with a missing node was not rejected" << std::endl;
+        passed = false;
+    }
+
+    if (passed) {
+        std::cout << "✓ Keys generated in lockstep batches with one message per node per round" << std::endl;
+    }
+    return passed;
+}
+
+bool TestOpaqueRelay(TlsTestEnvironment& env)
+{
+    std::cout << "\n=== Test 16: Opaque Round Relay ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    if (!coordinator) {
+        std::cerr << "Coordinator not available" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    bool passed = true;
+
+    // 1. 같은 세션을 protobuf 중계 / envelope 중계로 실행 - 노드 입력이 같으므로 결과도 같아야 함
+    const std::vector<MpcProtocol> protocols = { MPC_PROTOCOL_KEYGEN, MPC_PROTOCOL_ECDSA_SIGNING, MPC_PROTOCOL_EDDSA_SIGNING };
+    for (MpcProtocol protocol : protocols) {
+        session::MpcSessionSpec spec;
+        spec.session_id = std::string("relay_cmp_") + MpcProtocol_Name(protocol);
+        spec.protocol = protocol;
+        spec.key_id = "relay_cmp_key";
+        spec.node_ids = { node_ids[1], node_ids[2] };
+        spec.threshold = 2;
+        spec.session_input = "0x" + std::string(64, 'e');
+
+        coordinator->SetMpcOpaqueRelay(false);
+        session::MpcSessionResult parsed = coordinator->RunMpcSession(spec);
+        uint64_t relay_before = coordinator->GetMpcSessionStats().relay_sessions;
+        coordinator->SetMpcOpaqueRelay(true);
+        session::MpcSessionResult relayed = coordinator->RunMpcSession(spec);
+        coordinator->SetMpcOpaqueRelay(false);
+
+        std::cout << MpcProtocol_Name(protocol) << ": parsed " << parsed.output << ", opaque " << relayed.output << std::endl;
+        if (parsed.status != session::MpcSessionStatus::COMPLETED || relayed.status != session::MpcSessionStatus::COMPLETED ||
+            parsed.output != relayed.output || relayed.completed_rounds != parsed.completed_rounds) {
+            std::cerr << "Opaque relay result differs: " << parsed.error_message << " / " << relayed.error_message << std::endl;
+            passed = false;
+        }
+        if (coordinator->GetMpcSessionStats().relay_sessions != relay_before + 1) {
+            std::cerr << "Session was not relayed as envelopes" << std::endl;
+            passed = false;
+        }
+    }
+
+    // 2. 동시 세션 - 라운드 요청마다 같은 envelope 버퍼를 여러 수신자가 공유
+    session::MpcSessionSpec load_spec;
+    load_spec.protocol = MPC_PROTOCOL_ECDSA_SIGNING;
+    load_spec.node_ids = { node_ids[1], node_ids[2] };
+    load_spec.threshold = 2;
+    load_spec.session_input = "0x" + std::string(64, 'f');
+
+    coordinator->SetMpcOpaqueRelay(true);
+    BatchingPoint point = RunBatchingPoint(coordinator, load_spec, "relay_load", 500, 32);
+    coordinator->SetMpcOpaqueRelay(false);
+    std::cout << "[PERF] opaque relay, 32 in flight: " << point.sessions_per_sec << " sessions/s, p50 "
+              << point.p50_ms << "ms, p99 " << point.p99_ms << "ms" << std::endl;
+    if (point.completed != 500) {
+        std::cerr << "Concurrent relay sessions: " << point.completed << "/500 completed" << std::endl;
+        passed = false;
+    }
+
+    if (passed) {
+        std::cout << "✓ Round outputs forwarded as opaque envelopes with identical results" << std::endl;
+    }
+    return passed;
+}
+
 void PrintTestResult(const std::string& test_name, bool result)
 {
     std::cout << "[" << (result ? "PASS" : "FAIL") << "] " << test_name << std::endl;
@@ -392,14 +1616,38 @@ int main()
         bool test2 = TestSigningProtocol(env);
         bool test3 = TestConcurrentRequests(env);
         bool test4 = TestStressTest(env);
+        bool test5 = TestStalledHandshakeDoesNotBlockReconnect(env);
+        bool test6 = TestShuttingDownNodeFailsOver(env);
+        bool test7 = TestLatencyHistograms(env);
+        bool test8 = TestQuorumFanOut(env);
+        bool test9 = TestFanOutThreadCreation(env);
+        bool test10 = TestMultiRoundMpcSessions(env);
+        bool test11 = TestCrossSessionRoundBatching(env);
+        bool test12 = TestPresignaturePool(env);
+        bool test13 = TestLatencyAwareNodeSelection(env);
+        bool test14 = TestHedgedSessions(env);
+        bool test15 = TestBatchedKeygen(env);
+        bool test16 = TestOpaqueRelay(env);
 
         std::cout << "\n=== Test Results ===" << std::endl;
         PrintTestResult("Basic TLS Connection", test1);
         PrintTestResult("Signing Protocol over TLS", test2);
         PrintTestResult("Concurrent Requests", test3);
         PrintTestResult("TLS Stress Test", test4);
-
-        bool all_passed = test1 && test2 && test3 && test4;
+        PrintTestResult("Stalled Handshake vs Reconnect", test5);
+        PrintTestResult("Shutting-down Node Fails Over", test6);
+        PrintTestResult("Per-stage Latency Histograms", test7);
+        PrintTestResult("Threshold Quorum Fan-out", test8);
+        PrintTestResult("Fan-out Thread Creation", test9);
+        PrintTestResult("Multi-round MPC Sessions", test10);
+        PrintTestResult("Cross-session Round Batching", test11);
+        PrintTestResult("Presignature Pool", test12);
+        PrintTestResult("Latency-aware Node Selection", test13);
+        PrintTestResult("Hedged MPC Sessions", test14);
+        PrintTestResult("Batched Key Generation", test15);
+        PrintTestResult("Opaque Round Relay", test16);
+
+        bool all_passed = test1 && test2 && test3 && test4 && test5 && test6 && test7 && test8 && test9 && test10 && test11 && test12 && test13 && test14 && test15 && test16;
         
         std::cout << "\n================================================" << std::endl;
         if (all_passed) {
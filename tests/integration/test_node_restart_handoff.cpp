@@ -0,0 +1,494 @@
+// tests/integration/test_node_restart_handoff.cpp
+#include "coordinator/CoordinatorServer.hpp"
+#include "node/NodeServer.hpp"
+#include "node/network/include/ListenerHandoff.hpp"
+#include "node/network/include/NodePeerMesh.hpp"
+#include "common/env/EnvManager.hpp"
+#include "types/BasicTypes.hpp"
+#include "common/kms/include/KMSManager.hpp"
+#include "common/network/tls/include/TlsContext.hpp"
+#include "common/resource/include/ReadOnlyResLoaderManager.hpp"
+#include "types/MessageTypes.hpp"
+#include "proto/coordinator_node/generated/message.pb.h"
+#include "proto/coordinator_node/generated/signing.pb.h"
+#include "proto/coordinator_node/generated/common.pb.h"
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <map>
+#include <unistd.h>
+
+using namespace mpc_engine;
+using namespace mpc_engine::coordinator;
+using namespace mpc_engine::node;
+using namespace mpc_engine::node::network;
+using namespace mpc_engine::env;
+using namespace mpc_engine::kms;
+using namespace mpc_engine::proto::coordinator_node;
+using namespace mpc_engine::resource;
+
+/**
+ * 무중단 재시작 테스트
+ *
+ * 같은 테스트 프로세스 안에서 "기존 노드"와 "새 노드"를 띄워
+ * 실제 배포 시 두 프로세스 간에 일어나는 listening socket 핸드오프를 재현합니다.
+ * (SCM_RIGHTS는 같은 프로세스 안에서도 새 fd를 만들어 전달하므로 경로는 동일)
+ */
+class HandoffTestEnvironment
+{
+private:
+    std::unique_ptr<NodeServer> old_node;
+    std::unique_ptr<NodeServer> new_node;
+    std::unique_ptr<CoordinatorServer> coordinator_server;
+    NodeConfig node_config;
+    std::string probe_certificate_path;     // mesh 도달 확인용 peer (node2 인증서)
+    std::string probe_private_key_id;
+    std::string handoff_path;
+    std::atomic<bool> handed_off{false};
+
+public:
+    bool SetupEnvironment()
+    {
+        std::cout << "\n=== Setting up Handoff Test Environment ===" << std::endl;
+
+        if (!EnvManager::Instance().Initialize("local")) {
+            std::cerr << "Failed to initialize config" << std::endl;
+            return false;
+        }
+
+        ReadOnlyResLoaderManager::Instance().Initialize(PlatformType::LOCAL);
+
+        std::string kms_path = Config::GetString("NODE_LOCAL_KMS_PATH");
+        KMSManager::InitializeLocal(PlatformType::LOCAL, kms_path);
+        TlsContext::GlobalInit();
+
+        // node1 하나만 사용
+        std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+        std::vector<std::pair<std::string, uint16_t>> node_hosts = Config::GetNodeEndpoints("NODE_HOSTS");
+        std::vector<std::string> platforms = Config::GetStringArray("NODE_PLATFORMS");
+        std::vector<std::string> tls_cert_paths = Config::GetStringArray("TLS_CERT_PATHS");
+        std::vector<std::string> tls_kms_nodes_coordinator_key_ids = Config::GetStringArray("TLS_KMS_NODES_COORDINATOR_KEY_IDS");
+        std::vector<std::pair<std::string, uint16_t>> mesh_hosts = Config::GetNodeEndpoints("NODE_MESH_HOSTS");
+
+        node_config.node_id = node_ids[0];
+        node_config.bind_address = node_hosts[0].first;
+        node_config.bind_port = node_hosts[0].second;
+        node_config.platform_type = PlatformTypeFromString(platforms[0]);
+        node_config.certificate_path = tls_cert_paths[0];
+        node_config.private_key_id = tls_kms_nodes_coordinator_key_ids[0];
+        node_config.mesh_bind_address = mesh_hosts[0].first;
+        node_config.mesh_port = mesh_hosts[0].second;
+        probe_certificate_path = tls_cert_paths[1];
+        probe_private_key_id = tls_kms_nodes_coordinator_key_ids[1];
+
+        handoff_path = ListenerHandoff::GetPath("/tmp", node_config.node_id + "-test-" + std::to_string(getpid()));
+
+        old_node = StartNode(INVALID_SOCKET_VALUE);
+        if (!old_node) {
+            return false;
+        }
+        if (!EnableHandoff(old_node.get())) {
+            return false;
+        }
+        std::cout << "✓ Old node started: " << node_config.node_id << std::endl;
+
+        coordinator_server = std::make_unique<CoordinatorServer>();
+        if (!coordinator_server->Initialize()) {
+            std::cerr << "Failed to initialize coordinator" << std::endl;
+            return false;
+        }
+
+        if (!coordinator_server->RegisterNode(node_config.node_id, node_config.platform_type,
+                                              node_config.bind_address, node_config.bind_port, 0)) {
+            std::cerr << "Failed to register node" << std::endl;
+            return false;
+        }
+
+        if (!coordinator_server->Start() || !coordinator_server->ConnectToNode(node_config.node_id)) {
+            std::cerr << "Failed to connect coordinator to node" << std::endl;
+            return false;
+        }
+
+        std::cout << "✓ Coordinator connected" << std::endl;
+        return true;
+    }
+
+    void TeardownEnvironment()
+    {
+        std::cout << "\n=== Tearing down environment ===" << std::endl;
+
+        if (coordinator_server) {
+            coordinator_server->Stop();
+            coordinator_server.reset();
+        }
+        if (old_node && old_node->IsRunning()) {
+            old_node->Stop();
+        }
+        if (new_node && new_node->IsRunning()) {
+            new_node->Stop();
+        }
+        old_node.reset();
+        new_node.reset();
+
+        TlsContext::GlobalCleanup();
+        std::cout << "✓ Teardown complete" << std::endl;
+    }
+
+    std::unique_ptr<NodeServer> StartNode(socket_t inherited_listener, socket_t inherited_mesh_listener = INVALID_SOCKET_VALUE)
+    {
+        NodeConfig config = node_config;
+        config.inherited_listener = inherited_listener;
+        config.inherited_mesh_listener = inherited_mesh_listener;
+
+        auto node_server = std::make_unique<NodeServer>(config);
+        if (!node_server->Initialize()) {
+            std::cerr << "Failed to initialize node" << std::endl;
+            return nullptr;
+        }
+
+        if (auto* tcp_server = node_server->GetTcpServer()) {
+            tcp_server->SetTrustedCoordinator(Config::GetString("TRUSTED_COORDINATOR_IP"));
+            tcp_server->EnableKernelFirewall(false);
+        }
+
+        if (!node_server->Start()) {
+            std::cerr << "Failed to start node" << std::endl;
+            return nullptr;
+        }
+        return node_server;
+    }
+
+    bool EnableHandoff(NodeServer* node_server)
+    {
+        handed_off = false;
+        node_server->GetTcpServer()->SetHandoffHandler([this]() { handed_off = true; });
+        return node_server->GetTcpServer()->EnableListenerHandoff(handoff_path);
+    }
+
+    /**
+     * @brief 새 peer 연결로 mesh 포트에 메시지를 보내 node_server의 mesh가 받는지 확인
+     * (포트를 accept하는 프로세스가 받으므로 인수/롤백 후 어느 쪽이 mesh를 가졌는지 알 수 있음)
+     */
+    bool ProbeMesh(NodeServer* node_server, const std::string& session_id)
+    {
+        auto probe = std::make_shared<NodePeerMesh>("handoff-probe", "127.0.0.1", 0);
+        if (!probe->Initialize(probe_certificate_path, probe_private_key_id) || !probe->Start()) {
+            std::cerr << "Failed to start probe mesh" << std::endl;
+            return false;
+        }
+
+        MpcPeerMessage message;
+        message.set_session_id(session_id);
+        message.set_round(1);
+        message.set_from_player(2);
+        message.set_to_player(1);
+        message.set_payload("probe");
+
+        std::string error;
+        PeerEndpoint endpoint{ node_config.node_id, node_config.mesh_bind_address, node_config.mesh_port };
+        bool received = false;
+        if (!probe->Send(endpoint, message, &error)) {
+            std::cerr << "Mesh probe send failed: " << error << std::endl;
+        } else if (node_server->GetPeerMesh()) {
+            std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+            std::map<uint64_t, std::string> payloads;
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            received = node_server->GetPeerMesh()->Receive(session_id, 1, 1, { { 2, node_ids[1] } }, deadline, &payloads, &error);
+            if (!received) {
+                std::cerr << "Mesh probe not received: " << error << std::endl;
+            }
+        }
+        probe->Stop();
+        return received;
+    }
+
+    CoordinatorServer* GetCoordinator() { return coordinator_server.get(); }
+    NodeServer* GetOldNode() { return old_node.get(); }
+    NodeServer* GetNewNode() { return new_node.get(); }
+    void SetNewNode(std::unique_ptr<NodeServer> node_server) { new_node = std::move(node_server); }
+    const std::string& GetNodeId() const { return node_config.node_id; }
+    const std::string& GetHandoffPath() const { return handoff_path; }
+    bool IsHandedOff() const { return handed_off.load(); }
+};
+
+// ===== Helper Functions =====
+
+uint64_t GetCurrentTimeMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+}
+
+std::unique_ptr<CoordinatorNodeMessage> CreateSigningRequest(const std::string& uid, uint64_t request_id)
+{
+    auto message = std::make_unique<CoordinatorNodeMessage>();
+    message->set_message_type(static_cast<int32_t>(mpc_engine::MessageType::SIGNING_REQUEST));
+
+    SigningRequest* request = message->mutable_signing_request();
+    RequestHeader* header = request->mutable_header();
+    header->set_uid(uid);
+    header->set_send_time(std::to_string(GetCurrentTimeMs()));
+    header->set_request_id(request_id);
+
+    request->set_key_id("handoff_key");
+    request->set_transaction_data("0x" + std::string(64, 'f'));
+    request->set_threshold(2);
+    request->set_total_shards(3);
+    return message;
+}
+
+/**
+ * @brief 서명 요청을 계속 보내며 성공 시각 기록
+ *
+ * 실패(SHUTTING_DOWN, 연결 끊김)는 바로 재시도하므로
+ * 연속된 두 성공 사이 간격이 곧 서명 불가 구간입니다.
+ */
+class SigningLoad
+{
+private:
+    CoordinatorServer* coordinator;
+    std::string node_id;
+    std::thread worker;
+    std::atomic<bool> running{false};
+    std::mutex mutex;
+    std::vector<std::chrono::steady_clock::time_point> successes;
+    std::atomic<uint64_t> failures{0};
+
+public:
+    SigningLoad(CoordinatorServer* coordinator, const std::string& node_id)
+        : coordinator(coordinator), node_id(node_id) {}
+
+    ~SigningLoad() { Stop(); }
+
+    void Start()
+    {
+        running = true;
+        worker = std::thread([this]() {
+            uint64_t seq = 0;
+            while (running.load()) {
+                auto request = CreateSigningRequest("handoff_load", ++seq);
+                auto response = coordinator->SendToNode(node_id, request.get());
+                if (response && response->has_signing_response()) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    successes.push_back(std::chrono::steady_clock::now());
+                } else {
+                    failures++;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+        });
+    }
+
+    void Stop()
+    {
+        running = false;
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    size_t SuccessCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return successes.size();
+    }
+
+    uint64_t FailureCount() const { return failures.load(); }
+
+    // since 이후 성공 간 최대 간격 (ms)
+    int64_t MaxGapMs(std::chrono::steady_clock::time_point since)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        int64_t max_gap = -1;
+        std::chrono::steady_clock::time_point prev = since;
+        for (const auto& t : successes) {
+            if (t < since) {
+                continue;
+            }
+            max_gap = std::max<int64_t>(max_gap,
+                std::chrono::duration_cast<std::chrono::milliseconds>(t - prev).count());
+            prev = t;
+        }
+        return max_gap;
+    }
+};
+
+// ===== Test Functions =====
+
+bool TestAbortedHandoffRollsBack(HandoffTestEnvironment& env)
+{
+    std::cout << "\n=== Test 1: Aborted Handoff Rolls Back ===" << std::endl;
+
+    auto* old_tcp = env.GetOldNode()->GetTcpServer();
+
+    // 새 프로세스가 listener를 받은 뒤 Confirm 없이 죽은 경우
+    {
+        auto handoff = ListenerHandoff::Acquire(env.GetHandoffPath(), 5000);
+        if (!handoff) {
+            std::cerr << "Failed to acquire listener" << std::endl;
+            return false;
+        }
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    if (env.IsHandedOff() || old_tcp->IsListenerHandedOff()) {
+        std::cerr << "Old node gave up its listener without confirmation" << std::endl;
+        return false;
+    }
+
+    // 기존 노드는 계속 서비스
+    auto request = CreateSigningRequest("rollback_check", 1);
+    auto response = env.GetCoordinator()->SendToNode(env.GetNodeId(), request.get());
+    if (!response || !response->has_signing_response()) {
+        std::cerr << "Old node stopped serving after aborted handoff" << std::endl;
+        return false;
+    }
+
+    // 함께 넘겼던 mesh listener도 다시 accept
+    if (!env.ProbeMesh(env.GetOldNode(), "handoff_mesh_rollback")) {
+        std::cerr << "Old node stopped accepting mesh links after aborted handoff" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ Old node kept its listeners and kept serving" << std::endl;
+    return true;
+}
+
+bool TestRestartSigningGap(HandoffTestEnvironment& env)
+{
+    std::cout << "\n=== Test 2: Signing Availability During Restart ===" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    SigningLoad load(coordinator, env.GetNodeId());
+    load.Start();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    size_t before = load.SuccessCount();
+    if (before == 0) {
+        std::cerr << "No signing traffic before restart" << std::endl;
+        return false;
+    }
+
+    // 재시작 시작 시점부터 서명 간격 측정
+    auto restart_start = std::chrono::steady_clock::now();
+
+    // 1. 새 프로세스: listener 인수 → 시작 → Confirm
+    auto handoff = ListenerHandoff::Acquire(env.GetHandoffPath(), 5000);
+    if (!handoff) {
+        load.Stop();
+        std::cerr << "Failed to acquire listener" << std::endl;
+        return false;
+    }
+
+    socket_t listener = handoff->ReleaseListener();
+    socket_t mesh_listener = handoff->ReleaseMeshListener();
+    auto new_node = env.StartNode(listener, mesh_listener);
+    if (!new_node || !handoff->Confirm()) {
+        load.Stop();
+        std::cerr << "New node failed to take over" << std::endl;
+        return false;
+    }
+    handoff.reset();
+    env.SetNewNode(std::move(new_node));
+
+    // 2. 기존 프로세스: READY 수신 → drain 후 종료
+    auto wait_start = std::chrono::steady_clock::now();
+    while (!env.IsHandedOff() &&
+           std::chrono::steady_clock::now() - wait_start < std::chrono::seconds(5)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (!env.IsHandedOff()) {
+        load.Stop();
+        std::cerr << "Old node did not observe handoff" << std::endl;
+        return false;
+    }
+    env.GetOldNode()->Stop();
+    auto old_stopped = std::chrono::steady_clock::now();
+
+    // 3. 새 프로세스가 트래픽을 받을 때까지 계속 부하 유지
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    load.Stop();
+
+    auto restart_ms = std::chrono::duration_cast<std::chrono::milliseconds>(old_stopped - restart_start).count();
+    int64_t max_gap = load.MaxGapMs(restart_start);
+    uint64_t new_node_messages = env.GetNewNode()->GetTcpServer()->GetStats().messages_received;
+
+    std::cout << "\n[PERF] Restart (acquire → old node stopped): " << restart_ms << "ms" << std::endl;
+    std::cout << "[PERF] Max signing gap during restart: " << max_gap << "ms" << std::endl;
+    std::cout << "[PERF] Signed before/total: " << before << "/" << load.SuccessCount()
+              << ", failed attempts: " << load.FailureCount() << std::endl;
+    std::cout << "[PERF] Requests served by new node: " << new_node_messages << std::endl;
+
+    if (new_node_messages == 0) {
+        std::cerr << "Coordinator never reached the new node" << std::endl;
+        return false;
+    }
+
+    // mesh 포트도 인수 - 새 노드가 mesh 없이 떠서 mesh 세션을 거절하면 안 됨
+    if (!env.ProbeMesh(env.GetNewNode(), "handoff_mesh_takeover")) {
+        std::cerr << "New node did not take over the peer mesh" << std::endl;
+        return false;
+    }
+    std::cout << "✓ New node took over the peer mesh listener" << std::endl;
+
+    // 포트가 닫히는 구간이 없으므로 drain + 재연결 수준이어야 함
+    if (max_gap < 0 || max_gap > 2000) {
+        std::cerr << "Signing gap too large" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ Node restarted without closing the port" << std::endl;
+    return true;
+}
+
+void PrintTestResult(const std::string& test_name, bool result)
+{
+    std::cout << "[" << (result ? "PASS" : "FAIL") << "] " << test_name << std::endl;
+}
+
+int main()
+{
+    std::cout << "================================================" << std::endl;
+    std::cout << "  MPC Engine Node Restart Handoff Test" << std::endl;
+    std::cout << "================================================" << std::endl;
+
+    HandoffTestEnvironment env;
+
+    try {
+        if (!env.SetupEnvironment()) {
+            std::cerr << "Failed to setup test environment" << std::endl;
+            env.TeardownEnvironment();
+            return 1;
+        }
+
+        bool test1 = TestAbortedHandoffRollsBack(env);
+        bool test2 = TestRestartSigningGap(env);
+
+        std::cout << "\n=== Test Results ===" << std::endl;
+        PrintTestResult("Aborted Handoff Rolls Back", test1);
+        PrintTestResult("Signing Availability During Restart", test2);
+
+        bool all_passed = test1 && test2;
+
+        std::cout << "\n================================================" << std::endl;
+        if (all_passed) {
+            std::cout << "  🎉 ALL TESTS PASSED!" << std::endl;
+        } else {
+            std::cout << "  ❌ SOME TESTS FAILED" << std::endl;
+        }
+        std::cout << "================================================" << std::endl;
+
+        env.TeardownEnvironment();
+        return all_passed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Test exception: " << e.what() << std::endl;
+        env.TeardownEnvironment();
+        return 1;
+    }
+}
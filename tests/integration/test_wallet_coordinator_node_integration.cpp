@@ -1,11 +1,14 @@
 // tests/integration/test_wallet_coordinator_node_integration.cpp
 #include "coordinator/CoordinatorServer.hpp"
 #include "node/NodeServer.hpp"
+#include "node/handlers/include/NodeMessageRouter.hpp"
 #include "common/env/EnvManager.hpp"
 #include "common/kms/include/KMSManager.hpp"
 #include "common/resource/include/ReadOnlyResLoaderManager.hpp"
 #include "common/network/tls/include/TlsContext.hpp"
 #include "coordinator/handlers/wallet/include/WalletMessageRouter.hpp"
+#include "coordinator/handlers/wallet/include/WalletSigningHandler.hpp"
+#include "coordinator/handlers/wallet/include/WalletKeyHandler.hpp"
 #include "types/MessageTypes.hpp"
 #include "proto/wallet_coordinator/generated/wallet_message.pb.h"
 #include "proto/coordinator_node/generated/message.pb.h"
@@ -16,6 +19,13 @@
 #include <memory>
 #include <future>
 #include <cassert>
+#include <algorithm>
+#include <set>
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <boost/beast/ssl.hpp>
 
 using namespace mpc_engine;
 using namespace mpc_engine::coordinator;
@@ -182,6 +192,7 @@ public:
     }
 
     CoordinatorServer* GetCoordinator() { return coordinator_server.get(); }
+    NodeServer* GetNode(size_t index) { return index < node_servers.size() ? node_servers[index].get() : nullptr; }
     size_t GetNodeCount() const { return node_servers.size(); }
     bool IsSetup() const { return is_setup; }
 };
@@ -221,6 +232,29 @@ std::unique_ptr<WalletCoordinatorMessage> CreateWalletSigningRequest(
     return message;
 }
 
+// Wallet → Coordinator 키 생성 요청
+std::unique_ptr<WalletCoordinatorMessage> CreateWalletKeyRequest(
+    const std::string& request_id,
+    const std::string& tenant_id,
+    const std::string& wallet_id
+) {
+    auto message = std::make_unique<WalletCoordinatorMessage>();
+    message->set_message_type(static_cast<uint32_t>(mpc_engine::WalletMessageType::KEY_CREATE_REQUEST));
+    
+    WalletKeyCreateRequest* request = message->mutable_key_create_request();
+    
+    auto* header = request->mutable_header();
+    header->set_message_type(static_cast<uint32_t>(mpc_engine::WalletMessageType::KEY_CREATE_REQUEST));
+    header->set_request_id(request_id);
+    header->set_timestamp(std::to_string(GetCurrentTimeMs()));
+    header->set_coordinator_id("coordinator");
+    
+    request->set_tenant_id(tenant_id);
+    request->set_wallet_id(wallet_id);
+    
+    return message;
+}
+
 // Coordinator → Node 요청 생성
 std::unique_ptr<CoordinatorNodeMessage> CreateCoordinatorNodeSigningRequest(
     const std::string& uid,
@@ -247,6 +281,97 @@ std::unique_ptr<CoordinatorNodeMessage> CreateCoordinatorNodeSigningRequest(
     return message;
 }
 
+// Wallet 서버 역할 HTTPS 클라이언트 - keep-alive 연결 1개 (node1 인증서로 mTLS)
+class WalletHttpsClient
+{
+private:
+    boost::asio::io_context io;
+    boost::asio::ssl::context context{boost::asio::ssl::context::tlsv12_client};
+    std::unique_ptr<boost::beast::ssl_stream<boost::beast::tcp_stream>> stream;
+
+public:
+    bool Connect()
+    {
+        namespace ssl = boost::asio::ssl;
+        try {
+            std::string cert_path = Config::GetString("TLS_CERT_PATH");
+            context.load_verify_file(cert_path + Config::GetString("TLS_CERT_CA"));
+            context.set_verify_mode(ssl::verify_peer);
+            context.use_certificate_chain_file(cert_path + Config::GetStringArray("TLS_CERT_PATHS")[0]);
+            std::string key = KMSManager::Instance().GetSecret(Config::GetStringArray("TLS_KMS_NODES_COORDINATOR_KEY_IDS")[0]);
+            context.use_private_key(boost::asio::const_buffer(key.data(), key.size()), ssl::context::pem);
+
+            stream = std::make_unique<boost::beast::ssl_stream<boost::beast::tcp_stream>>(io, context);
+            boost::beast::get_lowest_layer(*stream).expires_after(std::chrono::seconds(5));
+            boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::make_address(Config::GetString("COORDINATOR_HTTPS_BIND")),
+                                                    Config::GetUInt16("COORDINATOR_HTTPS_PORT"));
+            boost::beast::get_lowest_layer(*stream).connect(endpoint);
+            stream->handshake(ssl::stream_base::client);
+            return true;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    // @return HTTP status (연결 실패 / 끊김 -1)
+    int Send(boost::beast::http::verb method, const std::string& target, const std::string& body,
+             std::string* response_body = nullptr,
+             const std::vector<std::pair<std::string, std::string>>& headers = {})
+    {
+        namespace http = boost::beast::http;
+        if (!stream) {
+            return -1;
+        }
+        try {
+            http::request<http::string_body> request(method, target, 11);
+            request.set(http::field::host, "coordinator");
+            request.set(http::field::content_type, "application/x-protobuf");
+            request.keep_alive(true);
+            for (const auto& header : headers) {
+                request.set(header.first, header.second);
+            }
+            request.body() = body;
+            request.prepare_payload();
+
+            boost::beast::get_lowest_layer(*stream).expires_after(std::chrono::seconds(10));
+            http::write(*stream, request);
+            boost::beast::flat_buffer buffer;
+            http::response<http::string_body> response;
+            http::read(*stream, buffer, response);
+            if (response_body) {
+                *response_body = response.body();
+            }
+            return static_cast<int>(response.result_int());
+        } catch (const std::exception&) {
+            return -1;
+        }
+    }
+};
+
+// 라운드 요청(단건/배치) 중 조건에 맞는 라운드가 있는지
+template <typename Predicate>
+bool HasRound(const mpc_engine::network::framing::NetworkMessage& message, Predicate matches)
+{
+    CoordinatorNodeMessage parsed;
+    if (!parsed.ParseFromArray(message.body.data(), static_cast<int>(message.body.size()))) {
+        return false;
+    }
+    if (parsed.has_mpc_round_request()) {
+        return matches(parsed.mpc_round_request());
+    }
+    if (parsed.has_mpc_round_batch_request()) {
+        const auto& rounds = parsed.mpc_round_batch_request().rounds();
+        return std::any_of(rounds.begin(), rounds.end(), matches);
+    }
+    return false;
+}
+
+// 라운드 요청에 session_id가 prefix로 시작하는 세션이 있는지
+bool HasSessionWithPrefix(const mpc_engine::network::framing::NetworkMessage& message, const std::string& prefix)
+{
+    return HasRound(message, [&prefix](const MpcRoundRequest& round) { return round.session_id().rfind(prefix, 0) == 0; });
+}
+
 // ===== Test Functions =====
 
 bool TestWalletToCoordinatorMessageRouting([[maybe_unused]] E2ETestEnvironment& env)
@@ -453,6 +578,483 @@ bool TestConcurrentE2ERequests([[maybe_unused]] E2ETestEnvironment& env)
     return true;
 }
 
+bool TestDuplicateWalletRequests(E2ETestEnvironment& env)
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  Test 5: Duplicate Wallet Requests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    if (!coordinator) {
+        std::cerr << "❌ Coordinator not available" << std::endl;
+        return false;
+    }
+
+    WalletRequestDedupStats before = GetWalletRequestDedupStats();
+
+    // 1. Wallet 재시도 시뮬레이션 - 같은 request_id 동시 8개 + 완료 후 재시도 1개
+    const int duplicates = 8;
+    auto send = []() -> std::string {
+        auto wallet_request = CreateWalletSigningRequest("dedup_e2e_001", "dedup_key", "0x" + std::string(64, 'e'));
+        auto response = WalletMessageRouter::Instance().ProcessMessage(wallet_request.get());
+        if (!response || !response->has_signing_response() || !response->signing_response().header().success()) {
+            return "";
+        }
+        return response->signing_response().final_signature();
+    };
+
+    std::vector<std::future<std::string>> futures;
+    for (int i = 0; i < duplicates; ++i) {
+        futures.push_back(std::async(std::launch::async, send));
+    }
+    std::vector<std::string> signatures;
+    for (auto& future : futures) {
+        signatures.push_back(future.get());
+    }
+    signatures.push_back(send());
+
+    bool same = !signatures[0].empty();
+    for (const std::string& signature : signatures) {
+        same = same && signature == signatures[0];
+    }
+
+    // 2. 같은 request_id로 다른 트랜잭션 → 거절
+    auto conflicting = CreateWalletSigningRequest("dedup_e2e_001", "dedup_key", "0x" + std::string(64, 'f'));
+    auto conflict_response = WalletMessageRouter::Instance().ProcessMessage(conflicting.get());
+    bool rejected = conflict_response && conflict_response->has_signing_response() &&
+                    !conflict_response->signing_response().header().success();
+
+    WalletRequestDedupStats after = GetWalletRequestDedupStats();
+    CoordinatorStats stats = coordinator->GetStats();
+    uint64_t executed = after.executed - before.executed;
+    uint64_t deduplicated = (after.joined - before.joined) + (after.cached - before.cached);
+
+    std::cout << "  Signing runs: " << executed << ", answered from dedup table: " << deduplicated
+              << " (joined " << after.joined - before.joined << ", cached " << after.cached - before.cached << ")" << std::endl;
+    std::cout << "  Dedup hit rate " << stats.wallet_dedup_hit_rate * 100.0 << "%, " << stats.wallet_dedup_entries
+              << " entries, " << stats.wallet_dedup_memory_bytes << " bytes" << std::endl;
+
+    if (!same || executed != 1 || deduplicated != static_cast<uint64_t>(duplicates) || !rejected ||
+        after.conflicts != before.conflicts + 1 || stats.wallet_dedup_memory_bytes == 0) {
+        std::cerr << "❌ Duplicate requests were not deduplicated" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ Retried requests share one signing run" << std::endl;
+    return true;
+}
+
+bool TestPregeneratedKeyPool(E2ETestEnvironment& env)
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  Test 6: Pre-generated Key Pool" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    if (!coordinator) {
+        std::cerr << "❌ Coordinator not available" << std::endl;
+        return false;
+    }
+
+    // pool이 target까지 찰 때까지 대기 (rate 제한 - 최대 5초)
+    auto wait_for_depth = [coordinator](size_t depth, std::chrono::milliseconds timeout) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (coordinator->GetKeyPoolStats().depth < depth && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return coordinator->GetKeyPoolStats().depth >= depth;
+    };
+
+    // 1. 작은 pool로 교체 - 보충 속도 제한 확인 (첫 배치 이후는 keys_per_second)
+    session::PregeneratedKeyPoolConfig config;
+    config.target_depth = 50;
+    config.low_watermark = 10;
+    config.batch_size = 10;
+    config.keys_per_second = 100;
+    config.threshold = 2;
+    auto fill_start = std::chrono::steady_clock::now();
+    coordinator->SetKeyPool(config);
+    if (!wait_for_depth(config.target_depth, std::chrono::seconds(5))) {
+        std::cerr << "❌ Pool did not fill: depth " << coordinator->GetKeyPoolStats().depth << std::endl;
+        return false;
+    }
+    double fill_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - fill_start).count();
+    session::PregeneratedKeyPoolStats filled = coordinator->GetKeyPoolStats();
+    std::cout << "  Filled " << filled.depth << " keys in " << fill_ms << "ms (" << filled.batches << " batches, limit "
+              << config.keys_per_second << " keys/s)" << std::endl;
+
+    // 2. 키 생성 요청 = pool 키 배정
+    const size_t wallets = 45;
+    std::vector<double> latencies_ms;
+    std::set<std::string> key_ids;
+    bool all_pregenerated = true;
+    for (size_t i = 0; i < wallets; ++i) {
+        auto request = CreateWalletKeyRequest("key_req_" + std::to_string(i), "tenant_a", "wallet_" + std::to_string(i));
+        auto start = std::chrono::steady_clock::now();
+        auto response = WalletMessageRouter::Instance().ProcessMessage(request.get());
+        latencies_ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        if (!response || !response->has_key_create_response() || !response->key_create_response().header().success()) {
+            std::cerr << "❌ Key creation failed for wallet_" << i << std::endl;
+            return false;
+        }
+        const WalletKeyCreateResponse& key = response->key_create_response();
+        all_pregenerated = all_pregenerated && key.pregenerated() && key.node_ids_size() == 3 && !key.public_key().empty();
+        key_ids.insert(key.key_id());
+    }
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    double pool_p50 = latencies_ms[latencies_ms.size() / 2];
+    double pool_max = latencies_ms.back();
+
+    // 3. 같은 지갑 재요청 → 같은 키
+    auto retry = WalletMessageRouter::Instance().ProcessMessage(CreateWalletKeyRequest("key_req_retry", "tenant_a", "wallet_0").get());
+    auto first = coordinator->CreateWalletKey("tenant_a", "wallet_0");
+    bool idempotent = retry && retry->key_create_response().header().success() &&
+                      retry->key_create_response().key_id() == first.key.key_id;
+
+    // 4. 다른 tenant의 같은 wallet_id는 별도 키
+    WalletKeyResult other_tenant = coordinator->CreateWalletKey("tenant_b", "wallet_0");
+    bool tenant_isolated = other_tenant.success && other_tenant.key.key_id != first.key.key_id;
+
+    // 5. 요청 시 keygen 비교 (pool과 다른 threshold → miss)
+    auto start = std::chrono::steady_clock::now();
+    WalletKeyResult on_demand = coordinator->CreateWalletKey("tenant_a", "wallet_3of3", 3);
+    double on_demand_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // 서명 후보 = keygen 참여 노드 (pool / 요청 시 keygen 모두 기록, 모르는 키만 engine set 라우팅)
+    bool placement_recorded = coordinator->GetSigningNodeIds(first.key.key_id) == first.key.node_ids &&
+                              coordinator->GetSigningNodeIds(on_demand.key.key_id) == on_demand.key.node_ids &&
+                              coordinator->GetSigningNodeIds("unknown_key") == coordinator->GetKeyNodeIds("unknown_key");
+
+    // 6. low watermark 이하 → target까지 보충
+    bool refilled = wait_for_depth(config.target_depth, std::chrono::seconds(5));
+    session::PregeneratedKeyPoolStats stats = coordinator->GetKeyPoolStats();
+    CoordinatorStats coordinator_stats = coordinator->GetStats();
+
+    std::cout << "[PERF] pool assignment: p50 " << pool_p50 << "ms, max " << pool_max << "ms (" << wallets << " wallets)" << std::endl;
+    std::cout << "[PERF] on-demand keygen: " << on_demand_ms << "ms" << std::endl;
+    std::cout << "  Pool: depth " << stats.depth << ", assigned " << stats.assigned << ", generated " << stats.generated
+              << ", batches " << stats.batches << ", hit rate " << coordinator_stats.key_pool_hit_rate * 100.0 << "%" << std::endl;
+
+    // 키 생성 속도 제한: 첫 배치(10) 이후 40개는 100 keys/s → 최소 ~400ms
+    bool throttled = fill_ms >= 300.0;
+    bool passed = all_pregenerated && key_ids.size() == wallets && idempotent && tenant_isolated &&
+                  on_demand.success && !on_demand.pregenerated && placement_recorded && refilled && throttled &&
+                  stats.assigned == wallets + 2 && stats.batches > filled.batches;
+
+    // 환경 기본 pool로 복원
+    session::PregeneratedKeyPoolConfig restored;
+    restored.target_depth = Config::GetUInt32("COORDINATOR_KEY_POOL_TARGET_DEPTH");
+    restored.low_watermark = Config::GetUInt32("COORDINATOR_KEY_POOL_LOW_WATERMARK");
+    restored.batch_size = Config::GetUInt32("COORDINATOR_KEY_POOL_BATCH");
+    restored.keys_per_second = Config::GetUInt32("COORDINATOR_KEY_POOL_KEYS_PER_SEC");
+    restored.max_active_sessions = Config::GetUInt32("COORDINATOR_KEY_POOL_MAX_ACTIVE_SESSIONS");
+    coordinator->SetKeyPool(restored);
+
+    if (!passed) {
+        std::cerr << "❌ Key pool check failed (pregenerated " << all_pregenerated << ", unique " << key_ids.size()
+                  << ", idempotent " << idempotent << ", tenants " << tenant_isolated << ", on-demand " << on_demand.success
+                  << ", placement " << placement_recorded
+                  << ", refilled " << refilled << ", throttled " << throttled << ")" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ Wallet keys assigned from the pre-generated pool" << std::endl;
+    return true;
+}
+
+bool TestDeadlinePropagation(E2ETestEnvironment& env)
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  Test 7: Deadline Propagation" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    if (!coordinator || env.GetNodeCount() < 3) {
+        std::cerr << "❌ Environment not available" << std::endl;
+        return false;
+    }
+    for (size_t i = 0; i < env.GetNodeCount(); ++i) {
+        if (!env.GetNode(i)->GetTcpServer()) {
+            std::cerr << "❌ Node " << i << " not available" << std::endl;
+            return false;
+        }
+    }
+    if (!coordinator->IsHttpsServerRunning() && (!coordinator->InitializeHttpsServer() || !coordinator->StartHttpsServer())) {
+        std::cerr << "❌ HTTPS server failed to start" << std::endl;
+        return false;
+    }
+
+    namespace http = boost::beast::http;
+    using Clock = std::chrono::steady_clock;
+    auto elapsed_ms = [](Clock::time_point since) {
+        return static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - since).count());
+    };
+    auto restore_handlers = [&env]() {
+        for (size_t i = 0; i < env.GetNodeCount(); ++i) {
+            env.GetNode(i)->GetTcpServer()->SetMessageHandler([](const mpc_engine::network::framing::NetworkMessage& message) {
+                return node::handlers::NodeMessageRouter::Instance().Process(message);
+            });
+        }
+    };
+
+    // 1. 모든 노드가 deadline_key 라운드 메시지마다 150ms 지연 - 기한이 없으면 라운드 타임아웃(10s) 안에 느리게 성공
+    //    (키 pool 보충 등 다른 세션은 그대로 - 다음 테스트까지 늘어지지 않도록)
+    for (size_t i = 0; i < env.GetNodeCount(); ++i) {
+        env.GetNode(i)->GetTcpServer()->SetMessageHandler([](const mpc_engine::network::framing::NetworkMessage& message) {
+            if (HasRound(message, [](const MpcRoundRequest& round) { return round.key_id() == "deadline_key"; })) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(150));
+            }
+            return node::handlers::NodeMessageRouter::Instance().Process(message);
+        });
+    }
+
+    WalletHttpsClient client;
+    if (!client.Connect()) {
+        restore_handlers();
+        std::cerr << "❌ Wallet HTTPS connection failed" << std::endl;
+        return false;
+    }
+
+    struct WalletOutcome
+    {
+        int status = -1;
+        bool success = false;
+        std::string error;
+        long long elapsed_ms = 0;
+    };
+    auto sign = [&](const std::string& request_id, uint32_t proto_timeout_ms,
+                    const std::vector<std::pair<std::string, std::string>>& headers) {
+        auto request = CreateWalletSigningRequest(request_id, "deadline_key", "0x" + std::string(64, 'a'));
+        request->mutable_signing_request()->mutable_header()->set_timeout_ms(proto_timeout_ms);
+        std::string body;
+        request->SerializeToString(&body);
+
+        WalletOutcome outcome;
+        std::string response_body;
+        auto start = Clock::now();
+        outcome.status = client.Send(http::verb::post, "/", body, &response_body, headers);
+        outcome.elapsed_ms = elapsed_ms(start);
+        WalletCoordinatorMessage response;
+        if (response.ParseFromString(response_body) && response.has_signing_response()) {
+            outcome.success = response.signing_response().header().success();
+            outcome.error = response.signing_response().header().error_message();
+        }
+        return outcome;
+    };
+
+    WalletOutcome unbounded = sign("deadline_req_none", 0, {});
+    WalletOutcome http_budget = sign("deadline_req_http", 0, { { "X-Request-Timeout-Ms", "100" } });
+    WalletOutcome proto_budget = sign("deadline_req_proto", 100, {});
+
+    std::cout << "  No budget: HTTP " << unbounded.status << ", " << (unbounded.success ? "signed" : "failed")
+              << " in " << unbounded.elapsed_ms << "ms" << std::endl;
+    std::cout << "  X-Request-Timeout-Ms 100: HTTP " << http_budget.status << ", failed in " << http_budget.elapsed_ms
+              << "ms (" << http_budget.error << ")" << std::endl;
+    std::cout << "  header.timeout_ms 100: HTTP " << proto_budget.status << ", failed in " << proto_budget.elapsed_ms
+              << "ms (" << proto_budget.error << ")" << std::endl;
+
+    // 2. node1 handler lane을 300ms 붙잡은 뒤 같은 lane에 100ms 기한 요청 3개
+    //    - coordinator는 100ms 만에 포기하고, 노드는 기한이 지난 요청을 handler에 넘기지 않음
+    static std::atomic<int> lane_invocations{0};
+    lane_invocations = 0;
+    env.GetNode(0)->GetTcpServer()->SetMessageHandler([](const mpc_engine::network::framing::NetworkMessage& message) {
+        CoordinatorNodeMessage parsed;
+        if (message.header.message_type == static_cast<uint16_t>(mpc_engine::MessageType::SIGNING_REQUEST) &&
+            parsed.ParseFromArray(message.body.data(), static_cast<int>(message.body.size())) &&
+            parsed.signing_request().key_id() == "deadline_lane") {
+            lane_invocations++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        }
+        return node::handlers::NodeMessageRouter::Instance().Process(message);
+    });
+
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+    const std::string node_id = node_ids[0];
+    auto blocker = std::async(std::launch::async, [coordinator, &node_id]() {
+        auto request = CreateCoordinatorNodeSigningRequest("deadline_lane_0", "deadline_lane", "0xlane");
+        return coordinator->SendToNode(node_id, request.get()) != nullptr;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    const int bounded = 3;
+    std::vector<std::future<std::pair<long long, std::string>>> expiring;
+    for (int i = 0; i < bounded; ++i) {
+        expiring.push_back(std::async(std::launch::async, [coordinator, &node_id, &elapsed_ms, i]() {
+            auto request = CreateCoordinatorNodeSigningRequest("deadline_lane_" + std::to_string(i + 1), "deadline_lane", "0xlane");
+            auto start = Clock::now();
+            auto response = coordinator->SendToNode(node_id, request.get(), start + std::chrono::milliseconds(100));
+            std::string outcome = !response ? std::string("no response")
+                                : response->has_error_response() ? NodeErrorCode_Name(response->error_response().code())
+                                : "answered";
+            return std::make_pair(elapsed_ms(start), outcome);
+        }));
+    }
+
+    long long slowest_bounded = 0;
+    bool bounded_gave_up = true;
+    for (auto& future : expiring) {
+        auto result = future.get();
+        slowest_bounded = std::max(slowest_bounded, result.first);
+        bounded_gave_up = bounded_gave_up && result.second != "answered";
+    }
+    bool blocker_answered = blocker.get();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));   // 노드가 큐에 남은 요청을 꺼내 버릴 시간
+
+    std::cout << "  Lane requests with 100ms budget gave up after at most " << slowest_bounded << "ms, handler ran "
+              << lane_invocations.load() << " of " << bounded + 1 << " requests" << std::endl;
+
+    restore_handlers();
+
+    bool passed = unbounded.status == 200 && unbounded.success &&
+                  http_budget.status == 200 && !http_budget.success && http_budget.elapsed_ms < 500 &&
+                  http_budget.error.find("Deadline exceeded") != std::string::npos &&
+                  proto_budget.status == 200 && !proto_budget.success && proto_budget.elapsed_ms < 500 &&
+                  proto_budget.error.find("Deadline exceeded") != std::string::npos &&
+                  blocker_answered && bounded_gave_up && slowest_bounded < 250 && lane_invocations.load() == 1;
+    if (!passed) {
+        std::cerr << "❌ Deadline was not enforced end to end" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ Expired requests failed fast and never reached the node handler" << std::endl;
+    return true;
+}
+
+bool TestCoordinatorDrain(E2ETestEnvironment& env)
+{
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  Test 8: Coordinator Drain" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    auto* coordinator = env.GetCoordinator();
+    auto* node1 = env.GetNode(0);
+    auto* node3 = env.GetNode(2);
+    if (!coordinator || !node1 || !node3 || !node1->GetTcpServer() || !node3->GetTcpServer()) {
+        std::cerr << "❌ Environment not available" << std::endl;
+        return false;
+    }
+    if (!coordinator->IsHttpsServerRunning() && (!coordinator->InitializeHttpsServer() || !coordinator->StartHttpsServer())) {
+        std::cerr << "❌ HTTPS server failed to start" << std::endl;
+        return false;
+    }
+
+    namespace http = boost::beast::http;
+    std::vector<std::string> node_ids = Config::GetStringArray("NODE_IDS");
+
+    // 1. drain 전 연결 2개 - 하나는 health check, 하나는 Wallet 요청용
+    WalletHttpsClient health_client;
+    WalletHttpsClient wallet_client;
+    if (!health_client.Connect() || !wallet_client.Connect()) {
+        std::cerr << "❌ Wallet HTTPS connection failed" << std::endl;
+        return false;
+    }
+    int health_before = health_client.Send(http::verb::get, "/health", std::string());
+
+    // 2. node1은 drain_slow 세션 메시지마다 150ms 지연 (deadline 안에 끝남),
+    //    node3은 drain_stuck 세션 메시지를 release까지 붙잡음 (deadline 후 abort 대상)
+    static std::atomic<bool> release{false};
+    release = false;
+    node1->GetTcpServer()->SetMessageHandler([](const mpc_engine::network::framing::NetworkMessage& message) {
+        if (HasSessionWithPrefix(message, "drain_slow")) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(150));
+        }
+        return node::handlers::NodeMessageRouter::Instance().Process(message);
+    });
+    node3->GetTcpServer()->SetMessageHandler([](const mpc_engine::network::framing::NetworkMessage& message) {
+        if (HasSessionWithPrefix(message, "drain_stuck")) {
+            auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!release.load() && std::chrono::steady_clock::now() < limit) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        }
+        return node::handlers::NodeMessageRouter::Instance().Process(message);
+    });
+
+    auto start_session = [&](const std::string& session_id, const std::vector<std::string>& participants) {
+        auto promise = std::make_shared<std::promise<session::MpcSessionResult>>();
+        std::future<session::MpcSessionResult> future = promise->get_future();
+        session::MpcSessionSpec spec;
+        spec.session_id = session_id;
+        spec.protocol = MPC_PROTOCOL_ECDSA_SIGNING;
+        spec.key_id = "drain_key";
+        spec.node_ids = participants;
+        spec.threshold = 2;
+        spec.session_input = "0x" + std::string(64, 'd');
+        coordinator->StartMpcSession(spec, [promise](const session::MpcSessionResult& result) {
+            promise->set_value(result);
+        });
+        return future;
+    };
+
+    std::vector<std::future<session::MpcSessionResult>> slow;
+    std::vector<std::future<session::MpcSessionResult>> stuck;
+    for (int i = 0; i < 3; ++i) {
+        slow.push_back(start_session("drain_slow_" + std::to_string(i), { node_ids[0], node_ids[1] }));
+    }
+    for (int i = 0; i < 2; ++i) {
+        stuck.push_back(start_session("drain_stuck_" + std::to_string(i), { node_ids[1], node_ids[2] }));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // 3. drain 시작 (SIGTERM 경로와 같은 호출)
+    const std::chrono::milliseconds drain_timeout(1500);
+    auto drain = std::async(std::launch::async, [coordinator, drain_timeout]() {
+        return coordinator->Drain(drain_timeout);
+    });
+    while (!coordinator->IsDraining()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // drain 중: health 503, 기존 연결의 새 요청 503, 새 연결 거부, 새 세션 ABORTED
+    int health_during = health_client.Send(http::verb::get, "/health", std::string());
+    std::string request_body;
+    CreateWalletSigningRequest("drain_req", "drain_key", "0xdrain")->SerializeToString(&request_body);
+    int wallet_during = wallet_client.Send(http::verb::post, "/", request_body);
+    WalletHttpsClient late_client;
+    bool late_connected = late_client.Connect() && late_client.Send(http::verb::get, "/health", std::string()) == 200;
+    session::MpcSessionResult refused = start_session("drain_refused", { node_ids[0], node_ids[1] }).get();
+
+    CoordinatorDrainReport report = drain.get();
+    release = true;
+
+    size_t slow_completed = 0;
+    size_t stuck_aborted = 0;
+    for (auto& future : slow) {
+        slow_completed += future.get().status == session::MpcSessionStatus::COMPLETED ? 1 : 0;
+    }
+    for (auto& future : stuck) {
+        stuck_aborted += future.get().status == session::MpcSessionStatus::ABORTED ? 1 : 0;
+    }
+
+    std::cout << "  Health: " << health_before << " → " << health_during << ", wallet request during drain: " << wallet_during
+              << ", new connection " << (late_connected ? "accepted" : "refused") << std::endl;
+    std::cout << "  Drain: " << report.elapsed_ms << "ms, " << report.sessions.in_flight << " in flight, "
+              << report.sessions.completed << " completed, " << report.sessions.failed << " failed, "
+              << report.sessions.aborted << " aborted, " << report.sessions.lost << " lost, "
+              << report.unanswered_requests << " unanswered" << std::endl;
+
+    // presign pool 세션이 함께 진행 중이었을 수 있으므로 하한으로 확인
+    bool passed = health_before == 200 && health_during == 503 && wallet_during == 503 && !late_connected &&
+                  refused.status == session::MpcSessionStatus::ABORTED &&
+                  slow_completed == slow.size() && stuck_aborted == stuck.size() &&
+                  report.sessions.in_flight >= slow.size() + stuck.size() &&
+                  report.sessions.completed >= slow.size() && report.sessions.aborted >= stuck.size() &&
+                  report.sessions.lost == 0 && report.unanswered_requests == 0 &&
+                  report.sessions.completed + report.sessions.failed + report.sessions.aborted + report.sessions.lost == report.sessions.in_flight &&
+                  report.elapsed_ms >= static_cast<uint64_t>(drain_timeout.count()) &&
+                  report.elapsed_ms < static_cast<uint64_t>(drain_timeout.count()) + 1000;
+    if (!passed) {
+        std::cerr << "❌ Drain check failed (slow completed " << slow_completed << "/" << slow.size() << ", stuck aborted "
+                  << stuck_aborted << "/" << stuck.size() << ", refused " << session::MpcSessionStatusToString(refused.status)
+                  << ")" << std::endl;
+        return false;
+    }
+
+    std::cout << "✓ In-flight sessions finished or were aborted on the nodes while new work was refused" << std::endl;
+    return true;
+}
+
 // ===== Main =====
 
 int main() 
@@ -497,6 +1099,30 @@ int main()
             all_passed = false;
         }
 
+        // Test 5: 중복 요청 제거
+        if (!TestDuplicateWalletRequests(env)) {
+            std::cerr << "\n❌ Test 5 failed" << std::endl;
+            all_passed = false;
+        }
+
+        // Test 6: 미리 생성된 키 pool
+        if (!TestPregeneratedKeyPool(env)) {
+            std::cerr << "\n❌ Test 6 failed" << std::endl;
+            all_passed = false;
+        }
+
+        // Test 7: 요청 기한 전달
+        if (!TestDeadlinePropagation(env)) {
+            std::cerr << "\n❌ Test 7 failed" << std::endl;
+            all_passed = false;
+        }
+
+        // Test 8: 종료 전 drain (마지막 - 이후 coordinator는 새 요청을 받지 않음)
+        if (!TestCoordinatorDrain(env)) {
+            std::cerr << "\n❌ Test 8 failed" << std::endl;
+            all_passed = false;
+        }
+
     } catch (const std::exception& e) {
         std::cerr << "\n❌ Test exception: " << e.what() << std::endl;
         all_passed = false;
@@ -515,6 +1141,10 @@ int main()
         std::cout << "  - Coordinator → Node communication: ✓" << std::endl;
         std::cout << "  - Full E2E flow: ✓" << std::endl;
         std::cout << "  - Concurrent requests: ✓" << std::endl;
+        std::cout << "  - Duplicate request dedup: ✓" << std::endl;
+        std::cout << "  - Pre-generated key pool: ✓" << std::endl;
+        std::cout << "  - Deadline propagation: ✓" << std::endl;
+        std::cout << "  - Coordinator drain: ✓" << std::endl;
         std::cout << "\n✅ System ready for production!" << std::endl;
         return 0;
     } else {
@@ -0,0 +1,197 @@
+// tests/unit/engine_set_router_test.cpp
+#include "coordinator/network/node_client/include/EngineSetRouter.hpp"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <vector>
+#include <stdexcept>
+#include <string>
+
+using namespace mpc_engine::coordinator::network;
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void expect(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+constexpr size_t KEY_COUNT = 100000;
+
+std::string key_id(size_t i) {
+    return "wallet-key-" + std::to_string(i);
+}
+
+std::vector<std::string> route_all(const ConsistentHashRing& ring) {
+    std::vector<std::string> placement;
+    placement.reserve(KEY_COUNT);
+    for (size_t i = 0; i < KEY_COUNT; ++i) {
+        placement.push_back(ring.Route(key_id(i)));
+    }
+    return placement;
+}
+
+int main() {
+    std::cout << "=== EngineSetRouter Tests ===" << std::endl;
+
+    // Test 1: set이 없으면 빈 문자열
+    run_test("Empty Ring", []() {
+        ConsistentHashRing ring;
+        expect(ring.Route("k").empty(), "empty ring routed a key");
+        EngineSetRouter router;
+        expect(router.Route("k").empty(), "empty router routed a key");
+    });
+
+    // Test 2: 같은 key는 항상 같은 set, set 추가 순서와 무관
+    run_test("Deterministic Placement", []() {
+        ConsistentHashRing a;
+        ConsistentHashRing b;
+        for (const char* set_id : { "set-a", "set-b", "set-c" }) {
+            a.AddSet(set_id);
+        }
+        for (const char* set_id : { "set-c", "set-a", "set-b" }) {
+            b.AddSet(set_id);
+        }
+        for (size_t i = 0; i < 1000; ++i) {
+            expect(a.Route(key_id(i)) == a.Route(key_id(i)), "placement changed between calls");
+            expect(a.Route(key_id(i)) == b.Route(key_id(i)), "placement depends on insertion order");
+        }
+    });
+
+    // Test 3: set 간 key 분포 (평균 ±15%)
+    run_test("Balanced Distribution", []() {
+        ConsistentHashRing ring;
+        for (int i = 0; i < 4; ++i) {
+            ring.AddSet("set-" + std::to_string(i));
+        }
+        std::map<std::string, size_t> counts;
+        for (const std::string& set_id : route_all(ring)) {
+            counts[set_id]++;
+        }
+        expect(counts.size() == 4, "not every set received keys");
+        double mean = static_cast<double>(KEY_COUNT) / 4;
+        for (const auto& entry : counts) {
+            double skew = std::abs(static_cast<double>(entry.second) - mean) / mean;
+            std::cout << "  " << entry.first << ": " << entry.second << " keys (" << skew * 100 << "% off)" << std::endl;
+            expect(skew <= 0.15, entry.first + " holds " + std::to_string(entry.second) + " keys");
+        }
+    });
+
+    // Test 4: set 추가 시 새 set으로 가는 key만 이동 (약 1/(n+1))
+    run_test("Minimal Movement On Add", []() {
+        ConsistentHashRing ring;
+        for (int i = 0; i < 4; ++i) {
+            ring.AddSet("set-" + std::to_string(i));
+        }
+        std::vector<std::string> before = route_all(ring);
+        ring.AddSet("set-4");
+        std::vector<std::string> after = route_all(ring);
+
+        size_t moved = 0;
+        for (size_t i = 0; i < KEY_COUNT; ++i) {
+            if (before[i] != after[i]) {
+                expect(after[i] == "set-4", "key moved between existing sets");
+                moved++;
+            }
+        }
+        double fraction = static_cast<double>(moved) / KEY_COUNT;
+        std::cout << "  moved " << fraction * 100 << "% of keys (ideal 20%)" << std::endl;
+        expect(fraction > 0.15 && fraction < 0.25, "moved fraction " + std::to_string(fraction));
+    });
+
+    // Test 5: set 제거 시 제거된 set의 key만 이동
+    run_test("Minimal Movement On Remove", []() {
+        ConsistentHashRing ring;
+        for (int i = 0; i < 5; ++i) {
+            ring.AddSet("set-" + std::to_string(i));
+        }
+        std::vector<std::string> before = route_all(ring);
+        expect(ring.RemoveSet("set-2"), "remove failed");
+        expect(!ring.RemoveSet("set-2"), "removed twice");
+        std::vector<std::string> after = route_all(ring);
+
+        for (size_t i = 0; i < KEY_COUNT; ++i) {
+            if (before[i] == "set-2") {
+                expect(after[i] != "set-2", "key still routed to removed set");
+            } else {
+                expect(before[i] == after[i], "unaffected key moved");
+            }
+        }
+    });
+
+    // Test 6: 노드 소속 / set 자동 생성 / 제거
+    run_test("Router Membership", []() {
+        EngineSetRouter router;
+        expect(router.AddNode("set-a", "node1"), "add node1");
+        expect(router.AddNode("set-a", "node2"), "add node2");
+        expect(router.AddNode("set-a", "node2"), "re-adding to the same set should succeed");
+        expect(!router.AddNode("set-b", "node2"), "node joined a second set");
+        expect(router.AddSet("set-b", { "node3", "node4" }), "add set-b");
+        expect(!router.AddSet("set-c", { "node5", "node1" }), "set-c took a node from set-a");
+        expect(router.GetSetCount() == 2, "set count " + std::to_string(router.GetSetCount()));
+        expect(router.GetNodeSet("node3") == "set-b", "node3 set");
+
+        router.RemoveNode("node3");
+        router.RemoveNode("node4");
+        expect(router.GetSetCount() == 1, "empty set was not removed");
+        for (size_t i = 0; i < 100; ++i) {
+            expect(router.Route(key_id(i)) == "set-a", "key routed to a removed set");
+        }
+        expect(router.GetSetNodes("set-a").size() == 2, "set-a nodes");
+    });
+
+    // Test 7: set별 부하 집계 (Finish 없이 소멸하면 실패)
+    run_test("Load Accounting", []() {
+        EngineSetRouter router;
+        router.AddSet("set-a", { "node1" });
+        {
+            EngineSetRouter::Request ok = router.Begin("set-a");
+            EngineSetRouter::Request dropped = router.Begin("set-a");
+            expect(router.GetStats().front().in_flight == 2, "in_flight while running");
+            ok.Finish(true);
+            ok.Finish(false);   // 두 번째 Finish는 무시
+        }
+        EngineSetRouter::Request unknown = router.Begin("missing");
+        unknown.Finish(false);
+
+        EngineSetStats stats = router.GetStats().front();
+        expect(stats.in_flight == 0, "in_flight " + std::to_string(stats.in_flight));
+        expect(stats.requests == 2, "requests " + std::to_string(stats.requests));
+        expect(stats.failures == 1, "failures " + std::to_string(stats.failures));
+    });
+
+    // ===== 성능 측정 =====
+    std::cout << "\n=== Performance ===" << std::endl;
+    {
+        EngineSetRouter router;
+        for (int i = 0; i < 8; ++i) {
+            router.AddSet("set-" + std::to_string(i), { "node" + std::to_string(i) });
+        }
+        std::vector<std::string> keys;
+        for (size_t i = 0; i < 1024; ++i) {
+            keys.push_back(key_id(i));
+        }
+
+        const int iterations = 500000;
+        size_t sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            sink += router.Route(keys[static_cast<size_t>(i) & 1023]).size();
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[PERF] Route (8 sets x 160 vnodes): " << elapsed / iterations << " ns/op (" << (sink > 0 ? "ok" : "empty") << ")" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+// tests/unit/key_placement_store_test.cpp
+#include "coordinator/session/include/KeyPlacementStore.hpp"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+using namespace mpc_engine::coordinator::session;
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void expect(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+std::string journal_path(const std::string& name) {
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("key_placement_" + std::to_string(::getpid()) + "_" + name + ".journal")).string();
+    std::filesystem::remove(path);
+    return path;
+}
+
+KeyPlacement make_placement(const std::string& key_id, const std::string& set_id, std::vector<std::string> node_ids) {
+    KeyPlacement placement;
+    placement.key_id = key_id;
+    placement.set_id = set_id;
+    placement.node_ids = std::move(node_ids);
+    placement.threshold = 2;
+    return placement;
+}
+
+int main() {
+    std::cout << "=== KeyPlacementStore Tests ===" << std::endl;
+
+    // Test 1: 재시작 후에도 기록된 배치 그대로
+    run_test("Survives Reopen", []() {
+        std::string path = journal_path("reopen");
+        {
+            KeyPlacementStore store;
+            expect(store.Open(path) && store.IsDurable(), "open failed");
+            expect(store.Record(make_placement("wallet-key-1", "set-a", { "node1", "node2", "node3" })), "record failed");
+            expect(store.Record(make_placement("wallet-key-2", "", { "node4", "node5" })), "record without set failed");
+        }
+
+        KeyPlacementStore reopened;
+        expect(reopened.Open(path), "reopen failed");
+        expect(reopened.Size() == 2, "placements lost: " + std::to_string(reopened.Size()));
+        std::optional<KeyPlacement> first = reopened.Find("wallet-key-1");
+        expect(first && first->set_id == "set-a" && first->threshold == 2 &&
+               first->node_ids == std::vector<std::string>({ "node1", "node2", "node3" }), "placement changed");
+        std::optional<KeyPlacement> second = reopened.Find("wallet-key-2");
+        expect(second && second->set_id.empty() && second->node_ids.size() == 2, "empty set id not preserved");
+        expect(!reopened.Find("wallet-key-3"), "unknown key found");
+        std::filesystem::remove(path);
+    });
+
+    // Test 2: 배치는 바뀌지 않음 - 같은 내용은 무시, 다른 노드는 거부
+    run_test("Placement Is Immutable", []() {
+        std::string path = journal_path("immutable");
+        KeyPlacementStore store;
+        expect(store.Open(path), "open failed");
+        expect(store.Record(make_placement("wallet-key-1", "set-a", { "node1", "node2" })), "record failed");
+        expect(store.Record(make_placement("wallet-key-1", "set-a", { "node1", "node2" })), "identical record rejected");
+        expect(!store.Record(make_placement("wallet-key-1", "set-b", { "node3", "node4" })), "conflicting record accepted");
+        expect(store.Find("wallet-key-1")->node_ids.front() == "node1", "placement overwritten");
+
+        KeyPlacementStore reopened;
+        expect(reopened.Open(path) && reopened.Size() == 1, "duplicate records written");
+        std::filesystem::remove(path);
+    });
+
+    // Test 3: 기록 중 중단된 마지막 줄은 버리고 이어 쓰기
+    run_test("Incomplete Tail", []() {
+        std::string path = journal_path("tail");
+        {
+            KeyPlacementStore store;
+            expect(store.Open(path), "open failed");
+            expect(store.Record(make_placement("wallet-key-1", "set-a", { "node1", "node2" })), "record failed");
+        }
+        {
+            std::ofstream file(path, std::ios::app);
+            file << "wallet-key-2\tset-a\t2\tno";
+        }
+
+        KeyPlacementStore store;
+        expect(store.Open(path) && store.Size() == 1, "incomplete record loaded");
+        expect(store.Record(make_placement("wallet-key-3", "set-a", { "node1", "node2" })), "record after truncate failed");
+
+        KeyPlacementStore reopened;
+        expect(reopened.Open(path) && reopened.Size() == 2 && reopened.Find("wallet-key-3"), "record after tail corrupted");
+        std::filesystem::remove(path);
+    });
+
+    // Test 4: journal 구분자가 들어간 id는 기록하지 않음
+    run_test("Invalid Ids", []() {
+        KeyPlacementStore store;
+        expect(!store.IsDurable(), "memory store reported durable");
+        expect(!store.Record(make_placement("", "set-a", { "node1" })), "empty key accepted");
+        expect(!store.Record(make_placement("key\t1", "set-a", { "node1" })), "tab in key accepted");
+        expect(!store.Record(make_placement("key-1", "set-a", { "node,1" })), "comma in node accepted");
+        expect(store.Record(make_placement("key-1", "set-a", { "node1" })) && store.Size() == 1, "memory record failed");
+    });
+
+    // Test 5: 열 수 없는 경로
+    run_test("Open Failure", []() {
+        KeyPlacementStore store;
+        expect(!store.Open("/nonexistent-dir/key-placements.journal"), "open of missing directory succeeded");
+        expect(!store.IsDurable(), "store durable after failed open");
+    });
+
+    return 0;
+}
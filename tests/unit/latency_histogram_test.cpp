@@ -0,0 +1,159 @@
+// tests/unit/latency_histogram_test.cpp
+#include "common/utils/metrics/LatencyHistogram.hpp"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <string>
+
+using namespace mpc_engine::utils;
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void expect(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+// 상대 오차 1/SUB_BUCKET_HALF 이내
+void expect_close(uint64_t actual, uint64_t expected, const char* label) {
+    double tolerance = static_cast<double>(expected) / LatencyHistogram::SUB_BUCKET_HALF + 1.0;
+    double diff = static_cast<double>(actual > expected ? actual - expected : expected - actual);
+    if (diff > tolerance) {
+        throw std::runtime_error(std::string(label) + ": expected ~" + std::to_string(expected) +
+                                 ", got " + std::to_string(actual));
+    }
+}
+
+int main() {
+    std::cout << "=== LatencyHistogram Tests ===" << std::endl;
+
+    // Test 1: 버킷 경계 - 인덱스가 단조 증가하고 값이 버킷 범위 안에 있어야 함
+    run_test("Bucket Boundaries", []() {
+        size_t previous = 0;
+        for (uint64_t value = 0; value < (1ULL << 20); value += 7) {
+            size_t index = LatencyHistogram::BucketIndex(value);
+            expect(index >= previous, "bucket index not monotonic at " + std::to_string(value));
+            expect(LatencyHistogram::LowestEquivalent(index) <= value &&
+                   value <= LatencyHistogram::HighestEquivalent(index),
+                   "value outside its bucket: " + std::to_string(value));
+            previous = index;
+        }
+
+        size_t last = LatencyHistogram::BucketIndex(LatencyHistogram::MAX_TRACKABLE_NS);
+        expect(last == LatencyHistogram::BUCKET_COUNT - 1, "max value must map to last bucket");
+    });
+
+    // Test 2: 빈 히스토그램
+    run_test("Empty Snapshot", []() {
+        LatencyHistogram histogram;
+        LatencySnapshot snapshot = histogram.Snapshot();
+        expect(snapshot.count == 0 && snapshot.max_ns == 0 && snapshot.p99_ns == 0, "empty snapshot not zero");
+    });
+
+    // Test 3: 균등 분포 1us ~ 100ms 분위수 정확도
+    run_test("Percentile Accuracy", []() {
+        LatencyHistogram histogram;
+        const uint64_t samples = 100000;
+        for (uint64_t i = 1; i <= samples; ++i) {
+            histogram.Record(i * 1000);
+        }
+
+        LatencySnapshot snapshot = histogram.Snapshot();
+        expect(snapshot.count == samples, "count mismatch");
+        expect(snapshot.max_ns == samples * 1000, "max mismatch");
+        expect_close(snapshot.min_ns, 1000, "min");
+        expect_close(snapshot.mean_ns, (samples + 1) * 500, "mean");
+        expect_close(snapshot.p50_ns, 50000 * 1000, "p50");
+        expect_close(snapshot.p90_ns, 90000 * 1000, "p90");
+        expect_close(snapshot.p99_ns, 99000 * 1000, "p99");
+        expect_close(snapshot.p999_ns, 99900 * 1000, "p99.9");
+    });
+
+    // Test 4: 꼬리 지연 - 1% 이상치가 p99.9에만 드러나야 함
+    run_test("Tail Latency", []() {
+        LatencyHistogram histogram;
+        for (int i = 0; i < 9980; ++i) histogram.Record(2'000'000);      // 2ms
+        for (int i = 0; i < 20; ++i) histogram.Record(400'000'000);      // 400ms
+
+        LatencySnapshot snapshot = histogram.Snapshot();
+        expect_close(snapshot.p99_ns, 2'000'000, "p99");
+        expect_close(snapshot.p999_ns, 400'000'000, "p99.9");
+        expect(snapshot.max_ns == 400'000'000, "max mismatch");
+    });
+
+    // Test 5: 범위 초과 값은 최대값으로 고정
+    run_test("Overflow Clamped", []() {
+        LatencyHistogram histogram;
+        histogram.Record(UINT64_MAX);
+        LatencySnapshot snapshot = histogram.Snapshot();
+        expect(snapshot.count == 1, "count mismatch");
+        expect(snapshot.max_ns == LatencyHistogram::MAX_TRACKABLE_NS, "overflow not clamped");
+    });
+
+    // Test 6: 동시 기록 - 잠금 없이 샘플 누락 없음
+    run_test("Concurrent Record", []() {
+        LatencyHistogram histogram;
+        const int threads = 4;
+        const int per_thread = 200000;
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&histogram, t]() {
+                for (int i = 0; i < per_thread; ++i) {
+                    histogram.Record(static_cast<uint64_t>((i % 1000 + 1) * 1000 + t));
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        LatencySnapshot snapshot = histogram.Snapshot();
+        expect(snapshot.count == static_cast<uint64_t>(threads) * per_thread,
+               "lost samples: " + std::to_string(snapshot.count));
+        expect(snapshot.max_ns == 1000 * 1000 + threads - 1, "max mismatch");
+    });
+
+    // ===== 성능 측정 =====
+    std::cout << "\n=== Performance ===" << std::endl;
+    {
+        LatencyHistogram histogram;
+        const int iterations = 5'000'000;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            histogram.Record(static_cast<uint64_t>(i & 0xFFFFF));
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[PERF] Record: " << elapsed / iterations << " ns/op" << std::endl;
+
+        start = std::chrono::steady_clock::now();
+        uint64_t start_ns = MonotonicNowNs();
+        for (int i = 0; i < iterations; ++i) {
+            histogram.RecordSince(start_ns);
+        }
+        elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[PERF] RecordSince (clock read + record): " << elapsed / iterations << " ns/op" << std::endl;
+
+        start = std::chrono::steady_clock::now();
+        const int snapshots = 1000;
+        uint64_t sink = 0;
+        for (int i = 0; i < snapshots; ++i) {
+            sink += histogram.Snapshot().p99_ns;
+        }
+        elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[PERF] Snapshot: " << elapsed / snapshots << " us/op (" << (sink > 0 ? "ok" : "empty") << ")" << std::endl;
+    }
+
+    return 0;
+}
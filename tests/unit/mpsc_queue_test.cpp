@@ -0,0 +1,404 @@
+// tests/unit/mpsc_queue_test.cpp
+#include "common/utils/queue/MpscQueue.hpp"
+#include "common/utils/queue/ThreadSafeQueue.hpp"
+#include "common/network/framing/tcp.hpp"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <cstring>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace mpc_engine::utils;
+using namespace mpc_engine::network::framing;
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+// move 생성 시 throw하는 원소 (노드 생성 실패 재현)
+struct ThrowingItem {
+    int value = 0;
+    bool poison = false;
+
+    ThrowingItem() = default;
+    ThrowingItem(int v, bool p) : value(v), poison(p) {}
+    ThrowingItem(ThrowingItem&& other) : value(other.value), poison(other.poison) {
+        if (poison) {
+            throw std::runtime_error("poisoned move");
+        }
+    }
+    ThrowingItem& operator=(ThrowingItem&& other) {
+        value = other.value;
+        poison = other.poison;
+        return *this;
+    }
+};
+
+// ===== 벤치마크 =====
+// 핸들러 스레드 N개가 응답을 만들고 송신 스레드 1개가 소켓에 기록하는 NodeTcpServer 구조 재현
+// (TLS 대신 socketpair에 write, 반대편은 drain 스레드가 계속 읽음)
+
+struct BenchResult {
+    double elapsed_ms;
+    uint64_t messages;
+    uint64_t write_calls;
+};
+
+class SocketSink {
+private:
+    int fds[2] = {-1, -1};
+    std::thread drain_thread;
+    std::atomic<bool> running{true};
+
+public:
+    SocketSink() {
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+            throw std::runtime_error("socketpair failed");
+        }
+        drain_thread = std::thread([this]() {
+            std::vector<char> buf(256 * 1024);
+            while (running.load()) {
+                if (read(fds[1], buf.data(), buf.size()) <= 0) break;
+            }
+        });
+    }
+
+    ~SocketSink() {
+        running = false;
+        shutdown(fds[0], SHUT_RDWR);
+        drain_thread.join();
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    bool WriteAll(const void* data, size_t length) {
+        const char* p = static_cast<const char*>(data);
+        while (length > 0) {
+            ssize_t n = write(fds[0], p, length);
+            if (n <= 0) return false;
+            p += n;
+            length -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+};
+
+NetworkMessage MakeResponse(size_t body_size, uint64_t request_id) {
+    NetworkMessage message(0, std::vector<uint8_t>(body_size, 0x5a));
+    message.header.request_id = request_id;
+    return message;
+}
+
+// Before: ThreadSafeQueue + 메시지당 Pop 1회, header/body write 2회 (기존 SendLoop)
+BenchResult BenchThreadSafeQueue(size_t producers, size_t per_producer, size_t body_size) {
+    ThreadSafeQueue<NetworkMessage> queue(producers * 50);
+    SocketSink sink;
+    uint64_t total = producers * per_producer;
+    uint64_t write_calls = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (size_t i = 0; i < per_producer; ++i) {
+                queue.TryPush(MakeResponse(body_size, p * per_producer + i), std::chrono::milliseconds(5000));
+            }
+        });
+    }
+
+    for (uint64_t sent = 0; sent < total; ++sent) {
+        NetworkMessage message;
+        if (queue.TryPop(message, std::chrono::milliseconds(1000)) != QueueResult::SUCCESS) {
+            throw std::runtime_error("ThreadSafeQueue pop timeout");
+        }
+        sink.WriteAll(&message.header, sizeof(MessageHeader));
+        sink.WriteAll(message.body.data(), message.body.size());
+        write_calls += 2;
+    }
+
+    for (auto& t : threads) t.join();
+
+    double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return BenchResult{elapsed, total, write_calls};
+}
+
+// After: MpscQueue + PopAll 배치, 배치당 write 1회 (새 SendLoop)
+BenchResult BenchMpscQueue(size_t producers, size_t per_producer, size_t body_size) {
+    MpscQueue<NetworkMessage> queue(producers * 50);
+    SocketSink sink;
+    uint64_t total = producers * per_producer;
+    uint64_t write_calls = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (size_t i = 0; i < per_producer; ++i) {
+                queue.TryPush(MakeResponse(body_size, p * per_producer + i), std::chrono::milliseconds(5000));
+            }
+        });
+    }
+
+    std::vector<NetworkMessage> batch;
+    std::vector<uint8_t> buffer;
+    uint64_t sent = 0;
+    while (sent < total) {
+        batch.clear();
+        if (queue.TryPopAll(batch, std::chrono::milliseconds(1000), 64) != QueueResult::SUCCESS) {
+            throw std::runtime_error("MpscQueue pop timeout");
+        }
+
+        size_t size = 0;
+        for (const auto& message : batch) size += sizeof(MessageHeader) + message.body.size();
+        buffer.resize(size);
+        uint8_t* cursor = buffer.data();
+        for (const auto& message : batch) {
+            std::memcpy(cursor, &message.header, sizeof(MessageHeader));
+            cursor += sizeof(MessageHeader);
+            std::memcpy(cursor, message.body.data(), message.body.size());
+            cursor += message.body.size();
+        }
+        sink.WriteAll(buffer.data(), buffer.size());
+        write_calls++;
+        sent += batch.size();
+    }
+
+    for (auto& t : threads) t.join();
+
+    double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return BenchResult{elapsed, total, write_calls};
+}
+
+void PrintBench(const char* name, const BenchResult& r) {
+    std::cout << "       " << name << ": " << r.messages << " msgs in " << static_cast<long long>(r.elapsed_ms) << "ms"
+              << " (" << static_cast<long long>(r.messages * 1000.0 / r.elapsed_ms) << " msgs/sec, "
+              << r.write_calls << " writes, "
+              << static_cast<long long>(r.elapsed_ms * 1e6 / r.messages) << " ns/msg)" << std::endl;
+}
+
+int main() {
+    std::cout << "=== MpscQueue Unit Tests ===" << std::endl;
+    std::cout << std::endl;
+
+    // Test 1: 기본 Push/Pop
+    run_test("Basic Push/Pop", []() {
+        MpscQueue<int> queue(10);
+
+        if (queue.Push(42) != QueueResult::SUCCESS) {
+            throw std::runtime_error("Push failed");
+        }
+
+        int value = 0;
+        if (queue.TryPop(value, std::chrono::milliseconds(100)) != QueueResult::SUCCESS || value != 42) {
+            throw std::runtime_error("Pop failed");
+        }
+
+        if (!queue.Empty()) {
+            throw std::runtime_error("Queue should be empty");
+        }
+    });
+
+    // Test 2: PopAll 배치 + max_items
+    run_test("PopAll Batch", []() {
+        MpscQueue<int> queue(100);
+        for (int i = 0; i < 10; ++i) {
+            queue.Push(i);
+        }
+
+        std::vector<int> batch;
+        if (queue.TryPopAll(batch, std::chrono::milliseconds(100), 4) != QueueResult::SUCCESS || batch.size() != 4) {
+            throw std::runtime_error("Expected batch of 4");
+        }
+        if (queue.TryPopAll(batch, std::chrono::milliseconds(100)) != QueueResult::SUCCESS || batch.size() != 10) {
+            throw std::runtime_error("Expected remaining 6");
+        }
+        for (int i = 0; i < 10; ++i) {
+            if (batch[i] != i) {
+                throw std::runtime_error("FIFO order broken");
+            }
+        }
+    });
+
+    // Test 3: 빈 큐 타임아웃
+    run_test("Pop Timeout", []() {
+        MpscQueue<int> queue(10);
+        std::vector<int> batch;
+
+        auto start = std::chrono::steady_clock::now();
+        QueueResult result = queue.TryPopAll(batch, std::chrono::milliseconds(100));
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        if (result != QueueResult::TIMEOUT || elapsed < 90) {
+            throw std::runtime_error("Expected timeout");
+        }
+    });
+
+    // Test 4: 가득 찬 큐
+    run_test("Full Queue TryPush", []() {
+        MpscQueue<int> queue(2);
+        queue.Push(1);
+        queue.Push(2);
+
+        if (queue.TryPush(3, std::chrono::milliseconds(50)) != QueueResult::TIMEOUT) {
+            throw std::runtime_error("Expected timeout on full queue");
+        }
+
+        int value;
+        queue.TryPop(value, std::chrono::milliseconds(10));
+        if (queue.TryPush(3, std::chrono::milliseconds(50)) != QueueResult::SUCCESS) {
+            throw std::runtime_error("Push should succeed after pop");
+        }
+    });
+
+    // Test 5: 대기 중인 소비자 깨우기
+    run_test("Wakeup Sleeping Consumer", []() {
+        MpscQueue<int> queue(10);
+        std::atomic<long long> latency_ms{-1};
+
+        std::thread consumer([&]() {
+            std::vector<int> batch;
+            auto start = std::chrono::steady_clock::now();
+            if (queue.TryPopAll(batch, std::chrono::milliseconds(2000)) == QueueResult::SUCCESS) {
+                latency_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            }
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        queue.Push(7);
+        consumer.join();
+
+        if (latency_ms.load() < 0 || latency_ms.load() > 500) {
+            throw std::runtime_error("Consumer not woken: " + std::to_string(latency_ms.load()));
+        }
+    });
+
+    // Test 6: Shutdown
+    run_test("Shutdown", []() {
+        MpscQueue<int> queue(10);
+        queue.Push(1);
+
+        std::thread consumer([&]() {
+            std::vector<int> batch;
+            queue.TryPopAll(batch, std::chrono::milliseconds(100));
+            QueueResult result = queue.TryPopAll(batch, std::chrono::milliseconds(5000));
+            if (result != QueueResult::SHUTDOWN) {
+                throw std::runtime_error("Expected SHUTDOWN");
+            }
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        queue.Shutdown();
+        consumer.join();
+
+        if (queue.Push(2) != QueueResult::SHUTDOWN) {
+            throw std::runtime_error("Push after shutdown should fail");
+        }
+    });
+
+    // Test 7: 16 producer, 손실/중복 없음 + producer별 순서 유지
+    run_test("16 Producers No Loss", []() {
+        const size_t producers = 16;
+        const size_t per_producer = 20000;
+        MpscQueue<uint64_t> queue(1024);
+
+        std::vector<std::thread> threads;
+        for (size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p]() {
+                for (size_t i = 0; i < per_producer; ++i) {
+                    queue.Push((static_cast<uint64_t>(p) << 32) | i);
+                }
+            });
+        }
+
+        std::vector<int64_t> last_seen(producers, -1);
+        std::vector<uint64_t> batch;
+        size_t received = 0;
+        while (received < producers * per_producer) {
+            batch.clear();
+            if (queue.TryPopAll(batch, std::chrono::milliseconds(1000)) != QueueResult::SUCCESS) {
+                throw std::runtime_error("Consumer stalled at " + std::to_string(received));
+            }
+            for (uint64_t v : batch) {
+                size_t p = static_cast<size_t>(v >> 32);
+                int64_t seq = static_cast<int64_t>(v & 0xffffffff);
+                if (seq != last_seen[p] + 1) {
+                    throw std::runtime_error("Per-producer order broken");
+                }
+                last_seen[p] = seq;
+            }
+            received += batch.size();
+        }
+
+        for (auto& t : threads) t.join();
+
+        if (!queue.Empty()) {
+            throw std::runtime_error("Queue should be empty");
+        }
+    });
+
+    // Test 8: 노드 생성이 throw해도 size가 새지 않고 소비자가 멈추지 않음
+    run_test("Throwing Push Does Not Leak Size", []() {
+        MpscQueue<ThrowingItem> queue(4);
+
+        bool threw = false;
+        try {
+            queue.Push(ThrowingItem(1, true));
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        if (!threw) {
+            throw std::runtime_error("Push should propagate the exception");
+        }
+        if (queue.Size() != 0) {
+            throw std::runtime_error("Size leaked: " + std::to_string(queue.Size()));
+        }
+
+        ThrowingItem item;
+        auto start = std::chrono::steady_clock::now();
+        if (queue.TryPop(item, std::chrono::milliseconds(50)) != QueueResult::TIMEOUT) {
+            throw std::runtime_error("Empty queue should time out");
+        }
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(1)) {
+            throw std::runtime_error("Consumer spun on a missing node");
+        }
+
+        queue.Push(ThrowingItem(2, false));
+        if (queue.TryPop(item, std::chrono::milliseconds(100)) != QueueResult::SUCCESS || item.value != 2) {
+            throw std::runtime_error("Queue unusable after failed push");
+        }
+    });
+
+    // 성능 테스트
+    std::cout << std::endl;
+    std::cout << "[PERF] 16 handler threads -> 1 send thread (256B responses)" << std::endl;
+    {
+        const size_t producers = 16;
+        const size_t per_producer = 20000;
+        const size_t body_size = 256;
+
+        BenchResult before = BenchThreadSafeQueue(producers, per_producer, body_size);
+        BenchResult after = BenchMpscQueue(producers, per_producer, body_size);
+
+        PrintBench("ThreadSafeQueue + per-message write", before);
+        PrintBench("MpscQueue + batched write        ", after);
+        std::cout << "       Speedup: " << (before.elapsed_ms / after.elapsed_ms) << "x" << std::endl;
+    }
+
+    std::cout << std::endl;
+    std::cout << "=== All Tests Passed ===" << std::endl;
+    return 0;
+}
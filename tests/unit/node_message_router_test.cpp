@@ -0,0 +1,371 @@
+// tests/unit/node_message_router_test.cpp
+#include "node/handlers/include/NodeMessageRouter.hpp"
+#include "node/handlers/include/NodeMpcSessionHandler.hpp"
+#include "types/MessageTypes.hpp"
+#include "proto/coordinator_node/generated/message.pb.h"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+using namespace mpc_engine;
+using namespace mpc_engine::node::handlers;
+using namespace mpc_engine::proto::coordinator_node;
+using namespace mpc_engine::network::framing;
+
+// ===== 할당 카운터 (전역 operator new 대체) =====
+static std::atomic<uint64_t> g_allocations{0};
+
+void* operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void expect(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+NetworkMessage MakeFrame(const CoordinatorNodeMessage& message, uint64_t request_id) {
+    NetworkMessage frame(static_cast<uint16_t>(message.message_type()), message.SerializeAsString());
+    frame.header.request_id = request_id;
+    return frame;
+}
+
+NetworkMessage MakeSigningFrame(uint64_t request_id) {
+    CoordinatorNodeMessage message;
+    message.set_message_type(static_cast<int32_t>(MessageType::SIGNING_REQUEST));
+    SigningRequest* request = message.mutable_signing_request();
+    request->mutable_header()->set_uid("router_test_uid");
+    request->mutable_header()->set_send_time("1700000000000");
+    request->mutable_header()->set_request_id(request_id);
+    request->set_key_id("router_test_key_0001");
+    request->set_transaction_data("0x" + std::string(64, 'a'));
+    request->set_threshold(2);
+    request->set_total_shards(3);
+    return MakeFrame(message, request_id);
+}
+
+NetworkMessage MakeMpcRoundFrame(const std::string& session_id, uint32_t round, uint64_t player_id,
+                                 const std::vector<uint64_t>& peers_with_messages, uint64_t request_id,
+                                 MpcProtocol protocol = MPC_PROTOCOL_ECDSA_SIGNING, uint32_t total_rounds = 5) {
+    CoordinatorNodeMessage message;
+    message.set_message_type(static_cast<int32_t>(MessageType::MPC_ROUND));
+    MpcRoundRequest* request = message.mutable_mpc_round_request();
+    request->mutable_header()->set_request_id(request_id);
+    request->set_session_id(session_id);
+    request->set_protocol(protocol);
+    request->set_round(round);
+    request->set_total_rounds(total_rounds);
+    request->set_key_id("router_test_key_0001");
+    request->set_player_id(player_id);
+    request->add_player_ids(1);
+    request->add_player_ids(2);
+    request->set_threshold(2);
+    request->set_session_input("0x" + std::string(64, 'a'));
+    for (uint64_t peer : peers_with_messages) {
+        (*request->mutable_peer_messages())[peer] = "round_" + std::to_string(round - 1) + "_from_" + std::to_string(peer);
+    }
+    return MakeFrame(message, request_id);
+}
+
+NetworkMessage MakeOnlineSigningFrame(const std::string& presignature_id, uint64_t player_id,
+                                      const std::vector<uint64_t>& player_ids, uint64_t request_id) {
+    CoordinatorNodeMessage message;
+    message.set_message_type(static_cast<int32_t>(MessageType::MPC_ROUND));
+    MpcRoundRequest* request = message.mutable_mpc_round_request();
+    request->mutable_header()->set_request_id(request_id);
+    request->set_session_id("online_" + std::to_string(request_id));
+    request->set_protocol(MPC_PROTOCOL_ECDSA_ONLINE_SIGNING);
+    request->set_round(1);
+    request->set_total_rounds(1);
+    request->set_key_id("router_test_key_0001");
+    request->set_player_id(player_id);
+    for (uint64_t player : player_ids) {
+        request->add_player_ids(player);
+    }
+    request->set_threshold(static_cast<uint32_t>(player_ids.size()));
+    request->set_session_input("0x" + std::string(64, 'b'));
+    request->set_presignature_id(presignature_id);
+    return MakeFrame(message, request_id);
+}
+
+CoordinatorNodeMessage ParseRequest(const NetworkMessage& frame) {
+    CoordinatorNodeMessage message;
+    expect(message.ParseFromArray(frame.body.data(), static_cast<int>(frame.body.size())), "request body not parseable");
+    return message;
+}
+
+CoordinatorNodeMessage ParseResponse(const NetworkMessage& frame) {
+    expect(frame.Validate() == ValidationResult::OK, "response frame invalid");
+    CoordinatorNodeMessage message;
+    expect(message.ParseFromArray(frame.body.data(), static_cast<int>(frame.body.size())), "response body not parseable");
+    return message;
+}
+
+// ===== 변경 전 경로 재현 (비교 기준) =====
+// heap parse → unique_ptr 응답 → SerializeToString → body 복사
+NetworkMessage LegacyProcess(const NetworkMessage& frame) {
+    auto request = std::make_unique<CoordinatorNodeMessage>();
+    request->ParseFromArray(frame.body.data(), static_cast<int>(frame.body.size()));
+
+    const SigningRequest& signing_request = request->signing_request();
+    auto response = std::make_unique<CoordinatorNodeMessage>();
+    response->set_message_type(static_cast<int32_t>(MessageType::SIGNING_REQUEST));
+    SigningResponse* signing_response = response->mutable_signing_response();
+    signing_response->mutable_header()->set_success(true);
+    signing_response->mutable_header()->set_request_id(signing_request.header().request_id());
+    signing_response->set_key_id(signing_request.key_id());
+    signing_response->set_signature("NODE_MOCK_SIGNATURE_" + signing_request.key_id() + "_" + std::to_string(1700000000000ULL));
+    signing_response->set_shard_index(0);
+
+    std::string serialized;
+    response->SerializeToString(&serialized);
+
+    NetworkMessage out;
+    out.header.message_type = static_cast<uint16_t>(response->message_type());
+    out.header.body_length = static_cast<uint32_t>(serialized.size());
+    out.body.assign(serialized.begin(), serialized.end());
+    out.header.checksum = MessageHeader::ComputeChecksum(out.body);
+    out.header.request_id = frame.header.request_id;
+    return out;
+}
+
+struct PipelineBench {
+    double ns_per_request;
+    double allocations_per_request;
+};
+
+template<typename TFunc>
+PipelineBench RunBench(const NetworkMessage& frame, int iterations, TFunc process) {
+    // warm-up (thread_local arena 블록, protobuf 기본 인스턴스 초기화)
+    for (int i = 0; i < 1000; ++i) {
+        process(frame);
+    }
+
+    uint64_t allocations_before = g_allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    size_t sink = 0;
+    for (int i = 0; i < iterations; ++i) {
+        sink += process(frame).body.size();
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    uint64_t allocations = g_allocations.load() - allocations_before;
+
+    if (sink == 0) {
+        throw std::runtime_error("empty responses");
+    }
+    return { elapsed / iterations, static_cast<double>(allocations) / iterations };
+}
+
+int main() {
+    std::cout << "=== NodeMessageRouter Tests ===" << std::endl;
+
+    NodeMessageRouter& router = NodeMessageRouter::Instance();
+    router.Initialize();
+
+    // Test 1: 서명 요청 → 서명 응답 (request_id / checksum 유지)
+    run_test("Signing Round Trip", [&router]() {
+        NetworkMessage response = router.Process(MakeSigningFrame(77));
+        expect(response.header.request_id == 77, "frame request_id not preserved");
+
+        CoordinatorNodeMessage message = ParseResponse(response);
+        expect(message.has_signing_response(), "expected signing_response");
+        expect(message.signing_response().header().success(), "signing not successful");
+        expect(message.signing_response().header().request_id() == 77, "proto request_id mismatch");
+        expect(message.signing_response().key_id() == "router_test_key_0001", "key_id mismatch");
+        expect(message.signing_response().signature().rfind("NODE_MOCK_SIGNATURE_router_test_key_0001_", 0) == 0,
+               "unexpected signature");
+    });
+
+    // Test 2: 깨진 body → 같은 응답 메시지에 INVALID 에러
+    run_test("Invalid Protobuf", [&router]() {
+        NetworkMessage frame(static_cast<uint16_t>(MessageType::SIGNING_REQUEST), std::string("\xff\xff\xff\xff", 4));
+        frame.header.request_id = 5;
+
+        CoordinatorNodeMessage message = ParseResponse(router.Process(frame));
+        expect(message.has_error_response(), "expected error_response");
+        expect(message.error_response().code() == NODE_ERROR_INVALID, "expected NODE_ERROR_INVALID");
+        expect(message.error_response().header().request_id() == 5, "request_id mismatch");
+    });
+
+    // Test 3: 등록되지 않은 message type
+    run_test("Unsupported Message Type", [&router]() {
+        CoordinatorNodeMessage request;
+        request.set_message_type(static_cast<int32_t>(MessageType::MAX_MESSAGE_TYPE) + 3);
+        request.mutable_signing_request()->set_key_id("k");
+
+        CoordinatorNodeMessage message = ParseResponse(router.Process(MakeFrame(request, 6)));
+        expect(message.has_error_response() && message.error_response().code() == NODE_ERROR_INVALID,
+               "expected NODE_ERROR_INVALID");
+    });
+
+    // Test 4: message type과 payload 불일치
+    run_test("Payload Mismatch", [&router]() {
+        CoordinatorNodeMessage request;
+        request.set_message_type(static_cast<int32_t>(MessageType::SIGNING_REQUEST));
+        request.mutable_signing_response()->set_key_id("k");
+
+        CoordinatorNodeMessage message = ParseResponse(router.Process(MakeFrame(request, 7)));
+        expect(message.has_error_response() && message.error_response().code() == NODE_ERROR_INVALID,
+               "expected NODE_ERROR_INVALID");
+    });
+
+    // Test 5: MPC 라운드 순서 검증 / 재전송 / abort
+    run_test("MPC Round Ordering", [&router]() {
+        auto round = [&router](uint32_t r, uint64_t player, const std::vector<uint64_t>& peers) {
+            return ParseResponse(router.Process(MakeMpcRoundFrame("router_mpc_session", r, player, peers, 100 + r)));
+        };
+
+        CoordinatorNodeMessage first = round(1, 1, {});
+        expect(first.has_mpc_round_response() && first.mpc_round_response().header().success(), "round 1 failed");
+
+        // 같은 라운드 재전송 → 저장된 출력
+        CoordinatorNodeMessage retransmit = round(1, 1, {});
+        expect(retransmit.mpc_round_response().output() == first.mpc_round_response().output(), "retransmit output changed");
+
+        expect(!round(3, 1, { 1, 2 }).mpc_round_response().header().success(), "skipped round accepted");
+        expect(!round(2, 1, { 1 }).mpc_round_response().header().success(), "round with missing peer message accepted");
+        expect(!round(1, 7, {}).mpc_round_response().header().success(), "non-participant accepted");
+
+        // 다른 참여자는 독립적으로 진행
+        expect(round(1, 2, {}).mpc_round_response().header().success(), "player 2 round 1 failed");
+        expect(round(2, 1, { 1, 2 }).mpc_round_response().header().success(), "round 2 failed");
+        expect(NodeMpcSessionStore::Instance().GetActiveSessionCount() == 2, "expected 2 session states");
+
+        // abort → 모든 참여자 상태 폐기, 이후 라운드는 순서 오류
+        CoordinatorNodeMessage abort;
+        abort.set_message_type(static_cast<int32_t>(MessageType::MPC_SESSION_ABORT));
+        abort.mutable_mpc_abort_request()->set_session_id("router_mpc_session");
+        expect(ParseResponse(router.Process(MakeFrame(abort, 200))).mpc_abort_response().header().success(), "abort failed");
+        expect(NodeMpcSessionStore::Instance().GetActiveSessionCount() == 0, "abort left session state");
+        expect(!round(3, 1, { 1, 2 }).mpc_round_response().header().success(), "round after abort accepted");
+    });
+
+    // Test 6: 여러 세션의 라운드 묶음 → 라운드별 결과 (한 세션 실패가 다른 세션에 영향 없음)
+    run_test("MPC Round Batch", [&router]() {
+        CoordinatorNodeMessage batch;
+        batch.set_message_type(static_cast<int32_t>(MessageType::MPC_ROUND_BATCH));
+        MpcRoundBatchRequest* request = batch.mutable_mpc_round_batch_request();
+        for (const char* session_id : { "router_batch_a", "router_batch_b" }) {
+            CoordinatorNodeMessage single = ParseRequest(MakeMpcRoundFrame(session_id, 1, 1, {}, 300));
+            request->add_rounds()->Swap(single.mutable_mpc_round_request());
+        }
+        CoordinatorNodeMessage skipped = ParseRequest(MakeMpcRoundFrame("router_batch_c", 2, 1, { 1, 2 }, 301));
+        request->add_rounds()->Swap(skipped.mutable_mpc_round_request());
+
+        CoordinatorNodeMessage message = ParseResponse(router.Process(MakeFrame(batch, 302)));
+        expect(message.has_mpc_round_batch_response(), "expected mpc_round_batch_response");
+        const MpcRoundBatchResponse& response = message.mpc_round_batch_response();
+        expect(response.rounds_size() == 3, "expected one result per round");
+        expect(response.rounds(0).header().success() && response.rounds(0).session_id() == "router_batch_a", "round a failed");
+        expect(response.rounds(1).header().success() && response.rounds(1).session_id() == "router_batch_b", "round b failed");
+        expect(!response.rounds(2).header().success(), "out-of-order round in batch accepted");
+        expect(response.rounds(0).output() != response.rounds(1).output(), "sessions share output");
+
+        NodeMpcSessionStore::Instance().Abort("router_batch_a");
+        NodeMpcSessionStore::Instance().Abort("router_batch_b");
+    });
+
+    // Test 7: presign 4 라운드 → presignature 보관 → 온라인 서명 1 라운드에서 1회만 소비
+    run_test("MPC Presignature Consumption", [&router]() {
+        std::string presignature[3];
+        for (uint32_t r = 1; r <= 4; ++r) {
+            std::vector<uint64_t> peers;
+            if (r > 1) {
+                peers = { 1, 2 };
+            }
+            for (uint64_t player : { 1, 2 }) {
+                CoordinatorNodeMessage message = ParseResponse(router.Process(
+                    MakeMpcRoundFrame("router_presig", r, player, peers, 400 + r, MPC_PROTOCOL_ECDSA_PRESIGN, 4)));
+                expect(message.mpc_round_response().header().success(), "presign round " + std::to_string(r) + " failed");
+                presignature[player] = message.mpc_round_response().output();
+            }
+        }
+        expect(presignature[1] == presignature[2] && presignature[1].rfind("MOCK_PRESIG_", 0) == 0, "presign outputs disagree");
+        expect(NodeMpcSessionStore::Instance().GetPresignatureCount() == 2, "expected one presignature per player");
+
+        auto online = [&router](const std::string& presignature_id, uint64_t player, const std::vector<uint64_t>& players) {
+            return ParseResponse(router.Process(MakeOnlineSigningFrame(presignature_id, player, players, 500 + player)))
+                .mpc_round_response();
+        };
+        expect(!online("router_unknown", 1, { 1, 2 }).header().success(), "unknown presignature accepted");
+        expect(!online("router_presig", 1, { 1, 3 }).header().success(), "presignature used with a different signer set");
+
+        MpcRoundResponse first = online("router_presig", 1, { 1, 2 });
+        MpcRoundResponse second = online("router_presig", 2, { 1, 2 });
+        expect(first.header().success() && second.header().success(), "online signing failed");
+        expect(first.output() == second.output() && first.output().rfind("MOCK_SIGNATURE_", 0) == 0, "online signatures disagree");
+        expect(NodeMpcSessionStore::Instance().GetPresignatureCount() == 0, "presignature not consumed");
+        expect(!online("router_presig", 1, { 1, 2 }).header().success(), "presignature reused");
+    });
+
+    // Test 8: 여러 핸들러 스레드 동시 처리 (스레드별 arena 블록)
+    run_test("Concurrent Processing", [&router]() {
+        const int threads = 4;
+        const int per_thread = 5000;
+        std::atomic<int> ok{0};
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&router, &ok, t]() {
+                for (int i = 0; i < per_thread; ++i) {
+                    uint64_t request_id = static_cast<uint64_t>(t) * per_thread + i + 1;
+                    NetworkMessage response = router.Process(MakeSigningFrame(request_id));
+                    CoordinatorNodeMessage message;
+                    if (response.header.request_id == request_id &&
+                        message.ParseFromArray(response.body.data(), static_cast<int>(response.body.size())) &&
+                        message.signing_response().header().request_id() == request_id) {
+                        ok++;
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        expect(ok.load() == threads * per_thread, "mismatched responses: " + std::to_string(ok.load()));
+    });
+
+    // ===== 성능 측정 =====
+    std::cout << "\n=== Performance (allocations per request) ===" << std::endl;
+    {
+        const int iterations = 200000;
+        NetworkMessage frame = MakeSigningFrame(42);
+
+        PipelineBench legacy = RunBench(frame, iterations, [](const NetworkMessage& f) { return LegacyProcess(f); });
+        PipelineBench typed = RunBench(frame, iterations, [&router](const NetworkMessage& f) { return router.Process(f); });
+
+        std::cout << "[PERF] Legacy (heap parse + SerializeToString + copy): "
+                  << legacy.allocations_per_request << " allocs/req, " << legacy.ns_per_request << " ns/req" << std::endl;
+        std::cout << "[PERF] Typed pipeline (arena + single serialize):     "
+                  << typed.allocations_per_request << " allocs/req, " << typed.ns_per_request << " ns/req" << std::endl;
+
+        run_test("Fewer Allocations Than Legacy", [&]() {
+            expect(typed.allocations_per_request < legacy.allocations_per_request,
+                   "typed pipeline does not reduce allocations");
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+// tests/unit/node_selector_test.cpp
+#include "coordinator/network/node_client/include/NodeSelector.hpp"
+#include <iostream>
+#include <chrono>
+#include <map>
+#include <vector>
+#include <stdexcept>
+#include <string>
+
+using namespace mpc_engine;
+using namespace mpc_engine::coordinator::network;
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void expect(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+std::string join(const std::vector<std::string>& ids) {
+    std::string out;
+    for (const auto& id : ids) {
+        out += (out.empty() ? "" : ",") + id;
+    }
+    return out;
+}
+
+constexpr uint64_t NOW_MS = 1'000'000;
+
+NodeCandidate make_candidate(const std::string& node_id, uint64_t latency_us, size_t in_flight = 0,
+                             PlatformType platform = PlatformType::UNKNOWN) {
+    NodeCandidate candidate;
+    candidate.node_id = node_id;
+    candidate.platform = platform;
+    candidate.load.latency_ns = latency_us * 1000;
+    candidate.load.last_sample_ms = NOW_MS - 10;
+    candidate.load.in_flight = in_flight;
+    return candidate;
+}
+
+int main() {
+    std::cout << "=== NodeSelector Tests ===" << std::endl;
+
+    // Test 1: 지연 낮은 순
+    run_test("Lowest Latency Order", []() {
+        NodeSelector selector;
+        auto order = selector.Order({ make_candidate("a", 900), make_candidate("b", 100), make_candidate("c", 400) }, NOW_MS);
+        expect(join(order) == "b,c,a", "unexpected order: " + join(order));
+    });
+
+    // Test 2: 대기 요청이 많은 노드는 지연이 낮아도 뒤로
+    run_test("In-flight Penalty", []() {
+        NodeSelector selector;
+        auto order = selector.Order({ make_candidate("busy", 100, 9), make_candidate("idle", 300, 0) }, NOW_MS);
+        expect(join(order) == "idle,busy", "unexpected order: " + join(order));
+    });
+
+    // Test 3: ORDERED는 후보 순서 유지
+    run_test("Ordered Policy", []() {
+        NodeSelectionConfig config;
+        config.policy = NodeSelectionPolicy::ORDERED;
+        NodeSelector selector(config);
+        auto order = selector.Order({ make_candidate("a", 900), make_candidate("b", 100), make_candidate("c", 400) }, NOW_MS);
+        expect(join(order) == "a,b,c", "unexpected order: " + join(order));
+    });
+
+    // Test 4: 우선/회피 목록 (노드 id, 플랫폼) - 지연보다 우선
+    run_test("Preferred / Avoided Tiers", []() {
+        NodeSelectionConfig config;
+        config.preferred_platforms = { PlatformType::AWS };
+        config.avoided_nodes = { "fast-but-avoided" };
+        NodeSelector selector(config);
+        auto order = selector.Order({
+            make_candidate("fast-but-avoided", 50),
+            make_candidate("neutral", 200),
+            make_candidate("aws-slow", 800, 0, PlatformType::AWS),
+            make_candidate("aws-fast", 300, 0, PlatformType::AWS),
+        }, NOW_MS);
+        expect(join(order) == "aws-fast,aws-slow,neutral,fast-but-avoided", "unexpected order: " + join(order));
+    });
+
+    // Test 5: 최근 BUSY/타임아웃 노드는 cooldown 동안 맨 뒤, 이후 복귀
+    run_test("Degraded Cooldown", []() {
+        NodeSelector selector;
+        NodeCandidate degraded = make_candidate("degraded", 50);
+        degraded.load.last_degraded_ms = NOW_MS - 100;
+        auto order = selector.Order({ degraded, make_candidate("ok", 500) }, NOW_MS);
+        expect(join(order) == "ok,degraded", "degraded node not demoted: " + join(order));
+
+        order = selector.Order({ degraded, make_candidate("ok", 500) }, NOW_MS + 5000);
+        expect(order.front() == "degraded", "degraded node not restored after cooldown: " + join(order));
+    });
+
+    // Test 6: 표본이 오래된 노드는 점수 0 - 다시 시도되어 회복이 반영됨
+    run_test("Stale Sample Probe", []() {
+        NodeSelector selector;
+        NodeCandidate recovered = make_candidate("was-slow", 50'000);
+        recovered.load.last_sample_ms = NOW_MS - 5000;
+        expect(selector.Score(recovered.load, NOW_MS) == 0.0, "stale sample must score 0");
+
+        NodeCandidate never = make_candidate("new", 0);
+        never.load.last_sample_ms = 0;
+        expect(selector.Score(never.load, NOW_MS) == 0.0, "unsampled node must score 0");
+
+        auto order = selector.Order({ make_candidate("fast", 100), recovered }, NOW_MS);
+        expect(order.front() == "was-slow", "stale node not probed: " + join(order));
+    });
+
+    // Test 7: P2C - 가장 느린 노드는 1순위가 되지 않고, 나머지는 분산
+    run_test("Power of Two Choices", []() {
+        NodeSelectionConfig config;
+        config.policy = NodeSelectionPolicy::POWER_OF_TWO_CHOICES;
+        NodeSelector selector(config);
+        std::vector<NodeCandidate> candidates = {
+            make_candidate("a", 100), make_candidate("b", 110), make_candidate("c", 120), make_candidate("slow", 5000)
+        };
+
+        std::map<std::string, int> first;
+        const int rounds = 4000;
+        for (int i = 0; i < rounds; ++i) {
+            auto order = selector.Order(candidates, NOW_MS);
+            expect(order.size() == candidates.size(), "candidate lost");
+            first[order.front()]++;
+        }
+        expect(first["slow"] == 0, "slowest node picked first " + std::to_string(first["slow"]) + " times");
+        // a는 자신이 뽑힌 모든 쌍에서 이김 (1/2), c는 slow와 짝일 때만 (1/6)
+        expect(first["a"] > first["b"] && first["b"] > first["c"] && first["c"] > rounds / 20,
+               "unexpected spread a=" + std::to_string(first["a"]) + " b=" + std::to_string(first["b"]) +
+               " c=" + std::to_string(first["c"]));
+        std::cout << "  first pick: a=" << first["a"] << " b=" << first["b"] << " c=" << first["c"] << std::endl;
+    });
+
+    // Test 8: 정책 문자열
+    run_test("Policy Strings", []() {
+        expect(NodeSelectionPolicyFromString("ordered") == NodeSelectionPolicy::ORDERED, "ordered");
+        expect(NodeSelectionPolicyFromString("p2c") == NodeSelectionPolicy::POWER_OF_TWO_CHOICES, "p2c");
+        expect(NodeSelectionPolicyFromString("latency") == NodeSelectionPolicy::LOWEST_LATENCY, "latency");
+        expect(NodeSelectionPolicyFromString("bogus") == NodeSelectionPolicy::LOWEST_LATENCY, "default");
+        expect(std::string(NodeSelectionPolicyToString(NodeSelectionPolicy::POWER_OF_TWO_CHOICES)) == "p2c", "to string");
+    });
+
+    // ===== 성능 측정 =====
+    std::cout << "\n=== Performance ===" << std::endl;
+    {
+        NodeSelector selector;
+        std::vector<NodeCandidate> candidates;
+        for (int i = 0; i < 16; ++i) {
+            candidates.push_back(make_candidate("node" + std::to_string(i), static_cast<uint64_t>((i * 37) % 16 + 1) * 100));
+        }
+
+        const int iterations = 200000;
+        size_t sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            sink += selector.Order(candidates, NOW_MS).front().size();
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[PERF] Order (16 candidates): " << elapsed / iterations << " ns/op (" << (sink > 0 ? "ok" : "empty") << ")" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,277 @@
+// tests/unit/ordered_executor_test.cpp
+#include "common/utils/threading/OrderedExecutor.hpp"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <set>
+
+using namespace mpc_engine::utils;
+
+// 테스트용 Context 타입들
+struct SequenceContext {
+    uint64_t key;
+    int sequence;
+    std::vector<std::vector<int>>* per_key_order;   // key별 실행 순서 기록 (lane 내 단일 스레드 → 락 불필요)
+    std::atomic<int>* completed;
+};
+
+struct SleepContext {
+    int sleep_ms;
+    std::atomic<int>* completed;
+};
+
+struct ThreadIdContext {
+    std::thread::id* seen;
+    std::atomic<bool>* mismatch;
+};
+
+// 테스트 함수들
+void record_sequence(SequenceContext* ctx) {
+    (*ctx->per_key_order)[ctx->key].push_back(ctx->sequence);
+    ctx->completed->fetch_add(1);
+}
+
+void sleep_task(SleepContext* ctx) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ctx->sleep_ms));
+    ctx->completed->fetch_add(1);
+}
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void wait_for(std::atomic<int>& counter, int expected, int timeout_ms) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (counter.load() < expected && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+int main() {
+    std::cout << "=== OrderedExecutor Unit Tests ===" << std::endl;
+    std::cout << std::endl;
+
+    // Test 1: 같은 key는 제출 순서대로 실행
+    run_test("Per-Key FIFO Order", []() {
+        const size_t num_keys = 32;
+        const int per_key = 500;
+
+        OrderedExecutor<SequenceContext> executor(4);
+        std::vector<std::vector<int>> per_key_order(num_keys);
+        std::atomic<int> completed{0};
+
+        // 여러 producer가 서로 다른 key 집합을 인터리빙하며 제출
+        std::vector<std::thread> producers;
+        for (size_t p = 0; p < 4; ++p) {
+            producers.emplace_back([&, p]() {
+                for (int seq = 0; seq < per_key; ++seq) {
+                    for (uint64_t key = p; key < num_keys; key += 4) {
+                        executor.SubmitOwned(key, record_sequence,
+                            std::make_unique<SequenceContext>(SequenceContext{key, seq, &per_key_order, &completed}));
+                    }
+                }
+            });
+        }
+        for (auto& t : producers) t.join();
+
+        wait_for(completed, static_cast<int>(num_keys) * per_key, 5000);
+        executor.Shutdown();
+
+        for (size_t key = 0; key < num_keys; ++key) {
+            const auto& order = per_key_order[key];
+            if (order.size() != static_cast<size_t>(per_key)) {
+                throw std::runtime_error("Missing tasks for key " + std::to_string(key));
+            }
+            for (int i = 0; i < per_key; ++i) {
+                if (order[i] != i) {
+                    throw std::runtime_error("Out of order for key " + std::to_string(key));
+                }
+            }
+        }
+    });
+
+    // Test 2: 같은 key는 항상 같은 워커 스레드
+    run_test("Key Affinity (Same Worker Thread)", []() {
+        OrderedExecutor<ThreadIdContext> executor(4);
+        std::thread::id seen{};
+        std::atomic<bool> mismatch{false};
+        ThreadIdContext ctx{&seen, &mismatch};
+
+        for (int i = 0; i < 200; ++i) {
+            executor.SubmitBorrowed(12345, [](ThreadIdContext* c) {
+                if (*c->seen == std::thread::id{}) {
+                    *c->seen = std::this_thread::get_id();
+                } else if (*c->seen != std::this_thread::get_id()) {
+                    c->mismatch->store(true);
+                }
+            }, &ctx);
+        }
+
+        executor.Shutdown();
+
+        if (mismatch.load()) {
+            throw std::runtime_error("Same key ran on different threads");
+        }
+    });
+
+    // Test 3: 서로 다른 lane은 병렬 실행
+    run_test("Parallel Across Lanes", []() {
+        const size_t num_lanes = 4;
+        OrderedExecutor<SleepContext> executor(num_lanes);
+        std::atomic<int> completed{0};
+
+        // lane마다 하나씩 걸리는 key 선택
+        std::vector<uint64_t> keys;
+        std::set<size_t> used_lanes;
+        for (uint64_t key = 0; keys.size() < num_lanes; ++key) {
+            if (used_lanes.insert(executor.LaneOf(key)).second) {
+                keys.push_back(key);
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t key : keys) {
+            executor.SubmitOwned(key, sleep_task, std::make_unique<SleepContext>(SleepContext{100, &completed}));
+        }
+        wait_for(completed, static_cast<int>(num_lanes), 2000);
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "  Duration: " << duration << "ms (expected ~100ms)" << std::endl;
+
+        if (completed.load() != static_cast<int>(num_lanes) || duration > 300) {
+            throw std::runtime_error("Lanes did not run in parallel");
+        }
+    });
+
+    // Test 4: 예외가 lane을 멈추지 않음
+    run_test("Exception Handling", []() {
+        OrderedExecutor<SleepContext> executor(2);
+        std::atomic<int> completed{0};
+
+        executor.SubmitOwned(7, [](SleepContext*) {
+            throw std::runtime_error("Test exception");
+        }, std::make_unique<SleepContext>(SleepContext{0, &completed}));
+        executor.SubmitOwned(7, sleep_task, std::make_unique<SleepContext>(SleepContext{0, &completed}));
+
+        wait_for(completed, 1, 1000);
+        if (completed.load() != 1) {
+            throw std::runtime_error("Lane stopped after exception");
+        }
+    });
+
+    // Test 5: Shutdown 이후 제출 거부
+    run_test("Shutdown", []() {
+        OrderedExecutor<SleepContext> executor(2);
+        std::atomic<int> completed{0};
+
+        executor.Shutdown();
+
+        if (!executor.IsStopped()) {
+            throw std::runtime_error("Executor should be stopped");
+        }
+
+        try {
+            executor.SubmitOwned(1, sleep_task, std::make_unique<SleepContext>(SleepContext{0, &completed}));
+            throw std::logic_error("Submit after shutdown should throw");
+        } catch (const std::runtime_error&) {
+            // 예상된 동작
+        }
+    });
+
+    // Test 6: key 분산
+    run_test("Lane Distribution", []() {
+        OrderedExecutor<SleepContext> executor(8);
+        std::vector<int> hits(8, 0);
+
+        for (uint64_t key = 0; key < 8000; ++key) {
+            hits[executor.LaneOf(key)]++;
+        }
+
+        for (size_t lane = 0; lane < hits.size(); ++lane) {
+            if (hits[lane] < 700 || hits[lane] > 1300) {
+                throw std::runtime_error("Skewed lane " + std::to_string(lane) + ": " + std::to_string(hits[lane]));
+            }
+        }
+    });
+
+    // Test 7: TrySubmitOwned - 포화된 lane만 FULL
+    run_test("TrySubmitOwned (Full Lane)", []() {
+        OrderedExecutor<SleepContext> executor(2, 4);
+        std::atomic<int> completed{0};
+
+        // lane이 다른 두 key 선택
+        uint64_t busy_key = 0;
+        uint64_t idle_key = 1;
+        while (executor.LaneOf(idle_key) == executor.LaneOf(busy_key)) {
+            ++idle_key;
+        }
+
+        // busy lane: 실행 중 1개 + 대기 4개
+        executor.SubmitOwned(busy_key, sleep_task, std::make_unique<SleepContext>(SleepContext{200, &completed}));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        for (int i = 0; i < 4; ++i) {
+            if (executor.TrySubmitOwned(busy_key, sleep_task, std::make_unique<SleepContext>(SleepContext{0, &completed})) != QueueResult::SUCCESS) {
+                throw std::runtime_error("Lane rejected task before capacity");
+            }
+        }
+
+        if (executor.TrySubmitOwned(busy_key, sleep_task, std::make_unique<SleepContext>(SleepContext{0, &completed})) != QueueResult::FULL) {
+            throw std::runtime_error("Expected FULL on saturated lane");
+        }
+        if (executor.TrySubmitOwned(idle_key, sleep_task, std::make_unique<SleepContext>(SleepContext{0, &completed})) != QueueResult::SUCCESS) {
+            throw std::runtime_error("Idle lane should accept task");
+        }
+
+        wait_for(completed, 6, 2000);
+        if (completed.load() != 6) {
+            throw std::runtime_error("Accepted tasks not executed: " + std::to_string(completed.load()));
+        }
+
+        executor.Shutdown();
+        if (executor.TrySubmitOwned(idle_key, sleep_task, std::make_unique<SleepContext>(SleepContext{0, &completed})) != QueueResult::SHUTDOWN) {
+            throw std::runtime_error("Expected SHUTDOWN after Shutdown()");
+        }
+    });
+
+    // 성능 테스트
+    std::cout << std::endl;
+    std::cout << "[PERF] Performance Test" << std::endl;
+    {
+        OrderedExecutor<SequenceContext> executor(8);
+        std::vector<std::vector<int>> per_key_order(1024);
+        std::atomic<int> completed{0};
+
+        const int num_tasks = 100000;
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < num_tasks; ++i) {
+            uint64_t key = static_cast<uint64_t>(i) % per_key_order.size();
+            executor.SubmitOwned(key, record_sequence,
+                std::make_unique<SequenceContext>(SequenceContext{key, i, &per_key_order, &completed}));
+        }
+
+        wait_for(completed, num_tasks, 10000);
+        executor.Shutdown();
+
+        auto end = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        std::cout << "       " << num_tasks << " tasks in " << duration << "ms";
+        std::cout << " (" << (num_tasks * 1000 / std::max<long long>(1, duration)) << " tasks/sec)" << std::endl;
+        std::cout << "       Completed: " << completed.load() << std::endl;
+    }
+
+    std::cout << std::endl;
+    std::cout << "=== All Tests Passed ===" << std::endl;
+    return 0;
+}
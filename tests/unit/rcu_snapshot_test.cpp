@@ -0,0 +1,249 @@
+// tests/unit/rcu_snapshot_test.cpp
+#include "common/utils/threading/RcuSnapshot.hpp"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace mpc_engine::utils;
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void expect(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+// CoordinatorServer node 레지스트리와 같은 형태 (node_id → 클라이언트)
+struct FakeClient {
+    std::string node_id;
+    std::atomic<uint64_t> requests{0};
+};
+using Registry = std::unordered_map<std::string, std::shared_ptr<FakeClient>>;
+
+Registry make_registry(size_t count) {
+    Registry registry;
+    for (size_t i = 0; i < count; ++i) {
+        auto client = std::make_shared<FakeClient>();
+        client->node_id = "node" + std::to_string(i);
+        registry.emplace(client->node_id, client);
+    }
+    return registry;
+}
+
+// ===== 벤치마크 =====
+// 요청 스레드 threads개가 duration 동안 node_id 조회 (+ 선택적으로 writer가 주기적으로 새 버전 게시)
+struct BenchResult {
+    uint64_t lookups;
+    double elapsed_ms;
+    uint64_t publishes;
+};
+
+template<typename TLookup, typename TPublish>
+BenchResult run_bench(size_t threads, std::chrono::milliseconds duration, TLookup lookup, TPublish publish,
+                      std::chrono::microseconds publish_interval) {
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> total{0};
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            std::vector<std::string> keys;
+            for (size_t i = 0; i < 16; ++i) {
+                keys.push_back("node" + std::to_string((i + t) % 16));
+            }
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            uint64_t local = 0;
+            size_t i = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int batch = 0; batch < 64; ++batch) {
+                    local += lookup(keys[i++ & 15]) ? 1 : 0;
+                }
+            }
+            total += local;
+        });
+    }
+
+    uint64_t publishes = 0;
+    auto begin = std::chrono::steady_clock::now();
+    start = true;
+    auto deadline = begin + duration;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (publish_interval.count() > 0) {
+            std::this_thread::sleep_for(publish_interval);
+            publish();
+            publishes++;
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    stop = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    return { total.load(), elapsed, publishes };
+}
+
+void print_bench(const char* name, const BenchResult& result) {
+    std::cout << "[PERF] " << name << ": " << result.lookups / result.elapsed_ms / 1000.0 << " M lookups/s ("
+              << result.lookups << " in " << result.elapsed_ms << "ms, " << result.publishes << " publishes)" << std::endl;
+}
+
+int main() {
+    std::cout << "=== RcuSnapshot Tests ===" << std::endl;
+
+    // Test 1: 게시한 버전이 바로 보임 (캐시된 이전 버전이 남지 않음)
+    run_test("Publish Visible To Readers", []() {
+        RcuSnapshot<Registry> registry(std::make_shared<const Registry>(make_registry(2)));
+        expect(registry.Read()->size() == 2, "initial size");
+        uint64_t before = registry.GetVersion();
+
+        registry.Publish(std::make_shared<const Registry>(make_registry(3)));
+        expect(registry.GetVersion() != before, "version did not change");
+        expect(registry.Read()->size() == 3, "stale snapshot after publish");
+        expect(registry.Load()->size() == 3, "Load returned a stale snapshot");
+    });
+
+    // Test 2: Update는 복사본 수정 - false면 게시하지 않음, 이전 스냅샷은 그대로
+    run_test("Copy-on-write Update", []() {
+        RcuSnapshot<Registry> registry(std::make_shared<const Registry>(make_registry(2)));
+        std::shared_ptr<const Registry> old_snapshot = registry.Load();
+        uint64_t version = registry.GetVersion();
+
+        expect(!registry.Update([](Registry&) { return false; }), "rejected update published");
+        expect(registry.GetVersion() == version, "rejected update changed the version");
+
+        expect(registry.Update([](Registry& next) { return next.erase("node0") == 1; }), "update failed");
+        expect(old_snapshot->count("node0") == 1, "old snapshot was modified");
+        expect(registry.Read()->count("node0") == 0, "update not visible");
+    });
+
+    // Test 3: 인스턴스가 여러 개여도 스레드 캐시가 섞이지 않음
+    run_test("Independent Instances", []() {
+        RcuSnapshot<Registry> a(std::make_shared<const Registry>(make_registry(1)));
+        RcuSnapshot<Registry> b(std::make_shared<const Registry>(make_registry(4)));
+        for (int i = 0; i < 3; ++i) {
+            expect(a.Read()->size() == 1, "a read b's snapshot");
+            expect(b.Read()->size() == 4, "b read a's snapshot");
+        }
+    });
+
+    // Test 4: 이전 스냅샷은 마지막 참조(다른 스레드 캐시)가 사라지면 해제
+    run_test("Old Snapshots Released", []() {
+        RcuSnapshot<Registry> registry(std::make_shared<const Registry>(make_registry(2)));
+        std::weak_ptr<FakeClient> removed = registry.Load()->at("node1");
+
+        std::thread reader([&]() { expect(registry.Read()->size() == 2, "reader size"); });
+        reader.join();
+        registry.Update([](Registry& next) { return next.erase("node1") == 1; });
+        registry.Read();    // 이 스레드 캐시도 새 버전으로
+        expect(removed.expired(), "removed client still alive");
+    });
+
+    // Test 5: Read 반환값을 들고 있는 동안은 새 버전 게시 + 같은 스레드의 재Read에도 해제되지 않음
+    run_test("Read Pins Snapshot", []() {
+        RcuSnapshot<Registry> registry(std::make_shared<const Registry>(make_registry(2)));
+        std::shared_ptr<const Registry> pinned = registry.Read();
+        std::weak_ptr<FakeClient> node1 = pinned->at("node1");
+
+        registry.Update([](Registry& next) { return next.erase("node1") == 1; });
+        expect(registry.Read()->count("node1") == 0, "update not visible");
+        expect(!node1.expired() && pinned->at("node1")->node_id == "node1", "pinned snapshot released");
+
+        pinned.reset();
+        expect(node1.expired(), "removed client outlived its last snapshot");
+    });
+
+    // Test 6: writer가 계속 게시하는 동안 reader는 항상 완전한 스냅샷을 봄
+    run_test("Concurrent Readers And Writer", []() {
+        RcuSnapshot<Registry> registry(std::make_shared<const Registry>(make_registry(16)));
+        std::atomic<bool> stop{false};
+        std::atomic<uint64_t> torn{0};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 8; ++t) {
+            readers.emplace_back([&]() {
+                while (!stop.load()) {
+                    std::shared_ptr<const Registry> pinned = registry.Read();
+                    const Registry& snapshot = *pinned;
+                    // writer는 항상 16개 또는 15개(node15 제거) 버전만 게시
+                    if (snapshot.size() != 16 && snapshot.size() != 15) {
+                        torn++;
+                    }
+                    for (const auto& entry : snapshot) {
+                        if (!entry.second || entry.second->node_id != entry.first) {
+                            torn++;
+                        }
+                    }
+                }
+            });
+        }
+        for (int i = 0; i < 2000; ++i) {
+            registry.Update([i](Registry& next) {
+                if (i % 2 == 0) {
+                    next.erase("node15");
+                } else {
+                    auto client = std::make_shared<FakeClient>();
+                    client->node_id = "node15";
+                    next.emplace("node15", client);
+                }
+                return true;
+            });
+        }
+        stop = true;
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        expect(torn.load() == 0, std::to_string(torn.load()) + " inconsistent reads");
+    });
+
+    // ===== 성능 측정 =====
+    // 이전 구조 (요청마다 nodes_mutex + map 조회) vs RCU 스냅샷, 요청 스레드 64개
+    std::cout << "\n=== Performance (64 request threads, 16 nodes, "
+              << std::thread::hardware_concurrency() << " cores) ===" << std::endl;
+    const size_t threads = 64;
+    const auto duration = std::chrono::milliseconds(500);
+    {
+        Registry map = make_registry(16);
+        std::mutex mutex;
+        auto lookup = [&](const std::string& node_id) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = map.find(node_id);
+            return it != map.end() ? it->second.get() : nullptr;
+        };
+        print_bench("mutex + map", run_bench(threads, duration, lookup, []() {}, std::chrono::microseconds(0)));
+    }
+    {
+        RcuSnapshot<Registry> registry(std::make_shared<const Registry>(make_registry(16)));
+        auto lookup = [&](const std::string& node_id) {
+            std::shared_ptr<const Registry> clients = registry.Read();
+            auto it = clients->find(node_id);
+            return it != clients->end() ? it->second.get() : nullptr;
+        };
+        print_bench("rcu snapshot", run_bench(threads, duration, lookup, []() {}, std::chrono::microseconds(0)));
+
+        // 등록/해제가 1ms마다 일어나는 경우 (실제로는 훨씬 드묾)
+        auto publish = [&]() { registry.Update([](Registry&) { return true; }); };
+        print_bench("rcu snapshot, publish every 1ms", run_bench(threads, duration, lookup, publish, std::chrono::microseconds(1000)));
+    }
+
+    return 0;
+}
@@ -0,0 +1,343 @@
+// tests/unit/relay_frame_test.cpp
+#include "common/network/framing/relay.hpp"
+#include "node/handlers/include/NodeMessageRouter.hpp"
+#include "types/MessageTypes.hpp"
+#include "proto/coordinator_node/generated/message.pb.h"
+#include <iostream>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace mpc_engine;
+using namespace mpc_engine::node::handlers;
+using namespace mpc_engine::proto::coordinator_node;
+using namespace mpc_engine::network::framing;
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void expect(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+using Segment = std::shared_ptr<const std::vector<uint8_t>>;
+
+CoordinatorNodeMessage MakeRoundMessage(const std::string& session_id, uint32_t round, uint64_t player_id) {
+    CoordinatorNodeMessage message;
+    message.set_message_type(static_cast<int32_t>(MessageType::MPC_ROUND));
+    MpcRoundRequest* request = message.mutable_mpc_round_request();
+    request->mutable_header()->set_uid(session_id);
+    request->set_session_id(session_id);
+    request->set_protocol(MPC_PROTOCOL_ECDSA_SIGNING);
+    request->set_round(round);
+    request->set_total_rounds(5);
+    request->set_key_id("relay_test_key");
+    request->set_player_id(player_id);
+    request->add_player_ids(1);
+    request->add_player_ids(2);
+    request->add_player_ids(3);
+    request->set_threshold(2);
+    if (round == 1) {
+        request->set_session_input("0x" + std::string(64, 'a'));
+    }
+    return message;
+}
+
+/**
+ * @brief coordinator와 같은 방식의 relay 요청 프레임 (prefix body + 공유 envelope segment, checksum은 XOR 합성)
+ * @param checksums segments[i]를 body로 받은 응답 프레임의 checksum
+ */
+NetworkMessage BuildRelayFrame(const CoordinatorNodeMessage& round_message, const std::vector<Segment>& segments,
+                               const std::vector<uint32_t>& checksums) {
+    NetworkMessage frame;
+    RelayFrameHeader header;
+    header.request_length = static_cast<uint32_t>(round_message.ByteSizeLong());
+    header.envelope_count = static_cast<uint32_t>(segments.size());
+    frame.body.resize(RelayFramePrefixSize(header.request_length));
+    memcpy(frame.body.data(), &header, sizeof(header));
+    round_message.SerializeWithCachedSizesToArray(frame.body.data() + sizeof(header));
+
+    uint32_t checksum = MessageHeader::ComputeChecksum(frame.body);
+    size_t body_length = frame.body.size();
+    for (size_t i = 0; i < segments.size(); ++i) {
+        frame.segments.push_back(segments[i]);
+        checksum ^= checksums[i];
+        body_length += segments[i]->size();
+    }
+    frame.header.message_type = static_cast<uint16_t>(MessageType::MPC_RELAY_ROUND);
+    frame.header.body_length = static_cast<uint32_t>(body_length);
+    frame.header.checksum = checksum;
+    return frame;
+}
+
+// 노드가 받는 형태 (body 하나로 이어진 프레임)
+NetworkMessage Flatten(const NetworkMessage& frame) {
+    NetworkMessage flat;
+    flat.header = frame.header;
+    flat.body = frame.body;
+    for (const Segment& segment : frame.segments) {
+        flat.body.insert(flat.body.end(), segment->begin(), segment->end());
+    }
+    return flat;
+}
+
+// ===== coordinator 라운드 중계 1회 (참여자 수만큼 응답 → 다음 라운드 요청) =====
+// 기존 경로: 응답 parse → peer_messages 조립 → 수신자별 SerializeToString + body 복사 + checksum
+double LegacyRelayRound(const std::vector<NetworkMessage>& responses, size_t participants) {
+    auto start = std::chrono::steady_clock::now();
+
+    std::map<uint64_t, std::string> outputs;
+    for (const NetworkMessage& response : responses) {
+        auto message = std::make_unique<CoordinatorNodeMessage>();
+        message->ParseFromArray(response.body.data(), static_cast<int>(response.body.size()));
+        MpcRoundResponse* round = message->mutable_mpc_round_response();
+        outputs[round->player_id()] = std::move(*round->mutable_output());
+    }
+
+    CoordinatorNodeMessage next = MakeRoundMessage("relay_bench", 2, 0);
+    for (auto& entry : outputs) {
+        (*next.mutable_mpc_round_request()->mutable_peer_messages())[entry.first] = std::move(entry.second);
+    }
+
+    size_t sent = 0;
+    for (size_t player = 1; player <= participants; ++player) {
+        next.mutable_mpc_round_request()->set_player_id(player);
+        std::string serialized;
+        next.SerializeToString(&serialized);
+        NetworkMessage frame;
+        frame.body.assign(serialized.begin(), serialized.end());
+        frame.header.body_length = static_cast<uint32_t>(frame.body.size());
+        frame.header.checksum = MessageHeader::ComputeChecksum(frame.body);
+        sent += frame.header.body_length;
+    }
+    expect(sent > 0, "legacy relay sent nothing");
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+// relay 경로: envelope header만 디코딩 → 수신자별 라운드 요청 prefix + 같은 응답 버퍼 공유
+// (수신 버퍼 해제는 수신 쪽 비용이므로 segments로 돌려받아 측정 밖에서 해제)
+double OpaqueRelayRound(std::vector<NetworkMessage>& responses, size_t participants, std::vector<Segment>* retained) {
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<Segment>& segments = *retained;
+    std::vector<uint32_t> checksums;
+    for (NetworkMessage& response : responses) {
+        RelayEnvelopeView view;
+        expect(DecodeRelayEnvelope(response.body.data(), response.body.size(), &view), "bad envelope");
+        checksums.push_back(response.header.checksum);
+        segments.push_back(std::make_shared<const std::vector<uint8_t>>(std::move(response.body)));
+    }
+
+    CoordinatorNodeMessage next = MakeRoundMessage("relay_bench", 2, 0);
+    size_t sent = 0;
+    for (size_t player = 1; player <= participants; ++player) {
+        next.mutable_mpc_round_request()->set_player_id(player);
+        NetworkMessage frame = BuildRelayFrame(next, segments, checksums);
+        sent += frame.header.body_length;
+    }
+    expect(sent > 0, "opaque relay sent nothing");
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<NetworkMessage> MakeProtobufResponses(size_t participants, size_t payload_size) {
+    std::vector<NetworkMessage> responses;
+    for (size_t player = 1; player <= participants; ++player) {
+        CoordinatorNodeMessage message;
+        message.set_message_type(static_cast<int32_t>(MessageType::MPC_ROUND));
+        MpcRoundResponse* round = message.mutable_mpc_round_response();
+        round->mutable_header()->set_success(true);
+        round->set_session_id("relay_bench");
+        round->set_round(1);
+        round->set_player_id(player);
+        round->set_output(std::string(payload_size, static_cast<char>('a' + player)));
+        responses.emplace_back(static_cast<uint16_t>(MessageType::MPC_ROUND), message.SerializeAsString());
+    }
+    return responses;
+}
+
+std::vector<NetworkMessage> MakeEnvelopeResponses(size_t participants, size_t payload_size) {
+    std::vector<NetworkMessage> responses;
+    for (size_t player = 1; player <= participants; ++player) {
+        responses.emplace_back(static_cast<uint16_t>(MessageType::MPC_RELAY_ROUND),
+                               EncodeRelayEnvelope("relay_bench", 1, player, {}, std::string(payload_size, static_cast<char>('a' + player))));
+    }
+    return responses;
+}
+
+int main() {
+    std::cout << "=== Relay Frame Tests ===" << std::endl;
+
+    NodeMessageRouter& router = NodeMessageRouter::Instance();
+    router.Initialize();
+
+    run_test("Envelope Round Trip", []() {
+        std::vector<uint8_t> envelope = EncodeRelayEnvelope("session_a", 3, 2, { 1, 3 }, "payload_bytes");
+        expect(envelope.size() % RELAY_ALIGNMENT == 0, "envelope not padded");
+
+        RelayEnvelopeView view;
+        expect(DecodeRelayEnvelope(envelope.data(), envelope.size(), &view), "decode failed");
+        expect(view.session_id == "session_a" && view.round == 3 && view.from_player == 2, "header mismatch");
+        expect(view.payload == "payload_bytes", "payload mismatch");
+        expect(view.size == envelope.size(), "size mismatch");
+        expect(view.AddressedTo(1) && view.AddressedTo(3) && !view.AddressedTo(2), "recipients mismatch");
+
+        std::vector<uint8_t> broadcast = EncodeRelayEnvelope("session_a", 1, 1, {}, std::string());
+        expect(DecodeRelayEnvelope(broadcast.data(), broadcast.size(), &view) && view.AddressedTo(42), "broadcast envelope");
+    });
+
+    run_test("Malformed Envelope Rejected", []() {
+        std::vector<uint8_t> envelope = EncodeRelayEnvelope("session_b", 1, 1, {}, std::string(100, 'x'));
+        RelayEnvelopeView view;
+
+        expect(!DecodeRelayEnvelope(envelope.data(), envelope.size() - 4, &view), "truncated envelope accepted");
+        expect(!DecodeRelayEnvelope(envelope.data(), sizeof(RelayEnvelopeHeader) - 1, &view), "short header accepted");
+
+        std::vector<uint8_t> bad_magic = envelope;
+        bad_magic[0] ^= 0xFF;
+        expect(!DecodeRelayEnvelope(bad_magic.data(), bad_magic.size(), &view), "bad magic accepted");
+
+        std::vector<uint8_t> oversized = envelope;
+        uint32_t huge = 0xFFFFFFF0;
+        memcpy(oversized.data() + offsetof(RelayEnvelopeHeader, payload_length), &huge, sizeof(huge));
+        expect(!DecodeRelayEnvelope(oversized.data(), oversized.size(), &view), "oversized payload length accepted");
+    });
+
+    run_test("Composed Checksum Matches Flat Body", []() {
+        std::vector<Segment> segments;
+        std::vector<uint32_t> checksums;
+        for (uint64_t player = 1; player <= 3; ++player) {
+            // 길이가 4의 배수가 아닌 payload도 padding으로 정렬됨
+            auto envelope = std::make_shared<const std::vector<uint8_t>>(
+                EncodeRelayEnvelope("session_c", 1, player, {}, std::string(97 + player, static_cast<char>('0' + player))));
+            checksums.push_back(MessageHeader::ComputeChecksum(*envelope));
+            segments.push_back(envelope);
+        }
+
+        NetworkMessage frame = BuildRelayFrame(MakeRoundMessage("session_c", 2, 1), segments, checksums);
+        NetworkMessage flat = Flatten(frame);
+        expect(flat.body.size() == frame.header.body_length, "body length mismatch");
+        expect(flat.Validate() == ValidationResult::OK, "composed checksum does not validate");
+        expect(frame.GetTotalSize() == sizeof(MessageHeader) + flat.body.size(), "total size ignores segments");
+
+        std::string_view request;
+        std::vector<RelayEnvelopeView> envelopes;
+        expect(DecodeRelayFrame(flat.body, &request, &envelopes), "frame decode failed");
+        expect(envelopes.size() == 3 && envelopes[2].from_player == 3, "envelopes mismatch");
+
+        CoordinatorNodeMessage parsed;
+        expect(parsed.ParseFromArray(request.data(), static_cast<int>(request.size())) &&
+               parsed.mpc_round_request().round() == 2, "embedded round request mismatch");
+
+        flat.body.pop_back();
+        expect(!DecodeRelayFrame(flat.body, &request, &envelopes), "truncated frame accepted");
+    });
+
+    run_test("Node Relays Rounds As Envelopes", [&router]() {
+        const std::string session_id = "relay_node_session";
+        std::vector<Segment> segments;
+        std::vector<uint32_t> checksums;
+
+        // round 1: envelope 없이 시작 → 참여자별 envelope 응답
+        for (uint64_t player : { 1, 2, 3 }) {
+            NetworkMessage frame = Flatten(BuildRelayFrame(MakeRoundMessage(session_id, 1, player), {}, {}));
+            NetworkMessage response = router.Process(frame);
+            expect(response.header.message_type == static_cast<uint16_t>(MessageType::MPC_RELAY_ROUND), "round 1 not an envelope");
+            expect(response.Validate() == ValidationResult::OK, "round 1 response invalid");
+
+            RelayEnvelopeView view;
+            expect(DecodeRelayEnvelope(response.body.data(), response.body.size(), &view), "round 1 envelope decode failed");
+            expect(view.session_id == session_id && view.round == 1 && view.from_player == player, "round 1 routing header");
+            checksums.push_back(response.header.checksum);
+            segments.push_back(std::make_shared<const std::vector<uint8_t>>(std::move(response.body)));
+        }
+
+        // round 2: 같은 envelope 버퍼를 세 수신자가 공유
+        std::string first_output;
+        for (uint64_t player : { 1, 2, 3 }) {
+            NetworkMessage frame = Flatten(BuildRelayFrame(MakeRoundMessage(session_id, 2, player), segments, checksums));
+            expect(frame.Validate() == ValidationResult::OK, "round 2 frame invalid");
+            NetworkMessage response = router.Process(frame);
+
+            RelayEnvelopeView view;
+            expect(DecodeRelayEnvelope(response.body.data(), response.body.size(), &view), "round 2 envelope decode failed");
+            expect(view.round == 2 && view.from_player == player, "round 2 routing header");
+            expect(view.payload.rfind("R2_P" + std::to_string(player) + "_", 0) == 0, "unexpected round 2 output");
+        }
+        expect(segments[0].use_count() == 1, "segment still referenced");
+    });
+
+    run_test("Mismatched Envelope Rejected", [&router]() {
+        // 다른 세션의 envelope가 섞이면 protobuf 에러 응답
+        NetworkMessage round1 = Flatten(BuildRelayFrame(MakeRoundMessage("relay_reject_session", 1, 1), {}, {}));
+        expect(router.Process(round1).header.message_type == static_cast<uint16_t>(MessageType::MPC_RELAY_ROUND), "round 1 failed");
+
+        auto foreign = std::make_shared<const std::vector<uint8_t>>(EncodeRelayEnvelope("other_session", 1, 2, {}, "x"));
+        NetworkMessage frame = Flatten(BuildRelayFrame(MakeRoundMessage("relay_reject_session", 2, 1), { foreign },
+                                                       { MessageHeader::ComputeChecksum(*foreign) }));
+        NetworkMessage response = router.Process(frame);
+
+        RelayEnvelopeView view;
+        expect(!DecodeRelayEnvelope(response.body.data(), response.body.size(), &view), "error returned as envelope");
+        CoordinatorNodeMessage parsed;
+        expect(parsed.ParseFromArray(response.body.data(), static_cast<int>(response.body.size())), "error response not protobuf");
+        expect(parsed.has_error_response() && parsed.error_response().code() == NODE_ERROR_INVALID, "expected NODE_ERROR_INVALID");
+
+        // envelope가 아닌 body
+        NetworkMessage garbage(static_cast<uint16_t>(MessageType::MPC_RELAY_ROUND), std::string("not a relay frame"));
+        response = router.Process(garbage);
+        expect(parsed.ParseFromArray(response.body.data(), static_cast<int>(response.body.size())) &&
+               parsed.has_error_response(), "garbage frame not rejected");
+    });
+
+    // ===== 성능 측정 =====
+    std::cout << "\n=== Performance (coordinator relay per round, 3 participants) ===" << std::endl;
+    {
+        const size_t participants = 3;
+        const std::vector<size_t> payload_sizes = { 256, 4 * 1024, 64 * 1024, 256 * 1024 };
+        std::vector<double> legacy_ns;
+        std::vector<double> opaque_ns;
+
+        for (size_t payload_size : payload_sizes) {
+            const int iterations = payload_size >= 64 * 1024 ? 200 : 2000;
+            std::vector<NetworkMessage> protobuf_responses = MakeProtobufResponses(participants, payload_size);
+            std::vector<NetworkMessage> envelope_responses = MakeEnvelopeResponses(participants, payload_size);
+
+            double legacy_total = 0;
+            double opaque_total = 0;
+            for (int i = 0; i < iterations; ++i) {
+                legacy_total += LegacyRelayRound(protobuf_responses, participants);
+                std::vector<NetworkMessage> received = envelope_responses;     // 수신 버퍼 (측정 밖)
+                std::vector<Segment> retained;
+                opaque_total += OpaqueRelayRound(received, participants, &retained);
+            }
+            legacy_ns.push_back(legacy_total / iterations);
+            opaque_ns.push_back(opaque_total / iterations);
+
+            std::cout << "[PERF] payload " << payload_size << "B: parse + re-serialize " << legacy_ns.back()
+                      << " ns/round, opaque envelope " << opaque_ns.back() << " ns/round" << std::endl;
+        }
+
+        run_test("Opaque Relay Cost Independent Of Payload", [&]() {
+            // payload 1024배에도 같은 자릿수 (중계 작업이 payload를 건드리지 않음 - 남는 증가분은 큰 버퍼의 cache miss)
+            expect(opaque_ns.back() < opaque_ns.front() * 10, "opaque relay cost grows with payload size");
+            expect(opaque_ns.back() * 10 < legacy_ns.back(), "opaque relay not cheaper than re-serialization");
+        });
+    }
+
+    return 0;
+}
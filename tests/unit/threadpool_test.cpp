@@ -20,6 +20,16 @@ struct ComplexContext {
     std::atomic<bool>* completed;
 };
 
+struct PlacementContext {
+    std::atomic<int>* cpu;
+    std::atomic<bool>* done;
+};
+
+struct GateContext {
+    std::atomic<bool>* release;
+    std::atomic<int>* done;
+};
+
 // 테스트 함수들
 void simple_task(SimpleContext* ctx) {
     ctx->counter->fetch_add(ctx->value);
@@ -30,6 +40,13 @@ void complex_task(ComplexContext* ctx) {
     ctx->completed->store(true);
 }
 
+void gated_task(GateContext* ctx) {
+    while (!ctx->release->load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ctx->done->fetch_add(1);
+}
+
 void exception_task([[maybe_unused]] SimpleContext* ctx) {
     throw std::runtime_error("Test exception");
 }
@@ -247,6 +264,92 @@ int main() {
         }
     });
 
+    // Test 9: TrySubmitOwned - 큐 포화 시 대기 없이 FULL
+    run_test("TrySubmitOwned (Full Queue)", []() {
+        ThreadPool<GateContext> pool(1);  // 큐 용량 100
+        std::atomic<bool> release{false};
+        std::atomic<int> done{0};
+
+        // 워커 1개를 붙잡고 큐를 가득 채움
+        pool.SubmitOwned(gated_task, std::make_unique<GateContext>(GateContext{&release, &done}));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        int accepted = 0;
+        QueueResult result = QueueResult::SUCCESS;
+        auto start = std::chrono::steady_clock::now();
+        while (accepted < 1000) {
+            result = pool.TrySubmitOwned(gated_task, std::make_unique<GateContext>(GateContext{&release, &done}));
+            if (result != QueueResult::SUCCESS) break;
+            ++accepted;
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        if (result != QueueResult::FULL || accepted != 100) {
+            throw std::runtime_error(std::string("Expected FULL after 100, got ") + QueueResultToString(result) +
+                " after " + std::to_string(accepted));
+        }
+        if (elapsed > 100) {
+            throw std::runtime_error("TrySubmitOwned blocked: " + std::to_string(elapsed) + "ms");
+        }
+
+        release.store(true);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (done.load() < accepted + 1 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (done.load() != accepted + 1) {
+            throw std::runtime_error("Accepted tasks not executed: " + std::to_string(done.load()));
+        }
+
+        pool.Shutdown();
+        if (pool.TrySubmitOwned(gated_task, std::make_unique<GateContext>(GateContext{&release, &done})) != QueueResult::SHUTDOWN) {
+            throw std::runtime_error("Expected SHUTDOWN after Shutdown()");
+        }
+    });
+
+    // Test: CpuSet 파싱
+    run_test("CpuSet Parse", []() {
+        CpuSet cpus;
+        if (!CpuSet::Parse("0-3, 8,10-11,2", cpus) || cpus.Size() != 7 || cpus.ToString() != "0-3,8,10-11") {
+            throw std::runtime_error("Unexpected parse result: " + cpus.ToString());
+        }
+        for (const char* invalid : {"", "3-1", "a", "1,,2", "-1", "0-", "99999"}) {
+            CpuSet rejected;
+            if (CpuSet::Parse(invalid, rejected)) {
+                throw std::runtime_error(std::string("Accepted invalid cpuset: '") + invalid + "'");
+            }
+        }
+    });
+
+    // Test: 워커 CPU 고정 - 작업이 지정한 CPU에서만 실행되어야 함
+    run_test("Worker Placement", []() {
+        ThreadPlacement placement;
+        CpuSet::Parse("0", placement.cpus);
+        placement.per_worker = true;
+        placement.numa_local_memory = true;
+
+        ThreadPool<PlacementContext> pool(2, placement);
+        for (int i = 0; i < 10; ++i) {
+            std::atomic<int> cpu{-1};
+            std::atomic<bool> done{false};
+            PlacementContext ctx{&cpu, &done};
+            pool.SubmitBorrowed([](PlacementContext* c) {
+                c->cpu->store(sched_getcpu());
+                c->done->store(true);
+            }, &ctx);
+            while (!done.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            if (cpu.load() != 0) {
+                throw std::runtime_error("Task ran on cpu " + std::to_string(cpu.load()));
+            }
+        }
+        if (pool.GetPlacementFailureCount() != 0) {
+            throw std::runtime_error("Placement failed on " + std::to_string(pool.GetPlacementFailureCount()) + " workers");
+        }
+    });
+
     // 성능 테스트
     std::cout << std::endl;
     std::cout << "[PERF] Performance Test" << std::endl;
@@ -0,0 +1,312 @@
+// tests/unit/wallet_admission_test.cpp
+#include "coordinator/network/wallet_server/include/WalletAdmissionController.hpp"
+#include "common/utils/threading/ThreadPool.hpp"
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mpc_engine::utils;
+using namespace mpc_engine::coordinator::network::wallet_server;
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void expect(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+TenantLimit make_limit(double rps, double burst, size_t max_concurrent, uint32_t weight = 1) {
+    TenantLimit limit;
+    limit.requests_per_second = rps;
+    limit.burst = burst;
+    limit.max_concurrent = max_concurrent;
+    limit.weight = weight;
+    return limit;
+}
+
+// 디스패치 순서 기록 (handler pool 대신)
+struct DispatchLog {
+    std::mutex mutex;
+    std::vector<std::string> order;
+
+    WalletAdmissionController::Work Record(const std::string& tenant_id) {
+        return [this, tenant_id]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(tenant_id);
+        };
+    }
+};
+
+// ===== 벤치마크 =====
+// handler thread 4개, 요청 1개 처리 1ms - noisy tenant가 한꺼번에 몰린 뒤 quiet tenant 요청의 대기 시간
+struct Job {
+    std::chrono::steady_clock::time_point submitted;
+    std::string tenant_id;
+    WalletAdmissionController* admission = nullptr;
+    std::mutex* latency_mutex = nullptr;
+    std::vector<double>* quiet_latencies_ms = nullptr;
+};
+
+void ProcessJob(Job* job) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (job->tenant_id == "quiet") {
+        double waited = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - job->submitted).count();
+        std::lock_guard<std::mutex> lock(*job->latency_mutex);
+        job->quiet_latencies_ms->push_back(waited);
+    }
+    if (job->admission) {
+        job->admission->Complete(job->tenant_id);
+    }
+}
+
+std::vector<double> run_noisy_neighbor(bool fair, size_t noisy_requests, size_t quiet_requests) {
+    const size_t handler_threads = 4;
+    ThreadPool<Job> pool(handler_threads);
+    WalletAdmissionController admission(handler_threads, WalletAdmissionConfig());
+    std::mutex latency_mutex;
+    std::vector<double> latencies;
+
+    auto submit = [&](const std::string& tenant_id) {
+        auto job = std::make_unique<Job>();
+        job->submitted = std::chrono::steady_clock::now();
+        job->tenant_id = tenant_id;
+        job->latency_mutex = &latency_mutex;
+        job->quiet_latencies_ms = &latencies;
+        if (!fair) {
+            pool.SubmitOwned(ProcessJob, std::move(job));
+            return;
+        }
+        job->admission = &admission;
+        auto pending = std::make_shared<std::unique_ptr<Job>>(std::move(job));
+        admission.Submit(tenant_id, [&pool, pending]() { pool.SubmitOwned(ProcessJob, std::move(*pending)); });
+    };
+
+    for (size_t i = 0; i < noisy_requests; ++i) {
+        submit("noisy");
+    }
+    for (size_t i = 0; i < quiet_requests; ++i) {
+        submit("quiet");
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(latency_mutex);
+            if (latencies.size() == quiet_requests) {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    // CoordinatorHttpsServer::Stop과 같은 순서 - 대기 중인 noisy 요청은 폐기
+    admission.Shutdown();
+    pool.Shutdown();
+    std::sort(latencies.begin(), latencies.end());
+    return latencies;
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+    size_t index = std::min(sorted.size() - 1, static_cast<size_t>(p * static_cast<double>(sorted.size())));
+    return sorted[index];
+}
+
+int main() {
+    std::cout << "=== WalletAdmissionController Tests ===" << std::endl;
+
+    // Test 1: token bucket - burst 소진 후 Retry-After와 함께 거절
+    run_test("Token Bucket Rate Limit", []() {
+        WalletAdmissionConfig config;
+        config.default_limit = make_limit(0.5, 3, 0);
+        WalletAdmissionController admission(64, config);
+        DispatchLog log;
+        for (int i = 0; i < 3; ++i) {
+            expect(admission.Submit("t", log.Record("t")).Admitted(), "burst request rejected");
+        }
+        AdmissionDecision decision = admission.Submit("t", log.Record("t"));
+        expect(decision.status == AdmissionStatus::RATE_LIMITED, AdmissionStatusToString(decision.status));
+        expect(decision.retry_after.count() == 2, "retry after " + std::to_string(decision.retry_after.count()));
+        expect(admission.Submit("other", log.Record("other")).Admitted(), "other tenant limited");
+    });
+
+    // Test 2: tenant 동시 요청 상한 (대기 + 처리 중)
+    run_test("Concurrency Cap", []() {
+        WalletAdmissionConfig config;
+        config.default_limit = make_limit(0, 0, 2);
+        WalletAdmissionController admission(1, config);
+        DispatchLog log;
+        expect(admission.Submit("t", log.Record("t")).Admitted(), "first");
+        expect(admission.Submit("t", log.Record("t")).Admitted(), "second (queued)");
+        AdmissionDecision decision = admission.Submit("t", log.Record("t"));
+        expect(decision.status == AdmissionStatus::CONCURRENCY_LIMITED, AdmissionStatusToString(decision.status));
+        expect(decision.retry_after.count() >= 1, "missing retry after");
+
+        admission.Complete("t");
+        expect(log.order.size() == 2, "queued request not dispatched after completion");
+        expect(admission.Submit("t", log.Record("t")).Admitted(), "slot not released");
+    });
+
+    // Test 3: 전체 대기열 상한
+    run_test("Global Queue Bound", []() {
+        WalletAdmissionConfig config;
+        config.max_queued = 2;
+        WalletAdmissionController admission(1, config);
+        DispatchLog log;
+        expect(admission.Submit("a", log.Record("a")).Admitted(), "dispatched");
+        expect(admission.Submit("b", log.Record("b")).Admitted(), "queued 1");
+        expect(admission.Submit("c", log.Record("c")).Admitted(), "queued 2");
+        expect(admission.Submit("d", log.Record("d")).status == AdmissionStatus::OVERLOADED, "queue bound ignored");
+        expect(admission.GetQueuedCount() == 2, "queued count");
+    });
+
+    // Test 4: deficit round robin - 먼저 몰린 tenant가 있어도 다른 tenant 차례가 옴
+    run_test("Deficit Round Robin", []() {
+        WalletAdmissionController admission(1, WalletAdmissionConfig());
+        DispatchLog log;
+        for (int i = 0; i < 50; ++i) {
+            admission.Submit("noisy", log.Record("noisy"));
+        }
+        for (int i = 0; i < 3; ++i) {
+            admission.Submit("quiet", log.Record("quiet"));
+        }
+        for (int i = 0; i < 8; ++i) {
+            admission.Complete(log.order.back());
+        }
+        // 첫 noisy(이미 디스패치) 이후 noisy / quiet 교대
+        std::string order;
+        for (const std::string& tenant_id : log.order) {
+            order += tenant_id == "quiet" ? 'q' : 'n';
+        }
+        expect(order == "nnqnqnqnn", "dispatch order " + order);
+    });
+
+    // Test 5: weight - 라운드당 weight개씩
+    run_test("Weighted Quantum", []() {
+        WalletAdmissionConfig config;
+        config.tenants["gold"] = make_limit(0, 0, 0, 3);
+        WalletAdmissionController admission(1, config);
+        DispatchLog log;
+        admission.Submit("blocker", log.Record("blocker"));
+        for (int i = 0; i < 20; ++i) {
+            admission.Submit("gold", log.Record("gold"));
+            admission.Submit("basic", log.Record("basic"));
+        }
+        for (int i = 0; i < 16; ++i) {
+            admission.Complete(log.order.back());
+        }
+        size_t gold = std::count(log.order.begin() + 1, log.order.end(), std::string("gold"));
+        size_t basic = std::count(log.order.begin() + 1, log.order.end(), std::string("basic"));
+        expect(gold == 12 && basic == 4, "gold " + std::to_string(gold) + ", basic " + std::to_string(basic));
+    });
+
+    // Test 6: 한도 파일 + 운영 중 교체
+    run_test("Reload Limits", []() {
+        std::string path = "/tmp/wallet_admission_test_limits";
+        {
+            std::ofstream file(path);
+            file << "# tenant limits\n";
+            file << "*      rps=100 concurrency=10\n";
+            file << "tenant-a rps=1 burst=1   # small tenant\n";
+            file << "tenant-b weight=4 key=secret-b1 key=secret-b2\n";
+        }
+        WalletAdmissionConfig config;
+        std::string error;
+        expect(LoadWalletAdmissionLimits(path, &config, &error), error);
+        expect(config.default_limit.requests_per_second == 100 && config.default_limit.max_concurrent == 10, "default");
+        expect(config.LimitFor("tenant-a").burst == 1, "tenant-a burst");
+        expect(config.LimitFor("tenant-b").weight == 4 && config.LimitFor("tenant-b").requests_per_second == 100,
+               "tenant-b should inherit the default");
+
+        // tenant는 인증된 identity로만 - 모르는 key / 등록되지 않은 CN은 default 하나로
+        expect(config.ResolveTenant("secret-b2", "") == "tenant-b", "API key not mapped");
+        expect(config.ResolveTenant("secret-b1", "tenant-a") == "tenant-b", "API key should take precedence");
+        expect(config.ResolveTenant("", "tenant-a") == "tenant-a", "client certificate not mapped");
+        expect(config.ResolveTenant("tenant-b", "") == DEFAULT_TENANT, "unknown API key got its own tenant");
+        expect(config.ResolveTenant("forged", "wallet-server-7") == DEFAULT_TENANT, "unregistered identity got its own tenant");
+
+        {
+            std::ofstream file(path);
+            file << "tenant-b weight=4\n";
+        }
+        WalletAdmissionConfig reloaded = config;
+        expect(LoadWalletAdmissionLimits(path, &reloaded, &error) && reloaded.ResolveTenant("secret-b1", "") == DEFAULT_TENANT,
+               "API key removed from the file still accepted");
+
+        {
+            std::ofstream file(path);
+            file << "tenant-c rps=abc\n";
+        }
+        WalletAdmissionConfig broken;
+        expect(!LoadWalletAdmissionLimits(path, &broken, &error), "invalid value accepted");
+        {
+            std::ofstream file(path);
+            file << "* key=shared\n";
+        }
+        expect(!LoadWalletAdmissionLimits(path, &broken, &error), "API key on the default tenant accepted");
+        std::remove(path.c_str());
+
+        WalletAdmissionController admission(64, WalletAdmissionConfig());
+        DispatchLog log;
+        for (int i = 0; i < 5; ++i) {
+            expect(admission.Submit("tenant-a", log.Record("tenant-a")).Admitted(), "unlimited before reload");
+        }
+        admission.SetConfig(config);
+        expect(admission.Submit("tenant-a", log.Record("tenant-a")).Admitted(), "bucket clamped to new burst");
+        expect(admission.Submit("tenant-a", log.Record("tenant-a")).status == AdmissionStatus::RATE_LIMITED, "new limit ignored");
+    });
+
+    // Test 7: 종료 시 대기 요청 폐기 + 이후 거절
+    run_test("Shutdown Drops Queue", []() {
+        WalletAdmissionController admission(1, WalletAdmissionConfig());
+        auto marker = std::make_shared<int>(0);
+        std::weak_ptr<int> watch = marker;
+        admission.Submit("t", []() {});
+        admission.Submit("t", [marker]() {});
+        marker.reset();
+        expect(!watch.expired(), "queued work released early");
+        admission.Shutdown();
+        expect(watch.expired(), "queued work not released");
+        expect(admission.Submit("t", []() {}).status == AdmissionStatus::OVERLOADED, "submit after shutdown");
+    });
+
+    // ===== 성능 측정 =====
+    std::cout << "\n=== Performance (4 handler threads, 1ms per request, 400 noisy + 20 quiet requests) ===" << std::endl;
+    {
+        std::vector<double> fifo = run_noisy_neighbor(false, 400, 20);
+        std::vector<double> fair = run_noisy_neighbor(true, 400, 20);
+        std::cout << "[PERF] quiet tenant, single FIFO queue: p50 " << percentile(fifo, 0.5) << "ms, p99 " << percentile(fifo, 0.99) << "ms" << std::endl;
+        std::cout << "[PERF] quiet tenant, DRR admission:     p50 " << percentile(fair, 0.5) << "ms, p99 " << percentile(fair, 0.99) << "ms" << std::endl;
+    }
+
+    {
+        WalletAdmissionConfig config;
+        config.default_limit = make_limit(1e9, 1e9, 0);
+        WalletAdmissionController admission(1 << 20, config);
+        const int iterations = 200000;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            admission.Submit(i % 2 ? "a" : "b", []() {});
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[PERF] Submit (admit + dispatch): " << elapsed / iterations << " ns/op" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,256 @@
+// tests/unit/wallet_request_dedup_test.cpp
+#include "coordinator/handlers/wallet/include/WalletRequestDeduplicator.hpp"
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <string>
+
+using namespace mpc_engine::coordinator::handlers::wallet;
+
+// 테스트 유틸리티
+template<typename TFunc>
+void run_test(const char* name, TFunc test) {
+    try {
+        test();
+        std::cout << "[PASS] " << name << std::endl;
+    } catch (const std::exception& e) {
+        std::cout << "[FAIL] " << name << ": " << e.what() << std::endl;
+    }
+}
+
+void expect(bool condition, const std::string& message) {
+    if (!condition) {
+        throw std::runtime_error(message);
+    }
+}
+
+std::unique_ptr<WalletCoordinatorMessage> make_response(const std::string& signature, bool success = true) {
+    auto message = std::make_unique<WalletCoordinatorMessage>();
+    message->mutable_signing_response()->mutable_header()->set_success(success);
+    message->mutable_signing_response()->set_final_signature(signature);
+    return message;
+}
+
+int main() {
+    std::cout << "=== WalletRequestDeduplicator Tests ===" << std::endl;
+
+    // Test 1: 동시 중복 요청 - 한 번만 실행하고 모두 같은 결과
+    run_test("Singleflight", []() {
+        WalletRequestDeduplicator dedup;
+        std::atomic<int> executions{0};
+        std::atomic<int> joined{0};
+        std::vector<std::string> signatures(16);
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 16; ++i) {
+            threads.emplace_back([&, i]() {
+                WalletDedupOutcome outcome;
+                auto response = dedup.Execute("tenant-a", "req-1", "fp-42", [&]() {
+                    executions++;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    return make_response("sig-" + std::to_string(executions.load()));
+                }, &outcome);
+                joined += (outcome == WalletDedupOutcome::JOINED) ? 1 : 0;
+                signatures[i] = response ? response->signing_response().final_signature() : "";
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        expect(executions == 1, "executed " + std::to_string(executions.load()) + " times");
+        expect(joined == 15, "joined " + std::to_string(joined.load()));
+        for (const std::string& signature : signatures) {
+            expect(signature == "sig-1", "duplicate got a different result: " + signature);
+        }
+        expect(dedup.GetStats().in_flight == 0 && dedup.GetStats().entries == 1, "entry not completed");
+    });
+
+    // Test 2: 늦은 재시도 - 보관된 결과 반환
+    run_test("Cached Retry", []() {
+        WalletRequestDeduplicator dedup;
+        int executions = 0;
+        auto work = [&]() { executions++; return make_response("sig"); };
+        dedup.Execute("tenant-a", "req-1", "fp-1", work);
+
+        WalletDedupOutcome outcome;
+        auto response = dedup.Execute("tenant-a", "req-1", "fp-1", work, &outcome);
+        expect(executions == 1, "retry re-executed");
+        expect(outcome == WalletDedupOutcome::CACHED, "outcome " + std::string(WalletDedupOutcomeToString(outcome)));
+        expect(response && response->signing_response().final_signature() == "sig", "cached response mismatch");
+        expect(dedup.GetStats().HitRate() == 0.5, "hit rate");
+    });
+
+    // Test 3: 실패 응답은 보관하지 않음 - 재시도가 다시 실행
+    run_test("Failures Not Cached", []() {
+        WalletRequestDeduplicator dedup;
+        int executions = 0;
+        dedup.Execute("tenant-a", "req-1", "fp-1", [&]() { executions++; return make_response("", false); });
+
+        WalletDedupOutcome outcome;
+        auto response = dedup.Execute("tenant-a", "req-1", "fp-1", [&]() { executions++; return make_response("sig"); }, &outcome);
+        expect(executions == 2 && outcome == WalletDedupOutcome::EXECUTED, "failed request was cached");
+        expect(response->signing_response().header().success(), "retry result");
+    });
+
+    // Test 4: 같은 request_id, 다른 payload
+    run_test("Payload Conflict", []() {
+        WalletRequestDeduplicator dedup;
+        dedup.Execute("tenant-a", "req-1", "fp-1", []() { return make_response("sig"); });
+
+        WalletDedupOutcome outcome;
+        bool executed = false;
+        auto response = dedup.Execute("tenant-a", "req-1", "fp-2", [&]() { executed = true; return make_response("other"); }, &outcome);
+        expect(!response && !executed && outcome == WalletDedupOutcome::CONFLICT, "conflicting payload executed");
+        expect(dedup.GetStats().conflicts == 1, "conflict not counted");
+    });
+
+    // Test 5: TTL 만료 후 재실행
+    run_test("TTL Expiry", []() {
+        WalletRequestDedupConfig config;
+        config.ttl = std::chrono::milliseconds(50);
+        WalletRequestDeduplicator dedup(config);
+        int executions = 0;
+        auto work = [&]() { executions++; return make_response("sig"); };
+        dedup.Execute("tenant-a", "req-1", "fp-1", work);
+        std::this_thread::sleep_for(std::chrono::milliseconds(80));
+        dedup.Execute("tenant-a", "req-1", "fp-1", work);
+        expect(executions == 2, "expired entry served");
+        expect(dedup.GetStats().expired == 1, "expiry not counted");
+    });
+
+    // Test 6: 보관 수 상한 - 오래된 것부터 제거, 메모리 사용량 추적
+    run_test("Bounded Table", []() {
+        WalletRequestDedupConfig config;
+        config.max_entries = 100;
+        WalletRequestDeduplicator dedup(config);
+        for (int i = 0; i < 1000; ++i) {
+            dedup.Execute("tenant-a", "req-" + std::to_string(i), "fp-1", []() { return make_response(std::string(130, 's')); });
+        }
+        WalletRequestDedupStats stats = dedup.GetStats();
+        expect(stats.entries == 100 && stats.evicted == 900, "table not bounded: " + std::to_string(stats.entries));
+        expect(stats.memory_bytes > 100 * 130 && stats.memory_bytes < 100 * 4096, "memory estimate " + std::to_string(stats.memory_bytes));
+
+        WalletDedupOutcome outcome;
+        dedup.Execute("tenant-a", "req-999", "fp-1", []() { return make_response("x"); }, &outcome);
+        expect(outcome == WalletDedupOutcome::CACHED, "newest entry evicted");
+        dedup.Execute("tenant-a", "req-0", "fp-1", []() { return make_response("x"); }, &outcome);
+        expect(outcome == WalletDedupOutcome::EXECUTED, "oldest entry kept");
+
+        config.max_entries = 10;
+        dedup.Configure(config);
+        expect(dedup.GetStats().entries == 10, "shrink not applied");
+    });
+
+    // Test 7: request_id 없음 / 끔 - 매번 실행
+    run_test("Bypass", []() {
+        WalletRequestDeduplicator dedup;
+        int executions = 0;
+        WalletDedupOutcome outcome;
+        dedup.Execute("tenant-a", "", "fp-1", [&]() { executions++; return make_response("sig"); }, &outcome);
+        dedup.Execute("tenant-a", "", "fp-1", [&]() { executions++; return make_response("sig"); }, &outcome);
+        expect(executions == 2 && outcome == WalletDedupOutcome::BYPASSED, "empty request id deduplicated");
+
+        dedup.Configure(WalletRequestDedupConfig{ 0, std::chrono::milliseconds(1000) });
+        dedup.Execute("tenant-a", "req-1", "fp-1", [&]() { executions++; return make_response("sig"); });
+        dedup.Execute("tenant-a", "req-1", "fp-1", [&]() { executions++; return make_response("sig"); }, &outcome);
+        expect(executions == 4 && outcome == WalletDedupOutcome::BYPASSED, "disabled dedup still deduplicated");
+    });
+
+    // Test 8: 실행 중 예외 - 대기자는 nullptr, 이후 재시도는 다시 실행
+    run_test("Work Exception", []() {
+        WalletRequestDeduplicator dedup;
+        std::atomic<bool> started{false};
+        std::unique_ptr<WalletCoordinatorMessage> waiter_response = make_response("placeholder");
+
+        std::thread leader([&]() {
+            try {
+                dedup.Execute("tenant-a", "req-1", "fp-1", [&]() -> std::unique_ptr<WalletCoordinatorMessage> {
+                    started = true;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                    throw std::runtime_error("backend failure");
+                });
+            } catch (const std::exception&) {}
+        });
+        while (!started) std::this_thread::yield();
+        waiter_response = dedup.Execute("tenant-a", "req-1", "fp-1", []() { return make_response("never"); });
+        leader.join();
+
+        expect(!waiter_response, "waiter should share the failed (empty) result");
+        WalletDedupOutcome outcome;
+        dedup.Execute("tenant-a", "req-1", "fp-1", []() { return make_response("sig"); }, &outcome);
+        expect(outcome == WalletDedupOutcome::EXECUTED, "failed request was not retried");
+    });
+
+    // Test 9: tenant마다 별도 범위 - 같은 request_id라도 결과를 공유하지 않음
+    run_test("Tenant Scoped", []() {
+        WalletRequestDeduplicator dedup;
+        dedup.Execute("tenant-a", "req-1", "fp-1", []() { return make_response("sig-a"); });
+
+        WalletDedupOutcome outcome;
+        auto response = dedup.Execute("tenant-b", "req-1", "fp-2", []() { return make_response("sig-b"); }, &outcome);
+        expect(outcome == WalletDedupOutcome::EXECUTED, "outcome " + std::string(WalletDedupOutcomeToString(outcome)));
+        expect(response && response->signing_response().final_signature() == "sig-b", "got another tenant's result");
+
+        dedup.Execute("tenant-a", "req-1", "fp-1", []() { return make_response("x"); }, &outcome);
+        expect(outcome == WalletDedupOutcome::CACHED, "same tenant retry not cached");
+    });
+
+    // Test 10: 실행 중 결과 대기는 호출자 기한까지만
+    run_test("Join Deadline", []() {
+        WalletRequestDeduplicator dedup;
+        std::atomic<bool> started{false};
+        std::atomic<bool> release{false};
+
+        std::thread leader([&]() {
+            dedup.Execute("tenant-a", "req-1", "fp-1", [&]() {
+                started = true;
+                while (!release) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                return make_response("sig");
+            });
+        });
+        while (!started) std::this_thread::yield();
+
+        WalletDedupOutcome outcome;
+        auto start = std::chrono::steady_clock::now();
+        auto response = dedup.Execute("tenant-a", "req-1", "fp-1", []() { return make_response("never"); }, &outcome,
+                                      std::chrono::steady_clock::now() + std::chrono::milliseconds(50));
+        auto waited = std::chrono::steady_clock::now() - start;
+        release = true;
+        leader.join();
+
+        expect(!response && outcome == WalletDedupOutcome::DEADLINE_EXCEEDED,
+               "outcome " + std::string(WalletDedupOutcomeToString(outcome)));
+        expect(waited < std::chrono::milliseconds(1000), "waiter ignored its deadline");
+        expect(dedup.GetStats().deadline_exceeded == 1, "deadline not counted");
+
+        dedup.Execute("tenant-a", "req-1", "fp-1", []() { return make_response("x"); }, &outcome);
+        expect(outcome == WalletDedupOutcome::CACHED, "leader result not kept after waiter gave up");
+    });
+
+    // ===== 성능 측정 =====
+    std::cout << "\n=== Performance ===" << std::endl;
+    {
+        WalletRequestDeduplicator dedup;
+        const int keys = 10000;
+        for (int i = 0; i < keys; ++i) {
+            dedup.Execute("tenant-a", "perf-" + std::to_string(i), "fp-1", []() { return make_response(std::string(130, 's')); });
+        }
+        WalletRequestDedupStats stats = dedup.GetStats();
+        std::cout << "[PERF] memory: " << stats.memory_bytes / stats.entries << " bytes/entry (" << stats.entries
+                  << " entries, " << stats.memory_bytes / 1024 << " KiB)" << std::endl;
+
+        const int iterations = 200000;
+        size_t sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            auto response = dedup.Execute("tenant-a", "perf-" + std::to_string(i % keys), "fp-1", []() { return make_response("x"); });
+            sink += response->signing_response().final_signature().size();
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[PERF] cached hit: " << elapsed / iterations << " ns/op (" << (sink > 0 ? "ok" : "empty") << ")" << std::endl;
+    }
+
+    return 0;
+}